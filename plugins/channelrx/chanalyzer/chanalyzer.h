@@ -36,6 +36,7 @@ class ChannelAnalyzer : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureChannelAnalyzer : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureChannelAnalyzer)
 
     public:
         const ChannelAnalyzerSettings& getSettings() const { return m_settings; }
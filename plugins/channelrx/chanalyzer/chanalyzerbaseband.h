@@ -35,6 +35,7 @@ class ChannelAnalyzerBaseband : public QObject
 public:
     class MsgConfigureChannelAnalyzerBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureChannelAnalyzerBaseband)
 
     public:
         const ChannelAnalyzerSettings& getSettings() const { return m_settings; }
@@ -54,39 +54,55 @@ ChannelAnalyzerSink::~ChannelAnalyzerSink()
 
 void ChannelAnalyzerSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-	fftfilt::cmplx *sideband = 0;
-
-	for (SampleVector::const_iterator it = begin; it < end; ++it)
-	{
-    	Complex ci;
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
-
-		if (m_decimator.getDecim() == 1)
-		{
-	        processOneSample(c, sideband);
-		}
-		else
-		{
-            if (m_decimator.decimate(c, ci))
+    unsigned int len = end - begin;
+
+    if (m_mixBuffer.size() < len) {
+        m_mixBuffer.resize(len);
+    }
+
+    Complex *buffer = m_mixBuffer.data();
+    m_nco.mix(&(*begin), buffer, len);
+
+    // decimation is done in place as there are never more output than input samples
+    if (m_decimator.getDecim() != 1)
+    {
+        len = m_decimator.decimate(buffer, len, buffer);
+
+        if (m_settings.m_rationalDownSample)
+        {
+            unsigned int nbOut = 0;
+
+            for (unsigned int i = 0; i < len; i++)
             {
-                if (m_settings.m_rationalDownSample)
-                {
-                    Complex cj;
+                Complex ci = buffer[i];
 
-                    if (m_interpolator.decimate(&m_interpolatorDistanceRemain, ci, &cj))
-                    {
-                        processOneSample(cj, sideband);
-                        m_interpolatorDistanceRemain += m_interpolatorDistance;
-                    }
-                }
-                else
+                if (m_interpolator.decimate(&m_interpolatorDistanceRemain, ci, &buffer[nbOut]))
                 {
-                    processOneSample(ci, sideband);
+                    nbOut++;
+                    m_interpolatorDistanceRemain += m_interpolatorDistance;
                 }
             }
+
+            len = nbOut;
         }
-	}
+    }
+
+    m_filterBuffer.clear();
+
+    if (m_settings.m_ssb)
+    {
+        SSBFilter->runSSB(buffer, len, m_filterBuffer, m_usb);
+    }
+    else
+    {
+        if (m_settings.m_rrc) {
+            RRCFilter->runFilt(buffer, len, m_filterBuffer);
+        } else {
+            DSBFilter->runDSB(buffer, len, m_filterBuffer);
+        }
+    }
+
+    processFiltered();
 
 	if (m_sampleSink) {
 		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), m_settings.m_ssb); // m_ssb = positive only
@@ -95,49 +111,90 @@ void ChannelAnalyzerSink::feed(const SampleVector::const_iterator& begin, const
 	m_sampleBuffer.clear();
 }
 
-void ChannelAnalyzerSink::processOneSample(Complex& c, fftfilt::cmplx *sideband)
+void ChannelAnalyzerSink::processFiltered()
 {
-    int n_out;
+    unsigned int len = m_filterBuffer.size();
 
-    if (m_settings.m_ssb)
+    if (len == 0) {
+        return;
+    }
+
+    Complex *filtered = m_filterBuffer.data();
+
+    for (unsigned int i = 0; i < len; i++)
     {
-        n_out = SSBFilter->runSSB(c, &sideband, m_usb);
+        Real re = filtered[i].real() / SDR_RX_SCALEF;
+        Real im = filtered[i].imag() / SDR_RX_SCALEF;
+        m_magsq = re*re + im*im;
+        m_channelPowerAvg(m_magsq);
     }
-    else
+
+    if (m_loBuffer.size() < len) {
+        m_loBuffer.resize(len);
+    }
+
+    Complex *lo = m_loBuffer.data();
+
+    if (m_settings.m_pll)
     {
-        if (m_settings.m_rrc) {
-            n_out = RRCFilter->runFilt(c, &sideband);
+        // the loops are insensitive to the input scale
+        if (m_settings.m_fll) {
+            m_fll.feed(filtered, len, lo);
         } else {
-            n_out = DSBFilter->runDSB(c, &sideband);
+            m_pll.feed(filtered, len, lo);
+        }
+
+        // Use -fPLL to mix (exchange PLL real and image in the complex multiplication)
+        for (unsigned int i = 0; i < len; i++) {
+            filtered[i] *= std::conj(lo[i]);
         }
     }
+    else if (m_settings.m_inputType == ChannelAnalyzerSettings::InputPLL)
+    {
+        std::fill(lo, lo + len, m_settings.m_fll ? m_fll.getComplex() : m_pll.getComplex());
+    }
 
-    for (int i = 0; i < n_out; i++)
+    switch (m_settings.m_inputType)
     {
-        fftfilt::cmplx si = sideband[i];
-        Real re = si.real() / SDR_RX_SCALEF;
-        Real im = si.imag() / SDR_RX_SCALEF;
-        m_magsq = re*re + im*im;
-        m_channelPowerAvg(m_magsq);
-        std::complex<float> mix;
+    case ChannelAnalyzerSettings::InputPLL:
+        pushSamples(lo, len, SDR_RX_SCALEF);
+        break;
+    case ChannelAnalyzerSettings::InputAutoCorr:
+    {
+        if (m_corrBuffer.size() < len) {
+            m_corrBuffer.resize(len);
+        }
 
-        if (m_settings.m_pll)
-        {
-            if (m_settings.m_fll)
-            {
-                m_fll.feed(re, im);
-                // Use -fPLL to mix (exchange PLL real and image in the complex multiplication)
-                mix = si * std::conj(m_fll.getComplex());
-            }
-            else
-            {
-                m_pll.feed(re, im);
-                // Use -fPLL to mix (exchange PLL real and image in the complex multiplication)
-                mix = si * std::conj(m_pll.getComplex());
-            }
+        Complex *corr = m_corrBuffer.data();
+
+        for (unsigned int i = 0; i < len; i++) {
+            corr[i] = filtered[i] / SDR_RX_SCALEF;
         }
 
-        feedOneSample(m_settings.m_pll ? mix : si, m_settings.m_fll ? m_fll.getComplex() : m_pll.getComplex());
+        m_corr->run(corr, nullptr, len, corr);
+        pushSamples(corr, len, 1.0f);
+    }
+        break;
+    case ChannelAnalyzerSettings::InputSignal:
+    default:
+        pushSamples(filtered, len, 1.0f);
+        break;
+    }
+}
+
+void ChannelAnalyzerSink::pushSamples(const Complex *samples, unsigned int len, Real scale)
+{
+    if (m_settings.m_ssb & !m_usb) // invert spectrum for LSB
+    {
+        for (unsigned int i = 0; i < len; i++) {
+            m_sampleBuffer.push_back(Sample(samples[i].imag()*scale, samples[i].real()*scale));
+        }
+    }
+    else
+    {
+        for (unsigned int i = 0; i < len; i++) {
+            m_sampleBuffer.push_back(Sample(samples[i].real()*scale, samples[i].imag()*scale));
+        }
     }
 }
 
@@ -18,6 +18,8 @@
 #ifndef INCLUDE_CHANALYZERSINK_H
 #define INCLUDE_CHANALYZERSINK_H
 
+#include <vector>
+
 #include "dsp/channelsamplesink.h"
 #include "dsp/interpolator.h"
 #include "dsp/decimatorc.h"
@@ -82,47 +84,16 @@ private:
 
     BasebandSampleSink* m_sampleSink;
 
+	std::vector<Complex> m_mixBuffer;    //!< mixed then decimated samples
+	std::vector<Complex> m_filterBuffer; //!< filtered samples then mixed with PLL
+	std::vector<Complex> m_loBuffer;     //!< PLL or FLL output
+	std::vector<Complex> m_corrBuffer;   //!< correlator input and output
+
 	void setFilters(int sampleRate, float bandwidth, float lowCutoff);
-	void processOneSample(Complex& c, fftfilt::cmplx *sideband);
+	void processFiltered();
     int getActualSampleRate();
     void applySampleRate();
-
-	inline void feedOneSample(const fftfilt::cmplx& s, const fftfilt::cmplx& pll)
-	{
-	    switch (m_settings.m_inputType)
-	    {
-	        case ChannelAnalyzerSettings::InputPLL:
-            {
-                if (m_settings.m_ssb & !m_usb) { // invert spectrum for LSB
-                    m_sampleBuffer.push_back(Sample(pll.imag()*SDR_RX_SCALEF, pll.real()*SDR_RX_SCALEF));
-                } else {
-                    m_sampleBuffer.push_back(Sample(pll.real()*SDR_RX_SCALEF, pll.imag()*SDR_RX_SCALEF));
-                }
-            }
-	            break;
-	        case ChannelAnalyzerSettings::InputAutoCorr:
-	        {
-                std::complex<float> a = m_corr->run(s/SDR_RX_SCALEF, 0);
-
-                if (m_settings.m_ssb & !m_usb) { // invert spectrum for LSB
-                    m_sampleBuffer.push_back(Sample(a.imag(), a.real()));
-                } else {
-                    m_sampleBuffer.push_back(Sample(a.real(), a.imag()));
-                }
-	        }
-	            break;
-            case ChannelAnalyzerSettings::InputSignal:
-            default:
-            {
-                if (m_settings.m_ssb & !m_usb) { // invert spectrum for LSB
-                    m_sampleBuffer.push_back(Sample(s.imag(), s.real()));
-                } else {
-                    m_sampleBuffer.push_back(Sample(s.real(), s.imag()));
-                }
-            }
-                break;
-	    }
-	}
+    void pushSamples(const Complex *samples, unsigned int len, Real scale);
 };
 
 #endif // INCLUDE_CHANALYZERSINK_H
@@ -22,7 +22,6 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QBuffer>
-#include <QThread>
 
 #include <stdio.h>
 #include <complex.h>
@@ -51,7 +50,7 @@ AMDemod::AMDemod(DeviceAPI *deviceAPI) :
     setObjectName(m_channelId);
 
     m_basebandSink = new AMDemodBaseband();
-    m_basebandSink->moveToThread(&m_thread);
+    setExecutorTask(m_basebandSink->getExecutorTask());
 
 	applySettings(m_settings, true);
 
@@ -93,8 +92,7 @@ void AMDemod::start()
 	qDebug("AMDemod::start");
 
     m_basebandSink->reset();
-    m_basebandSink->startWork();
-    m_thread.start();
+    m_basebandSink->startWork(m_deviceAPI->getDeviceSetIndex());
 
     DSPSignalNotification *dspMsg = new DSPSignalNotification(m_basebandSampleRate, m_centerFrequency);
     m_basebandSink->getInputMessageQueue()->push(dspMsg);
@@ -107,8 +105,6 @@ void AMDemod::stop()
 {
     qDebug("AMDemod::stop");
 	m_basebandSink->stopWork();
-	m_thread.quit();
-	m_thread.wait();
 }
 
 bool AMDemod::handleMessage(const Message& cmd)
@@ -249,6 +245,26 @@ bool AMDemod::deserialize(const QByteArray& data)
     }
 }
 
+bool AMDemod::setSettingsFields(const ChannelSettingsFields& fields)
+{
+    AMDemodSettings settings = m_settings;
+    fields.apply(settings);
+    configureSettings(settings);
+    return true;
+}
+
+void AMDemod::configureSettings(const AMDemodSettings& settings)
+{
+    MsgConfigureAMDemod *msg = MsgConfigureAMDemod::create(settings, false);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureAMDemod *msgToGUI = MsgConfigureAMDemod::create(settings, false);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+}
+
 int AMDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -21,7 +21,6 @@
 #include <vector>
 
 #include <QNetworkRequest>
-#include <QThread>
 
 #include "dsp/basebandsamplesink.h"
 #include "channel/channelapi.h"
@@ -32,7 +31,6 @@
 
 class QNetworkAccessManager;
 class QNetworkReply;
-class QThread;
 class DeviceAPI;
 
 class AMDemod : public BasebandSampleSink, public ChannelAPI {
@@ -40,6 +38,7 @@ class AMDemod : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureAMDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureAMDemod)
 
     public:
         const AMDemodSettings& getSettings() const { return m_settings; }
@@ -74,6 +73,8 @@ public:
     virtual const QString& getURI() const { return m_channelIdURI; }
     virtual void getTitle(QString& title) { title = m_settings.m_title; }
     virtual qint64 getCenterFrequency() const { return m_settings.m_inputFrequencyOffset; }
+    virtual bool setSettingsFields(const ChannelSettingsFields& fields);
+    virtual bool getRfBandwidth(double& rfBandwidth) const { rfBandwidth = m_settings.m_rfBandwidth; return true; }
 
     virtual QByteArray serialize() const;
     virtual bool deserialize(const QByteArray& data);
@@ -128,7 +129,6 @@ public:
 
 private:
 	DeviceAPI *m_deviceAPI;
-    QThread m_thread;
     AMDemodBaseband* m_basebandSink;
     AMDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
@@ -140,6 +140,7 @@ private:
     QNetworkRequest m_networkRequest;
 
     void applySettings(const AMDemodSettings& settings, bool force = false);
+    void configureSettings(const AMDemodSettings& settings); //!< apply and forward to GUI
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const AMDemodSettings& settings, bool force);
 
@@ -25,21 +25,42 @@
 
 MESSAGE_CLASS_DEFINITION(AMDemodBaseband::MsgConfigureAMDemodBaseband, Message)
 
+const int AMDemodBaseband::m_audioSampleRate = 48000;
+
 AMDemodBaseband::AMDemodBaseband() :
     m_running(false),
-    m_mutex(QMutex::Recursive)
+    m_mutex(QMutex::Recursive),
+    m_executorTask(DSPEngine::instance()->getBasebandExecutor(), [this]() { handleInputMessages(); handleData(); })
 {
     qDebug("AMDemodBaseband::AMDemodBaseband");
 
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
 
-    DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
-    m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
+    QObject::connect(
+        &m_sampleFifo,
+        &SampleSinkFifo::dataReady,
+        this,
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
+    );
+    QObject::connect(
+        &m_inputMessageQueue,
+        &MessageQueue::messageEnqueued,
+        this,
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
+    );
+
+    AudioDeviceManager *audioDeviceManager = DSPEngine::instance()->getAudioDeviceManager();
+    audioDeviceManager->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
+    audioDeviceManager->setAudioSinkSampleRate(m_sink.getAudioFifo(), m_audioSampleRate);
+    m_sink.applyAudioSampleRate(m_audioSampleRate);
 }
 
 AMDemodBaseband::~AMDemodBaseband()
 {
+    m_executorTask.stop();
     m_inputMessageQueue.clear();
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo());
     delete m_channelizer;
@@ -52,30 +73,16 @@ void AMDemodBaseband::reset()
     m_sampleFifo.reset();
 }
 
-void AMDemodBaseband::startWork()
+void AMDemodBaseband::startWork(int affinityGroup)
 {
-    QMutexLocker mutexLocker(&m_mutex);
-    QObject::connect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        this,
-        &AMDemodBaseband::handleData,
-        Qt::QueuedConnection
-    );
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    m_executorTask.setAffinityGroup(affinityGroup);
+    m_executorTask.start();
     m_running = true;
 }
 
 void AMDemodBaseband::stopWork()
 {
-    QMutexLocker mutexLocker(&m_mutex);
-    disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
-    QObject::disconnect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        this,
-        &AMDemodBaseband::handleData
-    );
+    m_executorTask.stop(); // waits for a run in progress so must not hold m_mutex
     m_running = false;
 }
 
@@ -147,6 +154,11 @@ bool AMDemodBaseband::handleMessage(const Message& cmd)
 
 		return true;
     }
+    else if (DSPConfigureAudio::match(cmd))
+    {
+        qDebug() << "AMDemodBaseband::handleMessage: DSPConfigureAudio: resampled by the audio output";
+        return true; // the demodulator audio rate does not depend on the audio device
+    }
     else
     {
         return false;
@@ -169,14 +181,7 @@ void AMDemodBaseband::applySettings(const AMDemodSettings& settings, bool force)
         //qDebug("AMDemod::applySettings: audioDeviceName: %s audioDeviceIndex: %d", qPrintable(settings.m_audioDeviceName), audioDeviceIndex);
         audioDeviceManager->removeAudioSink(m_sink.getAudioFifo());
         audioDeviceManager->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue(), audioDeviceIndex);
-        int audioSampleRate = audioDeviceManager->getOutputSampleRate(audioDeviceIndex);
-
-        if (m_sink.getAudioSampleRate() != audioSampleRate)
-        {
-            m_channelizer->setChannelization(audioSampleRate, settings.m_inputFrequencyOffset);
-            m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
-            m_sink.applyAudioSampleRate(audioSampleRate);
-        }
+        audioDeviceManager->setAudioSinkSampleRate(m_sink.getAudioFifo(), m_audioSampleRate); // new stream in the new device mixer
     }
 
     m_sink.applySettings(settings, force);
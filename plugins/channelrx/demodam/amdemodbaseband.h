@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandexecutor.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -35,6 +36,7 @@ class AMDemodBaseband : public QObject
 public:
     class MsgConfigureAMDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureAMDemodBaseband)
 
     public:
         const AMDemodSettings& getSettings() const { return m_settings; }
@@ -59,7 +61,7 @@ public:
     AMDemodBaseband();
     ~AMDemodBaseband();
     void reset();
-    void startWork();
+    void startWork(int affinityGroup);
     void stopWork();
     void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
@@ -72,6 +74,9 @@ public:
     bool getPllLocked() const { return m_sink.getPllLocked(); }
     Real getPllFrequency() const { return m_sink.getPllFrequency(); }
     bool isRunning() const { return m_running; }
+    const BasebandExecutor::Task *getExecutorTask() const { return &m_executorTask; }
+
+    static const int m_audioSampleRate; //!< demodulator audio rate. The audio output mixer resamples to the device rate
 
 private:
     SampleSinkFifo m_sampleFifo;
@@ -81,6 +86,7 @@ private:
     AMDemodSettings m_settings;
     bool m_running;
     QMutex m_mutex;
+    BasebandExecutor::Task m_executorTask; //!< runs the processing on the shared executor
 
     bool handleMessage(const Message& cmd);
     void applySettings(const AMDemodSettings& settings, bool force = false);
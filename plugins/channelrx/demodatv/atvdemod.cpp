@@ -22,9 +22,16 @@
 #include <stdio.h>
 #include <complex.h>
 
+#include "SWGChannelSettings.h"
+#include "SWGATVDemodSettings.h"
+#include "SWGChannelReport.h"
+#include "SWGATVDemodReport.h"
+
 #include "dsp/dspengine.h"
 #include "device/deviceapi.h"
+#include "util/db.h"
 
+#include "atvdemodwebapiadapter.h"
 #include "atvdemod.h"
 
 MESSAGE_CLASS_DEFINITION(ATVDemod::MsgConfigureATVDemod, Message)
@@ -159,3 +166,89 @@ void ATVDemod::applySettings(const ATVDemodSettings& settings, bool force)
 
     m_settings = settings;
 }
+
+QByteArray ATVDemod::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool ATVDemod::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        MsgConfigureATVDemod *msg = MsgConfigureATVDemod::create(m_settings, true);
+        m_inputMessageQueue.push(msg);
+        return true;
+    }
+    else
+    {
+        m_settings.resetToDefaults();
+        MsgConfigureATVDemod *msg = MsgConfigureATVDemod::create(m_settings, true);
+        m_inputMessageQueue.push(msg);
+        return false;
+    }
+}
+
+int ATVDemod::webapiSettingsGet(
+        SWGSDRangel::SWGChannelSettings& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setAtvDemodSettings(new SWGSDRangel::SWGATVDemodSettings());
+    response.getAtvDemodSettings()->init();
+    ATVDemodWebAPIAdapter::webapiFormatChannelSettings(response, m_settings);
+    return 200;
+}
+
+int ATVDemod::webapiSettingsPutPatch(
+        bool force,
+        const QStringList& channelSettingsKeys,
+        SWGSDRangel::SWGChannelSettings& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    ATVDemodSettings settings = m_settings;
+    ATVDemodWebAPIAdapter::webapiUpdateChannelSettings(settings, channelSettingsKeys, response);
+
+    MsgConfigureATVDemod *msg = MsgConfigureATVDemod::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    if (getMessageQueueToGUI()) // forward to GUI if any
+    {
+        MsgConfigureATVDemod *msgToGUI = MsgConfigureATVDemod::create(settings, force);
+        getMessageQueueToGUI()->push(msgToGUI);
+    }
+
+    ATVDemodWebAPIAdapter::webapiFormatChannelSettings(response, settings);
+
+    return 200;
+}
+
+int ATVDemod::webapiReportGet(
+        SWGSDRangel::SWGChannelReport& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setAtvDemodReport(new SWGSDRangel::SWGATVDemodReport());
+    response.getAtvDemodReport()->init();
+    webapiFormatChannelReport(response);
+    return 200;
+}
+
+void ATVDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
+{
+    ATVDemodSink::SyncStats syncStats;
+    getSyncStats(syncStats);
+
+    response.getAtvDemodReport()->setChannelPowerDb(CalcDb::dbPower(getMagSq()));
+    response.getAtvDemodReport()->setChannelSampleRate(m_basebandSink->getChannelSampleRate());
+    response.getAtvDemodReport()->setBfoLocked(getBFOLocked() ? 1 : 0);
+    response.getAtvDemodReport()->setLineCount(syncStats.m_lineCount);
+    response.getAtvDemodReport()->setFrameCount(syncStats.m_frameCount);
+    response.getAtvDemodReport()->setVSyncCount(syncStats.m_vSyncCount);
+    response.getAtvDemodReport()->setHSyncLockCount(syncStats.m_hSyncLockCount);
+    response.getAtvDemodReport()->setHSyncResyncCount(syncStats.m_hSyncResyncCount);
+    response.getAtvDemodReport()->setFrameOutputCount(syncStats.m_frameOutputCount);
+    response.getAtvDemodReport()->setFrameOutputWidth(syncStats.m_frameOutputWidth);
+    response.getAtvDemodReport()->setFrameOutputHeight(syncStats.m_frameOutputHeight);
+}
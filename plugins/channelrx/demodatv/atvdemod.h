@@ -39,6 +39,7 @@ class ATVDemod : public BasebandSampleSink, public ChannelAPI
 public:
     class MsgConfigureATVDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureATVDemod)
 
     public:
         const ATVDemodSettings& getSettings() const { return m_settings; }
@@ -74,8 +75,8 @@ public:
     virtual void getTitle(QString& title) { title = objectName(); }
     virtual qint64 getCenterFrequency() const { return m_settings.m_inputFrequencyOffset; }
 
-    virtual QByteArray serialize() const { return QByteArray(); }
-    virtual bool deserialize(const QByteArray& data) { (void) data; return false; }
+    virtual QByteArray serialize() const;
+    virtual bool deserialize(const QByteArray& data);
 
     virtual int getNbSinkStreams() const { return 1; }
     virtual int getNbSourceStreams() const { return 0; }
@@ -87,10 +88,25 @@ public:
         return m_settings.m_inputFrequencyOffset;
     }
 
+    virtual int webapiSettingsGet(
+            SWGSDRangel::SWGChannelSettings& response,
+            QString& errorMessage);
+
+    virtual int webapiSettingsPutPatch(
+            bool force,
+            const QStringList& channelSettingsKeys,
+            SWGSDRangel::SWGChannelSettings& response,
+            QString& errorMessage);
+
+    virtual int webapiReportGet(
+            SWGSDRangel::SWGChannelReport& response,
+            QString& errorMessage);
+
 	void setScopeSink(BasebandSampleSink* scopeSink) { m_basebandSink->setScopeSink(scopeSink); }
     void setTVScreen(TVScreenAnalog *tvScreen) { m_basebandSink->setTVScreen(tvScreen); }; //!< set by the GUI
     double getMagSq() const { return m_basebandSink->getMagSq(); } //!< Beware this is scaled to 2^30
     bool getBFOLocked() { return m_basebandSink->getBFOLocked(); }
+    void getSyncStats(ATVDemodSink::SyncStats& syncStats) const { m_basebandSink->getSyncStats(syncStats); }
     void setVideoTabIndex(int videoTabIndex) { m_basebandSink->setVideoTabIndex(videoTabIndex); }
 
     static const QString m_channelIdURI;
@@ -105,6 +121,7 @@ private:
     int m_basebandSampleRate; //!< sample rate stored from device message used when starting baseband sink
 
     void applySettings(const ATVDemodSettings& settings, bool force = false);
+    void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
 };
 
 #endif // INCLUDE_ATVDEMOD_H
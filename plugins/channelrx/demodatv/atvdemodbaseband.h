@@ -35,6 +35,7 @@ class ATVDemodBaseband : public QObject
 public:
     class MsgConfigureATVDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureATVDemodBaseband)
 
     public:
         const ATVDemodSettings& getSettings() const { return m_settings; }
@@ -68,6 +69,7 @@ public:
     void setScopeSink(BasebandSampleSink* scopeSink) { m_sink.setScopeSink(scopeSink); }
     void setTVScreen(TVScreenAnalog *tvScreen) { m_sink.setTVScreen(tvScreen); }
     bool getBFOLocked() { return m_sink.getBFOLocked(); }
+    void getSyncStats(ATVDemodSink::SyncStats& syncStats) const { m_sink.getSyncStats(syncStats); }
     void setVideoTabIndex(int videoTabIndex) { m_sink.setVideoTabIndex(videoTabIndex); }
     void setBasebandSampleRate(int sampleRate); //!< To be used when supporting thread is stopped
     bool isRunning() const { return m_running; }
@@ -0,0 +1,207 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <errno.h>
+#include <new>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <QDebug>
+
+#include "atvdemodframeoutput.h"
+
+const int ATVDemodFrameOutput::m_nbSharedMemorySlots = 4;
+
+ATVDemodFrameOutput::ATVDemodFrameOutput() :
+    m_type(ATVDemodSettings::FrameOutputNone),
+    m_width(0),
+    m_height(0),
+    m_frame(nullptr),
+    m_currentLine(nullptr),
+    m_frameCount(0),
+    m_shmHeader(nullptr),
+    m_shmSize(0)
+{}
+
+ATVDemodFrameOutput::~ATVDemodFrameOutput()
+{
+    close();
+}
+
+bool ATVDemodFrameOutput::open(
+    ATVDemodSettings::FrameOutput frameOutput,
+    const QString& name,
+    int width,
+    int height,
+    int fps,
+    bool interleaved)
+{
+    close();
+
+    if ((frameOutput == ATVDemodSettings::FrameOutputNone) || (width <= 0) || (height <= 0)) {
+        return false;
+    }
+
+    m_type = frameOutput;
+    m_width = width;
+    m_height = height;
+    m_frameCount = 0;
+    m_outOfBoundsLine.resize(width);
+    bool success;
+
+    if (frameOutput == ATVDemodSettings::FrameOutputSharedMemory) {
+        success = openSharedMemory(name, fps);
+    } else {
+        success = openFile(name, fps, interleaved);
+    }
+
+    if (!success)
+    {
+        close();
+        return false;
+    }
+
+    m_currentLine = m_outOfBoundsLine.data();
+    qDebug("ATVDemodFrameOutput::open: type: %d name: %s %dx%d",
+        (int) frameOutput, qPrintable(name), width, height);
+
+    return true;
+}
+
+bool ATVDemodFrameOutput::openSharedMemory(const QString& name, int fps)
+{
+#ifdef _WIN32
+    (void) name;
+    (void) fps;
+    qWarning("ATVDemodFrameOutput::openSharedMemory: shared memory output not supported on this platform");
+    return false;
+#else
+    m_shmName = name.toStdString();
+    size_t headerSize = ((sizeof(SharedMemoryHeader) + 63) / 64) * 64; // keep slots cache line aligned
+    m_shmSize = headerSize + m_nbSharedMemorySlots * m_width * m_height;
+    int fd = shm_open(m_shmName.c_str(), O_CREAT | O_RDWR, 0644);
+
+    if (fd < 0)
+    {
+        qWarning("ATVDemodFrameOutput::openSharedMemory: cannot open %s: %s", m_shmName.c_str(), strerror(errno));
+        return false;
+    }
+
+    if (ftruncate(fd, m_shmSize) < 0)
+    {
+        qWarning("ATVDemodFrameOutput::openSharedMemory: cannot size %s: %s", m_shmName.c_str(), strerror(errno));
+        ::close(fd);
+        shm_unlink(m_shmName.c_str());
+        return false;
+    }
+
+    void *shm = mmap(nullptr, m_shmSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (shm == MAP_FAILED)
+    {
+        qWarning("ATVDemodFrameOutput::openSharedMemory: cannot map %s: %s", m_shmName.c_str(), strerror(errno));
+        shm_unlink(m_shmName.c_str());
+        return false;
+    }
+
+    m_shmHeader = new (shm) SharedMemoryHeader;
+    memcpy(m_shmHeader->m_magic, "SDRATVFR", 8);
+    m_shmHeader->m_version = 1;
+    m_shmHeader->m_headerSize = headerSize;
+    m_shmHeader->m_width = m_width;
+    m_shmHeader->m_height = m_height;
+    m_shmHeader->m_nbSlots = m_nbSharedMemorySlots;
+    m_shmHeader->m_fps = fps;
+    m_shmHeader->m_frameCount.store(0, std::memory_order_release);
+    m_frame = (uint8_t*) shm + headerSize;
+    memset(m_frame, 0, m_nbSharedMemorySlots * m_width * m_height);
+
+    return true;
+#endif
+}
+
+bool ATVDemodFrameOutput::openFile(const QString& name, int fps, bool interleaved)
+{
+    m_file.open(name.toStdString().c_str(), std::ios::binary | std::ios::trunc);
+
+    if (!m_file.is_open())
+    {
+        qWarning("ATVDemodFrameOutput::openFile: cannot open %s", qPrintable(name));
+        return false;
+    }
+
+    if (m_type == ATVDemodSettings::FrameOutputY4M)
+    {
+        m_file << "YUV4MPEG2 W" << m_width << " H" << m_height << " F" << fps << ":1 I" << (interleaved ? 't' : 'p')
+            << " A1:1 Cmono\n";
+    }
+
+    m_frameBuffer.assign(m_width * m_height, 0);
+    m_frame = m_frameBuffer.data();
+
+    return true;
+}
+
+void ATVDemodFrameOutput::close()
+{
+#ifndef _WIN32
+    if (m_shmHeader)
+    {
+        munmap(m_shmHeader, m_shmSize);
+        shm_unlink(m_shmName.c_str());
+        m_shmHeader = nullptr;
+    }
+#endif
+
+    if (m_file.is_open()) {
+        m_file.close();
+    }
+
+    m_frameBuffer.clear();
+    m_frame = nullptr;
+    m_currentLine = nullptr;
+    m_type = ATVDemodSettings::FrameOutputNone;
+}
+
+void ATVDemodFrameOutput::frameDone()
+{
+    m_frameCount++;
+
+    if (m_shmHeader)
+    {
+        m_shmHeader->m_frameCount.store(m_frameCount, std::memory_order_release);
+        m_frame = (uint8_t*) m_shmHeader + m_shmHeader->m_headerSize
+            + (m_frameCount % m_nbSharedMemorySlots) * m_width * m_height;
+    }
+    else if (m_file.is_open())
+    {
+        if (m_type == ATVDemodSettings::FrameOutputY4M) {
+            m_file << "FRAME\n";
+        }
+
+        m_file.write((const char*) m_frame, m_width * m_height);
+    }
+
+    m_currentLine = m_outOfBoundsLine.data();
+}
@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_ATVDEMODFRAMEOUTPUT_H
+#define INCLUDE_ATVDEMODFRAMEOUTPUT_H
+
+#include <stdint.h>
+#include <atomic>
+#include <fstream>
+#include <vector>
+
+#include <QString>
+
+#include "atvdemodsettings.h"
+
+/**
+ * GUI independent target of the decoded frames. Frames are 8 bit luma images of
+ * the visible part of the picture.
+ *
+ * With shared memory the demodulator writes pixels directly into a ring of frame
+ * slots that follows a SharedMemoryHeader. The slot of the last complete frame is
+ * (m_frameCount - 1) % m_nbSlots. A reader that copies a slot should check that
+ * m_frameCount has not advanced by m_nbSlots - 1 or more meanwhile.
+ *
+ * With files frames are written either as a monochrome YUV4MPEG2 stream or as
+ * raw concatenated frames.
+ */
+class ATVDemodFrameOutput
+{
+public:
+    struct SharedMemoryHeader
+    {
+        char m_magic[8];                    //!< "SDRATVFR"
+        uint32_t m_version;
+        uint32_t m_headerSize;              //!< offset of the first slot
+        uint32_t m_width;
+        uint32_t m_height;
+        uint32_t m_nbSlots;
+        uint32_t m_fps;
+        std::atomic<uint64_t> m_frameCount; //!< number of complete frames
+    };
+
+    ATVDemodFrameOutput();
+    ~ATVDemodFrameOutput();
+
+    bool open(ATVDemodSettings::FrameOutput frameOutput, const QString& name, int width, int height, int fps, bool interleaved);
+    void close();
+    bool isOpen() const { return m_frame != nullptr; }
+    int getWidth() const { return m_width; }
+    int getHeight() const { return m_height; }
+    uint64_t getFrameCount() const { return m_frameCount; }
+
+    void selectRow(int row)
+    {
+        m_currentLine = (row < m_height) && (row >= 0) ? m_frame + row * m_width : m_outOfBoundsLine.data();
+    }
+
+    void setSampleValue(int column, int value) //!< same origin as TVScreenAnalogBuffer
+    {
+        if ((column < m_width - 2) && (column >= -2)) {
+            m_currentLine[column + 2] = value;
+        }
+    }
+
+    void frameDone();
+
+    static const int m_nbSharedMemorySlots;
+
+private:
+    ATVDemodSettings::FrameOutput m_type;
+    int m_width;
+    int m_height;
+    uint8_t *m_frame;        //!< frame being filled
+    uint8_t *m_currentLine;
+    std::vector<uint8_t> m_outOfBoundsLine;
+    uint64_t m_frameCount;
+
+    // shared memory
+    std::string m_shmName;
+    SharedMemoryHeader *m_shmHeader;
+    size_t m_shmSize;
+
+    // files
+    std::vector<uint8_t> m_frameBuffer;
+    std::ofstream m_file;
+
+    bool openSharedMemory(const QString& name, int fps);
+    bool openFile(const QString& name, int fps, bool interleaved);
+};
+
+#endif // INCLUDE_ATVDEMODFRAMEOUTPUT_H
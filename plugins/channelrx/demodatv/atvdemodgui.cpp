@@ -169,6 +169,15 @@ bool ATVDemodGUI::handleMessage(const Message& message)
 
         return true;
     }
+    else if (ATVDemod::MsgConfigureATVDemod::match(message))
+    {
+        qDebug("ATVDemodGUI::handleMessage: ATVDemod::MsgConfigureATVDemod");
+        const ATVDemod::MsgConfigureATVDemod& cfg = (ATVDemod::MsgConfigureATVDemod&) message;
+        m_settings = cfg.getSettings();
+        displaySettings();
+
+        return true;
+    }
     else
     {
         return false;
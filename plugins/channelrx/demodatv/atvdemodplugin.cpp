@@ -18,10 +18,11 @@
 
 
 #include <QtPlugin>
-#include <QAction>
 #include "plugin/pluginapi.h"
 
+#ifndef SERVER_MODE
 #include "atvdemodgui.h"
+#endif
 #include "atvdemod.h"
 #include "atvdemodplugin.h"
 #include "atvdemodwebapiadapter.h"
@@ -73,10 +74,21 @@ void ATVDemodPlugin::createRxChannel(DeviceAPI *deviceAPI, BasebandSampleSink **
 	}
 }
 
+#ifdef SERVER_MODE
+ChannelGUI* ATVDemodPlugin::createRxChannelGUI(
+        DeviceUISet *deviceUISet,
+        BasebandSampleSink *rxChannel) const
+{
+    (void) deviceUISet;
+    (void) rxChannel;
+    return 0;
+}
+#else
 ChannelGUI* ATVDemodPlugin::createRxChannelGUI(DeviceUISet *deviceUISet, BasebandSampleSink *rxChannel) const
 {
     return ATVDemodGUI::create(m_ptrPluginAPI, deviceUISet, rxChannel);
 }
+#endif
 
 ChannelWebAPIAdapter* ATVDemodPlugin::createChannelWebAPIAdapter() const
 {
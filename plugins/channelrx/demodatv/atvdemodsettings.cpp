@@ -48,6 +48,8 @@ void ATVDemodSettings::resetToDefaults()
     m_halfFrames = false; // m_fltRatioOfRowsToDisplay = 1.0
     m_levelSynchroTop = 0.15f;
     m_levelBlack = 0.3f;
+    m_frameOutput = FrameOutputNone;
+    m_frameOutputName = "/sdrangel_atv";
     m_rgbColor = QColor(255, 255, 255).rgb();
     m_title = "ATV Demodulator";
     m_udpAddress = "127.0.0.1";
@@ -85,6 +87,8 @@ QByteArray ATVDemodSettings::serialize() const
     s.writeS32(22, m_amScalingFactor);
     s.writeS32(23, m_amOffsetFactor);
     s.writeBool(24, m_fftFiltering);
+    s.writeS32(25, (int) m_frameOutput);
+    s.writeString(26, m_frameOutputName);
 
     return s.final();
 }
@@ -133,6 +137,9 @@ bool ATVDemodSettings::deserialize(const QByteArray& arrData)
         d.readS32(22, &m_amScalingFactor, 100);
         d.readS32(23, &m_amOffsetFactor, 0);
         d.readBool(24, &m_fftFiltering, false);
+        d.readS32(25, &tmp, 0);
+        m_frameOutput = tmp < 0 ? FrameOutputNone : tmp > (int) FrameOutputRaw ? FrameOutputRaw : (FrameOutput) tmp;
+        d.readString(26, &m_frameOutputName, "/sdrangel_atv");
 
         return true;
     }
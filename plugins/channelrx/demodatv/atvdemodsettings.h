@@ -45,6 +45,14 @@ struct ATVDemodSettings
         ATVStdHSkip
     };
 
+    enum FrameOutput
+    {
+        FrameOutputNone,
+        FrameOutputSharedMemory, //!< POSIX shared memory ring of 8 bit luma frames
+        FrameOutputY4M,          //!< YUV4MPEG2 monochrome stream
+        FrameOutputRaw           //!< raw concatenated 8 bit luma frames
+    };
+
     // RF settings
     qint64        m_inputFrequencyOffset; //!< Offset from baseband center frequency
     int           m_bfoFrequency;         //!< BFO frequency (Hz)
@@ -67,6 +75,10 @@ struct ATVDemodSettings
     float         m_levelSynchroTop;      //!< Horizontal synchronization top level (0.0 to 1.0 scale)
     float         m_levelBlack;           //!< Black level (0.0 to 1.0 scale)
 
+    // Frame output
+    FrameOutput   m_frameOutput;          //!< GUI independent frame output
+    QString       m_frameOutputName;      //!< Shared memory name or file path
+
     // common channel settings
     quint32 m_rgbColor;
     QString m_title;
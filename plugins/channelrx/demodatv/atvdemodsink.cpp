@@ -22,6 +22,9 @@
 #include <complex.h>
 
 #include "audio/audiooutput.h"
+#ifndef SERVER_MODE
+#include "gui/tvscreenanalog.h"
+#endif
 
 #include "atvdemodsink.h"
 
@@ -50,6 +53,12 @@ ATVDemodSink::ATVDemodSink() :
     m_hSyncErrorCount(0),
     m_amSampleIndex(0),
     m_lineIndex(0),
+    m_lineCount(0),
+    m_frameCount(0),
+    m_vSyncCount(0),
+    m_hSyncLockCount(0),
+    m_hSyncResyncCount(0),
+    m_syncStats(),
     m_ampAverage(4800),
     m_bfoPLL(200/1000000, 100/1000000, 0.01),
     m_bfoFilter(200.0, 1000000.0, 0.9),
@@ -102,6 +111,8 @@ void ATVDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
         m_scopeSink->feed(m_scopeSampleBuffer.begin(), m_scopeSampleBuffer.end(), false); // m_ssb = positive only
         m_scopeSampleBuffer.clear();
     }
+
+    publishSyncStats();
 }
 
 void ATVDemodSink::demod(Complex& c)
@@ -306,10 +317,7 @@ void ATVDemodSink::demod(Complex& c)
 
     //********** process video sample **********
 
-    if (m_registeredTVScreen) // can process only if the screen is available (set via the GUI)
-    {
-        processSample(sample, sampleVideo);
-    }
+    processSample(sample, sampleVideo); // synchronization runs even without screen or frame output
 }
 
 void ATVDemodSink::applyStandard(int sampleRate, ATVDemodSettings::ATVStd atvStd, float lineDuration)
@@ -449,14 +457,7 @@ void ATVDemodSink::applyChannelSettings(int channelSampleRate, int channelFreque
 
     applyStandard(m_channelSampleRate, m_settings.m_atvStd, ATVDemodSettings::getNominalLineTime(m_settings.m_nbLines, m_settings.m_fps));
 
-    if (m_registeredTVScreen)
-    {
-        m_registeredTVScreen->resizeTVScreen(
-            m_samplesPerLine - m_numberSamplesPerLineSignals,
-            m_settings.m_nbLines - m_numberOfBlackLines
-        );
-		m_tvScreenBuffer = m_registeredTVScreen->getBackBuffer();
-    }
+    applyScreenSize(m_settings);
 
     m_fieldIndex = 0;
 
@@ -526,17 +527,15 @@ void ATVDemodSink::applySettings(const ATVDemodSettings& settings, bool force)
         applyStandard(m_channelSampleRate, settings.m_atvStd,
             ATVDemodSettings::getNominalLineTime(settings.m_nbLines, settings.m_fps));
 
-        if (m_registeredTVScreen)
-        {
-            m_registeredTVScreen->resizeTVScreen(
-                m_samplesPerLine - m_numberSamplesPerLineSignals,
-                settings.m_nbLines - m_numberOfBlackLines
-            );
-			m_tvScreenBuffer = m_registeredTVScreen->getBackBuffer();
-        }
+        applyScreenSize(settings);
 
         m_fieldIndex = 0;
     }
+    else if ((settings.m_frameOutput != m_settings.m_frameOutput)
+     || (settings.m_frameOutputName != m_settings.m_frameOutputName))
+    {
+        applyFrameOutput(settings);
+    }
 
     if ((settings.m_fmDeviation != m_settings.m_fmDeviation) || force) {
         m_objPhaseDiscri.setFMScaling(1.0f / settings.m_fmDeviation);
@@ -548,3 +547,75 @@ void ATVDemodSink::applySettings(const ATVDemodSettings& settings, bool force)
 
     m_settings = settings;
 }
+
+void ATVDemodSink::applyScreenSize(const ATVDemodSettings& settings)
+{
+#ifndef SERVER_MODE
+    if (m_registeredTVScreen)
+    {
+        m_registeredTVScreen->resizeTVScreen(
+            m_samplesPerLine - m_numberSamplesPerLineSignals,
+            settings.m_nbLines - m_numberOfBlackLines
+        );
+		m_tvScreenBuffer = m_registeredTVScreen->getBackBuffer();
+    }
+#endif
+
+    applyFrameOutput(settings);
+}
+
+void ATVDemodSink::applyFrameOutput(const ATVDemodSettings& settings)
+{
+    if (settings.m_frameOutput == ATVDemodSettings::FrameOutputNone)
+    {
+        m_frameOutput.close();
+    }
+    else
+    {
+        m_frameOutput.open(
+            settings.m_frameOutput,
+            settings.m_frameOutputName,
+            m_samplesPerLine - m_numberSamplesPerLineSignals,
+            settings.m_nbLines - m_numberOfBlackLines,
+            settings.m_fps,
+            m_interleaved
+        );
+    }
+
+    publishSyncStats();
+}
+
+void ATVDemodSink::newFrame()
+{
+#ifndef SERVER_MODE
+    if (m_registeredTVScreen) {
+		m_tvScreenBuffer = m_registeredTVScreen->swapBuffers();
+    }
+#endif
+
+    if (m_frameOutput.isOpen()) {
+        m_frameOutput.frameDone();
+    }
+
+    m_frameCount++;
+}
+
+// Called in the sink thread once per block. The counters themselves are updated per line without locking.
+void ATVDemodSink::publishSyncStats()
+{
+    QMutexLocker mutexLocker(&m_syncStatsMutex);
+    m_syncStats.m_lineCount = m_lineCount;
+    m_syncStats.m_frameCount = m_frameCount;
+    m_syncStats.m_vSyncCount = m_vSyncCount;
+    m_syncStats.m_hSyncLockCount = m_hSyncLockCount;
+    m_syncStats.m_hSyncResyncCount = m_hSyncResyncCount;
+    m_syncStats.m_frameOutputCount = m_frameOutput.getFrameCount();
+    m_syncStats.m_frameOutputWidth = m_frameOutput.isOpen() ? m_frameOutput.getWidth() : 0;
+    m_syncStats.m_frameOutputHeight = m_frameOutput.isOpen() ? m_frameOutput.getHeight() : 0;
+}
+
+void ATVDemodSink::getSyncStats(SyncStats& syncStats) const
+{
+    QMutexLocker mutexLocker(&m_syncStatsMutex);
+    syncStats = m_syncStats;
+}
@@ -19,6 +19,7 @@
 #define INCLUDE_ATVDEMODSINK_H
 
 #include <QElapsedTimer>
+#include <QMutex>
 #include <vector>
 #include <memory>
 
@@ -33,9 +34,12 @@
 #include "dsp/phasediscri.h"
 #include "audio/audiofifo.h"
 #include "util/movingaverage.h"
-#include "gui/tvscreenanalog.h"
+#include "gui/tvscreenanalogbuffer.h"
 
 #include "atvdemodsettings.h"
+#include "atvdemodframeoutput.h"
+
+class TVScreenAnalog;
 
 class ATVDemodSink : public ChannelSampleSink {
 public:
@@ -50,6 +54,20 @@ public:
     bool getBFOLocked();
     void setVideoTabIndex(int videoTabIndex) { m_videoTabIndex = videoTabIndex; }
 
+    struct SyncStats
+    {
+        quint64 m_lineCount;        //!< lines processed
+        quint64 m_frameCount;       //!< frames completed
+        quint64 m_vSyncCount;       //!< vertical synchronizations detected
+        quint64 m_hSyncLockCount;   //!< horizontal synchronizations within tolerance (slow adjustment)
+        quint64 m_hSyncResyncCount; //!< horizontal synchronizations out of tolerance (fast adjustment)
+        quint64 m_frameOutputCount; //!< frames written to the frame output
+        int m_frameOutputWidth;
+        int m_frameOutputHeight;
+    };
+
+    void getSyncStats(SyncStats& syncStats) const; //!< can be called from any thread
+
     void applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force = false);
     void applySettings(const ATVDemodSettings& settings, bool force = false);
 
@@ -110,6 +128,7 @@ private:
     //*************** ATV PARAMETERS  ***************
     TVScreenAnalog *m_registeredTVScreen;
 	std::shared_ptr<TVScreenAnalogBuffer> m_tvScreenBuffer;
+    ATVDemodFrameOutput m_frameOutput;
 
     //int m_intNumberSamplePerLine;
     int m_numberSamplesPerHTop;        //!< number of samples per horizontal synchronization pulse (pulse in ultra-black) - integer value
@@ -162,6 +181,14 @@ private:
     float prevSample;
     int m_avgColIndex;
 
+    quint64 m_lineCount;
+    quint64 m_frameCount;
+    quint64 m_vSyncCount;
+    quint64 m_hSyncLockCount;
+    quint64 m_hSyncResyncCount;
+    SyncStats m_syncStats;          //!< snapshot of the counters above for other threads
+    mutable QMutex m_syncStatsMutex;
+
     SampleVector m_sampleBuffer;
 
     float m_sampleRangeCorrection;
@@ -186,11 +213,32 @@ private:
 
     void demod(Complex& c);
     void applyStandard(int sampleRate, ATVDemodSettings::ATVStd atvStd, float lineDuration);
+    void applyScreenSize(const ATVDemodSettings& settings);
+    void applyFrameOutput(const ATVDemodSettings& settings);
+    void newFrame();
+    void publishSyncStats();
+
+    inline void selectRow(int rowIndex)
+    {
+        if (m_registeredTVScreen) {
+		    m_tvScreenBuffer->selectRow(rowIndex, m_sampleOffsetFrac);
+        }
+
+        if (m_frameOutput.isOpen()) {
+            m_frameOutput.selectRow(rowIndex);
+        }
+    }
 
     inline void processSample(float& sample, int& sampleVideo)
     {
         // Filling pixel on the current line - reference index 0 at start of sync pulse
-		m_tvScreenBuffer->setSampleValue(m_sampleOffset - m_numberSamplesPerHSync, sampleVideo);
+        if (m_registeredTVScreen) {
+		    m_tvScreenBuffer->setSampleValue(m_sampleOffset - m_numberSamplesPerHSync, sampleVideo);
+        }
+
+        if (m_frameOutput.isOpen()) {
+            m_frameOutput.setSampleValue(m_sampleOffset - m_numberSamplesPerHSync, sampleVideo);
+        }
 
         if (m_settings.m_hSync)
         {
@@ -215,6 +263,7 @@ private:
                         // Fast sync: shift is too large, needs to be fixed ASAP
 						m_hSyncShift = hSyncShift;
                         m_hSyncErrorCount = 0;
+                        m_hSyncResyncCount++;
                     }
                 }
                 else
@@ -222,6 +271,7 @@ private:
 					// Slow sync: slight adjustment is needed
 					m_hSyncShift = hSyncShift * 0.2f;
                     m_hSyncErrorCount = 0;
+                    m_hSyncLockCount++;
                 }
 				m_sampleOffsetDetected = 0;
             }
@@ -247,6 +297,7 @@ private:
 			m_hSyncShift = 0.0f;
 
 			m_lineIndex++;
+            m_lineCount++;
 			if (m_settings.m_atvStd == ATVDemodSettings::ATVStdHSkip) {
                 processEOLHSkip();
             } else {
@@ -262,12 +313,14 @@ private:
     {
         if (m_lineIndex == m_numberOfVSyncLines + 3 && m_fieldIndex == 0)
         {
-			m_tvScreenBuffer = m_registeredTVScreen->swapBuffers();
+            newFrame();
         }
 
         if (m_vSyncDetectSampleCount > m_vSyncDetectThreshold &&
             (m_lineIndex < 3 || m_lineIndex > m_numberOfVSyncLines + 1) && m_settings.m_vSync)
         {
+            m_vSyncCount++;
+
             if (m_interleaved)
             {
                 if (m_fieldDetectSampleCount > m_fieldDetectThreshold1)
@@ -295,7 +348,7 @@ private:
         if (m_interleaved)
             rowIndex = rowIndex * 2 - m_fieldIndex;
 
-		m_tvScreenBuffer->selectRow(rowIndex, m_sampleOffsetFrac);
+        selectRow(rowIndex);
 	}
 
     // Vertical sync is obtained by skipping horizontal sync on the line that triggers vertical sync (new frame)
@@ -304,11 +357,15 @@ private:
 		if ((m_sampleOffsetDetected > (3 * m_samplesPerLine) / 2) // Vertical sync is first horizontal sync after skip (count at least 1.5 line length)
             || (!m_settings.m_vSync && (m_lineIndex >= m_settings.m_nbLines))) // Vsync ignored and reached nominal number of lines per frame
         {
-			m_tvScreenBuffer = m_registeredTVScreen->swapBuffers();
+            if (m_sampleOffsetDetected > (3 * m_samplesPerLine) / 2) {
+                m_vSyncCount++;
+            }
+
+            newFrame();
 			m_lineIndex = 0;
         }
 
-		m_tvScreenBuffer->selectRow(m_lineIndex, m_sampleOffsetFrac);
+        selectRow(m_lineIndex);
     }
 };
 
@@ -75,6 +75,8 @@ void ATVDemodWebAPIAdapter::webapiFormatChannelSettings(
     response.getAtvDemodSettings()->setTitle(new QString(settings.m_title));
     response.getAtvDemodSettings()->setUdpAddress(new QString(settings.m_udpAddress));
     response.getAtvDemodSettings()->setUdpPort(settings.m_udpPort);
+    response.getAtvDemodSettings()->setFrameOutput((int) settings.m_frameOutput);
+    response.getAtvDemodSettings()->setFrameOutputName(new QString(settings.m_frameOutputName));
 }
 
 void ATVDemodWebAPIAdapter::webapiUpdateChannelSettings(
@@ -148,4 +150,14 @@ void ATVDemodWebAPIAdapter::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("udpPort")) {
         settings.m_udpPort = response.getAtvDemodSettings()->getUdpPort();
     }
+    if (channelSettingsKeys.contains("frameOutput"))
+    {
+        int frameOutput = response.getAtvDemodSettings()->getFrameOutput();
+        settings.m_frameOutput = frameOutput < 0 ? ATVDemodSettings::FrameOutputNone :
+            frameOutput > (int) ATVDemodSettings::FrameOutputRaw ? ATVDemodSettings::FrameOutputRaw :
+                (ATVDemodSettings::FrameOutput) frameOutput;
+    }
+    if (channelSettingsKeys.contains("frameOutputName")) {
+        settings.m_frameOutputName = *response.getAtvDemodSettings()->getFrameOutputName();
+    }
 }
\ No newline at end of file
@@ -23,7 +23,6 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QBuffer>
-#include <QThread>
 
 #include "SWGChannelSettings.h"
 #include "SWGBFMDemodSettings.h"
@@ -53,10 +52,9 @@ BFMDemod::BFMDemod(DeviceAPI *deviceAPI) :
 {
 	setObjectName(m_channelId);
 
-    m_thread = new QThread(this);
     m_basebandSink = new BFMDemodBaseband();
+    setExecutorTask(m_basebandSink->getExecutorTask());
     m_basebandSink->setSpectrumSink(&m_spectrumVis);
-    m_basebandSink->moveToThread(m_thread);
 
 	applySettings(m_settings, true);
 
@@ -75,7 +73,6 @@ BFMDemod::~BFMDemod()
     m_deviceAPI->removeChannelSinkAPI(this);
     m_deviceAPI->removeChannelSink(this);
     delete m_basebandSink;
-    delete m_thread;
 }
 
 uint32_t BFMDemod::getNumberOfDeviceStreams() const
@@ -98,14 +95,13 @@ void BFMDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    m_basebandSink->startWork(m_deviceAPI->getDeviceSetIndex());
 }
 
 void BFMDemod::stop()
 {
     qDebug() << "BFMDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+    m_basebandSink->stopWork();
 }
 
 bool BFMDemod::handleMessage(const Message& cmd)
@@ -34,7 +34,6 @@
 
 class QNetworkAccessManager;
 class QNetworkReply;
-class QThread;
 class DeviceAPI;
 
 namespace SWGSDRangel {
@@ -46,6 +45,7 @@ class BFMDemod : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureBFMDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureBFMDemod)
 
     public:
         const BFMDemodSettings& getSettings() const { return m_settings; }
@@ -142,7 +142,6 @@ public:
 
 private:
 	DeviceAPI *m_deviceAPI;
-    QThread *m_thread;
     BFMDemodBaseband* m_basebandSink;
 	BFMDemodSettings m_settings;
     SpectrumVis m_spectrumVis;
@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandexecutor.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -35,6 +36,7 @@ class BFMDemodBaseband : public QObject
 public:
     class MsgConfigureBFMDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureBFMDemodBaseband)
 
     public:
         const BFMDemodSettings& getSettings() const { return m_settings; }
@@ -63,6 +65,10 @@ public:
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     int getChannelSampleRate() const;
     void setBasebandSampleRate(int sampleRate);
+    void startWork(int affinityGroup);
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    const BasebandExecutor::Task *getExecutorTask() const { return &m_executorTask; }
     void setSpectrumSink(BasebandSampleSink* spectrumSink) { m_sink.setSpectrumSink(spectrumSink); }
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_messageQueueToGUI = messageQueue; }
 
@@ -87,6 +93,8 @@ private:
     BFMDemodSettings m_settings;
     QMutex m_mutex;
     MessageQueue *m_messageQueueToGUI;
+    bool m_running;
+    BasebandExecutor::Task m_executorTask; //!< runs the processing on the shared executor
 
     MessageQueue *getMessageQueueToGUI() { return m_messageQueueToGUI; }
 
@@ -84,6 +84,7 @@ public:
 
     class MsgConfigureDATVDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureDATVDemod)
 
     public:
         const DATVDemodSettings& getSettings() const { return m_settings; }
@@ -35,6 +35,7 @@ class DATVDemodBaseband : public QObject
 public:
     class MsgConfigureDATVDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureDATVDemodBaseband)
 
     public:
         const DATVDemodSettings& getSettings() const { return m_settings; }
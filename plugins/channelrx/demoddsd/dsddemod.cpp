@@ -26,7 +26,6 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QBuffer>
-#include <QThread>
 
 #include "SWGChannelSettings.h"
 #include "SWGDSDDemodSettings.h"
@@ -55,9 +54,8 @@ DSDDemod::DSDDemod(DeviceAPI *deviceAPI) :
     qDebug("DSDDemod::DSDDemod");
 	setObjectName(m_channelId);
 
-    m_thread = new QThread(this);
     m_basebandSink = new DSDDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    setExecutorTask(m_basebandSink->getExecutorTask());
 
     applySettings(m_settings, true);
 
@@ -75,7 +73,6 @@ DSDDemod::~DSDDemod()
 	m_deviceAPI->removeChannelSinkAPI(this);
     m_deviceAPI->removeChannelSink(this);
     delete m_basebandSink;
-    delete m_thread;
 }
 
 uint32_t DSDDemod::getNumberOfDeviceStreams() const
@@ -98,14 +95,13 @@ void DSDDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    m_basebandSink->startWork(m_deviceAPI->getDeviceSetIndex());
 }
 
 void DSDDemod::stop()
 {
     qDebug() << "DSDDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+    m_basebandSink->stopWork();
 }
 
 bool DSDDemod::handleMessage(const Message& cmd)
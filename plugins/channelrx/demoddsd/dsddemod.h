@@ -33,7 +33,6 @@
 
 class QNetworkAccessManager;
 class QNetworkReply;
-class QThread;
 class DownChannelizer;
 
 class DSDDemod : public BasebandSampleSink, public ChannelAPI {
@@ -41,6 +40,7 @@ class DSDDemod : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureDSDDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureDSDDemod)
 
     public:
         const DSDDemodSettings& getSettings() const { return m_settings; }
@@ -127,7 +127,6 @@ public:
 
 private:
 	DeviceAPI *m_deviceAPI;
-    QThread *m_thread;
     DSDDemodBaseband *m_basebandSink;
 	DSDDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
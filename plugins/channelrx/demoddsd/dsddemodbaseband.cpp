@@ -26,7 +26,9 @@
 MESSAGE_CLASS_DEFINITION(DSDDemodBaseband::MsgConfigureDSDDemodBaseband, Message)
 
 DSDDemodBaseband::DSDDemodBaseband() :
-    m_mutex(QMutex::Recursive)
+    m_mutex(QMutex::Recursive),
+    m_running(false),
+    m_executorTask(DSPEngine::instance()->getBasebandExecutor(), [this]() { handleInputMessages(); handleData(); })
 {
     qDebug("DSDDemodBaseband::DSDDemodBaseband");
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
@@ -36,8 +38,8 @@ DSDDemodBaseband::DSDDemodBaseband() :
         &m_sampleFifo,
         &SampleSinkFifo::dataReady,
         this,
-        &DSDDemodBaseband::handleData,
-        Qt::QueuedConnection
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
     );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo1(), getInputMessageQueue());
@@ -45,11 +47,18 @@ DSDDemodBaseband::DSDDemodBaseband() :
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo2(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
 
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    QObject::connect(
+        &m_inputMessageQueue,
+        &MessageQueue::messageEnqueued,
+        this,
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
+    );
 }
 
 DSDDemodBaseband::~DSDDemodBaseband()
 {
+    m_executorTask.stop();
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo1());
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo2());
     delete m_channelizer;
@@ -61,6 +70,19 @@ void DSDDemodBaseband::reset()
     m_sampleFifo.reset();
 }
 
+void DSDDemodBaseband::startWork(int affinityGroup)
+{
+    m_executorTask.setAffinityGroup(affinityGroup);
+    m_executorTask.start();
+    m_running = true;
+}
+
+void DSDDemodBaseband::stopWork()
+{
+    m_executorTask.stop(); // waits for a run in progress so must not hold m_mutex
+    m_running = false;
+}
+
 void DSDDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
     m_sampleFifo.write(begin, end);
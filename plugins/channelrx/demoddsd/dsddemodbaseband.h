@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandexecutor.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -35,6 +36,7 @@ class DSDDemodBaseband : public QObject
 public:
     class MsgConfigureDSDDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureDSDDemodBaseband)
 
     public:
         const DSDDemodSettings& getSettings() const { return m_settings; }
@@ -67,6 +69,10 @@ public:
     void getMagSqLevels(double& avg, double& peak, int& nbSamples) { m_sink.getMagSqLevels(avg, peak, nbSamples); }
     bool getSquelchOpen() const { return m_sink.getSquelchOpen(); }
     void setBasebandSampleRate(int sampleRate);
+    void startWork(int affinityGroup);
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    const BasebandExecutor::Task *getExecutorTask() const { return &m_executorTask; }
 	void setScopeXYSink(BasebandSampleSink* scopeSink) { m_sink.setScopeXYSink(scopeSink); }
 	void configureMyPosition(float myLatitude, float myLongitude) { m_sink.configureMyPosition(myLatitude, myLongitude); }
    	const DSDDecoder& getDecoder() const { return m_sink.getDecoder(); }
@@ -79,6 +85,8 @@ private:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     DSDDemodSettings m_settings;
     QMutex m_mutex;
+    bool m_running;
+    BasebandExecutor::Task m_executorTask; //!< runs the processing on the shared executor
 
     bool handleMessage(const Message& cmd);
     void applySettings(const DSDDemodSettings& settings, bool force = false);
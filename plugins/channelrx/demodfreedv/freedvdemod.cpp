@@ -19,7 +19,6 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QBuffer>
-#include <QThread>
 
 #include "SWGChannelSettings.h"
 #include "SWGFreeDVDemodSettings.h"
@@ -47,10 +46,9 @@ FreeDVDemod::FreeDVDemod(DeviceAPI *deviceAPI) :
 {
 	setObjectName(m_channelId);
 
-    m_thread = new QThread(this);
     m_basebandSink = new FreeDVDemodBaseband();
+    setExecutorTask(m_basebandSink->getExecutorTask());
     m_basebandSink->setSpectrumSink(&m_spectrumVis);
-    m_basebandSink->moveToThread(m_thread);
 
     applySettings(m_settings, true);
 
@@ -68,7 +66,6 @@ FreeDVDemod::~FreeDVDemod()
 	m_deviceAPI->removeChannelSinkAPI(this);
     m_deviceAPI->removeChannelSink(this);
     delete m_basebandSink;
-    delete m_thread;
 }
 
 uint32_t FreeDVDemod::getNumberOfDeviceStreams() const
@@ -91,14 +88,13 @@ void FreeDVDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    m_basebandSink->startWork(m_deviceAPI->getDeviceSetIndex());
 }
 
 void FreeDVDemod::stop()
 {
     qDebug() << "FreeDVDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+    m_basebandSink->stopWork();
 }
 
 bool FreeDVDemod::handleMessage(const Message& cmd)
@@ -33,13 +33,13 @@
 class QNetworkAccessManager;
 class QNetworkReply;
 class DeviceAPI;
-class QThread;
 
 class FreeDVDemod : public BasebandSampleSink, public ChannelAPI {
 	Q_OBJECT
 public:
     class MsgConfigureFreeDVDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFreeDVDemod)
 
     public:
         const FreeDVDemodSettings& getSettings() const { return m_settings; }
@@ -144,7 +144,6 @@ public:
 
 private:
 	DeviceAPI *m_deviceAPI;
-    QThread *m_thread;
     FreeDVDemodBaseband *m_basebandSink;
     FreeDVDemodSettings m_settings;
     SpectrumVis m_spectrumVis;
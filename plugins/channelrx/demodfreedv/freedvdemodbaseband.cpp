@@ -28,7 +28,9 @@ MESSAGE_CLASS_DEFINITION(FreeDVDemodBaseband::MsgResyncFreeDVDemod, Message)
 
 FreeDVDemodBaseband::FreeDVDemodBaseband() :
     m_mutex(QMutex::Recursive),
-    m_messageQueueToGUI(nullptr)
+    m_messageQueueToGUI(nullptr),
+    m_running(false),
+    m_executorTask(DSPEngine::instance()->getBasebandExecutor(), [this]() { handleInputMessages(); handleData(); })
 {
     qDebug("FreeDVDemodBaseband::FreeDVDemodBaseband");
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
@@ -38,18 +40,25 @@ FreeDVDemodBaseband::FreeDVDemodBaseband() :
         &m_sampleFifo,
         &SampleSinkFifo::dataReady,
         this,
-        &FreeDVDemodBaseband::handleData,
-        Qt::QueuedConnection
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
     );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
 
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    QObject::connect(
+        &m_inputMessageQueue,
+        &MessageQueue::messageEnqueued,
+        this,
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
+    );
 }
 
 FreeDVDemodBaseband::~FreeDVDemodBaseband()
 {
+    m_executorTask.stop();
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo());
     delete m_channelizer;
 }
@@ -60,6 +69,19 @@ void FreeDVDemodBaseband::reset()
     m_sampleFifo.reset();
 }
 
+void FreeDVDemodBaseband::startWork(int affinityGroup)
+{
+    m_executorTask.setAffinityGroup(affinityGroup);
+    m_executorTask.start();
+    m_running = true;
+}
+
+void FreeDVDemodBaseband::stopWork()
+{
+    m_executorTask.stop(); // waits for a run in progress so must not hold m_mutex
+    m_running = false;
+}
+
 void FreeDVDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
     m_sampleFifo.write(begin, end);
@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandexecutor.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -35,6 +36,7 @@ class FreeDVDemodBaseband : public QObject
 public:
     class MsgConfigureFreeDVDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFreeDVDemodBaseband)
 
     public:
         const FreeDVDemodSettings& getSettings() const { return m_settings; }
@@ -79,6 +81,10 @@ public:
     double getMagSq() { return m_sink.getMagSq(); }
     void getMagSqLevels(double& avg, double& peak, int& nbSamples) { m_sink.getMagSqLevels(avg, peak, nbSamples); }
     void setBasebandSampleRate(int sampleRate);
+    void startWork(int affinityGroup);
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    const BasebandExecutor::Task *getExecutorTask() const { return &m_executorTask; }
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_messageQueueToGUI = messageQueue; }
 
 	void setSpectrumSink(BasebandSampleSink* spectrumSink) { m_sink.setSpectrumSink(spectrumSink); }
@@ -107,6 +113,8 @@ private:
     FreeDVDemodSettings m_settings;
     QMutex m_mutex;
     MessageQueue *m_messageQueueToGUI;
+    bool m_running;
+    BasebandExecutor::Task m_executorTask; //!< runs the processing on the shared executor
 
     MessageQueue *getMessageQueueToGUI() { return m_messageQueueToGUI; }
     bool handleMessage(const Message& cmd);
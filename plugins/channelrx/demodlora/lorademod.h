@@ -35,6 +35,7 @@ class LoRaDemod : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureLoRaDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLoRaDemod)
 
     public:
         const LoRaDemodSettings& getSettings() const { return m_settings; }
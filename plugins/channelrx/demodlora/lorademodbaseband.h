@@ -35,6 +35,7 @@ class LoRaDemodBaseband : public QObject
 public:
     class MsgConfigureLoRaDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLoRaDemodBaseband)
 
     public:
         const LoRaDemodSettings& getSettings() const { return m_settings; }
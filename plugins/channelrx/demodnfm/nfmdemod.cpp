@@ -24,7 +24,6 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QBuffer>
-#include <QThread>
 
 #include "SWGChannelSettings.h"
 #include "SWGNFMDemodSettings.h"
@@ -54,9 +53,8 @@ NFMDemod::NFMDemod(DeviceAPI *devieAPI) :
     qDebug("NFMDemod::NFMDemod");
 	setObjectName(m_channelId);
 
-    m_thread = new QThread(this);
     m_basebandSink = new NFMDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    setExecutorTask(m_basebandSink->getExecutorTask());
 
 	applySettings(m_settings, true);
 
@@ -74,7 +72,6 @@ NFMDemod::~NFMDemod()
 	m_deviceAPI->removeChannelSinkAPI(this);
     m_deviceAPI->removeChannelSink(this);
     delete m_basebandSink;
-    delete m_thread;
 }
 
 uint32_t NFMDemod::getNumberOfDeviceStreams() const
@@ -97,14 +94,13 @@ void NFMDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    m_basebandSink->startWork(m_deviceAPI->getDeviceSetIndex());
 }
 
 void NFMDemod::stop()
 {
     qDebug() << "NFMDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+    m_basebandSink->stopWork();
 }
 
 bool NFMDemod::handleMessage(const Message& cmd)
@@ -257,6 +253,26 @@ bool NFMDemod::deserialize(const QByteArray& data)
     return success;
 }
 
+bool NFMDemod::setSettingsFields(const ChannelSettingsFields& fields)
+{
+    NFMDemodSettings settings = m_settings;
+    fields.apply(settings);
+    configureSettings(settings);
+    return true;
+}
+
+void NFMDemod::configureSettings(const NFMDemodSettings& settings)
+{
+    MsgConfigureNFMDemod *msg = MsgConfigureNFMDemod::create(settings, false);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureNFMDemod *msgToGUI = MsgConfigureNFMDemod::create(settings, false);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+}
+
 int NFMDemod::webapiSettingsGet(
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage)
@@ -32,7 +32,6 @@
 
 class QNetworkAccessManager;
 class QNetworkReply;
-class QThread;
 class DeviceAPI;
 
 class NFMDemod : public BasebandSampleSink, public ChannelAPI {
@@ -40,6 +39,7 @@ class NFMDemod : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureNFMDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureNFMDemod)
 
     public:
         const NFMDemodSettings& getSettings() const { return m_settings; }
@@ -74,6 +74,8 @@ public:
     virtual const QString& getURI() const { return m_channelIdURI; }
     virtual void getTitle(QString& title) { title = m_settings.m_title; }
     virtual qint64 getCenterFrequency() const { return m_settings.m_inputFrequencyOffset; }
+    virtual bool setSettingsFields(const ChannelSettingsFields& fields);
+    virtual bool getRfBandwidth(double& rfBandwidth) const { rfBandwidth = m_settings.m_rfBandwidth; return true; }
 
     virtual QByteArray serialize() const;
     virtual bool deserialize(const QByteArray& data);
@@ -125,7 +127,6 @@ public:
 
 private:
     DeviceAPI* m_deviceAPI;
-    QThread *m_thread;
     NFMDemodBaseband* m_basebandSink;
 	NFMDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
@@ -136,6 +137,7 @@ private:
     static const int m_udpBlockSize;
 
     void applySettings(const NFMDemodSettings& settings, bool force = false);
+    void configureSettings(const NFMDemodSettings& settings); //!< apply and forward to GUI
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const NFMDemodSettings& settings, bool force);
 
@@ -26,7 +26,9 @@
 MESSAGE_CLASS_DEFINITION(NFMDemodBaseband::MsgConfigureNFMDemodBaseband, Message)
 
 NFMDemodBaseband::NFMDemodBaseband() :
-    m_mutex(QMutex::Recursive)
+    m_mutex(QMutex::Recursive),
+    m_running(false),
+    m_executorTask(DSPEngine::instance()->getBasebandExecutor(), [this]() { handleInputMessages(); handleData(); })
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
@@ -36,18 +38,25 @@ NFMDemodBaseband::NFMDemodBaseband() :
         &m_sampleFifo,
         &SampleSinkFifo::dataReady,
         this,
-        &NFMDemodBaseband::handleData,
-        Qt::QueuedConnection
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
     );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_sink.applyAudioSampleRate(DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate());
 
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    QObject::connect(
+        &m_inputMessageQueue,
+        &MessageQueue::messageEnqueued,
+        this,
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
+    );
 }
 
 NFMDemodBaseband::~NFMDemodBaseband()
 {
+    m_executorTask.stop();
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo());
     delete m_channelizer;
 }
@@ -58,6 +67,19 @@ void NFMDemodBaseband::reset()
     m_sampleFifo.reset();
 }
 
+void NFMDemodBaseband::startWork(int affinityGroup)
+{
+    m_executorTask.setAffinityGroup(affinityGroup);
+    m_executorTask.start();
+    m_running = true;
+}
+
+void NFMDemodBaseband::stopWork()
+{
+    m_executorTask.stop(); // waits for a run in progress so must not hold m_mutex
+    m_running = false;
+}
+
 void NFMDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
     m_sampleFifo.write(begin, end);
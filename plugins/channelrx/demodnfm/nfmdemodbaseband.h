@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandexecutor.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -35,6 +36,7 @@ class NFMDemodBaseband : public QObject
 public:
     class MsgConfigureNFMDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureNFMDemodBaseband)
 
     public:
         const NFMDemodSettings& getSettings() const { return m_settings; }
@@ -69,6 +71,10 @@ public:
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_sink.setMessageQueueToGUI(messageQueue); }
     int getAudioSampleRate() const { return m_sink.getAudioSampleRate(); }
     void setBasebandSampleRate(int sampleRate);
+    void startWork(int affinityGroup);
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    const BasebandExecutor::Task *getExecutorTask() const { return &m_executorTask; }
 
 private:
     SampleSinkFifo m_sampleFifo;
@@ -77,6 +83,8 @@ private:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     NFMDemodSettings m_settings;
     QMutex m_mutex;
+    bool m_running;
+    BasebandExecutor::Task m_executorTask; //!< runs the processing on the shared executor
 
     bool handleMessage(const Message& cmd);
     void applySettings(const NFMDemodSettings& settings, bool force = false);
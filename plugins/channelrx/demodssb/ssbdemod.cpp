@@ -25,7 +25,6 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QBuffer>
-#include <QThread>
 
 #include "SWGChannelSettings.h"
 #include "SWGSSBDemodSettings.h"
@@ -53,10 +52,9 @@ SSBDemod::SSBDemod(DeviceAPI *deviceAPI) :
 {
 	setObjectName(m_channelId);
 
-    m_thread = new QThread(this);
     m_basebandSink = new SSBDemodBaseband();
+    setExecutorTask(m_basebandSink->getExecutorTask());
     m_basebandSink->setSpectrumSink(&m_spectrumVis);
-    m_basebandSink->moveToThread(m_thread);
 
 	applySettings(m_settings, true);
 
@@ -74,7 +72,6 @@ SSBDemod::~SSBDemod()
 	m_deviceAPI->removeChannelSinkAPI(this);
     m_deviceAPI->removeChannelSink(this);
     delete m_basebandSink;
-    delete m_thread;
 }
 
 uint32_t SSBDemod::getNumberOfDeviceStreams() const
@@ -97,14 +94,13 @@ void SSBDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    m_basebandSink->startWork(m_deviceAPI->getDeviceSetIndex());
 }
 
 void SSBDemod::stop()
 {
     qDebug() << "SSBDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+    m_basebandSink->stopWork();
 }
 
 bool SSBDemod::handleMessage(const Message& cmd)
@@ -260,6 +256,26 @@ bool SSBDemod::deserialize(const QByteArray& data)
     }
 }
 
+bool SSBDemod::setSettingsFields(const ChannelSettingsFields& fields)
+{
+    SSBDemodSettings settings = m_settings;
+    fields.apply(settings);
+    configureSettings(settings);
+    return true;
+}
+
+void SSBDemod::configureSettings(const SSBDemodSettings& settings)
+{
+    MsgConfigureSSBDemod *msg = MsgConfigureSSBDemod::create(settings, false);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureSSBDemod *msgToGUI = MsgConfigureSSBDemod::create(settings, false);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+}
+
 int SSBDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -34,7 +34,6 @@
 
 class QNetworkAccessManager;
 class QNetworkReply;
-class QThread;
 class DeviceAPI;
 
 class SSBDemod : public BasebandSampleSink, public ChannelAPI {
@@ -42,6 +41,7 @@ class SSBDemod : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureSSBDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSSBDemod)
 
     public:
         const SSBDemodSettings& getSettings() const { return m_settings; }
@@ -77,6 +77,8 @@ public:
     virtual const QString& getURI() const { return m_channelIdURI; }
     virtual void getTitle(QString& title) { title = m_settings.m_title; }
     virtual qint64 getCenterFrequency() const { return m_settings.m_inputFrequencyOffset; }
+    virtual bool setSettingsFields(const ChannelSettingsFields& fields);
+    virtual bool getRfBandwidth(double& rfBandwidth) const { rfBandwidth = m_settings.m_rfBandwidth; return true; }
 
     virtual QByteArray serialize() const;
     virtual bool deserialize(const QByteArray& data);
@@ -129,7 +131,6 @@ public:
 
 private:
 	DeviceAPI *m_deviceAPI;
-    QThread *m_thread;
     SSBDemodBaseband* m_basebandSink;
     SSBDemodSettings m_settings;
     SpectrumVis m_spectrumVis;
@@ -139,6 +140,7 @@ private:
     QNetworkRequest m_networkRequest;
 
 	void applySettings(const SSBDemodSettings& settings, bool force = false);
+	void configureSettings(const SSBDemodSettings& settings); //!< apply and forward to GUI
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const SSBDemodSettings& settings, bool force);
 
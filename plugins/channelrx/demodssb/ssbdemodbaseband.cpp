@@ -27,7 +27,9 @@ MESSAGE_CLASS_DEFINITION(SSBDemodBaseband::MsgConfigureSSBDemodBaseband, Message
 
 SSBDemodBaseband::SSBDemodBaseband() :
     m_messageQueueToGUI(nullptr),
-    m_mutex(QMutex::Recursive)
+    m_mutex(QMutex::Recursive),
+    m_running(false),
+    m_executorTask(DSPEngine::instance()->getBasebandExecutor(), [this]() { handleInputMessages(); handleData(); })
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
@@ -37,19 +39,26 @@ SSBDemodBaseband::SSBDemodBaseband() :
         &m_sampleFifo,
         &SampleSinkFifo::dataReady,
         this,
-        &SSBDemodBaseband::handleData,
-        Qt::QueuedConnection
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
     );
 
     DSPEngine::instance()->getAudioDeviceManager()->addAudioSink(m_sink.getAudioFifo(), getInputMessageQueue());
     m_audioSampleRate = DSPEngine::instance()->getAudioDeviceManager()->getOutputSampleRate();
     m_sink.applyAudioSampleRate(m_audioSampleRate);
 
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    QObject::connect(
+        &m_inputMessageQueue,
+        &MessageQueue::messageEnqueued,
+        this,
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
+    );
 }
 
 SSBDemodBaseband::~SSBDemodBaseband()
 {
+    m_executorTask.stop();
     DSPEngine::instance()->getAudioDeviceManager()->removeAudioSink(m_sink.getAudioFifo());
     delete m_channelizer;
 }
@@ -61,6 +70,19 @@ void SSBDemodBaseband::reset()
     m_sampleFifo.reset();
 }
 
+void SSBDemodBaseband::startWork(int affinityGroup)
+{
+    m_executorTask.setAffinityGroup(affinityGroup);
+    m_executorTask.start();
+    m_running = true;
+}
+
+void SSBDemodBaseband::stopWork()
+{
+    m_executorTask.stop(); // waits for a run in progress so must not hold m_mutex
+    m_running = false;
+}
+
 void SSBDemodBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
     m_sampleFifo.write(begin, end);
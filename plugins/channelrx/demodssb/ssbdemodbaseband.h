@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandexecutor.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -35,6 +36,7 @@ class SSBDemodBaseband : public QObject
 public:
     class MsgConfigureSSBDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSSBDemodBaseband)
 
     public:
         const SSBDemodSettings& getSettings() const { return m_settings; }
@@ -68,6 +70,10 @@ public:
     unsigned int getAudioSampleRate() const { return m_audioSampleRate; }
     bool getAudioActive() const { return m_sink.getAudioActive(); }
     void setBasebandSampleRate(int sampleRate);
+    void startWork(int affinityGroup);
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    const BasebandExecutor::Task *getExecutorTask() const { return &m_executorTask; }
     void setMessageQueueToGUI(MessageQueue *messageQueue) { m_messageQueueToGUI = messageQueue; }
 
 private:
@@ -79,6 +85,8 @@ private:
     unsigned int m_audioSampleRate;
     MessageQueue *m_messageQueueToGUI;
     QMutex m_mutex;
+    bool m_running;
+    BasebandExecutor::Task m_executorTask; //!< runs the processing on the shared executor
 
     bool handleMessage(const Message& cmd);
     void applySettings(const SSBDemodSettings& settings, bool force = false);
@@ -25,7 +25,6 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QBuffer>
-#include <QThread>
 
 #include "SWGChannelSettings.h"
 #include "SWGWFMDemodSettings.h"
@@ -55,9 +54,8 @@ WFMDemod::WFMDemod(DeviceAPI* deviceAPI) :
 {
 	setObjectName(m_channelId);
 
-    m_thread = new QThread(this);
     m_basebandSink = new WFMDemodBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    setExecutorTask(m_basebandSink->getExecutorTask());
 
 	applySettings(m_settings, true);
 
@@ -76,7 +74,6 @@ WFMDemod::~WFMDemod()
     m_deviceAPI->removeChannelSinkAPI(this);
     m_deviceAPI->removeChannelSink(this);
     delete m_basebandSink;
-    delete m_thread;
 }
 
 uint32_t WFMDemod::getNumberOfDeviceStreams() const
@@ -99,14 +96,13 @@ void WFMDemod::start()
     }
 
     m_basebandSink->reset();
-    m_thread->start();
+    m_basebandSink->startWork(m_deviceAPI->getDeviceSetIndex());
 }
 
 void WFMDemod::stop()
 {
     qDebug() << "WFMDemod::stop";
-	m_thread->exit();
-	m_thread->wait();
+    m_basebandSink->stopWork();
 }
 
 bool WFMDemod::handleMessage(const Message& cmd)
@@ -236,6 +232,26 @@ bool WFMDemod::deserialize(const QByteArray& data)
     }
 }
 
+bool WFMDemod::setSettingsFields(const ChannelSettingsFields& fields)
+{
+    WFMDemodSettings settings = m_settings;
+    fields.apply(settings);
+    configureSettings(settings);
+    return true;
+}
+
+void WFMDemod::configureSettings(const WFMDemodSettings& settings)
+{
+    MsgConfigureWFMDemod *msg = MsgConfigureWFMDemod::create(settings, false);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureWFMDemod *msgToGUI = MsgConfigureWFMDemod::create(settings, false);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+}
+
 int WFMDemod::webapiSettingsGet(
         SWGSDRangel::SWGChannelSettings& response,
         QString& errorMessage)
@@ -39,6 +39,7 @@ class WFMDemod : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureWFMDemod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureWFMDemod)
 
     public:
         const WFMDemodSettings& getSettings() const { return m_settings; }
@@ -73,6 +74,8 @@ public:
     virtual const QString& getURI() const { return m_channelIdURI; }
     virtual void getTitle(QString& title) { title = m_settings.m_title; }
     virtual qint64 getCenterFrequency() const { return m_settings.m_inputFrequencyOffset; }
+    virtual bool setSettingsFields(const ChannelSettingsFields& fields);
+    virtual bool getRfBandwidth(double& rfBandwidth) const { rfBandwidth = m_settings.m_rfBandwidth; return true; }
 
     virtual QByteArray serialize() const;
     virtual bool deserialize(const QByteArray& data);
@@ -123,7 +126,6 @@ public:
 
 private:
     DeviceAPI* m_deviceAPI;
-    QThread *m_thread;
     WFMDemodBaseband* m_basebandSink;
     WFMDemodSettings m_settings;
     int m_basebandSampleRate; //!< stored from device message used when starting baseband sink
@@ -134,6 +136,7 @@ private:
     static const int m_udpBlockSize;
 
     void applySettings(const WFMDemodSettings& settings, bool force = false);
+    void configureSettings(const WFMDemodSettings& settings); //!< apply and forward to GUI
 
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const WFMDemodSettings& settings, bool force);
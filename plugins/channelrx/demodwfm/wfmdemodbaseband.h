@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandexecutor.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -35,6 +36,7 @@ class WFMDemodBaseband : public QObject
 public:
     class MsgConfigureWFMDemodBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureWFMDemodBaseband)
 
     public:
         const WFMDemodSettings& getSettings() const { return m_settings; }
@@ -63,6 +65,10 @@ public:
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     int getChannelSampleRate() const;
     void setBasebandSampleRate(int sampleRate);
+    void startWork(int affinityGroup);
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    const BasebandExecutor::Task *getExecutorTask() const { return &m_executorTask; }
 
     int getAudioSampleRate() const { return m_sink.getAudioSampleRate(); }
 	double getMagSq() const { return m_sink.getMagSq(); }
@@ -77,6 +83,8 @@ private:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     WFMDemodSettings m_settings;
     QMutex m_mutex;
+    bool m_running;
+    BasebandExecutor::Task m_executorTask; //!< runs the processing on the shared executor
 
     bool handleMessage(const Message& cmd);
     void applySettings(const WFMDemodSettings& settings, bool force = false);
@@ -41,6 +41,7 @@ class FileSink : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureFileSink : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFileSink)
 
     public:
         const FileSinkSettings& getSettings() const { return m_settings; }
@@ -38,6 +38,7 @@ class FileSinkBaseband : public QObject
 public:
     class MsgConfigureFileSinkBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFileSinkBaseband)
 
     public:
         const FileSinkSettings& getSettings() const { return m_settings; }
@@ -486,7 +486,7 @@ void FileSinkGUI::on_showFileDialog_clicked(bool checked)
         this,
         tr("Save record file"),
         m_settings.m_fileRecordName,
-        tr("SDR I/Q Files (*.sdriq)")
+        tr("SDR I/Q Files (*.sdriq);;SDR chunked I/Q Files (*.sdriqc)")
     );
 
     fileDialog.setOptions(QFileDialog::DontUseNativeDialog);
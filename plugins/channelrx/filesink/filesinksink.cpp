@@ -26,6 +26,7 @@
 FileSinkSink::FileSinkSink() :
     m_spectrumSink(nullptr),
     m_msgQueueToGUI(nullptr),
+    m_fileRecord(&m_fileSink),
     m_nbCaptures(0),
     m_preRecordBuffer(48000),
     m_preRecordFill(0),
@@ -46,17 +47,17 @@ void FileSinkSink::startRecording()
     {
         // set the length of pre record time
         qint64 mSShift = (m_preRecordFill * 1000) / m_sinkSampleRate;
-        m_fileSink.setMsShift(-mSShift);
+        m_fileRecord->setMsShift(-mSShift);
 
         // notify capture start
-        m_fileSink.startRecording();
+        m_fileRecord->startRecording();
         m_record = true;
         m_nbCaptures++;
 
         if (m_msgQueueToGUI)
         {
             FileSinkMessages::MsgReportRecordFileName *msg
-                = FileSinkMessages::MsgReportRecordFileName::create(m_fileSink.getCurrentFileName());
+                = FileSinkMessages::MsgReportRecordFileName::create(m_fileRecord->getCurrentFileName());
             m_msgQueueToGUI->push(msg);
         }
 
@@ -65,10 +66,10 @@ void FileSinkSink::startRecording()
         m_preRecordBuffer.readBegin(m_preRecordFill, &p1Begin, &p1End, &p2Begin, &p2End);
 
         if (p1Begin != p1End) {
-            m_fileSink.feed(p1Begin, p1End, false);
+            m_fileRecord->feed(p1Begin, p1End, false);
         }
         if (p2Begin != p2End) {
-            m_fileSink.feed(p2Begin, p2End, false);
+            m_fileRecord->feed(p2Begin, p2End, false);
         }
 
         m_byteCount += m_preRecordFill * sizeof(Sample);
@@ -84,9 +85,27 @@ void FileSinkSink::stopRecording()
     if (m_record)
     {
         m_preRecordBuffer.reset();
-        m_fileSink.stopRecording();
+        m_fileRecord->stopRecording();
         m_record = false;
     }
+    else if (m_chunkedFileSink.isSuspended())
+    {
+        m_chunkedFileSink.stopRecording();
+    }
+}
+
+void FileSinkSink::suspendRecording()
+{
+    if (m_fileRecord == &m_chunkedFileSink) // next capture goes into the same file after a gap
+    {
+        m_preRecordBuffer.reset();
+        m_chunkedFileSink.suspendRecording();
+        m_record = false;
+    }
+    else
+    {
+        stopRecording();
+    }
 }
 
 void FileSinkSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
@@ -122,13 +141,13 @@ void FileSinkSink::feed(const SampleVector::const_iterator& begin, const SampleV
 
         if (m_squelchOpen)
         {
-            m_fileSink.feed(beginw, endw, true);
+            m_fileRecord->feed(beginw, endw, true);
         }
         else
         {
             if (nbToWrite < m_postSquelchCounter)
             {
-                m_fileSink.feed(beginw, endw, true);
+                m_fileRecord->feed(beginw, endw, true);
                 m_postSquelchCounter -= nbToWrite;
             }
             else
@@ -139,11 +158,11 @@ void FileSinkSink::feed(const SampleVector::const_iterator& begin, const SampleV
                     m_msgQueueToGUI->push(msg);
                 }
 
-                m_fileSink.feed(beginw, endw + m_postSquelchCounter, true);
+                m_fileRecord->feed(beginw, endw + m_postSquelchCounter, true);
                 nbToWrite = m_postSquelchCounter;
                 m_postSquelchCounter = 0;
 
-                stopRecording();
+                suspendRecording();
             }
         }
 
@@ -155,7 +174,7 @@ void FileSinkSink::feed(const SampleVector::const_iterator& begin, const SampleV
     }
     else if (m_record)
     {
-        m_fileSink.feed(beginw, endw, true);
+        m_fileRecord->feed(beginw, endw, true);
         int nbSamples = endw - beginw;
         m_byteCount += nbSamples * sizeof(Sample);
 
@@ -217,7 +236,9 @@ void FileSinkSink::applyChannelSettings(
     {
         DSPSignalNotification *notif = new DSPSignalNotification(sinkSampleRate, centerFrequency);
         DSPSignalNotification *notifToSpectrum = new DSPSignalNotification(*notif);
+        DSPSignalNotification *notifToChunked = new DSPSignalNotification(*notif);
         m_fileSink.getInputMessageQueue()->push(notif);
+        m_chunkedFileSink.getInputMessageQueue()->push(notifToChunked);
         m_spectrumSink->getInputMessageQueue()->push(notifToSpectrum);
 
         if (m_msgQueueToGUI)
@@ -250,9 +271,17 @@ void FileSinkSink::applySettings(const FileSinkSettings& settings, bool force)
         QString fileBase;
         FileRecordInterface::RecordType recordType = FileRecordInterface::guessTypeFromFileName(settings.m_fileRecordName, fileBase);
 
-        if (recordType == FileRecordInterface::RecordTypeSdrIQ)
+        stopRecording(); // a suspended chunked record is closed
+
+        if ((recordType == FileRecordInterface::RecordTypeSdrIQ) || (recordType == FileRecordInterface::RecordTypeSdrIQChunked))
         {
-            m_fileSink.setFileName(fileBase);
+            if (recordType == FileRecordInterface::RecordTypeSdrIQ) {
+                m_fileRecord = &m_fileSink;
+            } else {
+                m_fileRecord = &m_chunkedFileSink;
+            }
+
+            m_fileRecord->setFileName(fileBase);
             m_msCount = 0;
             m_byteCount = 0;
             m_nbCaptures = 0;
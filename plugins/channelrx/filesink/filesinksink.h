@@ -20,6 +20,7 @@
 
 #include "dsp/channelsamplesink.h"
 #include "dsp/filerecord.h"
+#include "dsp/filerecordchunked.h"
 #include "dsp/decimatorc.h"
 #include "dsp/samplesimplefifo.h"
 #include "dsp/ncof.h"
@@ -36,10 +37,11 @@ public:
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
 
-    FileRecord *getFileSink() { return &m_fileSink; }
+    FileRecordInterface *getFileSink() { return m_fileRecord; }
     void setSpectrumSink(SpectrumVis* spectrumSink) { m_spectrumSink = spectrumSink; }
     void startRecording();
     void stopRecording();
+    void suspendRecording(); //!< end of squelch capture
     void setDeviceHwId(const QString& hwId) { m_deviceHwId = hwId; }
     void setDeviceUId(int uid) { m_deviceUId = uid; }
     void applyChannelSettings(
@@ -67,6 +69,8 @@ private:
     SampleVector m_sampleBuffer;
     FileSinkSettings m_settings;
     FileRecord m_fileSink;
+    FileRecordChunked m_chunkedFileSink;
+    FileRecordInterface *m_fileRecord; //!< active one of the above
     unsigned int m_nbCaptures;
     SampleSimpleFifo m_preRecordBuffer;
     unsigned int m_preRecordFill;
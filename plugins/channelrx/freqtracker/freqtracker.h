@@ -38,6 +38,7 @@ class FreqTracker : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureFreqTracker : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFreqTracker)
 
     public:
         const FreqTrackerSettings& getSettings() const { return m_settings; }
@@ -35,6 +35,7 @@ class FreqTrackerBaseband : public QObject
 public:
     class MsgConfigureFreqTrackerBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFreqTrackerBaseband)
 
     public:
         const FreqTrackerSettings& getSettings() const { return m_settings; }
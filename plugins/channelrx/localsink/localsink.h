@@ -41,6 +41,7 @@ class LocalSink : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureLocalSink : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLocalSink)
 
     public:
         const LocalSinkSettings& getSettings() const { return m_settings; }
@@ -120,7 +120,6 @@ bool LocalSinkBaseband::handleMessage(const Message& cmd)
         qDebug() << "LocalSinkBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
         m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
         m_channelizer->setBasebandSampleRate(notif.getSampleRate(), true); // apply decimation
-        m_sink.setSampleRate(getChannelSampleRate());
 
 		return true;
     }
@@ -169,7 +168,6 @@ void LocalSinkBaseband::applySettings(const LocalSinkSettings& settings, bool fo
      || (settings.m_filterChainHash != m_settings.m_filterChainHash) || force)
     {
         m_channelizer->setDecimation(settings.m_log2Decim, settings.m_filterChainHash);
-        m_sink.setSampleRate(getChannelSampleRate());
     }
 
     //m_source.applySettings(settings, force);
@@ -36,6 +36,7 @@ class LocalSinkBaseband : public QObject
 public:
     class MsgConfigureLocalSinkBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLocalSinkBaseband)
 
     public:
         const LocalSinkSettings& getSettings() const { return m_settings; }
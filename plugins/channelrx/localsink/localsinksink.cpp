@@ -20,20 +20,19 @@
 #include <boost/crc.hpp>
 #include <boost/cstdint.hpp>
 #include "dsp/devicesamplesource.h"
+#include "dsp/sampleblockqueue.h"
 #include "dsp/hbfilterchainconverter.h"
 
-#include "localsinkworker.h"
 #include "localsinksink.h"
 
 LocalSinkSink::LocalSinkSink() :
-        m_sinkWorker(nullptr),
+        m_deviceSampleBlockQueue(nullptr),
         m_running(false),
         m_centerFrequency(0),
         m_frequencyOffset(0),
         m_sampleRate(48000),
         m_deviceSampleRate(48000)
 {
-    m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(4000000));
     applySettings(m_settings, true);
 }
 
@@ -41,9 +40,24 @@ LocalSinkSink::~LocalSinkSink()
 {
 }
 
+// Without decimation the samples belong to the device engine of this channel: they are copied into a block
 void LocalSinkSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-    m_sampleFifo.write(begin, end);
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_deviceSampleBlockQueue) {
+        m_deviceSampleBlockQueue->push(begin, end);
+    }
+}
+
+// The channelizer output buffer is handed to the local input device engine without copying the samples
+void LocalSinkSink::feedBuffer(SampleVector& samples)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_deviceSampleBlockQueue) {
+        m_deviceSampleBlockQueue->push(samples);
+    }
 }
 
 void LocalSinkSink::start(DeviceSampleSource *deviceSource)
@@ -54,60 +68,23 @@ void LocalSinkSink::start(DeviceSampleSource *deviceSource)
         stop();
     }
 
-    m_sinkWorker = new LocalSinkWorker();
-    m_sinkWorker->moveToThread(&m_sinkWorkerThread);
-    m_sinkWorker->setSampleFifo(&m_sampleFifo);
+    QMutexLocker mutexLocker(&m_mutex);
 
     if (deviceSource) {
-        m_sinkWorker->setDeviceSampleFifo(deviceSource->getSampleFifo());
+        m_deviceSampleBlockQueue = deviceSource->getSampleBlockQueue(); // null if not a local input
     }
 
-    QObject::connect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        m_sinkWorker,
-        &LocalSinkWorker::handleData,
-        Qt::QueuedConnection
-    );
-
-    startWorker();
     m_running = true;
 }
 
 void LocalSinkSink::stop()
 {
     qDebug("LocalSinkSink::stop");
-
-    QObject::disconnect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        m_sinkWorker,
-        &LocalSinkWorker::handleData
-    );
-
-    if (m_sinkWorker != 0)
-    {
-        stopWorker();
-        m_sinkWorker->deleteLater();
-        m_sinkWorker = nullptr;
-    }
-
+    QMutexLocker mutexLocker(&m_mutex);
+    m_deviceSampleBlockQueue = nullptr;
     m_running = false;
 }
 
-void LocalSinkSink::startWorker()
-{
-	m_sinkWorker->startStop(true);
-	m_sinkWorkerThread.start();
-}
-
-void LocalSinkSink::stopWorker()
-{
-	m_sinkWorker->startStop(false);
-	m_sinkWorkerThread.quit();
-	m_sinkWorkerThread.wait();
-}
-
 void LocalSinkSink::applySettings(const LocalSinkSettings& settings, bool force)
 {
     qDebug() << "LocalSinkSink::applySettings:"
@@ -117,8 +94,3 @@ void LocalSinkSink::applySettings(const LocalSinkSettings& settings, bool force)
 
     m_settings = settings;
 }
-
-void LocalSinkSink::setSampleRate(int sampleRate)
-{
-    m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(sampleRate));
-}
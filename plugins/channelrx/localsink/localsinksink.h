@@ -19,14 +19,14 @@
 #define INCLUDE_LOCALSINKSINK_H_
 
 #include <QObject>
-#include <QThread>
+#include <QMutex>
 
 #include "dsp/channelsamplesink.h"
 
 #include "localsinksettings.h"
 
 class DeviceSampleSource;
-class LocalSinkWorker;
+class SampleBlockQueue;
 
 class LocalSinkSink : public QObject, public ChannelSampleSink {
     Q_OBJECT
@@ -35,27 +35,23 @@ public:
 	~LocalSinkSink();
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    virtual void feedBuffer(SampleVector& samples);
 
     void applySettings(const LocalSinkSettings& settings, bool force = false);
     void start(DeviceSampleSource *deviceSource);
     void stop();
     bool isRunning() const { return m_running; }
-    void setSampleRate(int sampleRate);
 
 private:
-    SampleSinkFifo m_sampleFifo;
     LocalSinkSettings m_settings;
-    LocalSinkWorker *m_sinkWorker;
-    QThread m_sinkWorkerThread;
+    SampleBlockQueue *m_deviceSampleBlockQueue; //!< queue of the local input device the channel sample blocks are handed to
+    QMutex m_mutex;
     bool m_running;
 
     uint64_t m_centerFrequency;
     int64_t m_frequencyOffset;
     uint32_t m_sampleRate;
     uint32_t m_deviceSampleRate;
-
-	void startWorker();
-	void stopWorker();
 };
 
 #endif // INCLUDE_LOCALSINKSINK_H_
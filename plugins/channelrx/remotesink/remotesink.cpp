@@ -26,9 +26,9 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QBuffer>
-#include <QThread>
 
 #include "SWGChannelSettings.h"
+#include "SWGChannelReport.h"
 
 #include "util/simpleserializer.h"
 #include "dsp/dspcommands.h"
@@ -52,9 +52,8 @@ RemoteSink::RemoteSink(DeviceAPI *deviceAPI) :
 {
     setObjectName(m_channelId);
 
-    m_thread = new QThread(this);
     m_basebandSink = new RemoteSinkBaseband();
-    m_basebandSink->moveToThread(m_thread);
+    setExecutorTask(m_basebandSink->getExecutorTask());
 
     applySettings(m_settings, true);
 
@@ -72,7 +71,6 @@ RemoteSink::~RemoteSink()
     m_deviceAPI->removeChannelSinkAPI(this);
     m_deviceAPI->removeChannelSink(this);
     delete m_basebandSink;
-    delete m_thread;
 }
 
 uint32_t RemoteSink::getNumberOfDeviceStreams() const
@@ -95,7 +93,7 @@ void RemoteSink::start()
         m_basebandSink->setBasebandSampleRate(m_basebandSampleRate);
     }
 
-    m_thread->start();
+    m_basebandSink->startWork(m_deviceAPI->getDeviceSetIndex());
     m_basebandSink->startSender();
 }
 
@@ -103,8 +101,7 @@ void RemoteSink::stop()
 {
     qDebug("RemoteSink::stop");
     m_basebandSink->stopSender();
-	m_thread->exit();
-	m_thread->wait();
+    m_basebandSink->stopWork();
 }
 
 bool RemoteSink::handleMessage(const Message& cmd)
@@ -197,6 +194,12 @@ void RemoteSink::applySettings(const RemoteSinkSettings& settings, bool force)
     if ((m_settings.m_title != settings.m_title) || force) {
         reverseAPIKeys.append("title");
     }
+    if ((m_settings.m_transportPacking != settings.m_transportPacking) || force) {
+        reverseAPIKeys.append("transportPacking");
+    }
+    if ((m_settings.m_transportLZ4 != settings.m_transportLZ4) || force) {
+        reverseAPIKeys.append("transportLZ4");
+    }
 
     if ((m_settings.m_log2Decim != settings.m_log2Decim) || force)
     {
@@ -297,6 +300,17 @@ int RemoteSink::webapiSettingsPutPatch(
     return 200;
 }
 
+int RemoteSink::webapiReportGet(
+        SWGSDRangel::SWGChannelReport& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setRemoteSinkReport(new SWGSDRangel::SWGRemoteSinkReport());
+    response.getRemoteSinkReport()->init();
+    webapiFormatChannelReport(response);
+    return 200;
+}
+
 void RemoteSink::webapiUpdateChannelSettings(
         RemoteSinkSettings& settings,
         const QStringList& channelSettingsKeys,
@@ -359,6 +373,16 @@ void RemoteSink::webapiUpdateChannelSettings(
         settings.m_streamIndex = response.getRemoteSinkSettings()->getStreamIndex();
     }
 
+    if (channelSettingsKeys.contains("transportPacking"))
+    {
+        int transportPacking = response.getRemoteSinkSettings()->getTransportPacking();
+        settings.m_transportPacking = transportPacking < 0 ? 0 : transportPacking > 2 ? 2 : transportPacking;
+    }
+
+    if (channelSettingsKeys.contains("transportLZ4")) {
+        settings.m_transportLZ4 = response.getRemoteSinkSettings()->getTransportLz4() != 0;
+    }
+
     if (channelSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getRemoteSinkSettings()->getUseReverseApi() != 0;
     }
@@ -399,6 +423,8 @@ void RemoteSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& re
     response.getRemoteSinkSettings()->setLog2Decim(settings.m_log2Decim);
     response.getRemoteSinkSettings()->setFilterChainHash(settings.m_filterChainHash);
     response.getRemoteSinkSettings()->setStreamIndex(settings.m_streamIndex);
+    response.getRemoteSinkSettings()->setTransportPacking(settings.m_transportPacking);
+    response.getRemoteSinkSettings()->setTransportLz4(settings.m_transportLZ4 ? 1 : 0);
     response.getRemoteSinkSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getRemoteSinkSettings()->getReverseApiAddress()) {
@@ -412,6 +438,16 @@ void RemoteSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& re
     response.getRemoteSinkSettings()->setReverseApiChannelIndex(settings.m_reverseAPIChannelIndex);
 }
 
+void RemoteSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
+{
+    int encoding;
+    float compressionRatio, codecTimeUs;
+    m_basebandSink->getCodecStats(encoding, compressionRatio, codecTimeUs);
+    response.getRemoteSinkReport()->setTransportEncoding(encoding);
+    response.getRemoteSinkReport()->setCompressionRatio(compressionRatio);
+    response.getRemoteSinkReport()->setCodecTimeUs(codecTimeUs);
+}
+
 void RemoteSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const RemoteSinkSettings& settings, bool force)
 {
     SWGSDRangel::SWGChannelSettings *swgChannelSettings = new SWGSDRangel::SWGChannelSettings();
@@ -452,6 +488,12 @@ void RemoteSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys,
     if (channelSettingsKeys.contains("streamIndex") || force) {
         swgRemoteSinkSettings->setStreamIndex(settings.m_streamIndex);
     }
+    if (channelSettingsKeys.contains("transportPacking") || force) {
+        swgRemoteSinkSettings->setTransportPacking(settings.m_transportPacking);
+    }
+    if (channelSettingsKeys.contains("transportLZ4") || force) {
+        swgRemoteSinkSettings->setTransportLz4(settings.m_transportLZ4 ? 1 : 0);
+    }
 
     QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
             .arg(settings.m_reverseAPIAddress)
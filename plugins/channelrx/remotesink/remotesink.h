@@ -40,6 +40,7 @@ class RemoteSink : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureRemoteSink : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureRemoteSink)
 
     public:
         const RemoteSinkSettings& getSettings() const { return m_settings; }
@@ -98,6 +99,10 @@ public:
             SWGSDRangel::SWGChannelSettings& response,
             QString& errorMessage);
 
+    virtual int webapiReportGet(
+            SWGSDRangel::SWGChannelReport& response,
+            QString& errorMessage);
+
     static void webapiFormatChannelSettings(
         SWGSDRangel::SWGChannelSettings& response,
         const RemoteSinkSettings& settings);
@@ -118,7 +123,6 @@ signals:
 
 private:
     DeviceAPI *m_deviceAPI;
-    QThread *m_thread;
     RemoteSinkBaseband *m_basebandSink;
     RemoteSinkSettings m_settings;
 
@@ -132,6 +136,7 @@ private:
     void applySettings(const RemoteSinkSettings& settings, bool force = false);
     static void validateFilterChainHash(RemoteSinkSettings& settings);
     void calculateFrequencyOffset();
+    void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const RemoteSinkSettings& settings, bool force);
 
 private slots:
@@ -26,7 +26,9 @@
 MESSAGE_CLASS_DEFINITION(RemoteSinkBaseband::MsgConfigureRemoteSinkBaseband, Message)
 
 RemoteSinkBaseband::RemoteSinkBaseband() :
-    m_mutex(QMutex::Recursive)
+    m_mutex(QMutex::Recursive),
+    m_running(false),
+    m_executorTask(DSPEngine::instance()->getBasebandExecutor(), [this]() { handleInputMessages(); handleData(); })
 {
     m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
     m_channelizer = new DownChannelizer(&m_sink);
@@ -36,15 +38,22 @@ RemoteSinkBaseband::RemoteSinkBaseband() :
         &m_sampleFifo,
         &SampleSinkFifo::dataReady,
         this,
-        &RemoteSinkBaseband::handleData,
-        Qt::QueuedConnection
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
     );
 
-    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    QObject::connect(
+        &m_inputMessageQueue,
+        &MessageQueue::messageEnqueued,
+        this,
+        [this]() { m_executorTask.schedule(); },
+        Qt::DirectConnection
+    );
 }
 
 RemoteSinkBaseband::~RemoteSinkBaseband()
 {
+    m_executorTask.stop();
     delete m_channelizer;
 }
 
@@ -54,6 +63,19 @@ void RemoteSinkBaseband::reset()
     m_sampleFifo.reset();
 }
 
+void RemoteSinkBaseband::startWork(int affinityGroup)
+{
+    m_executorTask.setAffinityGroup(affinityGroup);
+    m_executorTask.start();
+    m_running = true;
+}
+
+void RemoteSinkBaseband::stopWork()
+{
+    m_executorTask.stop(); // waits for a run in progress so must not hold m_mutex
+    m_running = false;
+}
+
 void RemoteSinkBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
     m_sampleFifo.write(begin, end);
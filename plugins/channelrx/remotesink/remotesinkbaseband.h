@@ -22,6 +22,7 @@
 #include <QMutex>
 
 #include "dsp/samplesinkfifo.h"
+#include "dsp/basebandexecutor.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
@@ -36,6 +37,7 @@ class RemoteSinkBaseband : public QObject
 public:
     class MsgConfigureRemoteSinkBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureRemoteSinkBaseband)
 
     public:
         const RemoteSinkSettings& getSettings() const { return m_settings; }
@@ -64,10 +66,17 @@ public:
 	void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
     void startSender() { m_sink.startSender(); }
     void stopSender() { m_sink.stopSender(); }
+    void getCodecStats(int& encoding, float& compressionRatio, float& codecTimeUs) {
+        m_sink.getCodecStats(encoding, compressionRatio, codecTimeUs);
+    }
 
     MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
     int getChannelSampleRate() const;
     void setBasebandSampleRate(int sampleRate);
+    void startWork(int affinityGroup);
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    const BasebandExecutor::Task *getExecutorTask() const { return &m_executorTask; }
 
 private:
     SampleSinkFifo m_sampleFifo;
@@ -77,6 +86,8 @@ private:
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     RemoteSinkSettings m_settings;
     QMutex m_mutex;
+    bool m_running;
+    BasebandExecutor::Task m_executorTask; //!< runs the processing on the shared executor
 
     bool handleMessage(const Message& cmd);
     void applySettings(const RemoteSinkSettings& settings, bool force = false);
@@ -170,6 +170,9 @@ void RemoteSinkGUI::displaySettings()
     ui->nominalNbBlocksText->setText(tr("%1/%2").arg(s).arg(s1));
     ui->txDelayText->setText(tr("%1%").arg(m_settings.m_txDelay));
     ui->txDelay->setValue(m_settings.m_txDelay);
+    ui->transportPacking->setCurrentIndex(m_settings.m_transportPacking);
+    ui->transportLZ4->setChecked(m_settings.m_transportLZ4);
+    ui->transportLZ4->setEnabled(m_settings.m_transportPacking != 0);
     updateTxDelayTime();
     applyDecimation();
     displayStreamIndex();
@@ -342,6 +345,19 @@ void RemoteSinkGUI::on_nbFECBlocks_valueChanged(int value)
     applySettings();
 }
 
+void RemoteSinkGUI::on_transportPacking_currentIndexChanged(int index)
+{
+    m_settings.m_transportPacking = index < 0 ? 0 : index > 2 ? 2 : index;
+    ui->transportLZ4->setEnabled(m_settings.m_transportPacking != 0); // LZ4 applies to packed samples only
+    applySettings();
+}
+
+void RemoteSinkGUI::on_transportLZ4_toggled(bool checked)
+{
+    m_settings.m_transportLZ4 = checked;
+    applySettings();
+}
+
 void RemoteSinkGUI::updateTxDelayTime()
 {
     double txDelayRatio = m_settings.m_txDelay / 100.0;
@@ -90,6 +90,8 @@ private slots:
     void on_dataApplyButton_clicked(bool checked);
     void on_nbFECBlocks_valueChanged(int value);
     void on_txDelay_valueChanged(int value);
+    void on_transportPacking_currentIndexChanged(int index);
+    void on_transportLZ4_toggled(bool checked);
     void onWidgetRolled(QWidget* widget, bool rollDown);
     void onMenuDialogCalled(const QPoint& p);
     void tick();
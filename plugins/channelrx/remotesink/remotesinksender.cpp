@@ -30,12 +30,14 @@
 #include "cm256cc/cm256.h"
 
 #include "channel/remotedatablock.h"
+#include "channel/remotedatacodec.h"
 #include "remotesinksender.h"
 
 RemoteSinkSender::RemoteSinkSender() :
     m_fifo(20, this),
     m_address(QHostAddress::LocalHost),
-    m_socket(nullptr)
+    m_socket(nullptr),
+    m_encoding(RemoteDataCodec::EncodingRaw)
 {
     qDebug("RemoteSinkSender::RemoteSinkSender");
     m_cm256p = m_cm256.isInitialized() ? &m_cm256 : nullptr;
@@ -61,6 +63,14 @@ RemoteDataBlock *RemoteSinkSender::getDataBlock()
     return m_fifo.getDataBlock();
 }
 
+void RemoteSinkSender::getCodecStats(int& encoding, float& compressionRatio, float& codecTimeUs)
+{
+    QMutexLocker mutexLocker(&m_codecStatsMutex);
+    encoding = m_encoding;
+    compressionRatio = m_compressionRatio.instantAverage();
+    codecTimeUs = m_codecTimeUs.instantAverage();
+}
+
 void RemoteSinkSender::handleData()
 {
     RemoteDataBlock *dataBlock;
@@ -87,7 +97,22 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
     int txDelay = dataBlock->m_txControlBlock.m_txDelay;
     m_address.setAddress(dataBlock->m_txControlBlock.m_dataAddress);
     uint16_t dataPort = dataBlock->m_txControlBlock.m_dataPort;
+    int encoding = dataBlock->m_txControlBlock.m_encoding;
     RemoteSuperBlock *txBlockx = dataBlock->m_superBlocks;
+    // encoded frames are sent in datagrams cut to the largest encoded block of the frame
+    int blockBytes;
+
+    if (encoding == RemoteDataCodec::EncodingRaw)
+    {
+        blockBytes = sizeof(RemoteProtectedBlock);
+        updateCodecStats(encoding, 1.0f, 0.0f);
+    }
+    else
+    {
+        blockBytes = encodeDataBlock(dataBlock, encoding);
+    }
+
+    qint64 udpSize = sizeof(RemoteHeader) + blockBytes;
 
     if ((nbBlocksFEC == 0) || !m_cm256p) // Do not FEC encode
     {
@@ -96,14 +121,14 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
             for (int i = 0; i < RemoteNbOrginalBlocks; i++)
             {
                 // send block via UDP
-                m_socket->writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
+                m_socket->writeDatagram((const char*)&txBlockx[i], udpSize, m_address, dataPort);
                 std::this_thread::sleep_for(std::chrono::microseconds(txDelay));
             }
         }
     }
     else
     {
-        cm256Params.BlockBytes = sizeof(RemoteProtectedBlock);
+        cm256Params.BlockBytes = blockBytes;
         cm256Params.OriginalCount = RemoteNbOrginalBlocks;
         cm256Params.RecoveryCount = nbBlocksFEC;
 
@@ -118,6 +143,7 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
             txBlockx[i].m_header.m_blockIndex = i;
             txBlockx[i].m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
             txBlockx[i].m_header.m_sampleBits = SDR_RX_SAMP_SZ;
+            txBlockx[i].m_header.m_encoding = encoding;
             descriptorBlocks[i].Block = (void *) &(txBlockx[i].m_protectedBlock);
             descriptorBlocks[i].Index = txBlockx[i].m_header.m_blockIndex;
         }
@@ -129,10 +155,12 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
             // TODO: send without FEC changing meta data to set indication of no FEC
         }
 
-        // Merge FEC with data to transmit
+        // Merge FEC with data to transmit. Recovery blocks are output end to end.
         for (int i = 0; i < cm256Params.RecoveryCount; i++)
         {
-            txBlockx[i + cm256Params.OriginalCount].m_protectedBlock = fecBlocks[i];
+            memcpy((void *) &txBlockx[i + cm256Params.OriginalCount].m_protectedBlock,
+                (const void *) (((const uint8_t *) fecBlocks) + i*blockBytes),
+                blockBytes);
         }
 
         // Transmit all blocks
@@ -141,7 +169,7 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
             for (int i = 0; i < cm256Params.OriginalCount + cm256Params.RecoveryCount; i++)
             {
                 // send block via UDP
-                m_socket->writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
+                m_socket->writeDatagram((const char*)&txBlockx[i], udpSize, m_address, dataPort);
                 std::this_thread::sleep_for(std::chrono::microseconds(txDelay));
             }
         }
@@ -149,3 +177,48 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
 
     dataBlock->m_txControlBlock.m_processed = true;
 }
+
+int RemoteSinkSender::encodeDataBlock(RemoteDataBlock *dataBlock, int encoding)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    RemoteSuperBlock *txBlockx = dataBlock->m_superBlocks;
+    int sampleBytes = txBlockx[0].m_header.m_sampleBytes;
+    int blockBytes = sizeof(RemoteMetaDataFEC); // block zero is sent as is
+
+    for (int i = 1; i < RemoteNbOrginalBlocks; i++)
+    {
+        int encodedBytes = RemoteDataCodec::encodeBlock(
+            txBlockx[i].m_protectedBlock.buf,
+            m_encodedBlock.buf,
+            sampleBytes,
+            encoding
+        );
+        txBlockx[i].m_protectedBlock = m_encodedBlock;
+        txBlockx[i].m_header.m_encoding = encoding;
+        blockBytes = encodedBytes > blockBytes ? encodedBytes : blockBytes;
+    }
+
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    updateCodecStats(
+        encoding,
+        (float) sizeof(RemoteProtectedBlock) / blockBytes,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / 1000.0f
+    );
+
+    return blockBytes;
+}
+
+void RemoteSinkSender::updateCodecStats(int encoding, float compressionRatio, float codecTimeUs)
+{
+    QMutexLocker mutexLocker(&m_codecStatsMutex);
+
+    if (encoding != m_encoding)
+    {
+        m_encoding = encoding;
+        m_compressionRatio.reset();
+        m_codecTimeUs.reset();
+    }
+
+    m_compressionRatio(compressionRatio);
+    m_codecTimeUs(codecTimeUs);
+}
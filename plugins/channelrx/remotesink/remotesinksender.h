@@ -33,6 +33,8 @@
 
 #include "util/message.h"
 #include "util/messagequeue.h"
+#include "util/movingaverage.h"
+#include "channel/remotedatablock.h"
 
 #include "remotesinkfifo.h"
 
@@ -48,6 +50,7 @@ public:
     ~RemoteSinkSender();
 
     RemoteDataBlock *getDataBlock();
+    void getCodecStats(int& encoding, float& compressionRatio, float& codecTimeUs);
 
 private:
     RemoteSinkFifo m_fifo;
@@ -57,7 +60,15 @@ private:
     QHostAddress m_address;
     QUdpSocket *m_socket;
 
+    RemoteProtectedBlock m_encodedBlock;
+    QMutex m_codecStatsMutex;
+    int m_encoding;                                          //!< encoding of the last frame sent
+    MovingAverageUtil<float, double, 16> m_compressionRatio; //!< raw to sent bytes ratio of original blocks
+    MovingAverageUtil<float, double, 16> m_codecTimeUs;      //!< encoding time per frame
+
     void sendDataBlock(RemoteDataBlock *dataBlock);
+    int encodeDataBlock(RemoteDataBlock *dataBlock, int encoding);
+    void updateCodecStats(int encoding, float compressionRatio, float codecTimeUs);
 
 private slots:
     void handleData();
@@ -46,6 +46,8 @@ void RemoteSinkSettings::resetToDefaults()
     m_filterChainHash = 0;
     m_channelMarker = nullptr;
     m_streamIndex = 0;
+    m_transportPacking = 0;
+    m_transportLZ4 = false;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -70,6 +72,8 @@ QByteArray RemoteSinkSettings::serialize() const
     s.writeU32(12, m_log2Decim);
     s.writeU32(13, m_filterChainHash);
     s.writeS32(14, m_streamIndex);
+    s.writeS32(15, m_transportPacking);
+    s.writeBool(16, m_transportLZ4);
 
     return s.final();
 }
@@ -87,6 +91,7 @@ bool RemoteSinkSettings::deserialize(const QByteArray& data)
     if(d.getVersion() == 1)
     {
         uint32_t tmp;
+        int tmpInt;
         QString strtmp;
 
         d.readU32(1, &tmp, 0);
@@ -127,6 +132,9 @@ bool RemoteSinkSettings::deserialize(const QByteArray& data)
         m_log2Decim = tmp > 6 ? 6 : tmp;
         d.readU32(13, &m_filterChainHash, 0);
         d.readS32(14, &m_streamIndex, 0);
+        d.readS32(15, &tmpInt, 0);
+        m_transportPacking = tmpInt < 0 ? 0 : tmpInt > 2 ? 2 : tmpInt;
+        d.readBool(16, &m_transportLZ4, false);
 
         return true;
     }
@@ -40,6 +40,8 @@ struct RemoteSinkSettings
     uint32_t m_log2Decim;
     uint32_t m_filterChainHash;
     int m_streamIndex; //!< MIMO channel. Not relevant when connected to SI (single Rx).
+    int m_transportPacking; //!< sample packing for transport (RemoteDataCodec::Encoding packing values)
+    bool m_transportLZ4;    //!< LZ4 compression of the packed samples
     bool m_useReverseAPI;
     QString m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
@@ -23,6 +23,7 @@
 
 #include "dsp/hbfilterchainconverter.h"
 #include "util/timeutil.h"
+#include "channel/remotedatacodec.h"
 
 #include "remotesinksender.h"
 #include "remotesinksink.h"
@@ -32,6 +33,8 @@ RemoteSinkSink::RemoteSinkSink() :
         m_frameCount(0),
         m_sampleIndex(0),
         m_dataBlock(nullptr),
+        m_encoding(RemoteDataCodec::EncodingRaw),
+        m_frameEncoding(RemoteDataCodec::EncodingRaw),
         m_deviceCenterFrequency(0),
         m_frequencyOffset(0),
         m_basebandSampleRate(48000),
@@ -84,6 +87,11 @@ void RemoteSinkSink::setTxDelay(int txDelay, int nbBlocksFEC, int log2Decim)
         << "sampleRate: " << sampleRate << "S/s";
 }
 
+void RemoteSinkSink::getCodecStats(int& encoding, float& compressionRatio, float& codecTimeUs)
+{
+    m_remoteSinkSender->getCodecStats(encoding, compressionRatio, codecTimeUs);
+}
+
 void RemoteSinkSink::setNbBlocksFEC(int nbBlocksFEC)
 {
     qDebug() << "RemoteSinkSink::setNbBlocksFEC: nbBlocksFEC: " << nbBlocksFEC;
@@ -105,10 +113,11 @@ void RemoteSinkSink::feed(const SampleVector::const_iterator& begin, const Sampl
             RemoteMetaDataFEC metaData;
             uint64_t nowus = TimeUtil::nowus();
             // gettimeofday(&tv, 0);
+            m_frameEncoding = m_encoding; // encoding cannot change within a frame
 
             metaData.m_centerFrequency = m_deviceCenterFrequency + m_frequencyOffset;
             metaData.m_sampleRate = m_basebandSampleRate / (1<<m_settings.m_log2Decim);
-            metaData.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
+            metaData.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4) | (m_frameEncoding << 4);
             metaData.m_sampleBits = SDR_RX_SAMP_SZ;
             metaData.m_nbOriginalBlocks = RemoteNbOrginalBlocks;
             metaData.m_nbFECBlocks = m_nbBlocksFEC;
@@ -128,6 +137,7 @@ void RemoteSinkSink::feed(const SampleVector::const_iterator& begin, const Sampl
             superBlock.m_header.m_blockIndex = m_txBlockIndex;
             superBlock.m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
             superBlock.m_header.m_sampleBits = SDR_RX_SAMP_SZ;
+            superBlock.m_header.m_encoding = m_frameEncoding;
 
             RemoteMetaDataFEC *destMeta = (RemoteMetaDataFEC *) &superBlock.m_protectedBlock;
             *destMeta = metaData;
@@ -172,6 +182,7 @@ void RemoteSinkSink::feed(const SampleVector::const_iterator& begin, const Sampl
             m_superBlock.m_header.m_blockIndex = m_txBlockIndex;
             m_superBlock.m_header.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
             m_superBlock.m_header.m_sampleBits = SDR_RX_SAMP_SZ;
+            m_superBlock.m_header.m_encoding = m_frameEncoding;
             m_dataBlock->m_superBlocks[m_txBlockIndex] = m_superBlock;
 
             if (m_txBlockIndex == RemoteNbOrginalBlocks - 1) // frame complete
@@ -181,6 +192,7 @@ void RemoteSinkSink::feed(const SampleVector::const_iterator& begin, const Sampl
                 m_dataBlock->m_txControlBlock.m_complete = true;
                 m_dataBlock->m_txControlBlock.m_nbBlocksFEC = m_nbBlocksFEC;
                 m_dataBlock->m_txControlBlock.m_txDelay = m_txDelay;
+                m_dataBlock->m_txControlBlock.m_encoding = m_frameEncoding;
                 m_dataBlock->m_txControlBlock.m_dataAddress = m_dataAddress;
                 m_dataBlock->m_txControlBlock.m_dataPort = m_dataPort;
 
@@ -205,8 +217,20 @@ void RemoteSinkSink::applySettings(const RemoteSinkSettings& settings, bool forc
             << " m_dataAddress: " << settings.m_dataAddress
             << " m_dataPort: " << settings.m_dataPort
             << " m_streamIndex: " << settings.m_streamIndex
+            << " m_transportPacking: " << settings.m_transportPacking
+            << " m_transportLZ4: " << settings.m_transportLZ4
             << " force: " << force;
 
+    if ((m_settings.m_transportPacking != settings.m_transportPacking)
+     || (m_settings.m_transportLZ4 != settings.m_transportLZ4) || force)
+    {
+        m_encoding = RemoteDataCodec::getEncoding(settings.m_transportPacking, settings.m_transportLZ4);
+
+        if (settings.m_transportLZ4 && !(m_encoding & RemoteDataCodec::EncodingLZ4)) {
+            qWarning("RemoteSinkSink::applySettings: LZ4 compression is not available or needs sample packing");
+        }
+    }
+
     if ((m_settings.m_dataAddress != settings.m_dataAddress) || force) {
         m_dataAddress = settings.m_dataAddress;
     }
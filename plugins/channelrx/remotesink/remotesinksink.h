@@ -44,6 +44,7 @@ public:
     void applySettings(const RemoteSinkSettings& settings, bool force = false);
     void applyBasebandSampleRate(uint32_t sampleRate);
     void setDeviceCenterFrequency(uint64_t frequency) { m_deviceCenterFrequency = frequency; }
+    void getCodecStats(int& encoding, float& compressionRatio, float& codecTimeUs);
 
 private:
     RemoteSinkSettings m_settings;
@@ -56,6 +57,8 @@ private:
     RemoteSuperBlock m_superBlock;
     RemoteMetaDataFEC m_currentMetaFEC;
     RemoteDataBlock *m_dataBlock;
+    int m_encoding;                      //!< transport encoding from settings
+    int m_frameEncoding;                 //!< transport encoding of the current frame
 
     uint64_t m_deviceCenterFrequency;
     int64_t m_frequencyOffset;
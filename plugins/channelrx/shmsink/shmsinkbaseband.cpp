@@ -0,0 +1,209 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/downchannelizer.h"
+#include "dsp/dspengine.h"
+#include "dsp/dspcommands.h"
+
+#include "shmsinkbaseband.h"
+
+MESSAGE_CLASS_DEFINITION(ShmSinkBaseband::MsgConfigureShmSinkBaseband, Message)
+MESSAGE_CLASS_DEFINITION(ShmSinkBaseband::MsgConfigureShmSinkWork, Message)
+MESSAGE_CLASS_DEFINITION(ShmSinkBaseband::MsgConfigureShmSinkMeta, Message)
+
+ShmSinkBaseband::ShmSinkBaseband() :
+    m_mutex(QMutex::Recursive)
+{
+    m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(48000));
+    m_channelizer = new DownChannelizer(&m_sink);
+
+    qDebug("ShmSinkBaseband::ShmSinkBaseband");
+    QObject::connect(
+        &m_sampleFifo,
+        &SampleSinkFifo::dataReady,
+        this,
+        &ShmSinkBaseband::handleData,
+        Qt::QueuedConnection
+    );
+
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+}
+
+ShmSinkBaseband::~ShmSinkBaseband()
+{
+    delete m_channelizer;
+}
+
+void ShmSinkBaseband::reset()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_sampleFifo.reset();
+}
+
+void ShmSinkBaseband::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    m_sampleFifo.write(begin, end);
+}
+
+void ShmSinkBaseband::handleData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while ((m_sampleFifo.fill() > 0) && (m_inputMessageQueue.size() == 0))
+    {
+		SampleVector::iterator part1begin;
+		SampleVector::iterator part1end;
+		SampleVector::iterator part2begin;
+		SampleVector::iterator part2end;
+
+        std::size_t count = m_sampleFifo.readBegin(m_sampleFifo.fill(), &part1begin, &part1end, &part2begin, &part2end);
+
+		// first part of FIFO data
+        if (part1begin != part1end) {
+            m_channelizer->feed(part1begin, part1end);
+        }
+
+		// second part of FIFO data (used when block wraps around)
+		if(part2begin != part2end) {
+            m_channelizer->feed(part2begin, part2end);
+        }
+
+		m_sampleFifo.readCommit((unsigned int) count);
+    }
+}
+
+void ShmSinkBaseband::handleInputMessages()
+{
+	Message* message;
+
+	while ((message = m_inputMessageQueue.pop()) != nullptr)
+	{
+		if (handleMessage(*message)) {
+			delete message;
+		}
+	}
+}
+
+bool ShmSinkBaseband::handleMessage(const Message& cmd)
+{
+    if (MsgConfigureShmSinkBaseband::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        MsgConfigureShmSinkBaseband& cfg = (MsgConfigureShmSinkBaseband&) cmd;
+        qDebug() << "ShmSinkBaseband::handleMessage: MsgConfigureShmSinkBaseband";
+
+        applySettings(cfg.getSettings(), cfg.getForce());
+
+        return true;
+    }
+    else if (DSPSignalNotification::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
+        qDebug() << "ShmSinkBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
+        m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
+        m_channelizer->setBasebandSampleRate(notif.getSampleRate(), true); // apply decimation
+
+        // the ring size depends on the channel sample rate. Recreating it drops the consumers so do it only
+        // when the size changes. Sample rate and frequency come with MsgConfigureShmSinkMeta
+        if (m_sink.isRunning() && (m_sink.getCapacity() != ShmSampleRing::roundCapacity(getRingCapacity()))) {
+            restartSink();
+        }
+
+		return true;
+    }
+    else if (MsgConfigureShmSinkWork::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+		MsgConfigureShmSinkWork& conf = (MsgConfigureShmSinkWork&) cmd;
+        qDebug() << "ShmSinkBaseband::handleMessage: MsgConfigureShmSinkWork: " << conf.isWorking();
+
+        if (conf.isWorking()) {
+            m_sink.start(m_settings.m_shmName, getRingCapacity());
+        } else {
+            m_sink.stop();
+        }
+
+		return true;
+    }
+    else if (MsgConfigureShmSinkMeta::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        MsgConfigureShmSinkMeta& notif  = (MsgConfigureShmSinkMeta&) cmd;
+        qDebug() << "ShmSinkBaseband::handleMessage: MsgConfigureShmSinkMeta:"
+            << " sampleRate: " << notif.getSampleRate()
+            << " centerFrequency: " << notif.getCenterFrequency();
+        m_sink.setMeta(notif.getSampleRate(), notif.getCenterFrequency());
+
+        return  true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void ShmSinkBaseband::applySettings(const ShmSinkSettings& settings, bool force)
+{
+    qDebug() << "ShmSinkBaseband::applySettings:"
+        << "m_shmName:" << settings.m_shmName
+        << "m_ringSizeMs:" << settings.m_ringSizeMs
+        << "m_log2Decim:" << settings.m_log2Decim
+        << "m_filterChainHash:" << settings.m_filterChainHash
+        << " force: " << force;
+
+    if ((settings.m_log2Decim != m_settings.m_log2Decim)
+     || (settings.m_filterChainHash != m_settings.m_filterChainHash) || force)
+    {
+        m_channelizer->setDecimation(settings.m_log2Decim, settings.m_filterChainHash);
+    }
+
+    bool restart = (settings.m_shmName != m_settings.m_shmName)
+        || (settings.m_ringSizeMs != m_settings.m_ringSizeMs)
+        || (settings.m_log2Decim != m_settings.m_log2Decim);
+
+    m_settings = settings;
+
+    if (restart || force) {
+        restartSink();
+    }
+}
+
+unsigned int ShmSinkBaseband::getRingCapacity() const
+{
+    return (getChannelSampleRate() / 1000 + 1) * m_settings.m_ringSizeMs;
+}
+
+void ShmSinkBaseband::restartSink()
+{
+    if (m_sink.isRunning()) {
+        m_sink.start(m_settings.m_shmName, getRingCapacity());
+    }
+}
+
+void ShmSinkBaseband::getConsumers(std::vector<ShmSampleRing::ConsumerStatus>& consumers)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_sink.getConsumers(consumers);
+}
+
+int ShmSinkBaseband::getChannelSampleRate() const
+{
+    return m_channelizer->getChannelSampleRate();
+}
@@ -0,0 +1,346 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QLocale>
+
+#include "device/deviceuiset.h"
+#include "gui/basicchannelsettingsdialog.h"
+#include "gui/devicestreamselectiondialog.h"
+#include "dsp/hbfilterchainconverter.h"
+#include "mainwindow.h"
+
+#include "shmsinkgui.h"
+#include "shmsink.h"
+#include "ui_shmsinkgui.h"
+
+ShmSinkGUI* ShmSinkGUI::create(PluginAPI* pluginAPI, DeviceUISet *deviceUISet, BasebandSampleSink *channelRx)
+{
+    ShmSinkGUI* gui = new ShmSinkGUI(pluginAPI, deviceUISet, channelRx);
+    return gui;
+}
+
+void ShmSinkGUI::destroy()
+{
+    delete this;
+}
+
+void ShmSinkGUI::resetToDefaults()
+{
+    m_settings.resetToDefaults();
+    displaySettings();
+    applySettings(true);
+}
+
+QByteArray ShmSinkGUI::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool ShmSinkGUI::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        displaySettings();
+        applySettings(true);
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+bool ShmSinkGUI::handleMessage(const Message& message)
+{
+    if (ShmSink::MsgBasebandSampleRateNotification::match(message))
+    {
+        ShmSink::MsgBasebandSampleRateNotification& notif = (ShmSink::MsgBasebandSampleRateNotification&) message;
+        //m_channelMarker.setBandwidth(notif.getSampleRate());
+        m_basebandSampleRate = notif.getSampleRate();
+        displayRateAndShift();
+        return true;
+    }
+    else if (ShmSink::MsgConfigureShmSink::match(message))
+    {
+        const ShmSink::MsgConfigureShmSink& cfg = (ShmSink::MsgConfigureShmSink&) message;
+        m_settings = cfg.getSettings();
+        blockApplySettings(true);
+        displaySettings();
+        blockApplySettings(false);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+ShmSinkGUI::ShmSinkGUI(PluginAPI* pluginAPI, DeviceUISet *deviceUISet, BasebandSampleSink *channelrx, QWidget* parent) :
+        ChannelGUI(parent),
+        ui(new Ui::ShmSinkGUI),
+        m_pluginAPI(pluginAPI),
+        m_deviceUISet(deviceUISet),
+        m_basebandSampleRate(0),
+        m_tickCount(0)
+{
+    ui->setupUi(this);
+    setAttribute(Qt::WA_DeleteOnClose, true);
+    connect(this, SIGNAL(widgetRolled(QWidget*,bool)), this, SLOT(onWidgetRolled(QWidget*,bool)));
+    connect(this, SIGNAL(customContextMenuRequested(const QPoint &)), this, SLOT(onMenuDialogCalled(const QPoint &)));
+
+    m_shmSink = (ShmSink*) channelrx;
+    m_shmSink->setMessageQueueToGUI(getInputMessageQueue());
+
+    m_channelMarker.blockSignals(true);
+    m_channelMarker.setColor(m_settings.m_rgbColor);
+    m_channelMarker.setCenterFrequency(0);
+    m_channelMarker.setTitle("Shared Memory Sink");
+    m_channelMarker.blockSignals(false);
+    m_channelMarker.setVisible(true); // activate signal on the last setting only
+
+    m_settings.setChannelMarker(&m_channelMarker);
+
+    m_deviceUISet->addChannelMarker(&m_channelMarker);
+    m_deviceUISet->addRollupWidget(this);
+
+    connect(getInputMessageQueue(), SIGNAL(messageEnqueued()), this, SLOT(handleSourceMessages()));
+    connect(&MainWindow::getInstance()->getMasterTimer(), SIGNAL(timeout()), this, SLOT(tick())); // 50 ms
+
+    displaySettings();
+    applySettings(true);
+}
+
+ShmSinkGUI::~ShmSinkGUI()
+{
+    delete ui;
+}
+
+void ShmSinkGUI::blockApplySettings(bool block)
+{
+    m_doApplySettings = !block;
+}
+
+void ShmSinkGUI::applySettings(bool force)
+{
+    if (m_doApplySettings)
+    {
+        setTitleColor(m_channelMarker.getColor());
+
+        ShmSink::MsgConfigureShmSink* message = ShmSink::MsgConfigureShmSink::create(m_settings, force);
+        m_shmSink->getInputMessageQueue()->push(message);
+    }
+}
+
+void ShmSinkGUI::displaySettings()
+{
+    m_channelMarker.blockSignals(true);
+    m_channelMarker.setCenterFrequency(0);
+    m_channelMarker.setTitle(m_settings.m_title);
+    m_channelMarker.setBandwidth(m_basebandSampleRate / (1<<m_settings.m_log2Decim));
+    m_channelMarker.setMovable(false); // do not let user move the center arbitrarily
+    m_channelMarker.blockSignals(false);
+    m_channelMarker.setColor(m_settings.m_rgbColor); // activate signal on the last setting only
+
+    setTitleColor(m_settings.m_rgbColor);
+    setWindowTitle(m_channelMarker.getTitle());
+
+    blockApplySettings(true);
+    ui->shmName->setText(m_settings.m_shmName);
+    ui->ringSizeMs->setValue(m_settings.m_ringSizeMs);
+    ui->shmPlay->setChecked(m_settings.m_play);
+    ui->decimationFactor->setCurrentIndex(m_settings.m_log2Decim);
+    applyDecimation();
+    displayStreamIndex();
+
+    blockApplySettings(false);
+}
+
+void ShmSinkGUI::displayStreamIndex()
+{
+    if (m_deviceUISet->m_deviceMIMOEngine) {
+        setStreamIndicator(tr("%1").arg(m_settings.m_streamIndex));
+    } else {
+        setStreamIndicator("S"); // single channel indicator
+    }
+}
+
+void ShmSinkGUI::displayRateAndShift()
+{
+    int shift = m_shiftFrequencyFactor * m_basebandSampleRate;
+    double channelSampleRate = ((double) m_basebandSampleRate) / (1<<m_settings.m_log2Decim);
+    QLocale loc;
+    ui->offsetFrequencyText->setText(tr("%1 Hz").arg(loc.toString(shift)));
+    ui->channelRateText->setText(tr("%1k").arg(QString::number(channelSampleRate / 1000.0, 'g', 5)));
+    m_channelMarker.setCenterFrequency(shift);
+    m_channelMarker.setBandwidth(channelSampleRate);
+}
+
+void ShmSinkGUI::updateConsumers()
+{
+    std::vector<ShmSampleRing::ConsumerStatus> consumers;
+    m_shmSink->getConsumers(consumers);
+    uint64_t maxLag = 0;
+
+    for (const auto& consumer : consumers) {
+        maxLag = std::max(maxLag, consumer.m_lag);
+    }
+
+    uint32_t channelSampleRate = m_shmSink->getChannelSampleRate();
+    int maxLagMs = channelSampleRate == 0 ? 0 : (int) ((maxLag * 1000) / channelSampleRate);
+    ui->consumersText->setText(tr("%1 / %2 ms").arg(consumers.size()).arg(maxLagMs));
+}
+
+void ShmSinkGUI::leaveEvent(QEvent*)
+{
+    m_channelMarker.setHighlighted(false);
+}
+
+void ShmSinkGUI::enterEvent(QEvent*)
+{
+    m_channelMarker.setHighlighted(true);
+}
+
+void ShmSinkGUI::handleSourceMessages()
+{
+    Message* message;
+
+    while ((message = getInputMessageQueue()->pop()) != 0)
+    {
+        if (handleMessage(*message))
+        {
+            delete message;
+        }
+    }
+}
+
+void ShmSinkGUI::onWidgetRolled(QWidget* widget, bool rollDown)
+{
+    (void) widget;
+    (void) rollDown;
+}
+
+void ShmSinkGUI::onMenuDialogCalled(const QPoint &p)
+{
+    if (m_contextMenuType == ContextMenuChannelSettings)
+    {
+        BasicChannelSettingsDialog dialog(&m_channelMarker, this);
+        dialog.setUseReverseAPI(m_settings.m_useReverseAPI);
+        dialog.setReverseAPIAddress(m_settings.m_reverseAPIAddress);
+        dialog.setReverseAPIPort(m_settings.m_reverseAPIPort);
+        dialog.setReverseAPIDeviceIndex(m_settings.m_reverseAPIDeviceIndex);
+        dialog.setReverseAPIChannelIndex(m_settings.m_reverseAPIChannelIndex);
+
+        dialog.move(p);
+        dialog.exec();
+
+        m_settings.m_rgbColor = m_channelMarker.getColor().rgb();
+        m_settings.m_title = m_channelMarker.getTitle();
+        m_settings.m_useReverseAPI = dialog.useReverseAPI();
+        m_settings.m_reverseAPIAddress = dialog.getReverseAPIAddress();
+        m_settings.m_reverseAPIPort = dialog.getReverseAPIPort();
+        m_settings.m_reverseAPIDeviceIndex = dialog.getReverseAPIDeviceIndex();
+        m_settings.m_reverseAPIChannelIndex = dialog.getReverseAPIChannelIndex();
+
+        setWindowTitle(m_settings.m_title);
+        setTitleColor(m_settings.m_rgbColor);
+
+        applySettings();
+    }
+    else if ((m_contextMenuType == ContextMenuStreamSettings) && (m_deviceUISet->m_deviceMIMOEngine))
+    {
+        DeviceStreamSelectionDialog dialog(this);
+        dialog.setNumberOfStreams(m_shmSink->getNumberOfDeviceStreams());
+        dialog.setStreamIndex(m_settings.m_streamIndex);
+        dialog.move(p);
+        dialog.exec();
+
+        m_settings.m_streamIndex = dialog.getSelectedStreamIndex();
+        m_channelMarker.clearStreamIndexes();
+        m_channelMarker.addStreamIndex(m_settings.m_streamIndex);
+        displayStreamIndex();
+        applySettings();
+    }
+
+    resetContextMenuType();
+}
+
+void ShmSinkGUI::on_decimationFactor_currentIndexChanged(int index)
+{
+    m_settings.m_log2Decim = index;
+    applyDecimation();
+}
+
+void ShmSinkGUI::on_position_valueChanged(int value)
+{
+    m_settings.m_filterChainHash = value;
+    applyPosition();
+}
+
+void ShmSinkGUI::on_shmName_editingFinished()
+{
+    m_settings.m_shmName = ui->shmName->text();
+    applySettings();
+}
+
+void ShmSinkGUI::on_ringSizeMs_valueChanged(int value)
+{
+    m_settings.m_ringSizeMs = value;
+    applySettings();
+}
+
+void ShmSinkGUI::on_shmPlay_toggled(bool checked)
+{
+    m_settings.m_play = checked;
+    applySettings();
+}
+
+void ShmSinkGUI::applyDecimation()
+{
+    uint32_t maxHash = 1;
+
+    for (uint32_t i = 0; i < m_settings.m_log2Decim; i++) {
+        maxHash *= 3;
+    }
+
+    ui->position->setMaximum(maxHash-1);
+    ui->position->setValue(m_settings.m_filterChainHash);
+    m_settings.m_filterChainHash = ui->position->value();
+    applyPosition();
+}
+
+void ShmSinkGUI::applyPosition()
+{
+    ui->filterChainIndex->setText(tr("%1").arg(m_settings.m_filterChainHash));
+    QString s;
+    m_shiftFrequencyFactor = HBFilterChainConverter::convertToString(m_settings.m_log2Decim, m_settings.m_filterChainHash, s);
+    ui->filterChainText->setText(s);
+
+    displayRateAndShift();
+    applySettings();
+}
+
+void ShmSinkGUI::tick()
+{
+    if (++m_tickCount == 20) // once per second
+    {
+        updateConsumers();
+        m_tickCount = 0;
+    }
+}
@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "shmsinksink.h"
+
+ShmSinkSink::ShmSinkSink() :
+        m_running(false),
+        m_sampleRate(48000),
+        m_centerFrequency(0)
+{
+}
+
+ShmSinkSink::~ShmSinkSink()
+{
+    stop();
+}
+
+void ShmSinkSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (m_running) {
+        m_ring.write(begin, end);
+    }
+}
+
+void ShmSinkSink::start(const QString& shmName, unsigned int capacity)
+{
+    qDebug() << "ShmSinkSink::start: " << shmName << " capacity: " << capacity;
+
+    if (m_running) {
+        stop();
+    }
+
+    m_ring.setMeta(m_sampleRate, m_centerFrequency);
+    m_running = m_ring.create(shmName, capacity);
+}
+
+void ShmSinkSink::stop()
+{
+    qDebug("ShmSinkSink::stop");
+    m_ring.close();
+    m_running = false;
+}
+
+void ShmSinkSink::setMeta(uint32_t sampleRate, uint64_t centerFrequency)
+{
+    m_sampleRate = sampleRate;
+    m_centerFrequency = centerFrequency;
+    m_ring.setMeta(sampleRate, centerFrequency);
+}
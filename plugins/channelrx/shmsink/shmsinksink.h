@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_SHMSINKSINK_H_
+#define INCLUDE_SHMSINKSINK_H_
+
+#include <vector>
+
+#include <QString>
+
+#include "dsp/channelsamplesink.h"
+#include "dsp/shmsamplering.h"
+
+class ShmSinkSink : public ChannelSampleSink {
+public:
+    ShmSinkSink();
+	~ShmSinkSink();
+
+	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+
+    void start(const QString& shmName, unsigned int capacity);
+    void stop();
+    bool isRunning() const { return m_running; }
+    uint32_t getCapacity() const { return m_ring.getCapacity(); }
+    void setMeta(uint32_t sampleRate, uint64_t centerFrequency);
+    void getConsumers(std::vector<ShmSampleRing::ConsumerStatus>& consumers) const { m_ring.getConsumers(consumers); }
+
+private:
+    ShmSampleRing m_ring;
+    bool m_running;
+    uint32_t m_sampleRate;
+    uint64_t m_centerFrequency;
+};
+
+#endif // INCLUDE_SHMSINKSINK_H_
@@ -150,6 +150,9 @@ void UDPSink::applySettings(const UDPSinkSettings& settings, bool force)
             << " m_fmDeviation: " << settings.m_fmDeviation
             << " m_udpAddressStr: " << settings.m_udpAddress
             << " m_udpPort: " << settings.m_udpPort
+            << " m_udpDestinations: " << settings.m_udpDestinations
+            << " m_multicastTTL: " << settings.m_multicastTTL
+            << " m_rtp: " << settings.m_rtp
             << " m_audioPort: " << settings.m_audioPort
             << " m_streamIndex: " << settings.m_streamIndex
             << " m_useReverseAPI: " << settings.m_useReverseAPI
@@ -206,6 +209,15 @@ void UDPSink::applySettings(const UDPSinkSettings& settings, bool force)
     if ((settings.m_udpPort != m_settings.m_udpPort) || force) {
         reverseAPIKeys.append("udpPort");
     }
+    if ((settings.m_udpDestinations != m_settings.m_udpDestinations) || force) {
+        reverseAPIKeys.append("udpDestinations");
+    }
+    if ((settings.m_multicastTTL != m_settings.m_multicastTTL) || force) {
+        reverseAPIKeys.append("multicastTTL");
+    }
+    if ((settings.m_rtp != m_settings.m_rtp) || force) {
+        reverseAPIKeys.append("rtp");
+    }
     if ((settings.m_audioPort != m_settings.m_audioPort) || force) {
         reverseAPIKeys.append("audioPort");
     }
@@ -350,6 +362,15 @@ void UDPSink::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("udpPort")) {
         settings.m_udpPort = response.getUdpSinkSettings()->getUdpPort();
     }
+    if (channelSettingsKeys.contains("udpDestinations")) {
+        settings.m_udpDestinations = *response.getUdpSinkSettings()->getUdpDestinations();
+    }
+    if (channelSettingsKeys.contains("multicastTTL")) {
+        settings.m_multicastTTL = response.getUdpSinkSettings()->getMulticastTtl();
+    }
+    if (channelSettingsKeys.contains("rtp")) {
+        settings.m_rtp = response.getUdpSinkSettings()->getRtp() != 0;
+    }
     if (channelSettingsKeys.contains("audioPort")) {
         settings.m_audioPort = response.getUdpSinkSettings()->getAudioPort();
     }
@@ -414,6 +435,15 @@ void UDPSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& respo
     }
 
     response.getUdpSinkSettings()->setUdpPort(settings.m_udpPort);
+
+    if (response.getUdpSinkSettings()->getUdpDestinations()) {
+        *response.getUdpSinkSettings()->getUdpDestinations() = settings.m_udpDestinations;
+    } else {
+        response.getUdpSinkSettings()->setUdpDestinations(new QString(settings.m_udpDestinations));
+    }
+
+    response.getUdpSinkSettings()->setMulticastTtl(settings.m_multicastTTL);
+    response.getUdpSinkSettings()->setRtp(settings.m_rtp ? 1 : 0);
     response.getUdpSinkSettings()->setAudioPort(settings.m_audioPort);
     response.getUdpSinkSettings()->setRgbColor(settings.m_rgbColor);
 
@@ -443,6 +473,10 @@ void UDPSink::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
     response.getUdpSinkReport()->setOutputPowerDb(CalcDb::dbPower(getMagSq()));
     response.getUdpSinkReport()->setSquelch(getSquelchOpen() ? 1 : 0);
     response.getUdpSinkReport()->setInputSampleRate(m_channelSampleRate);
+    response.getUdpSinkReport()->setNbDestinations(getNbDestinations());
+    response.getUdpSinkReport()->setDatagramsSent(getDatagramsSent());
+    response.getUdpSinkReport()->setDatagramsDropped(getDatagramsDropped());
+    response.getUdpSinkReport()->setThroughput(getThroughput());
 }
 
 void UDPSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const UDPSinkSettings& settings, bool force)
@@ -505,6 +539,15 @@ void UDPSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, con
     if (channelSettingsKeys.contains("udpPort") || force) {
         swgUDPSinkSettings->setUdpPort(settings.m_udpPort);
     }
+    if (channelSettingsKeys.contains("udpDestinations") || force) {
+        swgUDPSinkSettings->setUdpDestinations(new QString(settings.m_udpDestinations));
+    }
+    if (channelSettingsKeys.contains("multicastTTL") || force) {
+        swgUDPSinkSettings->setMulticastTtl(settings.m_multicastTTL);
+    }
+    if (channelSettingsKeys.contains("rtp") || force) {
+        swgUDPSinkSettings->setRtp(settings.m_rtp ? 1 : 0);
+    }
     if (channelSettingsKeys.contains("audioPort") || force) {
         swgUDPSinkSettings->setAudioPort(settings.m_audioPort);
     }
@@ -39,6 +39,7 @@ class UDPSink : public BasebandSampleSink, public ChannelAPI {
 public:
     class MsgConfigureUDPSink : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureUDPSink)
 
     public:
         const UDPSinkSettings& getSettings() const { return m_settings; }
@@ -71,6 +72,10 @@ public:
 	double getMagSq() const { return m_basebandSink->getMagSq(); }
 	double getInMagSq() const { return m_basebandSink->getInMagSq(); }
 	bool getSquelchOpen() const { return m_basebandSink->getSquelchOpen(); }
+    unsigned int getNbDestinations() const { return m_basebandSink->getNbDestinations(); }
+    uint64_t getDatagramsSent() const { return m_basebandSink->getDatagramsSent(); }
+    uint64_t getDatagramsDropped() const { return m_basebandSink->getDatagramsDropped(); }
+    float getThroughput() const { return m_basebandSink->getThroughput(); } //!< Bytes per second sent to all destinations
 
 	virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
 	virtual void start();
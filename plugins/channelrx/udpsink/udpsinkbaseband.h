@@ -35,6 +35,7 @@ class UDPSinkBaseband : public QObject
 public:
     class MsgConfigureUDPSinkBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureUDPSinkBaseband)
     public:
         const UDPSinkSettings& getSettings() const { return m_settings; }
         bool getForce() const { return m_force; }
@@ -88,6 +89,10 @@ public:
 	double getMagSq() const { return m_sink.getMagSq(); }
 	double getInMagSq() const { return m_sink.getInMagSq(); }
 	bool getSquelchOpen() const { return m_sink.getSquelchOpen(); }
+    unsigned int getNbDestinations() const { return m_sink.getNbDestinations(); }
+    uint64_t getDatagramsSent() const { return m_sink.getDatagramsSent(); }
+    uint64_t getDatagramsDropped() const { return m_sink.getDatagramsDropped(); }
+    float getThroughput() const { return m_sink.getThroughput(); }
 
 private:
     SampleSinkFifo m_sampleFifo;
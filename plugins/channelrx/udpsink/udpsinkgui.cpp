@@ -121,6 +121,11 @@ void UDPSinkGUI::tick()
         m_inPowerAvg.feed(m_udpSink->getInMagSq());
         double inPowDb = CalcDb::dbPower(m_inPowerAvg.average());
         ui->inputPower->setText(QString::number(inPowDb, 'f', 1));
+        ui->udpThroughput->setText(QString::number(m_udpSink->getThroughput() / 1000.0, 'f', 0));
+        ui->udpThroughput->setToolTip(tr("UDP throughput (kB/s) to %1 destination(s)\nSent: %2 datagrams\nDropped: %3 datagrams")
+            .arg(m_udpSink->getNbDestinations())
+            .arg(m_udpSink->getDatagramsSent())
+            .arg(m_udpSink->getDatagramsDropped()));
     }
 
     if (m_udpSink->getSquelchOpen()) {
@@ -239,6 +244,9 @@ void UDPSinkGUI::displaySettings()
     ui->outputUDPAddress->setText(m_settings.m_udpAddress);
     ui->outputUDPPort->setText(tr("%1").arg(m_settings.m_udpPort));
     ui->inputUDPAudioPort->setText(tr("%1").arg(m_settings.m_audioPort));
+    ui->udpDestinations->setText(m_settings.m_udpDestinations);
+    ui->multicastTTL->setValue(m_settings.m_multicastTTL);
+    ui->rtp->setChecked(m_settings.m_rtp);
 
     ui->squelch->setValue(m_settings.m_squelchdB);
     ui->squelchText->setText(tr("%1").arg(ui->squelch->value()*1.0, 0, 'f', 0));
@@ -458,6 +466,25 @@ void UDPSinkGUI::on_inputUDPAudioPort_editingFinished()
     ui->applyBtn->setStyleSheet("QPushButton { background-color : green; }");
 }
 
+void UDPSinkGUI::on_udpDestinations_editingFinished()
+{
+    m_settings.m_udpDestinations = ui->udpDestinations->text();
+    ui->applyBtn->setEnabled(true);
+    ui->applyBtn->setStyleSheet("QPushButton { background-color : green; }");
+}
+
+void UDPSinkGUI::on_multicastTTL_valueChanged(int value)
+{
+    m_settings.m_multicastTTL = value;
+    applySettingsImmediate();
+}
+
+void UDPSinkGUI::on_rtp_toggled(bool checked)
+{
+    m_settings.m_rtp = checked;
+    applySettingsImmediate();
+}
+
 void UDPSinkGUI::on_sampleRate_textEdited(const QString& arg1)
 {
     (void) arg1;
@@ -94,6 +94,9 @@ private slots:
 	void on_outputUDPAddress_editingFinished();
 	void on_outputUDPPort_editingFinished();
 	void on_inputUDPAudioPort_editingFinished();
+	void on_udpDestinations_editingFinished();
+	void on_multicastTTL_valueChanged(int value);
+	void on_rtp_toggled(bool checked);
 	void on_sampleRate_textEdited(const QString& arg1);
 	void on_rfBandwidth_textEdited(const QString& arg1);
 	void on_fmDeviation_textEdited(const QString& arg1);
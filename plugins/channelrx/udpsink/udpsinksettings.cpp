@@ -49,6 +49,9 @@ void UDPSinkSettings::resetToDefaults()
     m_udpAddress = "127.0.0.1";
     m_udpPort = 9998;
     m_audioPort = 9997;
+    m_udpDestinations = "";
+    m_multicastTTL = 1;
+    m_rtp = false;
     m_rgbColor = QColor(225, 25, 99).rgb();
     m_title = "UDP Sample Sink";
     m_useReverseAPI = false;
@@ -93,6 +96,9 @@ QByteArray UDPSinkSettings::serialize() const
     s.writeU32(26, m_reverseAPIDeviceIndex);
     s.writeU32(27, m_reverseAPIChannelIndex);
     s.writeS32(28, m_streamIndex);
+    s.writeString(29, m_udpDestinations);
+    s.writeS32(30, m_multicastTTL);
+    s.writeBool(31, m_rtp);
 
     return s.final();
 
@@ -183,6 +189,10 @@ bool UDPSinkSettings::deserialize(const QByteArray& data)
         d.readU32(27, &u32tmp, 0);
         m_reverseAPIChannelIndex = u32tmp > 99 ? 99 : u32tmp;
         d.readS32(28, &m_streamIndex, 0);
+        d.readString(29, &m_udpDestinations, "");
+        d.readS32(30, &s32tmp, 1);
+        m_multicastTTL = s32tmp < 1 ? 1 : s32tmp > 255 ? 255 : s32tmp;
+        d.readBool(31, &m_rtp, false);
 
         return true;
     }
@@ -60,6 +60,9 @@ struct UDPSinkSettings
     QString m_udpAddress;
     uint16_t m_udpPort;
     uint16_t m_audioPort;
+    QString m_udpDestinations; //!< additional destinations as address:port items separated by commas or spaces
+    int m_multicastTTL;
+    bool m_rtp;                //!< prepend a RTP header to each datagram
 
     QString m_title;
 
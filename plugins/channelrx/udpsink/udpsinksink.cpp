@@ -55,9 +55,10 @@ UDPSinkSink::UDPSinkSink() :
         m_squelchRelease(4800),
         m_agc(9600, m_agcTarget, 1e-6)
 {
-	m_udpBuffer16 = new UDPSinkUtil<Sample16>(this, udpBlockSize, m_settings.m_udpPort);
-	m_udpBufferMono16 = new UDPSinkUtil<int16_t>(this, udpBlockSize, m_settings.m_udpPort);
-    m_udpBuffer24 = new UDPSinkUtil<Sample24>(this, udpBlockSize, m_settings.m_udpPort);
+	m_udpSender = new UDPMultiSender(this, udpBlockSize);
+	m_udpBuffer16 = new UDPSinkUtil<Sample16>(m_udpSender, udpBlockSize);
+	m_udpBufferMono16 = new UDPSinkUtil<int16_t>(m_udpSender, udpBlockSize);
+    m_udpBuffer24 = new UDPSinkUtil<Sample24>(m_udpSender, udpBlockSize);
 	m_audioSocket = new QUdpSocket(this);
 	m_udpAudioBuf = new char[m_udpAudioPayloadSize];
 
@@ -106,6 +107,7 @@ UDPSinkSink::~UDPSinkSink()
 	delete m_udpBuffer24;
     delete m_udpBuffer16;
     delete m_udpBufferMono16;
+    delete m_udpSender;
 	delete[] m_udpAudioBuf;
     delete UDPFilter;
 }
@@ -285,6 +287,8 @@ void UDPSinkSink::feed(const SampleVector::const_iterator& begin, const SampleVe
 		}
 	}
 
+	m_udpSender->flush(); // send datagrams completed in this block
+
 	//qDebug() << "UDPSink::feed: " << m_sampleBuffer.size() * 4;
 
 	if ((m_spectrum != 0) && (m_spectrumEnabled)) {
@@ -395,6 +399,9 @@ void UDPSinkSink::applySettings(const UDPSinkSettings& settings, bool force)
             << " m_fmDeviation: " << settings.m_fmDeviation
             << " m_udpAddressStr: " << settings.m_udpAddress
             << " m_udpPort: " << settings.m_udpPort
+            << " m_udpDestinations: " << settings.m_udpDestinations
+            << " m_multicastTTL: " << settings.m_multicastTTL
+            << " m_rtp: " << settings.m_rtp
             << " m_audioPort: " << settings.m_audioPort
             << " m_streamIndex: " << settings.m_streamIndex
             << " m_useReverseAPI: " << settings.m_useReverseAPI
@@ -470,18 +477,22 @@ void UDPSinkSink::applySettings(const UDPSinkSettings& settings, bool force)
         m_agc.setThreshold(m_squelch*(1<<23));
     }
 
-    if ((settings.m_udpAddress != m_settings.m_udpAddress) || force)
+    if ((settings.m_udpAddress != m_settings.m_udpAddress)
+     || (settings.m_udpPort != m_settings.m_udpPort)
+     || (settings.m_udpDestinations != m_settings.m_udpDestinations) || force)
     {
-        m_udpBuffer16->setAddress(const_cast<QString&>(settings.m_udpAddress));
-        m_udpBufferMono16->setAddress(const_cast<QString&>(settings.m_udpAddress));
-        m_udpBuffer24->setAddress(const_cast<QString&>(settings.m_udpAddress));
+        m_udpSender->flush();
+        m_udpSender->setDestinations(settings.m_udpAddress, settings.m_udpPort, settings.m_udpDestinations);
+    }
+
+    if ((settings.m_multicastTTL != m_settings.m_multicastTTL) || force) {
+        m_udpSender->setMulticastTTL(settings.m_multicastTTL);
     }
 
-    if ((settings.m_udpPort != m_settings.m_udpPort) || force)
+    if ((settings.m_rtp != m_settings.m_rtp) || force)
     {
-        m_udpBuffer16->setPort(settings.m_udpPort);
-        m_udpBufferMono16->setPort(settings.m_udpPort);
-        m_udpBuffer24->setPort(settings.m_udpPort);
+        m_udpSender->flush();
+        m_udpSender->setRTP(settings.m_rtp);
     }
 
     if ((settings.m_audioPort != m_settings.m_audioPort) || force)
@@ -54,6 +54,10 @@ public:
 	double getMagSq() const { return m_magsq; }
 	double getInMagSq() const { return m_inMagsq; }
 	bool getSquelchOpen() const { return m_squelchOpen; }
+    unsigned int getNbDestinations() const { return m_udpSender->getNbDestinations(); }
+    uint64_t getDatagramsSent() const { return m_udpSender->getDatagramsSent(); }
+    uint64_t getDatagramsDropped() const { return m_udpSender->getDatagramsDropped(); }
+    float getThroughput() const { return m_udpSender->getThroughput(); }
 
 	static const int udpBlockSize = 512; // UDP block size in number of bytes
 
@@ -98,6 +102,7 @@ private:
 	fftfilt* UDPFilter;
 
 	SampleVector m_sampleBuffer;
+	UDPMultiSender *m_udpSender; //!< Sends datagrams of all sample buffers to all destinations
 	UDPSinkUtil<Sample16> *m_udpBuffer16;
 	UDPSinkUtil<int16_t> *m_udpBufferMono16;
     UDPSinkUtil<Sample24> *m_udpBuffer24;
@@ -47,6 +47,7 @@ class FileSource : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureFileSource : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFileSource)
 
     public:
         const FileSourceSettings& getSettings() const { return m_settings; }
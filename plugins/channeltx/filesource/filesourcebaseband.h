@@ -35,6 +35,7 @@ class FileSourceBaseband : public QObject
 public:
     class MsgConfigureFileSourceBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFileSourceBaseband)
 
     public:
         const FileSourceSettings& getSettings() const { return m_settings; }
@@ -39,6 +39,7 @@ class LocalSource : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureLocalSource : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLocalSource)
 
     public:
         const LocalSourceSettings& getSettings() const { return m_settings; }
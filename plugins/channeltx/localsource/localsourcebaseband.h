@@ -36,6 +36,7 @@ class LocalSourceBaseband : public QObject
 public:
     class MsgConfigureLocalSourceBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLocalSourceBaseband)
 
     public:
         const LocalSourceSettings& getSettings() const { return m_settings; }
@@ -45,6 +45,7 @@ class IEEE_802_15_4_Mod : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureIEEE_802_15_4_Mod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureIEEE_802_15_4_Mod)
 
     public:
         const IEEE_802_15_4_ModSettings& getSettings() const { return m_settings; }
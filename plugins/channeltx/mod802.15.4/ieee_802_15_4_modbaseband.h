@@ -36,6 +36,7 @@ class IEEE_802_15_4_ModBaseband : public QObject
 public:
     class MsgConfigureIEEE_802_15_4_ModBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureIEEE_802_15_4_ModBaseband)
 
     public:
         const IEEE_802_15_4_ModSettings& getSettings() const { return m_settings; }
@@ -44,6 +44,7 @@ class AMMod : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureAMMod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureAMMod)
 
     public:
         const AMModSettings& getSettings() const { return m_settings; }
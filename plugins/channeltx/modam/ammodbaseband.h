@@ -35,6 +35,7 @@ class AMModBaseband : public QObject
 public:
     class MsgConfigureAMModBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureAMModBaseband)
 
     public:
         const AMModSettings& getSettings() const { return m_settings; }
@@ -578,6 +578,8 @@ void ATVMod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
 {
     response.getAtvModReport()->setChannelPowerDb(CalcDb::dbPower(getMagSq()));
     response.getAtvModReport()->setChannelSampleRate(m_basebandSource->getChannelSampleRate());
+    response.getAtvModReport()->setDroppedFrames(getDroppedFrames());
+    response.getAtvModReport()->setRepeatedFrames(getRepeatedFrames());
 }
 
 void ATVMod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const ATVModSettings& settings, bool force)
@@ -715,6 +717,16 @@ int ATVMod::getEffectiveSampleRate() const
     return m_basebandSource->getEffectiveSampleRate();
 }
 
+uint32_t ATVMod::getDroppedFrames() const
+{
+    return m_basebandSource->getDroppedFrames();
+}
+
+uint32_t ATVMod::getRepeatedFrames() const
+{
+    return m_basebandSource->getRepeatedFrames();
+}
+
 void ATVMod::getCameraNumbers(std::vector<int>& numbers)
 {
     m_basebandSource->getCameraNumbers(numbers);
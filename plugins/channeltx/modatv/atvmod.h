@@ -43,6 +43,7 @@ class ATVMod : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureATVMod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureATVMod)
 
     public:
         const ATVModSettings& getSettings() const { return m_settings; }
@@ -299,6 +300,8 @@ public:
     double getMagSq() const;
     void setLevelMeter(QObject *levelMeter);
     int getEffectiveSampleRate() const;
+    uint32_t getDroppedFrames() const;
+    uint32_t getRepeatedFrames() const;
     void getCameraNumbers(std::vector<int>& numbers);
     void propagateMessageQueueToGUI();
 
@@ -35,6 +35,7 @@ class ATVModBaseband : public QObject
 public:
     class MsgConfigureATVModBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureATVModBaseband)
 
     public:
         const ATVModSettings& getSettings() const { return m_settings; }
@@ -221,6 +222,8 @@ public:
     void getCameraNumbers(std::vector<int>& numbers);
 
     int getEffectiveSampleRate() const { return m_source.getEffectiveSampleRate(); }
+    uint32_t getDroppedFrames() const { return m_source.getDroppedFrames(); }
+    uint32_t getRepeatedFrames() const { return m_source.getRepeatedFrames(); }
 
 signals:
 	/**
@@ -0,0 +1,661 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <time.h>
+
+#include <QDebug>
+#include <QMutexLocker>
+
+#include "opencv2/imgproc/imgproc.hpp"
+
+#include "util/messagequeue.h"
+
+#include "atvmodreport.h"
+#include "atvmodframequeue.h"
+#include "atvmodframeproducer.h"
+
+const int ATVModFrameProducer::m_cameraFPSTestNbFrames = 100;
+const unsigned long ATVModFrameProducer::m_idleWaitMs = 10;
+
+ATVModFrameProducer::ATVModFrameProducer(ATVModFrameQueue *frameQueue, float blackLevel, float spanLevel, QObject* parent) :
+    QThread(parent),
+    m_frameQueue(frameQueue),
+    m_blackLevel(blackLevel),
+    m_spanLevel(spanLevel),
+    m_running(false),
+    m_streaming(false),
+    m_droppedFrames(0),
+    m_atvModInput(ATVModSettings::ATVModInputHBars),
+    m_videoPlay(false),
+    m_videoPlayLoop(false),
+    m_cameraPlay(false),
+    m_showOverlayText(false),
+    m_uniformLevel(0.5f),
+    m_nbImageLines(0),
+    m_pointsPerImgLine(0),
+    m_fps(25.0f),
+    m_refreshFrame(false),
+    m_videoFPS(25.0f),
+    m_videoWidth(1),
+    m_videoHeight(1),
+    m_videoFPSq(1.0f),
+    m_videoFPSCount(0.0f),
+    m_videoPrevFPSCount(0),
+    m_videoLength(0),
+    m_videoEOF(false),
+    m_videoOK(false),
+    m_cameraIndex(-1),
+    m_messageQueueToGUI(nullptr)
+{
+    scanCameras();
+}
+
+ATVModFrameProducer::~ATVModFrameProducer()
+{
+    stopWork();
+
+    if (m_video.isOpened()) {
+        m_video.release();
+    }
+
+    releaseCameras();
+}
+
+void ATVModFrameProducer::startWork()
+{
+    m_startWaitMutex.lock();
+    start();
+
+    while (!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void ATVModFrameProducer::stopWork()
+{
+    m_running = false;
+    m_wakeUp.wakeAll();
+    wait();
+}
+
+void ATVModFrameProducer::run()
+{
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    while (m_running)
+    {
+        // lock each frame separately so that control from the modulator thread can get in
+        m_mutex.lock();
+
+        if (!produceFrame() && m_running) {
+            m_wakeUp.wait(&m_mutex, m_idleWaitMs);
+        }
+
+        m_mutex.unlock();
+    }
+}
+
+bool ATVModFrameProducer::produceFrame()
+{
+    if (m_atvModInput == ATVModSettings::ATVModInputVideo)
+    {
+        if (m_videoOK && m_videoPlay && !m_videoEOF) {
+            return produceVideoFrame();
+        }
+
+        if (m_refreshFrame && (m_videoFrame.empty() || publishFrame(m_videoFrame))) {
+            m_refreshFrame = false;
+        }
+    }
+    else if ((m_atvModInput == ATVModSettings::ATVModInputCamera) && (m_cameraIndex >= 0))
+    {
+        if (m_cameraPlay) {
+            return produceCameraFrame();
+        }
+
+        const cv::Mat& cameraFrame = m_cameras[m_cameraIndex].m_videoFrame;
+
+        if (m_refreshFrame && (cameraFrame.empty() || publishFrame(cameraFrame))) {
+            m_refreshFrame = false;
+        }
+    }
+
+    return false;
+}
+
+bool ATVModFrameProducer::produceVideoFrame()
+{
+    if (!m_frameQueue->getWriteFrame()) { // queue full
+        return false;
+    }
+
+    int fpsIncrement = (int) m_videoFPSCount - m_videoPrevFPSCount;
+    bool grabOK = true;
+
+    // move a number of frames according to increment (none when the TV frame repeats the video frame)
+    // use grab to test for EOF then retrieve to preserve last valid frame as the current original frame
+    for (int i = 0; i < fpsIncrement; i++)
+    {
+        grabOK = m_video.grab();
+        if (!grabOK) break;
+    }
+
+    if (!grabOK)
+    {
+        if (m_videoPlayLoop) { // play loop
+            seekVideo(0);
+        } else { // stops
+            m_videoEOF = true;
+            updateStreaming();
+        }
+
+        return true;
+    }
+
+    if (fpsIncrement > 0)
+    {
+        cv::Mat colorFrame;
+        m_video.retrieve(colorFrame);
+
+        if (!colorFrame.empty()) // some frames may not come out properly
+        {
+            if (m_showOverlayText) {
+                mixImageAndText(colorFrame, m_overlayText, m_uniformLevel);
+            }
+
+            cv::cvtColor(colorFrame, m_videoframeOriginal, cv::COLOR_RGB2GRAY);
+            resizeVideo();
+        }
+        else
+        {
+            m_droppedFrames++; // previous frame is sent again
+        }
+    }
+
+    if (m_videoFPSCount < m_videoFPS)
+    {
+        m_videoPrevFPSCount = (int) m_videoFPSCount;
+        m_videoFPSCount += m_videoFPSq;
+    }
+    else
+    {
+        m_videoPrevFPSCount = 0;
+        m_videoFPSCount = m_videoFPSq;
+    }
+
+    publishFrame(m_videoFrame);
+    m_refreshFrame = false;
+    return true;
+}
+
+bool ATVModFrameProducer::produceCameraFrame()
+{
+    if (m_frameQueue->size() > 1) { // live source: current frame and next one only
+        return false;
+    }
+
+    ATVCamera& camera = m_cameras[m_cameraIndex];
+
+    if (camera.m_videoFPS < 0.0f) // default frame rate when it could not be obtained via get
+    {
+        measureCameraFPS(camera);
+    }
+    else if (camera.m_videoFPS == 0.0f) // Hideous hack for windows
+    {
+        camera.m_videoFPS = 5.0f;
+        camera.m_videoFPSq = camera.m_videoFPS / m_fps;
+        camera.m_videoFPSCount = camera.m_videoFPSq;
+        camera.m_videoPrevFPSCount = 0;
+
+        if (getMessageQueueToGUI())
+        {
+            ATVModReport::MsgReportCameraData *report;
+            report = ATVModReport::MsgReportCameraData::create(
+                    camera.m_cameraNumber,
+                    camera.m_videoFPS,
+                    camera.m_videoFPSManual,
+                    camera.m_videoFPSManualEnable,
+                    camera.m_videoWidth,
+                    camera.m_videoHeight,
+                    0);
+            getMessageQueueToGUI()->push(report);
+        }
+    }
+
+    int fpsIncrement = (int) camera.m_videoFPSCount - camera.m_videoPrevFPSCount;
+
+    // move a number of frames according to increment
+    // use grab to test for EOF then retrieve to preserve last valid frame as the current original frame
+    cv::Mat colorFrame;
+    int grabOK = 0;
+
+    for (int i = 0; i < fpsIncrement; i++)
+    {
+        grabOK = camera.m_camera.grab();
+        if (!grabOK) break;
+    }
+
+    if (grabOK) {
+        camera.m_camera.retrieve(colorFrame);
+    }
+
+    if (!colorFrame.empty()) // some frames may not come out properly
+    {
+        if (m_showOverlayText) {
+            mixImageAndText(colorFrame, m_overlayText, m_uniformLevel);
+        }
+
+        cv::cvtColor(colorFrame, camera.m_videoframeOriginal, cv::COLOR_RGB2GRAY);
+        resizeCamera();
+    }
+    else if (fpsIncrement > 0)
+    {
+        m_droppedFrames++; // previous frame is sent again
+    }
+
+    if (camera.m_videoFPSCount < (camera.m_videoFPSManualEnable ? camera.m_videoFPSManual : camera.m_videoFPS))
+    {
+        camera.m_videoPrevFPSCount = (int) camera.m_videoFPSCount;
+        camera.m_videoFPSCount += (camera.m_videoFPSManualEnable ? camera.m_videoFPSqManual : camera.m_videoFPSq);
+    }
+    else
+    {
+        camera.m_videoPrevFPSCount = 0;
+        camera.m_videoFPSCount = (camera.m_videoFPSManualEnable ? camera.m_videoFPSqManual : camera.m_videoFPSq);
+    }
+
+    publishFrame(camera.m_videoFrame);
+    m_refreshFrame = false;
+    return (fpsIncrement == 0) || grabOK; // do not spin on a failing camera
+}
+
+bool ATVModFrameProducer::publishFrame(const cv::Mat& image)
+{
+    if (image.empty()) {
+        return false;
+    }
+
+    ATVModFrame *frame = m_frameQueue->getWriteFrame();
+
+    if (!frame) {
+        return false;
+    }
+
+    frame->setImage(image, m_blackLevel, m_spanLevel);
+    m_frameQueue->commitWrite();
+    return true;
+}
+
+void ATVModFrameProducer::measureCameraFPS(ATVCamera& camera)
+{
+    time_t start, end;
+    cv::Mat frame;
+
+    if (getMessageQueueToGUI())
+    {
+        ATVModReport::MsgReportCameraData *report;
+        report = ATVModReport::MsgReportCameraData::create(
+                camera.m_cameraNumber,
+                0.0f,
+                camera.m_videoFPSManual,
+                camera.m_videoFPSManualEnable,
+                camera.m_videoWidth,
+                camera.m_videoHeight,
+                1); // open splash screen on GUI side
+        getMessageQueueToGUI()->push(report);
+    }
+
+    int nbFrames = 0;
+
+    // this takes several seconds so let control in meanwhile. The cameras list does not change.
+    m_mutex.unlock();
+    time(&start);
+
+    for (int i = 0; i < m_cameraFPSTestNbFrames; i++)
+    {
+        camera.m_camera >> frame;
+        if (!frame.empty()) nbFrames++;
+    }
+
+    time(&end);
+    m_mutex.lock();
+
+    double seconds = difftime (end, start);
+    // take a 10% guard and divide bandwidth between all cameras as a hideous hack
+    camera.m_videoFPS = ((nbFrames / seconds) * 0.9) / m_cameras.size();
+    camera.m_videoFPSq = camera.m_videoFPS / m_fps;
+    camera.m_videoFPSCount = camera.m_videoFPSq;
+    camera.m_videoPrevFPSCount = 0;
+
+    if (getMessageQueueToGUI())
+    {
+        ATVModReport::MsgReportCameraData *report;
+        report = ATVModReport::MsgReportCameraData::create(
+                camera.m_cameraNumber,
+                camera.m_videoFPS,
+                camera.m_videoFPSManual,
+                camera.m_videoFPSManualEnable,
+                camera.m_videoWidth,
+                camera.m_videoHeight,
+                2); // close splash screen on GUI side
+        getMessageQueueToGUI()->push(report);
+    }
+}
+
+void ATVModFrameProducer::applySettings(const ATVModSettings& settings)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (settings.m_atvModInput != m_atvModInput) {
+        m_refreshFrame = true;
+    }
+
+    m_atvModInput = settings.m_atvModInput;
+    m_videoPlay = settings.m_videoPlay;
+    m_videoPlayLoop = settings.m_videoPlayLoop;
+    m_cameraPlay = settings.m_cameraPlay;
+    m_showOverlayText = settings.m_showOverlayText;
+    m_overlayText = settings.m_overlayText;
+    m_uniformLevel = settings.m_uniformLevel;
+    updateStreaming();
+    m_wakeUp.wakeOne();
+}
+
+void ATVModFrameProducer::applyImageSize(int nbImageLines, int pointsPerImgLine, float fps)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    m_nbImageLines = nbImageLines;
+    m_pointsPerImgLine = pointsPerImgLine;
+    m_fps = fps;
+
+    if (m_videoOK)
+    {
+        calculateVideoSizes();
+        resizeVideo();
+    }
+
+    calculateCamerasSizes();
+    resizeCamera();
+    m_refreshFrame = true;
+    m_wakeUp.wakeOne();
+}
+
+bool ATVModFrameProducer::openVideo(const QString& fileName)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+	//if (m_videoOK && m_video.isOpened()) m_video.release(); should be done by OpenCV in open method
+
+    m_videoOK = m_video.open(qPrintable(fileName));
+
+    if (m_videoOK)
+    {
+        m_videoFPS = m_video.get(cv::CAP_PROP_FPS);
+        m_videoWidth = (int) m_video.get(cv::CAP_PROP_FRAME_WIDTH);
+        m_videoHeight = (int) m_video.get(cv::CAP_PROP_FRAME_HEIGHT);
+        m_videoLength = (int) m_video.get(cv::CAP_PROP_FRAME_COUNT);
+        int ex = static_cast<int>(m_video.get(cv::CAP_PROP_FOURCC));
+        char ext[] = {(char)(ex & 0XFF),(char)((ex & 0XFF00) >> 8),(char)((ex & 0XFF0000) >> 16),(char)((ex & 0XFF000000) >> 24),0};
+
+        qDebug("ATVModFrameProducer::openVideo: %s FPS: %f size: %d x %d #frames: %d codec: %s",
+                m_video.isOpened() ? "OK" : "KO",
+                m_videoFPS,
+                m_videoWidth,
+                m_videoHeight,
+                m_videoLength,
+                ext);
+
+        calculateVideoSizes();
+        m_videoEOF = false;
+
+        if (getMessageQueueToGUI())
+        {
+            ATVModReport::MsgReportVideoFileSourceStreamData *report;
+            report = ATVModReport::MsgReportVideoFileSourceStreamData::create(m_videoFPS, m_videoLength);
+            getMessageQueueToGUI()->push(report);
+        }
+    }
+    else
+    {
+        qDebug("ATVModFrameProducer::openVideo: cannot open video file %s", qPrintable(fileName));
+    }
+
+    updateStreaming();
+    m_wakeUp.wakeOne();
+    return m_videoOK;
+}
+
+void ATVModFrameProducer::calculateVideoSizes()
+{
+	m_videoFPSq = m_videoFPS / m_fps;
+    m_videoFPSCount = m_videoFPSq;
+    m_videoPrevFPSCount = 0;
+
+	qDebug("ATVModFrameProducer::calculateVideoSizes: %d x %d -> %d x %d FPSq: %f",
+        m_videoWidth, m_videoHeight, m_pointsPerImgLine, m_nbImageLines, m_videoFPSq);
+}
+
+void ATVModFrameProducer::resizeVideo()
+{
+	if (!m_videoframeOriginal.empty() && (m_nbImageLines > 0) && (m_pointsPerImgLine > 0)) {
+		cv::resize(m_videoframeOriginal, m_videoFrame, cv::Size(m_pointsPerImgLine, m_nbImageLines)); // resize current frame
+	}
+}
+
+void ATVModFrameProducer::calculateCamerasSizes()
+{
+    for (std::vector<ATVCamera>::iterator it = m_cameras.begin(); it != m_cameras.end(); ++it)
+	{
+		it->m_videoFPSq = it->m_videoFPS / m_fps;
+		it->m_videoFPSqManual = it->m_videoFPSManual / m_fps;
+	    it->m_videoFPSCount = 0; //it->m_videoFPSq;
+	    it->m_videoPrevFPSCount = 0;
+
+        qDebug("ATVModFrameProducer::calculateCamerasSizes: [%d] %d x %d -> %d x %d FPSq: %f",
+            (int) (it - m_cameras.begin()), it->m_videoWidth, it->m_videoHeight, m_pointsPerImgLine, m_nbImageLines, it->m_videoFPSq);
+	}
+}
+
+void ATVModFrameProducer::resizeCamera()
+{
+    if (m_cameraIndex < 0) {
+        return;
+    }
+
+    ATVCamera& camera = m_cameras[m_cameraIndex];
+
+    if (!camera.m_videoframeOriginal.empty() && (m_nbImageLines > 0) && (m_pointsPerImgLine > 0)) {
+        cv::resize(camera.m_videoframeOriginal, camera.m_videoFrame, cv::Size(m_pointsPerImgLine, m_nbImageLines)); // resize current frame
+    }
+}
+
+void ATVModFrameProducer::seekVideoFileStream(int seekPercentage)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    seekVideo(seekPercentage);
+    updateStreaming();
+    m_wakeUp.wakeOne();
+}
+
+void ATVModFrameProducer::seekVideo(int seekPercentage)
+{
+    if ((m_videoOK) && m_video.isOpened())
+    {
+        int seekPoint = ((m_videoLength * seekPercentage) / 100);
+        m_video.set(cv::CAP_PROP_POS_FRAMES, seekPoint);
+        m_videoFPSCount = m_videoFPSq;
+        m_videoPrevFPSCount = 0;
+        m_videoEOF = false;
+    }
+}
+
+void ATVModFrameProducer::updateStreaming()
+{
+    m_streaming = ((m_atvModInput == ATVModSettings::ATVModInputVideo) && m_videoOK && m_videoPlay && !m_videoEOF)
+        || ((m_atvModInput == ATVModSettings::ATVModInputCamera) && m_cameraPlay && (m_cameraIndex >= 0));
+}
+
+void ATVModFrameProducer::scanCameras()
+{
+	for (int i = 0; i < 4; i++)
+	{
+		ATVCamera newCamera;
+		m_cameras.push_back(newCamera);
+		m_cameras.back().m_cameraNumber = i;
+		m_cameras.back().m_camera.open(i);
+
+		if (m_cameras.back().m_camera.isOpened())
+		{
+			m_cameras.back().m_videoFPS = m_cameras.back().m_camera.get(cv::CAP_PROP_FPS);
+			m_cameras.back().m_videoWidth = (int) m_cameras.back().m_camera.get(cv::CAP_PROP_FRAME_WIDTH);
+			m_cameras.back().m_videoHeight = (int) m_cameras.back().m_camera.get(cv::CAP_PROP_FRAME_HEIGHT);
+
+			//m_cameras.back().m_videoFPS = m_cameras.back().m_videoFPS < 0 ? 16.3f : m_cameras.back().m_videoFPS;
+
+			qDebug("ATVModFrameProducer::scanCameras: [%d] FPS: %f %dx%d",
+			        i,
+			        m_cameras.back().m_videoFPS,
+			        m_cameras.back().m_videoWidth ,
+			        m_cameras.back().m_videoHeight);
+		}
+		else
+		{
+			m_cameras.pop_back();
+		}
+	}
+
+	if (m_cameras.size() > 0)
+	{
+	    calculateCamerasSizes();
+		m_cameraIndex = 0;
+	}
+}
+
+void ATVModFrameProducer::releaseCameras()
+{
+	for (std::vector<ATVCamera>::iterator it = m_cameras.begin(); it != m_cameras.end(); ++it)
+	{
+		if (it->m_camera.isOpened()) it->m_camera.release();
+	}
+}
+
+void ATVModFrameProducer::getCameraNumbers(std::vector<int>& numbers)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (std::vector<ATVCamera>::iterator it = m_cameras.begin(); it != m_cameras.end(); ++it) {
+        numbers.push_back(it->m_cameraNumber);
+    }
+
+    if (m_cameras.size() > 0)
+    {
+        m_cameraIndex = 0;
+
+        if (getMessageQueueToGUI())
+        {
+            ATVModReport::MsgReportCameraData *report;
+            report = ATVModReport::MsgReportCameraData::create(
+                    m_cameras[0].m_cameraNumber,
+                    m_cameras[0].m_videoFPS,
+                    m_cameras[0].m_videoFPSManual,
+                    m_cameras[0].m_videoFPSManualEnable,
+                    m_cameras[0].m_videoWidth,
+                    m_cameras[0].m_videoHeight,
+                    0);
+            getMessageQueueToGUI()->push(report);
+        }
+    }
+}
+
+void ATVModFrameProducer::reportVideoFileSourceStreamTiming()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    int framesCount;
+
+    if (m_videoOK && m_video.isOpened())
+    {
+        framesCount = m_video.get(cv::CAP_PROP_POS_FRAMES);
+    } else {
+        framesCount = 0;
+    }
+
+    if (getMessageQueueToGUI())
+    {
+        ATVModReport::MsgReportVideoFileSourceStreamTiming *report;
+        report = ATVModReport::MsgReportVideoFileSourceStreamTiming::create(framesCount);
+        getMessageQueueToGUI()->push(report);
+    }
+}
+
+void ATVModFrameProducer::configureCameraIndex(int index)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((index >= 0) && (index < (int) m_cameras.size()))
+    {
+        m_cameraIndex = index;
+        resizeCamera();
+        m_refreshFrame = true;
+        updateStreaming();
+
+        if (getMessageQueueToGUI())
+        {
+            ATVModReport::MsgReportCameraData *report;
+            report = ATVModReport::MsgReportCameraData::create(
+                    m_cameras[m_cameraIndex].m_cameraNumber,
+                    m_cameras[m_cameraIndex].m_videoFPS,
+                    m_cameras[m_cameraIndex].m_videoFPSManual,
+                    m_cameras[m_cameraIndex].m_videoFPSManualEnable,
+                    m_cameras[m_cameraIndex].m_videoWidth,
+                    m_cameras[m_cameraIndex].m_videoHeight,
+                    0);
+            getMessageQueueToGUI()->push(report);
+        }
+    }
+}
+
+void ATVModFrameProducer::configureCameraData(uint32_t index, float manualFPS, bool manualFPSEnable)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (index < m_cameras.size())
+    {
+        m_cameras[index].m_videoFPSManual = manualFPS;
+        m_cameras[index].m_videoFPSManualEnable = manualFPSEnable;
+    }
+}
+
+void ATVModFrameProducer::mixImageAndText(cv::Mat& image, const QString& text, float uniformLevel)
+{
+    int fontFace = cv::FONT_HERSHEY_PLAIN;
+    double fontScale = image.rows / 100.0;
+    int thickness = image.cols / 160;
+    int baseline=0;
+
+    fontScale = fontScale < 4.0f ? 4.0f : fontScale; // minimum size
+    cv::Size textSize = cv::getTextSize(text.toStdString(), fontFace, fontScale, thickness, &baseline);
+    baseline += thickness;
+
+    // position the text in the top left corner
+    cv::Point textOrg(6, textSize.height+10);
+    // then put the text itself
+    cv::putText(image, text.toStdString(), textOrg, fontFace, fontScale, cv::Scalar::all(255*uniformLevel), thickness, cv::LINE_AA);
+}
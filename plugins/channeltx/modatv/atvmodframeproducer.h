@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_ATVMODFRAMEPRODUCER_H
+#define INCLUDE_ATVMODFRAMEPRODUCER_H
+
+#include <atomic>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include <opencv2/core/core.hpp>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/videoio.hpp>
+
+#include <stdint.h>
+
+#include "dsp/dsptypes.h"
+
+#include "atvmodsettings.h"
+
+class MessageQueue;
+class ATVModFrameQueue;
+
+/**
+ * Reads video file and camera frames, overlays text, converts to grayscale and resizes
+ * them to the image size in its own thread then pushes them as video levels to the
+ * frame queue. It produces one frame per TV frame and waits when the queue is full.
+ * Camera frames are not queued more than one frame ahead to keep latency low.
+ * Control methods are called from the modulator thread.
+ */
+class ATVModFrameProducer : public QThread
+{
+    Q_OBJECT
+
+public:
+    ATVModFrameProducer(ATVModFrameQueue *frameQueue, float blackLevel, float spanLevel, QObject* parent = nullptr);
+    ~ATVModFrameProducer();
+
+    void startWork();
+    void stopWork();
+    void wakeUp() { m_wakeUp.wakeOne(); } //!< called by the consumer when it has released a frame
+    void setMessageQueueToGUI(MessageQueue *messageQueue) { m_messageQueueToGUI = messageQueue; }
+
+    void applySettings(const ATVModSettings& settings);
+    void applyImageSize(int nbImageLines, int pointsPerImgLine, float fps);
+    bool openVideo(const QString& fileName);
+    void seekVideoFileStream(int seekPercentage);
+    void reportVideoFileSourceStreamTiming();
+    void configureCameraIndex(int index);
+    void configureCameraData(uint32_t index, float manualFPS, bool manualFPSEnable);
+    void getCameraNumbers(std::vector<int>& numbers);
+    bool isStreaming() const { return m_streaming.load(); } //!< true when a new frame is expected at each TV frame
+    uint32_t getDroppedFrames() const { return m_droppedFrames; }
+
+    static void mixImageAndText(cv::Mat& image, const QString& text, float uniformLevel);
+
+private:
+    class ATVCamera
+    {
+    public:
+    	cv::VideoCapture m_camera;    //!< camera object
+        cv::Mat m_videoframeOriginal; //!< camera non resized image
+        cv::Mat m_videoFrame;         //!< displayable camera frame
+    	int m_cameraNumber;           //!< camera device number
+        float m_videoFPS;             //!< camera FPS rate
+        float m_videoFPSManual;       //!< camera FPS rate manually set
+        bool m_videoFPSManualEnable;  //!< Enable camera FPS rate manual set value
+        int m_videoWidth;             //!< camera frame width
+        int m_videoHeight;            //!< camera frame height
+        float m_videoFPSq;            //!< camera FPS sacaling factor
+        float m_videoFPSqManual;      //!< camera FPS sacaling factor manually set
+        float m_videoFPSCount;        //!< camera FPS fractional counter
+        int m_videoPrevFPSCount;      //!< camera FPS previous integer counter
+
+        ATVCamera() :
+        	m_cameraNumber(-1),
+			m_videoFPS(25.0f),
+			m_videoFPSManual(20.0f),
+			m_videoFPSManualEnable(false),
+        	m_videoWidth(1),
+			m_videoHeight(1),
+			m_videoFPSq(1.0f),
+			m_videoFPSqManual(1.0f),
+		    m_videoFPSCount(0.0f),
+		    m_videoPrevFPSCount(0)
+        {}
+
+        ATVCamera(const ATVCamera& camera) :
+            m_camera(camera.m_camera),
+            m_videoframeOriginal(camera.m_videoframeOriginal),
+            m_videoFrame(camera.m_videoFrame),
+            m_cameraNumber(camera.m_cameraNumber),
+            m_videoFPS(camera.m_videoFPS),
+            m_videoFPSManual(camera.m_videoFPSManual),
+            m_videoFPSManualEnable(camera.m_videoFPSManualEnable),
+            m_videoWidth(camera.m_videoWidth),
+            m_videoHeight(camera.m_videoHeight),
+            m_videoFPSq(camera.m_videoFPSq),
+            m_videoFPSqManual(camera.m_videoFPSqManual),
+            m_videoFPSCount(camera.m_videoFPSCount),
+            m_videoPrevFPSCount(camera.m_videoPrevFPSCount)
+        {}
+    };
+
+    ATVModFrameQueue *m_frameQueue;
+    float m_blackLevel;
+    float m_spanLevel;
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    QMutex m_mutex;              //!< serializes frame production and control
+    QWaitCondition m_wakeUp;
+    bool m_running;
+    std::atomic<bool> m_streaming;
+    uint32_t m_droppedFrames;    //!< source frames that could not be read or decoded
+
+    ATVModSettings::ATVModInput m_atvModInput;
+    bool m_videoPlay;
+    bool m_videoPlayLoop;
+    bool m_cameraPlay;
+    bool m_showOverlayText;
+    QString m_overlayText;
+    float m_uniformLevel;
+
+    int m_nbImageLines;          //!< number of lines of the frames delivered
+    int m_pointsPerImgLine;      //!< number of points per line of the frames delivered
+    float m_fps;                 //!< TV frames per second
+    bool m_refreshFrame;         //!< deliver current frame again at new size
+
+    cv::VideoCapture m_video;    //!< current video capture
+    cv::Mat m_videoframeOriginal; //!< current frame from video
+    cv::Mat m_videoFrame;        //!< current displayable video frame
+    float m_videoFPS;            //!< current video FPS rate
+    int m_videoWidth;            //!< current video frame width
+    int m_videoHeight;           //!< current video frame height
+    float m_videoFPSq;           //!< current video FPS sacaling factor
+    float m_videoFPSCount;       //!< current video FPS fractional counter
+    int m_videoPrevFPSCount;     //!< current video FPS previous integer counter
+    int m_videoLength;           //!< current video length in frames
+    bool m_videoEOF;             //!< current video has reached end of file
+    bool m_videoOK;
+
+    std::vector<ATVCamera> m_cameras; //!< vector of available cameras
+    int m_cameraIndex;           //!< curent camera index in list of available cameras
+
+    MessageQueue *m_messageQueueToGUI;
+
+    static const int m_cameraFPSTestNbFrames; //!< number of frames for camera FPS test
+    static const unsigned long m_idleWaitMs;  //!< maximum wait time when there is nothing to do
+
+    void run();
+    bool produceFrame();
+    bool produceVideoFrame();
+    bool produceCameraFrame();
+    bool publishFrame(const cv::Mat& image);
+    void measureCameraFPS(ATVCamera& camera);
+    void calculateVideoSizes();
+    void resizeVideo();
+    void scanCameras();
+    void releaseCameras();
+    void calculateCamerasSizes();
+    void resizeCamera();
+    void seekVideo(int seekPercentage);
+    void updateStreaming();
+
+    MessageQueue *getMessageQueueToGUI() { return m_messageQueueToGUI; }
+};
+
+#endif // INCLUDE_ATVMODFRAMEPRODUCER_H
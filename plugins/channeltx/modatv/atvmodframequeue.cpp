@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "atvmodframequeue.h"
+
+void ATVModFrame::setImage(const cv::Mat& image, float blackLevel, float spanLevel)
+{
+    m_nbLines = image.rows;
+    m_nbPoints = image.cols;
+    m_levels.resize(m_nbLines * m_nbPoints);
+    float *level = m_levels.data();
+    const float scale = spanLevel / 256.0f;
+
+    for (int row = 0; row < m_nbLines; row++)
+    {
+        const unsigned char *pixels = image.ptr<unsigned char>(row);
+
+        for (int col = 0; col < m_nbPoints; col++) {
+            *level++ = pixels[col] * scale + blackLevel;
+        }
+    }
+}
+
+ATVModFrameQueue::ATVModFrameQueue() :
+    m_writeIndex(0),
+    m_readIndex(0)
+{}
+
+ATVModFrame *ATVModFrameQueue::getWriteFrame()
+{
+    unsigned int writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+
+    if (writeIndex - m_readIndex.load(std::memory_order_acquire) >= m_nbSlots) {
+        return nullptr;
+    }
+
+    return &m_frames[writeIndex % m_nbSlots];
+}
+
+void ATVModFrameQueue::commitWrite()
+{
+    m_writeIndex.fetch_add(1, std::memory_order_release);
+}
+
+unsigned int ATVModFrameQueue::size() const
+{
+    return m_writeIndex.load(std::memory_order_acquire) - m_readIndex.load(std::memory_order_acquire);
+}
+
+const ATVModFrame *ATVModFrameQueue::getReadFrame() const
+{
+    unsigned int readIndex = m_readIndex.load(std::memory_order_relaxed);
+
+    if (m_writeIndex.load(std::memory_order_acquire) == readIndex) {
+        return nullptr;
+    }
+
+    return &m_frames[readIndex % m_nbSlots];
+}
+
+bool ATVModFrameQueue::moveToNextFrame()
+{
+    unsigned int readIndex = m_readIndex.load(std::memory_order_relaxed);
+
+    if (m_writeIndex.load(std::memory_order_acquire) - readIndex < 2) {
+        return false;
+    }
+
+    m_readIndex.store(readIndex + 1, std::memory_order_release);
+    return true;
+}
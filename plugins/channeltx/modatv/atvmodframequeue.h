@@ -0,0 +1,73 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_ATVMODFRAMEQUEUE_H
+#define INCLUDE_ATVMODFRAMEQUEUE_H
+
+#include <atomic>
+#include <vector>
+
+#include <opencv2/core/core.hpp>
+
+/**
+ * Image part of a TV frame ready to be modulated: one video level per point of
+ * each image line so that the modulator only has to copy lines.
+ */
+struct ATVModFrame
+{
+    std::vector<float> m_levels;
+    int m_nbLines;
+    int m_nbPoints;
+
+    ATVModFrame() :
+        m_nbLines(0),
+        m_nbPoints(0)
+    {}
+
+    const float *getLine(int line) const { return &m_levels[line * m_nbPoints]; }
+    bool matches(int nbLines, int nbPoints) const { return (m_nbLines == nbLines) && (m_nbPoints == nbPoints); }
+    void setImage(const cv::Mat& image, float blackLevel, float spanLevel); //!< from a 8 bit grayscale image
+};
+
+/**
+ * Lock free single producer single consumer queue of frames. The consumer keeps
+ * using the oldest frame of the queue until it moves to the next one at the start
+ * of a new TV frame so that the current frame is never overwritten.
+ */
+class ATVModFrameQueue
+{
+public:
+    ATVModFrameQueue();
+
+    // producer side
+    ATVModFrame *getWriteFrame(); //!< nullptr if queue is full
+    void commitWrite();
+    unsigned int size() const; //!< number of frames including the current one
+
+    // consumer side
+    const ATVModFrame *getReadFrame() const; //!< current frame or nullptr if none was produced yet
+    bool moveToNextFrame();                  //!< false if there is no newer frame to move to
+
+    static const unsigned int m_nbSlots = 4;
+
+private:
+    ATVModFrame m_frames[m_nbSlots];
+    std::atomic<unsigned int> m_writeIndex; //!< count of committed frames
+    std::atomic<unsigned int> m_readIndex;  //!< count of released frames
+};
+
+#endif // INCLUDE_ATVMODFRAMEQUEUE_H
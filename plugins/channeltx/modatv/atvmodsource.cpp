@@ -15,8 +15,6 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
-#include <time.h>
-
 #include <QDebug>
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
@@ -36,7 +34,6 @@ const float ATVModSource::m_blackLevel = 0.3f;
 const float ATVModSource::m_spanLevel = 0.7f;
 const int ATVModSource::m_levelNbSamples = 10000; // every 10ms
 const int ATVModSource::m_nbBars = 6;
-const int ATVModSource::m_cameraFPSTestNbFrames = 100;
 const int ATVModSource::m_ssbFftLen = 1024;
 
 const ATVModSource::LineType ATVModSource::StdPAL625_F1Start[] = {
@@ -116,13 +113,8 @@ ATVModSource::ATVModSource() :
     m_horizontalCount(0),
     m_lineCount(0),
 	m_imageOK(false),
-	m_videoFPSq(1.0f),
-    m_videoFPSCount(0.0f),
-	m_videoPrevFPSCount(0),
-	m_videoEOF(false),
-	m_videoOK(false),
-	m_cameraIndex(-1),
-	//m_showOverlayText(false),
+    m_frameProducer(&m_frameQueue, m_blackLevel, m_spanLevel),
+    m_repeatedFrames(0),
     m_SSBFilter(nullptr),
     m_SSBFilterBuffer(nullptr),
     m_SSBFilterBufferIndex(0),
@@ -132,8 +124,6 @@ ATVModSource::ATVModSource() :
     m_messageQueueToGUI(nullptr),
     m_imageLine(0)
 {
-    scanCameras();
-
     m_SSBFilter = new fftfilt(0, m_settings.m_rfBandwidth / (float) m_channelSampleRate, m_ssbFftLen); // arbitrary cutoff
     m_SSBFilterBuffer = new Complex[m_ssbFftLen/2]; // filter returns data exactly half of its size
     memset(m_SSBFilterBuffer, 0, sizeof(Complex)*(m_ssbFftLen>>1));
@@ -149,15 +139,12 @@ ATVModSource::ATVModSource() :
     applySettings(m_settings, true); // does applyStandard() too;
 
     m_lineType = getLineType(m_settings.m_atvStd, m_lineCount);
+    m_frameProducer.startWork();
 }
 
 ATVModSource::~ATVModSource()
 {
-    if (m_video.isOpened()) {
-	    m_video.release();
-	}
-
-    releaseCameras();
+    m_frameProducer.stopWork();
     delete m_SSBFilter;
     delete m_DSBFilter;
     delete[] m_SSBFilterBuffer;
@@ -307,47 +294,12 @@ Complex& ATVModSource::modulateVestigialSSB(Real& sample)
 
 void ATVModSource::pullVideo(Real& sample)
 {
-    if (m_settings.m_atvStd == ATVModSettings::ATVStdHSkip)
-    {
-        pullImageSample(sample, m_lineCount == m_nbLines - 1); // pull image line without sync at end of image
-    }
-    else
-    {
-        switch(m_lineType)
-        {
-            case LineImage:
-                pullImageSample(sample);
-                break;
-            case LineImageHalf1Short:
-                pullImageFirstHalfShortSample(sample);
-                break;
-            case LineImageHalf1Broad:
-                pullImageFirstHalfBroadSample(sample);
-                break;
-            case LineImageHalf2:
-                pullImageLastHalfSample(sample);
-                break;
-            case LineShortPulses:
-                pullVSyncLineEquPulsesSample(sample);
-                break;
-            case LineBroadPulses:
-                pullVSyncLineLongPulsesSample(sample);
-                break;
-            case LineShortBroadPulses:
-                pullVSyncLineEquLongPulsesSample(sample);
-                break;
-            case LineBroadShortPulses:
-                pullVSyncLineLongEquPulsesSample(sample);
-                break;
-            case LineShortBlackPulses:
-                pullVSyncLineEquBlackPulsesSample(sample);
-                break;
-            case LineBlack:
-            default:
-                pullBlackLineSample(sample);
-        }
+    if (m_horizontalCount == 0) {
+        generateLine();
     }
 
+    sample = m_lineBuffer[m_horizontalCount];
+
     if (m_horizontalCount < m_nbHorizPoints - 1)
     {
         m_horizontalCount++;
@@ -376,180 +328,159 @@ void ATVModSource::pullVideo(Real& sample)
             m_lineCount = 0;
             m_imageLine = m_imageLineStart1; // field1 image line start index
             m_lineType = getLineType(m_settings.m_atvStd, m_lineCount);
-
-            if ((m_settings.m_atvModInput == ATVModSettings::ATVModInputVideo) && m_videoOK && (m_settings.m_videoPlay) && !m_videoEOF)
-            {
-            	int grabOK = 0;
-            	int fpsIncrement = (int) m_videoFPSCount - m_videoPrevFPSCount;
-
-            	// move a number of frames according to increment
-            	// use grab to test for EOF then retrieve to preserve last valid frame as the current original frame
-            	// TODO: handle pause (no move)
-            	for (int i = 0; i < fpsIncrement; i++)
-            	{
-            		grabOK = m_video.grab();
-            		if (!grabOK) break;
-            	}
-
-            	if (grabOK)
-            	{
-            		cv::Mat colorFrame;
-            		m_video.retrieve(colorFrame);
-
-            		if (!colorFrame.empty()) // some frames may not come out properly
-            		{
-            		    if (m_settings.m_showOverlayText) {
-            		        mixImageAndText(colorFrame);
-            		    }
-
-            		    cv::cvtColor(colorFrame, m_videoframeOriginal, cv::COLOR_RGB2GRAY);
-            		    resizeVideo();
-            		}
-            	}
-            	else
-            	{
-            	    if (m_settings.m_videoPlayLoop) { // play loop
-            	        seekVideoFileStream(0);
-            	    } else { // stops
-            	        m_videoEOF = true;
-            	    }
-            	}
-
-            	if (m_videoFPSCount < m_videoFPS)
-            	{
-            		m_videoPrevFPSCount = (int) m_videoFPSCount;
-                	m_videoFPSCount += m_videoFPSq;
-            	}
-            	else
-            	{
-            		m_videoPrevFPSCount = 0;
-            		m_videoFPSCount = m_videoFPSq;
-            	}
-            }
-            else if ((m_settings.m_atvModInput == ATVModSettings::ATVModInputCamera) && (m_settings.m_cameraPlay))
-            {
-                ATVCamera& camera = m_cameras[m_cameraIndex];
-
-                if (camera.m_videoFPS < 0.0f) // default frame rate when it could not be obtained via get
-                {
-                    time_t start, end;
-                    cv::Mat frame;
-
-                    if (getMessageQueueToGUI())
-                    {
-                        ATVModReport::MsgReportCameraData *report;
-                        report = ATVModReport::MsgReportCameraData::create(
-                                camera.m_cameraNumber,
-                                0.0f,
-                                camera.m_videoFPSManual,
-                                camera.m_videoFPSManualEnable,
-                                camera.m_videoWidth,
-                                camera.m_videoHeight,
-                                1); // open splash screen on GUI side
-                        getMessageQueueToGUI()->push(report);
-                    }
-
-                    int nbFrames = 0;
-
-                    time(&start);
-
-                    for (int i = 0; i < m_cameraFPSTestNbFrames; i++)
-                    {
-                        camera.m_camera >> frame;
-                        if (!frame.empty()) nbFrames++;
-                    }
-
-                    time(&end);
-
-                    double seconds = difftime (end, start);
-                    // take a 10% guard and divide bandwidth between all cameras as a hideous hack
-                    camera.m_videoFPS = ((nbFrames / seconds) * 0.9) / m_cameras.size();
-                    camera.m_videoFPSq = camera.m_videoFPS / m_fps;
-                    camera.m_videoFPSCount = camera.m_videoFPSq;
-                    camera.m_videoPrevFPSCount = 0;
-
-                    if (getMessageQueueToGUI())
-                    {
-                        ATVModReport::MsgReportCameraData *report;
-                        report = ATVModReport::MsgReportCameraData::create(
-                                camera.m_cameraNumber,
-                                camera.m_videoFPS,
-                                camera.m_videoFPSManual,
-                                camera.m_videoFPSManualEnable,
-                                camera.m_videoWidth,
-                                camera.m_videoHeight,
-                                2); // close splash screen on GUI side
-                        getMessageQueueToGUI()->push(report);
-                    }
-                }
-                else if (camera.m_videoFPS == 0.0f) // Hideous hack for windows
-                {
-                    camera.m_videoFPS = 5.0f;
-                    camera.m_videoFPSq = camera.m_videoFPS / m_fps;
-                    camera.m_videoFPSCount = camera.m_videoFPSq;
-                    camera.m_videoPrevFPSCount = 0;
-
-                    if (getMessageQueueToGUI())
-                    {
-                        ATVModReport::MsgReportCameraData *report;
-                        report = ATVModReport::MsgReportCameraData::create(
-                                camera.m_cameraNumber,
-                                camera.m_videoFPS,
-                                camera.m_videoFPSManual,
-                                camera.m_videoFPSManualEnable,
-                                camera.m_videoWidth,
-                                camera.m_videoHeight,
-                                0);
-                        getMessageQueueToGUI()->push(report);
-                    }
-                }
-
-                int fpsIncrement = (int) camera.m_videoFPSCount - camera.m_videoPrevFPSCount;
-
-                // move a number of frames according to increment
-                // use grab to test for EOF then retrieve to preserve last valid frame as the current original frame
-                cv::Mat colorFrame;
-                int grabOK = 0;
-
-                for (int i = 0; i < fpsIncrement; i++)
-                {
-                    grabOK = camera.m_camera.grab();
-                    if (!grabOK) break;
-                    // camera.m_camera >> colorFrame;
-                    // if (colorFrame.empty()) break;
-                }
-
-                if (grabOK) {
-                    camera.m_camera.retrieve(colorFrame);
-                }
-
-                if (!colorFrame.empty()) // some frames may not come out properly
-                {
-                    if (m_settings.m_showOverlayText) {
-                        mixImageAndText(colorFrame);
-                    }
-
-                    cv::cvtColor(colorFrame, camera.m_videoframeOriginal, cv::COLOR_RGB2GRAY);
-                    resizeCamera();
-                }
-
-                if (camera.m_videoFPSCount < (camera.m_videoFPSManualEnable ? camera.m_videoFPSManual : camera.m_videoFPS))
-                {
-                    camera.m_videoPrevFPSCount = (int) camera.m_videoFPSCount;
-                    camera.m_videoFPSCount += (camera.m_videoFPSManualEnable ? camera.m_videoFPSqManual : camera.m_videoFPSq);
-                }
-                else
-                {
-                    camera.m_videoPrevFPSCount = 0;
-                    camera.m_videoFPSCount = (camera.m_videoFPSManualEnable ? camera.m_videoFPSqManual : camera.m_videoFPSq);
-                }
-            }
+            moveToNextFrame();
         }
 
         m_horizontalCount = 0;
     }
 }
 
+void ATVModSource::moveToNextFrame()
+{
+    if (!m_frameQueue.moveToNextFrame() && m_frameProducer.isStreaming()) {
+        m_repeatedFrames++;
+    }
+
+    m_frameProducer.wakeUp(); // there is room for a new frame
+}
+
+void ATVModSource::generateLine()
+{
+    Real *line = m_lineBuffer.data();
+    int halfLine = m_nbHorizPoints / 2;
+
+    if (m_settings.m_atvStd == ATVModSettings::ATVStdHSkip)
+    {
+        generateImageLine(line, m_lineCount == m_nbLines - 1); // image line without sync at end of image
+        return;
+    }
+
+    switch(m_lineType)
+    {
+        case LineImage:
+            generateImageLine(line);
+            break;
+        case LineImageHalf1Short:
+            generateImageLine(line);
+            generatePulse(line + halfLine, m_nbHorizPoints - halfLine, m_pointsPerVEqu);
+            break;
+        case LineImageHalf1Broad:
+            generateImageLine(line);
+            generatePulse(line + halfLine, m_nbHorizPoints - halfLine, m_pointsPerVSync);
+            break;
+        case LineImageHalf2:
+            generateImageLine(line);
+            std::fill(line + m_pointsPerSync + m_pointsPerBP, line + halfLine, m_blackLevel);
+            break;
+        case LineShortPulses:
+            generatePulse(line, halfLine, m_pointsPerVEqu);
+            generatePulse(line + halfLine, m_nbHorizPoints - halfLine, m_pointsPerVEqu);
+            break;
+        case LineBroadPulses:
+            generatePulse(line, halfLine, m_pointsPerVSync);
+            generatePulse(line + halfLine, m_nbHorizPoints - halfLine, m_pointsPerVSync);
+            break;
+        case LineShortBroadPulses:
+            generatePulse(line, halfLine, m_pointsPerVEqu);
+            generatePulse(line + halfLine, m_nbHorizPoints - halfLine, m_pointsPerVSync);
+            break;
+        case LineBroadShortPulses:
+            generatePulse(line, halfLine, m_pointsPerVSync);
+            generatePulse(line + halfLine, m_nbHorizPoints - halfLine, m_pointsPerVEqu);
+            break;
+        case LineShortBlackPulses:
+            generatePulse(line, m_nbHorizPoints, m_pointsPerVEqu);
+            break;
+        case LineBlack:
+        default:
+            generatePulse(line, m_nbHorizPoints, m_pointsPerSync);
+    }
+}
+
+void ATVModSource::generateImageLine(Real *line, bool noHSync)
+{
+    int imageStart = m_pointsPerSync + m_pointsPerBP;
+    int imageEnd = imageStart + m_pointsPerImgLine;
+
+    std::fill(line, line + m_pointsPerSync, noHSync ? m_blackLevel : 0.0f); // sync pulse (ultra-black)
+    std::fill(line + m_pointsPerSync, line + imageStart, m_blackLevel); // back porch
+    generateImagePoints(line + imageStart);
+    std::fill(line + imageEnd, line + m_nbHorizPoints, m_blackLevel); // front porch
+}
+
+void ATVModSource::generateImagePoints(Real *points)
+{
+    Real uniformLevel = m_spanLevel * m_settings.m_uniformLevel + m_blackLevel;
+
+    if (m_imageLine >= (int) m_nbImageLines) // out of image zone
+    {
+        std::fill(points, points + m_pointsPerImgLine, uniformLevel);
+        return;
+    }
+
+    switch(m_settings.m_atvModInput)
+    {
+    case ATVModSettings::ATVModInputHBars:
+        for (int i = 0; i < m_pointsPerImgLine; i++) {
+            points[i] = (i / m_pointsPerHBar) * m_hBarIncrement + m_blackLevel;
+        }
+        break;
+    case ATVModSettings::ATVModInputVBars:
+        std::fill(points, points + m_pointsPerImgLine, (m_imageLine / m_linesPerVBar) * m_vBarIncrement + m_blackLevel);
+        break;
+    case ATVModSettings::ATVModInputChessboard:
+        for (int i = 0; i < m_pointsPerImgLine; i++) {
+            points[i] = (((m_imageLine / m_linesPerVBar)*5 + (i / m_pointsPerHBar)) % 2) * m_spanLevel * m_settings.m_uniformLevel + m_blackLevel;
+        }
+        break;
+    case ATVModSettings::ATVModInputHGradient:
+        for (int i = 0; i < m_pointsPerImgLine; i++) {
+            points[i] = (i / (float) m_pointsPerImgLine) * m_spanLevel + m_blackLevel;
+        }
+        break;
+    case ATVModSettings::ATVModInputVGradient:
+        std::fill(points, points + m_pointsPerImgLine, (m_imageLine / (float) m_nbImageLines) * m_spanLevel + m_blackLevel);
+        break;
+    case ATVModSettings::ATVModInputDiagonal:
+    {
+        int diagonalIndex = std::min((int) ((m_imageLine * m_pointsPerImgLine) / m_nbImageLines), m_pointsPerImgLine);
+        std::fill(points, points + diagonalIndex, m_blackLevel);
+        std::fill(points + diagonalIndex, points + m_pointsPerImgLine, m_settings.m_uniformLevel + m_blackLevel);
+        break;
+    }
+    case ATVModSettings::ATVModInputImage:
+        generateFramePoints(m_imageOK ? &m_imageFrame : nullptr, points);
+        break;
+    case ATVModSettings::ATVModInputVideo:
+    case ATVModSettings::ATVModInputCamera:
+        generateFramePoints(m_frameQueue.getReadFrame(), points);
+        break;
+    case ATVModSettings::ATVModInputUniform:
+    default:
+        std::fill(points, points + m_pointsPerImgLine, uniformLevel);
+    }
+}
+
+void ATVModSource::generateFramePoints(const ATVModFrame *frame, Real *points)
+{
+    if (frame && frame->matches(m_nbImageLines, m_pointsPerImgLine))
+    {
+        const float *frameLine = frame->getLine(m_imageLine);
+        std::copy(frameLine, frameLine + m_pointsPerImgLine, points);
+    }
+    else // not available or being resized
+    {
+        std::fill(points, points + m_pointsPerImgLine, m_spanLevel * m_settings.m_uniformLevel + m_blackLevel);
+    }
+}
+
+void ATVModSource::generatePulse(Real *line, int length, int pulseLength)
+{
+    int pulseEnd = std::min(pulseLength, length);
+    std::fill(line, line + pulseEnd, 0.0f); // ultra-black
+    std::fill(line + pulseEnd, line + length, m_blackLevel); // black
+}
+
 void ATVModSource::calculateLevel(Real& sample)
 {
     if (m_levelCalcCount < m_levelNbSamples)
@@ -687,19 +618,15 @@ void ATVModSource::applyStandard(const ATVModSettings& settings)
     }
 
     m_linesPerVBar = m_nbImageLines  / m_nbBars;
+    m_lineBuffer.resize(m_nbHorizPoints);
+    m_horizontalCount = 0; // restart line with new timings
 
     if (m_imageOK)
     {
         resizeImage();
     }
 
-    if (m_videoOK)
-    {
-    	calculateVideoSizes();
-    	resizeVideo();
-    }
-
-    calculateCamerasSizes();
+    m_frameProducer.applyImageSize(m_nbImageLines, m_pointsPerImgLine, m_fps);
 }
 
 void ATVModSource::openImage(const QString& fileName)
@@ -713,7 +640,7 @@ void ATVModSource::openImage(const QString& fileName)
         m_imageFromFile.copyTo(m_imageOriginal);
 
         if (m_settings.m_showOverlayText) {
-            mixImageAndText(m_imageOriginal);
+            ATVModFrameProducer::mixImageAndText(m_imageOriginal, m_settings.m_overlayText, m_settings.m_uniformLevel);
 	    }
 
 	    resizeImage();
@@ -727,201 +654,28 @@ void ATVModSource::openImage(const QString& fileName)
 
 void ATVModSource::openVideo(const QString& fileName)
 {
-	//if (m_videoOK && m_video.isOpened()) m_video.release(); should be done by OpenCV in open method
-
-    m_videoOK = m_video.open(qPrintable(fileName));
-
-    if (m_videoOK)
-    {
+    if (m_frameProducer.openVideo(fileName)) {
         m_settings.m_videoFileName = fileName;
-        m_videoFPS = m_video.get(cv::CAP_PROP_FPS);
-        m_videoWidth = (int) m_video.get(cv::CAP_PROP_FRAME_WIDTH);
-        m_videoHeight = (int) m_video.get(cv::CAP_PROP_FRAME_HEIGHT);
-        m_videoLength = (int) m_video.get(cv::CAP_PROP_FRAME_COUNT);
-        int ex = static_cast<int>(m_video.get(cv::CAP_PROP_FOURCC));
-        char ext[] = {(char)(ex & 0XFF),(char)((ex & 0XFF00) >> 8),(char)((ex & 0XFF0000) >> 16),(char)((ex & 0XFF000000) >> 24),0};
-
-        qDebug("ATVModSource::openVideo: %s FPS: %f size: %d x %d #frames: %d codec: %s",
-                m_video.isOpened() ? "OK" : "KO",
-                m_videoFPS,
-                m_videoWidth,
-                m_videoHeight,
-                m_videoLength,
-                ext);
-
-        calculateVideoSizes();
-        m_videoEOF = false;
-
-        if (getMessageQueueToGUI())
-        {
-            ATVModReport::MsgReportVideoFileSourceStreamData *report;
-            report = ATVModReport::MsgReportVideoFileSourceStreamData::create(m_videoFPS, m_videoLength);
-            getMessageQueueToGUI()->push(report);
-        }
-    }
-    else
-    {
+    } else {
         m_settings.m_videoFileName.clear();
-        qDebug("ATVModSource::openVideo: cannot open video file %s", qPrintable(fileName));
     }
 }
 
 void ATVModSource::resizeImage()
 {
-    float fy = (float) m_nbImageLines / (float) m_imageOriginal.rows;
-    float fx = m_pointsPerImgLine / (float) m_imageOriginal.cols;
-    cv::resize(m_imageOriginal, m_image, cv::Size(), fx, fy);
+    cv::resize(m_imageOriginal, m_image, cv::Size(m_pointsPerImgLine, m_nbImageLines));
+    m_imageFrame.setImage(m_image, m_blackLevel, m_spanLevel);
     qDebug("ATVModSource::resizeImage: %d x %d -> %d x %d", m_imageOriginal.cols, m_imageOriginal.rows, m_image.cols, m_image.rows);
 }
 
-void ATVModSource::calculateVideoSizes()
-{
-	m_videoFy = (float) m_nbImageLines / (float) m_videoHeight;
-	m_videoFx = m_pointsPerImgLine / (float) m_videoWidth;
-	m_videoFPSq = m_videoFPS / m_fps;
-    m_videoFPSCount = m_videoFPSq;
-    m_videoPrevFPSCount = 0;
-
-	qDebug("ATVModSource::calculateVideoSizes: factors: %f x %f FPSq: %f", m_videoFx, m_videoFy, m_videoFPSq);
-}
-
-void ATVModSource::resizeVideo()
-{
-	if (!m_videoframeOriginal.empty()) {
-		cv::resize(m_videoframeOriginal, m_videoFrame, cv::Size(), m_videoFx, m_videoFy); // resize current frame
-	}
-}
-
-void ATVModSource::calculateCamerasSizes()
-{
-    for (std::vector<ATVCamera>::iterator it = m_cameras.begin(); it != m_cameras.end(); ++it)
-	{
-		it->m_videoFy = (float) m_nbImageLines / (float) it->m_videoHeight;
-		it->m_videoFx = m_pointsPerImgLine / (float) it->m_videoWidth;
-		it->m_videoFPSq = it->m_videoFPS / m_fps;
-		it->m_videoFPSqManual = it->m_videoFPSManual / m_fps;
-	    it->m_videoFPSCount = 0; //it->m_videoFPSq;
-	    it->m_videoPrevFPSCount = 0;
-
-        qDebug("ATVModSource::calculateCamerasSizes: [%d] factors: %f x %f FPSq: %f",
-            (int) (it - m_cameras.begin()),  it->m_videoFx, it->m_videoFy, it->m_videoFPSq);
-	}
-}
-
-void ATVModSource::resizeCameras()
-{
-    for (std::vector<ATVCamera>::iterator it = m_cameras.begin(); it != m_cameras.end(); ++it)
-	{
-		if (!it->m_videoframeOriginal.empty()) {
-			cv::resize(it->m_videoframeOriginal, it->m_videoFrame, cv::Size(), it->m_videoFx, it->m_videoFy); // resize current frame
-		}
-	}
-}
-
-void ATVModSource::resizeCamera()
-{
-    if (!m_cameras[m_cameraIndex].m_videoframeOriginal.empty()) {
-        cv::resize(m_cameras[m_cameraIndex].m_videoframeOriginal, m_cameras[m_cameraIndex].m_videoFrame, cv::Size(), m_cameras[m_cameraIndex].m_videoFx, m_cameras[m_cameraIndex].m_videoFy); // resize current frame
-    }
-}
-
 void ATVModSource::seekVideoFileStream(int seekPercentage)
 {
-    if ((m_videoOK) && m_video.isOpened())
-    {
-        int seekPoint = ((m_videoLength * seekPercentage) / 100);
-        m_video.set(cv::CAP_PROP_POS_FRAMES, seekPoint);
-        m_videoFPSCount = m_videoFPSq;
-        m_videoPrevFPSCount = 0;
-        m_videoEOF = false;
-    }
-}
-
-void ATVModSource::scanCameras()
-{
-	for (int i = 0; i < 4; i++)
-	{
-		ATVCamera newCamera;
-		m_cameras.push_back(newCamera);
-		m_cameras.back().m_cameraNumber = i;
-		m_cameras.back().m_camera.open(i);
-
-		if (m_cameras.back().m_camera.isOpened())
-		{
-			m_cameras.back().m_videoFPS = m_cameras.back().m_camera.get(cv::CAP_PROP_FPS);
-			m_cameras.back().m_videoWidth = (int) m_cameras.back().m_camera.get(cv::CAP_PROP_FRAME_WIDTH);
-			m_cameras.back().m_videoHeight = (int) m_cameras.back().m_camera.get(cv::CAP_PROP_FRAME_HEIGHT);
-
-			//m_cameras.back().m_videoFPS = m_cameras.back().m_videoFPS < 0 ? 16.3f : m_cameras.back().m_videoFPS;
-
-			qDebug("ATVModSource::scanCameras: [%d] FPS: %f %dx%d",
-			        i,
-			        m_cameras.back().m_videoFPS,
-			        m_cameras.back().m_videoWidth ,
-			        m_cameras.back().m_videoHeight);
-		}
-		else
-		{
-			m_cameras.pop_back();
-		}
-	}
-
-	if (m_cameras.size() > 0)
-	{
-	    calculateCamerasSizes();
-		m_cameraIndex = 0;
-	}
-}
-
-void ATVModSource::releaseCameras()
-{
-	for (std::vector<ATVCamera>::iterator it = m_cameras.begin(); it != m_cameras.end(); ++it)
-	{
-		if (it->m_camera.isOpened()) it->m_camera.release();
-	}
+    m_frameProducer.seekVideoFileStream(seekPercentage);
 }
 
 void ATVModSource::getCameraNumbers(std::vector<int>& numbers)
 {
-    for (std::vector<ATVCamera>::iterator it = m_cameras.begin(); it != m_cameras.end(); ++it) {
-        numbers.push_back(it->m_cameraNumber);
-    }
-
-    if (m_cameras.size() > 0)
-    {
-        m_cameraIndex = 0;
-
-        if (getMessageQueueToGUI())
-        {
-            ATVModReport::MsgReportCameraData *report;
-            report = ATVModReport::MsgReportCameraData::create(
-                    m_cameras[0].m_cameraNumber,
-                    m_cameras[0].m_videoFPS,
-                    m_cameras[0].m_videoFPSManual,
-                    m_cameras[0].m_videoFPSManualEnable,
-                    m_cameras[0].m_videoWidth,
-                    m_cameras[0].m_videoHeight,
-                    0);
-            getMessageQueueToGUI()->push(report);
-        }
-    }
-}
-
-void ATVModSource::mixImageAndText(cv::Mat& image)
-{
-    int fontFace = cv::FONT_HERSHEY_PLAIN;
-    double fontScale = image.rows / 100.0;
-    int thickness = image.cols / 160;
-    int baseline=0;
-
-    fontScale = fontScale < 4.0f ? 4.0f : fontScale; // minimum size
-    cv::Size textSize = cv::getTextSize(m_settings.m_overlayText.toStdString(), fontFace, fontScale, thickness, &baseline);
-    baseline += thickness;
-
-    // position the text in the top left corner
-    cv::Point textOrg(6, textSize.height+10);
-    // then put the text itself
-    cv::putText(image, m_settings.m_overlayText.toStdString(), textOrg, fontFace, fontScale, cv::Scalar::all(255*m_settings.m_uniformLevel), thickness, cv::LINE_AA);
+    m_frameProducer.getCameraNumbers(numbers);
 }
 
 void ATVModSource::applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force)
@@ -1057,7 +811,7 @@ void ATVModSource::applySettings(const ATVModSettings& settings, bool force)
 
             if (settings.m_showOverlayText) {
                 qDebug("ATVModSource::applySettings: set overlay text");
-                mixImageAndText(m_imageOriginal);
+                ATVModFrameProducer::mixImageAndText(m_imageOriginal, settings.m_overlayText, settings.m_uniformLevel);
             } else{
                 qDebug("ATVModSource::applySettings: clear overlay text");
             }
@@ -1066,55 +820,21 @@ void ATVModSource::applySettings(const ATVModSettings& settings, bool force)
         }
     }
 
+    m_frameProducer.applySettings(settings);
     m_settings = settings;
 }
 
 void ATVModSource::reportVideoFileSourceStreamTiming()
 {
-    int framesCount;
-
-    if (m_videoOK && m_video.isOpened())
-    {
-        framesCount = m_video.get(cv::CAP_PROP_POS_FRAMES);;
-    } else {
-        framesCount = 0;
-    }
-
-    if (getMessageQueueToGUI())
-    {
-        ATVModReport::MsgReportVideoFileSourceStreamTiming *report;
-        report = ATVModReport::MsgReportVideoFileSourceStreamTiming::create(framesCount);
-        getMessageQueueToGUI()->push(report);
-    }
+    m_frameProducer.reportVideoFileSourceStreamTiming();
 }
 
 void ATVModSource::configureCameraIndex(int index)
 {
-    if (index < m_cameras.size())
-    {
-        m_cameraIndex = index;
-
-        if (getMessageQueueToGUI())
-        {
-            ATVModReport::MsgReportCameraData *report;
-            report = ATVModReport::MsgReportCameraData::create(
-                    m_cameras[m_cameraIndex].m_cameraNumber,
-                    m_cameras[m_cameraIndex].m_videoFPS,
-                    m_cameras[m_cameraIndex].m_videoFPSManual,
-                    m_cameras[m_cameraIndex].m_videoFPSManualEnable,
-                    m_cameras[m_cameraIndex].m_videoWidth,
-                    m_cameras[m_cameraIndex].m_videoHeight,
-                    0);
-            getMessageQueueToGUI()->push(report);
-        }
-    }
+    m_frameProducer.configureCameraIndex(index);
 }
 
 void ATVModSource::configureCameraData(uint32_t index, float mnaualFPS, bool manualFPSEnable)
 {
-    if (index < m_cameras.size())
-    {
-        m_cameras[index].m_videoFPSManual = mnaualFPS;
-        m_cameras[index].m_videoFPSManualEnable = manualFPSEnable;
-    }
+    m_frameProducer.configureCameraData(index, mnaualFPS, manualFPSEnable);
 }
@@ -25,7 +25,6 @@
 
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
-#include <opencv2/videoio.hpp>
 
 #include <stdint.h>
 
@@ -37,6 +36,8 @@
 #include "util/message.h"
 
 #include "atvmodsettings.h"
+#include "atvmodframequeue.h"
+#include "atvmodframeproducer.h"
 
 class MessageQueue;
 
@@ -54,7 +55,14 @@ public:
     double getMagSq() const { return m_movingAverage.asDouble(); }
     void getCameraNumbers(std::vector<int>& numbers);
 
-    void setMessageQueueToGUI(MessageQueue *messageQueue) { m_messageQueueToGUI = messageQueue; }
+    uint32_t getDroppedFrames() const { return m_frameProducer.getDroppedFrames(); }
+    uint32_t getRepeatedFrames() const { return m_repeatedFrames; }
+
+    void setMessageQueueToGUI(MessageQueue *messageQueue)
+    {
+        m_messageQueueToGUI = messageQueue;
+        m_frameProducer.setMessageQueueToGUI(messageQueue);
+    }
     void getLevels(qreal& rmsLevel, qreal& peakLevel, int& numSamples) const
     {
         rmsLevel = m_rmsLevel;
@@ -75,59 +83,6 @@ public:
     static float getRFBandwidthDivisor(ATVModSettings::ATVModulation modulation);
 
 private:
-    class ATVCamera
-    {
-    public:
-    	cv::VideoCapture m_camera;    //!< camera object
-        cv::Mat m_videoframeOriginal; //!< camera non resized image
-        cv::Mat m_videoFrame;         //!< displayable camera frame
-    	int m_cameraNumber;           //!< camera device number
-        float m_videoFPS;             //!< camera FPS rate
-        float m_videoFPSManual;       //!< camera FPS rate manually set
-        bool m_videoFPSManualEnable;  //!< Enable camera FPS rate manual set value
-        int m_videoWidth;             //!< camera frame width
-        int m_videoHeight;            //!< camera frame height
-        float m_videoFx;              //!< camera horizontal scaling factor
-        float m_videoFy;              //!< camera vertictal scaling factor
-        float m_videoFPSq;            //!< camera FPS sacaling factor
-        float m_videoFPSqManual;      //!< camera FPS sacaling factor manually set
-        float m_videoFPSCount;        //!< camera FPS fractional counter
-        int m_videoPrevFPSCount;      //!< camera FPS previous integer counter
-
-        ATVCamera() :
-        	m_cameraNumber(-1),
-			m_videoFPS(25.0f),
-			m_videoFPSManual(20.0f),
-			m_videoFPSManualEnable(false),
-        	m_videoWidth(1),
-			m_videoHeight(1),
-			m_videoFx(1.0f),
-			m_videoFy(1.0f),
-			m_videoFPSq(1.0f),
-			m_videoFPSqManual(1.0f),
-		    m_videoFPSCount(0.0f),
-		    m_videoPrevFPSCount(0)
-        {}
-
-        ATVCamera(const ATVCamera& camera) :
-            m_camera(camera.m_camera),
-            m_videoframeOriginal(camera.m_videoframeOriginal),
-            m_videoFrame(camera.m_videoFrame),
-            m_cameraNumber(camera.m_cameraNumber),
-            m_videoFPS(camera.m_videoFPS),
-            m_videoFPSManual(camera.m_videoFPSManual),
-            m_videoFPSManualEnable(camera.m_videoFPSManualEnable),
-            m_videoWidth(camera.m_videoWidth),
-            m_videoHeight(camera.m_videoHeight),
-            m_videoFx(camera.m_videoFx),
-            m_videoFy(camera.m_videoFy),
-            m_videoFPSq(camera.m_videoFPSq),
-            m_videoFPSqManual(camera.m_videoFPSqManual),
-            m_videoFPSCount(camera.m_videoFPSCount),
-            m_videoPrevFPSCount(camera.m_videoPrevFPSCount)
-        {}
-    };
-
     enum LineType
     {
         LineImage,            //!< Full image line
@@ -179,6 +134,7 @@ private:
     int      m_imageLine;        //!< current line index in image
     float    m_fps;              //!< resulting frames per second
     LineType m_lineType;         //!< current line type
+    std::vector<Real> m_lineBuffer; //!< video levels of current line
 
     MovingAverageUtil<double, double, 16> m_movingAverage;
     quint32 m_levelCalcCount;
@@ -192,23 +148,11 @@ private:
     cv::Mat m_image;             //!< resized image for transmission at given rate
     bool m_imageOK;
 
-    cv::VideoCapture m_video;    //!< current video capture
-    cv::Mat m_videoframeOriginal; //!< current frame from video
-    cv::Mat m_videoFrame;        //!< current displayable video frame
-    float m_videoFPS;            //!< current video FPS rate
-    int m_videoWidth;            //!< current video frame width
-    int m_videoHeight;           //!< current video frame height
-    float m_videoFx;             //!< current video horizontal scaling factor
-    float m_videoFy;             //!< current video vertictal scaling factor
-    float m_videoFPSq;           //!< current video FPS sacaling factor
-    float m_videoFPSCount;       //!< current video FPS fractional counter
-    int m_videoPrevFPSCount;     //!< current video FPS previous integer counter
-    int m_videoLength;           //!< current video length in frames
-    bool m_videoEOF;             //!< current video has reached end of file
-    bool m_videoOK;
-
-    std::vector<ATVCamera> m_cameras; //!< vector of available cameras
-    int m_cameraIndex;           //!< curent camera index in list of available cameras
+    ATVModFrame m_imageFrame;    //!< image levels for transmission
+
+    ATVModFrameQueue m_frameQueue; //!< video or camera frames ready for transmission
+    ATVModFrameProducer m_frameProducer;
+    uint32_t m_repeatedFrames;   //!< TV frames sent again because the next video or camera frame was not ready
 
     std::string m_overlayText;
     QString m_imageFileName;
@@ -231,7 +175,6 @@ private:
     static const float m_spanLevel;
     static const int m_levelNbSamples;
     static const int m_nbBars; //!< number of bars in bar or chessboard patterns
-    static const int m_cameraFPSTestNbFrames; //!< number of frames for camera FPS test
 
     static const LineType StdPAL625_F1Start[];
     static const LineType StdPAL625_F2Start[];
@@ -250,14 +193,12 @@ private:
     Complex& modulateVestigialSSB(Real& sample);
     void applyStandard(const ATVModSettings& settings);
     void resizeImage();
-    void calculateVideoSizes();
-    void resizeVideo();
-    void scanCameras();
-    void releaseCameras();
-    void calculateCamerasSizes();
-    void resizeCameras();
-    void resizeCamera();
-    void mixImageAndText(cv::Mat& image);
+    void moveToNextFrame();
+    void generateLine();
+    void generateImageLine(Real *line, bool noHSync = false);
+    void generateImagePoints(Real *points);
+    void generateFramePoints(const ATVModFrame *frame, Real *points);
+    void generatePulse(Real *line, int length, int pulseLength);
 
     MessageQueue *getMessageQueueToGUI() { return m_messageQueueToGUI; }
 
@@ -411,210 +352,6 @@ private:
 
         return LineBlack;
     }
-
-    inline void pullImageLastHalfSample(Real& sample)
-    {
-        if (m_horizontalCount < m_pointsPerSync + m_pointsPerBP) { // sync
-            pullImageSample(sample);
-        } else if (m_horizontalCount < (m_nbHorizPoints/2)) {
-            sample = m_blackLevel;
-        } else {
-            pullImageSample(sample);
-        }
-    }
-
-    inline void pullImageFirstHalfShortSample(Real& sample)
-    {
-        if (m_horizontalCount < (m_nbHorizPoints/2)) {
-            pullImageSample(sample);
-        } else {
-            pullVSyncLineEquPulsesSample(sample);
-        }
-    }
-
-    inline void pullImageFirstHalfBroadSample(Real& sample)
-    {
-        if (m_horizontalCount < (m_nbHorizPoints/2)) {
-            pullImageSample(sample);
-        } else {
-            pullVSyncLineLongPulsesSample(sample);
-        }
-    }
-
-    inline void pullImageSample(Real& sample, bool noHSync = false)
-    {
-        if (m_horizontalCount < m_pointsPerSync) // sync pulse
-        {
-            sample = noHSync ? m_blackLevel : 0.0f; // ultra-black
-        }
-        else if (m_horizontalCount < m_pointsPerSync + m_pointsPerBP) // back porch
-        {
-            sample = m_blackLevel; // black
-        }
-        else if (m_horizontalCount < m_pointsPerSync + m_pointsPerBP + m_pointsPerImgLine)
-        {
-            if (m_imageLine >= m_nbImageLines) // out of image zone
-            {
-                sample = m_spanLevel * m_settings.m_uniformLevel + m_blackLevel; // uniform line
-                return;
-            }
-
-            int pointIndex = m_horizontalCount - (m_pointsPerSync + m_pointsPerBP);
-
-            switch(m_settings.m_atvModInput)
-            {
-            case ATVModSettings::ATVModInputHBars:
-                sample = (pointIndex / m_pointsPerHBar) * m_hBarIncrement + m_blackLevel;
-                break;
-            case ATVModSettings::ATVModInputVBars:
-                sample = (m_imageLine / m_linesPerVBar) * m_vBarIncrement + m_blackLevel;
-                break;
-            case ATVModSettings::ATVModInputChessboard:
-                sample = (((m_imageLine / m_linesPerVBar)*5 + (pointIndex / m_pointsPerHBar)) % 2) * m_spanLevel * m_settings.m_uniformLevel + m_blackLevel;
-                break;
-            case ATVModSettings::ATVModInputHGradient:
-                sample = (pointIndex / (float) m_pointsPerImgLine) * m_spanLevel + m_blackLevel;
-                break;
-            case ATVModSettings::ATVModInputVGradient:
-                sample = (m_imageLine / (float) m_nbImageLines) * m_spanLevel + m_blackLevel;
-                break;
-            case ATVModSettings::ATVModInputDiagonal:
-                sample = pointIndex < (m_imageLine * m_pointsPerImgLine) / m_nbImageLines ? m_blackLevel : m_settings.m_uniformLevel + m_blackLevel;
-                break;
-            case ATVModSettings::ATVModInputImage:
-                if (!m_imageOK || m_image.empty())
-                {
-                    sample = m_spanLevel * m_settings.m_uniformLevel + m_blackLevel;
-                }
-                else
-                {
-                	unsigned char pixv;
-                    pixv = m_image.at<unsigned char>(m_imageLine, pointIndex); // row (y), col (x)
-                    sample = (pixv / 256.0f) * m_spanLevel + m_blackLevel;
-                }
-                break;
-            case ATVModSettings::ATVModInputVideo:
-                if (!m_videoOK || m_videoFrame.empty())
-                {
-                    sample = m_spanLevel * m_settings.m_uniformLevel + m_blackLevel;
-                }
-                else
-                {
-                	unsigned char pixv;
-                    pixv = m_videoFrame.at<unsigned char>(m_imageLine, pointIndex); // row (y), col (x)
-                    sample = (pixv / 256.0f) * m_spanLevel + m_blackLevel;
-                }
-            	break;
-            case ATVModSettings::ATVModInputCamera:
-                if (m_cameraIndex < 0)
-                {
-                    sample = m_spanLevel * m_settings.m_uniformLevel + m_blackLevel;
-                }
-                else
-                {
-                    ATVCamera& camera = m_cameras[m_cameraIndex];
-
-                    if (camera.m_videoFrame.empty())
-                    {
-                        sample = m_spanLevel * m_settings.m_uniformLevel + m_blackLevel;
-                    }
-                    else
-                    {
-                        unsigned char pixv;
-                        pixv = camera.m_videoFrame.at<unsigned char>(m_imageLine, pointIndex); // row (y), col (x)
-                        sample = (pixv / 256.0f) * m_spanLevel + m_blackLevel;
-                    }
-                }
-                break;
-            case ATVModSettings::ATVModInputUniform:
-            default:
-                sample = m_spanLevel * m_settings.m_uniformLevel + m_blackLevel; // uniform line
-            }
-        }
-        else // front porch
-        {
-            sample = m_blackLevel; // black
-        }
-    }
-
-    inline void pullVSyncLineEquPulsesSample(Real& sample)
-    {
-        if (m_horizontalCount < m_pointsPerVEqu) {
-            sample = 0.0f; // ultra-black
-        } else if (m_horizontalCount < (m_nbHorizPoints/2)) {
-            sample = m_blackLevel; // black
-        } else if (m_horizontalCount < (m_nbHorizPoints/2) + m_pointsPerVEqu) {
-            sample = 0.0f; // ultra-black
-        } else {
-            sample = m_blackLevel; // black
-        }
-    }
-
-    inline void pullVSyncLineLongPulsesSample(Real& sample)
-    {
-        if (m_horizontalCount < m_pointsPerVSync) {
-            sample = 0.0f; // ultra-black
-        } else if (m_horizontalCount < (m_nbHorizPoints/2)) {
-            sample = m_blackLevel; // black
-        } else if (m_horizontalCount < (m_nbHorizPoints/2) + m_pointsPerVSync) {
-            sample = 0.0f; // ultra-black
-        } else {
-            sample = m_blackLevel; // black
-        }
-    }
-
-    inline void pullVSyncLineEquLongPulsesSample(Real& sample)
-    {
-        if (m_horizontalCount < m_pointsPerVEqu) {
-            sample = 0.0f; // ultra-black
-        } else if (m_horizontalCount < (m_nbHorizPoints/2)) {
-            sample = m_blackLevel; // black
-        } else if (m_horizontalCount < (m_nbHorizPoints/2) + m_pointsPerVSync) {
-            sample = 0.0f; // ultra-black
-        } else {
-            sample = m_blackLevel; // black
-        }
-    }
-
-    inline void pullVSyncLineEquBlackPulsesSample(Real& sample)
-    {
-        if (m_horizontalCount < m_pointsPerVEqu) {
-            sample = 0.0f; // ultra-black
-        } else {
-            sample = m_blackLevel; // black
-        }
-    }
-
-    inline void pullVSyncLineLongEquPulsesSample(Real& sample)
-    {
-        if (m_horizontalCount < m_pointsPerVSync) {
-            sample = 0.0f; // ultra-black
-        } else if (m_horizontalCount < (m_nbHorizPoints/2)) {
-            sample = m_blackLevel; // black
-        } else if (m_horizontalCount < (m_nbHorizPoints/2) + m_pointsPerVEqu) {
-            sample = 0.0f; // ultra-black
-        } else {
-            sample = m_blackLevel; // black
-        }
-    }
-
-    inline void pullVSyncLineLongBlackPulsesSample(Real& sample)
-    {
-        if (m_horizontalCount < m_pointsPerVSync) {
-            sample = 0.0f; // ultra-black
-        } else {
-            sample = m_blackLevel; // black
-        }
-    }
-
-    inline void pullBlackLineSample(Real& sample)
-    {
-        if (m_horizontalCount < m_pointsPerSync) {
-            sample = 0.0f; // ultra-black
-        } else {
-            sample = m_blackLevel; // black
-        }
-    }
 };
 
 
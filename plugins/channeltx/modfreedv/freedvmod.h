@@ -48,6 +48,7 @@ class FreeDVMod : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureFreeDVMod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFreeDVMod)
 
     public:
         const FreeDVModSettings& getSettings() const { return m_settings; }
@@ -35,6 +35,7 @@ class FreeDVModBaseband : public QObject
 public:
     class MsgConfigureFreeDVModBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFreeDVModBaseband)
 
     public:
         const FreeDVModSettings& getSettings() const { return m_settings; }
@@ -44,6 +44,7 @@ class NFMMod : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureNFMMod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureNFMMod)
 
     public:
         const NFMModSettings& getSettings() const { return m_settings; }
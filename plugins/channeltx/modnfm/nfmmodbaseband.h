@@ -35,6 +35,7 @@ class NFMModBaseband : public QObject
 public:
     class MsgConfigureNFMModBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureNFMModBaseband)
 
     public:
         const NFMModSettings& getSettings() const { return m_settings; }
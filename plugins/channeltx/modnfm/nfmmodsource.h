@@ -31,6 +31,7 @@
 #include "dsp/bandpass.h"
 #include "dsp/filterrc.h"
 #include "util/movingaverage.h"
+#include "util/incrementalvector.h"
 #include "dsp/cwkeyer.h"
 #include "audio/audiofifo.h"
 
@@ -74,6 +75,7 @@ private:
     NCOF m_ctcssNco;
     float m_modPhasor; //!< baseband modulator phasor
     Complex m_modSample;
+    IncrementalVector<Complex> m_modBlock;
 
     Interpolator m_interpolator;
     Real m_interpolatorDistance;
@@ -120,6 +122,8 @@ private:
     void pushFeedback(Real sample);
     void calculateLevel(Real& sample);
     void modulateSample();
+    void interpolateSample(Complex& ci);
+    void shiftToCarrier(Complex *ci, Sample *out, unsigned int nbSamples);
 };
 
 
@@ -45,6 +45,7 @@ class PacketMod : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigurePacketMod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigurePacketMod)
 
     public:
         const PacketModSettings& getSettings() const { return m_settings; }
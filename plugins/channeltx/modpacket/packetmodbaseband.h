@@ -36,6 +36,7 @@ class PacketModBaseband : public QObject
 public:
     class MsgConfigurePacketModBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigurePacketModBaseband)
 
     public:
         const PacketModSettings& getSettings() const { return m_settings; }
@@ -46,6 +46,7 @@ class SSBMod : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureSSBMod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSSBMod)
 
     public:
         const SSBModSettings& getSettings() const { return m_settings; }
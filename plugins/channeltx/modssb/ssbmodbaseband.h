@@ -36,6 +36,7 @@ class SSBModBaseband : public QObject
 public:
     class MsgConfigureSSBModBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSSBModBaseband)
 
     public:
         const SSBModSettings& getSettings() const { return m_settings; }
@@ -82,19 +82,26 @@ SSBModSource::~SSBModSource()
 
 void SSBModSource::pull(SampleVector::iterator begin, unsigned int nbSamples)
 {
-    std::for_each(
-        begin,
-        begin + nbSamples,
-        [this](Sample& s) {
-            pullOne(s);
-        }
-    );
+    m_modBlock.allocate(nbSamples);
+    Complex *ci = m_modBlock.m_vector.data();
+
+    // modulation and rate conversion are sequential by nature. The carrier shift and conversion are done on the block
+    for (unsigned int i = 0; i < nbSamples; i++) {
+        interpolateSample(ci[i]);
+    }
+
+    shiftToCarrier(ci, &(*begin), nbSamples);
 }
 
 void SSBModSource::pullOne(Sample& sample)
 {
 	Complex ci;
+    interpolateSample(ci);
+    shiftToCarrier(&ci, &sample, 1);
+}
 
+void SSBModSource::interpolateSample(Complex& ci)
+{
     if (m_interpolatorDistance > 1.0f) // decimate
     {
     	modulateSample();
@@ -113,17 +120,29 @@ void SSBModSource::pullOne(Sample& sample)
     }
 
     m_interpolatorDistanceRemain += m_interpolatorDistance;
+}
 
-    ci *= m_carrierNco.nextIQ(); // shift to carrier frequency
-    ci *= 0.891235351562f * SDR_TX_SCALEF; //scaling at -1 dB to account for possible filter overshoot
+void SSBModSource::shiftToCarrier(Complex *ci, Sample *out, unsigned int nbSamples)
+{
+    for (unsigned int i = 0; i < nbSamples; i++, ++out)
+    {
+        ci[i] *= m_carrierNco.nextIQ(); // shift to carrier frequency
+        ci[i] *= 0.891235351562f * SDR_TX_SCALEF; //scaling at -1 dB to account for possible filter overshoot
+        out->m_real = (FixReal) ci[i].real();
+        out->m_imag = (FixReal) ci[i].imag();
+    }
 
-    double magsq = ci.real() * ci.real() + ci.imag() * ci.imag();
-	magsq /= (SDR_TX_SCALED*SDR_TX_SCALED);
-	m_movingAverage(magsq);
-	m_magsq = m_movingAverage.asDouble();
+    // only the last samples count in the moving average
+    unsigned int nbAverage = std::min(nbSamples, (unsigned int) m_movingAverage.size());
 
-	sample.m_real = (FixReal) ci.real();
-	sample.m_imag = (FixReal) ci.imag();
+    for (unsigned int i = nbSamples - nbAverage; i < nbSamples; i++)
+    {
+        double magsq = ci[i].real() * ci[i].real() + ci[i].imag() * ci[i].imag();
+        magsq /= (SDR_TX_SCALED*SDR_TX_SCALED);
+        m_movingAverage(magsq);
+    }
+
+	m_magsq = m_movingAverage.asDouble();
 }
 
 void SSBModSource::prefetch(unsigned int nbSamples)
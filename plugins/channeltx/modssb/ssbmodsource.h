@@ -29,6 +29,7 @@
 #include "dsp/fftfilt.h"
 #include "dsp/cwkeyer.h"
 #include "util/movingaverage.h"
+#include "util/incrementalvector.h"
 #include "audio/audiocompressorsnd.h"
 #include "audio/audiofifo.h"
 
@@ -73,6 +74,7 @@ private:
     NCOF m_carrierNco;
     NCOF m_toneNco;
     Complex m_modSample;
+    IncrementalVector<Complex> m_modBlock;
 
     Interpolator m_interpolator;
     Real m_interpolatorDistance;
@@ -132,6 +134,8 @@ private:
     void pushFeedback(Complex sample);
     void calculateLevel(Complex& sample);
     void modulateSample();
+    void interpolateSample(Complex& ci);
+    void shiftToCarrier(Complex *ci, Sample *out, unsigned int nbSamples);
 };
 
 #endif // INCLUDE_SSBMODSOURCE_H
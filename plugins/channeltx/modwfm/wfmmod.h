@@ -44,6 +44,7 @@ class WFMMod : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureWFMMod : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureWFMMod)
 
     public:
         const WFMModSettings& getSettings() const { return m_settings; }
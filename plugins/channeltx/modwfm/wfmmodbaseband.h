@@ -35,6 +35,7 @@ class WFMModBaseband : public QObject
 public:
     class MsgConfigureWFMModBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureWFMModBaseband)
 
     public:
         const WFMModSettings& getSettings() const { return m_settings; }
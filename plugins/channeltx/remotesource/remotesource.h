@@ -40,6 +40,7 @@ class RemoteSource : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureRemoteSource : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureRemoteSource)
 
     public:
         const RemoteSourceSettings& getSettings() const { return m_settings; }
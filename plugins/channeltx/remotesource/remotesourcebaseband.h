@@ -36,6 +36,7 @@ class RemoteSourceBaseband : public QObject
 public:
     class MsgConfigureRemoteSourceBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureRemoteSourceBaseband)
 
     public:
         const RemoteSourceSettings& getSettings() const { return m_settings; }
@@ -478,6 +478,11 @@ void UDPSource::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& respons
     response.getUdpSourceReport()->setChannelPowerDb(CalcDb::dbPower(getMagSq()));
     response.getUdpSourceReport()->setSquelch(m_basebandSource->isSquelchOpen() ? 1 : 0);
     response.getUdpSourceReport()->setBufferGauge(getBufferGauge());
+    response.getUdpSourceReport()->setBufferDepth(getBufferDepth());
+    response.getUdpSourceReport()->setLatePackets(getLatePackets());
+    response.getUdpSourceReport()->setLostPackets(getLostPackets());
+    response.getUdpSourceReport()->setUnderruns(getUnderruns());
+    response.getUdpSourceReport()->setRateCorrection(getRateCorrection() * 1e6);
     response.getUdpSourceReport()->setChannelSampleRate(m_basebandSource->getChannelSampleRate());
 }
 
@@ -620,6 +625,36 @@ int32_t UDPSource::getBufferGauge() const
     return m_basebandSource->getBufferGauge();
 }
 
+float UDPSource::getBufferDepth() const
+{
+    return m_basebandSource->getBufferDepth();
+}
+
+uint32_t UDPSource::getLatePackets() const
+{
+    return m_basebandSource->getLatePackets();
+}
+
+uint32_t UDPSource::getLostPackets() const
+{
+    return m_basebandSource->getLostPackets();
+}
+
+uint32_t UDPSource::getUnderruns() const
+{
+    return m_basebandSource->getUnderruns();
+}
+
+uint32_t UDPSource::getDroppedFrames() const
+{
+    return m_basebandSource->getDroppedFrames();
+}
+
+float UDPSource::getRateCorrection() const
+{
+    return m_basebandSource->getRateCorrection();
+}
+
 bool UDPSource::getSquelchOpen() const
 {
     return m_basebandSource->getSquelchOpen();
@@ -41,6 +41,7 @@ class UDPSource : public BasebandSampleSource, public ChannelAPI {
 public:
     class MsgConfigureUDPSource : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureUDPSource)
 
     public:
         const UDPSourceSettings& getSettings() const { return m_settings; }
@@ -147,6 +148,12 @@ public:
     double getMagSq() const;
     double getInMagSq() const;
     int32_t getBufferGauge() const;
+    float getBufferDepth() const;
+    uint32_t getLatePackets() const;
+    uint32_t getLostPackets() const;
+    uint32_t getUnderruns() const;
+    uint32_t getDroppedFrames() const;
+    float getRateCorrection() const;
     bool getSquelchOpen() const;
     void setSpectrum(bool enabled);
     void resetReadIndex();
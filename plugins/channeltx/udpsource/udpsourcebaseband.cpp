@@ -175,9 +175,6 @@ bool UDPSourceBaseband::handleMessage(const Message& cmd)
     {
         QMutexLocker mutexLocker(&m_mutex);
         UDPSourceMessages::MsgSampleRateCorrection& notif = (UDPSourceMessages::MsgSampleRateCorrection&) cmd;
-        qDebug() << "UDPSourceBaseband::handleMessage: MsgSampleRateCorrection:"
-            << "corr: " << notif.getCorrectionFactor()
-            << "ratio: " << notif.getRawDeltaRatio();
         m_source.sampleRateCorrection(notif.getRawDeltaRatio(), notif.getCorrectionFactor());
 
         return true;
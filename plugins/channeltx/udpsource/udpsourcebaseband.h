@@ -35,6 +35,7 @@ class UDPSourceBaseband : public QObject
 public:
     class MsgConfigureUDPSourceBaseband : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureUDPSourceBaseband)
 
     public:
         const UDPSourceSettings& getSettings() const { return m_settings; }
@@ -124,6 +125,12 @@ public:
     double getMagSq() const { return m_source.getMagSq(); }
     double getInMagSq() const { return m_source.getInMagSq(); }
     int32_t getBufferGauge() const { return m_source.getBufferGauge(); }
+    float getBufferDepth() const { return m_source.getBufferDepth(); }
+    uint32_t getLatePackets() const { return m_source.getLatePackets(); }
+    uint32_t getLostPackets() const { return m_source.getLostPackets(); }
+    uint32_t getUnderruns() const { return m_source.getUnderruns(); }
+    uint32_t getDroppedFrames() const { return m_source.getDroppedFrames(); }
+    float getRateCorrection() const { return m_source.getRateCorrection(); }
     bool getSquelchOpen() const { return m_source.getSquelchOpen(); }
     int getChannelSampleRate() const;
     bool isSquelchOpen() const;
@@ -550,6 +550,20 @@ void UDPSourceGUI::tick()
     QString s = QString::number(bufferGauge, 'f', 0);
     ui->bufferRWBalanceText->setText(tr("%1").arg(s));
 
+    if (m_tickCount % 20 == 0)
+    {
+        QString bufferStatus = tr("Depth: %1 ms\nLate: %2 Lost: %3 Underruns: %4 Dropped: %5\nRate correction: %6 ppm")
+            .arg(m_udpSource->getBufferDepth(), 0, 'f', 0)
+            .arg(m_udpSource->getLatePackets())
+            .arg(m_udpSource->getLostPackets())
+            .arg(m_udpSource->getUnderruns())
+            .arg(m_udpSource->getDroppedFrames())
+            .arg(m_udpSource->getRateCorrection() * 1e6, 0, 'f', 0);
+        ui->bufferGaugeNegative->setToolTip(bufferStatus);
+        ui->bufferGaugePositive->setToolTip(bufferStatus);
+        ui->bufferRWBalanceText->setToolTip(bufferStatus);
+    }
+
     if (m_udpSource->getSquelchOpen()) {
         ui->channelMute->setStyleSheet("QToolButton { background-color : green; }");
     } else {
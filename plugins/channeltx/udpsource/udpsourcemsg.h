@@ -30,8 +30,8 @@ public:
         MESSAGE_CLASS_DECLARATION
 
     public:
-        float getCorrectionFactor() const { return m_correctionFactor; }
-        float getRawDeltaRatio() const { return m_rawDeltaRatio; }
+        float getCorrectionFactor() const { return m_correctionFactor; } //!< input sample rate correction relative to nominal
+        float getRawDeltaRatio() const { return m_rawDeltaRatio; }       //!< smoothed buffer fill error relative to buffer size
 
         static MsgSampleRateCorrection* create(float correctionFactor, float rawDeltaRatio)
         {
@@ -34,8 +34,6 @@ UDPSourceSource::UDPSourceSource() :
     m_magsq(1e-10),
     m_movingAverage(16, 1e-10),
     m_inMovingAverage(480, 1e-10),
-    m_sampleRateSum(0),
-    m_sampleRateAvgCounter(0),
     m_levelCalcCount(0),
     m_peakLevel(0.0f),
     m_levelSum(0.0f),
@@ -52,6 +50,8 @@ UDPSourceSource::UDPSourceSource() :
     m_magsq = 0.0;
 
     m_udpHandler.start();
+    m_udpHandler.moveToThread(&m_udpThread);
+    m_udpThread.start();
 
     applySettings(m_settings, true);
     applyChannelSettings(m_channelSampleRate, m_channelFrequencyOffset, true);
@@ -59,7 +59,10 @@ UDPSourceSource::UDPSourceSource() :
 
 UDPSourceSource::~UDPSourceSource()
 {
-    m_udpHandler.stop();
+    // the socket lives in the handler thread: close it there before the thread ends
+    QMetaObject::invokeMethod(&m_udpHandler, "stop", Qt::BlockingQueuedConnection);
+    m_udpThread.quit();
+    m_udpThread.wait();
     delete m_SSBFilter;
     delete[] m_SSBFilterBuffer;
 }
@@ -355,8 +358,6 @@ void UDPSourceSource::applySettings(const UDPSourceSettings& settings, bool forc
         m_interpolator.create(48, settings.m_inputSampleRate, settings.m_rfBandwidth / 2.2, 3.0);
         m_actualInputSampleRate = settings.m_inputSampleRate;
         m_udpHandler.resetReadIndex();
-        m_sampleRateSum = 0.0;
-        m_sampleRateAvgCounter = 0;
         m_spectrumChunkSize = settings.m_inputSampleRate * 0.05; // 50 ms chunk
         m_spectrumChunkCounter = 0;
         m_levelNbSamples = settings.m_inputSampleRate * 0.01; // every 10 ms
@@ -416,41 +417,8 @@ void UDPSourceSource::applySettings(const UDPSourceSettings& settings, bool forc
 
 void UDPSourceSource::sampleRateCorrection(float rawDeltaRatio, float correctionFactor)
 {
-    float newSampleRate = m_actualInputSampleRate + correctionFactor * m_actualInputSampleRate;
-
-    // exclude values too way out nominal sample rate (20%)
-    if ((newSampleRate < m_settings.m_inputSampleRate * 1.2) && (newSampleRate >  m_settings.m_inputSampleRate * 0.8))
-    {
-        m_actualInputSampleRate = newSampleRate;
-
-        if ((rawDeltaRatio > -0.05) && (rawDeltaRatio < 0.05))
-        {
-            if (m_sampleRateAvgCounter < m_sampleRateAverageItems)
-            {
-                m_sampleRateSum += m_actualInputSampleRate;
-                m_sampleRateAvgCounter++;
-            }
-        }
-        else
-        {
-            m_sampleRateSum = 0.0;
-            m_sampleRateAvgCounter = 0;
-        }
-
-        if (m_sampleRateAvgCounter == m_sampleRateAverageItems)
-        {
-            float avgRate = m_sampleRateSum / m_sampleRateAverageItems;
-            qDebug("UDPSourceSource::sampleRateCorrection: corr: %+.6f new rate: %.0f: avg rate: %.0f",
-                    correctionFactor,
-                    m_actualInputSampleRate,
-                    avgRate);
-            m_actualInputSampleRate = avgRate;
-            m_sampleRateSum = 0.0;
-            m_sampleRateAvgCounter = 0;
-        }
-
-        m_interpolatorDistanceRemain = 0;
-        m_interpolatorConsumed = false;
-        m_interpolatorDistance = (Real) m_actualInputSampleRate / (Real) m_channelSampleRate;
-    }
-}
\ No newline at end of file
+    (void) rawDeltaRatio;
+    // the correction is relative to the nominal rate and applied continuously to the fractional resampler
+    m_actualInputSampleRate = m_settings.m_inputSampleRate * (1.0f + correctionFactor);
+    m_interpolatorDistance = (Real) m_actualInputSampleRate / (Real) m_channelSampleRate;
+}
@@ -19,6 +19,7 @@
 #define PLUGINS_CHANNELTX_UDPSINK_UDPSOURCESOURCE_H_
 
 #include <QObject>
+#include <QThread>
 #include <QNetworkRequest>
 
 #include "dsp/channelsamplesource.h"
@@ -47,6 +48,12 @@ public:
     double getMagSq() const { return m_magsq; }
     double getInMagSq() const { return m_inMagsq; }
     int32_t getBufferGauge() const { return m_udpHandler.getBufferGauge(); }
+    float getBufferDepth() const { return m_udpHandler.getBufferDepth(); }
+    uint32_t getLatePackets() const { return m_udpHandler.getLatePackets(); }
+    uint32_t getLostPackets() const { return m_udpHandler.getLostPackets(); }
+    uint32_t getUnderruns() const { return m_udpHandler.getUnderruns(); }
+    uint32_t getDroppedFrames() const { return m_udpHandler.getDroppedFrames(); }
+    float getRateCorrection() const { return m_udpHandler.getRateCorrection(); }
     bool getSquelchOpen() const { return m_squelchOpen; }
 
     void resetReadIndex();
@@ -89,9 +96,8 @@ private:
     MovingAverage<double> m_inMovingAverage;
 
     UDPSourceUDPHandler m_udpHandler;
+    QThread m_udpThread; //!< UDP reception thread
     Real m_actualInputSampleRate; //!< sample rate with UDP buffer skew compensation
-    double m_sampleRateSum;
-    int m_sampleRateAvgCounter;
 
     int m_levelCalcCount;
     qreal m_rmsLevel;
@@ -110,7 +116,6 @@ private:
     Complex* m_SSBFilterBuffer;
     int m_SSBFilterBufferIndex;
 
-    static const int m_sampleRateAverageItems = 17;
     static const int m_ssbFftLen = 1024;
 
     void modulateSample();
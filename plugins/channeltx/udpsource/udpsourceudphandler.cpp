@@ -25,6 +25,11 @@
 
 MESSAGE_CLASS_DEFINITION(UDPSourceUDPHandler::MsgUDPAddressAndPort, Message)
 
+static const float fillErrorAlpha = 1.0f / 256.0f; // buffer fill error smoothing (per frame)
+static const float rateControlKp = 1.0f / 30.0f;   // proportional gain
+static const float rateControlKi = rateControlKp / 200.0f; // integral gain (per control period)
+static const float maxRateCorrection = 0.05f;     // relative to nominal sample rate
+
 UDPSourceUDPHandler::UDPSourceUDPHandler() :
     m_dataSocket(nullptr),
     m_dataAddress(QHostAddress::LocalHost),
@@ -35,18 +40,44 @@ UDPSourceUDPHandler::UDPSourceUDPHandler() :
     m_dataConnected(false),
     m_multicast(false),
     m_udpDumpIndex(0),
+    m_rxBuffer(m_rxBatchSize * m_maxDatagramSize),
     m_nbUDPFrames(m_minNbUDPFrames),
     m_nbAllocatedUDPFrames(m_minNbUDPFrames),
     m_writeFrameIndex(0),
     m_readFrameIndex(m_minNbUDPFrames/2),
     m_readIndex(0),
     m_rwDelta(m_minNbUDPFrames/2),
-    m_d(0),
+    m_sampleSize(sizeof(Sample)),
+    m_sampleRate(48000.0f),
+    m_prebuffering(false),
+    m_rtpSynced(false),
+    m_nextSequence(0),
+    m_fillError(0.0f),
+    m_integral(0.0f),
+    m_controlCounter(0),
+    m_rateCorrection(0.0f),
+    m_latePackets(0),
+    m_lostPackets(0),
+    m_underruns(0),
+    m_droppedFrames(0),
+    m_resyncRequested(false),
     m_autoRWBalance(true),
     m_feedbackMessageQueue(nullptr)
 {
     m_udpBuf = new udpBlk_t[m_minNbUDPFrames];
-    std::fill(m_udpDump, m_udpDump + m_udpBlockSize + 8192, 0);
+    m_udpFilled.resize(m_minNbUDPFrames, false);
+    std::fill(m_udpDump, m_udpDump + m_udpBlockSize + m_maxDatagramSize, 0);
+#if defined(__linux__)
+    memset(m_rxMsgs, 0, sizeof(m_rxMsgs));
+
+    for (int i = 0; i < m_rxBatchSize; i++)
+    {
+        m_rxIovecs[i].iov_base = &m_rxBuffer[i*m_maxDatagramSize];
+        m_rxIovecs[i].iov_len = m_maxDatagramSize;
+        m_rxMsgs[i].msg_hdr.msg_iov = &m_rxIovecs[i];
+        m_rxMsgs[i].msg_hdr.msg_iovlen = 1;
+    }
+#endif
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleMessages()));
 }
 
@@ -109,51 +140,203 @@ void UDPSourceUDPHandler::stop()
 
 void UDPSourceUDPHandler::dataReadyRead()
 {
+    QMutexLocker mutexLocker(&m_mutex);
+
     while (m_dataSocket->hasPendingDatagrams() && m_dataConnected)
     {
-        qint64 pendingDataSize = m_dataSocket->pendingDatagramSize();
-        qint64 bytesRead = m_dataSocket->readDatagram(&m_udpDump[m_udpDumpIndex], pendingDataSize, &m_remoteAddress, &m_remotePort);
+        // the first datagram is read through Qt so that the socket read notifications are enabled again
+        qint64 bytesRead = m_dataSocket->readDatagram(m_rxBuffer.data(), m_maxDatagramSize, &m_remoteAddress, &m_remotePort);
 
-        if (bytesRead < 0)
-        {
+        if (bytesRead < 0) {
             qWarning("UDPSourceUDPHandler::dataReadyRead: UDP read error");
+        } else {
+            processDatagram(m_rxBuffer.data(), bytesRead);
         }
-        else
+
+#if defined(__linux__)
+        readBatch();
+#endif
+    }
+}
+
+#if defined(__linux__)
+void UDPSourceUDPHandler::readBatch()
+{
+    int fd = m_dataSocket->socketDescriptor();
+    int nbRead;
+
+    do
+    {
+        nbRead = recvmmsg(fd, m_rxMsgs, m_rxBatchSize, MSG_DONTWAIT, nullptr);
+
+        for (int i = 0; i < nbRead; i++)
         {
-            int udpDumpSize = m_udpDumpIndex + bytesRead;
-            int udpDumpPtr = 0;
+            if (m_rxMsgs[i].msg_hdr.msg_flags & MSG_TRUNC) {
+                qWarning("UDPSourceUDPHandler::readBatch: datagram truncated to %d bytes", m_maxDatagramSize);
+            }
 
-            while (udpDumpSize >= m_udpBlockSize)
-            {
-                moveData(&m_udpDump[udpDumpPtr]);
-                udpDumpPtr += m_udpBlockSize;
-                udpDumpSize -= m_udpBlockSize;
+            processDatagram(&m_rxBuffer[i*m_maxDatagramSize], m_rxMsgs[i].msg_len);
+        }
+    } while ((nbRead == m_rxBatchSize) && m_dataConnected);
+}
+#endif
+
+void UDPSourceUDPHandler::processDatagram(const char *data, int size)
+{
+    // RTP version 2 header followed by a whole number of blocks
+    if ((size > m_rtpHeaderSize)
+        && ((size - m_rtpHeaderSize) % m_udpBlockSize == 0)
+        && ((data[0] & 0xC0) == 0x80))
+    {
+        processRTP(data, size);
+        return;
+    }
+
+    memcpy(&m_udpDump[m_udpDumpIndex], data, size);
+    int udpDumpSize = m_udpDumpIndex + size;
+    int udpDumpPtr = 0;
+
+    while (udpDumpSize >= m_udpBlockSize)
+    {
+        moveData(&m_udpDump[udpDumpPtr]);
+        udpDumpPtr += m_udpBlockSize;
+        udpDumpSize -= m_udpBlockSize;
+    }
+
+    if (udpDumpSize > 0)
+    {
+        memmove(m_udpDump, &m_udpDump[udpDumpPtr], udpDumpSize);
+    }
+
+    m_udpDumpIndex = udpDumpSize;
+}
+
+void UDPSourceUDPHandler::processRTP(const char *data, int size)
+{
+    uint16_t sequence = ((uint8_t) data[2] << 8) | (uint8_t) data[3];
+    int nbBlocks = (size - m_rtpHeaderSize) / m_udpBlockSize;
+    const char *payload = &data[m_rtpHeaderSize];
+
+    if (!m_rtpSynced)
+    {
+        m_rtpSynced = true;
+        m_nextSequence = sequence;
+        m_udpDumpIndex = 0;
+    }
+
+    int16_t delta = (int16_t) (uint16_t) (sequence - m_nextSequence);
+
+    if ((delta < 0 ? -delta : delta) * nbBlocks >= m_nbUDPFrames) // stream discontinuity
+    {
+        qDebug("UDPSourceUDPHandler::processRTP: resync on sequence %u (expected %u)", sequence, m_nextSequence);
+        delta = 0;
+    }
+
+    if (delta < 0) // older than expected: reordered or late
+    {
+        int framesBack = -delta * nbBlocks;
+        int fill = (m_writeFrameIndex.load() - m_readFrameIndex.load() + m_nbUDPFrames) % m_nbUDPFrames;
+
+        // its place must not have been read yet nor received already
+        if ((framesBack < fill - 1) && !m_udpFilled[(m_writeFrameIndex.load() - framesBack + m_nbUDPFrames) % m_nbUDPFrames])
+        {
+            for (int i = 0; i < nbBlocks; i++) {
+                insertData(&payload[i*m_udpBlockSize], framesBack - i);
             }
 
-            if (udpDumpSize > 0)
-            {
-                memcpy(m_udpDump, &m_udpDump[udpDumpPtr], udpDumpSize);
+            if (m_lostPackets.load() > 0) {
+                m_lostPackets--;
             }
+        }
+        else
+        {
+            m_latePackets++;
+        }
+
+        return;
+    }
 
-            m_udpDumpIndex = udpDumpSize;
+    if (delta > 0) // packets missing
+    {
+        m_lostPackets += delta;
+
+        // keep their place in case they arrive later
+        for (int i = 0; i < delta * nbBlocks; i++) {
+            moveData(nullptr);
         }
     }
+
+    for (int i = 0; i < nbBlocks; i++) {
+        moveData(&payload[i*m_udpBlockSize]);
+    }
+
+    m_nextSequence = sequence + 1;
 }
 
-void UDPSourceUDPHandler::moveData(char *blk)
+void UDPSourceUDPHandler::moveData(const char *blk)
 {
-    memcpy(m_udpBuf[m_writeFrameIndex], blk, m_udpBlockSize);
+    int writeFrameIndex = m_writeFrameIndex.load();
+    int fill = (writeFrameIndex - m_readFrameIndex.load() + m_nbUDPFrames) % m_nbUDPFrames;
+
+    // a full buffer would look empty after one more frame and the reader may still read the frames ahead
+    // of it: drop the block. The reader moves back to half buffer at its next frame boundary.
+    if (fill >= m_nbUDPFrames - 1)
+    {
+        m_droppedFrames++;
+        return;
+    }
 
-    if (m_writeFrameIndex < m_nbUDPFrames - 1) {
-        m_writeFrameIndex++;
+    if (blk) {
+        memcpy(m_udpBuf[writeFrameIndex], blk, m_udpBlockSize);
+    } else {
+        memset(m_udpBuf[writeFrameIndex], 0, m_udpBlockSize);
+    }
+
+    m_udpFilled[writeFrameIndex] = blk != nullptr;
+
+    if (writeFrameIndex < m_nbUDPFrames - 1) {
+        m_writeFrameIndex = writeFrameIndex + 1;
     } else {
         m_writeFrameIndex = 0;
     }
 }
 
+void UDPSourceUDPHandler::insertData(const char *blk, int framesBack)
+{
+    int frameIndex = (m_writeFrameIndex.load() - framesBack + m_nbUDPFrames) % m_nbUDPFrames;
+    memcpy(m_udpBuf[frameIndex], blk, m_udpBlockSize);
+    m_udpFilled[frameIndex] = true;
+}
+
+bool UDPSourceUDPHandler::readable()
+{
+    if (m_resyncRequested.exchange(false)) {
+        resetReadIndex();
+    }
+
+    int fill = (m_writeFrameIndex.load() - m_readFrameIndex.load() + m_nbUDPFrames) % m_nbUDPFrames;
+
+    if (m_prebuffering)
+    {
+        if (fill < m_nbUDPFrames/2) {
+            return false;
+        }
+
+        m_prebuffering = false;
+    }
+    else if (fill == 0) // underrun: wait for the buffer to refill to half its size
+    {
+        m_prebuffering = true;
+        m_underruns++;
+        return false;
+    }
+
+    return true;
+}
+
 void UDPSourceUDPHandler::readSample(qint16 &t)
 {
-    if (m_readFrameIndex == m_writeFrameIndex) // block until more writes
+    if (!readable())
     {
         t = 0;
     }
@@ -166,7 +349,7 @@ void UDPSourceUDPHandler::readSample(qint16 &t)
 
 void UDPSourceUDPHandler::readSample(AudioSample &a)
 {
-    if (m_readFrameIndex == m_writeFrameIndex) // block until more writes
+    if (!readable())
     {
         a.l = 0;
         a.r = 0;
@@ -180,7 +363,7 @@ void UDPSourceUDPHandler::readSample(AudioSample &a)
 
 void UDPSourceUDPHandler::readSample(Sample &s)
 {
-    if (m_readFrameIndex == m_writeFrameIndex) // block until more writes
+    if (!readable())
     {
         s.m_real = 0;
         s.m_imag = 0;
@@ -194,47 +377,83 @@ void UDPSourceUDPHandler::readSample(Sample &s)
 
 void UDPSourceUDPHandler::advanceReadPointer(int nbBytes)
 {
-    if (m_readIndex < m_udpBlockSize - 2*nbBytes)
+    if (m_readIndex < m_udpBlockSize - nbBytes)
     {
         m_readIndex += nbBytes;
     }
     else
     {
         m_readIndex = 0;
+        m_sampleSize = nbBytes;
+        int readFrameIndex = m_readFrameIndex.load();
 
-        if (m_readFrameIndex < m_nbUDPFrames - 1)
-        {
-            m_readFrameIndex++;
+        if (readFrameIndex < m_nbUDPFrames - 1) {
+            m_readFrameIndex = readFrameIndex + 1;
+        } else {
+            m_readFrameIndex = 0;
         }
-        else
-        {
-            m_rwDelta = m_writeFrameIndex; // raw R/W delta estimate
-            int nbUDPFrames2 = m_nbUDPFrames/2;
-            float d = (m_rwDelta - nbUDPFrames2)/(float) m_nbUDPFrames;
-            //qDebug("UDPSourceUDPHandler::advanceReadPointer: w: %02d d: %f", m_writeIndex, d);
 
-            if ((d < -0.45) || (d > 0.45))
-            {
-                resetReadIndex();
-            }
-            else
-            {
-                float dd = d - m_d; // derivative
-                float c = (d / 15.0) + (dd / 20.0); // damping and scaling
-                c = c < -0.05 ? -0.05 : c > 0.05 ? 0.05 : c; // limit
-                UDPSourceMessages::MsgSampleRateCorrection *msg = UDPSourceMessages::MsgSampleRateCorrection::create(c, d);
+        updateRateControl((m_writeFrameIndex.load() - m_readFrameIndex.load() + m_nbUDPFrames) % m_nbUDPFrames);
+    }
+}
 
-                if (m_autoRWBalance && m_feedbackMessageQueue) {
-                    m_feedbackMessageQueue->push(msg);
-                }
+void UDPSourceUDPHandler::updateRateControl(int fill)
+{
+    m_rwDelta = fill;
 
-                m_readFrameIndex = 0;
-                m_d = d;
-            }
-        }
+    if (fill > m_nbUDPFrames - m_nbUDPFrames/16) // overflow: drop oldest data down to half buffer
+    {
+        qDebug("UDPSourceUDPHandler::updateRateControl: buffer overflow");
+        resetReadIndex();
+        return;
+    }
+
+    float error = (fill - m_nbUDPFrames/2) / (float) m_nbUDPFrames;
+    m_fillError += (error - m_fillError) * fillErrorAlpha; // smooth out network jitter
+
+    if (++m_controlCounter < std::max(m_nbUDPFrames/8, 1)) {
+        return;
+    }
+
+    m_controlCounter = 0;
+
+    if (!m_autoRWBalance) {
+        return;
+    }
+
+    // PI controller: the integral term tracks the sender to receiver clock drift
+    m_integral += rateControlKi * m_fillError;
+    m_integral = m_integral < -maxRateCorrection ? -maxRateCorrection : m_integral > maxRateCorrection ? maxRateCorrection : m_integral;
+    float c = rateControlKp * m_fillError + m_integral;
+    c = c < -maxRateCorrection ? -maxRateCorrection : c > maxRateCorrection ? maxRateCorrection : c;
+    m_rateCorrection = c;
+
+    if (m_feedbackMessageQueue) {
+        m_feedbackMessageQueue->push(UDPSourceMessages::MsgSampleRateCorrection::create(c, m_fillError));
     }
 }
 
+float UDPSourceUDPHandler::getBufferDepth() const
+{
+    int fill = (m_writeFrameIndex.load() - m_readFrameIndex.load() + m_nbUDPFrames) % m_nbUDPFrames;
+    return (fill * (m_udpBlockSize / m_sampleSize) * 1000.0f) / m_sampleRate;
+}
+
+void UDPSourceUDPHandler::setAutoRWBalance(bool autoRWBalance)
+{
+    m_autoRWBalance = autoRWBalance;
+    m_integral = 0.0f;
+    m_rateCorrection = 0.0f;
+}
+
+void UDPSourceUDPHandler::resetStats()
+{
+    m_latePackets = 0;
+    m_lostPackets = 0;
+    m_underruns = 0;
+    m_droppedFrames = 0;
+}
+
 void UDPSourceUDPHandler::configureUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin)
 {
     Message* msg = MsgUDPAddressAndPort::create(address, port, multicastAddress, multicastJoin);
@@ -268,7 +487,10 @@ void UDPSourceUDPHandler::applyUDPLink(const QString& address, quint16 port, con
 
     stop();
     m_dataPort = port;
-    resetReadIndex();
+    m_udpDumpIndex = 0;
+    m_rtpSynced = false;
+    resetStats();
+    m_resyncRequested = true; // the read position belongs to the channel thread
     start();
 }
 
@@ -277,7 +499,9 @@ void UDPSourceUDPHandler::resetReadIndex()
     m_readFrameIndex = (m_writeFrameIndex + (m_nbUDPFrames/2)) % m_nbUDPFrames;
     m_rwDelta = m_nbUDPFrames/2;
     m_readIndex = 0;
-    m_d = 0.0f;
+    m_prebuffering = false;
+    m_fillError = 0.0f;
+    m_controlCounter = 0;
 }
 
 void UDPSourceUDPHandler::resizeBuffer(float sampleRate)
@@ -285,16 +509,27 @@ void UDPSourceUDPHandler::resizeBuffer(float sampleRate)
     int halfNbFrames = std::max((sampleRate / 375.0), (m_minNbUDPFrames / 2.0));
     qDebug("UDPSourceUDPHandler::resizeBuffer: nb_frames: %d", 2*halfNbFrames);
 
-    if (2*halfNbFrames > m_nbAllocatedUDPFrames)
     {
-        delete[] m_udpBuf;
-        m_udpBuf = new udpBlk_t[2*halfNbFrames];
-        m_nbAllocatedUDPFrames = 2*halfNbFrames;
-    }
+        QMutexLocker mutexLocker(&m_mutex);
 
-    m_nbUDPFrames = 2*halfNbFrames;
-    m_writeFrameIndex = 0;
+        if (2*halfNbFrames > m_nbAllocatedUDPFrames)
+        {
+            delete[] m_udpBuf;
+            m_udpBuf = new udpBlk_t[2*halfNbFrames];
+            m_nbAllocatedUDPFrames = 2*halfNbFrames;
+        }
+
+        m_udpFilled.assign(2*halfNbFrames, false);
+        m_nbUDPFrames = 2*halfNbFrames;
+        m_writeFrameIndex = 0;
+        m_udpDumpIndex = 0;
+        m_rtpSynced = false;
+    }
 
+    m_sampleRate = sampleRate;
+    m_integral = 0.0f;
+    m_rateCorrection = 0.0f;
+    resetStats();
     resetReadIndex();
 }
 
@@ -23,11 +23,25 @@
 #include <QHostAddress>
 #include <QMutex>
 #include <stdint.h>
+#include <atomic>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#endif
 
 #include "dsp/dsptypes.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 
+/**
+ * Receives the UDP stream in its own thread and stores it in a ring of fixed size frames used as a jitter buffer.
+ * On Linux the socket queue is drained by batches with recvmmsg. RTP packets (as sent by UDP Sink) are placed
+ * according to their sequence number so that reordered packets are recovered and late packets are counted.
+ * The buffer fill is regulated around half the buffer by a PI controller acting on the input sample rate.
+ * Blocks received while the buffer is full are dropped so that frames not read yet are never overwritten.
+ * The read side (samples, read position) belongs to the channel thread: the reception thread only requests a resync.
+ */
 class UDPSourceUDPHandler : public QObject
 {
     Q_OBJECT
@@ -36,7 +50,8 @@ public:
     virtual ~UDPSourceUDPHandler();
 
     void start();
-    void stop();
+    Q_INVOKABLE void stop(); //!< call it in the handler thread
+
     void configureUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin);
     void configureMulticastAddress(const QString& address);
     void resetReadIndex();
@@ -46,12 +61,12 @@ public:
     void readSample(AudioSample &a); //!< audio stereo
     void readSample(Sample &s);      //!< I/Q stream
 
-    void setAutoRWBalance(bool autoRWBalance) { m_autoRWBalance = autoRWBalance; }
+    void setAutoRWBalance(bool autoRWBalance);
     void setFeedbackMessageQueue(MessageQueue *messageQueue) { m_feedbackMessageQueue = messageQueue; }
 
     /** Get buffer gauge value in % of buffer size ([-50:50])
-     *  [-50:0] : write leads or read lags
-     *  [0:50]  : read leads or write lags
+     *  [-50:0] : buffer fill below half
+     *  [0:50]  : buffer fill above half
      */
     inline int32_t getBufferGauge() const
     {
@@ -59,8 +74,18 @@ public:
         return (100*val) / m_nbUDPFrames;
     }
 
+    float getBufferDepth() const; //!< Buffered data in milliseconds
+    uint32_t getLatePackets() const { return m_latePackets.load(); }
+    uint32_t getLostPackets() const { return m_lostPackets.load(); }
+    uint32_t getUnderruns() const { return m_underruns.load(); }
+    uint32_t getDroppedFrames() const { return m_droppedFrames.load(); } //!< blocks dropped because the buffer was full
+    float getRateCorrection() const { return m_rateCorrection.load(); } //!< Current relative input sample rate correction
+
     static const int m_udpBlockSize = 512; // UDP block size in number of bytes
     static const int m_minNbUDPFrames = 256;  // number of frames of block size in the UDP buffer
+    static const int m_maxDatagramSize = 8192; // largest datagram handled
+    static const int m_rxBatchSize = 32;       // maximum number of datagrams read at once
+    static const int m_rtpHeaderSize = 12;
 
 public slots:
     void dataReadyRead();
@@ -97,8 +122,17 @@ private:
 
     typedef char (udpBlk_t)[m_udpBlockSize];
 
-    void moveData(char *blk);
+    void processDatagram(const char *data, int size);
+    void processRTP(const char *data, int size);
+    void moveData(const char *blk);
+    void insertData(const char *blk, int framesBack);
+    bool readable();
     void advanceReadPointer(int nbBytes);
+    void updateRateControl(int fill);
+    void resetStats();
+#if defined(__linux__)
+    void readBatch();
+#endif
     void applyUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool muticastJoin);
     bool handleMessage(const Message& message);
 
@@ -111,16 +145,36 @@ private:
     bool m_dataConnected;
     bool m_multicast;
     udpBlk_t *m_udpBuf;
-    char m_udpDump[m_udpBlockSize + 8192]; // UDP block size + largest possible block
+    std::vector<bool> m_udpFilled; //!< frame holds received data (false for lost packet placeholders)
+    char m_udpDump[m_udpBlockSize + m_maxDatagramSize]; // UDP block size + largest possible block
     int m_udpDumpIndex;
+    std::vector<char> m_rxBuffer;  //!< datagrams read by batch
+#if defined(__linux__)
+    struct mmsghdr m_rxMsgs[m_rxBatchSize];
+    struct iovec m_rxIovecs[m_rxBatchSize];
+#endif
     int m_nbUDPFrames;
     int m_nbAllocatedUDPFrames;
-    int m_writeFrameIndex;
-    int m_readFrameIndex;
+    std::atomic<int> m_writeFrameIndex;
+    std::atomic<int> m_readFrameIndex;
     int m_readIndex;
     int m_rwDelta;
-    float m_d;
+    int m_sampleSize;       //!< size in bytes of the last sample read
+    float m_sampleRate;     //!< nominal input sample rate
+    bool m_prebuffering;    //!< refilling to half buffer after an underrun
+    bool m_rtpSynced;
+    uint16_t m_nextSequence; //!< next expected RTP sequence number
+    float m_fillError;      //!< smoothed buffer fill error relative to buffer size
+    float m_integral;       //!< rate controller integral term
+    int m_controlCounter;
+    std::atomic<float> m_rateCorrection;
+    std::atomic<uint32_t> m_latePackets;
+    std::atomic<uint32_t> m_lostPackets;
+    std::atomic<uint32_t> m_underruns;
+    std::atomic<uint32_t> m_droppedFrames;
+    std::atomic<bool> m_resyncRequested; //!< reset the read position on next read
     bool m_autoRWBalance;
+    QMutex m_mutex;
     MessageQueue *m_feedbackMessageQueue;
     MessageQueue m_inputMessageQueue;
 
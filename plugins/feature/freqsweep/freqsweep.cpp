@@ -0,0 +1,578 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QBuffer>
+
+#include "SWGFeatureSettings.h"
+#include "SWGFeatureReport.h"
+#include "SWGFeatureActions.h"
+#include "SWGFreqSweepReport.h"
+#include "SWGDeviceState.h"
+
+#include "freqsweepworker.h"
+#include "freqsweep.h"
+
+MESSAGE_CLASS_DEFINITION(FreqSweep::MsgConfigureFreqSweep, Message)
+MESSAGE_CLASS_DEFINITION(FreqSweep::MsgStartStop, Message)
+MESSAGE_CLASS_DEFINITION(FreqSweep::MsgStartSweep, Message)
+
+const QString FreqSweep::m_featureIdURI = "sdrangel.feature.freqsweep";
+const QString FreqSweep::m_featureId = "FreqSweep";
+
+FreqSweep::FreqSweep(WebAPIAdapterInterface *webAPIAdapterInterface) :
+    Feature(m_featureIdURI, webAPIAdapterInterface),
+    m_sweeping(false)
+{
+    setObjectName(m_featureId);
+    m_worker = new FreqSweepWorker(webAPIAdapterInterface);
+    m_state = StIdle;
+    m_errorMessage = "FreqSweep error";
+    m_networkManager = new QNetworkAccessManager();
+    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
+}
+
+FreqSweep::~FreqSweep()
+{
+    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
+    delete m_networkManager;
+
+    if (m_worker->isRunning()) {
+        stop();
+    }
+
+    delete m_worker;
+}
+
+void FreqSweep::start()
+{
+	qDebug("FreqSweep::start");
+
+    m_worker->reset();
+    m_worker->setMessageQueueToGUI(getMessageQueueToGUI());
+    m_worker->setMessageQueueToFeature(getInputMessageQueue());
+    bool ok = m_worker->startWork();
+    m_state = ok ? StRunning : StError;
+    m_thread.start();
+
+    // forced settings start a sweep
+    FreqSweepWorker::MsgConfigureFreqSweepWorker *msg = FreqSweepWorker::MsgConfigureFreqSweepWorker::create(m_settings, true);
+    m_worker->getInputMessageQueue()->push(msg);
+}
+
+void FreqSweep::stop()
+{
+    qDebug("FreqSweep::stop");
+	m_worker->stopWork();
+    m_state = StIdle;
+	m_thread.quit();
+	m_thread.wait();
+    QMutexLocker mutexLocker(&m_resultMutex);
+    m_sweeping = false;
+}
+
+bool FreqSweep::handleMessage(const Message& cmd)
+{
+	if (MsgConfigureFreqSweep::match(cmd))
+	{
+        MsgConfigureFreqSweep& cfg = (MsgConfigureFreqSweep&) cmd;
+        qDebug() << "FreqSweep::handleMessage: MsgConfigureFreqSweep";
+        applySettings(cfg.getSettings(), cfg.getForce());
+
+		return true;
+	}
+    else if (MsgStartStop::match(cmd))
+    {
+        MsgStartStop& cfg = (MsgStartStop&) cmd;
+        qDebug() << "FreqSweep::handleMessage: MsgStartStop: start:" << cfg.getStartStop();
+
+        if (cfg.getStartStop()) {
+            start();
+        } else {
+            stop();
+        }
+
+        return true;
+    }
+    else if (MsgStartSweep::match(cmd))
+    {
+        qDebug() << "FreqSweep::handleMessage: MsgStartSweep";
+        FreqSweepWorker::MsgStartSweep *msg = FreqSweepWorker::MsgStartSweep::create();
+        m_worker->getInputMessageQueue()->push(msg);
+
+        return true;
+    }
+    else if (FreqSweepReport::MsgSweepDone::match(cmd))
+    {
+        FreqSweepReport::MsgSweepDone& report = (FreqSweepReport::MsgSweepDone&) cmd;
+        QMutexLocker mutexLocker(&m_resultMutex);
+        m_sweepResult = report.getResult();
+
+        return true;
+    }
+    else if (FreqSweepReport::MsgSweepStatus::match(cmd))
+    {
+        FreqSweepReport::MsgSweepStatus& report = (FreqSweepReport::MsgSweepStatus&) cmd;
+        QMutexLocker mutexLocker(&m_resultMutex);
+        m_sweeping = report.getSweeping();
+        m_sweepErrorMessage = report.getErrorMessage();
+
+        return true;
+    }
+	else
+	{
+		return false;
+	}
+}
+
+QByteArray FreqSweep::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool FreqSweep::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        MsgConfigureFreqSweep *msg = MsgConfigureFreqSweep::create(m_settings, true);
+        m_inputMessageQueue.push(msg);
+        return true;
+    }
+    else
+    {
+        m_settings.resetToDefaults();
+        MsgConfigureFreqSweep *msg = MsgConfigureFreqSweep::create(m_settings, true);
+        m_inputMessageQueue.push(msg);
+        return false;
+    }
+}
+
+void FreqSweep::applySettings(const FreqSweepSettings& settings, bool force)
+{
+    qDebug() << "FreqSweep::applySettings:"
+            << " m_title: " << settings.m_title
+            << " m_rgbColor: " << settings.m_rgbColor
+            << " m_deviceSetIndex: " << settings.m_deviceSetIndex
+            << " m_startFrequency: " << settings.m_startFrequency
+            << " m_stopFrequency: " << settings.m_stopFrequency
+            << " m_fftSize: " << settings.m_fftSize
+            << " m_usableBandwidthRatio: " << settings.m_usableBandwidthRatio
+            << " m_fftAveraging: " << settings.m_fftAveraging
+            << " m_discardBlocks: " << settings.m_discardBlocks
+            << " m_settleTimeUs: " << settings.m_settleTimeUs
+            << " m_settleTimeoutMs: " << settings.m_settleTimeoutMs
+            << " m_continuous: " << settings.m_continuous
+            << " m_useWebSocket: " << settings.m_useWebSocket
+            << " m_webSocketAddress: " << settings.m_webSocketAddress
+            << " m_webSocketPort: " << settings.m_webSocketPort
+            << " force: " << force;
+
+    QList<QString> reverseAPIKeys;
+
+    if ((m_settings.m_title != settings.m_title) || force) {
+        reverseAPIKeys.append("title");
+    }
+    if ((m_settings.m_rgbColor != settings.m_rgbColor) || force) {
+        reverseAPIKeys.append("rgbColor");
+    }
+    if ((m_settings.m_deviceSetIndex != settings.m_deviceSetIndex) || force) {
+        reverseAPIKeys.append("deviceSetIndex");
+    }
+    if ((m_settings.m_startFrequency != settings.m_startFrequency) || force) {
+        reverseAPIKeys.append("startFrequency");
+    }
+    if ((m_settings.m_stopFrequency != settings.m_stopFrequency) || force) {
+        reverseAPIKeys.append("stopFrequency");
+    }
+    if ((m_settings.m_fftSize != settings.m_fftSize) || force) {
+        reverseAPIKeys.append("fftSize");
+    }
+    if ((m_settings.m_usableBandwidthRatio != settings.m_usableBandwidthRatio) || force) {
+        reverseAPIKeys.append("usableBandwidthRatio");
+    }
+    if ((m_settings.m_fftAveraging != settings.m_fftAveraging) || force) {
+        reverseAPIKeys.append("fftAveraging");
+    }
+    if ((m_settings.m_discardBlocks != settings.m_discardBlocks) || force) {
+        reverseAPIKeys.append("discardBlocks");
+    }
+    if ((m_settings.m_settleTimeUs != settings.m_settleTimeUs) || force) {
+        reverseAPIKeys.append("settleTimeUs");
+    }
+    if ((m_settings.m_settleTimeoutMs != settings.m_settleTimeoutMs) || force) {
+        reverseAPIKeys.append("settleTimeoutMs");
+    }
+    if ((m_settings.m_continuous != settings.m_continuous) || force) {
+        reverseAPIKeys.append("continuous");
+    }
+    if ((m_settings.m_useWebSocket != settings.m_useWebSocket) || force) {
+        reverseAPIKeys.append("useWebSocket");
+    }
+    if ((m_settings.m_webSocketAddress != settings.m_webSocketAddress) || force) {
+        reverseAPIKeys.append("webSocketAddress");
+    }
+    if ((m_settings.m_webSocketPort != settings.m_webSocketPort) || force) {
+        reverseAPIKeys.append("webSocketPort");
+    }
+
+    FreqSweepWorker::MsgConfigureFreqSweepWorker *msg = FreqSweepWorker::MsgConfigureFreqSweepWorker::create(
+        settings, force
+    );
+    m_worker->getInputMessageQueue()->push(msg);
+
+    if (settings.m_useReverseAPI)
+    {
+        bool fullUpdate = ((m_settings.m_useReverseAPI != settings.m_useReverseAPI) && settings.m_useReverseAPI) ||
+                (m_settings.m_reverseAPIAddress != settings.m_reverseAPIAddress) ||
+                (m_settings.m_reverseAPIPort != settings.m_reverseAPIPort) ||
+                (m_settings.m_reverseAPIFeatureSetIndex != settings.m_reverseAPIFeatureSetIndex) ||
+                (m_settings.m_reverseAPIFeatureIndex != settings.m_reverseAPIFeatureIndex);
+        webapiReverseSendSettings(reverseAPIKeys, settings, fullUpdate || force);
+    }
+
+    m_settings = settings;
+}
+
+int FreqSweep::webapiRun(bool run,
+    SWGSDRangel::SWGDeviceState& response,
+    QString& errorMessage)
+{
+    (void) errorMessage;
+    getFeatureStateStr(*response.getState());
+    MsgStartStop *msg = MsgStartStop::create(run);
+    getInputMessageQueue()->push(msg);
+    return 202;
+}
+
+int FreqSweep::webapiSettingsGet(
+    SWGSDRangel::SWGFeatureSettings& response,
+    QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setFreqSweepSettings(new SWGSDRangel::SWGFreqSweepSettings());
+    response.getFreqSweepSettings()->init();
+    webapiFormatFeatureSettings(response, m_settings);
+    return 200;
+}
+
+int FreqSweep::webapiSettingsPutPatch(
+    bool force,
+    const QStringList& featureSettingsKeys,
+    SWGSDRangel::SWGFeatureSettings& response,
+    QString& errorMessage)
+{
+    FreqSweepSettings settings = m_settings;
+    webapiUpdateFeatureSettings(settings, featureSettingsKeys, response);
+
+    if ((settings.m_fftSize < 64) || (settings.m_fftSize > 16384) || (settings.m_fftSize % 2 != 0))
+    {
+        errorMessage = QString("FFT size %1 must be even and between 64 and 16384").arg(settings.m_fftSize);
+        return 400;
+    }
+
+    if ((settings.m_usableBandwidthRatio < 0.1f) || (settings.m_usableBandwidthRatio > 1.0f))
+    {
+        errorMessage = QString("Usable bandwidth ratio %1 must be between 0.1 and 1").arg(settings.m_usableBandwidthRatio);
+        return 400;
+    }
+
+    MsgConfigureFreqSweep *msg = MsgConfigureFreqSweep::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    qDebug("FreqSweep::webapiSettingsPutPatch: forward to GUI: %p", m_guiMessageQueue);
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureFreqSweep *msgToGUI = MsgConfigureFreqSweep::create(settings, force);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    webapiFormatFeatureSettings(response, settings);
+
+    return 200;
+}
+
+int FreqSweep::webapiReportGet(
+    SWGSDRangel::SWGFeatureReport& response,
+    QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setFreqSweepReport(new SWGSDRangel::SWGFreqSweepReport());
+    response.getFreqSweepReport()->init();
+    webapiFormatFeatureReport(response);
+    return 200;
+}
+
+int FreqSweep::webapiActionsPost(
+    const QStringList& featureActionsKeys,
+    SWGSDRangel::SWGFeatureActions& query,
+    QString& errorMessage)
+{
+    SWGSDRangel::SWGFreqSweepActions *swgFreqSweepActions = query.getFreqSweepActions();
+
+    if (swgFreqSweepActions)
+    {
+        if (featureActionsKeys.contains("sweep") && (swgFreqSweepActions->getSweep() != 0))
+        {
+            if (m_state != StRunning)
+            {
+                errorMessage = "Frequency sweep feature is not running";
+                return 400;
+            }
+
+            MsgStartSweep *msg = MsgStartSweep::create();
+            getInputMessageQueue()->push(msg);
+        }
+
+        return 202;
+    }
+    else
+    {
+        errorMessage = "Missing FreqSweepActions in query";
+        return 400;
+    }
+}
+
+void FreqSweep::webapiFormatFeatureSettings(
+    SWGSDRangel::SWGFeatureSettings& response,
+    const FreqSweepSettings& settings)
+{
+    if (response.getFreqSweepSettings()->getTitle()) {
+        *response.getFreqSweepSettings()->getTitle() = settings.m_title;
+    } else {
+        response.getFreqSweepSettings()->setTitle(new QString(settings.m_title));
+    }
+
+    response.getFreqSweepSettings()->setRgbColor(settings.m_rgbColor);
+    response.getFreqSweepSettings()->setDeviceSetIndex(settings.m_deviceSetIndex);
+    response.getFreqSweepSettings()->setStartFrequency(settings.m_startFrequency);
+    response.getFreqSweepSettings()->setStopFrequency(settings.m_stopFrequency);
+    response.getFreqSweepSettings()->setFftSize(settings.m_fftSize);
+    response.getFreqSweepSettings()->setUsableBandwidthRatio(settings.m_usableBandwidthRatio);
+    response.getFreqSweepSettings()->setFftAveraging(settings.m_fftAveraging);
+    response.getFreqSweepSettings()->setDiscardBlocks(settings.m_discardBlocks);
+    response.getFreqSweepSettings()->setSettleTimeUs(settings.m_settleTimeUs);
+    response.getFreqSweepSettings()->setSettleTimeoutMs(settings.m_settleTimeoutMs);
+    response.getFreqSweepSettings()->setContinuous(settings.m_continuous ? 1 : 0);
+    response.getFreqSweepSettings()->setUseWebSocket(settings.m_useWebSocket ? 1 : 0);
+
+    if (response.getFreqSweepSettings()->getWebSocketAddress()) {
+        *response.getFreqSweepSettings()->getWebSocketAddress() = settings.m_webSocketAddress;
+    } else {
+        response.getFreqSweepSettings()->setWebSocketAddress(new QString(settings.m_webSocketAddress));
+    }
+
+    response.getFreqSweepSettings()->setWebSocketPort(settings.m_webSocketPort);
+
+    response.getFreqSweepSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
+
+    if (response.getFreqSweepSettings()->getReverseApiAddress()) {
+        *response.getFreqSweepSettings()->getReverseApiAddress() = settings.m_reverseAPIAddress;
+    } else {
+        response.getFreqSweepSettings()->setReverseApiAddress(new QString(settings.m_reverseAPIAddress));
+    }
+
+    response.getFreqSweepSettings()->setReverseApiPort(settings.m_reverseAPIPort);
+    response.getFreqSweepSettings()->setReverseApiDeviceIndex(settings.m_reverseAPIFeatureSetIndex);
+    response.getFreqSweepSettings()->setReverseApiChannelIndex(settings.m_reverseAPIFeatureIndex);
+}
+
+void FreqSweep::webapiUpdateFeatureSettings(
+    FreqSweepSettings& settings,
+    const QStringList& featureSettingsKeys,
+    SWGSDRangel::SWGFeatureSettings& response)
+{
+    if (featureSettingsKeys.contains("title")) {
+        settings.m_title = *response.getFreqSweepSettings()->getTitle();
+    }
+    if (featureSettingsKeys.contains("rgbColor")) {
+        settings.m_rgbColor = response.getFreqSweepSettings()->getRgbColor();
+    }
+    if (featureSettingsKeys.contains("deviceSetIndex")) {
+        settings.m_deviceSetIndex = response.getFreqSweepSettings()->getDeviceSetIndex();
+    }
+    if (featureSettingsKeys.contains("startFrequency")) {
+        settings.m_startFrequency = response.getFreqSweepSettings()->getStartFrequency();
+    }
+    if (featureSettingsKeys.contains("stopFrequency")) {
+        settings.m_stopFrequency = response.getFreqSweepSettings()->getStopFrequency();
+    }
+    if (featureSettingsKeys.contains("fftSize")) {
+        settings.m_fftSize = response.getFreqSweepSettings()->getFftSize();
+    }
+    if (featureSettingsKeys.contains("usableBandwidthRatio")) {
+        settings.m_usableBandwidthRatio = response.getFreqSweepSettings()->getUsableBandwidthRatio();
+    }
+    if (featureSettingsKeys.contains("fftAveraging")) {
+        settings.m_fftAveraging = response.getFreqSweepSettings()->getFftAveraging();
+    }
+    if (featureSettingsKeys.contains("discardBlocks")) {
+        settings.m_discardBlocks = response.getFreqSweepSettings()->getDiscardBlocks();
+    }
+    if (featureSettingsKeys.contains("settleTimeUs")) {
+        settings.m_settleTimeUs = response.getFreqSweepSettings()->getSettleTimeUs();
+    }
+    if (featureSettingsKeys.contains("settleTimeoutMs")) {
+        settings.m_settleTimeoutMs = response.getFreqSweepSettings()->getSettleTimeoutMs();
+    }
+    if (featureSettingsKeys.contains("continuous")) {
+        settings.m_continuous = response.getFreqSweepSettings()->getContinuous() != 0;
+    }
+    if (featureSettingsKeys.contains("useWebSocket")) {
+        settings.m_useWebSocket = response.getFreqSweepSettings()->getUseWebSocket() != 0;
+    }
+    if (featureSettingsKeys.contains("webSocketAddress")) {
+        settings.m_webSocketAddress = *response.getFreqSweepSettings()->getWebSocketAddress();
+    }
+    if (featureSettingsKeys.contains("webSocketPort")) {
+        settings.m_webSocketPort = response.getFreqSweepSettings()->getWebSocketPort();
+    }
+    if (featureSettingsKeys.contains("useReverseAPI")) {
+        settings.m_useReverseAPI = response.getFreqSweepSettings()->getUseReverseApi() != 0;
+    }
+    if (featureSettingsKeys.contains("reverseAPIAddress")) {
+        settings.m_reverseAPIAddress = *response.getFreqSweepSettings()->getReverseApiAddress();
+    }
+    if (featureSettingsKeys.contains("reverseAPIPort")) {
+        settings.m_reverseAPIPort = response.getFreqSweepSettings()->getReverseApiPort();
+    }
+    if (featureSettingsKeys.contains("reverseAPIDeviceIndex")) {
+        settings.m_reverseAPIFeatureSetIndex = response.getFreqSweepSettings()->getReverseApiDeviceIndex();
+    }
+    if (featureSettingsKeys.contains("reverseAPIChannelIndex")) {
+        settings.m_reverseAPIFeatureIndex = response.getFreqSweepSettings()->getReverseApiChannelIndex();
+    }
+}
+
+void FreqSweep::webapiFormatFeatureReport(SWGSDRangel::SWGFeatureReport& response)
+{
+    QMutexLocker mutexLocker(&m_resultMutex);
+    SWGSDRangel::SWGFreqSweepReport *swgReport = response.getFreqSweepReport();
+    swgReport->setSweeping(m_sweeping ? 1 : 0);
+    *swgReport->getErrorMessage() = m_sweepErrorMessage;
+    swgReport->setSweepCount(m_sweepResult.m_sweepCount);
+    swgReport->setStartFrequency(m_sweepResult.m_startFrequency);
+    swgReport->setBinWidth(m_sweepResult.m_binWidth);
+    swgReport->setNbSteps(m_sweepResult.m_nbSteps);
+    swgReport->setSweepDurationMs(m_sweepResult.m_durationUs / 1000.0f);
+    swgReport->setSweepRate(m_sweepResult.m_sweepRate);
+    swgReport->setRetuneLatencyUs(m_sweepResult.m_averageRetuneLatencyUs);
+    swgReport->setTransientBlocks(m_sweepResult.m_transientBlocks);
+    QList<float> *power = swgReport->getPower();
+    power->reserve(m_sweepResult.m_powerDb.size());
+
+    for (float powerDb : m_sweepResult.m_powerDb) {
+        power->append(powerDb);
+    }
+}
+
+void FreqSweep::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const FreqSweepSettings& settings, bool force)
+{
+    SWGSDRangel::SWGFeatureSettings *swgFeatureSettings = new SWGSDRangel::SWGFeatureSettings();
+    swgFeatureSettings->setFeatureType(new QString("FreqSweep"));
+    swgFeatureSettings->setFreqSweepSettings(new SWGSDRangel::SWGFreqSweepSettings());
+    SWGSDRangel::SWGFreqSweepSettings *swgFreqSweepSettings = swgFeatureSettings->getFreqSweepSettings();
+
+    // transfer data that has been modified. When force is on transfer all data except reverse API data
+
+    if (channelSettingsKeys.contains("title") || force) {
+        swgFreqSweepSettings->setTitle(new QString(settings.m_title));
+    }
+    if (channelSettingsKeys.contains("rgbColor") || force) {
+        swgFreqSweepSettings->setRgbColor(settings.m_rgbColor);
+    }
+    if (channelSettingsKeys.contains("deviceSetIndex") || force) {
+        swgFreqSweepSettings->setDeviceSetIndex(settings.m_deviceSetIndex);
+    }
+    if (channelSettingsKeys.contains("startFrequency") || force) {
+        swgFreqSweepSettings->setStartFrequency(settings.m_startFrequency);
+    }
+    if (channelSettingsKeys.contains("stopFrequency") || force) {
+        swgFreqSweepSettings->setStopFrequency(settings.m_stopFrequency);
+    }
+    if (channelSettingsKeys.contains("fftSize") || force) {
+        swgFreqSweepSettings->setFftSize(settings.m_fftSize);
+    }
+    if (channelSettingsKeys.contains("usableBandwidthRatio") || force) {
+        swgFreqSweepSettings->setUsableBandwidthRatio(settings.m_usableBandwidthRatio);
+    }
+    if (channelSettingsKeys.contains("fftAveraging") || force) {
+        swgFreqSweepSettings->setFftAveraging(settings.m_fftAveraging);
+    }
+    if (channelSettingsKeys.contains("discardBlocks") || force) {
+        swgFreqSweepSettings->setDiscardBlocks(settings.m_discardBlocks);
+    }
+    if (channelSettingsKeys.contains("settleTimeUs") || force) {
+        swgFreqSweepSettings->setSettleTimeUs(settings.m_settleTimeUs);
+    }
+    if (channelSettingsKeys.contains("settleTimeoutMs") || force) {
+        swgFreqSweepSettings->setSettleTimeoutMs(settings.m_settleTimeoutMs);
+    }
+    if (channelSettingsKeys.contains("continuous") || force) {
+        swgFreqSweepSettings->setContinuous(settings.m_continuous ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("useWebSocket") || force) {
+        swgFreqSweepSettings->setUseWebSocket(settings.m_useWebSocket ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("webSocketAddress") || force) {
+        swgFreqSweepSettings->setWebSocketAddress(new QString(settings.m_webSocketAddress));
+    }
+    if (channelSettingsKeys.contains("webSocketPort") || force) {
+        swgFreqSweepSettings->setWebSocketPort(settings.m_webSocketPort);
+    }
+
+    QString channelSettingsURL = QString("http://%1:%2/sdrangel/featureset/%3/feature/%4/settings")
+            .arg(settings.m_reverseAPIAddress)
+            .arg(settings.m_reverseAPIPort)
+            .arg(settings.m_reverseAPIFeatureSetIndex)
+            .arg(settings.m_reverseAPIFeatureIndex);
+    m_networkRequest.setUrl(QUrl(channelSettingsURL));
+    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+
+    QBuffer *buffer = new QBuffer();
+    buffer->open((QBuffer::ReadWrite));
+    buffer->write(swgFeatureSettings->asJson().toUtf8());
+    buffer->seek(0);
+
+    // Always use PATCH to avoid passing reverse API settings
+    QNetworkReply *reply = m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    buffer->setParent(reply);
+
+    delete swgFeatureSettings;
+}
+
+void FreqSweep::networkManagerFinished(QNetworkReply *reply)
+{
+    QNetworkReply::NetworkError replyError = reply->error();
+
+    if (replyError)
+    {
+        qWarning() << "FreqSweep::networkManagerFinished:"
+                << " error(" << (int) replyError
+                << "): " << replyError
+                << ": " << reply->errorString();
+    }
+    else
+    {
+        QString answer = reply->readAll();
+        answer.chop(1); // remove last \n
+        qDebug("FreqSweep::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
+    }
+
+    reply->deleteLater();
+}
@@ -0,0 +1,169 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FEATURE_FREQSWEEP_H_
+#define INCLUDE_FEATURE_FREQSWEEP_H_
+
+#include <QThread>
+#include <QMutex>
+#include <QNetworkRequest>
+
+#include "feature/feature.h"
+#include "util/message.h"
+
+#include "freqsweepsettings.h"
+#include "freqsweepreport.h"
+
+class WebAPIAdapterInterface;
+class FreqSweepWorker;
+class QNetworkAccessManager;
+class QNetworkReply;
+
+namespace SWGSDRangel {
+    class SWGDeviceState;
+}
+
+class FreqSweep : public Feature
+{
+	Q_OBJECT
+public:
+    class MsgConfigureFreqSweep : public Message {
+        MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFreqSweep)
+
+    public:
+        const FreqSweepSettings& getSettings() const { return m_settings; }
+        bool getForce() const { return m_force; }
+
+        static MsgConfigureFreqSweep* create(const FreqSweepSettings& settings, bool force) {
+            return new MsgConfigureFreqSweep(settings, force);
+        }
+
+    private:
+        FreqSweepSettings m_settings;
+        bool m_force;
+
+        MsgConfigureFreqSweep(const FreqSweepSettings& settings, bool force) :
+            Message(),
+            m_settings(settings),
+            m_force(force)
+        { }
+    };
+
+    class MsgStartStop : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        bool getStartStop() const { return m_startStop; }
+
+        static MsgStartStop* create(bool startStop) {
+            return new MsgStartStop(startStop);
+        }
+
+    protected:
+        bool m_startStop;
+
+        MsgStartStop(bool startStop) :
+            Message(),
+            m_startStop(startStop)
+        { }
+    };
+
+    class MsgStartSweep : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        static MsgStartSweep* create() {
+            return new MsgStartSweep();
+        }
+
+    private:
+        MsgStartSweep() :
+            Message()
+        { }
+    };
+
+    FreqSweep(WebAPIAdapterInterface *webAPIAdapterInterface);
+    virtual ~FreqSweep();
+    virtual void destroy() { delete this; }
+    virtual bool handleMessage(const Message& cmd);
+
+    virtual const QString& getURI() const { return m_featureIdURI; }
+    virtual void getIdentifier(QString& id) const { id = m_featureId; }
+    virtual void getTitle(QString& title) const { title = m_settings.m_title; }
+
+    virtual QByteArray serialize() const;
+    virtual bool deserialize(const QByteArray& data);
+
+    virtual int webapiRun(bool run,
+            SWGSDRangel::SWGDeviceState& response,
+            QString& errorMessage);
+
+    virtual int webapiSettingsGet(
+            SWGSDRangel::SWGFeatureSettings& response,
+            QString& errorMessage);
+
+    virtual int webapiSettingsPutPatch(
+            bool force,
+            const QStringList& featureSettingsKeys,
+            SWGSDRangel::SWGFeatureSettings& response,
+            QString& errorMessage);
+
+    virtual int webapiReportGet(
+            SWGSDRangel::SWGFeatureReport& response,
+            QString& errorMessage);
+
+    virtual int webapiActionsPost(
+            const QStringList& featureActionsKeys,
+            SWGSDRangel::SWGFeatureActions& query,
+            QString& errorMessage);
+
+    static void webapiFormatFeatureSettings(
+        SWGSDRangel::SWGFeatureSettings& response,
+        const FreqSweepSettings& settings);
+
+    static void webapiUpdateFeatureSettings(
+            FreqSweepSettings& settings,
+            const QStringList& featureSettingsKeys,
+            SWGSDRangel::SWGFeatureSettings& response);
+
+    static const QString m_featureIdURI;
+    static const QString m_featureId;
+
+private:
+    QThread m_thread;
+    FreqSweepWorker *m_worker;
+    FreqSweepSettings m_settings;
+    FreqSweepReport::SweepResult m_sweepResult; //!< last complete sweep
+    bool m_sweeping;
+    QString m_sweepErrorMessage;
+    QMutex m_resultMutex; //!< the report can be requested from the API threads
+
+    QNetworkAccessManager *m_networkManager;
+    QNetworkRequest m_networkRequest;
+
+    void start();
+    void stop();
+    void applySettings(const FreqSweepSettings& settings, bool force = false);
+    void webapiFormatFeatureReport(SWGSDRangel::SWGFeatureReport& response);
+    void webapiReverseSendSettings(QList<QString>& featureSettingsKeys, const FreqSweepSettings& settings, bool force);
+
+private slots:
+    void networkManagerFinished(QNetworkReply *reply);
+};
+
+#endif // INCLUDE_FEATURE_FREQSWEEP_H_
@@ -0,0 +1,412 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include <QMessageBox>
+
+#include "feature/featureuiset.h"
+#include "gui/basicfeaturesettingsdialog.h"
+#include "mainwindow.h"
+#include "device/deviceuiset.h"
+
+#include "ui_freqsweepgui.h"
+#include "freqsweepreport.h"
+#include "freqsweep.h"
+#include "freqsweepgui.h"
+
+FreqSweepGUI* FreqSweepGUI::create(PluginAPI* pluginAPI, FeatureUISet *featureUISet, Feature *feature)
+{
+	FreqSweepGUI* gui = new FreqSweepGUI(pluginAPI, featureUISet, feature);
+	return gui;
+}
+
+void FreqSweepGUI::destroy()
+{
+	delete this;
+}
+
+void FreqSweepGUI::resetToDefaults()
+{
+    m_settings.resetToDefaults();
+    displaySettings();
+	applySettings(true);
+}
+
+QByteArray FreqSweepGUI::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool FreqSweepGUI::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        displaySettings();
+        applySettings(true);
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+bool FreqSweepGUI::handleMessage(const Message& message)
+{
+    if (FreqSweep::MsgConfigureFreqSweep::match(message))
+    {
+        qDebug("FreqSweepGUI::handleMessage: FreqSweep::MsgConfigureFreqSweep");
+        const FreqSweep::MsgConfigureFreqSweep& cfg = (FreqSweep::MsgConfigureFreqSweep&) message;
+        m_settings = cfg.getSettings();
+        blockApplySettings(true);
+        displaySettings();
+        blockApplySettings(false);
+
+        return true;
+    }
+    else if (FreqSweepReport::MsgSweepDone::match(message))
+    {
+        const FreqSweepReport::MsgSweepDone& report = (FreqSweepReport::MsgSweepDone&) message;
+        const FreqSweepReport::SweepResult& result = report.getResult();
+        ui->sweepRate->setText(tr("%1 MHz/s").arg(result.m_sweepRate, 0, 'f', 1));
+        ui->sweepDuration->setText(tr("%1 ms").arg(result.m_durationUs / 1000));
+        ui->sweepDuration->setToolTip(tr("Sweep %1: %2 steps in %3 ms, retune latency %4 us, %5 transient blocks")
+            .arg(result.m_sweepCount)
+            .arg(result.m_nbSteps)
+            .arg(result.m_durationUs / 1000)
+            .arg(result.m_averageRetuneLatencyUs, 0, 'f', 0)
+            .arg(result.m_transientBlocks));
+
+        return true;
+    }
+    else if (FreqSweepReport::MsgSweepStatus::match(message))
+    {
+        qDebug("FreqSweepGUI::handleMessage: FreqSweepReport::MsgSweepStatus");
+        const FreqSweepReport::MsgSweepStatus& report = (FreqSweepReport::MsgSweepStatus&) message;
+
+        if (!report.getErrorMessage().isEmpty())
+        {
+            ui->statusIndicator->setStyleSheet("QLabel { background-color: rgb(232, 85, 85); border-radius: 12px; }");
+            ui->statusIndicator->setToolTip(report.getErrorMessage());
+        }
+        else if (report.getSweeping())
+        {
+            ui->statusIndicator->setStyleSheet("QLabel { background-color: rgb(85, 232, 85); border-radius: 12px; }");
+            ui->statusIndicator->setToolTip("Sweeping");
+        }
+        else
+        {
+            ui->statusIndicator->setStyleSheet("QLabel { background-color: gray; border-radius: 12px; }");
+            ui->statusIndicator->setToolTip("Idle");
+        }
+
+        return true;
+    }
+
+	return false;
+}
+
+void FreqSweepGUI::handleInputMessages()
+{
+    Message* message;
+
+    while ((message = getInputMessageQueue()->pop()))
+    {
+        if (handleMessage(*message)) {
+            delete message;
+        }
+    }
+}
+
+void FreqSweepGUI::onWidgetRolled(QWidget* widget, bool rollDown)
+{
+    (void) widget;
+    (void) rollDown;
+}
+
+FreqSweepGUI::FreqSweepGUI(PluginAPI* pluginAPI, FeatureUISet *featureUISet, Feature *feature, QWidget* parent) :
+	FeatureGUI(parent),
+	ui(new Ui::FreqSweepGUI),
+	m_pluginAPI(pluginAPI),
+    m_featureUISet(featureUISet),
+	m_doApplySettings(true),
+    m_lastFeatureState(0)
+{
+	ui->setupUi(this);
+	setAttribute(Qt::WA_DeleteOnClose, true);
+    setChannelWidget(false);
+	connect(this, SIGNAL(widgetRolled(QWidget*,bool)), this, SLOT(onWidgetRolled(QWidget*,bool)));
+    m_freqSweep = reinterpret_cast<FreqSweep*>(feature);
+    m_freqSweep->setMessageQueueToGUI(&m_inputMessageQueue);
+
+	m_featureUISet->addRollupWidget(this);
+
+    connect(this, SIGNAL(customContextMenuRequested(const QPoint &)), this, SLOT(onMenuDialogCalled(const QPoint &)));
+    connect(getInputMessageQueue(), SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+
+	connect(&m_statusTimer, SIGNAL(timeout()), this, SLOT(updateStatus()));
+	m_statusTimer.start(1000);
+
+    updateDeviceSetList();
+    displaySettings();
+	applySettings(true);
+}
+
+FreqSweepGUI::~FreqSweepGUI()
+{
+	delete ui;
+}
+
+void FreqSweepGUI::blockApplySettings(bool block)
+{
+    m_doApplySettings = !block;
+}
+
+void FreqSweepGUI::displaySettings()
+{
+    setTitleColor(m_settings.m_rgbColor);
+    setWindowTitle(m_settings.m_title);
+    blockApplySettings(true);
+    int fftSizeIndex = 0;
+
+    for (unsigned int fftSize = 256; (fftSize < m_settings.m_fftSize) && (fftSizeIndex < ui->fftSize->count() - 1); fftSize <<= 1) {
+        fftSizeIndex++;
+    }
+
+    ui->fftSize->setCurrentIndex(fftSizeIndex);
+    ui->fftAveraging->setValue(m_settings.m_fftAveraging);
+    ui->startFrequency->setValue(m_settings.m_startFrequency / 1000);
+    ui->stopFrequency->setValue(m_settings.m_stopFrequency / 1000);
+    ui->usableBandwidth->setValue(roundf(m_settings.m_usableBandwidthRatio * 100.0f));
+    ui->discardBlocks->setValue(m_settings.m_discardBlocks);
+    ui->settleTime->setValue(m_settings.m_settleTimeUs);
+    ui->continuous->setChecked(m_settings.m_continuous);
+    ui->useWebSocket->setChecked(m_settings.m_useWebSocket);
+    ui->webSocketPort->setValue(m_settings.m_webSocketPort);
+    blockApplySettings(false);
+}
+
+void FreqSweepGUI::updateDeviceSetList()
+{
+    MainWindow *mainWindow = MainWindow::getInstance();
+    std::vector<DeviceUISet*>& deviceUISets = mainWindow->getDeviceUISets();
+    std::vector<DeviceUISet*>::const_iterator it = deviceUISets.begin();
+
+    ui->device->blockSignals(true);
+    ui->device->clear();
+    unsigned int deviceIndex = 0;
+
+    for (; it != deviceUISets.end(); ++it, deviceIndex++)
+    {
+        if ((*it)->m_deviceSourceEngine) {
+            ui->device->addItem(QString("R%1").arg(deviceIndex), deviceIndex);
+        }
+    }
+
+    int newDeviceIndex;
+
+    if (ui->device->count() > 0)
+    {
+        int comboIndex = ui->device->findData(m_settings.m_deviceSetIndex);
+        ui->device->setCurrentIndex(comboIndex < 0 ? 0 : comboIndex);
+        newDeviceIndex = ui->device->currentData().toInt();
+    }
+    else
+    {
+        newDeviceIndex = -1;
+    }
+
+    if (newDeviceIndex != m_settings.m_deviceSetIndex)
+    {
+        qDebug("FreqSweepGUI::updateDeviceSetList: device index changed: %d", newDeviceIndex);
+        m_settings.m_deviceSetIndex = newDeviceIndex;
+        applySettings();
+    }
+
+    ui->device->blockSignals(false);
+}
+
+void FreqSweepGUI::leaveEvent(QEvent*)
+{
+}
+
+void FreqSweepGUI::enterEvent(QEvent*)
+{
+}
+
+void FreqSweepGUI::onMenuDialogCalled(const QPoint &p)
+{
+    if (m_contextMenuType == ContextMenuChannelSettings)
+    {
+        BasicFeatureSettingsDialog dialog(this);
+        dialog.setTitle(m_settings.m_title);
+        dialog.setColor(m_settings.m_rgbColor);
+        dialog.setUseReverseAPI(m_settings.m_useReverseAPI);
+        dialog.setReverseAPIAddress(m_settings.m_reverseAPIAddress);
+        dialog.setReverseAPIPort(m_settings.m_reverseAPIPort);
+        dialog.setReverseAPIFeatureSetIndex(m_settings.m_reverseAPIFeatureSetIndex);
+        dialog.setReverseAPIFeatureIndex(m_settings.m_reverseAPIFeatureIndex);
+
+        dialog.move(p);
+        dialog.exec();
+
+        m_settings.m_rgbColor = dialog.getColor().rgb();
+        m_settings.m_title = dialog.getTitle();
+        m_settings.m_useReverseAPI = dialog.useReverseAPI();
+        m_settings.m_reverseAPIAddress = dialog.getReverseAPIAddress();
+        m_settings.m_reverseAPIPort = dialog.getReverseAPIPort();
+        m_settings.m_reverseAPIFeatureSetIndex = dialog.getReverseAPIFeatureSetIndex();
+        m_settings.m_reverseAPIFeatureIndex = dialog.getReverseAPIFeatureIndex();
+
+        setWindowTitle(m_settings.m_title);
+        setTitleColor(m_settings.m_rgbColor);
+
+        applySettings();
+    }
+
+    resetContextMenuType();
+}
+
+void FreqSweepGUI::on_startStop_toggled(bool checked)
+{
+    if (m_doApplySettings)
+    {
+        FreqSweep::MsgStartStop *message = FreqSweep::MsgStartStop::create(checked);
+        m_freqSweep->getInputMessageQueue()->push(message);
+    }
+}
+
+void FreqSweepGUI::on_sweep_clicked()
+{
+    FreqSweep::MsgStartSweep *message = FreqSweep::MsgStartSweep::create();
+    m_freqSweep->getInputMessageQueue()->push(message);
+}
+
+void FreqSweepGUI::on_continuous_toggled(bool checked)
+{
+    m_settings.m_continuous = checked;
+    applySettings();
+}
+
+void FreqSweepGUI::on_devicesRefresh_clicked()
+{
+    updateDeviceSetList();
+    displaySettings();
+}
+
+void FreqSweepGUI::on_device_currentIndexChanged(int index)
+{
+    if (index >= 0)
+    {
+        m_settings.m_deviceSetIndex = ui->device->currentData().toInt();
+        applySettings();
+    }
+}
+
+void FreqSweepGUI::on_fftSize_currentIndexChanged(int index)
+{
+    m_settings.m_fftSize = 256U << index;
+    applySettings();
+}
+
+void FreqSweepGUI::on_fftAveraging_valueChanged(int value)
+{
+    m_settings.m_fftAveraging = value;
+    applySettings();
+}
+
+void FreqSweepGUI::on_startFrequency_valueChanged(int value)
+{
+    m_settings.m_startFrequency = value * 1000LL;
+    applySettings();
+}
+
+void FreqSweepGUI::on_stopFrequency_valueChanged(int value)
+{
+    m_settings.m_stopFrequency = value * 1000LL;
+    applySettings();
+}
+
+void FreqSweepGUI::on_usableBandwidth_valueChanged(int value)
+{
+    m_settings.m_usableBandwidthRatio = value / 100.0f;
+    applySettings();
+}
+
+void FreqSweepGUI::on_discardBlocks_valueChanged(int value)
+{
+    m_settings.m_discardBlocks = value;
+    applySettings();
+}
+
+void FreqSweepGUI::on_settleTime_valueChanged(int value)
+{
+    m_settings.m_settleTimeUs = value;
+    applySettings();
+}
+
+void FreqSweepGUI::on_useWebSocket_toggled(bool checked)
+{
+    m_settings.m_useWebSocket = checked;
+    applySettings();
+}
+
+void FreqSweepGUI::on_webSocketPort_valueChanged(int value)
+{
+    m_settings.m_webSocketPort = value;
+    applySettings();
+}
+
+void FreqSweepGUI::updateStatus()
+{
+    int state = m_freqSweep->getState();
+
+    if (m_lastFeatureState != state)
+    {
+        switch (state)
+        {
+            case Feature::StNotStarted:
+                ui->startStop->setStyleSheet("QToolButton { background:rgb(79,79,79); }");
+                break;
+            case Feature::StIdle:
+                ui->startStop->setStyleSheet("QToolButton { background-color : blue; }");
+                break;
+            case Feature::StRunning:
+                ui->startStop->setStyleSheet("QToolButton { background-color : green; }");
+                break;
+            case Feature::StError:
+                ui->startStop->setStyleSheet("QToolButton { background-color : red; }");
+                QMessageBox::information(this, tr("Message"), m_freqSweep->getErrorMessage());
+                break;
+            default:
+                break;
+        }
+
+        m_lastFeatureState = state;
+    }
+}
+
+void FreqSweepGUI::applySettings(bool force)
+{
+	if (m_doApplySettings)
+	{
+	    FreqSweep::MsgConfigureFreqSweep* message = FreqSweep::MsgConfigureFreqSweep::create( m_settings, force);
+	    m_freqSweep->getInputMessageQueue()->push(message);
+	}
+}
@@ -0,0 +1,92 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FEATURE_FREQSWEEPGUI_H_
+#define INCLUDE_FEATURE_FREQSWEEPGUI_H_
+
+#include <QTimer>
+
+#include "feature/featuregui.h"
+#include "util/messagequeue.h"
+#include "freqsweepsettings.h"
+
+class PluginAPI;
+class FeatureUISet;
+class FreqSweep;
+
+namespace Ui {
+	class FreqSweepGUI;
+}
+
+class FreqSweepGUI : public FeatureGUI {
+	Q_OBJECT
+public:
+	static FreqSweepGUI* create(PluginAPI* pluginAPI, FeatureUISet *featureUISet, Feature *feature);
+	virtual void destroy();
+
+	void resetToDefaults();
+	QByteArray serialize() const;
+	bool deserialize(const QByteArray& data);
+	virtual MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
+
+private:
+	Ui::FreqSweepGUI* ui;
+	PluginAPI* m_pluginAPI;
+	FeatureUISet* m_featureUISet;
+	FreqSweepSettings m_settings;
+	bool m_doApplySettings;
+
+	FreqSweep* m_freqSweep;
+	MessageQueue m_inputMessageQueue;
+	QTimer m_statusTimer;
+	int m_lastFeatureState;
+
+	explicit FreqSweepGUI(PluginAPI* pluginAPI, FeatureUISet *featureUISet, Feature *feature, QWidget* parent = nullptr);
+	virtual ~FreqSweepGUI();
+
+    void blockApplySettings(bool block);
+	void applySettings(bool force = false);
+	void displaySettings();
+    void updateDeviceSetList();
+	bool handleMessage(const Message& message);
+
+	void leaveEvent(QEvent*);
+	void enterEvent(QEvent*);
+
+private slots:
+	void onMenuDialogCalled(const QPoint &p);
+	void onWidgetRolled(QWidget* widget, bool rollDown);
+    void handleInputMessages();
+	void on_startStop_toggled(bool checked);
+	void on_sweep_clicked();
+	void on_continuous_toggled(bool checked);
+	void on_devicesRefresh_clicked();
+	void on_device_currentIndexChanged(int index);
+	void on_fftSize_currentIndexChanged(int index);
+	void on_fftAveraging_valueChanged(int value);
+	void on_startFrequency_valueChanged(int value);
+	void on_stopFrequency_valueChanged(int value);
+	void on_usableBandwidth_valueChanged(int value);
+	void on_discardBlocks_valueChanged(int value);
+	void on_settleTime_valueChanged(int value);
+	void on_useWebSocket_toggled(bool checked);
+	void on_webSocketPort_valueChanged(int value);
+	void updateStatus();
+};
+
+
+#endif // INCLUDE_FEATURE_FREQSWEEPGUI_H_
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+
+#include <QtPlugin>
+#include "plugin/pluginapi.h"
+
+#ifndef SERVER_MODE
+#include "freqsweepgui.h"
+#endif
+#include "freqsweep.h"
+#include "freqsweepplugin.h"
+#include "freqsweepwebapiadapter.h"
+
+const PluginDescriptor FreqSweepPlugin::m_pluginDescriptor = {
+    FreqSweep::m_featureId,
+	QString("Frequency Sweep"),
+	QString("4.20.0"),
+	QString("(c) Edouard Griffiths, F4EXB"),
+	QString("https://github.com/f4exb/sdrangel"),
+	true,
+	QString("https://github.com/f4exb/sdrangel")
+};
+
+FreqSweepPlugin::FreqSweepPlugin(QObject* parent) :
+	QObject(parent),
+	m_pluginAPI(nullptr)
+{
+}
+
+const PluginDescriptor& FreqSweepPlugin::getPluginDescriptor() const
+{
+	return m_pluginDescriptor;
+}
+
+void FreqSweepPlugin::initPlugin(PluginAPI* pluginAPI)
+{
+	m_pluginAPI = pluginAPI;
+
+	// register Frequency Sweep feature
+	m_pluginAPI->registerFeature(FreqSweep::m_featureIdURI, FreqSweep::m_featureId, this);
+}
+
+#ifdef SERVER_MODE
+FeatureGUI* FreqSweepPlugin::createFeatureGUI(FeatureUISet *featureUISet, Feature *feature) const
+{
+	(void) featureUISet;
+	(void) feature;
+    return nullptr;
+}
+#else
+FeatureGUI* FreqSweepPlugin::createFeatureGUI(FeatureUISet *featureUISet, Feature *feature) const
+{
+	return FreqSweepGUI::create(m_pluginAPI, featureUISet, feature);
+}
+#endif
+
+Feature* FreqSweepPlugin::createFeature(WebAPIAdapterInterface* webAPIAdapterInterface) const
+{
+    return new FreqSweep(webAPIAdapterInterface);
+}
+
+FeatureWebAPIAdapter* FreqSweepPlugin::createFeatureWebAPIAdapter() const
+{
+	return new FreqSweepWebAPIAdapter();
+}
@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FEATURE_FREQSWEEPREPORT_H_
+#define INCLUDE_FEATURE_FREQSWEEPREPORT_H_
+
+#include <vector>
+
+#include <QString>
+
+#include "util/message.h"
+
+class FreqSweepReport
+{
+public:
+    struct SweepResult
+    {
+        quint64 m_sweepCount;
+        qint64 m_startFrequency;        //!< center frequency of the first bin (Hz)
+        double m_binWidth;              //!< Hz
+        std::vector<float> m_powerDb;   //!< stitched power spectrum relative to full scale
+        unsigned int m_nbSteps;
+        qint64 m_durationUs;
+        double m_sweepRate;             //!< MHz/s
+        double m_averageRetuneLatencyUs;
+        unsigned int m_transientBlocks; //!< blocks dropped as transient over the sweep
+
+        SweepResult() :
+            m_sweepCount(0),
+            m_startFrequency(0),
+            m_binWidth(0.0),
+            m_nbSteps(0),
+            m_durationUs(0),
+            m_sweepRate(0.0),
+            m_averageRetuneLatencyUs(0.0),
+            m_transientBlocks(0)
+        {}
+    };
+
+    class MsgSweepDone : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const SweepResult& getResult() const { return m_result; }
+
+        static MsgSweepDone* create(const SweepResult& result)
+        {
+            return new MsgSweepDone(result);
+        }
+
+    private:
+        SweepResult m_result;
+
+        MsgSweepDone(const SweepResult& result) :
+            Message(),
+            m_result(result)
+        { }
+    };
+
+    class MsgSweepStatus : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        bool getSweeping() const { return m_sweeping; }
+        const QString& getErrorMessage() const { return m_errorMessage; }
+
+        static MsgSweepStatus* create(bool sweeping, const QString& errorMessage)
+        {
+            return new MsgSweepStatus(sweeping, errorMessage);
+        }
+
+    private:
+        bool m_sweeping;
+        QString m_errorMessage; //!< empty if the sweep did not stop on error
+
+        MsgSweepStatus(bool sweeping, const QString& errorMessage) :
+            Message(),
+            m_sweeping(sweeping),
+            m_errorMessage(errorMessage)
+        { }
+    };
+
+    FreqSweepReport();
+    ~FreqSweepReport();
+};
+
+#endif // INCLUDE_FEATURE_FREQSWEEPREPORT_H_
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QColor>
+
+#include "util/simpleserializer.h"
+#include "settings/serializable.h"
+
+#include "freqsweepsettings.h"
+
+FreqSweepSettings::FreqSweepSettings()
+{
+    resetToDefaults();
+}
+
+void FreqSweepSettings::resetToDefaults()
+{
+    m_title = "Frequency Sweep";
+    m_rgbColor = QColor(255, 170, 0).rgb();
+    m_deviceSetIndex = -1;
+    m_startFrequency = 88000000;
+    m_stopFrequency = 108000000;
+    m_fftSize = 1024;
+    m_usableBandwidthRatio = 0.75f;
+    m_fftAveraging = 4;
+    m_discardBlocks = 1;
+    m_settleTimeUs = 1000;
+    m_settleTimeoutMs = 500;
+    m_continuous = false;
+    m_useWebSocket = false;
+    m_webSocketAddress = "127.0.0.1";
+    m_webSocketPort = 8886;
+    m_useReverseAPI = false;
+    m_reverseAPIAddress = "127.0.0.1";
+    m_reverseAPIPort = 8888;
+    m_reverseAPIFeatureSetIndex = 0;
+    m_reverseAPIFeatureIndex = 0;
+}
+
+QByteArray FreqSweepSettings::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeString(1, m_title);
+    s.writeU32(2, m_rgbColor);
+    s.writeS32(3, m_deviceSetIndex);
+    s.writeS64(4, m_startFrequency);
+    s.writeS64(5, m_stopFrequency);
+    s.writeU32(6, m_fftSize);
+    s.writeFloat(7, m_usableBandwidthRatio);
+    s.writeU32(8, m_fftAveraging);
+    s.writeU32(9, m_discardBlocks);
+    s.writeU32(10, m_settleTimeUs);
+    s.writeU32(11, m_settleTimeoutMs);
+    s.writeBool(12, m_continuous);
+    s.writeBool(13, m_useWebSocket);
+    s.writeString(14, m_webSocketAddress);
+    s.writeU32(15, m_webSocketPort);
+    s.writeBool(16, m_useReverseAPI);
+    s.writeString(17, m_reverseAPIAddress);
+    s.writeU32(18, m_reverseAPIPort);
+    s.writeU32(19, m_reverseAPIFeatureSetIndex);
+    s.writeU32(20, m_reverseAPIFeatureIndex);
+
+    return s.final();
+}
+
+bool FreqSweepSettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if(!d.isValid())
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    if(d.getVersion() == 1)
+    {
+        uint32_t utmp;
+
+        d.readString(1, &m_title, "Frequency Sweep");
+        d.readU32(2, &m_rgbColor, QColor(255, 170, 0).rgb());
+        d.readS32(3, &m_deviceSetIndex, -1);
+        d.readS64(4, &m_startFrequency, 88000000);
+        d.readS64(5, &m_stopFrequency, 108000000);
+        d.readU32(6, &utmp, 1024);
+        m_fftSize = utmp < 64 ? 64 : utmp > 16384 ? 16384 : utmp;
+        d.readFloat(7, &m_usableBandwidthRatio, 0.75f);
+        m_usableBandwidthRatio = m_usableBandwidthRatio < 0.1f ? 0.1f : m_usableBandwidthRatio > 1.0f ? 1.0f : m_usableBandwidthRatio;
+        d.readU32(8, &utmp, 4);
+        m_fftAveraging = utmp < 1 ? 1 : utmp;
+        d.readU32(9, &m_discardBlocks, 1);
+        d.readU32(10, &m_settleTimeUs, 1000);
+        d.readU32(11, &m_settleTimeoutMs, 500);
+        d.readBool(12, &m_continuous, false);
+        d.readBool(13, &m_useWebSocket, false);
+        d.readString(14, &m_webSocketAddress, "127.0.0.1");
+        d.readU32(15, &utmp, 8886);
+        m_webSocketPort = utmp < 1024 ? 1024 : utmp > 65535 ? 65535 : utmp;
+        d.readBool(16, &m_useReverseAPI, false);
+        d.readString(17, &m_reverseAPIAddress, "127.0.0.1");
+        d.readU32(18, &utmp, 0);
+
+        if ((utmp > 1023) && (utmp < 65535)) {
+            m_reverseAPIPort = utmp;
+        } else {
+            m_reverseAPIPort = 8888;
+        }
+
+        d.readU32(19, &utmp, 0);
+        m_reverseAPIFeatureSetIndex = utmp > 99 ? 99 : utmp;
+        d.readU32(20, &utmp, 0);
+        m_reverseAPIFeatureIndex = utmp > 99 ? 99 : utmp;
+
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
@@ -0,0 +1,55 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FEATURE_FREQSWEEPSETTINGS_H_
+#define INCLUDE_FEATURE_FREQSWEEPSETTINGS_H_
+
+#include <QByteArray>
+#include <QString>
+
+class Serializable;
+
+struct FreqSweepSettings
+{
+    QString m_title;
+    quint32 m_rgbColor;
+    int m_deviceSetIndex;           //!< Rx device set to sweep
+    qint64 m_startFrequency;        //!< Hz
+    qint64 m_stopFrequency;         //!< Hz
+    unsigned int m_fftSize;
+    float m_usableBandwidthRatio;   //!< fraction of the device bandwidth kept on each step
+    unsigned int m_fftAveraging;    //!< FFTs averaged on each step
+    unsigned int m_discardBlocks;   //!< FFT blocks discarded after the retune is effective
+    unsigned int m_settleTimeUs;    //!< extra time after the retune notification for the hardware to settle
+    unsigned int m_settleTimeoutMs; //!< give up waiting for a retune notification after this delay
+    bool m_continuous;              //!< restart sweeping at the end of a sweep
+    bool m_useWebSocket;            //!< serve the stitched spectrum on a websocket
+    QString m_webSocketAddress;
+    uint16_t m_webSocketPort;
+    bool m_useReverseAPI;
+    QString m_reverseAPIAddress;
+    uint16_t m_reverseAPIPort;
+    uint16_t m_reverseAPIFeatureSetIndex;
+    uint16_t m_reverseAPIFeatureIndex;
+
+    FreqSweepSettings();
+    void resetToDefaults();
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+};
+
+#endif // INCLUDE_FEATURE_FREQSWEEPSETTINGS_H_
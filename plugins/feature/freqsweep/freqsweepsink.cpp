@@ -0,0 +1,293 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/dspcommands.h"
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+#include "dsp/samplesinkfifo.h"
+
+#include "freqsweepsink.h"
+
+MESSAGE_CLASS_DEFINITION(FreqSweepSink::MsgStepDone, Message)
+
+const double FreqSweepSink::m_transientRatio = 2.0; // 3 dB
+
+FreqSweepSink::FreqSweepSink() :
+    m_mutex(QMutex::Recursive),
+    m_state(StateIdle),
+    m_msgQueueToWorker(nullptr),
+    m_sampleFifo(nullptr),
+    m_sampleRate(0),
+    m_centerFrequency(0),
+    m_expectedCenterFrequency(0),
+    m_fftSize(0),
+    m_fftAveraging(1),
+    m_discardBlocks(0),
+    m_settleTimeUs(0),
+    m_fft(nullptr),
+    m_fftEngineSequence(0),
+    m_fftBufferFill(0),
+    m_retuneLatencyUs(0),
+    m_settleRemaining(0),
+    m_discardedSamples(0),
+    m_blocksToDiscard(0),
+    m_nbAveraged(0),
+    m_transientBlocks(0),
+    m_previousBlockPower(0.0)
+{
+    setObjectName("FreqSweepSink");
+    m_stepTimer.start();
+}
+
+FreqSweepSink::~FreqSweepSink()
+{
+    releaseFFT();
+}
+
+void FreqSweepSink::releaseFFT()
+{
+    if (m_fft)
+    {
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        fftFactory->releaseEngine(m_fftSize, false, m_fftEngineSequence);
+        m_fft = nullptr;
+    }
+}
+
+void FreqSweepSink::setSampleFifo(SampleSinkFifo *sampleFifo)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_sampleFifo = sampleFifo;
+}
+
+void FreqSweepSink::configure(unsigned int fftSize, unsigned int fftAveraging, unsigned int discardBlocks, unsigned int settleTimeUs)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((fftSize != m_fftSize) || !m_fft)
+    {
+        releaseFFT();
+        m_fftSize = fftSize;
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        m_fftEngineSequence = fftFactory->getEngine(m_fftSize, false, &m_fft);
+        m_window.create(FFTWindow::BlackmanHarris, m_fftSize);
+        m_fftBuffer.resize(m_fftSize);
+        m_powerAccumulator.resize(m_fftSize);
+        m_blockPower.resize(m_fftSize);
+    }
+
+    m_fftAveraging = fftAveraging < 1 ? 1 : fftAveraging;
+    m_discardBlocks = discardBlocks;
+    m_settleTimeUs = settleTimeUs;
+    m_state = StateIdle;
+}
+
+void FreqSweepSink::startStep(qint64 centerFrequency)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_expectedCenterFrequency = centerFrequency;
+    m_stepTimer.restart();
+
+    if (m_centerFrequency == centerFrequency) { // the device will not notify a change
+        startSettling();
+    } else {
+        m_state = StateWaitRetune;
+    }
+}
+
+bool FreqSweepSink::forceStep()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_state != StateWaitRetune) {
+        return false;
+    }
+
+    qDebug("FreqSweepSink::forceStep: no retune notification for %lld Hz", m_expectedCenterFrequency);
+    startSettling();
+    return true;
+}
+
+void FreqSweepSink::abortStep()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_state = StateIdle;
+}
+
+int FreqSweepSink::getSampleRate()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_sampleRate;
+}
+
+qint64 FreqSweepSink::getCenterFrequency()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_centerFrequency;
+}
+
+void FreqSweepSink::startSettling()
+{
+    // Samples still in the device FIFO were acquired before the retune was effective.
+    // On top of these skip the samples covering the hardware settling time.
+    m_retuneLatencyUs = m_stepTimer.nsecsElapsed() / 1000;
+    qint64 pending = m_sampleFifo ? m_sampleFifo->fill() : 0;
+    m_settleRemaining = pending + ((qint64) m_settleTimeUs * m_sampleRate) / 1000000;
+    m_discardedSamples = m_settleRemaining;
+    m_fftBufferFill = 0;
+    m_blocksToDiscard = m_discardBlocks;
+    m_nbAveraged = 0;
+    m_transientBlocks = 0;
+    m_previousBlockPower = 0.0;
+    std::fill(m_powerAccumulator.begin(), m_powerAccumulator.end(), 0.0);
+    m_state = m_settleRemaining > 0 ? StateSettling : StateCollecting;
+}
+
+bool FreqSweepSink::handleMessage(const Message& cmd)
+{
+    if (DSPSignalNotification::match(cmd))
+    {
+        // called from the device engine thread like feed()
+        DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
+        QMutexLocker mutexLocker(&m_mutex);
+        bool retuned = notif.getCenterFrequency() != m_centerFrequency;
+        m_sampleRate = notif.getSampleRate();
+        m_centerFrequency = notif.getCenterFrequency();
+
+        // The actual center frequency may differ from the requested one (e.g. transverter shift)
+        // so any change of center frequency is taken as the retune of the current step
+        if ((m_state == StateWaitRetune) && (retuned || (m_centerFrequency == m_expectedCenterFrequency))) {
+            startSettling();
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+void FreqSweepSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    (void) positiveOnly;
+    QMutexLocker mutexLocker(&m_mutex);
+    SampleVector::const_iterator it = begin;
+
+    while (it < end)
+    {
+        if (m_state == StateSettling)
+        {
+            qint64 skip = std::min((qint64) (end - it), m_settleRemaining);
+            it += skip;
+            m_settleRemaining -= skip;
+
+            if (m_settleRemaining == 0) {
+                m_state = StateCollecting;
+            }
+        }
+        else if (m_state == StateCollecting)
+        {
+            unsigned int count = std::min((unsigned int) (end - it), m_fftSize - m_fftBufferFill);
+
+            for (unsigned int i = 0; i < count; i++, ++it) {
+                m_fftBuffer[m_fftBufferFill + i] = Complex(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
+            }
+
+            m_fftBufferFill += count;
+
+            if (m_fftBufferFill == m_fftSize)
+            {
+                m_fftBufferFill = 0;
+                processBlock();
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+void FreqSweepSink::processBlock()
+{
+    m_window.apply(&m_fftBuffer[0], m_fft->in());
+    m_fft->transform();
+    const Complex* fftOut = m_fft->out();
+    unsigned int halfSize = m_fftSize / 2;
+    double blockPower = 0.0;
+
+    // reorder buckets from lowest to highest frequency
+    for (unsigned int i = 0; i < halfSize; i++)
+    {
+        m_blockPower[i] = std::norm(fftOut[i + halfSize]);
+        m_blockPower[i + halfSize] = std::norm(fftOut[i]);
+        blockPower += m_blockPower[i] + m_blockPower[i + halfSize];
+    }
+
+    if (m_blocksToDiscard > 0)
+    {
+        m_blocksToDiscard--;
+        m_previousBlockPower = blockPower;
+        return;
+    }
+
+    // A block whose total power jumps from the previous one is still part of the retune transient
+    // (PLL lock, AGC...). Restart averaging from there but do not wait forever on bursty signals.
+    if ((m_previousBlockPower > 0.0) && (m_transientBlocks < m_maxTransientBlocks)
+     && ((blockPower > m_previousBlockPower * m_transientRatio) || (blockPower * m_transientRatio < m_previousBlockPower)))
+    {
+        m_transientBlocks++;
+        m_nbAveraged = 0;
+        std::fill(m_powerAccumulator.begin(), m_powerAccumulator.end(), 0.0);
+        m_previousBlockPower = blockPower;
+        return;
+    }
+
+    m_previousBlockPower = blockPower;
+
+    for (unsigned int i = 0; i < m_fftSize; i++) {
+        m_powerAccumulator[i] += m_blockPower[i];
+    }
+
+    if (++m_nbAveraged < m_fftAveraging) {
+        return;
+    }
+
+    std::vector<float> power(m_fftSize);
+    double norm = 1.0 / ((double) m_fftSize * m_fftSize * m_nbAveraged);
+
+    for (unsigned int i = 0; i < m_fftSize; i++) {
+        power[i] = m_powerAccumulator[i] * norm;
+    }
+
+    m_state = StateIdle;
+
+    if (m_msgQueueToWorker)
+    {
+        MsgStepDone *msg = MsgStepDone::create(
+            m_centerFrequency,
+            m_sampleRate,
+            power,
+            m_retuneLatencyUs,
+            m_discardedSamples + (qint64) (m_discardBlocks + m_transientBlocks) * m_fftSize,
+            m_transientBlocks
+        );
+        m_msgQueueToWorker->push(msg);
+    }
+}
@@ -0,0 +1,151 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FEATURE_FREQSWEEPSINK_H_
+#define INCLUDE_FEATURE_FREQSWEEPSINK_H_
+
+#include <vector>
+
+#include <QMutex>
+#include <QElapsedTimer>
+
+#include "dsp/basebandsamplesink.h"
+#include "dsp/fftwindow.h"
+#include "util/message.h"
+
+class FFTEngine;
+class SampleSinkFifo;
+
+/**
+ * Sample sink attached to the swept device engine. For each sweep step it waits for the retune
+ * to be effective, skips the samples that were acquired before, lets the hardware settle and
+ * averages the power spectrum of a number of FFT blocks that are not transient.
+ */
+class FreqSweepSink : public BasebandSampleSink
+{
+    Q_OBJECT
+public:
+    class MsgStepDone : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        qint64 getCenterFrequency() const { return m_centerFrequency; }
+        int getSampleRate() const { return m_sampleRate; }
+        const std::vector<float>& getPower() const { return m_power; }
+        qint64 getRetuneLatencyUs() const { return m_retuneLatencyUs; }
+        qint64 getDiscardedSamples() const { return m_discardedSamples; }
+        unsigned int getTransientBlocks() const { return m_transientBlocks; }
+
+        static MsgStepDone* create(
+            qint64 centerFrequency,
+            int sampleRate,
+            const std::vector<float>& power,
+            qint64 retuneLatencyUs,
+            qint64 discardedSamples,
+            unsigned int transientBlocks)
+        {
+            return new MsgStepDone(centerFrequency, sampleRate, power, retuneLatencyUs, discardedSamples, transientBlocks);
+        }
+
+    private:
+        qint64 m_centerFrequency;
+        int m_sampleRate;
+        std::vector<float> m_power; //!< linear power normalized to full scale from lowest to highest frequency
+        qint64 m_retuneLatencyUs;   //!< from step start to retune notification
+        qint64 m_discardedSamples;  //!< samples skipped before the first valid block
+        unsigned int m_transientBlocks;
+
+        MsgStepDone(
+            qint64 centerFrequency,
+            int sampleRate,
+            const std::vector<float>& power,
+            qint64 retuneLatencyUs,
+            qint64 discardedSamples,
+            unsigned int transientBlocks) :
+            Message(),
+            m_centerFrequency(centerFrequency),
+            m_sampleRate(sampleRate),
+            m_power(power),
+            m_retuneLatencyUs(retuneLatencyUs),
+            m_discardedSamples(discardedSamples),
+            m_transientBlocks(transientBlocks)
+        { }
+    };
+
+    FreqSweepSink();
+    virtual ~FreqSweepSink();
+
+    virtual void start() {}
+    virtual void stop() {}
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual bool handleMessage(const Message& cmd);
+
+    void setMessageQueueToWorker(MessageQueue *messageQueue) { m_msgQueueToWorker = messageQueue; }
+    void setSampleFifo(SampleSinkFifo *sampleFifo);
+    void configure(unsigned int fftSize, unsigned int fftAveraging, unsigned int discardBlocks, unsigned int settleTimeUs);
+    void startStep(qint64 centerFrequency); //!< call before the retune is requested
+    bool forceStep();                        //!< retune was not notified: take the samples from now on. False if not waiting.
+    void abortStep();
+    int getSampleRate();
+    qint64 getCenterFrequency();
+
+private:
+    enum State {
+        StateIdle,       //!< no step in progress
+        StateWaitRetune, //!< waiting for the device to notify the new center frequency
+        StateSettling,   //!< skipping samples acquired before the retune and during settling
+        StateCollecting  //!< accumulating power spectra
+    };
+
+    QMutex m_mutex;
+    State m_state;
+    MessageQueue *m_msgQueueToWorker;
+    SampleSinkFifo *m_sampleFifo;
+    int m_sampleRate;
+    qint64 m_centerFrequency;
+    qint64 m_expectedCenterFrequency;
+
+    unsigned int m_fftSize;
+    unsigned int m_fftAveraging;
+    unsigned int m_discardBlocks;
+    unsigned int m_settleTimeUs;
+    FFTEngine *m_fft;
+    unsigned int m_fftEngineSequence;
+    FFTWindow m_window;
+    std::vector<Complex> m_fftBuffer;
+    unsigned int m_fftBufferFill;
+    std::vector<double> m_powerAccumulator;
+    std::vector<float> m_blockPower;
+
+    QElapsedTimer m_stepTimer;
+    qint64 m_retuneLatencyUs;
+    qint64 m_settleRemaining;
+    qint64 m_discardedSamples;
+    unsigned int m_blocksToDiscard;
+    unsigned int m_nbAveraged;
+    unsigned int m_transientBlocks;
+    double m_previousBlockPower;
+
+    static const unsigned int m_maxTransientBlocks = 8;
+    static const double m_transientRatio; //!< block to block total power ratio above which a block is considered transient
+
+    void startSettling();
+    void processBlock();
+    void releaseFFT();
+};
+
+#endif // INCLUDE_FEATURE_FREQSWEEPSINK_H_
@@ -0,0 +1,473 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include <QDebug>
+
+#include "SWGErrorResponse.h"
+
+#include "webapi/webapiadapterinterface.h"
+#include "maincore.h"
+#include "device/deviceset.h"
+#include "device/deviceapi.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/dspdevicesourceengine.h"
+
+#include "freqsweepreport.h"
+#include "freqsweepworker.h"
+
+MESSAGE_CLASS_DEFINITION(FreqSweepWorker::MsgConfigureFreqSweepWorker, Message)
+MESSAGE_CLASS_DEFINITION(FreqSweepWorker::MsgStartSweep, Message)
+
+FreqSweepWorker::FreqSweepWorker(WebAPIAdapterInterface *webAPIAdapterInterface) :
+    m_webAPIAdapterInterface(webAPIAdapterInterface),
+    m_msgQueueToGUI(nullptr),
+    m_msgQueueToFeature(nullptr),
+    m_running(false),
+    m_mutex(QMutex::Recursive),
+    m_deviceSourceEngine(nullptr),
+    m_attachedDeviceSetIndex(-1),
+    m_stepForced(false),
+    m_sweeping(false),
+    m_planSampleRate(0),
+    m_binWidth(0.0),
+    m_keptBins(0),
+    m_nbSteps(0),
+    m_stepIndex(0),
+    m_retuneLatencySumUs(0),
+    m_transientBlocks(0),
+    m_sweepCount(0)
+{
+    qDebug("FreqSweepWorker::FreqSweepWorker");
+    m_sink = new FreqSweepSink();
+    m_sink->setMessageQueueToWorker(&m_inputMessageQueue);
+    m_stepTimer.setSingleShot(true);
+    connect(&m_stepTimer, SIGNAL(timeout()), this, SLOT(stepTimeout()));
+}
+
+FreqSweepWorker::~FreqSweepWorker()
+{
+    detachDevice();
+    m_inputMessageQueue.clear();
+    delete m_sink;
+}
+
+void FreqSweepWorker::reset()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_inputMessageQueue.clear();
+}
+
+bool FreqSweepWorker::startWork()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    m_running = true;
+    return m_running;
+}
+
+void FreqSweepWorker::stopWork()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    disconnect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+    m_stepTimer.stop();
+    m_sink->abortStep();
+    m_sweeping = false;
+    detachDevice();
+    m_wsSpectrum.closeSocket();
+    m_running = false;
+}
+
+void FreqSweepWorker::handleInputMessages()
+{
+	Message* message;
+
+	while ((message = m_inputMessageQueue.pop()) != nullptr)
+	{
+		if (handleMessage(*message)) {
+			delete message;
+		}
+	}
+}
+
+bool FreqSweepWorker::handleMessage(const Message& cmd)
+{
+    if (MsgConfigureFreqSweepWorker::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        MsgConfigureFreqSweepWorker& cfg = (MsgConfigureFreqSweepWorker&) cmd;
+        qDebug() << "FreqSweepWorker::handleMessage: MsgConfigureFreqSweepWorker";
+
+        applySettings(cfg.getSettings(), cfg.getForce());
+
+        return true;
+    }
+    else if (MsgStartSweep::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        qDebug() << "FreqSweepWorker::handleMessage: MsgStartSweep";
+
+        if (!m_sweeping) {
+            startSweep();
+        }
+
+        return true;
+    }
+    else if (FreqSweepSink::MsgStepDone::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        FreqSweepSink::MsgStepDone& stepDone = (FreqSweepSink::MsgStepDone&) cmd;
+        m_stepTimer.stop();
+
+        if (m_sweeping) {
+            stitch(stepDone);
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void FreqSweepWorker::applySettings(const FreqSweepSettings& settings, bool force)
+{
+    qDebug() << "FreqSweepWorker::applySettings:"
+            << " m_title: " << settings.m_title
+            << " m_deviceSetIndex: " << settings.m_deviceSetIndex
+            << " m_startFrequency: " << settings.m_startFrequency
+            << " m_stopFrequency: " << settings.m_stopFrequency
+            << " m_fftSize: " << settings.m_fftSize
+            << " m_usableBandwidthRatio: " << settings.m_usableBandwidthRatio
+            << " m_fftAveraging: " << settings.m_fftAveraging
+            << " m_discardBlocks: " << settings.m_discardBlocks
+            << " m_settleTimeUs: " << settings.m_settleTimeUs
+            << " m_settleTimeoutMs: " << settings.m_settleTimeoutMs
+            << " m_continuous: " << settings.m_continuous
+            << " m_useWebSocket: " << settings.m_useWebSocket
+            << " m_webSocketAddress: " << settings.m_webSocketAddress
+            << " m_webSocketPort: " << settings.m_webSocketPort
+            << " force: " << force;
+
+    bool deviceChanged = (m_settings.m_deviceSetIndex != settings.m_deviceSetIndex) || force;
+    bool sweepChanged = deviceChanged
+        || (m_settings.m_startFrequency != settings.m_startFrequency)
+        || (m_settings.m_stopFrequency != settings.m_stopFrequency)
+        || (m_settings.m_fftSize != settings.m_fftSize)
+        || (m_settings.m_usableBandwidthRatio != settings.m_usableBandwidthRatio)
+        || (m_settings.m_fftAveraging != settings.m_fftAveraging)
+        || (m_settings.m_discardBlocks != settings.m_discardBlocks)
+        || (m_settings.m_settleTimeUs != settings.m_settleTimeUs);
+
+    if ((m_settings.m_useWebSocket != settings.m_useWebSocket)
+     || (m_settings.m_webSocketAddress != settings.m_webSocketAddress)
+     || (m_settings.m_webSocketPort != settings.m_webSocketPort) || force)
+    {
+        m_wsSpectrum.closeSocket();
+
+        if (settings.m_useWebSocket)
+        {
+            m_wsSpectrum.setListeningAddress(settings.m_webSocketAddress);
+            m_wsSpectrum.setPort(settings.m_webSocketPort);
+            m_wsSpectrum.openSocket();
+        }
+    }
+
+    bool wasSweeping = m_sweeping;
+    m_settings = settings;
+
+    if (sweepChanged)
+    {
+        // the current sweep is meaningless with the new parameters: start over
+        m_stepTimer.stop();
+        m_sink->abortStep();
+        m_sweeping = false;
+        m_sink->configure(settings.m_fftSize, settings.m_fftAveraging, settings.m_discardBlocks, settings.m_settleTimeUs);
+
+        if (deviceChanged) {
+            detachDevice();
+        }
+
+        if (wasSweeping || force) {
+            startSweep();
+        }
+    }
+}
+
+bool FreqSweepWorker::attachDevice()
+{
+    std::vector<DeviceSet*>& deviceSets = MainCore::instance()->getDeviceSets();
+
+    if ((m_settings.m_deviceSetIndex < 0) || (m_settings.m_deviceSetIndex >= (int) deviceSets.size())) {
+        return false;
+    }
+
+    DeviceSet *deviceSet = deviceSets[m_settings.m_deviceSetIndex];
+
+    if (!deviceSet->m_deviceSourceEngine || !deviceSet->m_deviceAPI->getSampleSource()) {
+        return false;
+    }
+
+    m_sink->setSampleFifo(deviceSet->m_deviceAPI->getSampleSource()->getSampleFifo());
+    m_deviceSourceEngine = deviceSet->m_deviceSourceEngine;
+    m_attachedDeviceSetIndex = m_settings.m_deviceSetIndex;
+    m_deviceSourceEngine->addSink(m_sink); // notifies the current sample rate and center frequency
+    qDebug("FreqSweepWorker::attachDevice: attached to R%d", m_settings.m_deviceSetIndex);
+
+    return true;
+}
+
+void FreqSweepWorker::detachDevice()
+{
+    DSPDeviceSourceEngine *deviceSourceEngine = getAttachedEngine();
+
+    if (deviceSourceEngine) {
+        deviceSourceEngine->removeSink(m_sink);
+    }
+
+    m_deviceSourceEngine = nullptr;
+    m_attachedDeviceSetIndex = -1;
+    m_sink->setSampleFifo(nullptr);
+}
+
+// The device set may be removed while the sink is attached and its engine is deleted with it.
+// The engine is therefore found again in the device sets before it is used and nullptr is
+// returned when it is gone.
+DSPDeviceSourceEngine *FreqSweepWorker::getAttachedEngine() const
+{
+    if (!m_deviceSourceEngine) {
+        return nullptr;
+    }
+
+    std::vector<DeviceSet*>& deviceSets = MainCore::instance()->getDeviceSets();
+
+    if ((m_attachedDeviceSetIndex < 0) || (m_attachedDeviceSetIndex >= (int) deviceSets.size())) {
+        return nullptr;
+    }
+
+    return deviceSets[m_attachedDeviceSetIndex]->m_deviceSourceEngine == m_deviceSourceEngine ? m_deviceSourceEngine : nullptr;
+}
+
+qint64 FreqSweepWorker::getStepCenterFrequency(unsigned int stepIndex) const
+{
+    return m_settings.m_startFrequency + std::llround((stepIndex + 0.5) * m_keptBins * m_binWidth);
+}
+
+void FreqSweepWorker::startSweep()
+{
+    if (!m_running) {
+        return;
+    }
+
+    if (!getAttachedEngine())
+    {
+        detachDevice(); // forget an engine removed with its device set
+        attachDevice();
+    }
+
+    if (!getAttachedEngine())
+    {
+        stopSweep(QString("R%1 is not a valid Rx device set").arg(m_settings.m_deviceSetIndex));
+        return;
+    }
+
+    if (m_settings.m_stopFrequency <= m_settings.m_startFrequency)
+    {
+        stopSweep("Stop frequency must be above start frequency");
+        return;
+    }
+
+    m_planSampleRate = m_sink->getSampleRate();
+
+    if (m_planSampleRate <= 0)
+    {
+        stopSweep("Device sample rate is not known");
+        return;
+    }
+
+    // Each step keeps the m_keptBins central bins. Steps are spaced by the kept bandwidth so that
+    // the bins of consecutive steps fall exactly next to each other in the stitched spectrum.
+    m_binWidth = (double) m_planSampleRate / m_settings.m_fftSize;
+    m_keptBins = ((unsigned int) (m_settings.m_fftSize * m_settings.m_usableBandwidthRatio)) & ~1U;
+    m_keptBins = m_keptBins < 2 ? 2 : m_keptBins;
+    unsigned int nbBins = (unsigned int) std::ceil((m_settings.m_stopFrequency - m_settings.m_startFrequency) / m_binWidth) + 1;
+    m_nbSteps = (nbBins + m_keptBins - 1) / m_keptBins;
+    m_powerDb.assign(nbBins, -200.0f);
+    m_stepIndex = 0;
+    m_retuneLatencySumUs = 0;
+    m_transientBlocks = 0;
+    m_sweeping = true;
+    m_sweepTimer.start();
+    reportStatus();
+    retune();
+}
+
+void FreqSweepWorker::stopSweep(const QString& errorMessage)
+{
+    m_stepTimer.stop();
+    m_sink->abortStep();
+    m_sweeping = false;
+
+    if (!errorMessage.isEmpty()) {
+        qWarning("FreqSweepWorker::stopSweep: %s", qPrintable(errorMessage));
+    }
+
+    reportStatus(errorMessage);
+}
+
+void FreqSweepWorker::retune()
+{
+    qint64 centerFrequency = getStepCenterFrequency(m_stepIndex);
+    SWGSDRangel::SWGErrorResponse error;
+
+    // arm the sink before the retune so that its notification cannot be missed
+    m_sink->startStep(centerFrequency);
+    m_stepForced = false;
+    int httpCode = m_webAPIAdapterInterface->devicesetDeviceSettingsFieldPatch(
+        m_settings.m_deviceSetIndex,
+        WebAPIAdapterInterface::SettingsFieldCenterFrequency,
+        centerFrequency,
+        error
+    );
+
+    if (httpCode/100 != 2)
+    {
+        stopSweep(QString("Cannot tune R%1 to %2 Hz: %3")
+            .arg(m_settings.m_deviceSetIndex).arg(centerFrequency).arg(*error.getMessage()));
+        return;
+    }
+
+    m_stepTimer.start(m_settings.m_settleTimeoutMs);
+}
+
+void FreqSweepWorker::stepTimeout()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_sweeping) {
+        return;
+    }
+
+    if (!getAttachedEngine())
+    {
+        detachDevice();
+        stopSweep(QString("R%1 was removed").arg(m_settings.m_deviceSetIndex));
+    }
+    else if (!m_stepForced && m_sink->forceStep())
+    {
+        // Some devices do not notify a retune (e.g. no change at their frequency resolution).
+        // Take the samples from now on and give the step some more time to complete.
+        m_stepForced = true;
+        m_stepTimer.start(10 * m_settings.m_settleTimeoutMs);
+    }
+    else
+    {
+        stopSweep(QString("No samples from R%1. Is the device running?").arg(m_settings.m_deviceSetIndex));
+    }
+}
+
+void FreqSweepWorker::stitch(const FreqSweepSink::MsgStepDone& stepDone)
+{
+    if (stepDone.getSampleRate() != m_planSampleRate)
+    {
+        stopSweep(QString("Device sample rate changed from %1 to %2 S/s during the sweep")
+            .arg(m_planSampleRate).arg(stepDone.getSampleRate()));
+        return;
+    }
+
+    const std::vector<float>& power = stepDone.getPower();
+    unsigned int firstBin = m_settings.m_fftSize/2 - m_keptBins/2;
+    unsigned int stitchIndex = m_stepIndex * m_keptBins;
+
+    for (unsigned int i = 0; (i < m_keptBins) && (stitchIndex < m_powerDb.size()); i++, stitchIndex++) {
+        m_powerDb[stitchIndex] = 10.0f * log10f(power[firstBin + i] + 1e-20f);
+    }
+
+    m_retuneLatencySumUs += stepDone.getRetuneLatencyUs();
+    m_transientBlocks += stepDone.getTransientBlocks();
+    m_stepIndex++;
+
+    if (m_stepIndex < m_nbSteps) {
+        retune();
+    } else {
+        sweepDone();
+    }
+}
+
+void FreqSweepWorker::sweepDone()
+{
+    FreqSweepReport::SweepResult result;
+    result.m_sweepCount = ++m_sweepCount;
+    result.m_startFrequency = m_settings.m_startFrequency;
+    result.m_binWidth = m_binWidth;
+    result.m_powerDb = m_powerDb;
+    result.m_nbSteps = m_nbSteps;
+    result.m_durationUs = m_sweepTimer.nsecsElapsed() / 1000;
+    double spanHz = m_powerDb.size() * m_binWidth;
+    result.m_sweepRate = result.m_durationUs > 0 ? spanHz / result.m_durationUs : 0.0; // Hz/us = MHz/s
+    result.m_averageRetuneLatencyUs = (double) m_retuneLatencySumUs / m_nbSteps;
+    result.m_transientBlocks = m_transientBlocks;
+
+    qDebug("FreqSweepWorker::sweepDone: #%llu %.3f MHz in %u steps in %lld ms: %.1f MHz/s retune latency: %.0f us transients: %u",
+        result.m_sweepCount, spanHz / 1e6, m_nbSteps, result.m_durationUs / 1000, result.m_sweepRate,
+        result.m_averageRetuneLatencyUs, m_transientBlocks);
+
+    if (m_wsSpectrum.socketOpened())
+    {
+        std::vector<Real> spectrum(m_powerDb.begin(), m_powerDb.end());
+        m_wsSpectrum.newSpectrum(
+            spectrum,
+            spectrum.size(),
+            0.0f,   // reference level
+            120.0f, // power range
+            m_settings.m_startFrequency + (qint64) (spanHz / 2.0 - m_binWidth / 2.0),
+            (int) spanHz,
+            false
+        );
+    }
+
+    if (m_msgQueueToFeature) {
+        m_msgQueueToFeature->push(FreqSweepReport::MsgSweepDone::create(result));
+    }
+
+    if (m_msgQueueToGUI) {
+        m_msgQueueToGUI->push(FreqSweepReport::MsgSweepDone::create(result));
+    }
+
+    if (m_settings.m_continuous)
+    {
+        startSweep();
+    }
+    else
+    {
+        m_sweeping = false;
+        reportStatus();
+    }
+}
+
+void FreqSweepWorker::reportStatus(const QString& errorMessage)
+{
+    if (m_msgQueueToFeature) {
+        m_msgQueueToFeature->push(FreqSweepReport::MsgSweepStatus::create(m_sweeping, errorMessage));
+    }
+
+    if (m_msgQueueToGUI) {
+        m_msgQueueToGUI->push(FreqSweepReport::MsgSweepStatus::create(m_sweeping, errorMessage));
+    }
+}
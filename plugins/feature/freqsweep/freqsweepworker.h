@@ -0,0 +1,136 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FEATURE_FREQSWEEPWORKER_H_
+#define INCLUDE_FEATURE_FREQSWEEPWORKER_H_
+
+#include <vector>
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+
+#include "util/message.h"
+#include "util/messagequeue.h"
+#include "websockets/wsspectrum.h"
+
+#include "freqsweepsettings.h"
+#include "freqsweepsink.h"
+
+class WebAPIAdapterInterface;
+class DSPDeviceSourceEngine;
+
+class FreqSweepWorker : public QObject
+{
+    Q_OBJECT
+public:
+    class MsgConfigureFreqSweepWorker : public Message {
+        MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureFreqSweepWorker)
+
+    public:
+        const FreqSweepSettings& getSettings() const { return m_settings; }
+        bool getForce() const { return m_force; }
+
+        static MsgConfigureFreqSweepWorker* create(const FreqSweepSettings& settings, bool force)
+        {
+            return new MsgConfigureFreqSweepWorker(settings, force);
+        }
+
+    private:
+        FreqSweepSettings m_settings;
+        bool m_force;
+
+        MsgConfigureFreqSweepWorker(const FreqSweepSettings& settings, bool force) :
+            Message(),
+            m_settings(settings),
+            m_force(force)
+        { }
+    };
+
+    class MsgStartSweep : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        static MsgStartSweep* create() {
+            return new MsgStartSweep();
+        }
+
+    private:
+        MsgStartSweep() :
+            Message()
+        { }
+    };
+
+    FreqSweepWorker(WebAPIAdapterInterface *webAPIAdapterInterface);
+    ~FreqSweepWorker();
+    void reset();
+    bool startWork();
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
+    void setMessageQueueToGUI(MessageQueue *messageQueue) { m_msgQueueToGUI = messageQueue; }
+    void setMessageQueueToFeature(MessageQueue *messageQueue) { m_msgQueueToFeature = messageQueue; }
+
+private:
+    WebAPIAdapterInterface *m_webAPIAdapterInterface;
+    MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
+    MessageQueue *m_msgQueueToGUI;     //!< Queue to report state to GUI
+    MessageQueue *m_msgQueueToFeature; //!< Queue to report results to the feature
+    FreqSweepSettings m_settings;
+    bool m_running;
+    QMutex m_mutex;
+
+    FreqSweepSink *m_sink;
+    DSPDeviceSourceEngine *m_deviceSourceEngine; //!< engine the sink is attached to. Use getAttachedEngine() to access it
+    int m_attachedDeviceSetIndex;                //!< device set of m_deviceSourceEngine
+    WSSpectrum m_wsSpectrum;
+    QTimer m_stepTimer;   //!< watchdog on the current step
+    bool m_stepForced;    //!< retune notification timeout has already elapsed for the current step
+
+    // sweep plan and state
+    bool m_sweeping;
+    int m_planSampleRate;
+    double m_binWidth;
+    unsigned int m_keptBins;     //!< FFT bins kept on each step
+    unsigned int m_nbSteps;
+    unsigned int m_stepIndex;
+    std::vector<float> m_powerDb;
+    QElapsedTimer m_sweepTimer;
+    qint64 m_retuneLatencySumUs;
+    unsigned int m_transientBlocks;
+    quint64 m_sweepCount;
+
+    bool handleMessage(const Message& cmd);
+    void applySettings(const FreqSweepSettings& settings, bool force = false);
+    bool attachDevice();
+    void detachDevice();
+    DSPDeviceSourceEngine *getAttachedEngine() const;
+    void startSweep();
+    void stopSweep(const QString& errorMessage);
+    void retune();
+    void stitch(const FreqSweepSink::MsgStepDone& stepDone);
+    void sweepDone();
+    qint64 getStepCenterFrequency(unsigned int stepIndex) const;
+    void reportStatus(const QString& errorMessage = QString());
+
+private slots:
+    void handleInputMessages();
+    void stepTimeout();
+};
+
+#endif // INCLUDE_FEATURE_FREQSWEEPWORKER_H_
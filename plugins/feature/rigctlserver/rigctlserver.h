@@ -42,6 +42,7 @@ class RigCtlServer : public Feature
 public:
     class MsgConfigureRigCtlServer : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureRigCtlServer)
 
     public:
         const RigCtlServerSettings& getSettings() const { return m_settings; }
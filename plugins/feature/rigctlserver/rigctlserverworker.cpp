@@ -25,7 +25,6 @@
 #include "SWGDeviceState.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
-#include "SWGDeviceSettings.h"
 #include "SWGChannelSettings.h"
 #include "SWGDeviceSet.h"
 
@@ -334,14 +333,15 @@ void RigCtlServerWorker::getCommand()
 
 bool RigCtlServerWorker::setFrequency(double targetFrequency, rig_errcode_e& rigCtlRC)
 {
-    SWGSDRangel::SWGDeviceSettings deviceSettingsResponse;
     SWGSDRangel::SWGErrorResponse errorResponse;
+    double freq;
     int httpRC;
 
     // Get current device center frequency
-    httpRC = m_webAPIAdapterInterface->devicesetDeviceSettingsGet(
+    httpRC = m_webAPIAdapterInterface->devicesetDeviceSettingsFieldGet(
         m_settings.m_deviceIndex,
-        deviceSettingsResponse,
+        WebAPIAdapterInterface::SettingsFieldCenterFrequency,
+        freq,
         errorResponse
     );
 
@@ -349,108 +349,55 @@ bool RigCtlServerWorker::setFrequency(double targetFrequency, rig_errcode_e& rig
     {
         qWarning("RigCtlServerWorker::setFrequency: get device frequency error %d: %s",
             httpRC, qPrintable(*errorResponse.getMessage()));
-        rigCtlRC = RIG_EINVAL;
+        rigCtlRC = httpRC == 501 ? RIG_ENIMPL : RIG_EINVAL;
         return false;
     }
 
-    QJsonObject *jsonObj = deviceSettingsResponse.asJsonObject();
-    double freq;
+    bool outOfRange = std::abs(freq - targetFrequency) > m_settings.m_maxFrequencyOffset;
 
-    if (WebAPIUtils::getSubObjectDouble(*jsonObj, "centerFrequency", freq))
+    if (outOfRange)
     {
-        bool outOfRange = std::abs(freq - targetFrequency) > m_settings.m_maxFrequencyOffset;
-
-        if (outOfRange)
-        {
-            // Update centerFrequency
-            WebAPIUtils::setSubObjectDouble(*jsonObj, "centerFrequency", targetFrequency);
-            QStringList deviceSettingsKeys;
-            deviceSettingsKeys.append("centerFrequency");
-            deviceSettingsResponse.init();
-            deviceSettingsResponse.fromJsonObject(*jsonObj);
-            SWGSDRangel::SWGErrorResponse errorResponse2;
-
-            httpRC = m_webAPIAdapterInterface->devicesetDeviceSettingsPutPatch(
-                m_settings.m_deviceIndex,
-                false, // PATCH
-                deviceSettingsKeys,
-                deviceSettingsResponse,
-                errorResponse2
-            );
-
-            if (httpRC/100 == 2)
-            {
-                qDebug("RigCtlServerWorker::setFrequency: set device frequency %f OK", targetFrequency);
-            }
-            else
-            {
-                qWarning("RigCtlServerWorker::setFrequency: set device frequency error %d: %s",
-                    httpRC, qPrintable(*errorResponse2.getMessage()));
-                rigCtlRC = RIG_EINVAL;
-                return false;
-            }
-        }
-
-        // Update inputFrequencyOffset (offet if in range else zero)
-        float targetOffset = outOfRange ?  0 : targetFrequency - freq;
-        SWGSDRangel::SWGChannelSettings channelSettingsResponse;
-        // Get channel settings containing inputFrequencyOffset, so we can patch it
-        httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsGet(
+        // Update centerFrequency
+        httpRC = m_webAPIAdapterInterface->devicesetDeviceSettingsFieldPatch(
             m_settings.m_deviceIndex,
-            m_settings.m_channelIndex,
-            channelSettingsResponse,
+            WebAPIAdapterInterface::SettingsFieldCenterFrequency,
+            targetFrequency,
             errorResponse
         );
 
-        if (httpRC/100 != 2)
+        if (httpRC/100 == 2)
+        {
+            qDebug("RigCtlServerWorker::setFrequency: set device frequency %f OK", targetFrequency);
+        }
+        else
         {
-            qWarning("RigCtlServerWorker::setFrequency: get channel offset frequency error %d: %s",
+            qWarning("RigCtlServerWorker::setFrequency: set device frequency error %d: %s",
                 httpRC, qPrintable(*errorResponse.getMessage()));
             rigCtlRC = RIG_EINVAL;
             return false;
         }
+    }
 
-        jsonObj = channelSettingsResponse.asJsonObject();
+    // Update inputFrequencyOffset (offet if in range else zero)
+    float targetOffset = outOfRange ?  0 : targetFrequency - freq;
 
-        if (WebAPIUtils::setSubObjectDouble(*jsonObj, "inputFrequencyOffset", targetOffset))
-        {
-            QStringList channelSettingsKeys;
-            channelSettingsKeys.append("inputFrequencyOffset");
-            channelSettingsResponse.init();
-            channelSettingsResponse.fromJsonObject(*jsonObj);
-
-            httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsPutPatch(
-                m_settings.m_deviceIndex,
-                m_settings.m_channelIndex,
-                false, // PATCH
-                channelSettingsKeys,
-                channelSettingsResponse,
-                errorResponse
-            );
-
-            if (httpRC/100 == 2)
-            {
-                qDebug("RigCtlServerWorker::setFrequency: set channel offset frequency %f OK", targetOffset);
-            }
-            else
-            {
-                qWarning("RigCtlServerWorker::setFrequency: set channel frequency offset error %d: %s",
-                    httpRC, qPrintable(*errorResponse.getMessage()));
-                rigCtlRC = RIG_EINVAL;
-                return false;
-            }
-        }
-        else
-        {
-            qWarning("RigCtlServerWorker::setFrequency: No inputFrequencyOffset key in channel settings");
-            rigCtlRC = RIG_ENIMPL;
-            return false;
-        }
+    httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsFieldPatch(
+        m_settings.m_deviceIndex,
+        m_settings.m_channelIndex,
+        WebAPIAdapterInterface::SettingsFieldInputFrequencyOffset,
+        targetOffset,
+        errorResponse
+    );
+
+    if (httpRC/100 == 2)
+    {
+        qDebug("RigCtlServerWorker::setFrequency: set channel offset frequency %f OK", targetOffset);
     }
     else
     {
-        qWarning("RigCtlServerWorker::setFrequency: no centerFrequency key in device settings");
-        rigCtlRC = RIG_ENIMPL;
+        qWarning("RigCtlServerWorker::setFrequency: set channel frequency offset error %d: %s",
+            httpRC, qPrintable(*errorResponse.getMessage()));
+        rigCtlRC = httpRC == 501 ? RIG_ENIMPL : RIG_EINVAL;
         return false;
     }
 
@@ -460,14 +407,16 @@ bool RigCtlServerWorker::setFrequency(double targetFrequency, rig_errcode_e& rig
 
 bool RigCtlServerWorker::getFrequency(double& frequency, rig_errcode_e& rigCtlRC)
 {
-    SWGSDRangel::SWGDeviceSettings deviceSettingsResponse;
     SWGSDRangel::SWGErrorResponse errorResponse;
+    double deviceFreq;
+    double channelOffset;
     int httpRC;
 
     // Get current device center frequency
-    httpRC = m_webAPIAdapterInterface->devicesetDeviceSettingsGet(
+    httpRC = m_webAPIAdapterInterface->devicesetDeviceSettingsFieldGet(
         m_settings.m_deviceIndex,
-        deviceSettingsResponse,
+        WebAPIAdapterInterface::SettingsFieldCenterFrequency,
+        deviceFreq,
         errorResponse
     );
 
@@ -475,53 +424,28 @@ bool RigCtlServerWorker::getFrequency(double& frequency, rig_errcode_e& rigCtlRC
     {
         qWarning("RigCtlServerWorker::getFrequency: get device frequency error %d: %s",
             httpRC, qPrintable(*errorResponse.getMessage()));
-        rigCtlRC = RIG_EINVAL;
+        rigCtlRC = httpRC == 501 ? RIG_ENIMPL : RIG_EINVAL;
         return false;
     }
 
-    QJsonObject *jsonObj = deviceSettingsResponse.asJsonObject();
-    double deviceFreq;
-
-    if (WebAPIUtils::getSubObjectDouble(*jsonObj, "centerFrequency", deviceFreq))
-    {
-        SWGSDRangel::SWGChannelSettings channelSettingsResponse;
-        // Get channel settings containg inputFrequencyOffset, so we can patch them
-        httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsGet(
-            m_settings.m_deviceIndex,
-            m_settings.m_channelIndex,
-            channelSettingsResponse,
-            errorResponse
-        );
-
-        if (httpRC/100 != 2)
-        {
-            qWarning("RigCtlServerWorker::setFrequency: get channel offset frequency error %d: %s",
-                httpRC, qPrintable(*errorResponse.getMessage()));
-            rigCtlRC = RIG_EINVAL;
-            return false;
-        }
-
-        QJsonObject *jsonObj2 = channelSettingsResponse.asJsonObject();
-        double channelOffset;
+    // Get channel inputFrequencyOffset
+    httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsFieldGet(
+        m_settings.m_deviceIndex,
+        m_settings.m_channelIndex,
+        WebAPIAdapterInterface::SettingsFieldInputFrequencyOffset,
+        channelOffset,
+        errorResponse
+    );
 
-        if (WebAPIUtils::getSubObjectDouble(*jsonObj2, "inputFrequencyOffset", channelOffset))
-        {
-            frequency = deviceFreq + channelOffset;
-        }
-        else
-        {
-            qWarning("RigCtlServerWorker::setFrequency: No inputFrequencyOffset key in channel settings");
-            rigCtlRC = RIG_ENIMPL;
-            return false;
-        }
-    }
-    else
+    if (httpRC/100 != 2)
     {
-        qWarning("RigCtlServerWorker::setFrequency: no centerFrequency key in device settings");
-        rigCtlRC = RIG_ENIMPL;
+        qWarning("RigCtlServerWorker::getFrequency: get channel offset frequency error %d: %s",
+            httpRC, qPrintable(*errorResponse.getMessage()));
+        rigCtlRC = httpRC == 501 ? RIG_ENIMPL : RIG_EINVAL;
         return false;
     }
 
+    frequency = deviceFreq + channelOffset;
     rigCtlRC = RIG_OK;
     return true;
 }
@@ -640,41 +564,24 @@ bool RigCtlServerWorker::changeModem(const char *newMode, const char *newModemId
         m_msgQueueToFeature->push(msg);
     }
 
-    SWGSDRangel::SWGChannelSettings swgChannelSettings;
-    QStringList channelSettingsKeys;
-    channelSettingsKeys.append("inputFrequencyOffset");
-    QString jsonSettingsStr = tr("\"inputFrequencyOffset\":%1").arg(currentOffset);
-
-    if (!strncmp(newMode, "LSB", 3))
-    {
-        int bw = newModemBw < 0 ? -3000 : -newModemBw;
-    }
+    // offset and bandwidth in one configuration so that the second does not revert the first
+    ChannelSettingsFields fields;
+    fields.setInputFrequencyOffset(currentOffset);
 
-    if (lsb || (newModemBw >= 0))
-    {
-        int bw = lsb ? (newModemBw < 0 ? -3000 : -newModemBw) : newModemBw;
-        channelSettingsKeys.append("rfBandwidth");
-        jsonSettingsStr.append(tr(",\"rfBandwidth\":%2").arg(bw));
+    if (lsb || (newModemBw >= 0)) {
+        fields.setRfBandwidth(lsb ? (newModemBw < 0 ? -3000 : -newModemBw) : newModemBw);
     }
 
-    QString jsonStr = tr("{ \"channelType\": \"%1\", \"%2Settings\": {%3}}")
-        .arg(QString(newModemId))
-        .arg(QString(newModemId))
-        .arg(jsonSettingsStr);
-    swgChannelSettings.fromJson(jsonStr);
-
-    httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsPutPatch(
+    httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsFieldsPatch(
         m_settings.m_deviceIndex,
         nbChannels-1, // new index
-        false, // PATCH
-        channelSettingsKeys,
-        swgChannelSettings,
+        fields,
         errorResponse
     );
 
     if (httpRC/100 != 2)
     {
-        qWarning("RigCtlServerWorker::changeModem: set channel settings error %d: %s",
+        qWarning("RigCtlServerWorker::changeModem: set channel offset frequency and bandwidth error %d: %s",
             httpRC, qPrintable(*errorResponse.getMessage()));
         rigCtlRC = RIG_EINVAL;
         return false;
@@ -686,37 +593,26 @@ bool RigCtlServerWorker::changeModem(const char *newMode, const char *newModemId
 
 bool RigCtlServerWorker::getMode(const char **mode, double& passband, rig_errcode_e& rigCtlRC)
 {
-    SWGSDRangel::SWGChannelSettings channelSettingsResponse;
     SWGSDRangel::SWGErrorResponse errorResponse;
+    QString channelType;
     int httpRC;
+    int i;
 
-    // Get channel settings containg inputFrequencyOffset, so we can patch them
-    httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsGet(
+    httpRC = m_webAPIAdapterInterface->devicesetChannelTypeGet(
         m_settings.m_deviceIndex,
         m_settings.m_channelIndex,
-        channelSettingsResponse,
+        channelType,
         errorResponse
     );
 
     if (httpRC/100 != 2)
     {
-        qWarning("RigCtlServerWorker::getModem: get channel settings error %d: %s",
+        qWarning("RigCtlServerWorker::getModem: get channel type error %d: %s",
             httpRC, qPrintable(*errorResponse.getMessage()));
         rigCtlRC = RIG_EINVAL;
         return false;
     }
 
-    QJsonObject *jsonObj = channelSettingsResponse.asJsonObject();
-    QString channelType;
-    int i;
-
-    if (!WebAPIUtils::getObjectString(*jsonObj, "channelType", channelType))
-    {
-        qWarning("RigCtlServerWorker::getModem: no channelType key in channel settings");
-        rigCtlRC = RIG_ENIMPL;
-        return false;
-    }
-
     for (i = 0; m_modeMap[i].mode != nullptr; i++)
     {
         if (!channelType.compare(m_modeMap[i].modem))
@@ -733,8 +629,15 @@ bool RigCtlServerWorker::getMode(const char **mode, double& passband, rig_errcod
         return false;
     }
 
+    httpRC = m_webAPIAdapterInterface->devicesetChannelSettingsFieldGet(
+        m_settings.m_deviceIndex,
+        m_settings.m_channelIndex,
+        WebAPIAdapterInterface::SettingsFieldRfBandwidth,
+        passband,
+        errorResponse
+    );
 
-    if (WebAPIUtils::getSubObjectDouble(*jsonObj, "rfBandwidth", passband))
+    if (httpRC/100 == 2)
     {
         if (!channelType.compare("SSBDemod"))
         {
@@ -37,6 +37,7 @@ class RigCtlServerWorker : public QObject
 public:
     class MsgConfigureRigCtlServerWorker : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureRigCtlServerWorker)
 
     public:
         const RigCtlServerSettings& getSettings() const { return m_settings; }
@@ -41,6 +41,7 @@ class SimplePTT : public Feature
 public:
     class MsgConfigureSimplePTT : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSimplePTT)
 
     public:
         const SimplePTTSettings& getSettings() const { return m_settings; }
@@ -34,6 +34,7 @@ class SimplePTTWorker : public QObject
 public:
     class MsgConfigureSimplePTTWorker : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSimplePTTWorker)
 
     public:
         const SimplePTTSettings& getSettings() const { return m_settings; }
@@ -37,6 +37,7 @@ class Bladerf1Output : public DeviceSampleSink {
 public:
 	class MsgConfigureBladerf1 : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureBladerf1)
 
 	public:
 		const BladeRF1OutputSettings& getSettings() const { return m_settings; }
@@ -38,6 +38,7 @@ class BladeRF2Output : public DeviceSampleSink {
 public:
     class MsgConfigureBladeRF2 : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureBladeRF2)
 
     public:
         const BladeRF2OutputSettings& getSettings() const { return m_settings; }
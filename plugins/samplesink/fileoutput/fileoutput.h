@@ -36,6 +36,7 @@ class FileOutput : public DeviceSampleSink {
 public:
 	class MsgConfigureFileOutput : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureFileOutput)
 
 	public:
 		const FileOutputSettings& getSettings() const { return m_settings; }
@@ -38,6 +38,7 @@ public:
 
 	class MsgConfigureHackRF : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureHackRF)
 
 	public:
 		const HackRFOutputSettings& getSettings() const { return m_settings; }
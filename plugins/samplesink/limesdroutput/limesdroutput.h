@@ -39,6 +39,7 @@ class LimeSDROutput : public DeviceSampleSink
 public:
     class MsgConfigureLimeSDR : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLimeSDR)
 
     public:
         const LimeSDROutputSettings& getSettings() const { return m_settings; }
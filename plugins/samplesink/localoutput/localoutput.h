@@ -40,6 +40,7 @@ class LocalOutput : public DeviceSampleSink {
 public:
     class MsgConfigureLocalOutput : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLocalOutput)
 
     public:
         const LocalOutputSettings& getSettings() const { return m_settings; }
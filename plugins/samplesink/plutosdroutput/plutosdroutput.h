@@ -38,6 +38,7 @@ class PlutoSDROutput : public DeviceSampleSink {
 public:
     class MsgConfigurePlutoSDR : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigurePlutoSDR)
 
     public:
         const PlutoSDROutputSettings& getSettings() const { return m_settings; }
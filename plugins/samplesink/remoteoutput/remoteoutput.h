@@ -43,6 +43,7 @@ class RemoteOutput : public DeviceSampleSink {
 public:
 	class MsgConfigureRemoteOutput : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureRemoteOutput)
 
 	public:
 		const RemoteOutputSettings& getSettings() const { return m_settings; }
@@ -51,6 +51,7 @@ class SoapySDROutput : public DeviceSampleSink {
 public:
     class MsgConfigureSoapySDROutput : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSoapySDROutput)
 
     public:
         const SoapySDROutputSettings& getSettings() const { return m_settings; }
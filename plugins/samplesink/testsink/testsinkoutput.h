@@ -37,6 +37,7 @@ class TestSinkOutput : public DeviceSampleSink {
 public:
 	class MsgConfigureTestSink : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureTestSink)
 
 	public:
 		const TestSinkSettings& getSettings() const { return m_settings; }
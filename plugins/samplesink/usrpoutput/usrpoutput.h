@@ -42,6 +42,7 @@ class USRPOutput : public DeviceSampleSink
 public:
     class MsgConfigureUSRP : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureUSRP)
 
     public:
         const USRPOutputSettings& getSettings() const { return m_settings; }
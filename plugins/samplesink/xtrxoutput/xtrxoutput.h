@@ -39,6 +39,7 @@ class XTRXOutput : public DeviceSampleSink
 public:
     class MsgConfigureXTRX : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureXTRX)
 
         public:
             const XTRXOutputSettings& getSettings() const { return m_settings; }
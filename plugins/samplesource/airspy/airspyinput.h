@@ -37,6 +37,7 @@ class AirspyInput : public DeviceSampleSource {
 public:
 	class MsgConfigureAirspy : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureAirspy)
 
 	public:
 		const AirspySettings& getSettings() const { return m_settings; }
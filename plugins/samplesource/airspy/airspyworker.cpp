@@ -27,7 +27,6 @@ AirspyWorker::AirspyWorker(struct airspy_device* dev, SampleSinkFifo* sampleFifo
 	QObject(parent),
 	m_running(false),
 	m_dev(dev),
-	m_convertBuffer(AIRSPY_BLOCKSIZE),
 	m_sampleFifo(sampleFifo),
 	m_samplerate(10),
 	m_log2Decim(0),
@@ -92,7 +91,8 @@ void AirspyWorker::setFcPos(int fcPos)
 //  Decimate according to specified log2 (ex: log2=4 => decim=16)
 void AirspyWorker::callbackIQ(const qint16* buf, qint32 len)
 {
-	SampleVector::iterator it = m_convertBuffer.begin();
+	SampleVector::iterator begin = m_sampleFifo->writeBegin(((len/2) >> m_log2Decim) + 1);
+	SampleVector::iterator it = begin;
 
 	if (m_log2Decim == 0)
 	{
@@ -180,12 +180,13 @@ void AirspyWorker::callbackIQ(const qint16* buf, qint32 len)
 		}
 	}
 
-	m_sampleFifo->write(m_convertBuffer.begin(), it);
+	m_sampleFifo->writeCommit(it - begin);
 }
 
 void AirspyWorker::callbackQI(const qint16* buf, qint32 len)
 {
-	SampleVector::iterator it = m_convertBuffer.begin();
+	SampleVector::iterator begin = m_sampleFifo->writeBegin(((len/2) >> m_log2Decim) + 1);
+	SampleVector::iterator it = begin;
 
 	if (m_log2Decim == 0)
 	{
@@ -273,7 +274,7 @@ void AirspyWorker::callbackQI(const qint16* buf, qint32 len)
 		}
 	}
 
-	m_sampleFifo->write(m_convertBuffer.begin(), it);
+	m_sampleFifo->writeCommit(it - begin);
 }
 
 int AirspyWorker::rx_callback(airspy_transfer_t* transfer)
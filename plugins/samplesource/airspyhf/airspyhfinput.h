@@ -38,6 +38,7 @@ class AirspyHFInput : public DeviceSampleSource {
 public:
 	class MsgConfigureAirspyHF : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureAirspyHF)
 
 	public:
 		const AirspyHFSettings& getSettings() const { return m_settings; }
@@ -39,6 +39,7 @@ class Bladerf1Input : public DeviceSampleSource {
 public:
 	class MsgConfigureBladerf1 : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureBladerf1)
 
 	public:
 		const BladeRF1InputSettings& getSettings() const { return m_settings; }
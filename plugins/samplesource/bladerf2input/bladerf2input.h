@@ -40,6 +40,7 @@ class BladeRF2Input : public DeviceSampleSource {
 public:
     class MsgConfigureBladeRF2 : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureBladeRF2)
 
     public:
         const BladeRF2InputSettings& getSettings() const { return m_settings; }
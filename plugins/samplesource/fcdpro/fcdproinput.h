@@ -46,6 +46,7 @@ class FCDProInput : public DeviceSampleSource {
 public:
 	class MsgConfigureFCDPro : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureFCDPro)
 
 	public:
 		const FCDProSettings& getSettings() const { return m_settings; }
@@ -46,6 +46,7 @@ class FCDProPlusInput : public DeviceSampleSource {
 public:
 	class MsgConfigureFCDProPlus : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureFCDProPlus)
 
 	public:
 		const FCDProPlusSettings& getSettings() const { return m_settings; }
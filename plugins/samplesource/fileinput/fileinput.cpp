@@ -32,6 +32,7 @@
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspengine.h"
 #include "dsp/filerecord.h"
+#include "dsp/filerecordchunked.h"
 #include "device/deviceapi.h"
 
 #include "fileinput.h"
@@ -89,6 +90,8 @@ void FileInput::openFileStream()
 {
 	//stopInput();
 
+	m_chunkedReader.close();
+
 	if (m_ifstream.is_open()) {
 		m_ifstream.close();
 	}
@@ -100,7 +103,37 @@ void FileInput::openFileStream()
 #endif
 	quint64 fileSize = m_ifstream.tellg();
 
-	if (fileSize > sizeof(FileRecord::Header))
+	if (FileRecordChunked::isChunkedFile(m_ifstream))
+	{
+		bool headerOK = m_chunkedReader.open(&m_ifstream);
+
+		if (headerOK)
+		{
+			m_sampleRate = m_chunkedReader.getSampleRate();
+			m_centerFrequency = m_chunkedReader.getCenterFrequency();
+			m_startingTimeStamp = m_chunkedReader.getStartTimestampUs() / 1000000UL;
+			m_sampleSize = m_chunkedReader.getSampleSize();
+			m_recordLengthMuSec = m_chunkedReader.getEndTimestampUs() - m_chunkedReader.getStartTimestampUs();
+			qDebug("FileInput::openFileStream: chunked record: %s index %d chunks %d gaps %d corrupted chunks",
+				m_chunkedReader.isIndexed() ? "with" : "rebuilt",
+				(int) m_chunkedReader.getIndex().size(),
+				m_chunkedReader.getNbGaps(),
+				m_chunkedReader.getNbCorruptedChunks());
+		}
+		else
+		{
+			qCritical("FileInput::openFileStream: invalid chunked record");
+			m_chunkedReader.close();
+			m_recordLengthMuSec = 0;
+		}
+
+		if (getMessageQueueToGUI())
+		{
+			MsgReportHeaderCRC *report = MsgReportHeaderCRC::create(headerOK);
+			getMessageQueueToGUI()->push(report);
+		}
+	}
+	else if (fileSize > sizeof(FileRecord::Header))
 	{
 	    FileRecord::Header header;
 	    m_ifstream.seekg(0,std::ios_base::beg);
@@ -152,7 +185,9 @@ void FileInput::openFileStream()
 	    getMessageQueueToGUI()->push(report);
 	}
 
-	if (m_recordLengthMuSec == 0) {
+	if (m_recordLengthMuSec == 0)
+	{
+	    m_chunkedReader.close();
 	    m_ifstream.close();
 	}
 }
@@ -161,7 +196,15 @@ void FileInput::seekFileStream(int seekMillis)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
-	if ((m_ifstream.is_open()) && m_fileInputWorker && !m_fileInputWorker->isRunning())
+	if (m_chunkedReader.isOpen() && m_fileInputWorker && !m_fileInputWorker->isRunning())
+	{
+        quint64 seekUs = (m_recordLengthMuSec * seekMillis) / 1000;
+        m_chunkedReader.seekTimestamp(m_chunkedReader.getStartTimestampUs() + seekUs);
+        seekUs = m_chunkedReader.getTimestampUs() - m_chunkedReader.getStartTimestampUs(); // may land after a gap
+        applyStreamChange(m_chunkedReader.getSampleRate(), m_chunkedReader.getCenterFrequency());
+        m_fileInputWorker->setSamplesCount((seekUs * m_sampleRate) / 1000000UL);
+	}
+	else if ((m_ifstream.is_open()) && m_fileInputWorker && !m_fileInputWorker->isRunning())
 	{
         quint64 seekPoint = ((m_recordLengthMuSec * seekMillis) / 1000) * m_sampleRate;
         seekPoint /= 1000000UL;
@@ -172,6 +215,41 @@ void FileInput::seekFileStream(int seekMillis)
 	}
 }
 
+void FileInput::applyStreamChange(int sampleRate, quint64 centerFrequency)
+{
+	if ((sampleRate == m_sampleRate) && (centerFrequency == m_centerFrequency)) {
+		return;
+	}
+
+	qDebug("FileInput::applyStreamChange: sample rate: %d S/s center frequency: %llu Hz", sampleRate, centerFrequency);
+	m_sampleRate = sampleRate;
+	m_centerFrequency = centerFrequency;
+
+	if (m_fileInputWorker) // worker is stopped
+	{
+		if (!m_sampleFifo.setSize(m_settings.m_accelerationFactor * m_sampleRate * sizeof(Sample))) {
+			qCritical("FileInput::applyStreamChange: could not reallocate sample FIFO");
+		}
+
+		m_fileInputWorker->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize);
+	}
+
+	DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+	m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+
+	if (getMessageQueueToGUI())
+	{
+		DSPSignalNotification *notifToGUI = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+		getMessageQueueToGUI()->push(notifToGUI);
+		MsgReportFileInputStreamData *report = MsgReportFileInputStreamData::create(m_sampleRate,
+			m_sampleSize,
+			m_centerFrequency,
+			m_startingTimeStamp,
+			m_recordLengthMuSec);
+		getMessageQueueToGUI()->push(report);
+	}
+}
+
 void FileInput::init()
 {
     DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
@@ -189,7 +267,12 @@ bool FileInput::start()
 	QMutexLocker mutexLocker(&m_mutex);
 	qDebug() << "FileInput::start";
 
-	if (m_ifstream.tellg() != (std::streampos)0)
+	if (m_chunkedReader.isOpen())
+	{
+		m_chunkedReader.seekStart();
+		applyStreamChange(m_chunkedReader.getSampleRate(), m_chunkedReader.getCenterFrequency());
+	}
+	else if (m_ifstream.tellg() != (std::streampos)0)
     {
 		m_ifstream.clear();
 		m_ifstream.seekg(sizeof(FileRecord::Header), std::ios::beg);
@@ -201,7 +284,13 @@ bool FileInput::start()
 		return false;
 	}
 
-	m_fileInputWorker = new FileInputWorker(&m_ifstream, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+	m_fileInputWorker = new FileInputWorker(
+		&m_ifstream,
+		&m_sampleFifo,
+		m_masterTimer,
+		&m_inputMessageQueue,
+		m_chunkedReader.isOpen() ? &m_chunkedReader : nullptr
+	);
 	m_fileInputWorker->moveToThread(&m_fileInputWorkerThread);
 	m_fileInputWorker->setSampleRateAndSize(m_settings.m_accelerationFactor * m_sampleRate, m_sampleSize); // Fast Forward: 1 corresponds to live. 1/2 is half speed, 2 is double speed
 	startWorker();
@@ -394,6 +483,28 @@ bool FileInput::handleMessage(const Message& message)
 
         return true;
     }
+    else if (FileInputWorker::MsgReportStreamChange::match(message))
+    {
+        FileInputWorker::MsgReportStreamChange& report = (FileInputWorker::MsgReportStreamChange&) message;
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if (m_fileInputWorker)
+        {
+            bool running = m_fileInputWorker->isRunning();
+
+            if (running) {
+                stopWorker();
+            }
+
+            applyStreamChange(report.getSampleRate(), report.getCenterFrequency());
+
+            if (running) {
+                startWorker();
+            }
+        }
+
+        return true;
+    }
     else if (FileInputWorker::MsgReportEOF::match(message))
     {
         qDebug() << "FileInput::handleMessage: MsgReportEOF";
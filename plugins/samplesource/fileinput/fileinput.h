@@ -30,6 +30,7 @@
 #include <QNetworkRequest>
 
 #include "dsp/devicesamplesource.h"
+#include "dsp/filerecordchunkedreader.h"
 #include "fileinputsettings.h"
 
 class QNetworkAccessManager;
@@ -42,6 +43,7 @@ class FileInput : public DeviceSampleSource {
 public:
 	class MsgConfigureFileInput : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureFileInput)
 
 	public:
 		const FileInputSettings& getSettings() const { return m_settings; }
@@ -333,6 +335,7 @@ public:
 	QMutex m_mutex;
 	FileInputSettings m_settings;
 	std::ifstream m_ifstream;
+	FileRecordChunkedReader m_chunkedReader; //!< open when playing a chunked record (.sdriqc)
 	FileInputWorker* m_fileInputWorker;
 	QThread m_fileInputWorkerThread;
 	QString m_deviceDescription;
@@ -350,6 +353,7 @@ public:
 	void stopWorker();
 	void openFileStream();
 	void seekFileStream(int seekMillis);
+	void applyStreamChange(int sampleRate, quint64 centerFrequency);
 	bool applySettings(const FileInputSettings& settings, bool force = false);
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const FileInputSettings& settings, bool force);
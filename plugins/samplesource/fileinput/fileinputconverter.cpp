@@ -0,0 +1,66 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/filerecordchunked.h"
+
+#include "fileinputconverter.h"
+
+FileInputConverter::FileInputConverter(const QString& fileName, QObject* parent) :
+	QObject(parent),
+	m_fileName(fileName),
+	m_cancel(false),
+	m_percent(-1)
+{}
+
+void FileInputConverter::convert()
+{
+	QString errorMessage;
+	QStringList convertedFileNames;
+	bool success;
+	FileRecordChunked::ConversionProgress progress = [this](int percent) { return reportProgress(percent); };
+
+	if (m_fileName.endsWith(".sdriqc"))
+	{
+		QString sdriqFileName = m_fileName.left(m_fileName.size() - 1);
+		success = FileRecordChunked::convertToSdrIQ(m_fileName, sdriqFileName, convertedFileNames, errorMessage, progress);
+	}
+	else
+	{
+		QString chunkedFileName = m_fileName + "c";
+		success = FileRecordChunked::convertFromSdrIQ(m_fileName, chunkedFileName, errorMessage, progress);
+
+		if (success) {
+			convertedFileNames.append(chunkedFileName);
+		}
+	}
+
+	qDebug("FileInputConverter::convert: %s %s", qPrintable(m_fileName), success ? "converted" : qPrintable(errorMessage));
+	emit finished(success, convertedFileNames, errorMessage);
+}
+
+bool FileInputConverter::reportProgress(int percent)
+{
+	if (percent != m_percent) // signal only on changes as this is called for each chunk
+	{
+		m_percent = percent;
+		emit progress(percent);
+	}
+
+	return !m_cancel;
+}
@@ -0,0 +1,54 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FILEINPUTCONVERTER_H
+#define INCLUDE_FILEINPUTCONVERTER_H
+
+#include <atomic>
+
+#include <QObject>
+#include <QString>
+#include <QStringList>
+
+/**
+ * Converts a .sdriq file to a chunked .sdriqc file or the reverse. Meant to be moved to a worker
+ * thread so that the GUI stays responsive on large files. Existing files are never overwritten.
+ */
+class FileInputConverter : public QObject {
+	Q_OBJECT
+
+public:
+	FileInputConverter(const QString& fileName, QObject* parent = nullptr);
+
+	void cancel() { m_cancel = true; } //!< can be called from any thread
+
+public slots:
+	void convert();
+
+signals:
+	void progress(int percent);
+	void finished(bool success, const QStringList& convertedFileNames, const QString& errorMessage);
+
+private:
+	QString m_fileName;
+	std::atomic<bool> m_cancel;
+	int m_percent;
+
+	bool reportProgress(int percent);
+};
+
+#endif // INCLUDE_FILEINPUTCONVERTER_H
@@ -21,7 +21,10 @@
 #include <QDateTime>
 #include <QString>
 #include <QFileDialog>
+#include <QFileInfo>
 #include <QMessageBox>
+#include <QProgressDialog>
+#include <QThread>
 
 #include "ui_fileinputgui.h"
 #include "plugin/pluginapi.h"
@@ -31,10 +34,12 @@
 #include "gui/basicdevicesettingsdialog.h"
 #include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
+#include "dsp/filerecordchunked.h"
 
 #include "mainwindow.h"
 
 #include "fileinputgui.h"
+#include "fileinputconverter.h"
 #include "device/deviceapi.h"
 #include "device/deviceuiset.h"
 
@@ -54,7 +59,10 @@ FileInputGUI::FileInputGUI(DeviceUISet *deviceUISet, QWidget* parent) :
 	m_samplesCount(0),
 	m_tickCount(0),
 	m_enableNavTime(false),
-	m_lastEngineState(DeviceAPI::StNotStarted)
+	m_lastEngineState(DeviceAPI::StNotStarted),
+	m_converter(nullptr),
+	m_converterThread(nullptr),
+	m_converterProgress(nullptr)
 {
 	ui->setupUi(this);
 	ui->centerFrequency->setColorMapper(ColorMapper(ColorMapper::GrayGold));
@@ -83,6 +91,12 @@ FileInputGUI::FileInputGUI(DeviceUISet *deviceUISet, QWidget* parent) :
 
 FileInputGUI::~FileInputGUI()
 {
+	if (m_converterThread)
+	{
+		m_converter->cancel();
+		m_converterThread->wait();
+	}
+
 	delete ui;
 }
 
@@ -298,7 +312,7 @@ void FileInputGUI::on_showFileDialog_clicked(bool checked)
 {
     (void) checked;
 	QString fileName = QFileDialog::getOpenFileName(this,
-	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq)"), 0, QFileDialog::DontUseNativeDialog);
+	    tr("Open I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq *.sdriqc)"), 0, QFileDialog::DontUseNativeDialog);
 
 	if (fileName != "")
 	{
@@ -309,6 +323,74 @@ void FileInputGUI::on_showFileDialog_clicked(bool checked)
 	}
 }
 
+void FileInputGUI::on_convertFile_clicked(bool checked)
+{
+    (void) checked;
+
+	if (m_converter) {
+		return;
+	}
+
+	QString fileName = QFileDialog::getOpenFileName(this,
+	    tr("Convert I/Q record file"), ".", tr("SDR I/Q Files (*.sdriq *.sdriqc)"), 0, QFileDialog::DontUseNativeDialog);
+
+	if (fileName == "") {
+		return;
+	}
+
+	m_converter = new FileInputConverter(fileName);
+	m_converterThread = new QThread();
+	m_converter->moveToThread(m_converterThread);
+	m_converterProgress = new QProgressDialog(tr("Converting %1").arg(QFileInfo(fileName).fileName()), tr("Cancel"), 0, 100, this);
+	m_converterProgress->setWindowModality(Qt::WindowModal);
+	m_converterProgress->setAutoClose(false);
+	m_converterProgress->setAutoReset(false);
+	m_converterProgress->setMinimumDuration(500);
+
+	connect(m_converterThread, SIGNAL(started()), m_converter, SLOT(convert()));
+	connect(m_converter, SIGNAL(progress(int)), m_converterProgress, SLOT(setValue(int)));
+	connect(m_converter, SIGNAL(finished(bool, const QStringList&, const QString&)),
+		this, SLOT(conversionFinished(bool, const QStringList&, const QString&)));
+	connect(m_converter, SIGNAL(finished(bool, const QStringList&, const QString&)), m_converterThread, SLOT(quit()));
+	connect(m_converterThread, SIGNAL(finished()), m_converter, SLOT(deleteLater()));
+	connect(m_converterThread, SIGNAL(finished()), m_converterThread, SLOT(deleteLater()));
+	connect(m_converterProgress, SIGNAL(canceled()), this, SLOT(cancelConversion()));
+
+	ui->convertFile->setEnabled(false);
+	m_converterThread->start();
+}
+
+void FileInputGUI::cancelConversion()
+{
+	if (m_converter) {
+		m_converter->cancel();
+	}
+}
+
+void FileInputGUI::conversionFinished(bool success, const QStringList& convertedFileNames, const QString& errorMessage)
+{
+	m_converterProgress->deleteLater();
+	m_converterProgress = nullptr;
+	m_converter = nullptr; // deleted with its thread
+	m_converterThread = nullptr;
+	ui->convertFile->setEnabled(true);
+
+	if (success)
+	{
+		QString text = tr("Converted to:\n%1").arg(convertedFileNames.join("\n"));
+
+		if (!errorMessage.isEmpty()) {
+			text += "\n" + errorMessage;
+		}
+
+		QMessageBox::information(this, tr("Conversion"), text);
+	}
+	else
+	{
+		QMessageBox::warning(this, tr("Conversion"), tr("Conversion failed: %1").arg(errorMessage));
+	}
+}
+
 void FileInputGUI::on_acceleration_currentIndexChanged(int index)
 {
     if (m_doApplySettings)
@@ -28,6 +28,9 @@
 #include "fileinput.h"
 
 class DeviceUISet;
+class FileInputConverter;
+class QProgressDialog;
+class QThread;
 
 namespace Ui {
 	class FileInputGUI;
@@ -70,6 +73,9 @@ private:
     quint64 m_deviceCenterFrequency; //!< Center frequency in device
 	int m_lastEngineState;
 	MessageQueue m_inputMessageQueue;
+	FileInputConverter *m_converter;          //!< record file conversion in progress if not null
+	QThread *m_converterThread;
+	QProgressDialog *m_converterProgress;
 
 	void blockApplySettings(bool block) { m_doApplySettings = !block; }
 	void displaySettings();
@@ -90,6 +96,9 @@ private slots:
 	void on_play_toggled(bool checked);
 	void on_navTimeSlider_valueChanged(int value);
 	void on_showFileDialog_clicked(bool checked);
+	void on_convertFile_clicked(bool checked);
+	void cancelConversion();
+	void conversionFinished(bool success, const QStringList& convertedFileNames, const QString& errorMessage);
 	void on_acceleration_currentIndexChanged(int index);
     void updateStatus();
 	void tick();
@@ -21,20 +21,24 @@
 #include <QDebug>
 
 #include "dsp/filerecord.h"
+#include "dsp/filerecordchunkedreader.h"
 #include "fileinputworker.h"
 #include "dsp/samplesinkfifo.h"
 #include "util/messagequeue.h"
 
 MESSAGE_CLASS_DEFINITION(FileInputWorker::MsgReportEOF, Message)
+MESSAGE_CLASS_DEFINITION(FileInputWorker::MsgReportStreamChange, Message)
 
 FileInputWorker::FileInputWorker(std::ifstream *samplesStream,
         SampleSinkFifo* sampleFifo,
         const QTimer& timer,
         MessageQueue *fileInputMessageQueue,
+        FileRecordChunkedReader *chunkedReader,
         QObject* parent) :
 	QObject(parent),
 	m_running(false),
 	m_ifstream(samplesStream),
+	m_chunkedReader(chunkedReader),
 	m_fileBuf(nullptr),
 	m_convertBuf(nullptr),
 	m_bufsize(0),
@@ -174,6 +178,12 @@ void FileInputWorker::tick()
             setBuffers(m_chunksize);
         }
 
+        if (m_chunkedReader)
+        {
+            tickChunked();
+            return;
+        }
+
 		// read samples directly feeding the SampleFifo (no callback)
 		m_ifstream->read(reinterpret_cast<char*>(m_fileBuf), m_chunksize);
 
@@ -191,6 +201,30 @@ void FileInputWorker::tick()
 	}
 }
 
+void FileInputWorker::tickChunked()
+{
+    int nbSamples = m_chunksize / (2 * m_samplebytes);
+    int nbRead = m_chunkedReader->read(m_fileBuf, nbSamples);
+    writeToSampleFifo(m_fileBuf, nbRead * 2 * m_samplebytes);
+    // position is given by the chunk timestamps so that gaps in the record show in the time display
+    quint64 positionUs = m_chunkedReader->getTimestampUs() - m_chunkedReader->getStartTimestampUs();
+    m_samplesCount = (positionUs * m_chunkedReader->getSampleRate()) / 1000000UL;
+
+    if (m_chunkedReader->parametersChanged())
+    {
+        MsgReportStreamChange *message = MsgReportStreamChange::create(
+            m_chunkedReader->getSampleRate(),
+            m_chunkedReader->getCenterFrequency()
+        );
+        m_fileInputMessageQueue->push(message);
+    }
+    else if (m_chunkedReader->atEnd())
+    {
+        MsgReportEOF *message = MsgReportEOF::create();
+        m_fileInputMessageQueue->push(message);
+    }
+}
+
 void FileInputWorker::writeToSampleFifo(const quint8* buf, qint32 nbBytes)
 {
 	if (m_samplesize == 16)
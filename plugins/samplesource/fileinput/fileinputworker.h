@@ -31,6 +31,7 @@
 
 class SampleSinkFifo;
 class MessageQueue;
+class FileRecordChunkedReader;
 
 class FileInputWorker : public QObject {
 	Q_OBJECT
@@ -50,10 +51,33 @@ public:
         { }
     };
 
+    class MsgReportStreamChange : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        int getSampleRate() const { return m_sampleRate; }
+        quint64 getCenterFrequency() const { return m_centerFrequency; }
+
+        static MsgReportStreamChange* create(int sampleRate, quint64 centerFrequency) {
+            return new MsgReportStreamChange(sampleRate, centerFrequency);
+        }
+
+    private:
+        int m_sampleRate;
+        quint64 m_centerFrequency;
+
+        MsgReportStreamChange(int sampleRate, quint64 centerFrequency) :
+            Message(),
+            m_sampleRate(sampleRate),
+            m_centerFrequency(centerFrequency)
+        { }
+    };
+
 	FileInputWorker(std::ifstream *samplesStream,
 	        SampleSinkFifo* sampleFifo,
 	        const QTimer& timer,
 	        MessageQueue *fileInputMessageQueue,
+	        FileRecordChunkedReader *chunkedReader = nullptr, //!< reads chunked records instead of the raw stream if set
 	        QObject* parent = NULL);
 	~FileInputWorker();
 
@@ -69,6 +93,7 @@ private:
 	volatile bool m_running;
 
 	std::ifstream* m_ifstream;
+	FileRecordChunkedReader *m_chunkedReader;
 	quint8  *m_fileBuf;
 	quint8  *m_convertBuf;
 	std::size_t m_bufsize;
@@ -87,6 +112,7 @@ private:
 
 	//void decimate1(SampleVector::iterator* it, const qint16* buf, qint32 len);
 	void writeToSampleFifo(const quint8* buf, qint32 nbBytes);
+	void tickChunked();
 
 private slots:
 	void tick();
@@ -39,6 +39,7 @@ public:
 
 	class MsgConfigureHackRF : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureHackRF)
 
 	public:
 		const HackRFInputSettings& getSettings() const { return m_settings; }
@@ -38,6 +38,7 @@ class KiwiSDRInput : public DeviceSampleSource {
 public:
 	class MsgConfigureKiwiSDR : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureKiwiSDR)
 
 	public:
 		const KiwiSDRSettings& getSettings() const { return m_settings; }
@@ -39,6 +39,7 @@ class LimeSDRInput : public DeviceSampleSource
 public:
     class MsgConfigureLimeSDR : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLimeSDR)
 
     public:
         const LimeSDRInputSettings& getSettings() const { return m_settings; }
@@ -25,7 +25,6 @@ LimeSDRInputThread::LimeSDRInputThread(lms_stream_t* stream, SampleSinkFifo* sam
     QThread(parent),
     m_running(false),
     m_stream(stream),
-    m_convertBuffer(DeviceLimeSDR::blockSize),
     m_sampleFifo(sampleFifo),
     m_log2Decim(0),
     m_iqOrder(true)
@@ -108,7 +107,8 @@ void LimeSDRInputThread::run()
 //  Decimate according to specified log2 (ex: log2=4 => decim=16)
 void LimeSDRInputThread::callbackIQ(const qint16* buf, qint32 len)
 {
-    SampleVector::iterator it = m_convertBuffer.begin();
+    SampleVector::iterator begin = m_sampleFifo->writeBegin(((len/2) >> m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     switch (m_log2Decim)
     {
@@ -137,12 +137,13 @@ void LimeSDRInputThread::callbackIQ(const qint16* buf, qint32 len)
         break;
     }
 
-    m_sampleFifo->write(m_convertBuffer.begin(), it);
+    m_sampleFifo->writeCommit(it - begin);
 }
 
 void LimeSDRInputThread::callbackQI(const qint16* buf, qint32 len)
 {
-    SampleVector::iterator it = m_convertBuffer.begin();
+    SampleVector::iterator begin = m_sampleFifo->writeBegin(((len/2) >> m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     switch (m_log2Decim)
     {
@@ -171,5 +172,5 @@ void LimeSDRInputThread::callbackQI(const qint16* buf, qint32 len)
         break;
     }
 
-    m_sampleFifo->write(m_convertBuffer.begin(), it);
+    m_sampleFifo->writeCommit(it - begin);
 }
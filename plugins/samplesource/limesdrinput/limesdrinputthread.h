@@ -51,7 +51,6 @@ private:
 
     lms_stream_t* m_stream;
     qint16 m_buf[2*DeviceLimeSDR::blockSize]; //must hold I+Q values of each sample hence 2xcomplex size
-    SampleVector m_convertBuffer;
     SampleSinkFifo* m_sampleFifo;
 
     unsigned int m_log2Decim; // soft decimation
@@ -42,10 +42,10 @@ LocalInput::LocalInput(DeviceAPI *deviceAPI) :
     m_deviceAPI(deviceAPI),
     m_settings(),
     m_centerFrequency(0),
+    m_sampleRate(48000),
 	m_deviceDescription("LocalInput")
 {
-	m_sampleFifo.setSize(96000 * 4);
-
+    // samples come as blocks from the local sink channel: the sample FIFO is not used
     m_deviceAPI->setNbSourceStreams(1);
 
     m_networkManager = new QNetworkAccessManager();
@@ -78,6 +78,7 @@ bool LocalInput::start()
 void LocalInput::stop()
 {
 	qDebug() << "LocalInput::stop";
+	m_sampleBlockQueue.clear();
 }
 
 QByteArray LocalInput::serialize() const
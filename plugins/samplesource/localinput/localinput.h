@@ -40,6 +40,7 @@ class LocalInput : public DeviceSampleSource {
 public:
     class MsgConfigureLocalInput : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureLocalInput)
 
     public:
         const LocalInputSettings& getSettings() const { return m_settings; }
@@ -116,6 +117,7 @@ public:
     virtual void setMessageQueueToGUI(MessageQueue *queue);
 	virtual const QString& getDeviceDescription() const;
 	virtual int getSampleRate() const;
+    virtual SampleBlockQueue* getSampleBlockQueue() { return &m_sampleBlockQueue; } //!< blocks handed over by the local sink channel
     virtual void setSampleRate(int sampleRate);
 	virtual quint64 getCenterFrequency() const;
     virtual void setCenterFrequency(qint64 centerFrequency);
@@ -164,6 +166,7 @@ private:
 	QString m_deviceDescription;
     QNetworkAccessManager *m_networkManager;
     QNetworkRequest m_networkRequest;
+    SampleBlockQueue m_sampleBlockQueue;
 
     void applySettings(const LocalInputSettings& settings, bool force = false);
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
@@ -38,6 +38,7 @@ class PerseusInput : public DeviceSampleSource {
 public:
     class MsgConfigurePerseus : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigurePerseus)
 
     public:
         const PerseusSettings& getSettings() const { return m_settings; }
@@ -39,6 +39,7 @@ class PlutoSDRInput : public DeviceSampleSource {
 public:
     class MsgConfigurePlutoSDR : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigurePlutoSDR)
 
     public:
         const PlutoSDRInputSettings& getSettings() const { return m_settings; }
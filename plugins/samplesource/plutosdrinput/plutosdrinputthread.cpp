@@ -26,8 +26,6 @@ PlutoSDRInputThread::PlutoSDRInputThread(uint32_t blocksizeSamples, DevicePlutoS
     m_running(false),
     m_plutoBox(plutoBox),
     m_blockSizeSamples(blocksizeSamples),
-    m_convertBuffer(blocksizeSamples),
-    m_convertIt(m_convertBuffer.begin()),
     m_sampleFifo(sampleFifo),
     m_log2Decim(0),
     m_fcPos(PlutoSDRInputSettings::FC_POS_CENTER),
@@ -129,7 +127,8 @@ void PlutoSDRInputThread::run()
 //  Decimate according to specified log2 (ex: log2=4 => decim=16)
 void PlutoSDRInputThread::convertIQ(const qint16* buf, qint32 len)
 {
-    SampleVector::iterator it = m_convertBuffer.begin();
+    SampleVector::iterator begin = m_sampleFifo->writeBegin(((len/2) >> m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_log2Decim == 0)
     {
@@ -217,12 +216,13 @@ void PlutoSDRInputThread::convertIQ(const qint16* buf, qint32 len)
         }
     }
 
-    m_sampleFifo->write(m_convertBuffer.begin(), it);
+    m_sampleFifo->writeCommit(it - begin);
 }
 
 void PlutoSDRInputThread::convertQI(const qint16* buf, qint32 len)
 {
-    SampleVector::iterator it = m_convertBuffer.begin();
+    SampleVector::iterator begin = m_sampleFifo->writeBegin(((len/2) >> m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_log2Decim == 0)
     {
@@ -310,5 +310,5 @@ void PlutoSDRInputThread::convertQI(const qint16* buf, qint32 len)
         }
     }
 
-    m_sampleFifo->write(m_convertBuffer.begin(), it);
+    m_sampleFifo->writeCommit(it - begin);
 }
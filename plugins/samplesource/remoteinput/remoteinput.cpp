@@ -431,6 +431,9 @@ void RemoteInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& respons
 
     response.getRemoteInputReport()->setMinNbBlocks(m_remoteInputUDPHandler->getMinNbBlocks());
     response.getRemoteInputReport()->setMaxNbRecovery(m_remoteInputUDPHandler->getMaxNbRecovery());
+    response.getRemoteInputReport()->setTransportEncoding(m_remoteInputUDPHandler->getTransportEncoding());
+    response.getRemoteInputReport()->setCompressionRatio(m_remoteInputUDPHandler->getCompressionRatio());
+    response.getRemoteInputReport()->setCodecTimeUs(m_remoteInputUDPHandler->getDecodeTimeUs());
 }
 
 void RemoteInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const RemoteInputSettings& settings, bool force)
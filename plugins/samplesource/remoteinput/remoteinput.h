@@ -41,6 +41,7 @@ class RemoteInput : public DeviceSampleSource {
 public:
     class MsgConfigureRemoteInput : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureRemoteInput)
 
     public:
         const RemoteInputSettings& getSettings() const { return m_settings; }
@@ -144,6 +145,9 @@ public:
         int getNbFECBlocksPerFrame() const { return m_nbFECBlocksPerFrame; }
         int getSampleBits() const { return m_sampleBits; }
         int getSampleBytes() const { return m_sampleBytes; }
+        int getTransportEncoding() const { return m_transportEncoding; }
+        float getCompressionRatio() const { return m_compressionRatio; }
+        float getDecodeTimeUs() const { return m_decodeTimeUs; }
 
 		static MsgReportRemoteInputStreamTiming* create(uint64_t tv_msec,
 				float bufferLenSec,
@@ -159,7 +163,10 @@ public:
                 int nbOriginalBlocksPerFrame,
                 int nbFECBlocksPerFrame,
                 int sampleBits,
-                int sampleBytes)
+                int sampleBytes,
+                int transportEncoding,
+                float compressionRatio,
+                float decodeTimeUs)
 		{
 			return new MsgReportRemoteInputStreamTiming(tv_msec,
 					bufferLenSec,
@@ -175,7 +182,10 @@ public:
                     nbOriginalBlocksPerFrame,
                     nbFECBlocksPerFrame,
                     sampleBits,
-                    sampleBytes);
+                    sampleBytes,
+                    transportEncoding,
+                    compressionRatio,
+                    decodeTimeUs);
 		}
 
 	protected:
@@ -194,6 +204,9 @@ public:
         int      m_nbFECBlocksPerFrame;
         int      m_sampleBits;
         int      m_sampleBytes;
+        int      m_transportEncoding;
+        float    m_compressionRatio;
+        float    m_decodeTimeUs;
 
 		MsgReportRemoteInputStreamTiming(uint64_t tv_msec,
 				float bufferLenSec,
@@ -209,7 +222,10 @@ public:
                 int nbOriginalBlocksPerFrame,
                 int nbFECBlocksPerFrame,
                 int sampleBits,
-                int sampleBytes) :
+                int sampleBytes,
+                int transportEncoding,
+                float compressionRatio,
+                float decodeTimeUs) :
 			Message(),
 			m_tv_msec(tv_msec),
 			m_framesDecodingStatus(framesDecodingStatus),
@@ -225,7 +241,10 @@ public:
             m_nbOriginalBlocksPerFrame(nbOriginalBlocksPerFrame),
             m_nbFECBlocksPerFrame(nbFECBlocksPerFrame),
             m_sampleBits(sampleBits),
-            m_sampleBytes(sampleBytes)
+            m_sampleBytes(sampleBytes),
+            m_transportEncoding(transportEncoding),
+            m_compressionRatio(compressionRatio),
+            m_decodeTimeUs(decodeTimeUs)
 		{ }
 	};
 
@@ -20,8 +20,10 @@
 #include <cstring>
 #include <cmath>
 #include <algorithm>
+#include <chrono>
 #include <boost/crc.hpp>
 #include <boost/cstdint.hpp>
+#include "channel/remotedatacodec.h"
 #include "remoteinputbuffer.h"
 
 
@@ -37,6 +39,7 @@ RemoteInputBuffer::RemoteInputBuffer() :
         m_curNbRecovery(0),
         m_maxNbRecovery(0),
         m_framesDecoded(true),
+        m_curEncoding(0),
         m_readIndex(0),
         m_readBuffer(0),
         m_readSize(0),
@@ -100,7 +103,7 @@ void RemoteInputBuffer::setNbDecoderSlots(int nbDecoderSlots)
 
 void RemoteInputBuffer::setBufferLenSec(const RemoteMetaDataFEC& metaData)
 {
-    m_bufferLenSec = (float) m_framesNbBytes / (float) (metaData.m_sampleRate * metaData.m_sampleBytes * 2);
+    m_bufferLenSec = (float) m_framesNbBytes / (float) (metaData.m_sampleRate * (metaData.m_sampleBytes & 0xF) * 2);
 }
 
 void RemoteInputBuffer::initDecodeAllSlots()
@@ -112,6 +115,9 @@ void RemoteInputBuffer::initDecodeAllSlots()
         m_decoderSlots[i].m_recoveryCount = 0;
         m_decoderSlots[i].m_decoded = false;
         m_decoderSlots[i].m_metaRetrieved = false;
+        m_decoderSlots[i].m_blockBytes = sizeof(RemoteProtectedBlock);
+        m_decoderSlots[i].m_encoding = RemoteDataCodec::EncodingRaw;
+        m_decoderSlots[i].m_decodeTimeUs = 0.0f;
         resetOriginalBlocks(i);
         memset((void *) m_decoderSlots[i].m_recoveryBlocks, 0, RemoteNbOrginalBlocks * sizeof(RemoteProtectedBlock));
     }
@@ -141,6 +147,19 @@ void RemoteInputBuffer::initDecodeSlot(int slotIndex)
         m_maxNbRecovery = m_curNbRecovery;
     }
 
+    if (m_decoderSlots[slotIndex].m_blockCount > 0)
+    {
+        if (m_decoderSlots[slotIndex].m_encoding != m_curEncoding)
+        {
+            m_curEncoding = m_decoderSlots[slotIndex].m_encoding;
+            m_avgCompressionRatio.reset();
+            m_avgDecodeTimeUs.reset();
+        }
+
+        m_avgCompressionRatio((float) sizeof(RemoteProtectedBlock) / m_decoderSlots[slotIndex].m_blockBytes);
+        m_avgDecodeTimeUs(m_decoderSlots[slotIndex].m_decodeTimeUs);
+    }
+
     // void the slot
 
     m_decoderSlots[slotIndex].m_blockCount = 0;
@@ -148,6 +167,9 @@ void RemoteInputBuffer::initDecodeSlot(int slotIndex)
     m_decoderSlots[slotIndex].m_recoveryCount = 0;
     m_decoderSlots[slotIndex].m_decoded = false;
     m_decoderSlots[slotIndex].m_metaRetrieved = false;
+    m_decoderSlots[slotIndex].m_blockBytes = sizeof(RemoteProtectedBlock);
+    m_decoderSlots[slotIndex].m_encoding = RemoteDataCodec::EncodingRaw;
+    m_decoderSlots[slotIndex].m_decodeTimeUs = 0.0f;
 
     resetOriginalBlocks(slotIndex);
     memset((void *) m_decoderSlots[slotIndex].m_recoveryBlocks, 0, RemoteNbOrginalBlocks * sizeof(RemoteProtectedBlock));
@@ -183,7 +205,7 @@ void RemoteInputBuffer::rwCorrectionEstimate(int slotIndex)
 		}
 
          // calculate exponential moving average on floating point for better accuracy (was int)
-        double newCorrection = ((double) dBytes) / (((int) m_currentMeta.m_sampleBytes) * 2 * m_nbReads);
+        double newCorrection = ((double) dBytes) / (((int) (m_currentMeta.m_sampleBytes & 0xF)) * 2 * m_nbReads);
         m_balCorrection = 0.25*m_balCorrection + 0.75*newCorrection; // exponential average with alpha = 0.75 (original is wrong)
         //m_balCorrection = (m_balCorrection / 4) + (dBytes / (int) (m_currentMeta.m_sampleBytes * 2 * m_nbReads)); // correction is in number of samples. Alpha = 0.25
 
@@ -208,7 +230,7 @@ void RemoteInputBuffer::checkSlotData(int slotIndex)
     if (sampleRate > 0)
     {
         int64_t ts = m_currentMeta.m_tv_sec * 1000000LL + m_currentMeta.m_tv_usec;
-        ts -= (rwDelayBytes * 1000000LL) / (sampleRate * 2 * m_currentMeta.m_sampleBytes);
+        ts -= (rwDelayBytes * 1000000LL) / (sampleRate * 2 * (m_currentMeta.m_sampleBytes & 0xF));
         m_tvOut_sec = ts / 1000000LL;
         m_tvOut_usec = ts - (m_tvOut_sec * 1000000LL);
     }
@@ -222,11 +244,40 @@ void RemoteInputBuffer::checkSlotData(int slotIndex)
     }
 }
 
-void RemoteInputBuffer::writeData(char *array)
+void RemoteInputBuffer::decodeBlock(int slotIndex, int blockIndex, const RemoteProtectedBlock& encodedBlock, int sampleBytes)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    if (!RemoteDataCodec::decodeBlock(
+        encodedBlock.buf,
+        m_frames[slotIndex].m_blocks[blockIndex - 1].buf,
+        sampleBytes,
+        m_decoderSlots[slotIndex].m_encoding))
+    {
+        qDebug("RemoteInputBuffer::decodeBlock: invalid encoded block #%d", blockIndex);
+    }
+
+    std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+    m_decoderSlots[slotIndex].m_decodeTimeUs += std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / 1000.0f;
+}
+
+void RemoteInputBuffer::writeData(char *array, int size)
 {
     RemoteSuperBlock *superBlock = (RemoteSuperBlock *) array;
     int frameIndex = superBlock->m_header.m_frameIndex;
     int decoderIndex = frameIndex % m_nbDecoderSlots;
+    int blockBytes = size - (int) sizeof(RemoteHeader);
+    int encoding = superBlock->m_header.m_encoding;
+    int sampleBytes = superBlock->m_header.m_sampleBytes & 0xF;
+
+    // raw blocks come in full size datagrams. Encoded blocks come in datagrams shortened to the largest encoded block of the frame.
+    if ((blockBytes <= 0)
+     || (blockBytes > (int) sizeof(RemoteProtectedBlock))
+     || ((encoding == RemoteDataCodec::EncodingRaw) && (blockBytes != (int) sizeof(RemoteProtectedBlock))))
+    {
+        qDebug("RemoteInputBuffer::writeData: discard datagram of %d bytes with encoding %d", size, encoding);
+        return;
+    }
 
     // frame break
 
@@ -254,6 +305,18 @@ void RemoteInputBuffer::writeData(char *array)
         int blockIndex = superBlock->m_header.m_blockIndex;
         int blockCount = m_decoderSlots[decoderIndex].m_blockCount;
         int recoveryCount = m_decoderSlots[decoderIndex].m_recoveryCount;
+
+        if (blockCount == 0) // the first block received sets the frame encoding and block size
+        {
+            m_decoderSlots[decoderIndex].m_blockBytes = blockBytes;
+            m_decoderSlots[decoderIndex].m_encoding = encoding;
+        }
+        else if ((blockBytes != m_decoderSlots[decoderIndex].m_blockBytes) || (encoding != m_decoderSlots[decoderIndex].m_encoding))
+        {
+            qDebug("RemoteInputBuffer::writeData: discard block #%d inconsistent with frame", blockIndex);
+            return;
+        }
+
         m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[blockCount].Index = blockIndex;
 
         if (blockIndex == 0) // first block with meta
@@ -261,11 +324,18 @@ void RemoteInputBuffer::writeData(char *array)
             m_decoderSlots[decoderIndex].m_metaRetrieved = true;
         }
 
-        if (blockIndex < RemoteNbOrginalBlocks) // original data
+        if ((blockIndex < RemoteNbOrginalBlocks) && ((blockIndex == 0) || (encoding == RemoteDataCodec::EncodingRaw))) // original data
         {
             m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[blockCount].Block = (void *) storeOriginalBlock(decoderIndex, blockIndex, superBlock->m_protectedBlock);
             m_decoderSlots[decoderIndex].m_originalCount++;
         }
+        else if (blockIndex < RemoteNbOrginalBlocks) // encoded original data: keep encoded block for FEC and decode samples
+        {
+            m_decoderSlots[decoderIndex].m_originalBlocks[blockIndex] = superBlock->m_protectedBlock;
+            m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks[blockCount].Block = (void *) &m_decoderSlots[decoderIndex].m_originalBlocks[blockIndex];
+            m_decoderSlots[decoderIndex].m_originalCount++;
+            decodeBlock(decoderIndex, blockIndex, superBlock->m_protectedBlock, sampleBytes);
+        }
         else // recovery data
         {
             m_decoderSlots[decoderIndex].m_recoveryBlocks[recoveryCount] = superBlock->m_protectedBlock;
@@ -282,7 +352,7 @@ void RemoteInputBuffer::writeData(char *array)
 
         if (m_cm256_OK && (m_decoderSlots[decoderIndex].m_recoveryCount > 0)) // recovery data used => need to decode FEC
         {
-            m_paramsCM256.BlockBytes = sizeof(RemoteProtectedBlock); // never changes
+            m_paramsCM256.BlockBytes = m_decoderSlots[decoderIndex].m_blockBytes;
             m_paramsCM256.OriginalCount = RemoteNbOrginalBlocks;  // never changes
 
             if (m_decoderSlots[decoderIndex].m_metaRetrieved) {
@@ -331,7 +401,11 @@ void RemoteInputBuffer::writeData(char *array)
                         }
                     }
 
-                    storeOriginalBlock(decoderIndex, blockIndex, *recoveredBlock);
+                    if ((blockIndex == 0) || (m_decoderSlots[decoderIndex].m_encoding == RemoteDataCodec::EncodingRaw)) {
+                        storeOriginalBlock(decoderIndex, blockIndex, *recoveredBlock);
+                    } else {
+                        decodeBlock(decoderIndex, blockIndex, *recoveredBlock, sampleBytes);
+                    }
 
                     qDebug() << "RemoteInputBuffer::writeData: recovered block #" << blockIndex;
                 } // restore missing blocks
@@ -350,7 +424,7 @@ void RemoteInputBuffer::writeData(char *array)
                 {
                     setBufferLenSec(*metaData);
                     m_balCorrLimit = sampleRate / 400; // +/- 5% correction max per read
-                    m_readNbBytes = (sampleRate * metaData->m_sampleBytes * 2) / 20;
+                    m_readNbBytes = (sampleRate * (metaData->m_sampleBytes & 0xF) * 2) / 20;
                 }
 
                 printMeta("RemoteInputBuffer::writeData: new meta", metaData); // print for change other than timestamp
@@ -41,7 +41,7 @@ public:
     void setBufferLenSec(const RemoteMetaDataFEC& metaData);
 
 	// R/W operations
-	void writeData(char *array); //!< Write data into buffer.
+	void writeData(char *array, int size); //!< Write data of one datagram into buffer.
 	uint8_t *readData(int32_t length);            //!< Read data from buffer
 
 	// meta data
@@ -60,6 +60,9 @@ public:
     float getAvgNbBlocks() const { return m_avgNbBlocks; }
     float getAvgOriginalBlocks() const { return m_avgOrigBlocks; }
     float getAvgNbRecovery() const { return m_avgNbRecovery; }
+    int getCurEncoding() const { return m_curEncoding; }
+    float getAvgCompressionRatio() const { return m_avgCompressionRatio.instantAverage(); }
+    float getAvgDecodeTimeUs() const { return m_avgDecodeTimeUs.instantAverage(); }
 
     int getMinNbBlocks()
     {
@@ -124,7 +127,7 @@ private:
     struct DecoderSlot
     {
         RemoteProtectedBlock m_blockZero;                                       //!< First block of a frame. Has meta data.
-        RemoteProtectedBlock m_originalBlocks[RemoteNbOrginalBlocks];        //!< Original blocks retrieved directly or by later FEC
+        RemoteProtectedBlock m_originalBlocks[RemoteNbOrginalBlocks];        //!< Encoded original blocks as received (decoded in frames buffer)
         RemoteProtectedBlock m_recoveryBlocks[RemoteNbOrginalBlocks];        //!< Recovery blocks (FEC blocks) with max size
         CM256::cm256_block      m_cm256DescriptorBlocks[RemoteNbOrginalBlocks]; //!< CM256 decoder descriptors (block addresses and block indexes)
         int                     m_blockCount;         //!< number of blocks received for this frame
@@ -132,6 +135,9 @@ private:
         int                     m_recoveryCount;      //!< number of recovery blocks received
         bool                    m_decoded;            //!< true if decoded
         bool                    m_metaRetrieved;      //!< true if meta data (block zero) was retrieved
+        int                     m_blockBytes;         //!< number of significant bytes per block (FEC block size)
+        int                     m_encoding;           //!< transport encoding of the frame (RemoteDataCodec::Encoding)
+        float                   m_decodeTimeUs;       //!< time spent decoding encoded blocks
         DecoderSlot() {}
     };
 
@@ -152,6 +158,9 @@ private:
     MovingAverageUtil<int, int, 10> m_avgOrigBlocks; //!< (stats) average number of original blocks received
     MovingAverageUtil<int, int, 10> m_avgNbRecovery; //!< (stats) average number of recovery blocks used
     bool                 m_framesDecoded;        //!< [stats] true if all frames were decoded since last poll
+    int                  m_curEncoding;          //!< (stats) transport encoding of the last frame
+    MovingAverageUtil<float, double, 16> m_avgCompressionRatio; //!< (stats) average ratio of raw to encoded block sizes
+    MovingAverageUtil<float, double, 16> m_avgDecodeTimeUs;     //!< (stats) average frame decoding time in microseconds
     int                  m_readIndex;            //!< current byte read index in frames buffer
     int                  m_wrDeltaEstimate;      //!< Sampled estimate of write to read indexes difference
     uint32_t             m_tvOut_sec;            //!< Estimated returned samples timestamp (seconds)
@@ -214,6 +223,7 @@ private:
     void rwCorrectionEstimate(int slotIndex);
     void checkSlotData(int slotIndex);
     void initDecodeSlot(int slotIndex);
+    void decodeBlock(int slotIndex, int blockIndex, const RemoteProtectedBlock& encodedBlock, int sampleBytes);
 
     static void printMeta(const QString& header, RemoteMetaDataFEC *metaData);
 };
@@ -62,6 +62,9 @@ RemoteInputGui::RemoteInputGui(DeviceUISet *deviceUISet, QWidget* parent) :
     m_nbFECBlocks(0),
     m_sampleBits(16), // assume 16 bits to start with
     m_sampleBytes(2),
+    m_transportEncoding(0),
+    m_compressionRatio(1.0f),
+    m_decodeTimeUs(0.0f),
     m_samplesCount(0),
     m_tickCount(0),
     m_addressEdited(false),
@@ -200,6 +203,9 @@ bool RemoteInputGui::handleMessage(const Message& message)
         m_nbOriginalBlocks = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getNbOriginalBlocksPerFrame();
         m_sampleBits = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getSampleBits();
         m_sampleBytes = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getSampleBytes();
+        m_transportEncoding = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getTransportEncoding();
+        m_compressionRatio = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getCompressionRatio();
+        m_decodeTimeUs = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getDecodeTimeUs();
 
         int nbFECBlocks = ((RemoteInput::MsgReportRemoteInputStreamTiming&)message).getNbFECBlocksPerFrame();
 
@@ -497,6 +503,20 @@ void RemoteInputGui::updateWithStreamTime()
 
     ui->sampleBitsText->setText(tr("%1b").arg(m_sampleBits));
 
+    if (m_transportEncoding == 0)
+    {
+        ui->sampleBitsText->setToolTip(tr("Sample size (bits)"));
+    }
+    else
+    {
+        int packing = m_transportEncoding & 3;
+        ui->sampleBitsText->setToolTip(tr("Sample size (bits) - transport %1 bits%2 ratio %3 decode %4 us")
+            .arg(packing == 1 ? 8 : 12)
+            .arg(m_transportEncoding & 4 ? " LZ4" : "")
+            .arg(QString::number(m_compressionRatio, 'f', 2))
+            .arg(QString::number(m_decodeTimeUs, 'f', 0)));
+    }
+
     if (updateEventCounts)
     {
         displayEventCounts();
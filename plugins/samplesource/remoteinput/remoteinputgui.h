@@ -81,6 +81,9 @@ private:
     int m_nbFECBlocks;
     int m_sampleBits;
     int m_sampleBytes;
+    int m_transportEncoding;
+    float m_compressionRatio;
+    float m_decodeTimeUs;
 
 	int m_samplesCount;
 	std::size_t m_tickCount;
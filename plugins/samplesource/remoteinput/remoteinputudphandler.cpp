@@ -197,19 +197,18 @@ void RemoteInputUDPHandler::dataReadyRead()
 
 	while (m_dataSocket->hasPendingDatagrams() && m_dataConnected)
 	{
-		qint64 pendingDataSize = m_dataSocket->pendingDatagramSize();
-		m_udpReadBytes += m_dataSocket->readDatagram(&m_udpBuf[m_udpReadBytes], pendingDataSize, &m_remoteAddress, 0);
+		// datagrams of encoded frames are shorter than RemoteUdpSize
+		m_udpReadBytes = m_dataSocket->readDatagram(m_udpBuf, RemoteUdpSize, &m_remoteAddress, 0);
 
-		if (m_udpReadBytes == RemoteUdpSize) {
+		if (m_udpReadBytes > (qint64) sizeof(RemoteHeader)) {
 		    processData();
-		    m_udpReadBytes = 0;
 		}
 	}
 }
 
 void RemoteInputUDPHandler::processData()
 {
-    m_remoteInputBuffer.writeData(m_udpBuf);
+    m_remoteInputBuffer.writeData(m_udpBuf, m_udpReadBytes);
     const RemoteMetaDataFEC& metaData =  m_remoteInputBuffer.getCurrentMeta();
     bool change = false;
 
@@ -260,7 +259,7 @@ void RemoteInputUDPHandler::processData()
 void RemoteInputUDPHandler::adjustNbDecoderSlots(const RemoteMetaDataFEC& metaData)
 {
     int sampleRate = metaData.m_sampleRate;
-    int sampleBytes = metaData.m_sampleBytes;
+    int sampleBytes = metaData.m_sampleBytes & 0xF;
     int bufferFrameSize = RemoteInputBuffer::getBufferFrameSize();
     float fNbDecoderSlots = (float) (4 * sampleBytes * sampleRate) / (float) bufferFrameSize;
     int rawNbDecoderSlots = ((((int) ceil(fNbDecoderSlots)) / 2) * 2) + 2; // next multiple of 2
@@ -389,7 +388,7 @@ void RemoteInputUDPHandler::tick()
 	        int nbOriginalBlocks = m_remoteInputBuffer.getCurrentMeta().m_nbOriginalBlocks;
 	        int nbFECblocks = m_remoteInputBuffer.getCurrentMeta().m_nbFECBlocks;
 	        int sampleBits = m_remoteInputBuffer.getCurrentMeta().m_sampleBits;
-	        int sampleBytes = m_remoteInputBuffer.getCurrentMeta().m_sampleBytes;
+	        int sampleBytes = m_remoteInputBuffer.getCurrentMeta().m_sampleBytes & 0xF;
 
 	        //framesDecodingStatus = (minNbOriginalBlocks == nbOriginalBlocks ? 2 : (minNbOriginalBlocks < nbOriginalBlocks - nbFECblocks ? 0 : 1));
 	        if (minNbBlocks < nbOriginalBlocks) {
@@ -415,7 +414,10 @@ void RemoteInputUDPHandler::tick()
 	            nbOriginalBlocks,
 	            nbFECblocks,
 	            sampleBits,
-	            sampleBytes);
+	            sampleBytes,
+	            m_remoteInputBuffer.getCurEncoding(),
+	            m_remoteInputBuffer.getAvgCompressionRatio(),
+	            m_remoteInputBuffer.getAvgDecodeTimeUs());
 
 	            m_messageQueueToGUI->push(report);
 		}
@@ -74,6 +74,9 @@ public:
     uint64_t getTVmSec() const { return m_tv_msec; }
     int getMinNbBlocks() { return m_remoteInputBuffer.getMinNbBlocks(); }
     int getMaxNbRecovery() { return m_remoteInputBuffer.getMaxNbRecovery(); }
+    int getTransportEncoding() const { return m_remoteInputBuffer.getCurEncoding(); }
+    float getCompressionRatio() const { return m_remoteInputBuffer.getAvgCompressionRatio(); }
+    float getDecodeTimeUs() const { return m_remoteInputBuffer.getAvgDecodeTimeUs(); }
 public slots:
 	void dataReadyRead();
 
@@ -37,6 +37,7 @@ class RTLSDRInput : public DeviceSampleSource {
 public:
 	class MsgConfigureRTLSDR : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureRTLSDR)
 
 	public:
 		const RTLSDRSettings& getSettings() const { return m_settings; }
@@ -46,6 +46,7 @@ public:
 
     class MsgConfigureSDRPlay : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSDRPlay)
 
     public:
         const SDRPlaySettings& getSettings() const { return m_settings; }
@@ -0,0 +1,544 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <errno.h>
+
+#include <QDebug>
+#include <QNetworkReply>
+#include <QBuffer>
+
+#include "SWGDeviceSettings.h"
+#include "SWGDeviceState.h"
+#include "SWGDeviceReport.h"
+#include "SWGShmInputReport.h"
+
+#include "util/simpleserializer.h"
+#include "dsp/dspcommands.h"
+#include "dsp/dspengine.h"
+#include "device/deviceapi.h"
+
+#include "shminputworker.h"
+#include "shminput.h"
+
+MESSAGE_CLASS_DEFINITION(ShmInput::MsgConfigureShmInput, Message)
+MESSAGE_CLASS_DEFINITION(ShmInput::MsgStartStop, Message)
+MESSAGE_CLASS_DEFINITION(ShmInput::MsgReportSampleRateAndFrequency, Message)
+
+ShmInput::ShmInput(DeviceAPI *deviceAPI) :
+    m_deviceAPI(deviceAPI),
+    m_settings(),
+    m_centerFrequency(0),
+    m_sampleRate(48000),
+	m_deviceDescription("ShmInput"),
+    m_shmInputWorker(nullptr)
+{
+	m_sampleFifo.setSize(96000 * 4);
+
+    m_deviceAPI->setNbSourceStreams(1);
+
+    m_networkManager = new QNetworkAccessManager();
+    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
+    m_masterTimer.setTimerType(Qt::PreciseTimer);
+    m_masterTimer.start(SHMINPUT_POLL_MS);
+}
+
+ShmInput::~ShmInput()
+{
+    m_masterTimer.stop();
+    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
+    delete m_networkManager;
+	stop();
+}
+
+void ShmInput::destroy()
+{
+    delete this;
+}
+
+void ShmInput::init()
+{
+    applySettings(m_settings, true);
+}
+
+bool ShmInput::start()
+{
+	qDebug() << "ShmInput::start";
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_shmInputWorker) {
+        return true;
+    }
+
+    m_sampleFifo.reset();
+    m_shmInputWorker = new ShmInputWorker(m_settings.m_shmName, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+    m_shmInputWorker->moveToThread(&m_shmInputWorkerThread);
+    startWorker();
+
+	return true;
+}
+
+void ShmInput::stop()
+{
+	qDebug() << "ShmInput::stop";
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_shmInputWorker)
+    {
+        stopWorker();
+        delete m_shmInputWorker;
+        m_shmInputWorker = nullptr;
+    }
+}
+
+void ShmInput::startWorker()
+{
+    m_shmInputWorker->startWork();
+    m_shmInputWorkerThread.start();
+}
+
+void ShmInput::stopWorker()
+{
+    m_shmInputWorker->stopWork();
+    m_shmInputWorkerThread.quit();
+    m_shmInputWorkerThread.wait();
+}
+
+QByteArray ShmInput::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool ShmInput::deserialize(const QByteArray& data)
+{
+    bool success = true;
+
+    if (!m_settings.deserialize(data))
+    {
+        m_settings.resetToDefaults();
+        success = false;
+    }
+
+    MsgConfigureShmInput* message = MsgConfigureShmInput::create(m_settings, true);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureShmInput* messageToGUI = MsgConfigureShmInput::create(m_settings, true);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+
+    return success;
+}
+
+void ShmInput::setMessageQueueToGUI(MessageQueue *queue)
+{
+    m_guiMessageQueue = queue;
+}
+
+const QString& ShmInput::getDeviceDescription() const
+{
+	return m_deviceDescription;
+}
+
+int ShmInput::getSampleRate() const
+{
+    return m_sampleRate;
+}
+
+void ShmInput::setSampleRate(int sampleRate)
+{
+    if (sampleRate != m_sampleRate) {
+        m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(sampleRate));
+    }
+
+    m_sampleRate = sampleRate;
+
+    DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency); // Frequency in Hz for the DSP engine
+    m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+
+    if (getMessageQueueToGUI())
+    {
+        MsgReportSampleRateAndFrequency *msg = MsgReportSampleRateAndFrequency::create(m_sampleRate, m_centerFrequency);
+        getMessageQueueToGUI()->push(msg);
+    }
+}
+
+quint64 ShmInput::getCenterFrequency() const
+{
+    return m_centerFrequency;
+}
+
+void ShmInput::setCenterFrequency(qint64 centerFrequency)
+{
+    m_centerFrequency = centerFrequency;
+
+    DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency); // Frequency in Hz for the DSP engine
+    m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+
+    if (getMessageQueueToGUI())
+    {
+        MsgReportSampleRateAndFrequency *msg = MsgReportSampleRateAndFrequency::create(m_sampleRate, m_centerFrequency);
+        getMessageQueueToGUI()->push(msg);
+    }
+}
+
+void ShmInput::getStatus(bool& connected, uint64_t& lag, uint64_t& dropped)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_shmInputWorker)
+    {
+        connected = m_shmInputWorker->isConnected();
+        lag = m_shmInputWorker->getLag();
+        dropped = m_shmInputWorker->getDropped();
+    }
+    else
+    {
+        connected = false;
+        lag = 0;
+        dropped = 0;
+    }
+}
+
+bool ShmInput::handleMessage(const Message& message)
+{
+    if (MsgStartStop::match(message))
+    {
+        MsgStartStop& cmd = (MsgStartStop&) message;
+        qDebug() << "ShmInput::handleMessage: MsgStartStop: " << (cmd.getStartStop() ? "start" : "stop");
+
+        if (cmd.getStartStop())
+        {
+            if (m_deviceAPI->initDeviceEngine())
+            {
+                m_deviceAPI->startDeviceEngine();
+            }
+        }
+        else
+        {
+            m_deviceAPI->stopDeviceEngine();
+        }
+
+        if (m_settings.m_useReverseAPI) {
+            webapiReverseSendStartStop(cmd.getStartStop());
+        }
+
+        return true;
+    }
+    else if (ShmInputWorker::MsgReportMeta::match(message))
+    {
+        ShmInputWorker::MsgReportMeta& report = (ShmInputWorker::MsgReportMeta&) message;
+        qDebug("ShmInput::handleMessage: MsgReportMeta: sampleRate: %d centerFrequency: %llu",
+            report.getSampleRate(), report.getCenterFrequency());
+        m_centerFrequency = report.getCenterFrequency();
+        setSampleRate(report.getSampleRate()); // notifies both frequency and rate
+        return true;
+    }
+    else if (MsgConfigureShmInput::match(message))
+    {
+        qDebug() << "ShmInput::handleMessage:" << message.getIdentifier();
+        MsgConfigureShmInput& conf = (MsgConfigureShmInput&) message;
+        applySettings(conf.getSettings(), conf.getForce());
+        return true;
+    }
+	else
+	{
+		return false;
+	}
+}
+
+void ShmInput::applySettings(const ShmInputSettings& settings, bool force)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    QList<QString> reverseAPIKeys;
+
+    if ((m_settings.m_shmName != settings.m_shmName) || force)
+    {
+        reverseAPIKeys.append("shmName");
+
+        if (m_shmInputWorker) // attach to the new ring
+        {
+            stopWorker();
+            delete m_shmInputWorker;
+            m_sampleFifo.reset();
+            m_shmInputWorker = new ShmInputWorker(settings.m_shmName, &m_sampleFifo, m_masterTimer, &m_inputMessageQueue);
+            m_shmInputWorker->moveToThread(&m_shmInputWorkerThread);
+            startWorker();
+        }
+    }
+
+    if ((m_settings.m_dcBlock != settings.m_dcBlock) || force) {
+        reverseAPIKeys.append("dcBlock");
+    }
+    if ((m_settings.m_iqCorrection != settings.m_iqCorrection) || force) {
+        reverseAPIKeys.append("iqCorrection");
+    }
+
+    if ((m_settings.m_dcBlock != settings.m_dcBlock) || (m_settings.m_iqCorrection != settings.m_iqCorrection) || force)
+    {
+        m_deviceAPI->configureCorrections(settings.m_dcBlock, settings.m_iqCorrection);
+        qDebug("ShmInput::applySettings: corrections: DC block: %s IQ imbalance: %s",
+                settings.m_dcBlock ? "true" : "false",
+                settings.m_iqCorrection ? "true" : "false");
+    }
+
+    mutexLocker.unlock();
+
+    if (settings.m_useReverseAPI)
+    {
+        bool fullUpdate = ((m_settings.m_useReverseAPI != settings.m_useReverseAPI) && settings.m_useReverseAPI) ||
+                (m_settings.m_reverseAPIAddress != settings.m_reverseAPIAddress) ||
+                (m_settings.m_reverseAPIPort != settings.m_reverseAPIPort) ||
+                (m_settings.m_reverseAPIDeviceIndex != settings.m_reverseAPIDeviceIndex);
+        webapiReverseSendSettings(reverseAPIKeys, settings, fullUpdate || force);
+    }
+
+    m_settings = settings;
+
+    qDebug() << "ShmInput::applySettings: "
+            << " m_shmName: " << m_settings.m_shmName
+            << " m_dcBlock: " << m_settings.m_dcBlock
+            << " m_iqCorrection: " << m_settings.m_iqCorrection;
+}
+
+int ShmInput::webapiRunGet(
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState());
+    return 200;
+}
+
+int ShmInput::webapiRun(
+        bool run,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState());
+    MsgStartStop *message = MsgStartStop::create(run);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgStartStop *msgToGUI = MsgStartStop::create(run);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    return 200;
+}
+
+int ShmInput::webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setShmInputSettings(new SWGSDRangel::SWGShmInputSettings());
+    response.getShmInputSettings()->init();
+    webapiFormatDeviceSettings(response, m_settings);
+    return 200;
+}
+
+int ShmInput::webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    ShmInputSettings settings = m_settings;
+    webapiUpdateDeviceSettings(settings, deviceSettingsKeys, response);
+
+    MsgConfigureShmInput *msg = MsgConfigureShmInput::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureShmInput *msgToGUI = MsgConfigureShmInput::create(settings, force);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    webapiFormatDeviceSettings(response, settings);
+    return 200;
+}
+
+void ShmInput::webapiUpdateDeviceSettings(
+        ShmInputSettings& settings,
+        const QStringList& deviceSettingsKeys,
+        SWGSDRangel::SWGDeviceSettings& response)
+{
+    if (deviceSettingsKeys.contains("shmName")) {
+        settings.m_shmName = *response.getShmInputSettings()->getShmName();
+    }
+    if (deviceSettingsKeys.contains("dcBlock")) {
+        settings.m_dcBlock = response.getShmInputSettings()->getDcBlock() != 0;
+    }
+    if (deviceSettingsKeys.contains("iqCorrection")) {
+        settings.m_iqCorrection = response.getShmInputSettings()->getIqCorrection() != 0;
+    }
+    if (deviceSettingsKeys.contains("useReverseAPI")) {
+        settings.m_useReverseAPI = response.getShmInputSettings()->getUseReverseApi() != 0;
+    }
+    if (deviceSettingsKeys.contains("reverseAPIAddress")) {
+        settings.m_reverseAPIAddress = *response.getShmInputSettings()->getReverseApiAddress();
+    }
+    if (deviceSettingsKeys.contains("reverseAPIPort")) {
+        settings.m_reverseAPIPort = response.getShmInputSettings()->getReverseApiPort();
+    }
+    if (deviceSettingsKeys.contains("reverseAPIDeviceIndex")) {
+        settings.m_reverseAPIDeviceIndex = response.getShmInputSettings()->getReverseApiDeviceIndex();
+    }
+}
+
+void ShmInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const ShmInputSettings& settings)
+{
+    if (response.getShmInputSettings()->getShmName()) {
+        *response.getShmInputSettings()->getShmName() = settings.m_shmName;
+    } else {
+        response.getShmInputSettings()->setShmName(new QString(settings.m_shmName));
+    }
+
+    response.getShmInputSettings()->setDcBlock(settings.m_dcBlock ? 1 : 0);
+    response.getShmInputSettings()->setIqCorrection(settings.m_iqCorrection);
+
+    response.getShmInputSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
+
+    if (response.getShmInputSettings()->getReverseApiAddress()) {
+        *response.getShmInputSettings()->getReverseApiAddress() = settings.m_reverseAPIAddress;
+    } else {
+        response.getShmInputSettings()->setReverseApiAddress(new QString(settings.m_reverseAPIAddress));
+    }
+
+    response.getShmInputSettings()->setReverseApiPort(settings.m_reverseAPIPort);
+    response.getShmInputSettings()->setReverseApiDeviceIndex(settings.m_reverseAPIDeviceIndex);
+}
+
+int ShmInput::webapiReportGet(
+        SWGSDRangel::SWGDeviceReport& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setShmInputReport(new SWGSDRangel::SWGShmInputReport());
+    response.getShmInputReport()->init();
+    webapiFormatDeviceReport(response);
+    return 200;
+}
+
+void ShmInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response)
+{
+    response.getShmInputReport()->setCenterFrequency(m_centerFrequency);
+    response.getShmInputReport()->setSampleRate(m_sampleRate);
+    bool connected;
+    uint64_t lag, dropped;
+    getStatus(connected, lag, dropped);
+    response.getShmInputReport()->setConnected(connected ? 1 : 0);
+    response.getShmInputReport()->setLagSamples(lag);
+    response.getShmInputReport()->setDroppedSamples(dropped);
+}
+
+void ShmInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const ShmInputSettings& settings, bool force)
+{
+    SWGSDRangel::SWGDeviceSettings *swgDeviceSettings = new SWGSDRangel::SWGDeviceSettings();
+    swgDeviceSettings->setDirection(0); // single Rx
+    swgDeviceSettings->setOriginatorIndex(m_deviceAPI->getDeviceSetIndex());
+    swgDeviceSettings->setDeviceHwType(new QString("ShmInput"));
+    swgDeviceSettings->setShmInputSettings(new SWGSDRangel::SWGShmInputSettings());
+    SWGSDRangel::SWGShmInputSettings *swgShmInputSettings = swgDeviceSettings->getShmInputSettings();
+
+    // transfer data that has been modified. When force is on transfer all data except reverse API data
+
+    if (deviceSettingsKeys.contains("shmName") || force) {
+        swgShmInputSettings->setShmName(new QString(settings.m_shmName));
+    }
+    if (deviceSettingsKeys.contains("dcBlock") || force) {
+        swgShmInputSettings->setDcBlock(settings.m_dcBlock ? 1 : 0);
+    }
+    if (deviceSettingsKeys.contains("iqCorrection") || force) {
+        swgShmInputSettings->setIqCorrection(settings.m_iqCorrection ? 1 : 0);
+    }
+
+    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
+            .arg(settings.m_reverseAPIAddress)
+            .arg(settings.m_reverseAPIPort)
+            .arg(settings.m_reverseAPIDeviceIndex);
+    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
+    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+
+    QBuffer *buffer = new QBuffer();
+    buffer->open((QBuffer::ReadWrite));
+    buffer->write(swgDeviceSettings->asJson().toUtf8());
+    buffer->seek(0);
+
+    // Always use PATCH to avoid passing reverse API settings
+    QNetworkReply *reply = m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    buffer->setParent(reply);
+
+    delete swgDeviceSettings;
+}
+
+void ShmInput::webapiReverseSendStartStop(bool start)
+{
+    SWGSDRangel::SWGDeviceSettings *swgDeviceSettings = new SWGSDRangel::SWGDeviceSettings();
+    swgDeviceSettings->setDirection(0); // single Rx
+    swgDeviceSettings->setOriginatorIndex(m_deviceAPI->getDeviceSetIndex());
+    swgDeviceSettings->setDeviceHwType(new QString("ShmInput"));
+
+    QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/run")
+            .arg(m_settings.m_reverseAPIAddress)
+            .arg(m_settings.m_reverseAPIPort)
+            .arg(m_settings.m_reverseAPIDeviceIndex);
+    m_networkRequest.setUrl(QUrl(deviceSettingsURL));
+    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+
+    QBuffer *buffer = new QBuffer();
+    buffer->open((QBuffer::ReadWrite));
+    buffer->write(swgDeviceSettings->asJson().toUtf8());
+    buffer->seek(0);
+    QNetworkReply *reply;
+
+    if (start) {
+        reply = m_networkManager->sendCustomRequest(m_networkRequest, "POST", buffer);
+    } else {
+        reply = m_networkManager->sendCustomRequest(m_networkRequest, "DELETE", buffer);
+    }
+
+    buffer->setParent(reply);
+    delete swgDeviceSettings;
+}
+
+void ShmInput::networkManagerFinished(QNetworkReply *reply)
+{
+    QNetworkReply::NetworkError replyError = reply->error();
+
+    if (replyError)
+    {
+        qWarning() << "ShmInput::networkManagerFinished:"
+                << " error(" << (int) replyError
+                << "): " << replyError
+                << ": " << reply->errorString();
+    }
+    else
+    {
+        QString answer = reply->readAll();
+        answer.chop(1); // remove last \n
+        qDebug("ShmInput::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
+    }
+
+    reply->deleteLater();
+}
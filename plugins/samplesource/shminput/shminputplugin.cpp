@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QtPlugin>
+
+#include "plugin/pluginapi.h"
+#include "util/simpleserializer.h"
+
+#ifdef SERVER_MODE
+#include "shminput.h"
+#else
+#include "shminputgui.h"
+#endif
+#include "shminputplugin.h"
+#include "shminputwebapiadapter.h"
+
+const PluginDescriptor ShmInputPlugin::m_pluginDescriptor = {
+    QString("ShmInput"),
+	QString("Shared memory input"),
+	QString("4.19.0"),
+	QString("(c) Edouard Griffiths, F4EXB"),
+	QString("https://github.com/f4exb/sdrangel"),
+	true,
+	QString("https://github.com/f4exb/sdrangel")
+};
+
+const QString ShmInputPlugin::m_hardwareID = "ShmInput";
+const QString ShmInputPlugin::m_deviceTypeID = SHMINPUT_DEVICE_TYPE_ID;
+
+ShmInputPlugin::ShmInputPlugin(QObject* parent) :
+	QObject(parent)
+{
+}
+
+const PluginDescriptor& ShmInputPlugin::getPluginDescriptor() const
+{
+	return m_pluginDescriptor;
+}
+
+void ShmInputPlugin::initPlugin(PluginAPI* pluginAPI)
+{
+	pluginAPI->registerSampleSource(m_deviceTypeID, this);
+}
+
+void ShmInputPlugin::enumOriginDevices(QStringList& listedHwIds, OriginDevices& originDevices)
+{
+    if (listedHwIds.contains(m_hardwareID)) { // check if it was done
+        return;
+    }
+
+    originDevices.append(OriginDevice(
+        "ShmInput",
+        m_hardwareID,
+        QString(),
+        0,
+        1, // nb Rx
+        0  // nb Tx
+    ));
+
+    listedHwIds.append(m_hardwareID);
+}
+
+PluginInterface::SamplingDevices ShmInputPlugin::enumSampleSources(const OriginDevices& originDevices)
+{
+	SamplingDevices result;
+
+	for (OriginDevices::const_iterator it = originDevices.begin(); it != originDevices.end(); ++it)
+    {
+        if (it->hardwareId == m_hardwareID)
+        {
+            result.append(SamplingDevice(
+                it->displayableName,
+                m_hardwareID,
+                m_deviceTypeID,
+                it->serial,
+                it->sequence,
+                PluginInterface::SamplingDevice::BuiltInDevice,
+                PluginInterface::SamplingDevice::StreamSingleRx,
+                1,
+                0
+            ));
+        }
+    }
+
+	return result;
+}
+
+#ifdef SERVER_MODE
+DeviceGUI* ShmInputPlugin::createSampleSourcePluginInstanceGUI(
+        const QString& sourceId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+    (void) sourceId;
+    (void) widget;
+    (void) deviceUISet;
+    return 0;
+}
+#else
+DeviceGUI* ShmInputPlugin::createSampleSourcePluginInstanceGUI(
+        const QString& sourceId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+	if(sourceId == m_deviceTypeID)
+	{
+		ShmInputGui* gui = new ShmInputGui(deviceUISet);
+		*widget = gui;
+		return gui;
+	}
+	else
+	{
+		return 0;
+	}
+}
+#endif
+
+DeviceSampleSource *ShmInputPlugin::createSampleSourcePluginInstance(const QString& sourceId, DeviceAPI *deviceAPI)
+{
+    if (sourceId == m_deviceTypeID)
+    {
+        ShmInput* input = new ShmInput(deviceAPI);
+        return input;
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+DeviceWebAPIAdapter *ShmInputPlugin::createDeviceWebAPIAdapter() const
+{
+    return new ShmInputWebAPIAdapter();
+}
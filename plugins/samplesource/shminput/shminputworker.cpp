@@ -0,0 +1,152 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+#include <QTimer>
+
+#include "dsp/samplesinkfifo.h"
+#include "util/messagequeue.h"
+
+#include "shminputworker.h"
+
+MESSAGE_CLASS_DEFINITION(ShmInputWorker::MsgReportMeta, Message)
+
+ShmInputWorker::ShmInputWorker(
+        const QString& shmName,
+        SampleSinkFifo* sampleFifo,
+        const QTimer& timer,
+        MessageQueue *shmInputMessageQueue,
+        QObject* parent) :
+    QObject(parent),
+    m_running(false),
+    m_shmName(shmName),
+    m_sampleFifo(sampleFifo),
+    m_timer(timer),
+    m_shmInputMessageQueue(shmInputMessageQueue),
+    m_retryTicks(0),
+    m_sampleRate(0),
+    m_centerFrequency(0),
+    m_connected(false),
+    m_lag(0),
+    m_dropped(0)
+{
+}
+
+ShmInputWorker::~ShmInputWorker()
+{
+    if (m_running) {
+        stopWork();
+    }
+
+    m_ring.close();
+}
+
+void ShmInputWorker::startWork()
+{
+    qDebug("ShmInputWorker::startWork: %s", qPrintable(m_shmName));
+    m_retryTicks = 0;
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+    m_running = true;
+}
+
+void ShmInputWorker::stopWork()
+{
+    qDebug("ShmInputWorker::stopWork");
+    disconnect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+    m_running = false;
+}
+
+bool ShmInputWorker::openRing()
+{
+    if (!m_ring.open(m_shmName)) {
+        return false;
+    }
+
+    // one poll period worth of samples plus margin per read
+    uint32_t sampleRate = 0;
+    uint64_t centerFrequency, timestampUs;
+    m_ring.getMeta(sampleRate, centerFrequency, timestampUs);
+    unsigned int readSize = std::max(4096U, (sampleRate / 1000U) * SHMINPUT_POLL_MS * 2U);
+
+    if (m_buffer.size() < readSize) {
+        m_buffer.resize(readSize);
+    }
+
+    m_sampleRate = 0; // force meta report
+    m_connected.store(true, std::memory_order_relaxed);
+    qDebug("ShmInputWorker::openRing: attached to %s", qPrintable(m_shmName));
+    return true;
+}
+
+void ShmInputWorker::checkMeta()
+{
+    uint32_t sampleRate;
+    uint64_t centerFrequency, timestampUs;
+
+    if (!m_ring.getMeta(sampleRate, centerFrequency, timestampUs) || (sampleRate == 0)) {
+        return;
+    }
+
+    if ((sampleRate != m_sampleRate) || (centerFrequency != m_centerFrequency))
+    {
+        m_sampleRate = sampleRate;
+        m_centerFrequency = centerFrequency;
+        m_shmInputMessageQueue->push(MsgReportMeta::create(sampleRate, centerFrequency));
+    }
+}
+
+void ShmInputWorker::tick()
+{
+    if (!m_running) {
+        return;
+    }
+
+    if (m_ring.isOpen() && m_ring.isProducerGone())
+    {
+        qDebug("ShmInputWorker::tick: producer of %s is gone", qPrintable(m_shmName));
+        m_ring.close();
+        m_connected.store(false, std::memory_order_relaxed);
+        m_retryTicks = 0;
+    }
+
+    if (!m_ring.isOpen())
+    {
+        if (m_retryTicks > 0) // retry about once per second
+        {
+            m_retryTicks--;
+            return;
+        }
+
+        if (!openRing())
+        {
+            m_retryTicks = 1000 / SHMINPUT_POLL_MS;
+            return;
+        }
+    }
+
+    checkMeta(); // before the samples so that the DSP engine gets the new rate first
+    unsigned int nbRead;
+
+    while ((nbRead = m_ring.read(&m_buffer[0], m_buffer.size())) > 0) {
+        m_sampleFifo->write(m_buffer.begin(), m_buffer.begin() + nbRead);
+    }
+
+    m_lag.store(m_ring.getLag(), std::memory_order_relaxed);
+    m_dropped.store(m_ring.getDropped(), std::memory_order_relaxed);
+}
@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_SHMINPUTWORKER_H
+#define INCLUDE_SHMINPUTWORKER_H
+
+#include <atomic>
+
+#include <QObject>
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "dsp/shmsamplering.h"
+#include "util/message.h"
+
+#define SHMINPUT_POLL_MS 20
+
+class QTimer;
+class SampleSinkFifo;
+class MessageQueue;
+
+class ShmInputWorker : public QObject {
+    Q_OBJECT
+
+public:
+    class MsgReportMeta : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        int getSampleRate() const { return m_sampleRate; }
+        quint64 getCenterFrequency() const { return m_centerFrequency; }
+
+        static MsgReportMeta* create(int sampleRate, quint64 centerFrequency) {
+            return new MsgReportMeta(sampleRate, centerFrequency);
+        }
+
+    private:
+        int m_sampleRate;
+        quint64 m_centerFrequency;
+
+        MsgReportMeta(int sampleRate, quint64 centerFrequency) :
+            Message(),
+            m_sampleRate(sampleRate),
+            m_centerFrequency(centerFrequency)
+        { }
+    };
+
+    ShmInputWorker(
+        const QString& shmName,
+        SampleSinkFifo* sampleFifo,
+        const QTimer& timer,
+        MessageQueue *shmInputMessageQueue,
+        QObject* parent = nullptr);
+    ~ShmInputWorker();
+
+    void startWork();
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    bool isConnected() const { return m_connected.load(std::memory_order_relaxed); }
+    uint64_t getLag() const { return m_lag.load(std::memory_order_relaxed); }
+    uint64_t getDropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    volatile bool m_running;
+    QString m_shmName;
+    ShmSampleRing m_ring;
+    SampleVector m_buffer;
+    SampleSinkFifo* m_sampleFifo;
+    const QTimer& m_timer;
+    MessageQueue *m_shmInputMessageQueue;
+    unsigned int m_retryTicks;
+    uint32_t m_sampleRate;
+    uint64_t m_centerFrequency;
+    std::atomic<bool> m_connected;
+    std::atomic<uint64_t> m_lag;
+    std::atomic<uint64_t> m_dropped;
+
+    bool openRing();
+    void checkMeta();
+
+private slots:
+    void tick();
+};
+
+#endif // INCLUDE_SHMINPUTWORKER_H
@@ -52,6 +52,7 @@ class SoapySDRInput : public DeviceSampleSource
 public:
     class MsgConfigureSoapySDRInput : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSoapySDRInput)
 
     public:
         const SoapySDRInputSettings& getSettings() const { return m_settings; }
@@ -123,10 +123,6 @@ void SoapySDRInputThread::run()
             buffs[i] = buffMem[i].data();
         }
 
-        for (unsigned int i = 0; i < m_nbChannels; i++) {
-            m_channels[i].m_convertBuffer.resize(numElems, Sample{0,0});
-        }
-
         m_dev->activateStream(stream);
         int flags(0);
         long long timeNs(0);
@@ -329,7 +325,8 @@ void SoapySDRInputThread::callbackMIQI(std::vector<void *>& buffs, qint32 sample
 
 void SoapySDRInputThread::callbackSI8IQ(const qint8* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[channel].m_sampleFifo->writeBegin(((len/2) >> m_channels[channel].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -417,12 +414,13 @@ void SoapySDRInputThread::callbackSI8IQ(const qint8* buf, qint32 len, unsigned i
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    m_channels[channel].m_sampleFifo->writeCommit(it - begin);
 }
 
 void SoapySDRInputThread::callbackSI8QI(const qint8* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[channel].m_sampleFifo->writeBegin(((len/2) >> m_channels[channel].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -510,12 +508,13 @@ void SoapySDRInputThread::callbackSI8QI(const qint8* buf, qint32 len, unsigned i
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    m_channels[channel].m_sampleFifo->writeCommit(it - begin);
 }
 
 void SoapySDRInputThread::callbackSI12IQ(const qint16* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[channel].m_sampleFifo->writeBegin(((len/2) >> m_channels[channel].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -603,12 +602,13 @@ void SoapySDRInputThread::callbackSI12IQ(const qint16* buf, qint32 len, unsigned
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    m_channels[channel].m_sampleFifo->writeCommit(it - begin);
 }
 
 void SoapySDRInputThread::callbackSI12QI(const qint16* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[channel].m_sampleFifo->writeBegin(((len/2) >> m_channels[channel].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -696,12 +696,13 @@ void SoapySDRInputThread::callbackSI12QI(const qint16* buf, qint32 len, unsigned
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    m_channels[channel].m_sampleFifo->writeCommit(it - begin);
 }
 
 void SoapySDRInputThread::callbackSI16IQ(const qint16* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[channel].m_sampleFifo->writeBegin(((len/2) >> m_channels[channel].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -789,12 +790,13 @@ void SoapySDRInputThread::callbackSI16IQ(const qint16* buf, qint32 len, unsigned
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    m_channels[channel].m_sampleFifo->writeCommit(it - begin);
 }
 
 void SoapySDRInputThread::callbackSI16QI(const qint16* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[channel].m_sampleFifo->writeBegin(((len/2) >> m_channels[channel].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -882,12 +884,13 @@ void SoapySDRInputThread::callbackSI16QI(const qint16* buf, qint32 len, unsigned
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    m_channels[channel].m_sampleFifo->writeCommit(it - begin);
 }
 
 void SoapySDRInputThread::callbackSIFIQ(const float* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[channel].m_sampleFifo->writeBegin(((len/2) >> m_channels[channel].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -975,12 +978,13 @@ void SoapySDRInputThread::callbackSIFIQ(const float* buf, qint32 len, unsigned i
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    m_channels[channel].m_sampleFifo->writeCommit(it - begin);
 }
 
 void SoapySDRInputThread::callbackSIFQI(const float* buf, qint32 len, unsigned int channel)
 {
-    SampleVector::iterator it = m_channels[channel].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[channel].m_sampleFifo->writeBegin(((len/2) >> m_channels[channel].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[channel].m_log2Decim == 0)
     {
@@ -1068,5 +1072,5 @@ void SoapySDRInputThread::callbackSIFQI(const float* buf, qint32 len, unsigned i
         }
     }
 
-    m_channels[channel].m_sampleFifo->write(m_channels[channel].m_convertBuffer.begin(), it);
+    m_channels[channel].m_sampleFifo->writeCommit(it - begin);
 }
@@ -58,7 +58,6 @@ public:
 private:
     struct Channel
     {
-        SampleVector m_convertBuffer;
         SampleSinkFifo* m_sampleFifo;
         unsigned int m_log2Decim;
         int m_fcPos;
@@ -37,6 +37,7 @@ class TestSourceInput : public DeviceSampleSource {
 public:
 	class MsgConfigureTestSource : public Message {
 		MESSAGE_CLASS_DECLARATION
+		MESSAGE_CLASS_COALESCING(MsgConfigureTestSource)
 
 	public:
 		const TestSourceSettings& getSettings() const { return m_settings; }
@@ -42,6 +42,7 @@ class USRPInput : public DeviceSampleSource
 public:
     class MsgConfigureUSRP : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureUSRP)
 
     public:
         const USRPInputSettings& getSettings() const { return m_settings; }
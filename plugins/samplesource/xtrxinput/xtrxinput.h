@@ -40,6 +40,7 @@ class XTRXInput : public DeviceSampleSource
 public:
     class MsgConfigureXTRX : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureXTRX)
 
         public:
             const XTRXInputSettings& getSettings() const { return m_settings; }
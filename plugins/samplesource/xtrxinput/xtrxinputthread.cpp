@@ -34,10 +34,6 @@ XTRXInputThread::XTRXInputThread(struct xtrx_dev *dev, unsigned int nbChannels,
 {
     qDebug("XTRXInputThread::XTRXInputThread: nbChannels: %u uniqueChannelIndex: %u", nbChannels, uniqueChannelIndex);
     m_channels = new Channel[2];
-
-    for (unsigned int i = 0; i < 2; i++) {
-        m_channels[i].m_convertBuffer.resize(DeviceXTRX::blockSize, Sample{0,0});
-    }
 }
 
 XTRXInputThread::~XTRXInputThread()
@@ -233,7 +229,8 @@ SampleSinkFifo *XTRXInputThread::getFifo(unsigned int channel)
 
 void XTRXInputThread::callbackSIIQ(const qint16* buf, qint32 len)
 {
-    SampleVector::iterator it = m_channels[m_uniqueChannelIndex].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[m_uniqueChannelIndex].m_sampleFifo->writeBegin(((len/2) >> m_channels[m_uniqueChannelIndex].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[m_uniqueChannelIndex].m_log2Decim == 0)
     {
@@ -266,12 +263,13 @@ void XTRXInputThread::callbackSIIQ(const qint16* buf, qint32 len)
         }
     }
 
-    m_channels[m_uniqueChannelIndex].m_sampleFifo->write(m_channels[m_uniqueChannelIndex].m_convertBuffer.begin(), it);
+    m_channels[m_uniqueChannelIndex].m_sampleFifo->writeCommit(it - begin);
 }
 
 void XTRXInputThread::callbackSIQI(const qint16* buf, qint32 len)
 {
-    SampleVector::iterator it = m_channels[m_uniqueChannelIndex].m_convertBuffer.begin();
+    SampleVector::iterator begin = m_channels[m_uniqueChannelIndex].m_sampleFifo->writeBegin(((len/2) >> m_channels[m_uniqueChannelIndex].m_log2Decim) + 1);
+    SampleVector::iterator it = begin;
 
     if (m_channels[m_uniqueChannelIndex].m_log2Decim == 0)
     {
@@ -304,7 +302,7 @@ void XTRXInputThread::callbackSIQI(const qint16* buf, qint32 len)
         }
     }
 
-    m_channels[m_uniqueChannelIndex].m_sampleFifo->write(m_channels[m_uniqueChannelIndex].m_convertBuffer.begin(), it);
+    m_channels[m_uniqueChannelIndex].m_sampleFifo->writeCommit(it - begin);
 }
 
 void XTRXInputThread::callbackMI(const qint16* buf0, const qint16* buf1, qint32 len)
@@ -43,7 +43,9 @@
 #include "ambeworker.h"
 #include "ambeengine.h"
 
-AMBEEngine::AMBEEngine()
+AMBEEngine::AMBEEngine() :
+    m_lastPrune(QDateTime::currentDateTime()),
+    m_nbDroppedFrames(0)
 {}
 
 AMBEEngine::~AMBEEngine()
@@ -226,6 +228,11 @@ bool AMBEEngine::registerController(const std::string& deviceRef)
 
     if (worker->open(deviceRef))
     {
+        if (!worker->isEmulated()) {
+            std::this_thread::sleep_for(std::chrono::seconds(1));
+        }
+
+        QMutexLocker locker(&m_mutex);
         m_controllers.push_back(AMBEController());
         m_controllers.back().worker = worker;
         m_controllers.back().thread = new QThread();
@@ -236,7 +243,6 @@ bool AMBEEngine::registerController(const std::string& deviceRef)
         connect(m_controllers.back().worker, SIGNAL(finished()), m_controllers.back().worker, SLOT(deleteLater()));
         connect(m_controllers.back().thread, SIGNAL(finished()), m_controllers.back().thread, SLOT(deleteLater()));
         connect(&m_controllers.back().worker->m_inputMessageQueue, SIGNAL(messageEnqueued()), m_controllers.back().worker, SLOT(handleInputMessages()));
-        std::this_thread::sleep_for(std::chrono::seconds(1));
         m_controllers.back().thread->start();
 
         return true;
@@ -253,6 +259,8 @@ void AMBEEngine::releaseController(const std::string& deviceRef)
     {
         if (it->device == deviceRef)
         {
+            QMutexLocker locker(&m_mutex);
+            releaseStreams(it->worker);
             disconnect(&it->worker->m_inputMessageQueue, SIGNAL(messageEnqueued()), it->worker, SLOT(handleInputMessages()));
             it->worker->stop();
             it->thread->wait(100);
@@ -282,7 +290,9 @@ void AMBEEngine::releaseAll()
         ++it;
     }
 
+    QMutexLocker locker(&m_mutex);
     m_controllers.clear();
+    m_streamWorkers.clear();
 }
 
 void AMBEEngine::getDeviceRefs(std::vector<QString>& deviceNames)
@@ -305,42 +315,122 @@ void AMBEEngine::pushMbeFrame(
         int upsampling,
         AudioFifo *audioFifo)
 {
-    std::vector<AMBEController>::iterator it = m_controllers.begin();
-    std::vector<AMBEController>::iterator itAvail = m_controllers.end();
-    bool done = false;
     QMutexLocker locker(&m_mutex);
 
-    while (it != m_controllers.end())
+    if (m_controllers.size() == 0)
     {
-        if (it->worker->hasFifo(audioFifo))
-        {
-            it->worker->pushMbeFrame(mbeFrame, mbeRateIndex, mbeVolumeIndex, channels, useLP, upsampling, audioFifo);
-            done = true;
-        }
-        else if (it->worker->isAvailable())
-        {
-            itAvail = it;
+        qDebug("AMBEEngine::pushMbeFrame: no DV device available. MBE frame dropped");
+        m_nbDroppedFrames++;
+        return;
+    }
+
+    // least loaded device
+    std::vector<AMBEController>::iterator itBest = m_controllers.begin();
+
+    for (std::vector<AMBEController>::iterator it = m_controllers.begin() + 1; it != m_controllers.end(); ++it)
+    {
+        if (it->worker->getQueueDepth() < itBest->worker->getQueueDepth()) {
+            itBest = it;
         }
+    }
 
-        ++it;
+    QDateTime now = QDateTime::currentDateTime();
+
+    if (m_lastPrune.msecsTo(now) > 1000)
+    {
+        pruneStreams(now);
+        m_lastPrune = now;
     }
 
-    if (!done)
+    // A stream stays on its device as long as it has frames in flight there: the audio FIFO has a single writer
+    // and its audio must stay in order. When it has none it moves if another device is significantly less loaded
+    // or if its device is saturated. A stream with frames in flight on a saturated device loses the frame.
+    std::map<AudioFifo*, StreamAssignment>::iterator itStream = m_streamWorkers.find(audioFifo);
+    AMBEWorker *worker;
+
+    if (itStream == m_streamWorkers.end())
+    {
+        worker = itBest->worker;
+        StreamAssignment& assignment = m_streamWorkers[audioFifo];
+        assignment.worker = worker;
+        assignment.lastActivity = now;
+        qDebug("AMBEEngine::pushMbeFrame: assign %p to device %d", audioFifo, (int) (itBest - m_controllers.begin()));
+    }
+    else
     {
-        if (itAvail != m_controllers.end())
+        worker = itStream->second.worker;
+        itStream->second.lastActivity = now;
+
+        if ((worker != itBest->worker)
+            && (worker->getStreamQueueDepth(audioFifo) == 0)
+            && ((worker->getQueueDepth() > itBest->worker->getQueueDepth() + m_migrationThreshold)
+                || (worker->getQueueDepth() >= m_maxQueueDepth)))
         {
-            int wNum = itAvail - m_controllers.begin();
+            worker = itBest->worker;
+            itStream->second.worker = worker;
+            qDebug("AMBEEngine::pushMbeFrame: move %p to device %d", audioFifo, (int) (itBest - m_controllers.begin()));
+        }
+    }
+
+    if (worker->getQueueDepth() >= m_maxQueueDepth) // all devices saturated or stream pinned to a saturated device
+    {
+        qDebug("AMBEEngine::pushMbeFrame: DV device saturated. MBE frame dropped");
+        m_nbDroppedFrames++;
+        return;
+    }
+
+    worker->pushMbeFrame(mbeFrame, mbeRateIndex, mbeVolumeIndex, channels, useLP, upsampling, audioFifo);
+}
+
+void AMBEEngine::releaseStreams(AMBEWorker *worker)
+{
+    std::map<AudioFifo*, StreamAssignment>::iterator it = m_streamWorkers.begin();
 
-            qDebug("AMBEEngine::pushMbeFrame: push %p on empty queue %d", audioFifo, wNum);
-            itAvail->worker->pushMbeFrame(mbeFrame, mbeRateIndex, mbeVolumeIndex, channels, useLP, upsampling, audioFifo);
+    while (it != m_streamWorkers.end())
+    {
+        if (it->second.worker == worker) {
+            it = m_streamWorkers.erase(it);
+        } else {
+            ++it;
         }
-        else
-        {
-            qDebug("AMBEEngine::pushMbeFrame: no DV device available. MBE frame dropped");
+    }
+}
+
+void AMBEEngine::pruneStreams(const QDateTime& now)
+{
+    std::map<AudioFifo*, StreamAssignment>::iterator it = m_streamWorkers.begin();
+
+    while (it != m_streamWorkers.end())
+    {
+        // same inactivity delay as the workers so that a FIFO address reused by a new stream starts afresh
+        if ((it->second.lastActivity.msecsTo(now) > 10000) && (it->second.worker->getStreamQueueDepth(it->first) == 0)) {
+            it = m_streamWorkers.erase(it);
+        } else {
+            ++it;
         }
     }
 }
 
+void AMBEEngine::getDevicesStats(std::vector<DeviceStats>& devicesStats)
+{
+    QMutexLocker locker(&m_mutex);
+    std::vector<AMBEController>::const_iterator it = m_controllers.begin();
+
+    for (; it != m_controllers.end(); ++it)
+    {
+        AMBEWorker::Stats stats;
+        it->worker->getStats(stats);
+        devicesStats.push_back(DeviceStats());
+        devicesStats.back().m_deviceRef = QString(it->device.c_str());
+        devicesStats.back().m_queueDepth = stats.m_queueDepth;
+        devicesStats.back().m_nbStreams = stats.m_nbStreams;
+        devicesStats.back().m_framesDecoded = stats.m_framesDecoded;
+        devicesStats.back().m_framesFailed = stats.m_framesFailed;
+        devicesStats.back().m_meanLatencyMs = stats.m_meanLatencyMs;
+        devicesStats.back().m_maxLatencyMs = stats.m_maxLatencyMs;
+    }
+}
+
 QByteArray AMBEEngine::serialize() const
 {
     QStringList qDeviceList;
@@ -21,11 +21,14 @@
 
 #include <vector>
 #include <string>
+#include <map>
+#include <atomic>
 
 #include <QObject>
 #include <QMutex>
 #include <QString>
 #include <QByteArray>
+#include <QDateTime>
 
 #include "export.h"
 
@@ -37,6 +40,17 @@ class SDRBASE_API AMBEEngine : public QObject
 {
     Q_OBJECT
 public:
+    struct DeviceStats
+    {
+        QString m_deviceRef;
+        int m_queueDepth;         //!< frames pushed and not yet decoded
+        int m_nbStreams;          //!< audio streams currently served
+        quint64 m_framesDecoded;
+        quint64 m_framesFailed;
+        float m_meanLatencyMs;    //!< mean time from push to audio FIFO write
+        float m_maxLatencyMs;
+    };
+
     AMBEEngine();
     ~AMBEEngine();
 
@@ -57,6 +71,9 @@ public:
             int upsampling,
             AudioFifo *audioFifo);
 
+    void getDevicesStats(std::vector<DeviceStats>& devicesStats); //!< per device load and latency
+    quint64 getNbDroppedFrames() const { return m_nbDroppedFrames.load(); } //!< frames dropped because their device was saturated
+
     QByteArray serialize() const;
     bool deserialize(const QByteArray& data);
 
@@ -73,16 +90,34 @@ private:
         std::string device;
     };
 
+    struct StreamAssignment
+    {
+        StreamAssignment() :
+            worker(nullptr)
+        {}
+
+        AMBEWorker *worker;
+        QDateTime lastActivity;
+    };
+
 #ifndef __WINDOWS__
     static std::string get_driver(const std::string& tty);
     static void register_comport(std::vector<std::string>& comList, std::vector<std::string>& comList8250, const std::string& dir);
     static void probe_serial8250_comports(std::vector<std::string>& comList, std::vector<std::string> comList8250);
 #endif
     void getComList();
+    void releaseStreams(AMBEWorker *worker);
+    void pruneStreams(const QDateTime& now);
+
+    static const int m_maxQueueDepth = 16;       //!< frames in flight per device above which a device is saturated
+    static const int m_migrationThreshold = 2;   //!< queue depth difference that makes an idle stream move to another device
 
     std::vector<AMBEController> m_controllers;
     std::vector<std::string> m_comList;
     std::vector<std::string> m_comList8250;
+    std::map<AudioFifo*, StreamAssignment> m_streamWorkers; //!< sticky stream to device assignments
+    QDateTime m_lastPrune;
+    std::atomic<quint64> m_nbDroppedFrames;
     QMutex m_mutex;
 };
 
@@ -26,20 +26,40 @@
 MESSAGE_CLASS_DEFINITION(AMBEWorker::MsgMbeDecode, Message)
 MESSAGE_CLASS_DEFINITION(AMBEWorker::MsgTest, Message)
 
+const std::string AMBEWorker::m_emulatorDeviceRef = "emulator";
+
+AMBEWorker::StreamState::StreamState() :
+    m_audioBufferFill(0),
+    m_upsamplerLastValue(0.0f),
+    m_upsampling(1),
+    m_volume(1.0f),
+    m_pendingFrames(0)
+{
+    m_audioBuffer.resize(48000);
+    setVolumeFactors();
+}
+
+void AMBEWorker::StreamState::setVolumeFactors()
+{
+    m_upsamplingFactors[0] = m_volume;
+
+    for (int i = 1; i <= m_upsampling; i++) {
+        m_upsamplingFactors[i] = (i*m_volume) / (float) m_upsampling;
+    }
+}
+
 AMBEWorker::AMBEWorker() :
+    m_emulatorLatencyUs(0),
     m_running(false),
     m_currentGainIn(0),
     m_currentGainOut(0),
-    m_upsamplerLastValue(0.0f),
-    m_phase(0),
-    m_upsampling(1),
-    m_volume(1.0f)
+    m_queueDepth(0),
+    m_framesDecoded(0),
+    m_framesFailed(0),
+    m_latencySumMs(0.0),
+    m_maxLatencyMs(0.0f)
 {
-    m_audioBuffer.resize(48000);
-    m_audioBufferFill = 0;
-    m_audioFifo = 0;
     std::fill(m_dvAudioSamples, m_dvAudioSamples+SerialDV::MBE_AUDIO_BLOCK_SIZE, 0);
-    setVolumeFactors();
 }
 
 AMBEWorker::~AMBEWorker()
@@ -47,12 +67,26 @@ AMBEWorker::~AMBEWorker()
 
 bool AMBEWorker::open(const std::string& deviceRef)
 {
+    if (deviceRef.compare(0, m_emulatorDeviceRef.size(), m_emulatorDeviceRef) == 0)
+    {
+        // emulator or emulator:<latency in microseconds>. Default latency is a typical AMBE3000 round trip at 460800 baud.
+        std::size_t pos = deviceRef.find(':');
+        m_emulatorLatencyUs = pos == std::string::npos ? 0 : atoi(deviceRef.substr(pos+1).c_str());
+        m_emulatorLatencyUs = m_emulatorLatencyUs <= 0 ? 1500 : m_emulatorLatencyUs;
+        qDebug("AMBEWorker::open: emulated device with %d us latency", m_emulatorLatencyUs);
+        return true;
+    }
+
     return m_dvController.open(deviceRef);
 }
 
 void AMBEWorker::close()
 {
-    m_dvController.close();
+    if (m_emulatorLatencyUs > 0) {
+        m_emulatorLatencyUs = 0;
+    } else {
+        m_dvController.close();
+    }
 }
 
 void AMBEWorker::process()
@@ -77,53 +111,22 @@ void AMBEWorker::stop()
 void AMBEWorker::handleInputMessages()
 {
     Message* message;
-    m_audioBufferFill = 0;
-    AudioFifo *audioFifo = 0;
+    std::map<AudioFifo*, bool> touchedFifos;
 
     while ((message = m_inputMessageQueue.pop()) != 0)
     {
         if (MsgMbeDecode::match(*message))
         {
             MsgMbeDecode *decodeMsg = (MsgMbeDecode *) message;
-            int dBVolume = (decodeMsg->getVolumeIndex() - 30) / 4;
-            float volume = pow(10.0, dBVolume / 10.0f);
-            int upsampling = decodeMsg->getUpsampling();
-            upsampling = upsampling > 6 ? 6 : upsampling < 1 ? 1 : upsampling;
-
-            if ((volume != m_volume) || (upsampling != m_upsampling))
-            {
-                m_volume = volume;
-                m_upsampling = upsampling;
-                setVolumeFactors();
-            }
-
-            m_upsampleFilter.useHP(decodeMsg->getUseHP());
-
-            if (m_dvController.decode(m_dvAudioSamples, decodeMsg->getMbeFrame(), decodeMsg->getMbeRate()))
-            {
-                if (upsampling > 1) {
-                    upsample(upsampling, m_dvAudioSamples, SerialDV::MBE_AUDIO_BLOCK_SIZE, decodeMsg->getChannels());
-                } else {
-                    noUpsample(m_dvAudioSamples, SerialDV::MBE_AUDIO_BLOCK_SIZE, decodeMsg->getChannels());
-                }
-
-                audioFifo = decodeMsg->getAudioFifo();
+            AudioFifo *audioFifo = decodeMsg->getAudioFifo();
 
-                if (audioFifo && (m_audioBufferFill >= m_audioBuffer.size() - 960))
-                {
-                    uint res = audioFifo->write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
-
-                    if (res != m_audioBufferFill) {
-                        qDebug("AMBEWorker::handleInputMessages: %u/%u audio samples written", res, m_audioBufferFill);
-                    }
-
-                    m_audioBufferFill = 0;
-                }
-            }
-            else
-            {
-                qDebug("AMBEWorker::handleInputMessages: MsgMbeDecode: decode failed");
+            if (decode(*decodeMsg)) {
+                touchedFifos[audioFifo] = true;
             }
+
+            QMutexLocker mutexLocker(&m_streamsMutex);
+            m_streams[audioFifo].m_pendingFrames--;
+            m_queueDepth--;
         }
 
         delete message;
@@ -131,23 +134,120 @@ void AMBEWorker::handleInputMessages()
         if (m_inputMessageQueue.size() > 100)
         {
             qDebug("AMBEWorker::handleInputMessages: MsgMbeDecode: too many messages in queue. Flushing...");
+            QMutexLocker mutexLocker(&m_streamsMutex);
             m_inputMessageQueue.clear();
+            m_queueDepth = 0;
+
+            for (std::map<AudioFifo*, StreamState>::iterator it = m_streams.begin(); it != m_streams.end(); ++it) {
+                it->second.m_pendingFrames = 0;
+            }
+
             break;
         }
     }
 
-    if (audioFifo)
+    // write what is left for each stream served in this batch
+    for (std::map<AudioFifo*, bool>::iterator it = touchedFifos.begin(); it != touchedFifos.end(); ++it)
     {
-        uint res = audioFifo->write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
+        m_streamsMutex.lock();
+        StreamState& streamState = m_streams[it->first];
+        m_streamsMutex.unlock();
+        flush(it->first, streamState);
+    }
 
-        if (res != m_audioBufferFill) {
-            qDebug("AMBEWorker::handleInputMessages: %u/%u audio samples written", res, m_audioBufferFill);
-        }
+    pruneStreams();
+}
 
-        m_audioBufferFill = 0;
+bool AMBEWorker::decode(const MsgMbeDecode& decodeMsg)
+{
+    AudioFifo *audioFifo = const_cast<MsgMbeDecode&>(decodeMsg).getAudioFifo();
+    m_streamsMutex.lock(); // std::map references stay valid and only this thread erases
+    StreamState& streamState = m_streams[audioFifo];
+    m_streamsMutex.unlock();
+    int dBVolume = (decodeMsg.getVolumeIndex() - 30) / 4;
+    float volume = pow(10.0, dBVolume / 10.0f);
+    int upsampling = decodeMsg.getUpsampling();
+    upsampling = upsampling > 6 ? 6 : upsampling < 1 ? 1 : upsampling;
+
+    if ((volume != streamState.m_volume) || (upsampling != streamState.m_upsampling))
+    {
+        streamState.m_volume = volume;
+        streamState.m_upsampling = upsampling;
+        streamState.setVolumeFactors();
     }
 
-    m_timestamp = QDateTime::currentDateTime();
+    streamState.m_upsampleFilter.useHP(decodeMsg.getUseHP());
+    bool decoded;
+
+    if (m_emulatorLatencyUs > 0)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(m_emulatorLatencyUs)); // serial round trip
+        std::fill(m_dvAudioSamples, m_dvAudioSamples+SerialDV::MBE_AUDIO_BLOCK_SIZE, 0);
+        decoded = true;
+    }
+    else
+    {
+        decoded = m_dvController.decode(m_dvAudioSamples, decodeMsg.getMbeFrame(), decodeMsg.getMbeRate());
+    }
+
+    if (!decoded)
+    {
+        qDebug("AMBEWorker::decode: MsgMbeDecode: decode failed");
+        m_framesFailed++;
+        return false;
+    }
+
+    if (upsampling > 1) {
+        upsample(streamState, m_dvAudioSamples, SerialDV::MBE_AUDIO_BLOCK_SIZE, decodeMsg.getChannels());
+    } else {
+        noUpsample(streamState, m_dvAudioSamples, SerialDV::MBE_AUDIO_BLOCK_SIZE, decodeMsg.getChannels());
+    }
+
+    if (streamState.m_audioBufferFill >= streamState.m_audioBuffer.size() - 960) {
+        flush(audioFifo, streamState);
+    }
+
+    float latencyMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - decodeMsg.getPushTime()).count();
+    m_latencySumMs.store(m_latencySumMs.load(std::memory_order_relaxed) + latencyMs, std::memory_order_relaxed);
+
+    if (latencyMs > m_maxLatencyMs.load(std::memory_order_relaxed)) {
+        m_maxLatencyMs.store(latencyMs, std::memory_order_relaxed);
+    }
+
+    m_framesDecoded++;
+    streamState.m_lastActivity = QDateTime::currentDateTime();
+
+    return true;
+}
+
+void AMBEWorker::flush(AudioFifo *audioFifo, StreamState& streamState)
+{
+    if (audioFifo && (streamState.m_audioBufferFill > 0))
+    {
+        uint res = audioFifo->write((const quint8*)&streamState.m_audioBuffer[0], streamState.m_audioBufferFill);
+
+        if (res != streamState.m_audioBufferFill) {
+            qDebug("AMBEWorker::flush: %u/%u audio samples written", res, streamState.m_audioBufferFill);
+        }
+    }
+
+    streamState.m_audioBufferFill = 0;
+}
+
+void AMBEWorker::pruneStreams()
+{
+    QMutexLocker mutexLocker(&m_streamsMutex);
+    QDateTime now = QDateTime::currentDateTime();
+    std::map<AudioFifo*, StreamState>::iterator it = m_streams.begin();
+
+    while (it != m_streams.end())
+    {
+        if ((it->second.m_pendingFrames <= 0) && (it->second.m_lastActivity.msecsTo(now) > 10000)) { // 10 seconds inactivity
+            it = m_streams.erase(it);
+        } else {
+            ++it;
+        }
+    }
 }
 
 void AMBEWorker::pushMbeFrame(const unsigned char *mbeFrame,
@@ -158,75 +258,81 @@ void AMBEWorker::pushMbeFrame(const unsigned char *mbeFrame,
         int upsampling,
         AudioFifo *audioFifo)
 {
-    m_audioFifo = audioFifo;
+    QMutexLocker mutexLocker(&m_streamsMutex);
+    StreamState& streamState = m_streams[audioFifo];
+
+    if (streamState.m_pendingFrames <= 0) {
+        streamState.m_lastActivity = QDateTime::currentDateTime();
+    }
+
+    streamState.m_pendingFrames++;
+    m_queueDepth++;
     m_inputMessageQueue.push(MsgMbeDecode::create(mbeFrame, mbeRateIndex, mbeVolumeIndex, channels, useHP, upsampling, audioFifo));
 }
 
-bool AMBEWorker::isAvailable()
+int AMBEWorker::getStreamQueueDepth(AudioFifo *audioFifo)
 {
-	if (m_audioFifo == 0) {
-		return true;
-	}
-
-	return m_timestamp.time().msecsTo(QDateTime::currentDateTime().time()) > 1000; // 1 second inactivity timeout
+    QMutexLocker mutexLocker(&m_streamsMutex);
+    std::map<AudioFifo*, StreamState>::const_iterator it = m_streams.find(audioFifo);
+    return it == m_streams.end() ? 0 : it->second.m_pendingFrames;
 }
 
-bool AMBEWorker::hasFifo(AudioFifo *audioFifo)
+void AMBEWorker::getStats(Stats& stats)
 {
-    return m_audioFifo == audioFifo;
+    QMutexLocker mutexLocker(&m_streamsMutex);
+    stats.m_queueDepth = m_queueDepth.load();
+    stats.m_nbStreams = m_streams.size();
+    quint64 framesDecoded = m_framesDecoded.load();
+    stats.m_framesDecoded = framesDecoded;
+    stats.m_framesFailed = m_framesFailed.load();
+    stats.m_meanLatencyMs = framesDecoded == 0 ? 0.0f : m_latencySumMs.load() / framesDecoded;
+    stats.m_maxLatencyMs = m_maxLatencyMs.load();
 }
 
-void AMBEWorker::upsample(int upsampling, short *in, int nbSamplesIn, unsigned char channels)
+void AMBEWorker::upsample(StreamState& streamState, short *in, int nbSamplesIn, unsigned char channels)
 {
+    int upsampling = streamState.m_upsampling;
+
     for (int i = 0; i < nbSamplesIn; i++)
     {
         //float cur = m_upsampleFilter.usesHP() ? m_upsampleFilter.runHP((float) m_compressor.compress(in[i])) : (float) m_compressor.compress(in[i]);
-        float cur = m_upsampleFilter.usesHP() ? m_upsampleFilter.runHP((float) in[i]) : (float) in[i];
-        float prev = m_upsamplerLastValue;
+        float cur = streamState.m_upsampleFilter.usesHP() ? streamState.m_upsampleFilter.runHP((float) in[i]) : (float) in[i];
+        float prev = streamState.m_upsamplerLastValue;
         qint16 upsample;
 
         for (int j = 1; j <= upsampling; j++)
         {
-            upsample = (qint16) m_upsampleFilter.runLP(cur*m_upsamplingFactors[j] + prev*m_upsamplingFactors[upsampling-j]);
-            m_audioBuffer[m_audioBufferFill].l = channels & 1 ? m_compressor.compress(upsample) : 0;
-            m_audioBuffer[m_audioBufferFill].r = (channels>>1) & 1 ? m_compressor.compress(upsample) : 0;
+            upsample = (qint16) streamState.m_upsampleFilter.runLP(cur*streamState.m_upsamplingFactors[j] + prev*streamState.m_upsamplingFactors[upsampling-j]);
+            streamState.m_audioBuffer[streamState.m_audioBufferFill].l = channels & 1 ? m_compressor.compress(upsample) : 0;
+            streamState.m_audioBuffer[streamState.m_audioBufferFill].r = (channels>>1) & 1 ? m_compressor.compress(upsample) : 0;
 
-            if (m_audioBufferFill < m_audioBuffer.size() - 1) {
-                ++m_audioBufferFill;
+            if (streamState.m_audioBufferFill < streamState.m_audioBuffer.size() - 1) {
+                ++streamState.m_audioBufferFill;
             }
         }
 
-        m_upsamplerLastValue = cur;
+        streamState.m_upsamplerLastValue = cur;
     }
 
-    if (m_audioBufferFill >= m_audioBuffer.size() - 1) {
+    if (streamState.m_audioBufferFill >= streamState.m_audioBuffer.size() - 1) {
         qDebug("AMBEWorker::upsample(%d): audio buffer is full check its size", upsampling);
     }
 }
 
-void AMBEWorker::noUpsample(short *in, int nbSamplesIn, unsigned char channels)
+void AMBEWorker::noUpsample(StreamState& streamState, short *in, int nbSamplesIn, unsigned char channels)
 {
     for (int i = 0; i < nbSamplesIn; i++)
     {
-        float cur = m_upsampleFilter.usesHP() ? m_upsampleFilter.runHP((float) in[i]) : (float) in[i];
-        m_audioBuffer[m_audioBufferFill].l = channels & 1 ? cur*m_upsamplingFactors[0] : 0;
-        m_audioBuffer[m_audioBufferFill].r = (channels>>1) & 1 ? cur*m_upsamplingFactors[0] : 0;
+        float cur = streamState.m_upsampleFilter.usesHP() ? streamState.m_upsampleFilter.runHP((float) in[i]) : (float) in[i];
+        streamState.m_audioBuffer[streamState.m_audioBufferFill].l = channels & 1 ? cur*streamState.m_upsamplingFactors[0] : 0;
+        streamState.m_audioBuffer[streamState.m_audioBufferFill].r = (channels>>1) & 1 ? cur*streamState.m_upsamplingFactors[0] : 0;
 
-        if (m_audioBufferFill < m_audioBuffer.size() - 1) {
-            ++m_audioBufferFill;
+        if (streamState.m_audioBufferFill < streamState.m_audioBuffer.size() - 1) {
+            ++streamState.m_audioBufferFill;
         }
     }
 
-    if (m_audioBufferFill >= m_audioBuffer.size() - 1) {
+    if (streamState.m_audioBufferFill >= streamState.m_audioBuffer.size() - 1) {
         qDebug("AMBEWorker::noUpsample: audio buffer is full check its size");
     }
 }
-
-void AMBEWorker::setVolumeFactors()
-{
-    m_upsamplingFactors[0] = m_volume;
-
-    for (int i = 1; i <= m_upsampling; i++) {
-        m_upsamplingFactors[i] = (i*m_volume) / (float) m_upsampling;
-    }
-}
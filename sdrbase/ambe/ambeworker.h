@@ -19,9 +19,14 @@
 #ifndef SDRBASE_AMBE_AMBEWORKER_H_
 #define SDRBASE_AMBE_AMBEWORKER_H_
 
+#include <map>
+#include <atomic>
+#include <chrono>
+
 #include <QObject>
 #include <QDebug>
 #include <QDateTime>
+#include <QMutex>
 
 #include "export.h"
 #include "dvcontroller.h"
@@ -57,6 +62,7 @@ public:
         bool getUseHP() const { return m_useHP; }
         int getUpsampling() const { return m_upsampling; }
         AudioFifo *getAudioFifo() { return m_audioFifo; }
+        const std::chrono::steady_clock::time_point& getPushTime() const { return m_pushTime; }
 
         static MsgMbeDecode* create(
                 const unsigned char *mbeFrame,
@@ -78,6 +84,7 @@ public:
         bool m_useHP;
         int m_upsampling;
         AudioFifo *m_audioFifo;
+        std::chrono::steady_clock::time_point m_pushTime;
 
         MsgMbeDecode(const unsigned char *mbeFrame,
                 SerialDV::DVRate mbeRate,
@@ -92,12 +99,23 @@ public:
             m_channels(channels),
             m_useHP(useHP),
             m_upsampling(upsampling),
-            m_audioFifo(audioFifo)
+            m_audioFifo(audioFifo),
+            m_pushTime(std::chrono::steady_clock::now())
         {
             memcpy((void *) m_mbeFrame, (const void *) mbeFrame, SerialDV::DVController::getNbMbeBytes(m_mbeRate));
         }
     };
 
+    struct Stats
+    {
+        int m_queueDepth;         //!< frames pushed and not yet decoded
+        int m_nbStreams;          //!< audio streams currently served
+        quint64 m_framesDecoded;
+        quint64 m_framesFailed;
+        float m_meanLatencyMs;    //!< mean time from push to audio FIFO write
+        float m_maxLatencyMs;     //!< max time from push to audio FIFO write since the device was opened
+    };
+
     AMBEWorker();
     ~AMBEWorker();
 
@@ -109,12 +127,14 @@ public:
             int upsampling,
             AudioFifo *audioFifo);
 
-    bool open(const std::string& deviceRef); //!< Either serial device or ip:port
+    bool open(const std::string& deviceRef); //!< Either serial device or ip:port or emulator[:latency in microseconds]
     void close();
     void process();
     void stop();
-    bool isAvailable();
-    bool hasFifo(AudioFifo *audioFifo);
+    int getQueueDepth() const { return m_queueDepth.load(); }
+    int getStreamQueueDepth(AudioFifo *audioFifo); //!< frames pushed for this stream and not yet decoded
+    bool isEmulated() const { return m_emulatorLatencyUs > 0; }
+    void getStats(Stats& stats);
 
     void postTest()
     {
@@ -124,6 +144,8 @@ public:
 
     MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
 
+    static const std::string m_emulatorDeviceRef; //!< device reference prefix of the serial device emulator
+
 signals:
     void finished();
 
@@ -131,25 +153,43 @@ public slots:
     void handleInputMessages();
 
 private:
-    void upsample(int upsampling, short *in, int nbSamplesIn, unsigned char channels);
-    void noUpsample(short *in, int nbSamplesIn, unsigned char channels);
-    void setVolumeFactors();
+    /** Audio post processing state of one stream (DSD channel audio FIFO) */
+    struct StreamState
+    {
+        StreamState();
+        void setVolumeFactors();
+
+        AudioVector m_audioBuffer;
+        uint m_audioBufferFill;
+        float m_upsamplerLastValue;
+        MBEAudioInterpolatorFilter m_upsampleFilter;
+        int m_upsampling;
+        float m_volume;
+        float m_upsamplingFactors[7];
+        int m_pendingFrames;
+        QDateTime m_lastActivity;
+    };
+
+    bool decode(const MsgMbeDecode& decodeMsg);
+    void flush(AudioFifo *audioFifo, StreamState& streamState);
+    void upsample(StreamState& streamState, short *in, int nbSamplesIn, unsigned char channels);
+    void noUpsample(StreamState& streamState, short *in, int nbSamplesIn, unsigned char channels);
+    void pruneStreams();
 
     SerialDV::DVController m_dvController;
-    AudioFifo *m_audioFifo;
-    QDateTime m_timestamp;
+    int m_emulatorLatencyUs;  //!< emulated serial round trip latency. 0 when a real device is used.
     volatile bool m_running;
     int m_currentGainIn;
     int m_currentGainOut;
     short m_dvAudioSamples[SerialDV::MBE_AUDIO_BLOCK_SIZE];
-    AudioVector m_audioBuffer;
-    uint m_audioBufferFill;
-    float m_upsamplerLastValue;
-    float m_phase;
-    MBEAudioInterpolatorFilter m_upsampleFilter;
-    int m_upsampling;
-    float m_volume;
-    float m_upsamplingFactors[7];
+    std::map<AudioFifo*, StreamState> m_streams;
+    QMutex m_streamsMutex;
+    std::atomic<int> m_queueDepth;
+    // written by the worker thread only and read by getStats from other threads
+    std::atomic<quint64> m_framesDecoded;
+    std::atomic<quint64> m_framesFailed;
+    std::atomic<double> m_latencySumMs;
+    std::atomic<float> m_maxLatencyMs;
     AudioCompressor m_compressor;
 };
 
@@ -90,6 +90,7 @@ AudioDeviceManager::AudioDeviceManager()
 
     m_defaultInputStarted = false;
     m_defaultOutputStarted = false;
+    m_offlineOutputs = false;
 }
 
 AudioDeviceManager::~AudioDeviceManager()
@@ -257,7 +258,8 @@ void AudioDeviceManager::addAudioSink(AudioFifo* audioFifo, MessageQueue *sample
         m_audioOutputs[outputDeviceIndex] = new AudioOutput();
     }
 
-    if ((m_audioOutputs[outputDeviceIndex]->getNbFifos() == 0) &&
+    if (!m_offlineOutputs &&
+       (m_audioOutputs[outputDeviceIndex]->getNbFifos() == 0) &&
        ((outputDeviceIndex != -1) || !m_defaultOutputStarted))
     {
         startAudioOutput(outputDeviceIndex);
@@ -298,7 +300,7 @@ void AudioDeviceManager::removeAudioSink(AudioFifo* audioFifo)
     int audioOutputDeviceIndex = m_audioSinkFifos[audioFifo];
     m_audioOutputs[audioOutputDeviceIndex]->removeFifo(audioFifo);
 
-    if ((audioOutputDeviceIndex != -1) && (m_audioOutputs[audioOutputDeviceIndex]->getNbFifos() == 0)) {
+    if (!m_offlineOutputs && (audioOutputDeviceIndex != -1) && (m_audioOutputs[audioOutputDeviceIndex]->getNbFifos() == 0)) {
         stopAudioOutput(audioOutputDeviceIndex);
     }
 
@@ -307,6 +309,37 @@ void AudioDeviceManager::removeAudioSink(AudioFifo* audioFifo)
     m_audioFifoToSinkMessageQueues.remove(audioFifo);
 }
 
+void AudioDeviceManager::setAudioSinkSampleRate(AudioFifo* audioFifo, int sampleRate)
+{
+    if (m_audioSinkFifos.find(audioFifo) == m_audioSinkFifos.end())
+    {
+        qWarning("AudioDeviceManager::setAudioSinkSampleRate: audio FIFO %p not found", audioFifo);
+        return;
+    }
+
+    m_audioOutputs[m_audioSinkFifos[audioFifo]]->setFifoSampleRate(audioFifo, sampleRate);
+}
+
+void AudioDeviceManager::setAudioSinkGainPan(AudioFifo* audioFifo, float gain, float pan)
+{
+    if (m_audioSinkFifos.find(audioFifo) == m_audioSinkFifos.end())
+    {
+        qWarning("AudioDeviceManager::setAudioSinkGainPan: audio FIFO %p not found", audioFifo);
+        return;
+    }
+
+    m_audioOutputs[m_audioSinkFifos[audioFifo]]->setFifoGainPan(audioFifo, gain, pan);
+}
+
+void AudioDeviceManager::getOutputStreamsStats(int outputDeviceIndex, std::vector<AudioMixer::StreamStats>& stats)
+{
+    if (m_audioOutputs.find(outputDeviceIndex) == m_audioOutputs.end()) {
+        stats.clear();
+    } else {
+        m_audioOutputs[outputDeviceIndex]->getFifosStats(stats);
+    }
+}
+
 void AudioDeviceManager::addAudioSource(AudioFifo* audioFifo, MessageQueue *sampleSourceMessageQueue, int inputDeviceIndex)
 {
     qDebug("AudioDeviceManager::addAudioSource: %d: %p", inputDeviceIndex, audioFifo);
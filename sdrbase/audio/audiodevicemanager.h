@@ -99,6 +99,13 @@ public:
 
     void addAudioSink(AudioFifo* audioFifo, MessageQueue *sampleSinkMessageQueue, int outputDeviceIndex = -1); //!< Add the audio sink
     void removeAudioSink(AudioFifo* audioFifo); //!< Remove the audio sink
+    void setAudioSinkSampleRate(AudioFifo* audioFifo, int sampleRate); //!< Have the output mixer resample the sink. 0 for output device rate.
+    void setAudioSinkGainPan(AudioFifo* audioFifo, float gain, float pan); //!< Set sink gain and pan (-1.0 left to 1.0 right) in the output mixer
+    void getOutputStreamsStats(int outputDeviceIndex, std::vector<AudioMixer::StreamStats>& stats); //!< Stats of sinks attached to output device
+
+    void setOfflineOutputs(bool offlineOutputs) { m_offlineOutputs = offlineOutputs; } //!< Register audio sinks without starting output devices. FIFOs are then drained by the application.
+    bool getOfflineOutputs() const { return m_offlineOutputs; }
+    const QMap<AudioFifo*, int>& getAudioSinkFifos() const { return m_audioSinkFifos; } //!< audio sink FIFO to output device index map
 
     void addAudioSource(AudioFifo* audioFifo, MessageQueue *sampleSourceMessageQueue, int inputDeviceIndex = -1);    //!< Add an audio source
     void removeAudioSource(AudioFifo* audioFifo); //!< Remove an audio source
@@ -138,6 +145,7 @@ private:
 
     bool m_defaultOutputStarted; //!< True if the default audio output (-1) has already been started
     bool m_defaultInputStarted;  //!< True if the default audio input (-1) has already been started
+    bool m_offlineOutputs;       //!< True if audio output devices are not started (offline processing)
 
     void resetToDefaults();
     QByteArray serialize() const;
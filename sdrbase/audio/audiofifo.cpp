@@ -17,35 +17,53 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <string.h>
-#include <QTime>
+#include <QThread>
+#include <QElapsedTimer>
 #include "dsp/dsptypes.h"
 #include "audio/audiofifo.h"
 #include "audio/audionetsink.h"
+#include "dsp/pipelinemetrics.h"
 
 #define MIN(x, y) ((x) < (y) ? (x) : (y))
 
+std::atomic<bool> AudioFifo::m_blockingWrites(false);
+
 AudioFifo::AudioFifo() :
 	m_fifo(0),
-	m_sampleSize(sizeof(AudioSample))
+	m_sampleSize(sizeof(AudioSample)),
+	m_suspended(false),
+	m_activeAccesses(0),
+	m_overrunCount(0),
+	m_underrunCount(0),
+	m_hasConsumer(false)
 {
 	m_size = 0;
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_starved = true;
 }
 
 AudioFifo::AudioFifo(uint32_t numSamples) :
 	m_fifo(0),
-    m_sampleSize(sizeof(AudioSample))
+	m_sampleSize(sizeof(AudioSample)),
+	m_suspended(false),
+	m_activeAccesses(0),
+	m_overrunCount(0),
+	m_underrunCount(0),
+	m_hasConsumer(false)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
+	m_starved = true;
+
 	create(numSamples);
 }
 
 AudioFifo::~AudioFifo()
 {
 	QMutexLocker mutexLocker(&m_mutex);
+	suspend();
 
 	if (m_fifo != 0)
 	{
@@ -60,43 +78,72 @@ bool AudioFifo::setSize(uint32_t numSamples)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
-	return create(numSamples);
+	suspend();
+	bool res = create(numSamples);
+	resume();
+
+	return res;
 }
 
 uint AudioFifo::write(const quint8* data, uint32_t numSamples)
 {
-	uint32_t total;
-	uint32_t remaining;
-	uint32_t copyLen;
-
-	if (m_fifo == 0) {
+	if (!beginAccess()) {
 		return 0;
 	}
 
-	m_mutex.lock();
+	uint32_t total = writeAvailable(data, numSamples);
 
-	total = MIN(numSamples, m_size - m_fill);
-	remaining = total;
-
-	while (remaining != 0)
+	if ((total < numSamples) && m_blockingWrites.load(std::memory_order_relaxed) && m_hasConsumer.load(std::memory_order_relaxed))
 	{
-		if (isFull())
+		// back-pressure: wait for the consumer to make room. Give up if the FIFO is being resized or cleared.
+		QElapsedTimer waitTimer;
+		waitTimer.start();
+
+		while ((total < numSamples) && !m_suspended.load() && (waitTimer.elapsed() < m_blockingWriteTimeoutMs))
 		{
-			m_mutex.unlock();
-			return total - remaining; // written so far
+			QThread::usleep(500);
+			total += writeAvailable(data + total * m_sampleSize, numSamples - total);
 		}
+	}
+
+	uint32_t fillAfter = fill();
+
+	if (total < numSamples) {
+		m_overrunCount.fetch_add(1, std::memory_order_relaxed);
+	}
 
-		copyLen = MIN(remaining, m_size - m_fill);
-		copyLen = MIN(copyLen, m_size - m_tail);
+	if (PipelineMetrics::isEnabled())
+	{
+		PipelineMetrics *metrics = PipelineMetrics::instance();
+		metrics->addSamples(PipelineMetrics::StageAudioFifo, total);
+		metrics->updateFill(PipelineMetrics::StageAudioFifo, fillAfter, m_size);
+
+		if (total < numSamples) {
+			metrics->addOverflow(PipelineMetrics::StageAudioFifo);
+		}
+	}
+
+	endAccess();
+	return total;
+}
+
+uint32_t AudioFifo::writeAvailable(const quint8* data, uint32_t numSamples)
+{
+	uint32_t total = MIN(numSamples, m_size - fill());
+	uint32_t remaining = total;
+	uint32_t copyLen;
+
+	while (remaining != 0)
+	{
+		copyLen = MIN(remaining, m_size - m_tail);
 		memcpy(m_fifo + (m_tail * m_sampleSize), data, copyLen * m_sampleSize);
 		m_tail += copyLen;
 		m_tail %= m_size;
-		m_fill += copyLen;
 		data += copyLen * m_sampleSize;
 		remaining -= copyLen;
 	}
 
-	m_mutex.unlock();
+	m_fill.fetch_add(total, std::memory_order_release);
 	return total;
 }
 
@@ -106,50 +153,72 @@ uint AudioFifo::read(quint8* data, uint32_t numSamples)
 	uint32_t remaining;
 	uint32_t copyLen;
 
-	if (m_fifo == 0) {
+	if (!beginAccess()) {
 		return 0;
 	}
 
-	m_mutex.lock();
+	m_hasConsumer.store(true, std::memory_order_relaxed);
 
-	total = MIN(numSamples, m_fill);
+	if (numSamples == 0)
+	{
+		endAccess();
+		return 0;
+	}
+
+	total = MIN(numSamples, fill());
 	remaining = total;
 
 	while (remaining != 0)
 	{
-		if (isEmpty())
-		{
-			m_mutex.unlock();
-			return total - remaining; // read so far
-		}
-
-		copyLen = MIN(remaining, m_fill);
-		copyLen = MIN(copyLen, m_size - m_head);
+		copyLen = MIN(remaining, m_size - m_head);
 		memcpy(data, m_fifo + (m_head * m_sampleSize), copyLen * m_sampleSize);
-
 		m_head += copyLen;
 		m_head %= m_size;
-		m_fill -= copyLen;
 		data += copyLen * m_sampleSize;
 		remaining -= copyLen;
 	}
 
-	m_mutex.unlock();
+	m_fill.fetch_sub(total, std::memory_order_release);
+
+	if (total < numSamples)
+	{
+		// count only when a stream that was flowing runs dry, not every read of an idle or squelched stream
+		if (!m_starved)
+		{
+			m_underrunCount.fetch_add(1, std::memory_order_relaxed);
+
+			if (PipelineMetrics::isEnabled()) {
+				PipelineMetrics::instance()->addUnderrun(PipelineMetrics::StageAudioFifo);
+			}
+		}
+
+		m_starved = true;
+	}
+	else
+	{
+		m_starved = false;
+	}
+
+	endAccess();
 	return total;
 }
 
 uint AudioFifo::drain(uint32_t numSamples)
 {
-	QMutexLocker mutexLocker(&m_mutex);
+	if (!beginAccess()) {
+		return 0;
+	}
 
-	if(numSamples > m_fill)
-	{
-		numSamples = m_fill;
+	uint32_t fillCount = fill();
+
+	if (numSamples > fillCount) {
+		numSamples = fillCount;
 	}
 
 	m_head = (m_head + numSamples) % m_size;
-	m_fill -= numSamples;
+	m_fill.fetch_sub(numSamples, std::memory_order_release);
 
+	endAccess();
 	return numSamples;
 }
 
@@ -157,9 +226,18 @@ void AudioFifo::clear()
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
+	suspend();
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_starved = true;
+	resume();
+}
+
+void AudioFifo::resetCounters()
+{
+	m_overrunCount = 0;
+	m_underrunCount = 0;
 }
 
 bool AudioFifo::create(uint32_t numSamples)
@@ -173,9 +251,42 @@ bool AudioFifo::create(uint32_t numSamples)
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_starved = true;
 
 	m_fifo = new qint8[numSamples * m_sampleSize];
 	m_size = numSamples;
 
 	return true;
 }
+
+bool AudioFifo::beginAccess()
+{
+	m_activeAccesses.fetch_add(1);
+
+	if (m_suspended.load() || (m_fifo == 0) || (m_size == 0))
+	{
+		m_activeAccesses.fetch_sub(1);
+		return false;
+	}
+
+	return true;
+}
+
+void AudioFifo::endAccess()
+{
+	m_activeAccesses.fetch_sub(1);
+}
+
+void AudioFifo::suspend()
+{
+	m_suspended.store(true);
+
+	while (m_activeAccesses.load() != 0) { // wait for the producer and the consumer to leave the buffer
+		QThread::yieldCurrentThread();
+	}
+}
+
+void AudioFifo::resume()
+{
+	m_suspended.store(false);
+}
@@ -19,13 +19,19 @@
 #ifndef INCLUDE_AUDIOFIFO_H
 #define INCLUDE_AUDIOFIFO_H
 
+#include <atomic>
+
 #include <QObject>
 #include <QMutex>
-#include <QWaitCondition>
 
 #include "dsp/dsptypes.h"
 #include "export.h"
 
+/**
+ * Single producer single consumer audio FIFO. Reads and writes do not take any lock so that
+ * the audio device callback never waits on a demodulator thread. Only resizing and clearing
+ * suspend the FIFO while they reallocate or reset the buffer.
+ */
 class SDRBASE_API AudioFifo : public QObject {
 	Q_OBJECT
 public:
@@ -41,25 +47,52 @@ public:
 	uint32_t drain(uint32_t numSamples);
 	void clear();
 
-	inline uint32_t flush() { return drain(m_fill); }
-	inline uint32_t fill() const { return m_fill; }
-	inline bool isEmpty() const { return m_fill == 0; }
-	inline bool isFull() const { return m_fill == m_size; }
+	inline uint32_t flush() { return drain(fill()); }
+	inline uint32_t fill() const { return m_fill.load(std::memory_order_acquire); }
+	inline bool isEmpty() const { return fill() == 0; }
+	inline bool isFull() const { return fill() == m_size; }
 	inline uint32_t size() const { return m_size; }
 
+	uint32_t getOverrunCount() const { return m_overrunCount.load(std::memory_order_relaxed); } //!< number of writes that could not be fully stored
+	uint32_t getUnderrunCount() const { return m_underrunCount.load(std::memory_order_relaxed); } //!< number of times an active stream ran out of samples
+	void resetCounters();
+
+	/**
+	 * When set writes to a FIFO that has a consumer wait for it to make room instead of dropping
+	 * samples. Used for offline processing. The wait is bounded so that a stopped consumer cannot
+	 * block the producer forever.
+	 */
+	static void setBlockingWrites(bool blockingWrites) { m_blockingWrites.store(blockingWrites); }
+	static bool getBlockingWrites() { return m_blockingWrites.load(); }
+
 private:
-	QMutex m_mutex;
+	QMutex m_mutex; //!< serializes resize and clear operations
 
 	qint8* m_fifo;
 
 	const uint32_t m_sampleSize;
 
 	uint32_t m_size;
-	uint32_t m_fill;
-	uint32_t m_head;
-	uint32_t m_tail;
+	std::atomic<uint32_t> m_fill;
+	uint32_t m_head; //!< owned by the consumer
+	uint32_t m_tail; //!< owned by the producer
+	bool m_starved;  //!< owned by the consumer: last read was not fully served (idle streams start starved)
+
+	std::atomic<bool> m_suspended;       //!< set while the buffer is reallocated or reset
+	std::atomic<int> m_activeAccesses;   //!< number of read or write operations in progress
+	std::atomic<uint32_t> m_overrunCount;
+	std::atomic<uint32_t> m_underrunCount;
+	std::atomic<bool> m_hasConsumer;     //!< read at least once: blocking writes only wait for a FIFO that is drained
+
+	static std::atomic<bool> m_blockingWrites;
+	static const qint64 m_blockingWriteTimeoutMs = 2000;
 
 	bool create(uint32_t numSamples);
+	uint32_t writeAvailable(const quint8* data, uint32_t numSamples);
+	bool beginAccess();
+	void endAccess();
+	void suspend();
+	void resume();
 };
 
 #endif // INCLUDE_AUDIOFIFO_H
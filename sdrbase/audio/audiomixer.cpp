@@ -0,0 +1,291 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(USE_SSE2)
+#include <emmintrin.h>
+#endif
+
+#include "audiofifo.h"
+#include "audiomixer.h"
+
+AudioMixer::Stream::Stream(AudioFifo *audioFifo) :
+    m_audioFifo(audioFifo),
+    m_sampleRate(0),
+    m_gain(1.0f),
+    m_pan(0.0f),
+    m_gainL(1.0f),
+    m_gainR(1.0f),
+    m_bufferFill(0),
+    m_resample(false),
+    m_interpolatorDistance(1.0f),
+    m_interpolatorDistanceRemain(0.0f)
+{}
+
+void AudioMixer::Stream::setSampleRates(int streamSampleRate, int outputSampleRate)
+{
+    m_sampleRate = streamSampleRate;
+    m_bufferFill = 0;
+    m_resample = (streamSampleRate > 0) && (outputSampleRate > 0) && (streamSampleRate != outputSampleRate);
+
+    if (m_resample)
+    {
+        int minRate = std::min(streamSampleRate, outputSampleRate);
+        m_interpolator.create(16, streamSampleRate, 0.45 * minRate);
+        m_interpolatorDistance = (Real) streamSampleRate / (Real) outputSampleRate;
+        m_interpolatorDistanceRemain = 0;
+    }
+}
+
+void AudioMixer::Stream::setGainPan(float gain, float pan)
+{
+    m_gain = gain;
+    m_pan = pan < -1.0f ? -1.0f : pan > 1.0f ? 1.0f : pan;
+    m_gainL = m_gain * (m_pan > 0.0f ? 1.0f - m_pan : 1.0f);
+    m_gainR = m_gain * (m_pan < 0.0f ? 1.0f + m_pan : 1.0f);
+}
+
+unsigned int AudioMixer::Stream::pull(unsigned int nbSamples)
+{
+    if (m_buffer.size() < nbSamples) {
+        m_buffer.resize(nbSamples);
+    }
+
+    if (!m_resample)
+    {
+        m_bufferFill = m_audioFifo->read((quint8*) &m_buffer[0], nbSamples);
+    }
+    else
+    {
+        // m_bufferFill may already hold samples left over from the previous period
+        while (m_bufferFill < nbSamples)
+        {
+            unsigned int needed = (unsigned int) ((nbSamples - m_bufferFill) * m_interpolatorDistance) + 1;
+
+            if (m_readBuffer.size() < needed) {
+                m_readBuffer.resize(needed);
+            }
+
+            unsigned int nbRead = m_audioFifo->read((quint8*) &m_readBuffer[0], needed);
+
+            if (nbRead == 0) {
+                break;
+            }
+
+            for (unsigned int i = 0; i < nbRead; i++)
+            {
+                Complex c(m_readBuffer[i].l, m_readBuffer[i].r);
+                Complex ci;
+
+                if (m_interpolatorDistance < 1.0f) // interpolate
+                {
+                    while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
+                    {
+                        if (m_bufferFill == m_buffer.size()) {
+                            m_buffer.resize(2*m_buffer.size());
+                        }
+
+                        m_buffer[m_bufferFill].l = (qint16) std::max(-32768.0f, std::min(32767.0f, ci.real()));
+                        m_buffer[m_bufferFill].r = (qint16) std::max(-32768.0f, std::min(32767.0f, ci.imag()));
+                        m_bufferFill++;
+                        m_interpolatorDistanceRemain += m_interpolatorDistance;
+                    }
+                }
+                else // decimate
+                {
+                    if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
+                    {
+                        if (m_bufferFill == m_buffer.size()) {
+                            m_buffer.resize(2*m_buffer.size());
+                        }
+
+                        m_buffer[m_bufferFill].l = (qint16) std::max(-32768.0f, std::min(32767.0f, ci.real()));
+                        m_buffer[m_bufferFill].r = (qint16) std::max(-32768.0f, std::min(32767.0f, ci.imag()));
+                        m_bufferFill++;
+                        m_interpolatorDistanceRemain += m_interpolatorDistance;
+                    }
+                }
+            }
+        }
+    }
+
+    return std::min(m_bufferFill, nbSamples);
+}
+
+AudioMixer::AudioMixer() :
+    m_outputSampleRate(0)
+{}
+
+AudioMixer::~AudioMixer()
+{
+    for (std::list<Stream*>::iterator it = m_streams.begin(); it != m_streams.end(); ++it) {
+        delete *it;
+    }
+}
+
+void AudioMixer::setOutputSampleRate(int sampleRate)
+{
+    m_outputSampleRate = sampleRate;
+
+    for (std::list<Stream*>::iterator it = m_streams.begin(); it != m_streams.end(); ++it) {
+        (*it)->setSampleRates((*it)->m_sampleRate, m_outputSampleRate);
+    }
+}
+
+void AudioMixer::addStream(AudioFifo *audioFifo)
+{
+    if (findStream(audioFifo)) {
+        return;
+    }
+
+    Stream *stream = new Stream(audioFifo);
+    stream->setSampleRates(0, m_outputSampleRate);
+    m_streams.push_back(stream);
+}
+
+void AudioMixer::removeStream(AudioFifo *audioFifo)
+{
+    Stream *stream = findStream(audioFifo);
+
+    if (stream)
+    {
+        m_streams.remove(stream);
+        delete stream;
+    }
+}
+
+void AudioMixer::setStreamSampleRate(AudioFifo *audioFifo, int sampleRate)
+{
+    Stream *stream = findStream(audioFifo);
+
+    if (stream) {
+        stream->setSampleRates(sampleRate, m_outputSampleRate);
+    }
+}
+
+void AudioMixer::setStreamGainPan(AudioFifo *audioFifo, float gain, float pan)
+{
+    Stream *stream = findStream(audioFifo);
+
+    if (stream) {
+        stream->setGainPan(gain, pan);
+    }
+}
+
+void AudioMixer::getStreamsStats(std::vector<StreamStats>& stats) const
+{
+    stats.clear();
+
+    for (std::list<Stream*>::const_iterator it = m_streams.begin(); it != m_streams.end(); ++it)
+    {
+        StreamStats streamStats;
+        streamStats.m_sampleRate = (*it)->m_sampleRate == 0 ? m_outputSampleRate : (*it)->m_sampleRate;
+        streamStats.m_gain = (*it)->m_gain;
+        streamStats.m_pan = (*it)->m_pan;
+        streamStats.m_fill = (*it)->m_audioFifo->fill();
+        streamStats.m_underruns = (*it)->m_audioFifo->getUnderrunCount();
+        streamStats.m_overruns = (*it)->m_audioFifo->getOverrunCount();
+        stats.push_back(streamStats);
+    }
+}
+
+void AudioMixer::mix(qint16 *out, unsigned int nbSamples)
+{
+    if (m_mixBuffer.size() < 2*nbSamples) {
+        m_mixBuffer.resize(2*nbSamples);
+    }
+
+    std::fill(m_mixBuffer.begin(), m_mixBuffer.begin() + 2*nbSamples, 0.0f); // start with silence
+
+    for (std::list<Stream*>::iterator it = m_streams.begin(); it != m_streams.end(); ++it)
+    {
+        Stream *stream = *it;
+        unsigned int nbPulled = stream->pull(nbSamples);
+        accumulate(m_mixBuffer.data(), stream->m_buffer.data(), nbPulled, stream->m_gainL, stream->m_gainR);
+
+        if (stream->isResampled() && (stream->m_bufferFill > nbPulled)) // keep what was produced in excess for next period
+        {
+            std::copy(stream->m_buffer.begin() + nbPulled, stream->m_buffer.begin() + stream->m_bufferFill, stream->m_buffer.begin());
+            stream->m_bufferFill -= nbPulled;
+        }
+        else
+        {
+            stream->m_bufferFill = 0;
+        }
+    }
+
+    convert(out, m_mixBuffer.data(), nbSamples);
+}
+
+AudioMixer::Stream *AudioMixer::findStream(AudioFifo *audioFifo) const
+{
+    for (std::list<Stream*>::const_iterator it = m_streams.begin(); it != m_streams.end(); ++it)
+    {
+        if ((*it)->m_audioFifo == audioFifo) {
+            return *it;
+        }
+    }
+
+    return nullptr;
+}
+
+void AudioMixer::accumulate(float *mix, const AudioSample *src, unsigned int nbSamples, float gainL, float gainR)
+{
+    unsigned int i = 0;
+
+#if defined(USE_SSE2)
+    const __m128 gains = _mm_set_ps(gainR, gainL, gainR, gainL);
+
+    for (; i + 4 <= nbSamples; i += 4) // 4 stereo samples per iteration
+    {
+        __m128i s16 = _mm_loadu_si128((const __m128i*) &src[i]);
+        __m128 lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(s16, s16), 16)); // sign extend
+        __m128 hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(s16, s16), 16));
+        _mm_storeu_ps(&mix[2*i], _mm_add_ps(_mm_loadu_ps(&mix[2*i]), _mm_mul_ps(lo, gains)));
+        _mm_storeu_ps(&mix[2*i + 4], _mm_add_ps(_mm_loadu_ps(&mix[2*i + 4]), _mm_mul_ps(hi, gains)));
+    }
+#endif
+
+    for (; i < nbSamples; i++)
+    {
+        mix[2*i] += src[i].l * gainL;
+        mix[2*i + 1] += src[i].r * gainR;
+    }
+}
+
+void AudioMixer::convert(qint16 *out, const float *mix, unsigned int nbSamples)
+{
+    unsigned int i = 0;
+    unsigned int nbValues = 2*nbSamples;
+
+#if defined(USE_SSE2)
+    for (; i + 8 <= nbValues; i += 8) // saturating pack does the clipping
+    {
+        __m128i a = _mm_cvtps_epi32(_mm_loadu_ps(&mix[i]));
+        __m128i b = _mm_cvtps_epi32(_mm_loadu_ps(&mix[i + 4]));
+        _mm_storeu_si128((__m128i*) &out[i], _mm_packs_epi32(a, b));
+    }
+#endif
+
+    for (; i < nbValues; i++)
+    {
+        long s = std::lrint(mix[i]);
+        out[i] = s < -32768 ? -32768 : s > 32767 ? 32767 : s;
+    }
+}
@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_AUDIO_AUDIOMIXER_H_
+#define SDRBASE_AUDIO_AUDIOMIXER_H_
+
+#include <list>
+#include <vector>
+#include <stdint.h>
+
+#include "dsp/dsptypes.h"
+#include "dsp/interpolator.h"
+#include "export.h"
+
+class AudioFifo;
+
+/**
+ * Mixes the audio FIFOs attached to one audio output device into one stereo stream.
+ * Each stream has its own gain and pan and may run at a sample rate different from the
+ * device sample rate in which case it is resampled with a polyphase interpolator.
+ */
+class SDRBASE_API AudioMixer
+{
+public:
+    struct StreamStats
+    {
+        int m_sampleRate;        //!< stream sample rate (device rate if not resampled)
+        float m_gain;
+        float m_pan;
+        uint32_t m_fill;         //!< samples waiting in the stream FIFO
+        uint32_t m_underruns;    //!< times the stream FIFO ran out of samples
+        uint32_t m_overruns;     //!< writes the stream FIFO could not store completely
+    };
+
+    AudioMixer();
+    ~AudioMixer();
+
+    void setOutputSampleRate(int sampleRate);
+    int getOutputSampleRate() const { return m_outputSampleRate; }
+
+    void addStream(AudioFifo *audioFifo);
+    void removeStream(AudioFifo *audioFifo);
+    int getNbStreams() const { return m_streams.size(); }
+    void setStreamSampleRate(AudioFifo *audioFifo, int sampleRate); //!< 0 means device sample rate
+    void setStreamGainPan(AudioFifo *audioFifo, float gain, float pan); //!< pan from -1.0 (left) to 1.0 (right)
+    void getStreamsStats(std::vector<StreamStats>& stats) const;
+
+    /** Mix nbSamples stereo samples from all streams into interleaved 16 bit output */
+    void mix(qint16 *out, unsigned int nbSamples);
+
+private:
+    class Stream
+    {
+    public:
+        Stream(AudioFifo *audioFifo);
+        void setSampleRates(int streamSampleRate, int outputSampleRate);
+        void setGainPan(float gain, float pan);
+        unsigned int pull(unsigned int nbSamples); //!< fills m_buffer with up to nbSamples at output rate
+        bool isResampled() const { return m_resample; }
+
+        AudioFifo *m_audioFifo;
+        int m_sampleRate;
+        float m_gain;
+        float m_pan;
+        float m_gainL;
+        float m_gainR;
+        AudioVector m_buffer;      //!< samples at output rate ready for mixing
+        unsigned int m_bufferFill;
+
+    private:
+        bool m_resample;
+        Interpolator m_interpolator;
+        Real m_interpolatorDistance;
+        Real m_interpolatorDistanceRemain;
+        AudioVector m_readBuffer;  //!< samples at stream rate read from the FIFO
+    };
+
+    std::list<Stream*> m_streams;
+    int m_outputSampleRate;
+    std::vector<float> m_mixBuffer;
+
+    Stream *findStream(AudioFifo *audioFifo) const;
+    static void accumulate(float *mix, const AudioSample *src, unsigned int nbSamples, float gainL, float gainR);
+    static void convert(qint16 *out, const float *mix, unsigned int nbSamples);
+};
+
+#endif // SDRBASE_AUDIO_AUDIOMIXER_H_
@@ -23,6 +23,7 @@
 #include "audiooutput.h"
 #include "audiofifo.h"
 #include "audionetsink.h"
+#include "dsp/pipelinemetrics.h"
 
 AudioOutput::AudioOutput() :
 	m_mutex(QMutex::Recursive),
@@ -32,8 +33,7 @@ AudioOutput::AudioOutput() :
 	m_udpChannelMode(UDPChannelLeft),
 	m_udpChannelCodec(UDPCodecL16),
 	m_audioUsageCount(0),
-	m_onExit(false),
-	m_audioFifos()
+	m_onExit(false)
 {
 }
 
@@ -112,6 +112,7 @@ bool AudioOutput::start(int device, int rate)
             return false;
         }
 
+        m_mixer.setOutputSampleRate(m_audioFormat.sampleRate());
         m_audioOutput = new QAudioOutput(devInfo, m_audioFormat);
         m_audioNetSink = new AudioNetSink(0, m_audioFormat.sampleRate(), false);
 
@@ -161,14 +162,35 @@ void AudioOutput::addFifo(AudioFifo* audioFifo)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
-	m_audioFifos.push_back(audioFifo);
+	m_mixer.addStream(audioFifo);
 }
 
 void AudioOutput::removeFifo(AudioFifo* audioFifo)
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
-	m_audioFifos.remove(audioFifo);
+	m_mixer.removeStream(audioFifo);
+}
+
+void AudioOutput::setFifoSampleRate(AudioFifo* audioFifo, int sampleRate)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	m_mixer.setStreamSampleRate(audioFifo, sampleRate);
+}
+
+void AudioOutput::setFifoGainPan(AudioFifo* audioFifo, float gain, float pan)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	m_mixer.setStreamGainPan(audioFifo, gain, pan);
+}
+
+void AudioOutput::getFifosStats(std::vector<AudioMixer::StreamStats>& stats)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	m_mixer.getStreamsStats(stats);
 }
 
 /*
@@ -222,12 +244,6 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 {
     //qDebug("AudioOutput::readData: %lld", maxLen);
 
-    // Study this mutex on OSX, for now deadlocks possible
-    // Removed as it may indeed cause lockups and is in fact useless.
-//#ifndef __APPLE__
-//    QMutexLocker mutexLocker(&m_mutex);
-//#endif
-
 	unsigned int samplesPerBuffer = maxLen / 4;
 
 	if (samplesPerBuffer == 0)
@@ -235,100 +251,44 @@ qint64 AudioOutput::readData(char* data, qint64 maxLen)
 		return 0;
 	}
 
-	if (m_mixBuffer.size() < samplesPerBuffer * 2)
-	{
-		m_mixBuffer.resize(samplesPerBuffer * 2); // allocate 2 qint32 per sample (stereo)
-
-		if (m_mixBuffer.size() != samplesPerBuffer * 2)
-		{
-			return 0;
-		}
-	}
-
-	memset(&m_mixBuffer[0], 0x00, 2 * samplesPerBuffer * sizeof(m_mixBuffer[0])); // start with silence
-
-	// sum up a block from all fifos
-
-	for (std::list<AudioFifo*>::iterator it = m_audioFifos.begin(); it != m_audioFifos.end(); ++it)
-	{
-		// use outputBuffer as temp - yes, one memcpy could be saved
-		unsigned int samples = (*it)->read((quint8*) data, samplesPerBuffer);
-		const qint16* src = (const qint16*) data;
-		std::vector<qint32>::iterator dst = m_mixBuffer.begin();
-
-//		if (samples != framesPerBuffer)
-//		{
-//            qDebug("AudioOutput::readData: read %d samples vs %d requested", samples, framesPerBuffer);
-//		}
-
-		for (unsigned int i = 0; i < samples; i++)
-		{
-			*dst += *src;
-			++src;
-			++dst;
-			*dst += *src;
-			++src;
-			++dst;
-		}
-    }
-	// convert to int16
-
-	//std::vector<qint32>::const_iterator src = m_mixBuffer.begin(); // Valgrind optim
 	qint16* dst = (qint16*) data;
-	qint32 sl, sr;
 
-	for (unsigned int i = 0; i < samplesPerBuffer; i++)
+	// Never block the audio device callback: the FIFO list is only locked while streams are
+	// added, removed or reconfigured. In this case output silence for this period.
+	if (!m_mutex.tryLock())
 	{
-		// left channel
-
-		//s = *src++; // Valgrind optim
-		sl = m_mixBuffer[2*i];
-
-		if(sl < -32768)
-		{
-			sl = -32768;
-		}
-		else if (sl > 32767)
-		{
-			sl = 32767;
-		}
-
-		*dst++ = sl;
-
-		// right channel
-
-		//s = *src++; // Valgrind optim
-		sr = m_mixBuffer[2*i + 1];
-
-		if(sr < -32768)
-		{
-			sr = -32768;
-		}
-		else if (sr > 32767)
-		{
-			sr = 32767;
-		}
+		memset(data, 0x00, samplesPerBuffer * 4);
+		return samplesPerBuffer * 4;
+	}
 
-		*dst++ = sr;
+	PipelineMetrics::BlockTimer blockTimer(PipelineMetrics::StageAudioOutput, samplesPerBuffer);
+	m_mixer.mix(dst, samplesPerBuffer); // sum up a block from all fifos
+	m_mutex.unlock();
+	blockTimer.stop();
 
-		if ((m_copyAudioToUdp) && (m_audioNetSink))
+	if ((m_copyAudioToUdp) && (m_audioNetSink))
+	{
+		for (unsigned int i = 0; i < samplesPerBuffer; i++)
 		{
-	        switch (m_udpChannelMode)
-	        {
-            case UDPChannelStereo:
-                m_audioNetSink->write(sl, sr);
-                break;
-            case UDPChannelMixed:
-                m_audioNetSink->write((sl+sr)/2);
-                break;
-            case UDPChannelRight:
-                m_audioNetSink->write(sr);
-                break;
-	        case UDPChannelLeft:
-	        default:
-	            m_audioNetSink->write(sl);
-	            break;
-	        }
+			qint16 sl = dst[2*i];
+			qint16 sr = dst[2*i + 1];
+
+			switch (m_udpChannelMode)
+			{
+			case UDPChannelStereo:
+				m_audioNetSink->write(sl, sr);
+				break;
+			case UDPChannelMixed:
+				m_audioNetSink->write((sl+sr)/2);
+				break;
+			case UDPChannelRight:
+				m_audioNetSink->write(sr);
+				break;
+			case UDPChannelLeft:
+			default:
+				m_audioNetSink->write(sl);
+				break;
+			}
 		}
 	}
 
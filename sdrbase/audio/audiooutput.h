@@ -25,6 +25,7 @@
 #include <list>
 #include <vector>
 #include <stdint.h>
+#include "audio/audiomixer.h"
 #include "export.h"
 
 class QAudioOutput;
@@ -60,7 +61,10 @@ public:
 
 	void addFifo(AudioFifo* audioFifo);
 	void removeFifo(AudioFifo* audioFifo);
-	int getNbFifos() const { return m_audioFifos.size(); }
+	int getNbFifos() const { return m_mixer.getNbStreams(); }
+	void setFifoSampleRate(AudioFifo* audioFifo, int sampleRate); //!< FIFO samples are resampled to the device rate if different. 0 for device rate.
+	void setFifoGainPan(AudioFifo* audioFifo, float gain, float pan);
+	void getFifosStats(std::vector<AudioMixer::StreamStats>& stats);
 
 	unsigned int getRate() const { return m_audioFormat.sampleRate(); }
 	void setOnExit(bool onExit) { m_onExit = onExit; }
@@ -82,8 +86,7 @@ private:
 	uint m_audioUsageCount;
 	bool m_onExit;
 
-	std::list<AudioFifo*> m_audioFifos;
-	std::vector<qint32> m_mixBuffer;
+	AudioMixer m_mixer;
 
 	QAudioFormat m_audioFormat;
 
@@ -26,5 +26,6 @@ ChannelAPI::ChannelAPI(const QString& name, StreamType streamType) :
     m_indexInDeviceSet(-1),
     m_deviceSetIndex(0),
     m_deviceAPI(0),
-    m_uid(UidCalculator::getNewObjectId())
+    m_uid(UidCalculator::getNewObjectId()),
+    m_executorTask(nullptr)
 { }
\ No newline at end of file
@@ -25,6 +25,8 @@
 #include <stdint.h>
 
 #include "export.h"
+#include "dsp/basebandexecutor.h"
+#include "channel/channelsettingsfields.h"
 
 class DeviceAPI;
 
@@ -55,6 +57,25 @@ public:
     virtual const QString& getName() const { return m_name; }
     virtual qint64 getCenterFrequency() const = 0; //!< Applies to a default stream
 
+    /**
+     * Typed direct control of the most common settings for in process clients (e.g. CAT control)
+     * that do not go through the JSON settings. Return false if the channel does not support it.
+     */
+    virtual bool setSettingsFields(const ChannelSettingsFields& fields) { (void) fields; return false; } //!< All fields in one configuration
+    virtual bool getRfBandwidth(double& rfBandwidth) const { (void) rfBandwidth; return false; }
+    bool setCenterFrequency(qint64 frequency) //!< Applies to a default stream
+    {
+        ChannelSettingsFields fields;
+        fields.setInputFrequencyOffset(frequency);
+        return setSettingsFields(fields);
+    }
+    bool setRfBandwidth(double rfBandwidth)
+    {
+        ChannelSettingsFields fields;
+        fields.setRfBandwidth(rfBandwidth);
+        return setSettingsFields(fields);
+    }
+
     virtual QByteArray serialize() const = 0;
     virtual bool deserialize(const QByteArray& data) = 0;
 
@@ -122,6 +143,11 @@ public:
     virtual int getNbSourceStreams() const = 0;
     virtual qint64 getStreamCenterFrequency(int streamIndex, bool sinkElseSource) const = 0;
 
+    // Baseband executor accounting. Null if the channel runs its own thread.
+    const BasebandExecutor::Task *getExecutorTask() const { return m_executorTask; }
+
+protected:
+    void setExecutorTask(const BasebandExecutor::Task *executorTask) { m_executorTask = executorTask; }
 
 private:
     StreamType m_streamType;
@@ -134,6 +160,7 @@ private:
     int m_deviceSetIndex;
     DeviceAPI *m_deviceAPI;
     uint64_t m_uid;
+    const BasebandExecutor::Task *m_executorTask;
 };
 
 
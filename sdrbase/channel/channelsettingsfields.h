@@ -0,0 +1,72 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// Channel settings fields set directly by in process clients                    //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_CHANNEL_CHANNELSETTINGSFIELDS_H_
+#define SDRBASE_CHANNEL_CHANNELSETTINGSFIELDS_H_
+
+#include <QtGlobal>
+
+/**
+ * Some of the channel settings given together to ChannelAPI::setSettingsFields. Fields not set
+ * are left unchanged. All fields go to the channel in a single configuration message: two
+ * messages would each copy the current settings and the second would undo the first when the
+ * first is not applied yet (or the first is dropped by the queue coalescing).
+ */
+struct ChannelSettingsFields
+{
+    bool m_hasInputFrequencyOffset;
+    qint64 m_inputFrequencyOffset;
+    bool m_hasRfBandwidth;
+    double m_rfBandwidth;
+
+    ChannelSettingsFields() :
+        m_hasInputFrequencyOffset(false),
+        m_inputFrequencyOffset(0),
+        m_hasRfBandwidth(false),
+        m_rfBandwidth(0.0)
+    {}
+
+    void setInputFrequencyOffset(qint64 inputFrequencyOffset)
+    {
+        m_hasInputFrequencyOffset = true;
+        m_inputFrequencyOffset = inputFrequencyOffset;
+    }
+
+    void setRfBandwidth(double rfBandwidth)
+    {
+        m_hasRfBandwidth = true;
+        m_rfBandwidth = rfBandwidth;
+    }
+
+    bool isEmpty() const { return !m_hasInputFrequencyOffset && !m_hasRfBandwidth; }
+
+    /** Copy the fields that are set to a channel settings object with the usual member names */
+    template<typename Settings>
+    void apply(Settings& settings) const
+    {
+        if (m_hasInputFrequencyOffset) {
+            settings.m_inputFrequencyOffset = m_inputFrequencyOffset;
+        }
+        if (m_hasRfBandwidth) {
+            settings.m_rfBandwidth = m_rfBandwidth;
+        }
+    }
+};
+
+#endif // SDRBASE_CHANNEL_CHANNELSETTINGSFIELDS_H_
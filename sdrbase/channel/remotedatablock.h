@@ -40,7 +40,7 @@ struct RemoteMetaDataFEC
 {
     uint64_t m_centerFrequency;   //!<  8 center frequency in kHz
     uint32_t m_sampleRate;        //!< 12 sample rate in Hz
-    uint8_t  m_sampleBytes;       //!< 13 4 LSB: number of bytes per sample (2 or 4)
+    uint8_t  m_sampleBytes;       //!< 13 4 LSB: number of bytes per sample (2 or 4) 4 MSB: transport encoding (RemoteDataCodec::Encoding)
     uint8_t  m_sampleBits;        //!< 14 number of effective bits per sample (deprecated)
     uint8_t  m_nbOriginalBlocks;  //!< 15 number of blocks with original (protected) data
     uint8_t  m_nbFECBlocks;       //!< 16 number of blocks carrying FEC
@@ -80,7 +80,7 @@ struct RemoteHeader
     uint8_t  m_blockIndex;
     uint8_t  m_sampleBytes; //!<  number of bytes per sample (2 or 4) for this block
     uint8_t  m_sampleBits;  //!<  number of bits per sample
-    uint8_t  m_filler;
+    uint8_t  m_encoding;    //!<  transport encoding of this block (RemoteDataCodec::Encoding)
     uint16_t m_filler2;
 
     void init()
@@ -89,7 +89,7 @@ struct RemoteHeader
         m_blockIndex = 0;
         m_sampleBytes = 2;
         m_sampleBits = 16;
-        m_filler = 0;
+        m_encoding = 0;
         m_filler2 = 0;
     }
 };
@@ -127,6 +127,7 @@ struct RemoteTxControlBlock
     uint16_t m_frameIndex;
     int m_nbBlocksFEC;
     int m_txDelay;
+    int m_encoding;         //!< transport encoding of the sample blocks (RemoteDataCodec::Encoding)
     QString m_dataAddress;
     uint16_t m_dataPort;
 
@@ -136,6 +137,7 @@ struct RemoteTxControlBlock
         m_frameIndex = 0;
         m_nbBlocksFEC = 0;
         m_txDelay = 100;
+        m_encoding = 0;
         m_dataAddress = "127.0.0.1";
         m_dataPort = 9090;
     }
@@ -0,0 +1,217 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Remote sink channel (Rx) data blocks transport encoding                       //
+//                                                                               //
+// SDRangel can serve as a remote SDR front end that handles the interface       //
+// with a physical device and sends or receives the I/Q samples stream via UDP   //
+// to or from another SDRangel instance or any program implementing the same     //
+// protocol. The remote SDRangel is controlled via its Web REST API.             //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+
+#ifdef HAS_LZ4
+#include <lz4.h>
+#endif
+
+#include "remotedatablock.h"
+#include "remotedatacodec.h"
+
+namespace
+{
+    inline int32_t readValue(const uint8_t *raw, int index, int sampleBytes)
+    {
+        return sampleBytes == 2 ? (int32_t) ((const int16_t *) raw)[index] : ((const int32_t *) raw)[index];
+    }
+
+    inline void writeValue(uint8_t *raw, int index, int sampleBytes, int32_t value)
+    {
+        if (sampleBytes == 2) {
+            ((int16_t *) raw)[index] = (int16_t) value;
+        } else {
+            ((int32_t *) raw)[index] = value;
+        }
+    }
+
+    inline int getPackedSize(int nbValues, int packing)
+    {
+        return packing == RemoteDataCodec::EncodingPacked8 ? nbValues : (nbValues / 2) * 3;
+    }
+}
+
+int RemoteDataCodec::getEncoding(int packing, bool lz4)
+{
+    if ((packing != EncodingPacked8) && (packing != EncodingPacked12)) {
+        return EncodingRaw;
+    }
+
+    return packing | ((lz4 && isLZ4Available()) ? EncodingLZ4 : 0);
+}
+
+bool RemoteDataCodec::isLZ4Available()
+{
+#ifdef HAS_LZ4
+    return true;
+#else
+    return false;
+#endif
+}
+
+int RemoteDataCodec::getNbValuesPerBlock(int sampleBytes)
+{
+    return RemoteNbBytesPerBlock / sampleBytes;
+}
+
+int RemoteDataCodec::encodeBlock(const uint8_t *raw, uint8_t *encoded, int sampleBytes, int encoding)
+{
+    int packing = encoding & EncodingPackingMask;
+    int nbValues = getNbValuesPerBlock(sampleBytes) & ~1; // 12 bit values are packed by pairs
+    int32_t maxValue = packing == EncodingPacked8 ? 127 : 2047;
+    int32_t maxAbs = 0;
+
+    for (int i = 0; i < nbValues; i++) {
+        maxAbs = std::max(maxAbs, std::abs(readValue(raw, i, sampleBytes)));
+    }
+
+    // scale the block so that its largest value fits in the packed size
+    uint8_t shift = 0;
+
+    while ((maxAbs >> shift) > maxValue) {
+        shift++;
+    }
+
+    int32_t rounding = shift == 0 ? 0 : 1 << (shift - 1);
+    uint8_t packed[RemoteNbBytesPerBlock];
+    int packedSize = getPackedSize(nbValues, packing);
+
+    if (packing == EncodingPacked8)
+    {
+        for (int i = 0; i < nbValues; i++)
+        {
+            int32_t v = (readValue(raw, i, sampleBytes) + rounding) >> shift;
+            packed[i] = (uint8_t) (int8_t) std::min(std::max(v, -maxValue - 1), maxValue);
+        }
+    }
+    else
+    {
+        for (int i = 0, j = 0; i < nbValues; i += 2, j += 3)
+        {
+            int32_t a = std::min(std::max((readValue(raw, i, sampleBytes) + rounding) >> shift, -maxValue - 1), maxValue);
+            int32_t b = std::min(std::max((readValue(raw, i+1, sampleBytes) + rounding) >> shift, -maxValue - 1), maxValue);
+            packed[j]   = a & 0xFF;
+            packed[j+1] = ((a >> 8) & 0x0F) | ((b & 0x0F) << 4);
+            packed[j+2] = (b >> 4) & 0xFF;
+        }
+    }
+
+    RemoteEncodedBlockHeader *header = (RemoteEncodedBlockHeader *) encoded;
+    uint8_t *payload = encoded + sizeof(RemoteEncodedBlockHeader);
+    header->m_size = packedSize;
+    header->m_shift = shift;
+    header->m_flags = 0;
+
+#ifdef HAS_LZ4
+    if (encoding & EncodingLZ4)
+    {
+        int capacity = RemoteNbBytesPerBlock - sizeof(RemoteEncodedBlockHeader);
+        int compressedSize = LZ4_compress_default((const char *) packed, (char *) payload, packedSize, capacity);
+
+        if ((compressedSize > 0) && (compressedSize < packedSize)) // keep packed values if compression does not pay off
+        {
+            header->m_size = compressedSize;
+            header->m_flags = 1;
+        }
+    }
+#endif
+
+    if (header->m_flags == 0) {
+        std::memcpy(payload, packed, packedSize);
+    }
+
+    int size = sizeof(RemoteEncodedBlockHeader) + header->m_size;
+    std::memset(encoded + size, 0, RemoteNbBytesPerBlock - size);
+
+    return size;
+}
+
+bool RemoteDataCodec::decodeBlock(const uint8_t *encoded, uint8_t *raw, int sampleBytes, int encoding)
+{
+    const RemoteEncodedBlockHeader *header = (const RemoteEncodedBlockHeader *) encoded;
+    const uint8_t *payload = encoded + sizeof(RemoteEncodedBlockHeader);
+    int packing = encoding & EncodingPackingMask;
+    int nbValues = getNbValuesPerBlock(sampleBytes) & ~1;
+    int packedSize = getPackedSize(nbValues, packing);
+    uint8_t unpacked[RemoteNbBytesPerBlock];
+    const uint8_t *packed = payload;
+
+    if ((packing == EncodingRaw)
+     || ((sampleBytes != 2) && (sampleBytes != 4))
+     || (header->m_size > RemoteNbBytesPerBlock - sizeof(RemoteEncodedBlockHeader))
+     || (header->m_shift >= 8*sampleBytes))
+    {
+        std::memset(raw, 0, RemoteNbBytesPerBlock);
+        return false;
+    }
+
+    if (header->m_flags & 1)
+    {
+#ifdef HAS_LZ4
+        int size = LZ4_decompress_safe((const char *) payload, (char *) unpacked, header->m_size, packedSize);
+
+        if (size != packedSize)
+        {
+            std::memset(raw, 0, RemoteNbBytesPerBlock);
+            return false;
+        }
+
+        packed = unpacked;
+#else
+        std::memset(raw, 0, RemoteNbBytesPerBlock);
+        return false;
+#endif
+    }
+    else if (header->m_size != packedSize)
+    {
+        std::memset(raw, 0, RemoteNbBytesPerBlock);
+        return false;
+    }
+
+    int32_t scale = 1 << header->m_shift;
+
+    if (packing == EncodingPacked8)
+    {
+        for (int i = 0; i < nbValues; i++) {
+            writeValue(raw, i, sampleBytes, ((int8_t) packed[i]) * scale);
+        }
+    }
+    else
+    {
+        for (int i = 0, j = 0; i < nbValues; i += 2, j += 3)
+        {
+            int32_t a = packed[j] | ((packed[j+1] & 0x0F) << 8);
+            int32_t b = (packed[j+1] >> 4) | (packed[j+2] << 4);
+            writeValue(raw, i, sampleBytes, (a >= 2048 ? a - 4096 : a) * scale);
+            writeValue(raw, i+1, sampleBytes, (b >= 2048 ? b - 4096 : b) * scale);
+        }
+    }
+
+    std::memset(raw + nbValues*sampleBytes, 0, RemoteNbBytesPerBlock - nbValues*sampleBytes);
+
+    return true;
+}
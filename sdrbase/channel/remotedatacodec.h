@@ -0,0 +1,77 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Remote sink channel (Rx) data blocks transport encoding                       //
+//                                                                               //
+// SDRangel can serve as a remote SDR front end that handles the interface       //
+// with a physical device and sends or receives the I/Q samples stream via UDP   //
+// to or from another SDRangel instance or any program implementing the same     //
+// protocol. The remote SDRangel is controlled via its Web REST API.             //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHANNEL_REMOTEDATACODEC_H_
+#define CHANNEL_REMOTEDATACODEC_H_
+
+#include <stdint.h>
+
+#include "export.h"
+
+/**
+ * Transport encoding of the sample blocks of the remote protocol. Sample blocks are packed
+ * to 8 or 12 bits per I or Q value with a shift common to the block then optionally LZ4
+ * compressed. Each encoded block starts with a RemoteEncodedBlockHeader and the bytes past
+ * the significant size are zero. The meta data block (block zero) is never encoded.
+ *
+ * The encoding is signalled in the 4 MSB of RemoteMetaDataFEC::m_sampleBytes and in
+ * RemoteHeader::m_encoding so that blocks can be decoded before the meta data is known.
+ * Encoded frames are sent in datagrams shortened to the largest encoded block of the frame.
+ */
+class SDRBASE_API RemoteDataCodec
+{
+public:
+    enum Encoding
+    {
+        EncodingRaw = 0,      //!< samples as produced by the sender (2 or 4 bytes per I or Q)
+        EncodingPacked8 = 1,  //!< 8 bits per I or Q value
+        EncodingPacked12 = 2, //!< 12 bits per I or Q value
+        EncodingPackingMask = 3,
+        EncodingLZ4 = 4       //!< flag: LZ4 compression of the packed values
+    };
+
+    /** Encoding from the packing (0: none, 1: 8 bits, 2: 12 bits) and LZ4 options.
+     *  LZ4 applies to packed samples only and is dropped if it is not available in this build. */
+    static int getEncoding(int packing, bool lz4);
+    static bool isLZ4Available();
+    static int getNbValuesPerBlock(int sampleBytes);
+
+    /** Encode a block of RemoteNbBytesPerBlock raw bytes into a block of the same size.
+     *  Returns the number of significant bytes of the encoded block */
+    static int encodeBlock(const uint8_t *raw, uint8_t *encoded, int sampleBytes, int encoding);
+    /** Decode an encoded block into a block of RemoteNbBytesPerBlock raw bytes.
+     *  Returns false and zeroes the raw block if the encoded block is invalid */
+    static bool decodeBlock(const uint8_t *encoded, uint8_t *raw, int sampleBytes, int encoding);
+};
+
+#pragma pack(push, 1)
+struct RemoteEncodedBlockHeader
+{
+    uint16_t m_size;  //!< number of bytes of encoded values following the header
+    uint8_t  m_shift; //!< right shift applied to the values before packing
+    uint8_t  m_flags; //!< bit 0: values are LZ4 compressed
+};
+#pragma pack(pop)
+
+#endif /* CHANNEL_REMOTEDATACODEC_H_ */
@@ -17,8 +17,13 @@
 
 #include <algorithm>
 
+#include <QCoreApplication>
+#include <QThread>
+#include <QTimer>
+
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
+#include "dsp/spectrumvis.h"
 #include "plugin/pluginapi.h"
 #include "plugin/plugininterface.h"
 #include "settings/preset.h"
@@ -29,6 +34,19 @@
 #include "deviceset.h"
 
 
+// The spectrum vis of the tiles lives in the main thread but the last reference to the tiles may be
+// released by a web server thread: delete them in the main thread.
+static void deleteWaterfallTiles(WaterfallTiles *waterfallTiles)
+{
+    QCoreApplication *application = QCoreApplication::instance();
+
+    if (!application || (QThread::currentThread() == application->thread())) {
+        delete waterfallTiles;
+    } else {
+        QTimer::singleShot(0, application, [waterfallTiles]() { delete waterfallTiles; });
+    }
+}
+
 DeviceSet::ChannelInstanceRegistration::ChannelInstanceRegistration(const QString& channelName, ChannelAPI* channelAPI) :
     m_channelName(channelName),
     m_channelAPI(channelAPI)
@@ -46,6 +64,56 @@ DeviceSet::DeviceSet(int tabIndex, int deviceType)
 
 DeviceSet::~DeviceSet()
 {
+    if (m_waterfallTiles) {
+        applyWaterfallTilesSettings(m_waterfallTilesSettings, false);
+    }
+}
+
+bool DeviceSet::applyWaterfallTilesSettings(const WaterfallTiles::Settings& settings, bool enabled)
+{
+    if (!m_deviceSourceEngine) {
+        return false;
+    }
+
+    QMutexLocker mutexLocker(&m_waterfallTilesMutex);
+    m_waterfallTilesSettings = settings;
+
+    if (enabled)
+    {
+        if (!m_waterfallTiles)
+        {
+            m_waterfallTiles = std::shared_ptr<WaterfallTiles>(new WaterfallTiles(), deleteWaterfallTiles);
+            // may be called from a web server thread: have the main event loop serve the spectrum messages
+            m_waterfallTiles->getSpectrumVis()->moveToThread(QCoreApplication::instance()->thread());
+            m_waterfallTiles->applySettings(m_waterfallTilesSettings);
+            m_deviceSourceEngine->addSink(m_waterfallTiles->getSpectrumVis());
+            qDebug("DeviceSet::applyWaterfallTilesSettings: waterfall tiles enabled for %d", m_deviceTabIndex);
+        }
+        else
+        {
+            m_waterfallTiles->applySettings(m_waterfallTilesSettings);
+        }
+    }
+    else if (m_waterfallTiles)
+    {
+        m_deviceSourceEngine->removeSink(m_waterfallTiles->getSpectrumVis());
+        m_waterfallTiles.reset(); // deleted when the last web request using it is done
+        qDebug("DeviceSet::applyWaterfallTilesSettings: waterfall tiles disabled for %d", m_deviceTabIndex);
+    }
+
+    return true;
+}
+
+WaterfallTiles::Settings DeviceSet::getWaterfallTilesSettings() const
+{
+    QMutexLocker mutexLocker(&m_waterfallTilesMutex);
+    return m_waterfallTilesSettings;
+}
+
+std::shared_ptr<WaterfallTiles> DeviceSet::getWaterfallTiles() const
+{
+    QMutexLocker mutexLocker(&m_waterfallTilesMutex);
+    return m_waterfallTiles;
 }
 
 
@@ -18,8 +18,12 @@
 #ifndef SDRSRV_DEVICE_DEVICESET_H_
 #define SDRSRV_DEVICE_DEVICESET_H_
 
+#include <memory>
+
 #include <QTimer>
+#include <QMutex>
 
+#include "dsp/waterfalltiles.h"
 #include "export.h"
 
 class DeviceAPI;
@@ -58,6 +62,10 @@ public:
     void removeChannelInstanceAt(int index);
     void removeChannelInstance(ChannelAPI *channelAPI);
     void clearChannels();
+    // waterfall tiles (Rx only)
+    bool applyWaterfallTilesSettings(const WaterfallTiles::Settings& settings, bool enabled); //!< false if not Rx
+    WaterfallTiles::Settings getWaterfallTilesSettings() const;
+    std::shared_ptr<WaterfallTiles> getWaterfallTiles() const; //!< empty if disabled. Tiles stay valid while the pointer is held
 
 private:
     struct ChannelInstanceRegistration
@@ -79,6 +87,9 @@ private:
 
     ChannelInstanceRegistrations m_channelInstanceRegistrations;
     int m_deviceTabIndex;
+    std::shared_ptr<WaterfallTiles> m_waterfallTiles;
+    WaterfallTiles::Settings m_waterfallTilesSettings;
+    mutable QMutex m_waterfallTilesMutex; //!< tiles are enabled, disabled and fetched from web server threads
 
     void renameChannelInstances();
 };
@@ -0,0 +1,366 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+
+#include <QDebug>
+
+#include "basebandexecutor.h"
+
+BasebandExecutor::Task::Task(BasebandExecutor *executor, const std::function<void()>& work) :
+    m_executor(executor),
+    m_work(work),
+    m_state(StIdle),
+    m_enabled(false),
+    m_pending(false),
+    m_affinityGroup(-1),
+    m_runCount(0),
+    m_stolenCount(0),
+    m_runTimeNs(0),
+    m_startNs(0)
+{
+    m_homeWorker = executor->m_nextHomeWorker.fetch_add(1) % executor->getNbWorkers();
+}
+
+BasebandExecutor::Task::~Task()
+{
+    stop();
+}
+
+void BasebandExecutor::Task::start()
+{
+    m_runCount.store(0, std::memory_order_relaxed);
+    m_stolenCount.store(0, std::memory_order_relaxed);
+    m_runTimeNs.store(0, std::memory_order_relaxed);
+    m_startNs.store(m_executor->m_clock.nsecsElapsed(), std::memory_order_relaxed);
+    m_enabled.store(true);
+
+    if (m_pending.exchange(false)) {
+        schedule();
+    }
+}
+
+void BasebandExecutor::Task::stop()
+{
+    m_executor->m_nbStopping.fetch_add(1);
+    m_enabled.store(false);
+    m_executor->m_idleMutex.lock();
+
+    while (true)
+    {
+        if (m_executor->cancel(this)) // was waiting in a queue
+        {
+            m_pending.store(true);
+            m_state.store(StIdle);
+        }
+
+        if (m_state.load() == StIdle) {
+            break;
+        }
+
+        m_executor->m_idleCondition.wait(&m_executor->m_idleMutex); // let the current run complete
+    }
+
+    m_executor->m_idleMutex.unlock();
+    m_executor->m_nbStopping.fetch_sub(1);
+}
+
+void BasebandExecutor::Task::schedule()
+{
+    if (!m_enabled.load())
+    {
+        m_pending.store(true);
+
+        // start() may have been called in between and missed the pending flag
+        if (!m_enabled.load() || !m_pending.exchange(false)) {
+            return;
+        }
+    }
+
+    int state = m_state.load();
+
+    while (true)
+    {
+        if (state == StIdle)
+        {
+            if (m_state.compare_exchange_weak(state, StQueued))
+            {
+                if (m_enabled.load())
+                {
+                    m_executor->submit(this, m_executor->getHomeWorker(this));
+                    return;
+                }
+
+                // stop() was called since the check above: keep the request for start()
+                m_pending.store(true);
+                m_state.store(StIdle);
+                m_executor->notifyIdle();
+
+                if (!m_enabled.load() || !m_pending.exchange(false)) {
+                    return;
+                }
+
+                state = m_state.load(); // start() was called meanwhile
+            }
+        }
+        else if (state == StRunning)
+        {
+            if (m_state.compare_exchange_weak(state, StRunningRescheduled)) {
+                return;
+            }
+        }
+        else // already queued or rescheduled
+        {
+            return;
+        }
+    }
+}
+
+float BasebandExecutor::Task::getLoad() const
+{
+    int64_t elapsedNs = m_executor->m_clock.nsecsElapsed() - m_startNs.load(std::memory_order_relaxed);
+    return elapsedNs <= 0 ? 0.0f : (float) getRunTimeNs() / (float) elapsedNs;
+}
+
+BasebandExecutor::BasebandExecutor(bool affinityGroups, unsigned int nbWorkers) :
+    m_nbQueued(0),
+    m_nbSleeping(0),
+    m_nbStopping(0),
+    m_stop(false),
+    m_nextHomeWorker(0),
+    m_affinityGroups(affinityGroups)
+{
+    if (nbWorkers == 0) {
+        nbWorkers = std::max(1, QThread::idealThreadCount());
+    }
+
+    m_clock.start();
+
+    for (unsigned int i = 0; i < nbWorkers; i++) {
+        m_workers.push_back(new Worker(this, i));
+    }
+
+    for (std::vector<Worker*>::iterator it = m_workers.begin(); it != m_workers.end(); ++it) {
+        (*it)->start(QThread::HighPriority);
+    }
+
+    qDebug("BasebandExecutor::BasebandExecutor: %u workers affinity groups: %s",
+        nbWorkers, m_affinityGroups ? "on" : "off");
+}
+
+BasebandExecutor::~BasebandExecutor()
+{
+    m_sleepMutex.lock();
+    m_stop.store(true);
+    m_wakeCondition.wakeAll();
+    m_sleepMutex.unlock();
+
+    for (std::vector<Worker*>::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+    {
+        (*it)->wait();
+        delete *it;
+    }
+}
+
+unsigned int BasebandExecutor::getHomeWorker(const Task *task) const
+{
+    if (m_affinityGroups && (task->m_affinityGroup >= 0)) {
+        return task->m_affinityGroup % m_workers.size();
+    } else {
+        return task->m_homeWorker;
+    }
+}
+
+void BasebandExecutor::submit(Task *task, unsigned int workerIndex)
+{
+    Worker *worker = m_workers[workerIndex];
+    worker->m_mutex.lock();
+    worker->m_queue.push_back(task);
+    worker->m_mutex.unlock();
+    m_nbQueued.fetch_add(1);
+
+    if (m_nbSleeping.load() > 0)
+    {
+        m_sleepMutex.lock();
+        m_wakeCondition.wakeOne();
+        m_sleepMutex.unlock();
+    }
+}
+
+bool BasebandExecutor::cancel(Task *task)
+{
+    for (std::vector<Worker*>::iterator it = m_workers.begin(); it != m_workers.end(); ++it)
+    {
+        QMutexLocker mutexLocker(&(*it)->m_mutex);
+
+        for (std::deque<Task*>::iterator qit = (*it)->m_queue.begin(); qit != (*it)->m_queue.end(); ++qit)
+        {
+            if (*qit == task)
+            {
+                (*it)->m_queue.erase(qit);
+                m_nbQueued.fetch_sub(1);
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+BasebandExecutor::Task *BasebandExecutor::take(unsigned int workerIndex, bool& stolen)
+{
+    Task *task = nullptr;
+    Worker *worker = m_workers[workerIndex];
+
+    // own queue in order of arrival
+    worker->m_mutex.lock();
+
+    if (!worker->m_queue.empty())
+    {
+        task = worker->m_queue.front();
+        worker->m_queue.pop_front();
+    }
+
+    worker->m_mutex.unlock();
+    stolen = false;
+
+    // other queues from the most recent end
+    for (unsigned int i = 1; !task && (i < m_workers.size()); i++)
+    {
+        Worker *victim = m_workers[(workerIndex + i) % m_workers.size()];
+        victim->m_mutex.lock();
+
+        if (!victim->m_queue.empty())
+        {
+            task = victim->m_queue.back();
+            victim->m_queue.pop_back();
+            stolen = true;
+        }
+
+        victim->m_mutex.unlock();
+    }
+
+    if (task) {
+        m_nbQueued.fetch_sub(1);
+    }
+
+    return task;
+}
+
+void BasebandExecutor::execute(Task *task, unsigned int workerIndex, bool stolen)
+{
+    task->m_state.store(Task::StRunning);
+
+    if (!task->m_enabled.load())
+    {
+        task->m_pending.store(true);
+        task->m_state.store(Task::StIdle);
+        notifyIdle();
+        return;
+    }
+
+    qint64 startNs = m_clock.nsecsElapsed();
+    task->m_work();
+    task->m_runTimeNs.fetch_add(m_clock.nsecsElapsed() - startNs, std::memory_order_relaxed);
+    task->m_runCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (stolen) {
+        task->m_stolenCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    int state = Task::StRunning;
+
+    if (task->m_state.compare_exchange_strong(state, Task::StIdle))
+    {
+        notifyIdle();
+    }
+    else // scheduled while running
+    {
+        if (task->m_enabled.load())
+        {
+            task->m_state.store(Task::StQueued);
+            submit(task, workerIndex); // stay on this worker where its data is in cache
+        }
+        else
+        {
+            task->m_pending.store(true);
+            task->m_state.store(Task::StIdle);
+            notifyIdle();
+        }
+    }
+}
+
+// Called after a task became idle. The task must not be accessed anymore as a stop() returning
+// may destroy it so a stop() waiting for it is found with the executor counter.
+void BasebandExecutor::notifyIdle()
+{
+    if (m_nbStopping.load() > 0)
+    {
+        m_idleMutex.lock();
+        m_idleCondition.wakeAll();
+        m_idleMutex.unlock();
+    }
+}
+
+void BasebandExecutor::workerLoop(unsigned int index)
+{
+    if (m_affinityGroups) {
+        pinWorker(index);
+    }
+
+    while (!m_stop.load())
+    {
+        bool stolen;
+        Task *task = take(index, stolen);
+
+        if (task)
+        {
+            execute(task, index, stolen);
+            continue;
+        }
+
+        m_sleepMutex.lock();
+        m_nbSleeping.fetch_add(1);
+
+        while (!m_stop.load() && (m_nbQueued.load() == 0)) {
+            m_wakeCondition.wait(&m_sleepMutex);
+        }
+
+        m_nbSleeping.fetch_sub(1);
+        m_sleepMutex.unlock();
+    }
+}
+
+void BasebandExecutor::pinWorker(unsigned int index)
+{
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(index % QThread::idealThreadCount(), &cpuSet);
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0) {
+        qWarning("BasebandExecutor::pinWorker: cannot pin worker %u", index);
+    }
+#else
+    (void) index;
+#endif
+}
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_BASEBANDEXECUTOR_H_
+#define SDRBASE_DSP_BASEBANDEXECUTOR_H_
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+
+#include "export.h"
+
+/**
+ * Shared set of threads running the block processing of channel basebands. There is one worker
+ * per core. Each worker has its own queue of tasks and takes tasks from the queue of other workers
+ * when its own queue is empty (work stealing).
+ *
+ * A baseband owns a Task and calls Task::schedule() each time samples or messages are pending.
+ * Requests are coalesced: a task is queued at most once and a task is never run concurrently
+ * with itself so the baseband processing remains sequential like with a dedicated thread.
+ *
+ * With affinity groups enabled tasks of the same group (device set) are queued to the same
+ * worker and workers are pinned to a core (Linux only).
+ */
+class SDRBASE_API BasebandExecutor
+{
+public:
+    class SDRBASE_API Task
+    {
+    public:
+        Task(BasebandExecutor *executor, const std::function<void()>& work);
+        ~Task();
+
+        void setAffinityGroup(int group) { m_affinityGroup = group; }
+        int getAffinityGroup() const { return m_affinityGroup; }
+        void start();    //!< allow the task to run. Runs it if it was scheduled while stopped
+        void stop();     //!< prevent further runs and wait for the current run to complete
+        void schedule(); //!< thread safe
+
+        uint64_t getRunCount() const { return m_runCount.load(std::memory_order_relaxed); }
+        uint64_t getStolenCount() const { return m_stolenCount.load(std::memory_order_relaxed); } //!< runs on another worker than the home worker
+        uint64_t getRunTimeNs() const { return m_runTimeNs.load(std::memory_order_relaxed); }
+        float getLoad() const; //!< fraction of one core used since start
+
+    private:
+        enum State
+        {
+            StIdle,
+            StQueued,
+            StRunning,
+            StRunningRescheduled //!< scheduled again while running
+        };
+
+        friend class BasebandExecutor;
+
+        BasebandExecutor *m_executor;
+        std::function<void()> m_work;
+        std::atomic<int> m_state;
+        std::atomic<bool> m_enabled;
+        std::atomic<bool> m_pending;   //!< scheduled while stopped
+        int m_affinityGroup;
+        unsigned int m_homeWorker;
+        std::atomic<uint64_t> m_runCount;
+        std::atomic<uint64_t> m_stolenCount;
+        std::atomic<uint64_t> m_runTimeNs;
+        std::atomic<int64_t> m_startNs;
+    };
+
+    BasebandExecutor(bool affinityGroups = false, unsigned int nbWorkers = 0); //!< nbWorkers 0 for one worker per core
+    ~BasebandExecutor();
+
+    unsigned int getNbWorkers() const { return m_workers.size(); }
+    bool getAffinityGroups() const { return m_affinityGroups; }
+
+private:
+    class Worker : public QThread
+    {
+    public:
+        Worker(BasebandExecutor *executor, unsigned int index) : m_executor(executor), m_index(index) {}
+        QMutex m_mutex;
+        std::deque<Task*> m_queue;
+    private:
+        BasebandExecutor *m_executor;
+        unsigned int m_index;
+        void run() { m_executor->workerLoop(m_index); }
+    };
+
+    std::vector<Worker*> m_workers;
+    QMutex m_sleepMutex;
+    QWaitCondition m_wakeCondition;
+    QMutex m_idleMutex;             //!< with m_idleCondition lets Task::stop wait for a run to complete
+    QWaitCondition m_idleCondition;
+    std::atomic<int> m_nbStopping;  //!< Task::stop calls waiting for their task to become idle
+    std::atomic<int> m_nbQueued;
+    std::atomic<int> m_nbSleeping;
+    std::atomic<bool> m_stop;
+    std::atomic<unsigned int> m_nextHomeWorker;
+    bool m_affinityGroups;
+    QElapsedTimer m_clock;
+
+    void submit(Task *task, unsigned int workerIndex);
+    bool cancel(Task *task);
+    Task *take(unsigned int workerIndex, bool& stolen);
+    void execute(Task *task, unsigned int workerIndex, bool stolen);
+    void notifyIdle();
+    unsigned int getHomeWorker(const Task *task) const;
+    void workerLoop(unsigned int index);
+    void pinWorker(unsigned int index);
+};
+
+#endif // SDRBASE_DSP_BASEBANDEXECUTOR_H_
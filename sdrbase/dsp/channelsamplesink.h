@@ -32,6 +32,8 @@ public:
 	virtual ~ChannelSampleSink();
 
     virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end) = 0;
+    /** Feed a buffer owned by the caller. The sink may take the samples by swapping the vector contents */
+    virtual void feedBuffer(SampleVector& samples) { feed(samples.begin(), samples.end()); }
 };
 
 #endif // SDRBASE_DSP_CHANNELSAMPLESINK_H_
@@ -55,6 +55,7 @@ class SDRBASE_API CWKeyer : public QObject {
 public:
     class SDRBASE_API MsgConfigureCWKeyer : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureCWKeyer)
 
     public:
         const CWKeyerSettings& getSettings() const { return m_settings; }
@@ -15,6 +15,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include "decimatorc.h"
 
 DecimatorC::DecimatorC() :
@@ -51,6 +53,51 @@ bool DecimatorC::decimate(Complex c, Complex& cd)
     }
 }
 
+unsigned int DecimatorC::decimate(const Complex *in, unsigned int len, Complex *out)
+{
+    unsigned int nbOut = 0;
+
+    switch (m_log2Decim)
+    {
+    case 1:
+        for (unsigned int i = 0; i < len; i++) {
+            nbOut += decimate2(in[i], out[nbOut]) ? 1 : 0;
+        }
+        break;
+    case 2:
+        for (unsigned int i = 0; i < len; i++) {
+            nbOut += decimate4(in[i], out[nbOut]) ? 1 : 0;
+        }
+        break;
+    case 3:
+        for (unsigned int i = 0; i < len; i++) {
+            nbOut += decimate8(in[i], out[nbOut]) ? 1 : 0;
+        }
+        break;
+    case 4:
+        for (unsigned int i = 0; i < len; i++) {
+            nbOut += decimate16(in[i], out[nbOut]) ? 1 : 0;
+        }
+        break;
+    case 5:
+        for (unsigned int i = 0; i < len; i++) {
+            nbOut += decimate32(in[i], out[nbOut]) ? 1 : 0;
+        }
+        break;
+    case 6:
+        for (unsigned int i = 0; i < len; i++) {
+            nbOut += decimate64(in[i], out[nbOut]) ? 1 : 0;
+        }
+        break;
+    default: // no decimation
+        std::copy(in, in + len, out);
+        nbOut = len;
+        break;
+    }
+
+    return nbOut;
+}
+
 bool DecimatorC::decimate2(Complex c, Complex& cd)
 {
     float x = c.real();
@@ -33,6 +33,7 @@ public:
     DecimatorC();
     void setLog2Decim(unsigned int log2Decim);
     bool decimate(Complex c, Complex& cd);
+    unsigned int decimate(const Complex *in, unsigned int len, Complex *out); //!< Block version. Returns the number of samples written to out
     unsigned int getDecim() const { return m_decim; }
 
 private:
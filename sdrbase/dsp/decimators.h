@@ -20,6 +20,7 @@
 
 #include "dsp/dsptypes.h"
 #include "dsp/inthalfbandfiltereo.h"
+#include "dsp/sampleconverter.h"
 
 #define DECIMATORS_HB_FILTER_ORDER 64
 
@@ -463,15 +464,12 @@ private:
 template<typename StorageType, typename T, uint SdrBits, uint InputBits, bool IQOrder>
 void Decimators<StorageType, T, SdrBits, InputBits, IQOrder>::decimate1(SampleVector::iterator* it, const T* buf, qint32 len)
 {
-	qint32 xreal, yimag;
+	int nbSamples = len / 2;
 
-	for (int pos = 0; pos < len - 1; pos += 2)
+	if (nbSamples > 0)
 	{
-		xreal = IQOrder ? buf[pos+0] : buf[pos+1];
-		yimag = IQOrder ? buf[pos+1] : buf[pos+0];
-		(**it).setReal(xreal << decimation_shifts<SdrBits, InputBits>::pre1); // Valgrind optim (2 - comment not repeated)
-		(**it).setImag(yimag << decimation_shifts<SdrBits, InputBits>::pre1);
-		++(*it); // Valgrind optim (comment not repeated)
+		SampleConverter<T, 0, decimation_shifts<SdrBits, InputBits>::pre1, IQOrder>::convert(buf, &(**it), nbSamples);
+		*it += nbSamples;
 	}
 }
 
@@ -23,6 +23,7 @@
 #include <QByteArray>
 
 #include "samplesinkfifo.h"
+#include "sampleblockqueue.h"
 #include "util/message.h"
 #include "util/messagequeue.h"
 #include "export.h"
@@ -133,6 +134,7 @@ public:
 	virtual void setMessageQueueToGUI(MessageQueue *queue) = 0; // pure virtual so that child classes must have to deal with this
 	MessageQueue *getMessageQueueToGUI() { return m_guiMessageQueue; }
     SampleSinkFifo* getSampleFifo() { return &m_sampleFifo; }
+    virtual SampleBlockQueue* getSampleBlockQueue() { return nullptr; } //!< when not null the engine reads blocks from it instead of the FIFO
 
     static qint64 calculateDeviceCenterFrequency(
             quint64 centerFrequency,
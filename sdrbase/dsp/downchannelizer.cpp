@@ -22,6 +22,7 @@
 #include "dsp/inthalfbandfilter.h"
 #include "dsp/dspcommands.h"
 #include "dsp/hbfilterchainconverter.h"
+#include "dsp/pipelinemetrics.h"
 #include "downchannelizer.h"
 
 DownChannelizer::DownChannelizer(ChannelSampleSink* sampleSink) :
@@ -52,10 +53,13 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 
 	if (m_filterStages.size() == 0) // optimization when no downsampling is done anyway
 	{
+		PipelineMetrics::BlockTimer sinkTimer(PipelineMetrics::StageChannelSink, end - begin);
 		m_sampleSink->feed(begin, end);
 	}
 	else
 	{
+		PipelineMetrics::BlockTimer channelizerTimer(PipelineMetrics::StageChannelizer, end - begin);
+
 		for (SampleVector::const_iterator sample = begin; sample != end; ++sample)
 		{
 			Sample s(*sample);
@@ -82,7 +86,9 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 			}
 		}
 
-		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end());
+		channelizerTimer.stop();
+		PipelineMetrics::BlockTimer sinkTimer(PipelineMetrics::StageChannelSink, m_sampleBuffer.size());
+		m_sampleSink->feedBuffer(m_sampleBuffer);
 		m_sampleBuffer.clear();
 	}
 }
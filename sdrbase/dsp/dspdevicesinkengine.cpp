@@ -17,8 +17,17 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include <stdio.h>
+#include <algorithm>
+
+#if defined(USE_SSE2)
+#include <emmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
 #include <QDebug>
 #include <QThread>
+#include <QElapsedTimer>
 
 #include "dspdevicesinkengine.h"
 
@@ -157,6 +166,7 @@ QString DSPDeviceSinkEngine::sinkDeviceDescription()
 
 void DSPDeviceSinkEngine::workSampleFifo()
 {
+    QMutexLocker workLocker(&m_workMutex);
     SampleSourceFifo *sourceFifo = m_deviceSampleSink->getSampleFifo();
 
     if (!sourceFifo) {
@@ -167,7 +177,7 @@ void DSPDeviceSinkEngine::workSampleFifo()
     unsigned int iPart1Begin, iPart1End, iPart2Begin, iPart2End;
     unsigned int remainder = sourceFifo->remainder();
 
-    while ((remainder > 0) && (m_inputMessageQueue.size() == 0))
+    while (remainder > 0)
     {
         sourceFifo->write(remainder, iPart1Begin, iPart1End, iPart2Begin, iPart2End);
 
@@ -204,33 +214,8 @@ void DSPDeviceSinkEngine::workSamples(SampleVector& data, unsigned int iBegin, u
     }
     else
     {
-        m_sourceSampleBuffer.allocate(nbSamples);
-        SampleVector::iterator sBegin = m_sourceSampleBuffer.m_vector.begin();
-        BasebandSampleSources::const_iterator srcIt = m_basebandSampleSources.begin();
-        BasebandSampleSource *source = *srcIt;
-        source->pull(begin, nbSamples);
-        srcIt++;
-        m_sumIndex = 1;
-
-        for (; srcIt != m_basebandSampleSources.end(); ++srcIt, m_sumIndex++)
-        {
-            source = *srcIt;
-            source->pull(sBegin, nbSamples);
-            std::transform(
-                sBegin,
-                sBegin + nbSamples,
-                data.begin() + iBegin,
-                data.begin() + iBegin,
-                [this](Sample& a, const Sample& b) -> Sample {
-                    int den = m_sumIndex + 1; // at each stage scale sum by n/n+1 and input by 1/n+1
-                    int nom = m_sumIndex;     // so that final sum is scaled by N (number of channels)
-                    return Sample{
-                        a.real()/den + nom*(b.real()/den),
-                        a.imag()/den + nom*(b.imag()/den)
-                    };
-                }
-            );
-        }
+        pullSources(begin, nbSamples);
+        sumSources(&(*begin), m_sumInputs, nbSamples);
     }
 
     // possibly feed data to spectrum sink
@@ -239,6 +224,147 @@ void DSPDeviceSinkEngine::workSamples(SampleVector& data, unsigned int iBegin, u
     }
 }
 
+void DSPDeviceSinkEngine::pullSources(SampleVector::iterator begin, unsigned int nbSamples)
+{
+    unsigned int nbSources = m_basebandSampleSources.size();
+    m_sumInputs.resize(nbSources);
+    m_sumInputs[0] = &(*begin);
+
+    for (unsigned int i = 1; i < nbSources; i++)
+    {
+        m_sourceSampleBuffers[i-1].allocate(nbSamples);
+        m_sumInputs[i] = m_sourceSampleBuffers[i-1].m_vector.data();
+    }
+
+    // the first source pulls in place, the others in their own buffer
+    QElapsedTimer timer;
+
+    for (unsigned int i = 0; i < nbSources; i++)
+    {
+        timer.start();
+        SampleVector::iterator it = i == 0 ? begin : m_sourceSampleBuffers[i-1].m_vector.begin();
+        m_basebandSampleSources[i]->pull(it, nbSamples);
+        m_pullNs[i] = timer.nsecsElapsed();
+    }
+
+    QMutexLocker mutexLocker(&m_statsMutex);
+
+    for (unsigned int i = 0; i < nbSources; i++)
+    {
+        SourceStats& stats = m_sourcesStats[i];
+        stats.m_nbPulls++;
+        stats.m_nbSamples += nbSamples;
+        stats.m_totalNs += m_pullNs[i];
+        stats.m_maxNs = std::max(stats.m_maxNs, m_pullNs[i]);
+    }
+}
+
+void DSPDeviceSinkEngine::sumSources(Sample *out, const std::vector<const Sample*>& inputs, unsigned int nbSamples)
+{
+    unsigned int nbInputs = inputs.size();
+    float scale = 1.0f / nbInputs;
+    unsigned int i = 0;
+    // samples are handled as interleaved I/Q FixReal components
+    unsigned int nbComponents = 2*nbSamples;
+    FixReal *o = (FixReal*) out;
+
+#if defined(USE_SSE2) && (SDR_RX_SAMP_SZ == 16)
+    const __m128 vscale = _mm_set1_ps(scale);
+
+    for (; i + 8 <= nbComponents; i += 8)
+    {
+        __m128i accLo = _mm_setzero_si128();
+        __m128i accHi = _mm_setzero_si128();
+
+        for (unsigned int k = 0; k < nbInputs; k++)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*) (((const FixReal*) inputs[k]) + i));
+            accLo = _mm_add_epi32(accLo, _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16)); // sign extend to 32 bits
+            accHi = _mm_add_epi32(accHi, _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16));
+        }
+
+        accLo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(accLo), vscale));
+        accHi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(accHi), vscale));
+        _mm_storeu_si128((__m128i*) (o + i), _mm_packs_epi32(accLo, accHi));
+    }
+#elif defined(USE_SSE2)
+    const __m128 vscale = _mm_set1_ps(scale);
+
+    for (; i + 4 <= nbComponents; i += 4)
+    {
+        __m128i acc = _mm_setzero_si128();
+
+        for (unsigned int k = 0; k < nbInputs; k++) {
+            acc = _mm_add_epi32(acc, _mm_loadu_si128((const __m128i*) (((const FixReal*) inputs[k]) + i)));
+        }
+
+        acc = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtepi32_ps(acc), vscale));
+        _mm_storeu_si128((__m128i*) (o + i), acc);
+    }
+#elif defined(USE_NEON) && (SDR_RX_SAMP_SZ == 16)
+    for (; i + 8 <= nbComponents; i += 8)
+    {
+        int32x4_t accLo = vdupq_n_s32(0);
+        int32x4_t accHi = vdupq_n_s32(0);
+
+        for (unsigned int k = 0; k < nbInputs; k++)
+        {
+            int16x8_t v = vld1q_s16((const int16_t*) (((const FixReal*) inputs[k]) + i));
+            accLo = vaddw_s16(accLo, vget_low_s16(v));
+            accHi = vaddw_s16(accHi, vget_high_s16(v));
+        }
+
+        accLo = vcvtq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(accLo), scale));
+        accHi = vcvtq_s32_f32(vmulq_n_f32(vcvtq_f32_s32(accHi), scale));
+        vst1q_s16((int16_t*) (o + i), vcombine_s16(vqmovn_s32(accLo), vqmovn_s32(accHi)));
+    }
+#endif
+
+    for (; i < nbComponents; i++)
+    {
+        qint32 acc = 0;
+
+        for (unsigned int k = 0; k < nbInputs; k++) {
+            acc += ((const FixReal*) inputs[k])[i];
+        }
+
+        o[i] = (FixReal) (acc * scale);
+    }
+}
+
+void DSPDeviceSinkEngine::updateSources()
+{
+    unsigned int nbSources = m_basebandSampleSources.size();
+    m_sourceSampleBuffers.resize(nbSources < 2 ? 0 : nbSources - 1);
+    m_pullNs.resize(nbSources);
+}
+
+void DSPDeviceSinkEngine::getSourcesStats(std::vector<SourceStats>& stats)
+{
+    QMutexLocker mutexLocker(&m_statsMutex);
+    stats = m_sourcesStats;
+}
+
+void DSPDeviceSinkEngine::logSourcesStats()
+{
+    QMutexLocker mutexLocker(&m_statsMutex);
+
+    for (const auto& stats : m_sourcesStats)
+    {
+        if (stats.m_nbPulls == 0) {
+            continue;
+        }
+
+        qInfo("DSPDeviceSinkEngine::logSourcesStats: %s: pulls: %llu samples: %llu mean: %lld ns max: %lld ns %.1f ns/sample",
+            qPrintable(stats.m_name),
+            stats.m_nbPulls,
+            stats.m_nbSamples,
+            stats.m_totalNs / (qint64) stats.m_nbPulls,
+            stats.m_maxNs,
+            stats.m_totalNs / (double) stats.m_nbSamples);
+    }
+}
+
 // notStarted -> idle -> init -> running -+
 //                ^                       |
 //                +-----------------------+
@@ -266,7 +392,9 @@ DSPDeviceSinkEngine::State DSPDeviceSinkEngine::gotoIdle()
 	}
 
 	// stop everything
+	m_refiller.stopWork();
 	m_deviceSampleSink->stop();
+	logSourcesStats();
 
 	for(BasebandSampleSources::const_iterator it = m_basebandSampleSources.begin(); it != m_basebandSampleSources.end(); it++)
 	{
@@ -379,6 +507,8 @@ DSPDeviceSinkEngine::State DSPDeviceSinkEngine::gotoRunning()
         m_spectrumSink->start();
 	}
 
+	m_refiller.startWork(m_deviceSampleSink->getSampleFifo(), [this]() { workSampleFifo(); });
+
 	qDebug() << "DSPDeviceSinkEngine::gotoRunning: input message queue pending: " << m_inputMessageQueue.size();
 
 	return StRunning;
@@ -403,22 +533,6 @@ void DSPDeviceSinkEngine::handleSetSink(DeviceSampleSink* sink)
     }
 
     qDebug("DSPDeviceSinkEngine::handleSetSink: set %s", qPrintable(sink->getDeviceDescription()));
-
-    QObject::connect(
-        m_deviceSampleSink->getSampleFifo(),
-        &SampleSourceFifo::dataRead,
-        this,
-        &DSPDeviceSinkEngine::handleData,
-        Qt::QueuedConnection
-    );
-
-}
-
-void DSPDeviceSinkEngine::handleData()
-{
-	if (m_state == StRunning) {
-		 workSampleFifo();
-	}
 }
 
 void DSPDeviceSinkEngine::handleSynchronousMessages()
@@ -457,10 +571,12 @@ void DSPDeviceSinkEngine::handleSynchronousMessages()
 	}
 	else if (DSPAddSpectrumSink::match(*message))
 	{
+		QMutexLocker workLocker(&m_workMutex);
 		m_spectrumSink = ((DSPAddSpectrumSink*) message)->getSampleSink();
 	}
 	else if (DSPRemoveSpectrumSink::match(*message))
 	{
+		QMutexLocker workLocker(&m_workMutex);
 		BasebandSampleSink* spectrumSink = ((DSPRemoveSpectrumSink*) message)->getSampleSink();
 
 		if(m_state == StRunning) {
@@ -471,8 +587,15 @@ void DSPDeviceSinkEngine::handleSynchronousMessages()
 	}
 	else if (DSPAddBasebandSampleSource::match(*message))
 	{
+		QMutexLocker workLocker(&m_workMutex);
 		BasebandSampleSource* source = ((DSPAddBasebandSampleSource*) message)->getSampleSource();
 		m_basebandSampleSources.push_back(source);
+        {
+            QMutexLocker mutexLocker(&m_statsMutex);
+            m_sourcesStats.push_back(SourceStats());
+            m_sourcesStats.back().m_name = source->objectName();
+        }
+        updateSources();
         DSPSignalNotification notif(m_sampleRate, m_centerFrequency);
         source->handleMessage(notif);
 
@@ -483,13 +606,23 @@ void DSPDeviceSinkEngine::handleSynchronousMessages()
 	}
 	else if (DSPRemoveBasebandSampleSource::match(*message))
 	{
+		QMutexLocker workLocker(&m_workMutex);
 		BasebandSampleSource* source = ((DSPRemoveBasebandSampleSource*) message)->getSampleSource();
 
 		if(m_state == StRunning) {
 			source->stop();
 		}
 
-		m_basebandSampleSources.remove(source);
+		BasebandSampleSources::iterator it = std::find(m_basebandSampleSources.begin(), m_basebandSampleSources.end(), source);
+
+		if (it != m_basebandSampleSources.end())
+		{
+			QMutexLocker mutexLocker(&m_statsMutex);
+			m_sourcesStats.erase(m_sourcesStats.begin() + (it - m_basebandSampleSources.begin()));
+			m_basebandSampleSources.erase(it);
+		}
+
+		updateSources();
 	}
 
 	m_syncMessenger.done(m_state);
@@ -517,6 +650,7 @@ void DSPDeviceSinkEngine::handleInputMessages()
 				<< " m_centerFrequency: " << m_centerFrequency;
 
             // forward source changes to sources with immediate execution
+			QMutexLocker workLocker(&m_workMutex);
 
 			for(BasebandSampleSources::const_iterator it = m_basebandSampleSources.begin(); it != m_basebandSampleSources.end(); it++)
 			{
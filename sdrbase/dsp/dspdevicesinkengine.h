@@ -25,7 +25,7 @@
 #include <QWaitCondition>
 
 #include <stdint.h>
-#include <list>
+#include <vector>
 #include <map>
 
 #include "dsp/dsptypes.h"
@@ -33,6 +33,7 @@
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "util/incrementalvector.h"
+#include "dsp/samplesourcerefiller.h"
 #include "export.h"
 
 class DeviceSampleSink;
@@ -75,7 +76,24 @@ public:
 	void addSpectrumSink(BasebandSampleSink* spectrumSink);    //!< Add a spectrum vis baseband sample sink
 	void removeSpectrumSink(BasebandSampleSink* spectrumSink); //!< Add a spectrum vis baseband sample sink
 
+	struct SourceStats
+	{
+		QString m_name;         //!< baseband sample source object name
+		quint64 m_nbPulls;      //!< number of pulls
+		quint64 m_nbSamples;    //!< number of samples pulled
+		qint64 m_totalNs;       //!< cumulated pull time
+		qint64 m_maxNs;         //!< longest pull time
+
+		SourceStats() :
+			m_nbPulls(0),
+			m_nbSamples(0),
+			m_totalNs(0),
+			m_maxNs(0)
+		{}
+	};
+
 	State state() const { return m_state; } //!< Return DSP engine current state
+	void getSourcesStats(std::vector<SourceStats>& stats); //!< Pull timings of the baseband sample sources in the order they are summed
 
 	QString errorMessage(); //!< Return the current error message
 	QString sinkDeviceDescription(); //!< Return the sink device description
@@ -94,20 +112,29 @@ private:
 	DeviceSampleSink* m_deviceSampleSink;
 	int m_sampleSinkSequence;
 
-	typedef std::list<BasebandSampleSource*> BasebandSampleSources;
+	typedef std::vector<BasebandSampleSource*> BasebandSampleSources;
 	BasebandSampleSources m_basebandSampleSources; //!< baseband sample sources within main thread (usually file input)
 
 	BasebandSampleSink *m_spectrumSink;
-    IncrementalVector<Sample> m_sourceSampleBuffer;
+    std::vector<IncrementalVector<Sample>> m_sourceSampleBuffers; //!< one buffer per source except the first one that pulls in place
     IncrementalVector<Sample> m_sourceZeroBuffer;
+    std::vector<const Sample*> m_sumInputs;
+    QMutex m_statsMutex;
+    SampleSourceRefiller m_refiller; //!< refills the sample FIFO as soon as the device has read from it
+    QMutex m_workMutex;              //!< serializes refills with changes to the sources
+    std::vector<SourceStats> m_sourcesStats; //!< same order as m_basebandSampleSources
+    std::vector<qint64> m_pullNs;            //!< pull times of the current block, one slot per source
 
 	uint32_t m_sampleRate;
 	quint64 m_centerFrequency;
-    unsigned int m_sumIndex; //!< channel index when summing channels
 
 	void run();
 	void workSampleFifo(); //!< transfer samples from baseband sources to sink if in running state
     void workSamples(SampleVector& data, unsigned int iBegin, unsigned int iEnd);
+    void pullSources(SampleVector::iterator begin, unsigned int nbSamples);
+    void updateSources();  //!< resize buffers and statistics to the sources
+    void logSourcesStats();
+    static void sumSources(Sample *out, const std::vector<const Sample*>& inputs, unsigned int nbSamples); //!< out = mean of inputs
 
 	State gotoIdle();     //!< Go to the idle state
 	State gotoInit();     //!< Go to the acquisition init state from idle
@@ -117,7 +144,6 @@ private:
 	void handleSetSink(DeviceSampleSink* sink); //!< Manage sink setting
 
 private slots:
-	void handleData(); //!< Handle data when samples have to be written to the sample FIFO
 	void handleInputMessages(); //!< Handle input message queue
 	void handleSynchronousMessages(); //!< Handle synchronous messages with the thread
 };
@@ -23,8 +23,8 @@
 #include <stdio.h>
 #include <QDebug>
 #include "dsp/dspcommands.h"
-#include "util/fixed.h"
 #include "samplesinkfifo.h"
+#include "pipelinemetrics.h"
 
 DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	QThread(parent),
@@ -159,91 +159,7 @@ QString DSPDeviceSourceEngine::sourceDeviceDescription()
 
 void DSPDeviceSourceEngine::iqCorrections(SampleVector::iterator begin, SampleVector::iterator end, bool imbalanceCorrection)
 {
-    for(SampleVector::iterator it = begin; it < end; it++)
-    {
-        m_iBeta(it->real());
-        m_qBeta(it->imag());
-
-        if (imbalanceCorrection)
-        {
-#if IMBALANCE_INT
-            // acquisition
-            int64_t xi = (it->m_real - (int32_t) m_iBeta) << 5;
-            int64_t xq = (it->m_imag - (int32_t) m_qBeta) << 5;
-
-            // phase imbalance
-            m_avgII((xi*xi)>>28); // <I", I">
-            m_avgIQ((xi*xq)>>28); // <I", Q">
-
-            if ((int64_t) m_avgII != 0)
-            {
-                int64_t phi = (((int64_t) m_avgIQ)<<28) / (int64_t) m_avgII;
-                m_avgPhi(phi);
-            }
-
-            int64_t corrPhi = (((int64_t) m_avgPhi) * xq) >> 28;  //(m_avgPhi.asDouble()/16777216.0) * ((double) xq);
-
-            int64_t yi = xi - corrPhi;
-            int64_t yq = xq;
-
-            // amplitude I/Q imbalance
-            m_avgII2((yi*yi)>>28); // <I, I>
-            m_avgQQ2((yq*yq)>>28); // <Q, Q>
-
-            if ((int64_t) m_avgQQ2 != 0)
-            {
-                int64_t a = (((int64_t) m_avgII2)<<28) / (int64_t) m_avgQQ2;
-                Fixed<int64_t, 28> fA(Fixed<int64_t, 28>::internal(), a);
-                Fixed<int64_t, 28> sqrtA = sqrt((Fixed<int64_t, 28>) fA);
-                m_avgAmp(sqrtA.as_internal());
-            }
-
-            int64_t zq = (((int64_t) m_avgAmp) * yq) >> 28;
-
-            it->m_real = yi >> 5;
-            it->m_imag = zq >> 5;
-
-#else
-            // DC correction and conversion
-            float xi = (it->m_real - (int32_t) m_iBeta) / SDR_RX_SCALEF;
-            float xq = (it->m_imag - (int32_t) m_qBeta) / SDR_RX_SCALEF;
-
-            // phase imbalance
-            m_avgII(xi*xi); // <I", I">
-            m_avgIQ(xi*xq); // <I", Q">
-
-
-            if (m_avgII.asDouble() != 0) {
-                m_avgPhi(m_avgIQ.asDouble()/m_avgII.asDouble());
-            }
-
-            float& yi = xi; // the in phase remains the reference
-            float yq = xq - m_avgPhi.asDouble()*xi;
-
-            // amplitude I/Q imbalance
-            m_avgII2(yi*yi); // <I, I>
-            m_avgQQ2(yq*yq); // <Q, Q>
-
-            if (m_avgQQ2.asDouble() != 0) {
-                m_avgAmp(sqrt(m_avgII2.asDouble() / m_avgQQ2.asDouble()));
-            }
-
-            // final correction
-            float& zi = yi; // the in phase remains the reference
-            float zq = m_avgAmp.asDouble() * yq;
-
-            // convert and store
-            it->m_real = zi * SDR_RX_SCALEF;
-            it->m_imag = zq * SDR_RX_SCALEF;
-#endif
-        }
-        else
-        {
-            // DC correction only
-            it->m_real -= (int32_t) m_iBeta;
-            it->m_imag -= (int32_t) m_qBeta;
-        }
-    }
+    m_iqCorrector.process(begin, end, imbalanceCorrection);
 }
 
 void DSPDeviceSourceEngine::dcOffset(SampleVector::iterator begin, SampleVector::iterator end)
@@ -309,6 +225,14 @@ void DSPDeviceSourceEngine::imbalance(SampleVector::iterator begin, SampleVector
 
 void DSPDeviceSourceEngine::work()
 {
+	SampleBlockQueue* sampleBlockQueue = m_deviceSampleSource->getSampleBlockQueue();
+
+	if (sampleBlockQueue)
+	{
+		workSampleBlocks(sampleBlockQueue);
+		return;
+	}
+
 	SampleSinkFifo* sampleFifo = m_deviceSampleSource->getSampleFifo();
 	std::size_t samplesDone = 0;
 	bool positiveOnly = false;
@@ -321,6 +245,7 @@ void DSPDeviceSourceEngine::work()
 		SampleVector::iterator part2end;
 
 		std::size_t count = sampleFifo->readBegin(sampleFifo->fill(), &part1begin, &part1end, &part2begin, &part2end);
+		PipelineMetrics::BlockTimer blockTimer(PipelineMetrics::StageDeviceEngine, count);
 
 		// first part of FIFO data
 		if (part1begin != part1end)
@@ -362,6 +287,36 @@ void DSPDeviceSourceEngine::work()
 	}
 }
 
+// The blocks are processed in place: the source does not use them once handed over
+void DSPDeviceSourceEngine::workSampleBlocks(SampleBlockQueue* sampleBlockQueue)
+{
+	std::size_t samplesDone = 0;
+	bool positiveOnly = false;
+
+	while ((m_inputMessageQueue.size() == 0) && (samplesDone < m_sampleRate))
+	{
+		SampleBlock block = sampleBlockQueue->pop();
+
+		if (!block) {
+			break;
+		}
+
+		PipelineMetrics::BlockTimer blockTimer(PipelineMetrics::StageDeviceEngine, block->size());
+
+		if (m_dcOffsetCorrection)
+		{
+			iqCorrections(block->begin(), block->end(), m_iqImbalanceCorrection);
+		}
+
+		for (BasebandSampleSinks::const_iterator it = m_basebandSampleSinks.begin(); it != m_basebandSampleSinks.end(); ++it)
+		{
+			(*it)->feed(block->begin(), block->end(), positiveOnly);
+		}
+
+		samplesDone += block->size();
+	} // the block goes back to its pool when released here
+}
+
 // notStarted -> idle -> init -> running -+
 //                ^                       |
 //                +-----------------------+
@@ -527,6 +482,10 @@ void DSPDeviceSourceEngine::handleSetSource(DeviceSampleSource* source)
 	{
 		qDebug("DSPDeviceSourceEngine::handleSetSource: set %s", qPrintable(source->getDeviceDescription()));
 		connect(m_deviceSampleSource->getSampleFifo(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
+
+		if (m_deviceSampleSource->getSampleBlockQueue()) {
+			connect(m_deviceSampleSource->getSampleBlockQueue(), SIGNAL(dataReady()), this, SLOT(handleData()), Qt::QueuedConnection);
+		}
 	}
 	else
 	{
@@ -630,12 +589,7 @@ void DSPDeviceSourceEngine::handleInputMessages()
 				m_imbalance = 65536;
 			}
 
-			m_avgAmp.reset();
-			m_avgII.reset();
-			m_avgII2.reset();
-			m_avgIQ.reset();
-			m_avgPhi.reset();
-			m_avgQQ2.reset();
+			m_iqCorrector.reset();
 			m_iBeta.reset();
 			m_qBeta.reset();
 
@@ -29,9 +29,11 @@
 #include "util/syncmessenger.h"
 #include "export.h"
 #include "util/movingaverage.h"
+#include "dsp/iqcorrector.h"
 
 class DeviceSampleSource;
 class BasebandSampleSink;
+class SampleBlockQueue;
 
 class SDRBASE_API DSPDeviceSourceEngine : public QThread {
 	Q_OBJECT
@@ -100,24 +102,7 @@ private:
 	MovingAverageUtil<int32_t, int64_t, 1024> m_iBeta;
     MovingAverageUtil<int32_t, int64_t, 1024> m_qBeta;
 
-#if IMBALANCE_INT
-    // Fixed point DC + IQ corrections
-    MovingAverageUtil<int64_t, int64_t, 128> m_avgII;
-    MovingAverageUtil<int64_t, int64_t, 128> m_avgIQ;
-    MovingAverageUtil<int64_t, int64_t, 128> m_avgPhi;
-    MovingAverageUtil<int64_t, int64_t, 128> m_avgII2;
-    MovingAverageUtil<int64_t, int64_t, 128> m_avgQQ2;
-    MovingAverageUtil<int64_t, int64_t, 128> m_avgAmp;
-
-#else
-    // Floating point DC + IQ corrections
-    MovingAverageUtil<float, double, 128> m_avgII;
-    MovingAverageUtil<float, double, 128> m_avgIQ;
-    MovingAverageUtil<float, double, 128> m_avgII2;
-    MovingAverageUtil<float, double, 128> m_avgQQ2;
-    MovingAverageUtil<double, double, 128> m_avgPhi;
-    MovingAverageUtil<double, double, 128> m_avgAmp;
-#endif
+    IQCorrector m_iqCorrector; //!< DC + IQ corrections
 
     qint32 m_iRange;
 	qint32 m_qRange;
@@ -129,6 +114,7 @@ private:
 	void dcOffset(SampleVector::iterator begin, SampleVector::iterator end);
 	void imbalance(SampleVector::iterator begin, SampleVector::iterator end);
 	void work(); //!< transfer samples from source to sinks if in running state
+	void workSampleBlocks(SampleBlockQueue* sampleBlockQueue); //!< same with blocks handed over by the source
 
 	State gotoIdle();     //!< Go to the idle state
 	State gotoInit();     //!< Go to the acquisition init state from idle
@@ -24,6 +24,7 @@
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
 #include "dsp/fftfactory.h"
+#include "dsp/basebandexecutor.h"
 
 DSPEngine::DSPEngine() :
     m_deviceSourceEnginesUIDSequence(0),
@@ -31,7 +32,8 @@ DSPEngine::DSPEngine() :
     m_deviceMIMOEnginesUIDSequence(0),
     m_audioInputDeviceIndex(-1),    // default device
     m_audioOutputDeviceIndex(-1),   // default device
-    m_fftFactory(nullptr)
+    m_fftFactory(nullptr),
+    m_basebandExecutor(nullptr)
 {
 	m_dvSerialSupport = false;
     m_mimoSupport = false;
@@ -51,6 +53,10 @@ DSPEngine::~DSPEngine()
     if (m_fftFactory) {
         delete m_fftFactory;
     }
+
+    if (m_basebandExecutor) {
+        delete m_basebandExecutor;
+    }
 }
 
 Q_GLOBAL_STATIC(DSPEngine, dspEngine)
@@ -197,6 +203,24 @@ void DSPEngine::createFFTFactory(const QString& fftWisdomFileName)
     m_fftFactory = new FFTFactory(fftWisdomFileName);
 }
 
+void DSPEngine::createBasebandExecutor(bool affinityGroups)
+{
+    if (m_basebandExecutor) {
+        delete m_basebandExecutor;
+    }
+
+    m_basebandExecutor = new BasebandExecutor(affinityGroups);
+}
+
+BasebandExecutor *DSPEngine::getBasebandExecutor()
+{
+    if (!m_basebandExecutor) {
+        m_basebandExecutor = new BasebandExecutor();
+    }
+
+    return m_basebandExecutor;
+}
+
 void DSPEngine::preAllocateFFTs()
 {
     m_fftFactory->preallocate(7, 10, 1, 0); // pre-acllocate forward FFT only 1 per size from 128 to 1024
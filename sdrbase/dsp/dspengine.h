@@ -33,6 +33,7 @@ class DSPDeviceSourceEngine;
 class DSPDeviceSinkEngine;
 class DSPDeviceMIMOEngine;
 class FFTFactory;
+class BasebandExecutor;
 
 class SDRBASE_API DSPEngine : public QObject {
 	Q_OBJECT
@@ -88,6 +89,8 @@ public:
     void createFFTFactory(const QString& fftWisdomFileName);
     void preAllocateFFTs();
     FFTFactory *getFFTFactory() { return m_fftFactory; }
+    void createBasebandExecutor(bool affinityGroups);
+    BasebandExecutor *getBasebandExecutor(); //!< creates a default executor if none was created yet
 
 private:
 	std::vector<DSPDeviceSourceEngine*> m_deviceSourceEngines;
@@ -104,6 +107,7 @@ private:
     bool m_mimoSupport;
 	AMBEEngine m_ambeEngine;
     FFTFactory *m_fftFactory;
+    BasebandExecutor *m_basebandExecutor;
 };
 
 #endif // INCLUDE_DSPENGINE_H
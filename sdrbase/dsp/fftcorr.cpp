@@ -28,9 +28,24 @@
 void fftcorr::init_fft()
 {
     FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
-    fftASequence = fftFactory->getEngine(flen, false, &fftA);
-    fftBSequence = fftFactory->getEngine(flen, false, &fftB);
-    fftInvASequence = fftFactory->getEngine(flen, true, &fftInvA);
+
+    if (fftFactory)
+    {
+        ownFFT = false;
+        fftASequence = fftFactory->getEngine(flen, false, &fftA);
+        fftBSequence = fftFactory->getEngine(flen, false, &fftB);
+        fftInvASequence = fftFactory->getEngine(flen, true, &fftInvA);
+    }
+    else // no factory e.g. in command line tools
+    {
+        ownFFT = true;
+        fftA = FFTEngine::create(QString());
+        fftA->configure(flen, false);
+        fftB = FFTEngine::create(QString());
+        fftB->configure(flen, false);
+        fftInvA = FFTEngine::create(QString());
+        fftInvA->configure(flen, true);
+    }
 
     m_window.create(FFTWindow::Hanning, flen);
 
@@ -41,6 +56,7 @@ void fftcorr::init_fft()
 
     std::fill(dataA, dataA+flen, 0);
     std::fill(dataB, dataB+flen, 0);
+    std::fill(dataP, dataP+flen, 0);
 
     inptrA = 0;
     inptrB = 0;
@@ -55,17 +71,27 @@ fftcorr::fftcorr(int len) :
     fftInvA(nullptr),
     fftASequence(0),
     fftBSequence(0),
-    fftInvASequence(0)
+    fftInvASequence(0),
+    ownFFT(false)
 {
     init_fft();
 }
 
 fftcorr::~fftcorr()
 {
-    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
-    fftFactory->releaseEngine(flen, false, fftASequence);
-    fftFactory->releaseEngine(flen, false, fftBSequence);
-    fftFactory->releaseEngine(flen, true, fftInvASequence);
+    if (ownFFT)
+    {
+        delete fftA;
+        delete fftB;
+        delete fftInvA;
+    }
+    else
+    {
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        fftFactory->releaseEngine(flen, false, fftASequence);
+        fftFactory->releaseEngine(flen, false, fftBSequence);
+        fftFactory->releaseEngine(flen, true, fftInvASequence);
+    }
     delete[] dataA;
     delete[] dataB;
     delete[] dataBj;
@@ -84,16 +110,24 @@ int fftcorr::run(const cmplx& inA, const cmplx* inB, cmplx **out)
         return 0;
     }
 
+    correlate(inB != nullptr);
+
+    *out = dataP;
+    return flen2;
+}
+
+void fftcorr::correlate(bool cross)
+{
     m_window.apply(dataA, fftA->in());
     fftA->transform();
 
-    if (inB)
+    if (cross)
     {
         m_window.apply(dataB, fftB->in());
         fftB->transform();
     }
 
-    if (inB) {
+    if (cross) {
         std::transform(fftB->out(), fftB->out()+flen, dataBj, [](const cmplx& c) -> cmplx { return std::conj(c); });
     } else {
         std::transform(fftA->out(), fftA->out()+flen, dataBj, [](const cmplx& c) -> cmplx { return std::conj(c); });
@@ -107,14 +141,11 @@ int fftcorr::run(const cmplx& inA, const cmplx* inB, cmplx **out)
     std::fill(dataA, dataA+flen, 0);
     inptrA = 0;
 
-    if (inB)
+    if (cross)
     {
         std::fill(dataB, dataB+flen, 0);
         inptrB = 0;
     }
-
-    *out = dataP;
-    return flen2;
 }
 
 const fftcorr::cmplx& fftcorr::run(const cmplx& inA, const cmplx* inB)
@@ -127,3 +158,37 @@ const fftcorr::cmplx& fftcorr::run(const cmplx& inA, const cmplx* inB)
 
     return dataP[outptr++];
 }
+
+void fftcorr::run(const cmplx *inA, const cmplx *inB, int len, cmplx *out)
+{
+    int done = 0;
+
+    while (done < len)
+    {
+        int n = std::min(len - done, flen2 - inptrA);
+        std::copy(inA + done, inA + done + n, dataA + inptrA);
+        inptrA += n;
+
+        if (inB)
+        {
+            std::copy(inB + done, inB + done + n, dataB + inptrB);
+            inptrB += n;
+        }
+
+        if (inptrA < flen2)
+        {
+            std::copy(dataP + outptr, dataP + outptr + n, out + done);
+            outptr += n;
+        }
+        else
+        {
+            // same output as the sample version: the sample completing the buffer gets the first new value
+            std::copy(dataP + outptr, dataP + outptr + n - 1, out + done);
+            correlate(inB != nullptr);
+            out[done + n - 1] = dataP[0];
+            outptr = 1;
+        }
+
+        done += n;
+    }
+}
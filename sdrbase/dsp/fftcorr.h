@@ -36,9 +36,11 @@ public:
 
     int run(const cmplx& inA, const cmplx* inB, cmplx **out); //!< if inB = 0 then run auto-correlation
     const cmplx& run(const cmplx& inA, const cmplx* inB);
+    void run(const cmplx *inA, const cmplx *inB, int len, cmplx *out); //!< block version of the above. inB = 0 for auto-correlation
 
 private:
     void init_fft();
+    void correlate(bool cross); //!< correlate the current input buffers into dataP
     int flen;  //!< FFT length
     int flen2; //!< half FFT length
     FFTEngine *fftA;
@@ -47,6 +49,7 @@ private:
     unsigned int fftASequence;
     unsigned int fftBSequence;
     unsigned int fftInvASequence;
+    bool ownFFT;   //!< engines were created locally because there is no FFT factory
     FFTWindow m_window;
     cmplx *dataA;  // from A input
     cmplx *dataB;  // from B input
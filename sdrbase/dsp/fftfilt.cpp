@@ -39,31 +39,158 @@
 #include <sys/types.h>
 #include <memory.h>
 
+#include <map>
+
+#if defined(USE_SSE2)
+#include <emmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
+#include <QMutex>
+#include <QMutexLocker>
+
 #include <dsp/misc.h>
 #include <dsp/fftfilt.h>
+#include <dsp/dspengine.h>
+#include <dsp/fftfactory.h>
+#include <dsp/fftengine.h>
+
+namespace {
+
+// Filter spectra only depend on the filter type, FFT size and shape parameters.
+// Demodulators typically create many filters with the same parameters (one per channel
+// instance or one per bandwidth change) so the spectra are shared.
+struct SpectrumKey
+{
+    int m_type;
+    int m_len;
+    float m_p1;
+    float m_p2;
+
+    bool operator<(const SpectrumKey& other) const
+    {
+        if (m_type != other.m_type) {
+            return m_type < other.m_type;
+        }
+        if (m_len != other.m_len) {
+            return m_len < other.m_len;
+        }
+        if (m_p1 != other.m_p1) {
+            return m_p1 < other.m_p1;
+        }
+        return m_p2 < other.m_p2;
+    }
+};
+
+typedef std::map<SpectrumKey, std::shared_ptr<const std::vector<fftfilt::cmplx>>> SpectrumCache;
+
+QMutex spectrumCacheMutex;
+SpectrumCache spectrumCache;
+const unsigned int spectrumCacheMaxSize = 64;
+
+enum SpectrumType
+{
+    SpectrumBandpass,
+    SpectrumLowpass,
+    SpectrumRRC
+};
+
+// out[i] = a[i] * b[i]
+void multiplySpectrum(fftfilt::cmplx *out, const fftfilt::cmplx *a, const fftfilt::cmplx *b, int len)
+{
+    int i = 0;
+#if defined(USE_SSE2)
+    const __m128 signMask = _mm_set_ps(0.0f, -0.0f, 0.0f, -0.0f); // negate real part of the cross terms
+
+    for (; i + 1 < len; i += 2)
+    {
+        __m128 va = _mm_loadu_ps(reinterpret_cast<const float*>(&a[i]));   // ar0 ai0 ar1 ai1
+        __m128 vb = _mm_loadu_ps(reinterpret_cast<const float*>(&b[i]));   // br0 bi0 br1 bi1
+        __m128 bre = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(2, 2, 0, 0));       // br0 br0 br1 br1
+        __m128 bim = _mm_shuffle_ps(vb, vb, _MM_SHUFFLE(3, 3, 1, 1));       // bi0 bi0 bi1 bi1
+        __m128 asw = _mm_shuffle_ps(va, va, _MM_SHUFFLE(2, 3, 0, 1));       // ai0 ar0 ai1 ar1
+        __m128 r = _mm_add_ps(_mm_mul_ps(va, bre), _mm_xor_ps(_mm_mul_ps(asw, bim), signMask));
+        _mm_storeu_ps(reinterpret_cast<float*>(&out[i]), r);
+    }
+#elif defined(USE_NEON)
+    for (; i + 3 < len; i += 4)
+    {
+        float32x4x2_t va = vld2q_f32(reinterpret_cast<const float*>(&a[i]));
+        float32x4x2_t vb = vld2q_f32(reinterpret_cast<const float*>(&b[i]));
+        float32x4x2_t r;
+        r.val[0] = vmlsq_f32(vmulq_f32(va.val[0], vb.val[0]), va.val[1], vb.val[1]);
+        r.val[1] = vmlaq_f32(vmulq_f32(va.val[0], vb.val[1]), va.val[1], vb.val[0]);
+        vst2q_f32(reinterpret_cast<float*>(&out[i]), r);
+    }
+#endif
+    for (; i < len; i++) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+// out[i] = a[i] + b[i]
+void addBlocks(fftfilt::cmplx *out, const fftfilt::cmplx *a, const fftfilt::cmplx *b, int len)
+{
+    int i = 0;
+#if defined(USE_SSE2)
+    for (; i + 1 < len; i += 2)
+    {
+        __m128 va = _mm_loadu_ps(reinterpret_cast<const float*>(&a[i]));
+        __m128 vb = _mm_loadu_ps(reinterpret_cast<const float*>(&b[i]));
+        _mm_storeu_ps(reinterpret_cast<float*>(&out[i]), _mm_add_ps(va, vb));
+    }
+#elif defined(USE_NEON)
+    for (; i + 1 < len; i += 2)
+    {
+        float32x4_t va = vld1q_f32(reinterpret_cast<const float*>(&a[i]));
+        float32x4_t vb = vld1q_f32(reinterpret_cast<const float*>(&b[i]));
+        vst1q_f32(reinterpret_cast<float*>(&out[i]), vaddq_f32(va, vb));
+    }
+#endif
+    for (; i < len; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+} // namespace
 
 //------------------------------------------------------------------------------
 // initialize the filter
-// create forward and reverse FFTs
+// allocate forward and reverse FFTs from the FFT factory
 //------------------------------------------------------------------------------
 
-// Only need a single instance of g_fft, used for both forward and reverse
 void fftfilt::init_filter()
 {
 	flen2	= flen >> 1;
-	fft	= new g_fft<float>(flen);
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+
+    if (fftFactory)
+    {
+        ownFFT = false;
+        fwdFFTSequence = fftFactory->getEngine(flen, false, &fwdFFT);
+        invFFTSequence = fftFactory->getEngine(flen, true, &invFFT);
+    }
+    else // no factory e.g. in command line tools
+    {
+        ownFFT = true;
+        fwdFFTSequence = 0;
+        invFFTSequence = 0;
+        fwdFFT = FFTEngine::create(QString());
+        fwdFFT->configure(flen, false);
+        invFFT = FFTEngine::create(QString());
+        invFFT->configure(flen, true);
+    }
 
-	filter		= new cmplx[flen];
-    filterOpp   = new cmplx[flen];
-	data		= new cmplx[flen];
+	filter		= nullptr;
+    filterOpp   = nullptr;
+	data		= fwdFFT->in(); // forward FFT is out of place so the zero padded half is preserved
 	output		= new cmplx[flen2];
 	ovlbuf		= new cmplx[flen2];
 
-	memset(filter, 0, flen * sizeof(cmplx));
-    memset(filterOpp, 0, flen * sizeof(cmplx));
-	memset(data, 0, flen * sizeof(cmplx));
-	memset(output, 0, flen2 * sizeof(cmplx));
-	memset(ovlbuf, 0, flen2 * sizeof(cmplx));
+	std::fill(data, data + flen, cmplx{0, 0});
+	std::fill(output, output + flen2, cmplx{0, 0});
+	std::fill(ovlbuf, ovlbuf + flen2, cmplx{0, 0});
 
 	inptr = 0;
 }
@@ -95,153 +222,240 @@ fftfilt::fftfilt(float f2, int len)
 
 fftfilt::~fftfilt()
 {
-	if (fft) delete fft;
+    if (ownFFT)
+    {
+        delete fwdFFT;
+        delete invFFT;
+    }
+    else
+    {
+        FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+        fftFactory->releaseEngine(flen, false, fwdFFTSequence);
+        fftFactory->releaseEngine(flen, true, invFFTSequence);
+    }
 
-	if (filter) delete [] filter;
-    if (filterOpp) delete [] filterOpp;
-	if (data) delete [] data;
-	if (output) delete [] output;
-	if (ovlbuf) delete [] ovlbuf;
+	delete [] output;
+	delete [] ovlbuf;
 }
 
-void fftfilt::create_filter(float f1, float f2)
+// Returns the cached spectrum for the given parameters or computes it
+std::shared_ptr<const std::vector<fftfilt::cmplx>> fftfilt::getSpectrum(int type, float p1, float p2)
 {
-	// initialize the filter to zero
-	memset(filter, 0, flen * sizeof(cmplx));
-
-	// create the filter shape coefficients by fft
-	bool b_lowpass, b_highpass;
-	b_lowpass = (f2 != 0);
-	b_highpass = (f1 != 0);
-
-	for (int i = 0; i < flen2; i++) {
-		filter[i] = 0;
-	// lowpass @ f2
-		if (b_lowpass)
-			filter[i] += fsinc(f2, i, flen2);
-	// highighpass @ f1
-		if (b_highpass)
-			filter[i] -= fsinc(f1, i, flen2);
-	}
-	// highpass is delta[flen2/2] - h(t)
-	if (b_highpass && f2 < f1)
-		filter[flen2 / 2] += 1;
+    SpectrumKey key{type, flen, p1, p2};
+    QMutexLocker mutexLocker(&spectrumCacheMutex);
+    SpectrumCache::iterator it = spectrumCache.find(key);
 
-	for (int i = 0; i < flen2; i++)
-		filter[i] *= _blackman(i, flen2);
+    if (it != spectrumCache.end()) {
+        return it->second;
+    }
 
-	fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
+    if (spectrumCache.size() >= spectrumCacheMaxSize)
+    {
+        // drop spectra not used by any filter anymore
+        for (SpectrumCache::iterator itc = spectrumCache.begin(); itc != spectrumCache.end();)
+        {
+            if (itc->second.use_count() == 1) {
+                itc = spectrumCache.erase(itc);
+            } else {
+                ++itc;
+            }
+        }
+    }
 
-	// normalize the output filter for unity gain
-	float scale = 0, mag;
-	for (int i = 0; i < flen2; i++) {
-		mag = abs(filter[i]);
-		if (mag > scale) scale = mag;
-	}
-	if (scale != 0) {
-		for (int i = 0; i < flen; i++)
-			filter[i] /= scale;
-	}
+    std::shared_ptr<std::vector<cmplx>> spectrum = std::make_shared<std::vector<cmplx>>(flen);
+    computeSpectrum(type, p1, p2, *spectrum);
+    spectrumCache[key] = spectrum;
+
+    return spectrum;
 }
 
-// Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
-void fftfilt::create_dsb_filter(float f2)
+void fftfilt::computeSpectrum(int type, float p1, float p2, std::vector<cmplx>& spectrum)
 {
-	// initialize the filter to zero
-	memset(filter, 0, flen * sizeof(cmplx));
-
-	for (int i = 0; i < flen2; i++) {
-		filter[i] = fsinc(f2, i, flen2);
-		filter[i] *= _blackman(i, flen2);
-	}
-
-	fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
+    if (type == SpectrumRRC) // constructed directly from frequency domain response
+    {
+        for (int i = 0; i < flen; i++) {
+            spectrum[i] = frrc(p1, p2, i, flen);
+        }
+    }
+    else
+    {
+        // the forward FFT input holds pending samples
+        std::vector<cmplx> pending(data, data + inptr);
+        cmplx *impulse = fwdFFT->in();
+        std::fill(impulse, impulse + flen, cmplx{0, 0});
 
-	// normalize the output filter for unity gain
-	float scale = 0, mag;
-	for (int i = 0; i < flen2; i++) {
-		mag = abs(filter[i]);
-		if (mag > scale) scale = mag;
-	}
-	if (scale != 0) {
-		for (int i = 0; i < flen; i++)
-			filter[i] /= scale;
-	}
-}
+        if (type == SpectrumBandpass)
+        {
+            float f1 = p1;
+            float f2 = p2;
+            // create the filter shape coefficients by fft
+            bool b_lowpass, b_highpass;
+            b_lowpass = (f2 != 0);
+            b_highpass = (f1 != 0);
+
+            for (int i = 0; i < flen2; i++) {
+                impulse[i] = 0;
+            // lowpass @ f2
+                if (b_lowpass)
+                    impulse[i] += fsinc(f2, i, flen2);
+            // highighpass @ f1
+                if (b_highpass)
+                    impulse[i] -= fsinc(f1, i, flen2);
+            }
+            // highpass is delta[flen2/2] - h(t)
+            if (b_highpass && f2 < f1)
+                impulse[flen2 / 2] += 1;
+
+            for (int i = 0; i < flen2; i++)
+                impulse[i] *= _blackman(i, flen2);
+        }
+        else
+        {
+            for (int i = 0; i < flen2; i++) {
+                impulse[i] = fsinc(p1, i, flen2);
+                impulse[i] *= _blackman(i, flen2);
+            }
+        }
 
-// Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
-// used with runAsym for in band / opposite band asymmetrical filtering. Can be used for vestigial sideband modulation.
-void fftfilt::create_asym_filter(float fopp, float fin)
-{
-    // in band
-    // initialize the filter to zero
-    memset(filter, 0, flen * sizeof(cmplx));
+        fwdFFT->transform(); // filter was expressed in the time domain (impulse response)
+        std::copy(fwdFFT->out(), fwdFFT->out() + flen, spectrum.begin());
 
-    for (int i = 0; i < flen2; i++) {
-        filter[i] = fsinc(fin, i, flen2);
-        filter[i] *= _blackman(i, flen2);
+        // restore pending samples and zero padding
+        std::fill(impulse, impulse + flen, cmplx{0, 0});
+        std::copy(pending.begin(), pending.end(), impulse);
     }
 
-    fft->ComplexFFT(filter); // filter was expressed in the time domain (impulse response)
-
     // normalize the output filter for unity gain
     float scale = 0, mag;
-    for (int i = 0; i < flen2; i++) {
-        mag = abs(filter[i]);
-        if (mag > scale) scale = mag;
-    }
-    if (scale != 0) {
-        for (int i = 0; i < flen; i++)
-            filter[i] /= scale;
+    int nbBins = type == SpectrumRRC ? flen : flen2;
+
+    for (int i = 0; i < nbBins; i++)
+    {
+        mag = abs(spectrum[i]);
+        if (mag > scale) {
+            scale = mag;
+        }
     }
 
-    // opposite band
-    // initialize the filter to zero
-    memset(filterOpp, 0, flen * sizeof(cmplx));
+    // the inverse FFT is not normalized so fold its 1/N factor in the filter
+    scale = (scale != 0) ? scale * flen : flen;
 
-    for (int i = 0; i < flen2; i++) {
-        filterOpp[i] = fsinc(fopp, i, flen2);
-        filterOpp[i] *= _blackman(i, flen2);
+    for (int i = 0; i < flen; i++) {
+        spectrum[i] /= scale;
     }
+}
 
-    fft->ComplexFFT(filterOpp); // filter was expressed in the time domain (impulse response)
+void fftfilt::create_filter(float f1, float f2)
+{
+    filterSpectrum = getSpectrum(SpectrumBandpass, f1, f2);
+    filter = filterSpectrum->data();
+}
 
-    // normalize the output filter for unity gain
-    scale = 0;
-    for (int i = 0; i < flen2; i++) {
-        mag = abs(filterOpp[i]);
-        if (mag > scale) scale = mag;
-    }
-    if (scale != 0) {
-        for (int i = 0; i < flen; i++)
-            filterOpp[i] /= scale;
-    }
+// Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
+void fftfilt::create_dsb_filter(float f2)
+{
+    filterSpectrum = getSpectrum(SpectrumLowpass, f2, 0);
+    filter = filterSpectrum->data();
+}
+
+// Double the size of FFT used for equivalent SSB filter or assume FFT is half the size of the one used for SSB
+// used with runAsym for in band / opposite band asymmetrical filtering. Can be used for vestigial sideband modulation.
+void fftfilt::create_asym_filter(float fopp, float fin)
+{
+    filterSpectrum = getSpectrum(SpectrumLowpass, fin, 0); // in band
+    filter = filterSpectrum->data();
+    filterOppSpectrum = getSpectrum(SpectrumLowpass, fopp, 0); // opposite band
+    filterOpp = filterOppSpectrum->data();
 }
 
 // This filter is constructed directly from frequency domain response. Run with runFilt.
 void fftfilt::create_rrc_filter(float fb, float a)
 {
-    std::fill(filter, filter+flen, 0);
+    filterSpectrum = getSpectrum(SpectrumRRC, fb, a);
+    filter = filterSpectrum->data();
+}
 
-    for (int i = 0; i < flen; i++) {
-        filter[i] = frrc(fb, a, i, flen);
-    }
+// Filter one block of flen2 samples held in the forward FFT input with fast convolution (overlap-add algorithm).
+// Result is left in output.
+void fftfilt::process(RunMode mode, bool usb, bool getDC)
+{
+    fwdFFT->transform();
+    const cmplx *spectrum = fwdFFT->out();
+    cmplx *filtered = invFFT->in();
 
-    // normalize the output filter for unity gain
-    float scale = 0, mag;
-    for (int i = 0; i < flen; i++)
+    switch (mode)
     {
-        mag = abs(filter[i]);
-        if (mag > scale) {
-            scale = mag;
+    case RunSSB:
+        // Discard frequencies for ssb
+        if (usb)
+        {
+            multiplySpectrum(filtered, spectrum, filter, flen2);
+            std::fill(filtered + flen2 + 1, filtered + flen, cmplx{0, 0});
+        }
+        else
+        {
+            std::fill(filtered, filtered + flen2, cmplx{0, 0});
+            multiplySpectrum(filtered + flen2, spectrum + flen2, filter + flen2, flen2);
         }
+        filtered[flen2] = spectrum[flen2] * (1.0f / flen); // Nyquist bin is not filtered (only the inverse FFT normalization applies)
+        // get or reject DC component
+        filtered[0] = getDC ? spectrum[0]*filter[0] : 0;
+        break;
+    case RunDSB:
+        multiplySpectrum(filtered, spectrum, filter, flen);
+        // get or reject DC component
+        filtered[0] = getDC ? filtered[0] : 0;
+        break;
+    case RunAsym:
+        if (usb)
+        {
+            multiplySpectrum(filtered, spectrum, filter, flen2); // usb
+            multiplySpectrum(filtered + flen2, spectrum + flen2, filterOpp + flen2, flen2); // lsb is the opposite
+        }
+        else
+        {
+            multiplySpectrum(filtered, spectrum, filterOpp, flen2); // usb is the opposite
+            multiplySpectrum(filtered + flen2, spectrum + flen2, filter + flen2, flen2); // lsb
+        }
+        filtered[flen2] = spectrum[flen2] * (1.0f / flen); // Nyquist bin is not filtered (only the inverse FFT normalization applies)
+        filtered[0] = spectrum[0] * filter[0]; // always keep DC
+        break;
+    case RunFilt:
+    default:
+        multiplySpectrum(filtered, spectrum, filter, flen);
+        break;
     }
-    if (scale != 0)
+
+    invFFT->transform();
+    const cmplx *timedata = invFFT->out();
+
+    // overlap and add
+    addBlocks(output, ovlbuf, timedata, flen2);
+    std::copy(timedata + flen2, timedata + flen, ovlbuf);
+}
+
+int fftfilt::runBlock(const cmplx *in, int len, std::vector<cmplx>& out, RunMode mode, bool usb, bool getDC)
+{
+    int count = 0;
+
+    while (len > 0)
     {
-        for (int i = 0; i < flen; i++) {
-            filter[i] /= scale;
+        int n = std::min(len, flen2 - inptr);
+        std::copy(in, in + n, data + inptr);
+        inptr += n;
+        in += n;
+        len -= n;
+
+        if (inptr == flen2)
+        {
+            inptr = 0;
+            process(mode, usb, getDC);
+            out.insert(out.end(), output, output + flen2);
+            count += flen2;
         }
     }
+
+    return count;
 }
 
 // test bypass
@@ -264,17 +478,7 @@ int fftfilt::runFilt(const cmplx & in, cmplx **out)
 		return 0;
 	inptr = 0;
 
-	fft->ComplexFFT(data);
-	for (int i = 0; i < flen; i++)
-		data[i] *= filter[i];
-
-	fft->InverseComplexFFT(data);
-
-	for (int i = 0; i < flen2; i++) {
-		output[i] = ovlbuf[i] + data[i];
-		ovlbuf[i] = data[flen2 + i];
-	}
-	memset (data, 0, flen * sizeof(cmplx));
+    process(RunFilt, false, true);
 
 	*out = output;
 	return flen2;
@@ -288,36 +492,7 @@ int fftfilt::runSSB(const cmplx & in, cmplx **out, bool usb, bool getDC)
 		return 0;
 	inptr = 0;
 
-	fft->ComplexFFT(data);
-
-	// get or reject DC component
-	data[0] = getDC ? data[0]*filter[0] : 0;
-
-	// Discard frequencies for ssb
-	if (usb)
-	{
-		for (int i = 1; i < flen2; i++) {
-			data[i] *= filter[i];
-			data[flen2 + i] = 0;
-		}
-	}
-	else
-	{
-		for (int i = 1; i < flen2; i++) {
-			data[i] = 0;
-			data[flen2 + i] *= filter[flen2 + i];
-		}
-	}
-
-	// in-place FFT: freqdata overwritten with filtered timedata
-	fft->InverseComplexFFT(data);
-
-	// overlap and add
-	for (int i = 0; i < flen2; i++) {
-		output[i] = ovlbuf[i] + data[i];
-		ovlbuf[i] = data[i+flen2];
-	}
-	memset (data, 0, flen * sizeof(cmplx));
+    process(RunSSB, usb, getDC);
 
 	*out = output;
 	return flen2;
@@ -331,26 +506,7 @@ int fftfilt::runDSB(const cmplx & in, cmplx **out, bool getDC)
 		return 0;
 	inptr = 0;
 
-	fft->ComplexFFT(data);
-
-	for (int i = 0; i < flen2; i++) {
-		data[i] *= filter[i];
-		data[flen2 + i] *= filter[flen2 + i];
-	}
-
-    // get or reject DC component
-    data[0] = getDC ? data[0] : 0;
-
-	// in-place FFT: freqdata overwritten with filtered timedata
-	fft->InverseComplexFFT(data);
-
-	// overlap and add
-	for (int i = 0; i < flen2; i++) {
-		output[i] = ovlbuf[i] + data[i];
-		ovlbuf[i] = data[i+flen2];
-	}
-
-	memset (data, 0, flen * sizeof(cmplx));
+    process(RunDSB, false, getDC);
 
 	*out = output;
 	return flen2;
@@ -364,40 +520,30 @@ int fftfilt::runAsym(const cmplx & in, cmplx **out, bool usb)
         return 0;
     inptr = 0;
 
-    fft->ComplexFFT(data);
-
-    data[0] *= filter[0]; // always keep DC
+    process(RunAsym, usb, true);
 
-    if (usb)
-    {
-        for (int i = 1; i < flen2; i++)
-        {
-            data[i] *= filter[i]; // usb
-            data[flen2 + i] *= filterOpp[flen2 + i]; // lsb is the opposite
-        }
-    }
-    else
-    {
-        for (int i = 1; i < flen2; i++)
-        {
-            data[i] *= filterOpp[i]; // usb is the opposite
-            data[flen2 + i] *= filter[flen2 + i]; // lsb
-        }
-    }
+    *out = output;
+    return flen2;
+}
 
-    // in-place FFT: freqdata overwritten with filtered timedata
-    fft->InverseComplexFFT(data);
+int fftfilt::runFilt(const cmplx *in, int len, std::vector<cmplx>& out)
+{
+    return runBlock(in, len, out, RunFilt, false, true);
+}
 
-    // overlap and add
-    for (int i = 0; i < flen2; i++) {
-        output[i] = ovlbuf[i] + data[i];
-        ovlbuf[i] = data[i+flen2];
-    }
+int fftfilt::runSSB(const cmplx *in, int len, std::vector<cmplx>& out, bool usb, bool getDC)
+{
+    return runBlock(in, len, out, RunSSB, usb, getDC);
+}
 
-    memset (data, 0, flen * sizeof(cmplx));
+int fftfilt::runDSB(const cmplx *in, int len, std::vector<cmplx>& out, bool getDC)
+{
+    return runBlock(in, len, out, RunDSB, false, getDC);
+}
 
-    *out = output;
-    return flen2;
+int fftfilt::runAsym(const cmplx *in, int len, std::vector<cmplx>& out, bool usb)
+{
+    return runBlock(in, len, out, RunAsym, usb, true);
 }
 
 /* Sliding FFT from Fldigi */
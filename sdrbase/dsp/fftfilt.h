@@ -6,7 +6,10 @@
 #define	_FFTFILT_H
 
 #include <complex>
-#include "gfft.h"
+#include <vector>
+#include <memory>
+#include <cmath>
+
 #include "export.h"
 
 #undef M_PI
@@ -14,6 +17,8 @@
 
 //----------------------------------------------------------------------
 
+class FFTEngine;
+
 class SDRBASE_API fftfilt {
 enum {NONE, BLACKMAN, HAMMING, HANNING};
 
@@ -36,13 +41,33 @@ public:
 	int runDSB(const cmplx& in, cmplx **out, bool getDC = true);
 	int runAsym(const cmplx & in, cmplx **out, bool usb); //!< Asymmetrical fitering can be used for vestigial sideband
 
+    // Block input versions. Filtered samples are appended to out. Return the number of samples appended.
+    int runFilt(const cmplx *in, int len, std::vector<cmplx>& out);
+    int runSSB(const cmplx *in, int len, std::vector<cmplx>& out, bool usb, bool getDC = true);
+    int runDSB(const cmplx *in, int len, std::vector<cmplx>& out, bool getDC = true);
+    int runAsym(const cmplx *in, int len, std::vector<cmplx>& out, bool usb);
+
 protected:
+    enum RunMode
+    {
+        RunFilt,
+        RunSSB,
+        RunDSB,
+        RunAsym
+    };
+
 	int flen;
 	int flen2;
-	g_fft<float> *fft;
-	cmplx *filter;
-    cmplx *filterOpp;
-	cmplx *data;
+    FFTEngine *fwdFFT;
+    FFTEngine *invFFT;
+    unsigned int fwdFFTSequence;
+    unsigned int invFFTSequence;
+    bool ownFFT;   //!< engines were created locally because there is no FFT factory
+    std::shared_ptr<const std::vector<cmplx>> filterSpectrum;    //!< possibly shared with other filters with the same parameters
+    std::shared_ptr<const std::vector<cmplx>> filterOppSpectrum;
+	const cmplx *filter;
+    const cmplx *filterOpp;
+	cmplx *data;   //!< input of forward FFT: time samples followed by zero padding
 	cmplx *ovlbuf;
 	cmplx *output;
 	int inptr;
@@ -88,6 +113,10 @@ protected:
 
 	void init_filter();
 	void init_dsb_filter();
+    std::shared_ptr<const std::vector<cmplx>> getSpectrum(int type, float p1, float p2);
+    void computeSpectrum(int type, float p1, float p2, std::vector<cmplx>& spectrum);
+    void process(RunMode mode, bool usb, bool getDC);
+    int runBlock(const cmplx *in, int len, std::vector<cmplx>& out, RunMode mode, bool usb, bool getDC);
 };
 
 
@@ -49,8 +49,8 @@ public:
 	virtual ~FileRecord();
 
     quint64 getByteCount() const { return m_byteCount; }
-    void setMsShift(int shift) { m_msShift = shift; }
-    const QString& getCurrentFileName() { return m_curentFileName; }
+    virtual void setMsShift(int shift) { m_msShift = shift; }
+    virtual const QString& getCurrentFileName() { return m_curentFileName; }
 
     void genUniqueFileName(uint deviceUID, int istream = -1);
 
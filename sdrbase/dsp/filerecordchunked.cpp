@@ -0,0 +1,565 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+
+#include <boost/crc.hpp>
+#include <boost/cstdint.hpp>
+
+#include <QDebug>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+
+#include "dsp/dspcommands.h"
+#include "dsp/filerecord.h"
+#include "dsp/filerecordchunkedreader.h"
+#include "util/message.h"
+
+#include "filerecordchunked.h"
+
+FileRecordChunked::FileRecordChunked() :
+    FileRecordInterface(),
+    m_fileBase("test"),
+    m_sampleRate(0),
+    m_centerFrequency(0),
+    m_notifSampleRate(0),
+    m_notifCenterFrequency(0),
+    m_recordOn(false),
+    m_chunkContinuous(false),
+    m_byteCount(0),
+    m_msShift(0),
+    m_chunkSamples(m_defaultChunkSamples),
+    m_chunkTimestampUs(0)
+{
+    setObjectName("FileRecordChunked");
+    m_chunkBuffer.reserve(m_chunkSamples);
+}
+
+FileRecordChunked::FileRecordChunked(const QString& fileBase) :
+    FileRecordInterface(),
+    m_fileBase(fileBase),
+    m_sampleRate(0),
+    m_centerFrequency(0),
+    m_notifSampleRate(0),
+    m_notifCenterFrequency(0),
+    m_recordOn(false),
+    m_chunkContinuous(false),
+    m_byteCount(0),
+    m_msShift(0),
+    m_chunkSamples(m_defaultChunkSamples),
+    m_chunkTimestampUs(0)
+{
+    setObjectName("FileRecordChunked");
+    m_chunkBuffer.reserve(m_chunkSamples);
+}
+
+FileRecordChunked::~FileRecordChunked()
+{
+    stopRecording();
+}
+
+void FileRecordChunked::setFileName(const QString& fileBase)
+{
+    if (!m_sampleFile.is_open()) {
+        m_fileBase = fileBase;
+    }
+}
+
+void FileRecordChunked::setChunkSamples(quint32 chunkSamples)
+{
+    if (!m_sampleFile.is_open() && (chunkSamples > 0))
+    {
+        m_chunkSamples = chunkSamples;
+        m_chunkBuffer.reserve(m_chunkSamples);
+    }
+}
+
+void FileRecordChunked::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly)
+{
+    (void) positiveOnly;
+
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        if ((m_notifSampleRate != m_sampleRate) || (m_notifCenterFrequency != m_centerFrequency))
+        {
+            flushChunk(); // new parameters start a new chunk in the same file
+            m_sampleRate = m_notifSampleRate;
+            m_centerFrequency = m_notifCenterFrequency;
+        }
+    }
+
+    if (!m_recordOn) {
+        return;
+    }
+
+    SampleVector::const_iterator it = begin;
+
+    while (it < end)
+    {
+        if (m_chunkBuffer.empty() && !m_chunkContinuous) // first chunk after start or resume
+        {
+            m_chunkTimestampUs = nowUs() + m_msShift * 1000LL;
+            m_chunkContinuous = true;
+        }
+
+        int nbSamples = std::min((int) (end - it), (int) (m_chunkSamples - m_chunkBuffer.size()));
+        m_chunkBuffer.insert(m_chunkBuffer.end(), it, it + nbSamples);
+        it += nbSamples;
+
+        if (m_chunkBuffer.size() >= m_chunkSamples) {
+            flushChunk();
+        }
+    }
+
+    m_byteCount += (end - begin) * sizeof(Sample);
+}
+
+void FileRecordChunked::start()
+{
+}
+
+void FileRecordChunked::stop()
+{
+    stopRecording();
+}
+
+void FileRecordChunked::startRecording()
+{
+    if (m_recordOn) {
+        return;
+    }
+
+    if (!m_sampleFile.is_open()) {
+        openFile();
+    } else {
+        qDebug() << "FileRecordChunked::startRecording: resume";
+    }
+
+    if (m_sampleFile.is_open())
+    {
+        m_recordOn = true;
+        m_chunkContinuous = false; // new timestamp
+    }
+}
+
+void FileRecordChunked::suspendRecording()
+{
+    if (m_recordOn)
+    {
+        qDebug() << "FileRecordChunked::suspendRecording";
+        flushChunk();
+        m_recordOn = false;
+    }
+}
+
+void FileRecordChunked::stopRecording()
+{
+    if (m_sampleFile.is_open())
+    {
+        qDebug() << "FileRecordChunked::stopRecording";
+        flushChunk();
+        closeFile();
+    }
+
+    m_recordOn = false;
+}
+
+bool FileRecordChunked::handleMessage(const Message& message)
+{
+    if (DSPSignalNotification::match(message))
+    {
+        DSPSignalNotification& notif = (DSPSignalNotification&) message;
+        QMutexLocker mutexLocker(&m_mutex);
+        m_notifSampleRate = notif.getSampleRate();
+        m_notifCenterFrequency = notif.getCenterFrequency();
+        qDebug() << "FileRecordChunked::handleMessage: DSPSignalNotification: m_inputSampleRate: " << m_notifSampleRate
+                << " m_centerFrequency: " << m_notifCenterFrequency;
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void FileRecordChunked::openFile()
+{
+    qDebug() << "FileRecordChunked::openFile";
+    m_curentFileName = QString("%1.%2.sdriqc").arg(m_fileBase).arg(QDateTime::currentDateTimeUtc().toString("yyyy-MM-ddTHH_mm_ss_zzz"));
+    m_sampleFile.open(m_curentFileName.toStdString().c_str(), std::ios::binary);
+
+    if (!m_sampleFile.is_open())
+    {
+        qWarning("FileRecordChunked::openFile: cannot open %s", qPrintable(m_curentFileName));
+        return;
+    }
+
+    FileHeader header;
+    initFileHeader(header, SDR_RX_SAMP_SZ, m_chunkSamples);
+    writeFileHeader(m_sampleFile, header);
+    m_index.clear();
+    m_chunkBuffer.clear();
+    m_byteCount = 0;
+}
+
+void FileRecordChunked::closeFile()
+{
+    writeIndex(m_sampleFile, m_index);
+    m_sampleFile.close();
+    qDebug("FileRecordChunked::closeFile: %s: %lu chunks", qPrintable(m_curentFileName), m_index.size());
+    m_index.clear();
+}
+
+void FileRecordChunked::flushChunk()
+{
+    if (m_chunkBuffer.empty() || !m_sampleFile.is_open()) {
+        return;
+    }
+
+    ChunkHeader header;
+    header.sampleCount = m_chunkBuffer.size();
+    header.timestampUs = m_chunkTimestampUs;
+    header.centerFrequency = m_centerFrequency;
+    header.sampleRate = m_sampleRate;
+    writeChunk(
+        m_sampleFile,
+        header,
+        reinterpret_cast<const char*>(m_chunkBuffer.data()),
+        m_chunkBuffer.size() * sizeof(Sample),
+        m_index
+    );
+
+    if (m_sampleRate > 0) { // next chunk follows this one
+        m_chunkTimestampUs += (header.sampleCount * 1000000ULL) / m_sampleRate;
+    }
+
+    m_chunkBuffer.clear();
+}
+
+quint64 FileRecordChunked::nowUs()
+{
+    return QDateTime::currentMSecsSinceEpoch() * 1000ULL;
+}
+
+bool FileRecordChunked::isChunkedFile(std::ifstream& sampleFile)
+{
+    std::streampos pos = sampleFile.tellg();
+    FileHeader header;
+    sampleFile.seekg(0, std::ios::beg);
+    bool ok = readFileHeader(sampleFile, header);
+    sampleFile.clear();
+    sampleFile.seekg(pos);
+    return ok;
+}
+
+void FileRecordChunked::initFileHeader(FileHeader& header, quint32 sampleSize, quint32 chunkSamples)
+{
+    std::memset(&header, 0, sizeof(FileHeader));
+    std::strncpy(header.magic, "SDRIQCK", sizeof(header.magic));
+    header.version = m_version;
+    header.sampleSize = sampleSize;
+    header.chunkSamples = chunkSamples;
+}
+
+bool FileRecordChunked::readFileHeader(std::ifstream& sampleFile, FileHeader& header)
+{
+    sampleFile.read((char *) &header, sizeof(FileHeader));
+
+    if (sampleFile.gcount() != sizeof(FileHeader)) {
+        return false;
+    }
+
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&header, sizeof(FileHeader) - 4);
+    return (std::strncmp(header.magic, "SDRIQCK", sizeof(header.magic)) == 0) && (header.crc32 == crc32.checksum());
+}
+
+void FileRecordChunked::writeFileHeader(std::ofstream& sampleFile, FileHeader& header)
+{
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&header, sizeof(FileHeader) - 4);
+    header.crc32 = crc32.checksum();
+    sampleFile.write((const char *) &header, sizeof(FileHeader));
+}
+
+bool FileRecordChunked::readChunkHeader(std::ifstream& sampleFile, ChunkHeader& header)
+{
+    sampleFile.read((char *) &header, sizeof(ChunkHeader));
+
+    if (sampleFile.gcount() != sizeof(ChunkHeader)) {
+        return false;
+    }
+
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&header, sizeof(ChunkHeader) - 4);
+    return (header.magic == m_chunkMagic) && (header.crc32 == crc32.checksum());
+}
+
+void FileRecordChunked::writeChunk(
+    std::ofstream& sampleFile,
+    ChunkHeader& header,
+    const char *data,
+    std::size_t dataBytes,
+    std::vector<IndexEntry>& index)
+{
+    IndexEntry entry;
+    entry.timestampUs = header.timestampUs;
+    entry.offset = sampleFile.tellp();
+    entry.sampleCount = header.sampleCount;
+    entry.sampleRate = header.sampleRate;
+
+    boost::crc_32_type dataCrc32;
+    dataCrc32.process_bytes(data, dataBytes);
+    header.magic = m_chunkMagic;
+    header.dataCrc32 = dataCrc32.checksum();
+    header.filler = 0;
+    boost::crc_32_type crc32;
+    crc32.process_bytes(&header, sizeof(ChunkHeader) - 4);
+    header.crc32 = crc32.checksum();
+
+    sampleFile.write((const char *) &header, sizeof(ChunkHeader));
+    sampleFile.write(data, dataBytes);
+    index.push_back(entry);
+}
+
+void FileRecordChunked::writeIndex(std::ofstream& sampleFile, const std::vector<IndexEntry>& index)
+{
+    IndexTrailer trailer;
+    trailer.indexOffset = sampleFile.tellp();
+    trailer.nbEntries = index.size();
+    boost::crc_32_type crc32;
+
+    if (index.size() > 0)
+    {
+        crc32.process_bytes(index.data(), index.size() * sizeof(IndexEntry));
+        sampleFile.write((const char *) index.data(), index.size() * sizeof(IndexEntry));
+    }
+
+    trailer.crc32 = crc32.checksum();
+    std::memset(trailer.magic, 0, sizeof(trailer.magic));
+    std::strncpy(trailer.magic, "SDRIQIX", sizeof(trailer.magic));
+    sampleFile.write((const char *) &trailer, sizeof(IndexTrailer));
+}
+
+bool FileRecordChunked::convertFromSdrIQ(const QString& sdriqFileName, const QString& chunkedFileName, QString& errorMessage,
+    const ConversionProgress& progress)
+{
+    std::ifstream inFile(sdriqFileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
+
+    if (!inFile.is_open())
+    {
+        errorMessage = QString("Cannot open %1").arg(sdriqFileName);
+        return false;
+    }
+
+    quint64 fileSize = inFile.tellg();
+    inFile.seekg(0, std::ios::beg);
+    FileRecord::Header sdriqHeader;
+
+    if ((fileSize < sizeof(FileRecord::Header)) || !FileRecord::readHeader(inFile, sdriqHeader))
+    {
+        errorMessage = QString("Invalid .sdriq header in %1").arg(sdriqFileName);
+        return false;
+    }
+
+    if (((sdriqHeader.sampleSize != 16) && (sdriqHeader.sampleSize != 24)) || (sdriqHeader.sampleRate == 0))
+    {
+        errorMessage = QString("Unsupported sample size or rate in %1").arg(sdriqFileName);
+        return false;
+    }
+
+    if (QFileInfo::exists(chunkedFileName))
+    {
+        errorMessage = QString("%1 already exists").arg(chunkedFileName);
+        return false;
+    }
+
+    std::ofstream outFile(chunkedFileName.toStdString().c_str(), std::ios::binary);
+
+    if (!outFile.is_open())
+    {
+        errorMessage = QString("Cannot create %1").arg(chunkedFileName);
+        return false;
+    }
+
+    int sampleBytes = getSampleBytes(sdriqHeader.sampleSize);
+    std::vector<char> data(m_defaultChunkSamples * sampleBytes);
+    std::vector<IndexEntry> index;
+    quint64 nbSamples = 0;
+    FileHeader fileHeader;
+    initFileHeader(fileHeader, sdriqHeader.sampleSize, m_defaultChunkSamples);
+    writeFileHeader(outFile, fileHeader);
+
+    while (true)
+    {
+        inFile.read(data.data(), data.size());
+        int chunkSamples = inFile.gcount() / sampleBytes;
+
+        if (chunkSamples == 0) {
+            break;
+        }
+
+        ChunkHeader chunkHeader;
+        chunkHeader.sampleCount = chunkSamples;
+        chunkHeader.timestampUs = sdriqHeader.startTimeStamp * 1000000ULL + (nbSamples * 1000000ULL) / sdriqHeader.sampleRate;
+        chunkHeader.centerFrequency = sdriqHeader.centerFrequency;
+        chunkHeader.sampleRate = sdriqHeader.sampleRate;
+        writeChunk(outFile, chunkHeader, data.data(), chunkSamples * sampleBytes, index);
+        nbSamples += chunkSamples;
+
+        if (progress && !progress((int) ((100 * (sizeof(FileRecord::Header) + nbSamples * sampleBytes)) / fileSize)))
+        {
+            outFile.close();
+            QFile::remove(chunkedFileName);
+            errorMessage = "Cancelled";
+            return false;
+        }
+    }
+
+    writeIndex(outFile, index);
+    qDebug("FileRecordChunked::convertFromSdrIQ: %s -> %s: %llu samples in %lu chunks",
+        qPrintable(sdriqFileName), qPrintable(chunkedFileName), nbSamples, index.size());
+
+    return outFile.good();
+}
+
+bool FileRecordChunked::convertToSdrIQ(const QString& chunkedFileName, const QString& sdriqFileName, QStringList& sdriqFileNames, QString& errorMessage,
+    const ConversionProgress& progress)
+{
+    std::ifstream inFile(chunkedFileName.toStdString().c_str(), std::ios::binary);
+    FileRecordChunkedReader reader;
+    sdriqFileNames.clear();
+
+    if (!reader.open(&inFile))
+    {
+        errorMessage = QString("Invalid chunked record %1").arg(chunkedFileName);
+        return false;
+    }
+
+    // segments of constant sample rate and center frequency
+    const std::vector<IndexEntry>& index = reader.getIndex();
+    std::vector<int> segmentStarts;
+    quint64 totalSamples = 0;
+    ChunkHeader chunkHeader;
+    quint32 sampleRate = 0;
+    quint64 centerFrequency = 0;
+
+    for (std::size_t i = 0; i < index.size(); i++)
+    {
+        inFile.clear();
+        inFile.seekg(index[i].offset, std::ios::beg);
+
+        if (!readChunkHeader(inFile, chunkHeader)) {
+            chunkHeader.centerFrequency = centerFrequency; // keep on with the current segment
+        }
+
+        if ((i == 0) || (index[i].sampleRate != sampleRate) || (chunkHeader.centerFrequency != centerFrequency)) {
+            segmentStarts.push_back(i);
+        }
+
+        sampleRate = index[i].sampleRate;
+        centerFrequency = chunkHeader.centerFrequency;
+        totalSamples += index[i].sampleCount;
+    }
+
+    if (segmentStarts.size() == 0)
+    {
+        errorMessage = QString("No data in %1").arg(chunkedFileName);
+        return false;
+    }
+
+    QFileInfo fileInfo(sdriqFileName);
+    QString fileBase = fileInfo.path() + "/" + fileInfo.completeBaseName();
+    int sampleBytes = reader.getSampleBytes();
+    std::vector<quint8> data(m_defaultChunkSamples * sampleBytes);
+    segmentStarts.push_back(index.size());
+    QStringList outFileNames;
+
+    for (std::size_t segment = 0; segment < segmentStarts.size() - 1; segment++)
+    {
+        outFileNames.append(segmentStarts.size() == 2 ? sdriqFileName : QString("%1_%2.sdriq").arg(fileBase).arg(segment + 1));
+
+        if (QFileInfo::exists(outFileNames.back()))
+        {
+            errorMessage = QString("%1 already exists").arg(outFileNames.back());
+            return false;
+        }
+    }
+
+    quint64 samplesDone = 0;
+
+    for (std::size_t segment = 0; segment < segmentStarts.size() - 1; segment++)
+    {
+        const QString& outFileName = outFileNames[segment];
+        std::ofstream outFile(outFileName.toStdString().c_str(), std::ios::binary);
+
+        if (!outFile.is_open())
+        {
+            errorMessage = QString("Cannot create %1").arg(outFileName);
+            return false;
+        }
+
+        reader.seekChunk(segmentStarts[segment]);
+        reader.parametersChanged();
+
+        FileRecord::Header sdriqHeader;
+        sdriqHeader.sampleRate = reader.getSampleRate();
+        sdriqHeader.centerFrequency = reader.getCenterFrequency();
+        sdriqHeader.startTimeStamp = reader.getTimestampUs() / 1000000ULL;
+        sdriqHeader.sampleSize = reader.getSampleSize();
+        sdriqHeader.filler = 0;
+        FileRecord::writeHeader(outFile, sdriqHeader);
+
+        while (!reader.atEnd())
+        {
+            int nbSamples = reader.read(data.data(), m_defaultChunkSamples);
+            outFile.write((const char *) data.data(), nbSamples * sampleBytes);
+            samplesDone += nbSamples;
+
+            if (progress && !progress(totalSamples == 0 ? 100 : (int) ((100 * samplesDone) / totalSamples)))
+            {
+                outFile.close();
+                sdriqFileNames.append(outFileName);
+
+                for (const QString& fileName : sdriqFileNames) {
+                    QFile::remove(fileName);
+                }
+
+                sdriqFileNames.clear();
+                errorMessage = "Cancelled";
+                return false;
+            }
+
+            if (reader.parametersChanged()) {
+                break;
+            }
+        }
+
+        sdriqFileNames.append(outFileName);
+    }
+
+    if (reader.getNbCorruptedChunks() > 0) {
+        errorMessage = QString("%1 corrupted chunks").arg(reader.getNbCorruptedChunks());
+    }
+
+    qDebug("FileRecordChunked::convertToSdrIQ: %s -> %d files", qPrintable(chunkedFileName), sdriqFileNames.size());
+    return true;
+}
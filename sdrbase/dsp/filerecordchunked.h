@@ -0,0 +1,163 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FILERECORDCHUNKED_H
+#define INCLUDE_FILERECORDCHUNKED_H
+
+#include <fstream>
+#include <functional>
+#include <vector>
+
+#include <QString>
+#include <QStringList>
+#include <QMutex>
+
+#include "dsp/dsptypes.h"
+#include "dsp/filerecordinterface.h"
+#include "export.h"
+
+class Message;
+
+/**
+ * Chunked I/Q record (.sdriqc)
+ *
+ * The file starts with a FileHeader followed by chunks of at most FileHeader::chunkSamples samples.
+ * Each chunk has its own ChunkHeader with the timestamp of its first sample, center frequency and
+ * sample rate so that frequency or sample rate changes and gaps in time can be recorded in the same
+ * file. A chunk is closed when it is full, when the stream parameters change or when recording is
+ * suspended. When recording stops an index of all chunks is appended to the file followed by an
+ * IndexTrailer that is the last item of the file. If the trailer is missing or invalid (recording
+ * interrupted) the index can be rebuilt by scanning the chunk headers (see FileRecordChunkedReader).
+ *
+ * Samples are stored as in .sdriq files: I and Q as 16 bit integers for 16 bit samples and
+ * as 32 bit integers for 24 bit samples.
+ */
+class SDRBASE_API FileRecordChunked : public FileRecordInterface {
+public:
+
+#pragma pack(push, 1)
+    struct FileHeader
+    {
+        char    magic[8];       //!< "SDRIQCK" null terminated
+        quint32 version;        //!< format version
+        quint32 sampleSize;     //!< 16 or 24 bits
+        quint32 chunkSamples;   //!< maximum number of samples per chunk
+        quint32 filler;
+        quint32 filler2;
+        quint32 crc32;          //!< CRC32 of the 28 bytes above
+    };
+
+    struct ChunkHeader
+    {
+        quint32 magic;           //!< m_chunkMagic
+        quint32 sampleCount;     //!< number of samples in the chunk
+        quint64 timestampUs;     //!< Unix timestamp of the first sample in microseconds
+        quint64 centerFrequency; //!< center frequency in Hz
+        quint32 sampleRate;      //!< sample rate in S/s
+        quint32 dataCrc32;       //!< CRC32 of the chunk samples
+        quint32 filler;
+        quint32 crc32;           //!< CRC32 of the 36 bytes above
+    };
+
+    struct IndexEntry
+    {
+        quint64 timestampUs;     //!< Unix timestamp of the first sample of the chunk in microseconds
+        quint64 offset;          //!< file offset of the chunk header
+        quint32 sampleCount;     //!< number of samples in the chunk
+        quint32 sampleRate;      //!< sample rate of the chunk in S/s
+    };
+
+    struct IndexTrailer
+    {
+        quint64 indexOffset;     //!< file offset of the first index entry
+        quint32 nbEntries;       //!< number of index entries
+        quint32 crc32;           //!< CRC32 of the index entries
+        char    magic[8];        //!< "SDRIQIX" null terminated
+    };
+#pragma pack(pop)
+
+    static const quint32 m_version = 1;
+    static const quint32 m_chunkMagic = 0x4b4e4843; //!< "CHNK" little endian
+    static const quint32 m_defaultChunkSamples = 1<<18;
+
+    FileRecordChunked();
+    FileRecordChunked(const QString& fileBase);
+    virtual ~FileRecordChunked();
+
+    quint64 getByteCount() const { return m_byteCount; }
+    virtual void setMsShift(int shift) { m_msShift = shift; }
+    virtual const QString& getCurrentFileName() { return m_curentFileName; }
+    void setChunkSamples(quint32 chunkSamples);
+
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool positiveOnly);
+    virtual void start();
+    virtual void stop();
+    virtual bool handleMessage(const Message& message);
+
+    virtual void setFileName(const QString& fileBase);
+    virtual void startRecording();  //!< opens a new file or resumes a suspended recording
+    virtual void stopRecording();   //!< writes the index and closes the file
+    virtual bool isRecording() const { return m_recordOn; }
+    void suspendRecording();        //!< closes the current chunk but keeps the file open so that the next chunk is recorded after a gap
+    bool isSuspended() const { return !m_recordOn && m_sampleFile.is_open(); }
+
+    static bool isChunkedFile(std::ifstream& sampleFile); //!< checks the file header magic. Restores the stream position.
+    static void initFileHeader(FileHeader& header, quint32 sampleSize, quint32 chunkSamples);
+    static bool readFileHeader(std::ifstream& sampleFile, FileHeader& header); //!< returns true if magic and CRC checksum are correct
+    static void writeFileHeader(std::ofstream& sampleFile, FileHeader& header);
+    static bool readChunkHeader(std::ifstream& sampleFile, ChunkHeader& header); //!< returns true if magic and CRC checksum are correct
+    /** Writes a chunk header with its samples and appends its entry to the index */
+    static void writeChunk(std::ofstream& sampleFile, ChunkHeader& header, const char *data, std::size_t dataBytes, std::vector<IndexEntry>& index);
+    static void writeIndex(std::ofstream& sampleFile, const std::vector<IndexEntry>& index);
+    static int getSampleBytes(quint32 sampleSize) { return sampleSize == 24 ? 8 : 4; } //!< bytes per I/Q sample in file
+
+    /** Called with the conversion progress in percent. Returns false to cancel the conversion */
+    typedef std::function<bool(int)> ConversionProgress;
+    /** Converts a .sdriq file to a single segment chunked file. Fails if the chunked file exists */
+    static bool convertFromSdrIQ(const QString& sdriqFileName, const QString& chunkedFileName, QString& errorMessage,
+        const ConversionProgress& progress = ConversionProgress());
+    /** Converts a chunked file to .sdriq files. A new file is produced each time the center frequency or sample
+     *  rate changes. File names get a _<n> suffix if there is more than one. Gaps are not represented.
+     *  Fails if any of the .sdriq files exists */
+    static bool convertToSdrIQ(const QString& chunkedFileName, const QString& sdriqFileName, QStringList& sdriqFileNames, QString& errorMessage,
+        const ConversionProgress& progress = ConversionProgress());
+
+private:
+    QString m_fileBase;
+    quint32 m_sampleRate;       //!< sample rate of the current chunk
+    quint64 m_centerFrequency;  //!< center frequency of the current chunk
+    QMutex m_mutex;
+    quint32 m_notifSampleRate;  //!< last notified sample rate. Applied in the feed thread.
+    quint64 m_notifCenterFrequency;
+    bool m_recordOn;
+    bool m_chunkContinuous;  //!< next chunk timestamp follows the previous chunk (no gap)
+    std::ofstream m_sampleFile;
+    QString m_curentFileName;
+    quint64 m_byteCount;
+    int m_msShift;
+    quint32 m_chunkSamples;
+    SampleVector m_chunkBuffer;
+    quint64 m_chunkTimestampUs;
+    std::vector<IndexEntry> m_index;
+
+    void openFile();
+    void closeFile();
+    void flushChunk();
+    static quint64 nowUs();
+};
+
+#endif // INCLUDE_FILERECORDCHUNKED_H
@@ -0,0 +1,348 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstring>
+
+#include <boost/crc.hpp>
+#include <boost/cstdint.hpp>
+
+#include <QDebug>
+
+#include "filerecordchunkedreader.h"
+
+FileRecordChunkedReader::FileRecordChunkedReader() :
+    m_sampleFile(nullptr),
+    m_indexed(false),
+    m_nbSamples(0),
+    m_nbGaps(0),
+    m_nbCorruptedChunks(0),
+    m_chunkIndex(-1),
+    m_chunkPosition(0),
+    m_parametersChanged(false)
+{
+    std::memset(&m_fileHeader, 0, sizeof(FileRecordChunked::FileHeader));
+    std::memset(&m_chunkHeader, 0, sizeof(FileRecordChunked::ChunkHeader));
+}
+
+FileRecordChunkedReader::~FileRecordChunkedReader()
+{}
+
+bool FileRecordChunkedReader::open(std::ifstream *sampleFile)
+{
+    close();
+
+    if (!sampleFile || !sampleFile->is_open()) {
+        return false;
+    }
+
+    sampleFile->clear();
+    sampleFile->seekg(0, std::ios::end);
+    quint64 fileSize = sampleFile->tellg();
+    sampleFile->seekg(0, std::ios::beg);
+
+    if (!FileRecordChunked::readFileHeader(*sampleFile, m_fileHeader)
+    || ((m_fileHeader.sampleSize != 16) && (m_fileHeader.sampleSize != 24))
+    || (m_fileHeader.chunkSamples == 0) || (m_fileHeader.chunkSamples > (1<<24)))
+    {
+        qDebug("FileRecordChunkedReader::open: not a valid chunked record");
+        sampleFile->clear();
+        return false;
+    }
+
+    m_sampleFile = sampleFile;
+
+    if (!readIndex(fileSize)) {
+        rebuildIndex(fileSize);
+    }
+
+    indexStats();
+    qDebug("FileRecordChunkedReader::open: %lu chunks (%s) %llu samples %d gaps",
+        m_index.size(), m_indexed ? "indexed" : "rebuilt", m_nbSamples, m_nbGaps);
+    loadChunk(0, 0);
+    m_parametersChanged = false;
+
+    return true;
+}
+
+void FileRecordChunkedReader::close()
+{
+    m_sampleFile = nullptr;
+    m_index.clear();
+    m_indexed = false;
+    m_nbSamples = 0;
+    m_nbGaps = 0;
+    m_nbCorruptedChunks = 0;
+    m_chunkIndex = -1;
+    m_chunkPosition = 0;
+    m_chunkData.clear();
+    m_parametersChanged = false;
+    std::memset(&m_chunkHeader, 0, sizeof(FileRecordChunked::ChunkHeader));
+}
+
+bool FileRecordChunkedReader::readIndex(quint64 fileSize)
+{
+    FileRecordChunked::IndexTrailer trailer;
+
+    if (fileSize < sizeof(FileRecordChunked::FileHeader) + sizeof(FileRecordChunked::IndexTrailer)) {
+        return false;
+    }
+
+    m_sampleFile->clear();
+    m_sampleFile->seekg(fileSize - sizeof(FileRecordChunked::IndexTrailer), std::ios::beg);
+    m_sampleFile->read((char *) &trailer, sizeof(FileRecordChunked::IndexTrailer));
+
+    if ((m_sampleFile->gcount() != sizeof(FileRecordChunked::IndexTrailer))
+    || (std::strncmp(trailer.magic, "SDRIQIX", sizeof(trailer.magic)) != 0)
+    || (trailer.indexOffset + trailer.nbEntries * sizeof(FileRecordChunked::IndexEntry) + sizeof(FileRecordChunked::IndexTrailer) != fileSize))
+    {
+        qDebug("FileRecordChunkedReader::readIndex: no index trailer");
+        return false;
+    }
+
+    m_index.resize(trailer.nbEntries);
+    m_sampleFile->seekg(trailer.indexOffset, std::ios::beg);
+    m_sampleFile->read((char *) m_index.data(), trailer.nbEntries * sizeof(FileRecordChunked::IndexEntry));
+    boost::crc_32_type crc32;
+    crc32.process_bytes(m_index.data(), trailer.nbEntries * sizeof(FileRecordChunked::IndexEntry));
+
+    if (crc32.checksum() != trailer.crc32)
+    {
+        qWarning("FileRecordChunkedReader::readIndex: bad index CRC32");
+        m_index.clear();
+        return false;
+    }
+
+    for (std::size_t i = 0; i < m_index.size(); i++)
+    {
+        if ((m_index[i].offset < sizeof(FileRecordChunked::FileHeader))
+        || (m_index[i].offset + sizeof(FileRecordChunked::ChunkHeader) + m_index[i].sampleCount * getSampleBytes() > trailer.indexOffset))
+        {
+            qWarning("FileRecordChunkedReader::readIndex: inconsistent index entry %lu", i);
+            m_index.clear();
+            return false;
+        }
+    }
+
+    m_indexed = true;
+    return true;
+}
+
+void FileRecordChunkedReader::rebuildIndex(quint64 fileSize)
+{
+    quint64 offset = sizeof(FileRecordChunked::FileHeader);
+    FileRecordChunked::ChunkHeader header;
+    m_index.clear();
+    m_indexed = false;
+
+    while (offset + sizeof(FileRecordChunked::ChunkHeader) <= fileSize)
+    {
+        m_sampleFile->clear();
+        m_sampleFile->seekg(offset, std::ios::beg);
+
+        if (!FileRecordChunked::readChunkHeader(*m_sampleFile, header)) {
+            break;
+        }
+
+        quint64 chunkSize = sizeof(FileRecordChunked::ChunkHeader) + header.sampleCount * (quint64) getSampleBytes();
+
+        if ((header.sampleCount == 0) || (offset + chunkSize > fileSize)) { // truncated chunk at end of file
+            break;
+        }
+
+        FileRecordChunked::IndexEntry entry;
+        entry.timestampUs = header.timestampUs;
+        entry.offset = offset;
+        entry.sampleCount = header.sampleCount;
+        entry.sampleRate = header.sampleRate;
+        m_index.push_back(entry);
+        offset += chunkSize;
+    }
+
+    qDebug("FileRecordChunkedReader::rebuildIndex: %lu chunks", m_index.size());
+}
+
+void FileRecordChunkedReader::indexStats()
+{
+    m_nbSamples = 0;
+    m_nbGaps = 0;
+
+    for (std::size_t i = 0; i < m_index.size(); i++)
+    {
+        m_nbSamples += m_index[i].sampleCount;
+
+        if ((i > 0) && (m_index[i-1].sampleRate > 0))
+        {
+            quint64 expectedUs = m_index[i-1].timestampUs + (m_index[i-1].sampleCount * 1000000ULL) / m_index[i-1].sampleRate;
+
+            if (m_index[i].timestampUs > expectedUs + 1000) { // more than 1ms
+                m_nbGaps++;
+            }
+        }
+    }
+}
+
+quint64 FileRecordChunkedReader::getStartTimestampUs() const
+{
+    return m_index.size() == 0 ? 0 : m_index.front().timestampUs;
+}
+
+quint64 FileRecordChunkedReader::getEndTimestampUs() const
+{
+    if (m_index.size() == 0) {
+        return 0;
+    }
+
+    const FileRecordChunked::IndexEntry& last = m_index.back();
+    return last.timestampUs + (last.sampleRate == 0 ? 0 : (last.sampleCount * 1000000ULL) / last.sampleRate);
+}
+
+quint64 FileRecordChunkedReader::getTimestampUs() const
+{
+    if ((m_chunkIndex < 0) || (m_chunkHeader.sampleRate == 0)) {
+        return m_chunkHeader.timestampUs;
+    }
+
+    return m_chunkHeader.timestampUs + (m_chunkPosition * 1000000ULL) / m_chunkHeader.sampleRate;
+}
+
+bool FileRecordChunkedReader::loadChunk(int chunkIndex, quint32 position)
+{
+    if (!m_sampleFile || (chunkIndex < 0) || (chunkIndex >= (int) m_index.size()))
+    {
+        m_chunkIndex = m_index.size();
+        m_chunkPosition = 0;
+        return false;
+    }
+
+    const FileRecordChunked::IndexEntry& entry = m_index[chunkIndex];
+    bool hadChunk = m_chunkIndex >= 0;
+    quint32 previousSampleRate = m_chunkHeader.sampleRate;
+    quint64 previousCenterFrequency = m_chunkHeader.centerFrequency;
+    std::size_t dataBytes = entry.sampleCount * getSampleBytes();
+
+    FileRecordChunked::ChunkHeader header;
+
+    m_sampleFile->clear();
+    m_sampleFile->seekg(entry.offset, std::ios::beg);
+    m_chunkData.resize(dataBytes);
+
+    if (FileRecordChunked::readChunkHeader(*m_sampleFile, header) && (header.sampleCount == entry.sampleCount))
+    {
+        m_chunkHeader = header;
+        m_sampleFile->read((char *) m_chunkData.data(), dataBytes);
+        std::size_t nbRead = m_sampleFile->gcount();
+        boost::crc_32_type crc32;
+        crc32.process_bytes(m_chunkData.data(), nbRead);
+
+        if ((nbRead != dataBytes) || (crc32.checksum() != m_chunkHeader.dataCrc32))
+        {
+            qWarning("FileRecordChunkedReader::loadChunk: chunk %d: bad data CRC32", chunkIndex);
+            std::fill(m_chunkData.begin() + nbRead, m_chunkData.end(), 0);
+            m_nbCorruptedChunks++;
+        }
+    }
+    else // keep timing from index and play silence
+    {
+        qWarning("FileRecordChunkedReader::loadChunk: chunk %d: bad header", chunkIndex);
+        m_chunkHeader.sampleCount = entry.sampleCount;
+        m_chunkHeader.timestampUs = entry.timestampUs;
+        m_chunkHeader.sampleRate = entry.sampleRate;
+        m_chunkHeader.centerFrequency = previousCenterFrequency;
+        std::fill(m_chunkData.begin(), m_chunkData.end(), 0);
+        m_nbCorruptedChunks++;
+    }
+
+    if (hadChunk
+    && ((m_chunkHeader.sampleRate != previousSampleRate) || (m_chunkHeader.centerFrequency != previousCenterFrequency))) {
+        m_parametersChanged = true;
+    }
+
+    m_chunkIndex = chunkIndex;
+    m_chunkPosition = std::min(position, m_chunkHeader.sampleCount);
+    return true;
+}
+
+bool FileRecordChunkedReader::seekTimestamp(quint64 timestampUs)
+{
+    if (m_index.size() == 0) {
+        return false;
+    }
+
+    std::vector<FileRecordChunked::IndexEntry>::const_iterator it = std::upper_bound(
+        m_index.begin(),
+        m_index.end(),
+        timestampUs,
+        [](quint64 ts, const FileRecordChunked::IndexEntry& entry) { return ts < entry.timestampUs; }
+    );
+
+    int chunkIndex = (it - m_index.begin()) - 1;
+
+    if (chunkIndex < 0) {
+        return loadChunk(0, 0);
+    }
+
+    const FileRecordChunked::IndexEntry& entry = m_index[chunkIndex];
+    quint64 position = ((timestampUs - entry.timestampUs) * entry.sampleRate) / 1000000ULL;
+
+    if (position >= entry.sampleCount) { // in a gap after this chunk
+        return loadChunk(chunkIndex + 1, 0);
+    } else {
+        return loadChunk(chunkIndex, position);
+    }
+}
+
+int FileRecordChunkedReader::read(quint8 *buf, int nbSamples)
+{
+    int sampleBytes = getSampleBytes();
+    int nbRead = 0;
+
+    while ((nbRead < nbSamples) && (m_chunkIndex >= 0) && (m_chunkIndex < (int) m_index.size()))
+    {
+        if (m_chunkPosition >= m_chunkHeader.sampleCount)
+        {
+            loadChunk(m_chunkIndex + 1, 0);
+
+            if (m_parametersChanged) { // let the caller apply the new parameters first
+                break;
+            }
+
+            continue;
+        }
+
+        int n = std::min((quint32) (nbSamples - nbRead), m_chunkHeader.sampleCount - m_chunkPosition);
+        std::memcpy(&buf[nbRead * sampleBytes], &m_chunkData[m_chunkPosition * sampleBytes], n * sampleBytes);
+        m_chunkPosition += n;
+        nbRead += n;
+    }
+
+    return nbRead;
+}
+
+bool FileRecordChunkedReader::atEnd() const
+{
+    return (m_chunkIndex < 0)
+        || (m_chunkIndex >= (int) m_index.size())
+        || ((m_chunkIndex == (int) m_index.size() - 1) && (m_chunkPosition >= m_chunkHeader.sampleCount));
+}
+
+bool FileRecordChunkedReader::parametersChanged()
+{
+    bool changed = m_parametersChanged;
+    m_parametersChanged = false;
+    return changed;
+}
@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_FILERECORDCHUNKEDREADER_H
+#define INCLUDE_FILERECORDCHUNKEDREADER_H
+
+#include <fstream>
+#include <vector>
+
+#include "dsp/filerecordchunked.h"
+#include "export.h"
+
+/**
+ * Random access reader of chunked I/Q records (.sdriqc).
+ *
+ * The index is taken from the end of the file or rebuilt by scanning the chunk headers if the recording
+ * was interrupted. Seeking in time is a binary search in the index. Chunks are read whole and checked
+ * against their CRC then samples are served from memory.
+ */
+class SDRBASE_API FileRecordChunkedReader
+{
+public:
+    FileRecordChunkedReader();
+    ~FileRecordChunkedReader();
+
+    bool open(std::ifstream *sampleFile); //!< reads file header and index. Returns false if this is not a valid chunked file
+    void close();
+    bool isOpen() const { return m_sampleFile != nullptr; }
+    bool isIndexed() const { return m_indexed; } //!< true if the index was read from the file (else rebuilt)
+
+    quint32 getSampleSize() const { return m_fileHeader.sampleSize; }
+    int getSampleBytes() const { return FileRecordChunked::getSampleBytes(m_fileHeader.sampleSize); }
+    const std::vector<FileRecordChunked::IndexEntry>& getIndex() const { return m_index; }
+    quint64 getStartTimestampUs() const;
+    quint64 getEndTimestampUs() const;        //!< timestamp past the last sample
+    quint64 getNbSamples() const { return m_nbSamples; }
+    int getNbGaps() const { return m_nbGaps; }
+    int getNbCorruptedChunks() const { return m_nbCorruptedChunks; }
+
+    bool seekTimestamp(quint64 timestampUs);  //!< positions at the first sample at or after the timestamp
+    bool seekChunk(int chunkIndex) { return loadChunk(chunkIndex, 0); }
+    bool seekStart() { return loadChunk(0, 0); }
+    /** Reads up to nbSamples samples. Stops at the start of a chunk with a different sample rate or center frequency. */
+    int read(quint8 *buf, int nbSamples);
+    bool atEnd() const;
+    bool parametersChanged();                 //!< returns true once after reading entered a chunk with new parameters
+
+    quint32 getSampleRate() const { return m_chunkHeader.sampleRate; }      //!< of the current chunk
+    quint64 getCenterFrequency() const { return m_chunkHeader.centerFrequency; } //!< of the current chunk
+    quint64 getTimestampUs() const;           //!< timestamp of the next sample to be read
+
+private:
+    std::ifstream *m_sampleFile;
+    FileRecordChunked::FileHeader m_fileHeader;
+    std::vector<FileRecordChunked::IndexEntry> m_index;
+    bool m_indexed;
+    quint64 m_nbSamples;
+    int m_nbGaps;
+    int m_nbCorruptedChunks;
+    int m_chunkIndex;                         //!< current chunk or -1 if none
+    FileRecordChunked::ChunkHeader m_chunkHeader;
+    std::vector<quint8> m_chunkData;
+    quint32 m_chunkPosition;                  //!< next sample to read in the current chunk
+    bool m_parametersChanged;
+
+    bool readIndex(quint64 fileSize);
+    void rebuildIndex(quint64 fileSize);
+    void indexStats();
+    bool loadChunk(int chunkIndex, quint32 position);
+};
+
+#endif // INCLUDE_FILERECORDCHUNKEDREADER_H
@@ -55,6 +55,15 @@ FileRecordInterface::RecordType FileRecordInterface::guessTypeFromFileName(const
             fileBase = dotBreakout.join(QLatin1Char('.'));
             return RecordTypeSdrIQ;
         }
+        else if (extension == "sdriqc")
+        {
+            if (dotBreakout.length() > 1) {
+                dotBreakout.removeLast();
+            }
+
+            fileBase = dotBreakout.join(QLatin1Char('.'));
+            return RecordTypeSdrIQChunked;
+        }
         else if (extension == "sigmf-meta")
         {
             fileBase = dotBreakout.join(QLatin1Char('.'));
@@ -31,7 +31,8 @@ public:
     {
         RecordTypeUndefined = 0,
         RecordTypeSdrIQ,
-        RecordTypeSigMF
+        RecordTypeSigMF,
+        RecordTypeSdrIQChunked
     };
 
     FileRecordInterface();
@@ -46,6 +47,8 @@ public:
     virtual void startRecording() = 0;
     virtual void stopRecording() = 0;
     virtual bool isRecording() const = 0;
+    virtual void setMsShift(int shift) = 0;
+    virtual const QString& getCurrentFileName() = 0;
 
     static QString genUniqueFileName(unsigned int deviceUID, int istream = -1);
     static RecordType guessTypeFromFileName(const QString& fileName, QString& fileBase);
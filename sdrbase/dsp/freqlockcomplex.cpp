@@ -81,6 +81,37 @@ void FreqLockComplex::feed(float re, float im)
     m_phiX1 = m_phiX0;
 }
 
+void FreqLockComplex::feed(const std::complex<float> *x, unsigned int len, std::complex<float> *y)
+{
+    float phi = m_phi;
+    float phiX1 = m_phiX1;
+    float y1 = m_y1;
+    std::complex<float> yc = m_y;
+
+    for (unsigned int i = 0; i < len; i++)
+    {
+        yc = std::complex<float>(cos(phi), sin(phi));
+        float phiX0 = std::arg(x[i]);
+        float eF = normalizeAngle(phiX0 - phiX1);
+        y1 = m_a1*eF + m_a0*y1;
+        phi += y1;
+        phiX1 = phiX0;
+
+        if (y) {
+            y[i] = yc;
+        }
+    }
+
+    m_y = yc;
+    m_yRe = yc.real();
+    m_yIm = yc.imag();
+    m_freq = y1;
+    m_phi = phi;
+    m_phiX0 = phiX1;
+    m_phiX1 = phiX1;
+    m_y1 = y1;
+}
+
 float FreqLockComplex::normalizeAngle(float angle)
 {
     while (angle <= -M_PI) {
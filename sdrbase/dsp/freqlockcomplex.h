@@ -38,6 +38,8 @@ public:
     void setSampleRate(unsigned int sampleRate);
     /** Feed PLL with a new signa sample */
     void feed(float re, float im);
+    /** Feed with a block of samples. The output for each sample is written to y if not null */
+    void feed(const std::complex<float> *x, unsigned int len, std::complex<float> *y);
     const std::complex<float>& getComplex() const { return m_y; }
     float getReal() const { return m_yRe; }
     float getImag() const { return m_yIm; }
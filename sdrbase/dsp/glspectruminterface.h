@@ -27,6 +27,7 @@ public:
     GLSpectrumInterface() {}
     virtual ~GLSpectrumInterface() {}
     virtual void newSpectrum(const std::vector<Real>& spectrum, int fftSize) {}
+    virtual void setSignalParameters(quint64 centerFrequency, int sampleRate) {}
 };
 
 #endif // SDRBASE_DSP_GLSPECTRUMINTERFACE_H_
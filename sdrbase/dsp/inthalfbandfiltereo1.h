@@ -25,6 +25,12 @@
 
 #include <stdint.h>
 #include <cstdlib>
+#if defined(USE_SSE4_1)
+#include <smmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "dsp/dsptypes.h"
 #include "dsp/hbfiltertraits.h"
 //#include "dsp/inthalfbandfiltereo1i.h"
@@ -788,22 +794,66 @@ protected:
         *y = qAcc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift -1);
     }
 
-    void doInterpolateFIR(Sample* sample)
+    void doInterpolateFIRAcc(qint32& iAcc, qint32& qAcc)
     {
-        qint32 iAcc = 0;
-        qint32 qAcc = 0;
+        int a = m_ptr;
+        int b = m_ptr + (HBFIRFilterTraits<HBFilterOrder>::hbOrder / 2) - 1;
+        int i = 0;
+#if defined(USE_SSE4_1)
+        // two symmetric pairs of I/Q at a time: a, a+1 with b, b-1
+        __m128i acc = _mm_setzero_si128();
+
+        for (; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4 - 1; i += 2)
+        {
+            __m128i va = _mm_loadu_si128((const __m128i*) m_samples[a]);
+            __m128i vb = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*) m_samples[b-1]), _MM_SHUFFLE(1,0,3,2));
+            __m128i vc = _mm_loadl_epi64((const __m128i*) &HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i]);
+            vc = _mm_unpacklo_epi32(vc, vc);
+            acc = _mm_add_epi32(acc, _mm_mullo_epi32(_mm_add_epi32(va, vb), vc));
+            a += 2;
+            b -= 2;
+        }
 
-        qint16 a = m_ptr;
-        qint16 b = m_ptr + (HBFIRFilterTraits<HBFilterOrder>::hbOrder / 2) - 1;
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1,0,3,2)));
+        iAcc = _mm_cvtsi128_si32(acc);
+        qAcc = _mm_cvtsi128_si32(_mm_shuffle_epi32(acc, _MM_SHUFFLE(1,1,1,1)));
+#elif defined(USE_NEON)
+        int32x4_t acc = vdupq_n_s32(0);
 
-        // go through samples in buffer
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
+        for (; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4 - 1; i += 2)
+        {
+            int32x4_t va = vld1q_s32(m_samples[a]);
+            int32x4_t vb = vld1q_s32(m_samples[b-1]);
+            vb = vcombine_s32(vget_high_s32(vb), vget_low_s32(vb));
+            int32x2_t c = vld1_s32(&HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i]);
+            int32x2x2_t cc = vzip_s32(c, c);
+            acc = vmlaq_s32(acc, vaddq_s32(va, vb), vcombine_s32(cc.val[0], cc.val[1]));
+            a += 2;
+            b -= 2;
+        }
+
+        int32x2_t sum = vadd_s32(vget_low_s32(acc), vget_high_s32(acc));
+        iAcc = vget_lane_s32(sum, 0);
+        qAcc = vget_lane_s32(sum, 1);
+#else
+        iAcc = 0;
+        qAcc = 0;
+#endif
+        // go through remaining samples in buffer
+        for (; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
         {
             iAcc += (m_samples[a][0] + m_samples[b][0]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
             qAcc += (m_samples[a][1] + m_samples[b][1]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
             a++;
             b--;
         }
+    }
+
+    void doInterpolateFIR(Sample* sample)
+    {
+        qint32 iAcc;
+        qint32 qAcc;
+        doInterpolateFIRAcc(iAcc, qAcc);
 
         sample->setReal(iAcc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift -1));
         sample->setImag(qAcc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift -1));
@@ -811,20 +861,9 @@ protected:
 
     void doInterpolateFIR(qint32 *x, qint32 *y)
     {
-        qint32 iAcc = 0;
-        qint32 qAcc = 0;
-
-        qint16 a = m_ptr;
-        qint16 b = m_ptr + (HBFIRFilterTraits<HBFilterOrder>::hbOrder / 2) - 1;
-
-        // go through samples in buffer
-        for (int i = 0; i < HBFIRFilterTraits<HBFilterOrder>::hbOrder / 4; i++)
-        {
-            iAcc += (m_samples[a][0] + m_samples[b][0]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            qAcc += (m_samples[a][1] + m_samples[b][1]) * HBFIRFilterTraits<HBFilterOrder>::hbCoeffs[i];
-            a++;
-            b--;
-        }
+        qint32 iAcc;
+        qint32 qAcc;
+        doInterpolateFIRAcc(iAcc, qAcc);
 
         *x = iAcc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift -1);
         *y = qAcc >> (HBFIRFilterTraits<HBFilterOrder>::hbShift -1);
@@ -0,0 +1,263 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#if defined(USE_SSE2)
+#include <emmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "iqcorrector.h"
+
+const float IQCorrector::m_imbalanceSmoothing = 0.25f;
+
+IQCorrector::IQCorrector() :
+    m_estimationPeriod(4)
+{
+    reset();
+}
+
+void IQCorrector::reset()
+{
+    m_iOffset = 0.0f;
+    m_qOffset = 0.0f;
+    m_phase = 0.0f;
+    m_amplitude = 1.0f;
+    m_imbalanceEstimated = false;
+    m_blockCount = 0;
+}
+
+void IQCorrector::process(SampleVector::iterator begin, SampleVector::iterator end, bool imbalanceCorrection)
+{
+    int nbSamples = end - begin;
+
+    if (nbSamples <= 0) {
+        return;
+    }
+
+    Sample *samples = &(*begin);
+
+    if (imbalanceCorrection && ((m_blockCount++ % m_estimationPeriod) == 0)) {
+        estimateImbalance(samples, nbSamples);
+    }
+
+    float amplitude = imbalanceCorrection ? m_amplitude : 1.0f;
+    float coef = imbalanceCorrection ? m_amplitude * m_phase : 0.0f;
+    qint64 iSum = 0;
+    qint64 qSum = 0;
+    int i = correctSIMD(samples, nbSamples, amplitude, coef, iSum, qSum);
+    correctScalar(samples + i, nbSamples - i, amplitude, coef, iSum, qSum);
+    updateOffsets(iSum, qSum, nbSamples);
+}
+
+void IQCorrector::processScalar(SampleVector::iterator begin, SampleVector::iterator end, bool imbalanceCorrection)
+{
+    int nbSamples = end - begin;
+
+    if (nbSamples <= 0) {
+        return;
+    }
+
+    Sample *samples = &(*begin);
+
+    if (imbalanceCorrection && ((m_blockCount++ % m_estimationPeriod) == 0)) {
+        estimateImbalance(samples, nbSamples);
+    }
+
+    float amplitude = imbalanceCorrection ? m_amplitude : 1.0f;
+    float coef = imbalanceCorrection ? m_amplitude * m_phase : 0.0f;
+    qint64 iSum = 0;
+    qint64 qSum = 0;
+    correctScalar(samples, nbSamples, amplitude, coef, iSum, qSum);
+    updateOffsets(iSum, qSum, nbSamples);
+}
+
+void IQCorrector::estimateImbalance(const Sample *samples, int nbSamples)
+{
+    double sII = 0.0; // <I", I">
+    double sIQ = 0.0; // <I", Q">
+    double sQQ = 0.0; // <Q", Q">
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        double xi = samples[i].m_real - m_iOffset;
+        double xq = samples[i].m_imag - m_qOffset;
+        sII += xi*xi;
+        sIQ += xi*xq;
+        sQQ += xq*xq;
+    }
+
+    if (sII == 0.0) {
+        return;
+    }
+
+    // phase imbalance then amplitude imbalance on the phase corrected Q:
+    // <Q - phase.I, Q - phase.I> = <Q, Q> - phase.<I, Q> with phase = <I, Q> / <I, I>
+    double phase = sIQ / sII;
+    double sYQ = sQQ - phase*sIQ;
+
+    if (sYQ <= 0.0) {
+        return;
+    }
+
+    double amplitude = std::sqrt(sII / sYQ);
+
+    if (m_imbalanceEstimated)
+    {
+        m_phase += (phase - m_phase) * m_imbalanceSmoothing;
+        m_amplitude += (amplitude - m_amplitude) * m_imbalanceSmoothing;
+    }
+    else
+    {
+        m_phase = phase;
+        m_amplitude = amplitude;
+        m_imbalanceEstimated = true;
+    }
+}
+
+void IQCorrector::updateOffsets(qint64 iSum, qint64 qSum, int nbSamples)
+{
+    float weight = nbSamples < (int) m_dcAverageLength ? nbSamples / (float) m_dcAverageLength : 1.0f;
+    m_iOffset += ((float) (iSum / (double) nbSamples) - m_iOffset) * weight;
+    m_qOffset += ((float) (qSum / (double) nbSamples) - m_qOffset) * weight;
+}
+
+void IQCorrector::correctScalar(Sample *samples, int nbSamples, float amplitude, float coef, qint64& iSum, qint64& qSum)
+{
+    for (int i = 0; i < nbSamples; i++)
+    {
+        iSum += samples[i].m_real;
+        qSum += samples[i].m_imag;
+        float xi = samples[i].m_real - m_iOffset;
+        float xq = samples[i].m_imag - m_qOffset;
+        float zq = (xq * amplitude) - (xi * coef);
+#ifdef SDR_RX_SAMPLE_24BIT
+        samples[i].m_real = (FixReal) xi;
+        samples[i].m_imag = (FixReal) zq;
+#else
+        samples[i].m_real = (FixReal) (xi < -32768.0f ? -32768.0f : xi > 32767.0f ? 32767.0f : xi); // saturates as the SIMD pack does
+        samples[i].m_imag = (FixReal) (zq < -32768.0f ? -32768.0f : zq > 32767.0f ? 32767.0f : zq);
+#endif
+    }
+}
+
+#if defined(USE_SSE2)
+int IQCorrector::correctSIMD(Sample *samples, int nbSamples, float amplitude, float coef, qint64& iSum, qint64& qSum)
+{
+    // vectors hold interleaved I/Q: [I0 Q0 I1 Q1]. Q lanes get Q*amplitude - I*coef using the I/Q swapped vector.
+    const __m128 offset = _mm_setr_ps(m_iOffset, m_qOffset, m_iOffset, m_qOffset);
+    const __m128 amp = _mm_setr_ps(1.0f, amplitude, 1.0f, amplitude);
+    const __m128 cross = _mm_setr_ps(0.0f, coef, 0.0f, coef);
+    const int flushPeriod = 1 << (30 - SDR_RX_SAMP_SZ); // iterations before the 32 bit sums may overflow
+    __m128i acc = _mm_setzero_si128();
+    qint32 accOut[4];
+    int flushCount = 0;
+    int i = 0;
+
+    auto correct = [&](__m128i x) -> __m128i {
+        __m128 f = _mm_sub_ps(_mm_cvtepi32_ps(x), offset);
+        __m128 s = _mm_shuffle_ps(f, f, _MM_SHUFFLE(2,3,0,1));
+        return _mm_cvttps_epi32(_mm_sub_ps(_mm_mul_ps(f, amp), _mm_mul_ps(s, cross)));
+    };
+    auto flush = [&]() {
+        _mm_storeu_si128((__m128i*) accOut, acc);
+        iSum += (qint64) accOut[0] + accOut[2];
+        qSum += (qint64) accOut[1] + accOut[3];
+        acc = _mm_setzero_si128();
+        flushCount = 0;
+    };
+
+    for (; i + 4 <= nbSamples; i += 4) // 4 I/Q pairs
+    {
+#ifdef SDR_RX_SAMPLE_24BIT
+        __m128i lo = _mm_loadu_si128((const __m128i*) &samples[i]);
+        __m128i hi = _mm_loadu_si128((const __m128i*) &samples[i+2]);
+        acc = _mm_add_epi32(acc, _mm_add_epi32(lo, hi));
+        _mm_storeu_si128((__m128i*) &samples[i], correct(lo));
+        _mm_storeu_si128((__m128i*) &samples[i+2], correct(hi));
+#else
+        __m128i v = _mm_loadu_si128((const __m128i*) &samples[i]);
+        __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+        __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+        acc = _mm_add_epi32(acc, _mm_add_epi32(lo, hi));
+        _mm_storeu_si128((__m128i*) &samples[i], _mm_packs_epi32(correct(lo), correct(hi)));
+#endif
+        if (++flushCount == flushPeriod) {
+            flush();
+        }
+    }
+
+    flush();
+    return i;
+}
+#elif defined(USE_NEON)
+int IQCorrector::correctSIMD(Sample *samples, int nbSamples, float amplitude, float coef, qint64& iSum, qint64& qSum)
+{
+    // vectors hold interleaved I/Q: [I0 Q0 I1 Q1]. Q lanes get Q*amplitude - I*coef using the I/Q swapped vector.
+    const float offsetArr[4] = {m_iOffset, m_qOffset, m_iOffset, m_qOffset};
+    const float ampArr[4] = {1.0f, amplitude, 1.0f, amplitude};
+    const float crossArr[4] = {0.0f, coef, 0.0f, coef};
+    const float32x4_t offset = vld1q_f32(offsetArr);
+    const float32x4_t amp = vld1q_f32(ampArr);
+    const float32x4_t cross = vld1q_f32(crossArr);
+    const int flushPeriod = 1 << (30 - SDR_RX_SAMP_SZ); // iterations before the 32 bit sums may overflow
+    int32x4_t acc = vdupq_n_s32(0);
+    int flushCount = 0;
+    int i = 0;
+
+    auto correct = [&](int32x4_t x) -> int32x4_t {
+        float32x4_t f = vsubq_f32(vcvtq_f32_s32(x), offset);
+        float32x4_t s = vrev64q_f32(f);
+        return vcvtq_s32_f32(vsubq_f32(vmulq_f32(f, amp), vmulq_f32(s, cross)));
+    };
+    auto flush = [&]() {
+        iSum += (qint64) vgetq_lane_s32(acc, 0) + vgetq_lane_s32(acc, 2);
+        qSum += (qint64) vgetq_lane_s32(acc, 1) + vgetq_lane_s32(acc, 3);
+        acc = vdupq_n_s32(0);
+        flushCount = 0;
+    };
+
+    for (; i + 4 <= nbSamples; i += 4) // 4 I/Q pairs
+    {
+#ifdef SDR_RX_SAMPLE_24BIT
+        int32x4_t lo = vld1q_s32((const int32_t*) &samples[i]);
+        int32x4_t hi = vld1q_s32((const int32_t*) &samples[i+2]);
+        acc = vaddq_s32(acc, vaddq_s32(lo, hi));
+        vst1q_s32((int32_t*) &samples[i], correct(lo));
+        vst1q_s32((int32_t*) &samples[i+2], correct(hi));
+#else
+        int16x8_t v = vld1q_s16((const int16_t*) &samples[i]);
+        int32x4_t lo = vmovl_s16(vget_low_s16(v));
+        int32x4_t hi = vmovl_s16(vget_high_s16(v));
+        acc = vaddq_s32(acc, vaddq_s32(lo, hi));
+        vst1q_s16((int16_t*) &samples[i], vcombine_s16(vqmovn_s32(correct(lo)), vqmovn_s32(correct(hi))));
+#endif
+        if (++flushCount == flushPeriod) {
+            flush();
+        }
+    }
+
+    flush();
+    return i;
+}
+#else
+int IQCorrector::correctSIMD(Sample*, int, float, float, qint64&, qint64&)
+{
+    return 0;
+}
+#endif
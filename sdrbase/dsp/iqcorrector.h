@@ -0,0 +1,65 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_IQCORRECTOR_H_
+#define SDRBASE_DSP_IQCORRECTOR_H_
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * DC offset and I/Q imbalance correction of baseband sample blocks.
+ *
+ * DC offset is estimated on every block and applied with a one block lag so that estimation and
+ * correction are done in a single pass. The phase and amplitude imbalance estimation only needs
+ * three sums over the block and is run every N blocks. Between estimations the correction is a
+ * fixed 2x2 matrix applied with SSE2 or Neon instructions to the 16 or 24 bit samples.
+ */
+class SDRBASE_API IQCorrector
+{
+public:
+    IQCorrector();
+
+    void reset();
+    void setEstimationPeriod(unsigned int nbBlocks) { m_estimationPeriod = nbBlocks < 1 ? 1 : nbBlocks; }
+    void process(SampleVector::iterator begin, SampleVector::iterator end, bool imbalanceCorrection);
+    void processScalar(SampleVector::iterator begin, SampleVector::iterator end, bool imbalanceCorrection); //!< reference implementation
+
+    float getIOffset() const { return m_iOffset; }
+    float getQOffset() const { return m_qOffset; }
+    float getPhase() const { return m_phase; }         //!< Q = Q - phase * I
+    float getAmplitude() const { return m_amplitude; } //!< Q = amplitude * Q
+
+private:
+    float m_iOffset;
+    float m_qOffset;
+    float m_phase;
+    float m_amplitude;
+    bool m_imbalanceEstimated;
+    unsigned int m_estimationPeriod;
+    unsigned int m_blockCount;
+
+    static const unsigned int m_dcAverageLength = 1024; //!< DC offset time constant in samples
+    static const float m_imbalanceSmoothing;           //!< weight of a new imbalance estimate
+
+    void estimateImbalance(const Sample *samples, int nbSamples);
+    void updateOffsets(qint64 iSum, qint64 qSum, int nbSamples);
+    int correctSIMD(Sample *samples, int nbSamples, float amplitude, float coef, qint64& iSum, qint64& qSum);
+    void correctScalar(Sample *samples, int nbSamples, float amplitude, float coef, qint64& iSum, qint64& qSum);
+};
+
+#endif // SDRBASE_DSP_IQCORRECTOR_H_
@@ -106,3 +106,30 @@ void NCOF::getQI(Complex& c)
 	c.imag(m_table[(int) m_phase]);
 	c.real(-m_table[((int) m_phase + TableSize / 4) % TableSize]);
 }
+
+void NCOF::mix(const Sample *in, Complex *out, unsigned int len)
+{
+	Real phase = m_phase;
+
+	for (unsigned int i = 0; i < len; i++)
+	{
+		phase += m_phaseIncrement;
+
+		while (phase >= m_tableSizeLimit) {
+			phase -= TableSize;
+		}
+		while (phase < 0.0) {
+			phase += TableSize;
+		}
+
+		int iphase = (int) phase;
+		Real loRe = m_table[iphase];
+		Real loIm = -m_table[(iphase + TableSize / 4) & (TableSize - 1)];
+		Real re = in[i].real();
+		Real im = in[i].imag();
+		out[i].real(re*loRe - im*loIm);
+		out[i].imag(re*loIm + im*loRe);
+	}
+
+	m_phase = phase;
+}
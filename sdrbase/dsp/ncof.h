@@ -62,6 +62,7 @@ public:
 	void getIQ(Complex& c);             //!< Sets to the current complex sample (no phase increment)
 	Complex getQI();                    //!< Return current complex sample (no phase increment, reversed)
 	void getQI(Complex& c);             //!< Sets to the current complex sample (no phase increment, reversed)
+	void mix(const Sample *in, Complex *out, unsigned int len); //!< Multiply a block of samples by the next len complex samples
 };
 
 #endif // INCLUDE_NCO_H
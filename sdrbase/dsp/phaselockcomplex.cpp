@@ -159,7 +159,69 @@ void PhaseLockComplex::feed(float re, float im)
         m_phiHat += 2.0*M_PI;
     }
 
-    // lock and frequency estimation
+    updateLock();
+}
+
+void PhaseLockComplex::feed(const std::complex<float> *x, unsigned int len, std::complex<float> *y)
+{
+    // loop filter state is kept in locals during the block
+    float v0 = m_v0;
+    float v1 = m_v1;
+    float v2 = m_v2;
+    float phiHat = m_phiHat;
+    float deltaPhi = m_deltaPhi;
+    std::complex<float> yc = m_y;
+
+    for (unsigned int i = 0; i < len; i++)
+    {
+        yc = std::complex<float>(cos(phiHat), sin(phiHat));
+        deltaPhi = std::arg(x[i] * std::conj(yc));
+
+        if (m_pskOrder > 1) {
+            deltaPhi = normalizeAngle(m_pskOrder*deltaPhi);
+        }
+
+        v2 = v1;
+        v1 = v0;
+        v0 = deltaPhi - v1*m_a1 - v2*m_a2;
+        phiHat = v0*m_b0 + v1*m_b1 + v2*m_b2;
+
+        // prevent saturation
+        if (phiHat > 2.0*M_PI)
+        {
+            v0 *= (phiHat - 2.0*M_PI) / phiHat;
+            v1 *= (phiHat - 2.0*M_PI) / phiHat;
+            v2 *= (phiHat - 2.0*M_PI) / phiHat;
+            phiHat -= 2.0*M_PI;
+        }
+
+        if (phiHat < -2.0*M_PI)
+        {
+            v0 *= (phiHat + 2.0*M_PI) / phiHat;
+            v1 *= (phiHat + 2.0*M_PI) / phiHat;
+            v2 *= (phiHat + 2.0*M_PI) / phiHat;
+            phiHat += 2.0*M_PI;
+        }
+
+        if (y) {
+            y[i] = yc;
+        }
+
+        m_phiHat = phiHat;
+        updateLock();
+    }
+
+    m_y = yc;
+    m_yRe = yc.real();
+    m_yIm = yc.imag();
+    m_v0 = v0;
+    m_v1 = v1;
+    m_v2 = v2;
+    m_deltaPhi = deltaPhi;
+}
+
+void PhaseLockComplex::updateLock()
+{
     if (m_pskOrder > 1)
     {
         float dPhi = normalizeAngle(m_phiHat - m_phiHatPrev);
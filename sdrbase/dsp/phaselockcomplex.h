@@ -47,6 +47,8 @@ public:
     void reset();
     /** Feed PLL with a new signa sample */
     void feed(float re, float im);
+    /** Feed PLL with a block of samples. The PLL output for each sample is written to y if not null */
+    void feed(const std::complex<float> *x, unsigned int len, std::complex<float> *y);
     const std::complex<float>& getComplex() const { return m_y; }
     float getReal() const { return m_yRe; }
     float getImag() const { return m_yIm; }
@@ -80,6 +82,8 @@ private:
 
     /** Normalize angle in radians into the [-pi,+pi] region */
     static float normalizeAngle(float angle);
+    /** Lock and frequency estimation from the new phase estimate */
+    void updateLock();
 
     // a0 = 1 is implied
     float m_a1;
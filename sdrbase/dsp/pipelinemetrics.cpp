@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QTextStream>
+
+#include "util/messagequeue.h"
+#include "pipelinemetrics.h"
+
+std::atomic<bool> PipelineMetrics::m_enabled(false);
+
+PipelineMetrics::PipelineMetrics()
+{
+    reset();
+}
+
+PipelineMetrics *PipelineMetrics::instance()
+{
+    static PipelineMetrics pipelineMetrics;
+    return &pipelineMetrics;
+}
+
+void PipelineMetrics::setEnabled(bool enabled)
+{
+    qDebug("PipelineMetrics::setEnabled: %s", enabled ? "true" : "false");
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+const char *PipelineMetrics::getStageName(Stage stage)
+{
+    switch (stage)
+    {
+    case StageDeviceWorker:
+        return "device_worker";
+    case StageSampleFifo:
+        return "sample_fifo";
+    case StageDeviceEngine:
+        return "device_engine";
+    case StageChannelizer:
+        return "channelizer";
+    case StageChannelSink:
+        return "channel_sink";
+    case StageAudioFifo:
+        return "audio_fifo";
+    case StageAudioOutput:
+        return "audio_output";
+    default:
+        return "unknown";
+    }
+}
+
+quint64 PipelineMetrics::getBucketUpperBoundNs(int bucket)
+{
+    if ((bucket < 0) || (bucket >= m_nbHistogramBuckets - 1)) {
+        return 0;
+    } else {
+        return 1ULL << (m_histogramMinLog2 + bucket);
+    }
+}
+
+void PipelineMetrics::reset()
+{
+    for (int i = 0; i < NbStages; i++)
+    {
+        StageCounters& counters = m_stages[i];
+        counters.m_blocks.store(0, std::memory_order_relaxed);
+        counters.m_samples.store(0, std::memory_order_relaxed);
+        counters.m_totalNs.store(0, std::memory_order_relaxed);
+        counters.m_maxNs.store(0, std::memory_order_relaxed);
+
+        for (int j = 0; j < m_nbHistogramBuckets; j++) {
+            counters.m_histogram[j].store(0, std::memory_order_relaxed);
+        }
+
+        counters.m_fillHighWater.store(0, std::memory_order_relaxed);
+        counters.m_overflows.store(0, std::memory_order_relaxed);
+        counters.m_underruns.store(0, std::memory_order_relaxed);
+    }
+}
+
+void PipelineMetrics::addBlock(Stage stage, unsigned int nbSamples, qint64 nsecs)
+{
+    StageCounters& counters = m_stages[stage];
+    quint64 ns = nsecs < 0 ? 0 : nsecs;
+    int bucket = 0;
+
+    for (quint64 bound = 1ULL << m_histogramMinLog2; (ns > bound) && (bucket < m_nbHistogramBuckets - 1); bound <<= 1) {
+        bucket++;
+    }
+
+    counters.m_blocks.fetch_add(1, std::memory_order_relaxed);
+    counters.m_samples.fetch_add(nbSamples, std::memory_order_relaxed);
+    counters.m_totalNs.fetch_add(ns, std::memory_order_relaxed);
+    counters.m_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+    quint64 maxNs = counters.m_maxNs.load(std::memory_order_relaxed);
+
+    while ((ns > maxNs) && !counters.m_maxNs.compare_exchange_weak(maxNs, ns, std::memory_order_relaxed)) {}
+}
+
+void PipelineMetrics::addSamples(Stage stage, unsigned int nbSamples)
+{
+    m_stages[stage].m_samples.fetch_add(nbSamples, std::memory_order_relaxed);
+}
+
+void PipelineMetrics::updateFill(Stage stage, unsigned int fill, unsigned int size)
+{
+    if (size == 0) {
+        return;
+    }
+
+    StageCounters& counters = m_stages[stage];
+    quint32 ratio = (((quint64) fill) << 16) / size;
+    quint32 highWater = counters.m_fillHighWater.load(std::memory_order_relaxed);
+
+    while ((ratio > highWater) && !counters.m_fillHighWater.compare_exchange_weak(highWater, ratio, std::memory_order_relaxed)) {}
+}
+
+void PipelineMetrics::getSnapshot(Stage stage, StageSnapshot& snapshot) const
+{
+    const StageCounters& counters = m_stages[stage];
+    snapshot.m_blocks = counters.m_blocks.load(std::memory_order_relaxed);
+    snapshot.m_samples = counters.m_samples.load(std::memory_order_relaxed);
+    snapshot.m_totalNs = counters.m_totalNs.load(std::memory_order_relaxed);
+    snapshot.m_maxNs = counters.m_maxNs.load(std::memory_order_relaxed);
+
+    for (int i = 0; i < m_nbHistogramBuckets; i++) {
+        snapshot.m_histogram[i] = counters.m_histogram[i].load(std::memory_order_relaxed);
+    }
+
+    snapshot.m_fillHighWater = counters.m_fillHighWater.load(std::memory_order_relaxed) / 65536.0f;
+    snapshot.m_overflows = counters.m_overflows.load(std::memory_order_relaxed);
+    snapshot.m_underruns = counters.m_underruns.load(std::memory_order_relaxed);
+}
+
+QString PipelineMetrics::formatPrometheus() const
+{
+    QString text;
+    QTextStream out(&text);
+    StageSnapshot snapshots[NbStages];
+
+    for (int i = 0; i < NbStages; i++) {
+        getSnapshot((Stage) i, snapshots[i]);
+    }
+
+    out << "# HELP sdrangel_pipeline_metrics_enabled Pipeline instrumentation is active\n"
+        << "# TYPE sdrangel_pipeline_metrics_enabled gauge\n"
+        << "sdrangel_pipeline_metrics_enabled " << (isEnabled() ? 1 : 0) << "\n";
+
+    out << "# HELP sdrangel_pipeline_blocks_total Blocks processed by the stage\n"
+        << "# TYPE sdrangel_pipeline_blocks_total counter\n";
+
+    for (int i = 0; i < NbStages; i++) {
+        out << "sdrangel_pipeline_blocks_total{stage=\"" << getStageName((Stage) i) << "\"} " << snapshots[i].m_blocks << "\n";
+    }
+
+    out << "# HELP sdrangel_pipeline_samples_total Samples processed by the stage\n"
+        << "# TYPE sdrangel_pipeline_samples_total counter\n";
+
+    for (int i = 0; i < NbStages; i++) {
+        out << "sdrangel_pipeline_samples_total{stage=\"" << getStageName((Stage) i) << "\"} " << snapshots[i].m_samples << "\n";
+    }
+
+    out << "# HELP sdrangel_pipeline_block_duration_seconds Processing time per block\n"
+        << "# TYPE sdrangel_pipeline_block_duration_seconds histogram\n";
+
+    for (int i = 0; i < NbStages; i++)
+    {
+        const char *stageName = getStageName((Stage) i);
+        quint64 cumulative = 0;
+
+        for (int j = 0; j < m_nbHistogramBuckets - 1; j++)
+        {
+            cumulative += snapshots[i].m_histogram[j];
+            out << "sdrangel_pipeline_block_duration_seconds_bucket{stage=\"" << stageName
+                << "\",le=\"" << QString::number(getBucketUpperBoundNs(j) * 1e-9, 'g', 6) << "\"} " << cumulative << "\n";
+        }
+
+        cumulative += snapshots[i].m_histogram[m_nbHistogramBuckets - 1];
+        out << "sdrangel_pipeline_block_duration_seconds_bucket{stage=\"" << stageName << "\",le=\"+Inf\"} " << cumulative << "\n"
+            << "sdrangel_pipeline_block_duration_seconds_sum{stage=\"" << stageName << "\"} "
+            << QString::number(snapshots[i].m_totalNs * 1e-9, 'g', 9) << "\n"
+            << "sdrangel_pipeline_block_duration_seconds_count{stage=\"" << stageName << "\"} " << cumulative << "\n";
+    }
+
+    out << "# HELP sdrangel_pipeline_block_duration_max_seconds Longest processing time of a block\n"
+        << "# TYPE sdrangel_pipeline_block_duration_max_seconds gauge\n";
+
+    for (int i = 0; i < NbStages; i++)
+    {
+        out << "sdrangel_pipeline_block_duration_max_seconds{stage=\"" << getStageName((Stage) i) << "\"} "
+            << QString::number(snapshots[i].m_maxNs * 1e-9, 'g', 6) << "\n";
+    }
+
+    out << "# HELP sdrangel_pipeline_fifo_fill_high_water_ratio Highest FIFO fill relative to its size\n"
+        << "# TYPE sdrangel_pipeline_fifo_fill_high_water_ratio gauge\n";
+
+    for (int i = 0; i < NbStages; i++)
+    {
+        out << "sdrangel_pipeline_fifo_fill_high_water_ratio{stage=\"" << getStageName((Stage) i) << "\"} "
+            << QString::number(snapshots[i].m_fillHighWater, 'g', 4) << "\n";
+    }
+
+    out << "# HELP sdrangel_pipeline_fifo_overflows_total Writes that did not fit in the FIFO\n"
+        << "# TYPE sdrangel_pipeline_fifo_overflows_total counter\n";
+
+    for (int i = 0; i < NbStages; i++) {
+        out << "sdrangel_pipeline_fifo_overflows_total{stage=\"" << getStageName((Stage) i) << "\"} " << snapshots[i].m_overflows << "\n";
+    }
+
+    out << "# HELP sdrangel_pipeline_fifo_underruns_total Reads that could not be fully served by the FIFO\n"
+        << "# TYPE sdrangel_pipeline_fifo_underruns_total counter\n";
+
+    for (int i = 0; i < NbStages; i++) {
+        out << "sdrangel_pipeline_fifo_underruns_total{stage=\"" << getStageName((Stage) i) << "\"} " << snapshots[i].m_underruns << "\n";
+    }
+
+    out << "# HELP sdrangel_coalesced_messages_total Configuration messages superseded by a newer one before being applied\n"
+        << "# TYPE sdrangel_coalesced_messages_total counter\n"
+        << "sdrangel_coalesced_messages_total " << MessageQueue::getTotalCoalescedCount() << "\n";
+
+    out.flush();
+    return text;
+}
@@ -0,0 +1,140 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_PIPELINEMETRICS_H_
+#define SDRBASE_DSP_PIPELINEMETRICS_H_
+
+#include <atomic>
+#include <chrono>
+
+#include <QString>
+
+#include "export.h"
+
+/**
+ * Counters of the receive pipeline stages: device worker, sample FIFOs, device engine,
+ * channelizers, channel sinks, audio FIFOs and audio output. Per stage it counts blocks and
+ * samples, keeps a histogram of the processing time per block (log2 buckets), the FIFO fill
+ * high water mark and the FIFO overflows and underruns.
+ *
+ * Instrumentation is always compiled in but disabled by default. When disabled the hot path
+ * cost is a relaxed atomic load. Counters are shared by all instances of a stage (e.g. all
+ * channelizers) and updated with relaxed atomics.
+ */
+class SDRBASE_API PipelineMetrics
+{
+public:
+    enum Stage
+    {
+        StageDeviceWorker,  //!< device worker conversion and decimation into the sample FIFO
+        StageSampleFifo,    //!< sample FIFOs (device and channels)
+        StageDeviceEngine,  //!< device engine distribution to the baseband sinks
+        StageChannelizer,   //!< channelizers decimation
+        StageChannelSink,   //!< channel sinks (demodulators)
+        StageAudioFifo,     //!< audio FIFOs between channels and audio output
+        StageAudioOutput,   //!< audio output device callback
+        NbStages
+    };
+
+    static const int m_nbHistogramBuckets = 24;
+    static const int m_histogramMinLog2 = 10;  //!< first bucket is up to 2^10 ns (~1us). Last bucket has no upper bound.
+
+    struct StageSnapshot
+    {
+        quint64 m_blocks;
+        quint64 m_samples;
+        quint64 m_totalNs;
+        quint64 m_maxNs;
+        quint64 m_histogram[m_nbHistogramBuckets]; //!< non cumulative
+        float m_fillHighWater;                     //!< highest FIFO fill ratio (0..1)
+        quint64 m_overflows;
+        quint64 m_underruns;
+    };
+
+    /** Times a block processing in a scope and adds it to the stage when metrics are enabled */
+    class BlockTimer
+    {
+    public:
+        BlockTimer(Stage stage, unsigned int nbSamples = 0) :
+            m_stage(stage),
+            m_nbSamples(nbSamples),
+            m_enabled(PipelineMetrics::isEnabled())
+        {
+            if (m_enabled) {
+                m_start = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~BlockTimer() {
+            stop();
+        }
+
+        void setNbSamples(unsigned int nbSamples) { m_nbSamples = nbSamples; }
+
+        void stop() //!< add the block now instead of at the end of the scope
+        {
+            if (m_enabled)
+            {
+                qint64 nsecs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+                PipelineMetrics::instance()->addBlock(m_stage, m_nbSamples, nsecs);
+                m_enabled = false;
+            }
+        }
+
+    private:
+        Stage m_stage;
+        unsigned int m_nbSamples;
+        bool m_enabled;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    static PipelineMetrics *instance();
+    static bool isEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled);
+    static const char *getStageName(Stage stage);
+    static quint64 getBucketUpperBoundNs(int bucket); //!< 0 for the unbounded last bucket
+
+    void reset();
+    void addBlock(Stage stage, unsigned int nbSamples, qint64 nsecs);
+    void addSamples(Stage stage, unsigned int nbSamples);
+    void updateFill(Stage stage, unsigned int fill, unsigned int size);
+    void addOverflow(Stage stage) { m_stages[stage].m_overflows.fetch_add(1, std::memory_order_relaxed); }
+    void addUnderrun(Stage stage) { m_stages[stage].m_underruns.fetch_add(1, std::memory_order_relaxed); }
+
+    void getSnapshot(Stage stage, StageSnapshot& snapshot) const;
+    QString formatPrometheus() const; //!< Prometheus text exposition format (version 0.0.4)
+
+private:
+    struct alignas(64) StageCounters
+    {
+        std::atomic<quint64> m_blocks;
+        std::atomic<quint64> m_samples;
+        std::atomic<quint64> m_totalNs;
+        std::atomic<quint64> m_maxNs;
+        std::atomic<quint64> m_histogram[m_nbHistogramBuckets];
+        std::atomic<quint32> m_fillHighWater; //!< in 1/65536 of the FIFO size
+        std::atomic<quint64> m_overflows;
+        std::atomic<quint64> m_underruns;
+    };
+
+    StageCounters m_stages[NbStages];
+    static std::atomic<bool> m_enabled;
+
+    PipelineMetrics();
+};
+
+#endif // SDRBASE_DSP_PIPELINEMETRICS_H_
@@ -18,6 +18,13 @@
 
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <algorithm>
+#if defined(USE_SSE2)
+#include <emmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "projector.h"
 
 Projector::Projector(ProjectionType projectionType) :
@@ -226,3 +233,364 @@ Real Projector::normalizeAngle(Real angle)
     }
     return angle;
 }
+
+void Projector::runBlock(const Sample *samples, int nbSamples, Real *out)
+{
+    int i;
+
+    switch (m_projectionType)
+    {
+    case ProjectionReal:
+    case ProjectionImag:
+    case ProjectionMagLin:
+    case ProjectionMagSq:
+        i = projectSIMD(m_projectionType, samples, nbSamples, out);
+
+        for (; i < nbSamples; i++) {
+            out[i] = run(samples[i]);
+        }
+        break;
+    case ProjectionMagDB:
+        magSqBlock(samples, nbSamples, out);
+        dBBlock(out, nbSamples, out);
+        break;
+    case ProjectionPhase:
+    case ProjectionDPhase:
+        i = projectSIMD(ProjectionPhase, samples, nbSamples, out);
+
+        for (; i < nbSamples; i++) {
+            out[i] = atan2Approx(samples[i].m_imag, samples[i].m_real) / M_PI;
+        }
+
+        if (m_projectionType == ProjectionDPhase)
+        {
+            Real prevPhase = m_prevArg / M_PI;
+
+            for (i = 0; i < nbSamples; i++)
+            {
+                Real dPhi = out[i] - prevPhase;
+                prevPhase = out[i];
+
+                if (dPhi < -1.0f) {
+                    dPhi += 2.0f;
+                } else if (dPhi > 1.0f) {
+                    dPhi -= 2.0f;
+                }
+
+                out[i] = dPhi;
+            }
+
+            m_prevArg = prevPhase * M_PI;
+        }
+        break;
+    default:
+        for (i = 0; i < nbSamples; i++) {
+            out[i] = run(samples[i]);
+        }
+        break;
+    }
+}
+
+void Projector::magSqBlock(const Sample *samples, int nbSamples, Real *out)
+{
+    int i = projectSIMD(ProjectionMagSq, samples, nbSamples, out);
+
+    for (; i < nbSamples; i++)
+    {
+        Real re = samples[i].m_real / SDR_RX_SCALEF;
+        Real im = samples[i].m_imag / SDR_RX_SCALEF;
+        out[i] = re*re + im*im;
+    }
+}
+
+void Projector::dBBlock(const Real *magsq, int nbValues, Real *out)
+{
+    int i = dBSIMD(magsq, nbValues, out);
+
+    for (; i < nbValues; i++) {
+        out[i] = log10f(magsq[i]) * 10.0f;
+    }
+}
+
+Real Projector::atan2Approx(Real y, Real x)
+{
+    // Abramowitz and Stegun 4.4.49 on [0,1] then octant folding. Error is less than 1e-5 radians.
+    Real ax = std::fabs(x);
+    Real ay = std::fabs(y);
+    Real mx = std::max(ax, ay);
+    Real a = mx == 0.0f ? 0.0f : std::min(ax, ay) / mx;
+    Real s = a*a;
+    Real r = a*(0.9998660f + s*(-0.3302995f + s*(0.1801410f + s*(-0.0851330f + s*0.0208351f))));
+    r = ay > ax ? (Real) (M_PI/2) - r : r;
+    r = x < 0.0f ? (Real) M_PI - r : r;
+    return y < 0.0f ? -r : r;
+}
+
+#if defined(USE_SSE2)
+static inline void loadSamplesSIMD(const Sample *samples, __m128& re, __m128& im)
+{
+#ifdef SDR_RX_SAMPLE_24BIT
+    __m128 lo = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*) samples));       // I0 Q0 I1 Q1
+    __m128 hi = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*) (samples + 2))); // I2 Q2 I3 Q3
+    re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2,0,2,0));
+    im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3,1,3,1));
+#else
+    __m128i v = _mm_loadu_si128((const __m128i*) samples); // 32 bit lanes of Q:I
+    re = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(v, 16), 16));
+    im = _mm_cvtepi32_ps(_mm_srai_epi32(v, 16));
+#endif
+    const __m128 scale = _mm_set1_ps(1.0f / SDR_RX_SCALEF);
+    re = _mm_mul_ps(re, scale);
+    im = _mm_mul_ps(im, scale);
+}
+
+static inline __m128 atan2SIMD(__m128 y, __m128 x)
+{
+    const __m128 signMask = _mm_set1_ps(-0.0f);
+    __m128 ax = _mm_andnot_ps(signMask, x);
+    __m128 ay = _mm_andnot_ps(signMask, y);
+    __m128 mx = _mm_max_ps(ax, ay);
+    __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), _mm_max_ps(mx, _mm_set1_ps(1e-30f)));
+    __m128 s = _mm_mul_ps(a, a);
+    __m128 r = _mm_add_ps(_mm_set1_ps(-0.0851330f), _mm_mul_ps(s, _mm_set1_ps(0.0208351f)));
+    r = _mm_add_ps(_mm_set1_ps(0.1801410f), _mm_mul_ps(s, r));
+    r = _mm_add_ps(_mm_set1_ps(-0.3302995f), _mm_mul_ps(s, r));
+    r = _mm_mul_ps(a, _mm_add_ps(_mm_set1_ps(0.9998660f), _mm_mul_ps(s, r)));
+    __m128 swap = _mm_cmpgt_ps(ay, ax);
+    r = _mm_or_ps(_mm_and_ps(swap, _mm_sub_ps(_mm_set1_ps(M_PI/2), r)), _mm_andnot_ps(swap, r));
+    __m128 negX = _mm_cmplt_ps(x, _mm_setzero_ps());
+    r = _mm_or_ps(_mm_and_ps(negX, _mm_sub_ps(_mm_set1_ps(M_PI), r)), _mm_andnot_ps(negX, r));
+    return _mm_or_ps(r, _mm_and_ps(y, signMask)); // r is positive so this copies the sign of y
+}
+
+static inline __m128 dBSIMD4(__m128 x)
+{
+    // x = m.2^e with m in [sqrt(2)/2, sqrt(2)) and ln(m) = 2 atanh(t) with t = (m-1)/(m+1) so that |t| < 0.172
+    __m128i xi = _mm_castps_si128(x);
+    __m128i e = _mm_sub_epi32(_mm_srli_epi32(xi, 23), _mm_set1_epi32(127));
+    __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(xi, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+    __m128 big = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356f));
+    m = _mm_or_ps(_mm_and_ps(big, _mm_mul_ps(m, _mm_set1_ps(0.5f))), _mm_andnot_ps(big, m));
+    e = _mm_sub_epi32(e, _mm_castps_si128(big)); // mask is -1 when m was halved
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 t = _mm_div_ps(_mm_sub_ps(m, one), _mm_add_ps(m, one));
+    __m128 t2 = _mm_mul_ps(t, t);
+    __m128 p = _mm_add_ps(_mm_set1_ps(1.0f/7.0f), _mm_mul_ps(t2, _mm_set1_ps(1.0f/9.0f)));
+    p = _mm_add_ps(_mm_set1_ps(1.0f/5.0f), _mm_mul_ps(t2, p));
+    p = _mm_add_ps(_mm_set1_ps(1.0f/3.0f), _mm_mul_ps(t2, p));
+    p = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(2.0f), t), _mm_add_ps(one, _mm_mul_ps(t2, p)));
+    __m128 ln = _mm_add_ps(p, _mm_mul_ps(_mm_cvtepi32_ps(e), _mm_set1_ps(0.693147181f)));
+    __m128 dB = _mm_mul_ps(ln, _mm_set1_ps(4.34294482f)); // 10/ln(10)
+    __m128 zero = _mm_cmpeq_ps(x, _mm_setzero_ps());
+    return _mm_or_ps(_mm_and_ps(zero, _mm_set1_ps(-INFINITY)), _mm_andnot_ps(zero, dB));
+}
+
+int Projector::dBSIMD(const Real *magsq, int nbValues, Real *out)
+{
+    int i = 0;
+
+    for (; i + 4 <= nbValues; i += 4) {
+        _mm_storeu_ps(out + i, dBSIMD4(_mm_loadu_ps(magsq + i)));
+    }
+
+    return i;
+}
+
+int Projector::projectSIMD(ProjectionType projectionType, const Sample *samples, int nbSamples, Real *out)
+{
+    int i = 0;
+    __m128 re, im;
+
+    switch (projectionType)
+    {
+    case ProjectionReal:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            _mm_storeu_ps(out + i, re);
+        }
+        break;
+    case ProjectionImag:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            _mm_storeu_ps(out + i, im);
+        }
+        break;
+    case ProjectionMagLin:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            _mm_storeu_ps(out + i, _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im))));
+        }
+        break;
+    case ProjectionMagSq:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            _mm_storeu_ps(out + i, _mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im)));
+        }
+        break;
+    case ProjectionPhase:
+    {
+        const __m128 invPi = _mm_set1_ps(1.0f / M_PI);
+
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            _mm_storeu_ps(out + i, _mm_mul_ps(atan2SIMD(im, re), invPi));
+        }
+    }
+        break;
+    default:
+        break;
+    }
+
+    return i;
+}
+#elif defined(USE_NEON)
+static inline void loadSamplesSIMD(const Sample *samples, float32x4_t& re, float32x4_t& im)
+{
+#ifdef SDR_RX_SAMPLE_24BIT
+    int32x4x2_t v = vld2q_s32((const int32_t*) samples);
+    re = vcvtq_f32_s32(v.val[0]);
+    im = vcvtq_f32_s32(v.val[1]);
+#else
+    int16x4x2_t v = vld2_s16((const int16_t*) samples);
+    re = vcvtq_f32_s32(vmovl_s16(v.val[0]));
+    im = vcvtq_f32_s32(vmovl_s16(v.val[1]));
+#endif
+    re = vmulq_n_f32(re, 1.0f / SDR_RX_SCALEF);
+    im = vmulq_n_f32(im, 1.0f / SDR_RX_SCALEF);
+}
+
+static inline float32x4_t atan2SIMD(float32x4_t y, float32x4_t x)
+{
+    float32x4_t ax = vabsq_f32(x);
+    float32x4_t ay = vabsq_f32(y);
+    float32x4_t mx = vmaxq_f32(vmaxq_f32(ax, ay), vdupq_n_f32(1e-30f));
+    float32x4_t inv = vrecpeq_f32(mx); // reciprocal estimate refined twice
+    inv = vmulq_f32(vrecpsq_f32(mx, inv), inv);
+    inv = vmulq_f32(vrecpsq_f32(mx, inv), inv);
+    float32x4_t a = vmulq_f32(vminq_f32(ax, ay), inv);
+    float32x4_t s = vmulq_f32(a, a);
+    float32x4_t r = vmlaq_f32(vdupq_n_f32(-0.0851330f), s, vdupq_n_f32(0.0208351f));
+    r = vmlaq_f32(vdupq_n_f32(0.1801410f), s, r);
+    r = vmlaq_f32(vdupq_n_f32(-0.3302995f), s, r);
+    r = vmulq_f32(a, vmlaq_f32(vdupq_n_f32(0.9998660f), s, r));
+    r = vbslq_f32(vcgtq_f32(ay, ax), vsubq_f32(vdupq_n_f32(M_PI/2), r), r);
+    r = vbslq_f32(vcltq_f32(x, vdupq_n_f32(0.0f)), vsubq_f32(vdupq_n_f32(M_PI), r), r);
+    uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(y), vdupq_n_u32(0x80000000));
+    return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(r), sign)); // r is positive so this copies the sign of y
+}
+
+static inline float32x4_t sqrtSIMD(float32x4_t x)
+{
+    float32x4_t e = vrsqrteq_f32(x); // reciprocal square root estimate refined twice
+    e = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, e), e), e);
+    e = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, e), e), e);
+    return vbslq_f32(vceqq_f32(x, vdupq_n_f32(0.0f)), x, vmulq_f32(x, e));
+}
+
+static inline float32x4_t dBSIMD4(float32x4_t x)
+{
+    // x = m.2^e with m in [sqrt(2)/2, sqrt(2)) and ln(m) = 2 atanh(t) with t = (m-1)/(m+1) so that |t| < 0.172
+    uint32x4_t xi = vreinterpretq_u32_f32(x);
+    int32x4_t e = vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(xi, 23)), vdupq_n_s32(127));
+    float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(xi, vdupq_n_u32(0x007FFFFF)), vdupq_n_u32(0x3F800000)));
+    uint32x4_t big = vcgtq_f32(m, vdupq_n_f32(1.41421356f));
+    m = vbslq_f32(big, vmulq_n_f32(m, 0.5f), m);
+    e = vsubq_s32(e, vreinterpretq_s32_u32(big)); // mask is -1 when m was halved
+    float32x4_t one = vdupq_n_f32(1.0f);
+    float32x4_t den = vaddq_f32(m, one);
+    float32x4_t inv = vrecpeq_f32(den); // reciprocal estimate refined twice
+    inv = vmulq_f32(vrecpsq_f32(den, inv), inv);
+    inv = vmulq_f32(vrecpsq_f32(den, inv), inv);
+    float32x4_t t = vmulq_f32(vsubq_f32(m, one), inv);
+    float32x4_t t2 = vmulq_f32(t, t);
+    float32x4_t p = vmlaq_f32(vdupq_n_f32(1.0f/7.0f), t2, vdupq_n_f32(1.0f/9.0f));
+    p = vmlaq_f32(vdupq_n_f32(1.0f/5.0f), t2, p);
+    p = vmlaq_f32(vdupq_n_f32(1.0f/3.0f), t2, p);
+    p = vmulq_f32(vmulq_n_f32(t, 2.0f), vmlaq_f32(one, t2, p));
+    float32x4_t ln = vmlaq_f32(p, vcvtq_f32_s32(e), vdupq_n_f32(0.693147181f));
+    float32x4_t dB = vmulq_n_f32(ln, 4.34294482f); // 10/ln(10)
+    return vbslq_f32(vceqq_f32(x, vdupq_n_f32(0.0f)), vdupq_n_f32(-INFINITY), dB);
+}
+
+int Projector::dBSIMD(const Real *magsq, int nbValues, Real *out)
+{
+    int i = 0;
+
+    for (; i + 4 <= nbValues; i += 4) {
+        vst1q_f32(out + i, dBSIMD4(vld1q_f32(magsq + i)));
+    }
+
+    return i;
+}
+
+int Projector::projectSIMD(ProjectionType projectionType, const Sample *samples, int nbSamples, Real *out)
+{
+    int i = 0;
+    float32x4_t re, im;
+
+    switch (projectionType)
+    {
+    case ProjectionReal:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            vst1q_f32(out + i, re);
+        }
+        break;
+    case ProjectionImag:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            vst1q_f32(out + i, im);
+        }
+        break;
+    case ProjectionMagLin:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            vst1q_f32(out + i, sqrtSIMD(vmlaq_f32(vmulq_f32(re, re), im, im)));
+        }
+        break;
+    case ProjectionMagSq:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            vst1q_f32(out + i, vmlaq_f32(vmulq_f32(re, re), im, im));
+        }
+        break;
+    case ProjectionPhase:
+        for (; i + 4 <= nbSamples; i += 4)
+        {
+            loadSamplesSIMD(samples + i, re, im);
+            vst1q_f32(out + i, vmulq_n_f32(atan2SIMD(im, re), 1.0f / M_PI));
+        }
+        break;
+    default:
+        break;
+    }
+
+    return i;
+}
+#else
+int Projector::projectSIMD(ProjectionType projectionType, const Sample *samples, int nbSamples, Real *out)
+{
+    (void) projectionType;
+    (void) samples;
+    (void) nbSamples;
+    (void) out;
+    return 0;
+}
+
+int Projector::dBSIMD(const Real *magsq, int nbValues, Real *out)
+{
+    (void) magsq;
+    (void) nbValues;
+    (void) out;
+    return 0;
+}
+#endif
@@ -49,9 +49,20 @@ public:
     void setCacheMaster(bool cacheMaster) { m_cacheMaster = cacheMaster; }
 
     Real run(const Sample& s);
+    /**
+     * Project a block of samples. Real, imaginary, magnitude, power and phase based projections (phase, phase derivative)
+     * use SIMD kernels when available the others are processed sample by sample with run().
+     * Phase is approximated within about 1e-5 radians.
+     */
+    void runBlock(const Sample *samples, int nbSamples, Real *out);
+    static void magSqBlock(const Sample *samples, int nbSamples, Real *out); //!< squared magnitude only
+    static void dBBlock(const Real *magsq, int nbValues, Real *out);         //!< squared magnitude to dB (out may be magsq)
 
 private:
     static Real normalizeAngle(Real angle);
+    static Real atan2Approx(Real y, Real x);
+    static int projectSIMD(ProjectionType projectionType, const Sample *samples, int nbSamples, Real *out);
+    static int dBSIMD(const Real *magsq, int nbValues, Real *out);
     ProjectionType m_projectionType;
     Real m_prevArg;
     Real *m_cache;
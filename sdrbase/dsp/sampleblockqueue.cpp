@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QMutexLocker>
+
+#include "sampleblockqueue.h"
+
+SampleBlockQueue::Pool::~Pool()
+{
+    for (std::vector<SampleVector*>::iterator it = m_free.begin(); it != m_free.end(); ++it) {
+        delete *it;
+    }
+}
+
+SampleBlockQueue::SampleBlockQueue(unsigned int maxBlocks, QObject* parent) :
+    QObject(parent),
+    m_pool(new Pool(maxBlocks + 2)), // queued blocks plus the ones being produced and consumed
+    m_maxBlocks(maxBlocks),
+    m_droppedSamples(0)
+{}
+
+SampleBlockQueue::~SampleBlockQueue()
+{
+    clear();
+}
+
+SampleBlock SampleBlockQueue::allocate()
+{
+    SampleVector *samples = nullptr;
+
+    {
+        QMutexLocker mutexLocker(&m_pool->m_mutex);
+
+        if (m_pool->m_free.size() > 0)
+        {
+            samples = m_pool->m_free.back();
+            m_pool->m_free.pop_back();
+        }
+    }
+
+    if (!samples) {
+        samples = new SampleVector();
+    }
+
+    std::shared_ptr<Pool> pool = m_pool;
+
+    return SampleBlock(samples, [pool](SampleVector *released) {
+        QMutexLocker mutexLocker(&pool->m_mutex);
+
+        if (pool->m_free.size() < pool->m_maxFree) {
+            pool->m_free.push_back(released); // keeps its capacity
+        } else {
+            delete released;
+        }
+    });
+}
+
+void SampleBlockQueue::push(SampleVector& samples)
+{
+    if (samples.size() == 0) {
+        return;
+    }
+
+    SampleBlock block = allocate();
+    block->swap(samples);
+    samples.clear();
+    enqueue(block);
+}
+
+void SampleBlockQueue::push(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (begin == end) {
+        return;
+    }
+
+    SampleBlock block = allocate();
+    block->assign(begin, end);
+    enqueue(block);
+}
+
+void SampleBlockQueue::enqueue(const SampleBlock& block)
+{
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+
+        while (m_blocks.size() >= m_maxBlocks)
+        {
+            m_droppedSamples.fetch_add(m_blocks.front()->size(), std::memory_order_relaxed);
+            m_blocks.pop_front();
+        }
+
+        m_blocks.push_back(block);
+    }
+
+    emit dataReady();
+}
+
+SampleBlock SampleBlockQueue::pop()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_blocks.size() == 0) {
+        return SampleBlock();
+    }
+
+    SampleBlock block = m_blocks.front();
+    m_blocks.pop_front();
+    return block;
+}
+
+unsigned int SampleBlockQueue::size()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_blocks.size();
+}
+
+void SampleBlockQueue::clear()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_blocks.clear();
+}
@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SAMPLEBLOCKQUEUE_H_
+#define SDRBASE_DSP_SAMPLEBLOCKQUEUE_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <QObject>
+#include <QMutex>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+typedef std::shared_ptr<SampleVector> SampleBlock;
+
+/**
+ * Queue of reference counted sample blocks handed over from a producer thread to a consumer thread
+ * without copying the samples into a ring. A producer that owns its sample vector gives its contents
+ * by swapping with a recycled vector. The block vector goes back to the pool when the last reference
+ * to the block is released, whatever the thread.
+ * When the consumer does not keep up the oldest blocks are dropped beyond m_maxBlocks.
+ */
+class SDRBASE_API SampleBlockQueue : public QObject
+{
+    Q_OBJECT
+public:
+    SampleBlockQueue(unsigned int maxBlocks = 64, QObject* parent = nullptr);
+    ~SampleBlockQueue();
+
+    void push(SampleVector& samples); //!< takes the samples. samples is left empty with recycled capacity
+    void push(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end); //!< copies the samples
+    SampleBlock pop();                //!< null when the queue is empty
+    unsigned int size();
+    void clear();
+    uint64_t getDroppedSamples() const { return m_droppedSamples.load(std::memory_order_relaxed); }
+
+signals:
+    void dataReady();
+
+private:
+    struct Pool
+    {
+        QMutex m_mutex;
+        std::vector<SampleVector*> m_free;
+        unsigned int m_maxFree;
+
+        Pool(unsigned int maxFree) : m_maxFree(maxFree) {}
+        ~Pool();
+    };
+
+    std::shared_ptr<Pool> m_pool; //!< shared with the blocks so that it outlives the queue while blocks are in use
+    QMutex m_mutex;
+    std::deque<SampleBlock> m_blocks;
+    unsigned int m_maxBlocks;
+    std::atomic<uint64_t> m_droppedSamples;
+
+    SampleBlock allocate();
+    void enqueue(const SampleBlock& block);
+};
+
+#endif // SDRBASE_DSP_SAMPLEBLOCKQUEUE_H_
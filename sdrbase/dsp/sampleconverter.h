@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SAMPLECONVERTER_H_
+#define SDRBASE_DSP_SAMPLECONVERTER_H_
+
+#include <stdint.h>
+#include <type_traits>
+#if defined(USE_SSE2)
+#include <emmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "dsp/dsptypes.h"
+
+/**
+ * Vector load of 8 interleaved I/Q values as 16 bit integers. Only the common device
+ * sample types are vectorized: signed 16 bit (8 to 16 significant bits), signed and
+ * unsigned 8 bit.
+ */
+template<typename T>
+struct SampleConverterLoad
+{
+    static const bool simd = false;
+};
+
+#if defined(USE_SSE2)
+template<>
+struct SampleConverterLoad<qint16>
+{
+    static const bool simd = true;
+    static __m128i load8(const qint16 *buf) { return _mm_loadu_si128((const __m128i*) buf); }
+};
+
+template<>
+struct SampleConverterLoad<qint8>
+{
+    static const bool simd = true;
+    static __m128i load8(const qint8 *buf)
+    {
+        __m128i x = _mm_loadl_epi64((const __m128i*) buf);
+        return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8); // sign extension
+    }
+};
+
+template<>
+struct SampleConverterLoad<quint8>
+{
+    static const bool simd = true;
+    static __m128i load8(const quint8 *buf)
+    {
+        __m128i x = _mm_loadl_epi64((const __m128i*) buf);
+        return _mm_unpacklo_epi8(x, _mm_setzero_si128());
+    }
+};
+#elif defined(USE_NEON)
+template<>
+struct SampleConverterLoad<qint16>
+{
+    static const bool simd = true;
+    static int16x8_t load8(const qint16 *buf) { return vld1q_s16(buf); }
+};
+
+template<>
+struct SampleConverterLoad<qint8>
+{
+    static const bool simd = true;
+    static int16x8_t load8(const qint8 *buf) { return vmovl_s8(vld1_s8(buf)); }
+};
+
+template<>
+struct SampleConverterLoad<quint8>
+{
+    static const bool simd = true;
+    static int16x8_t load8(const quint8 *buf) { return vreinterpretq_s16_u16(vmovl_u8(vld1_u8(buf))); }
+};
+#endif
+
+/**
+ * Conversion of interleaved integer I/Q device samples to Sample. Offset is subtracted
+ * (unsigned samples) then values are shifted left by Shift to the internal sample size.
+ * This is the no decimation case of the integer decimators.
+ */
+template<typename T, int Offset, uint Shift, bool IQOrder>
+struct SampleConverter
+{
+    static void convert(const T* buf, Sample* out, int nbSamples)
+    {
+        int i = convertSIMD(buf, out, nbSamples, std::integral_constant<bool, SampleConverterLoad<T>::simd>());
+
+        for (; i < nbSamples; i++)
+        {
+            qint32 xreal = IQOrder ? buf[2*i] - Offset : buf[2*i+1] - Offset;
+            qint32 yimag = IQOrder ? buf[2*i+1] - Offset : buf[2*i] - Offset;
+            out[i].setReal(xreal << Shift);
+            out[i].setImag(yimag << Shift);
+        }
+    }
+
+    static void convertScalar(const T* buf, Sample* out, int nbSamples) //!< reference implementation
+    {
+        for (int i = 0; i < nbSamples; i++)
+        {
+            qint32 xreal = IQOrder ? buf[2*i] - Offset : buf[2*i+1] - Offset;
+            qint32 yimag = IQOrder ? buf[2*i+1] - Offset : buf[2*i] - Offset;
+            out[i].setReal(xreal << Shift);
+            out[i].setImag(yimag << Shift);
+        }
+    }
+
+private:
+    static int convertSIMD(const T*, Sample*, int, std::false_type) { return 0; }
+
+#if defined(USE_SSE2)
+    static int convertSIMD(const T* buf, Sample* out, int nbSamples, std::true_type)
+    {
+        const __m128i offset = _mm_set1_epi16(Offset);
+        int i = 0;
+
+        for (; i + 4 <= nbSamples; i += 4) // 4 I/Q pairs
+        {
+            __m128i v = _mm_sub_epi16(SampleConverterLoad<T>::load8(buf + 2*i), offset);
+
+            if (!IQOrder) { // swap I and Q
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2,3,0,1)), _MM_SHUFFLE(2,3,0,1));
+            }
+#ifdef SDR_RX_SAMPLE_24BIT
+            __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+            __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+            _mm_storeu_si128((__m128i*) &out[i], _mm_slli_epi32(lo, Shift));
+            _mm_storeu_si128((__m128i*) &out[i+2], _mm_slli_epi32(hi, Shift));
+#else
+            _mm_storeu_si128((__m128i*) &out[i], _mm_slli_epi16(v, Shift));
+#endif
+        }
+
+        return i;
+    }
+#elif defined(USE_NEON)
+    static int convertSIMD(const T* buf, Sample* out, int nbSamples, std::true_type)
+    {
+        const int16x8_t offset = vdupq_n_s16(Offset);
+        int i = 0;
+
+        for (; i + 4 <= nbSamples; i += 4) // 4 I/Q pairs
+        {
+            int16x8_t v = vsubq_s16(SampleConverterLoad<T>::load8(buf + 2*i), offset);
+
+            if (!IQOrder) { // swap I and Q
+                v = vrev32q_s16(v);
+            }
+#ifdef SDR_RX_SAMPLE_24BIT
+            vst1q_s32((int32_t*) &out[i], vshlq_n_s32(vmovl_s16(vget_low_s16(v)), Shift));
+            vst1q_s32((int32_t*) &out[i+2], vshlq_n_s32(vmovl_s16(vget_high_s16(v)), Shift));
+#else
+            vst1q_s16((int16_t*) &out[i], vshlq_n_s16(v, Shift));
+#endif
+        }
+
+        return i;
+    }
+#endif
+};
+
+#endif // SDRBASE_DSP_SAMPLECONVERTER_H_
@@ -16,19 +16,37 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <new>
+
 #include "samplesinkfifo.h"
+#include "pipelinemetrics.h"
 
 //#define MIN(x, y) (((x) < (y)) ? (x) : (y))
 
-void SampleSinkFifo::create(unsigned int s)
+std::atomic<bool> SampleSinkFifo::m_blockingWrites(false);
+
+bool SampleSinkFifo::create(unsigned int s)
 {
+	unsigned int size = m_size;
 	m_size = 0;
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_writeReserved = 0;
+
+	try
+	{
+		m_data.resize(m_hasWriteOverflow ? s + writeOverflowSize(s) : s);
+	}
+	catch (const std::bad_alloc&)
+	{
+		qCritical("SampleSinkFifo::create: cannot allocate %u samples", s);
+		m_size = size; // the previous buffer is kept
+		return false;
+	}
 
-	m_data.resize(s);
-	m_size = m_data.size();
+	m_size = s;
+	return true;
 }
 
 void SampleSinkFifo::reset()
@@ -37,6 +55,43 @@ void SampleSinkFifo::reset()
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	releaseSpace();
+}
+
+// Called with the mutex held by mutexLocker. The mutex is released while dataReady is signalled.
+void SampleSinkFifo::waitForSpace(QMutexLocker& mutexLocker, unsigned int count)
+{
+	if (!m_blockingWrites.load(std::memory_order_relaxed)) {
+		return;
+	}
+
+	QElapsedTimer waitTimer;
+	waitTimer.start();
+	unsigned int needed = std::min(count, m_size);
+
+	while ((m_size - m_fill < needed) && (waitTimer.elapsed() < (qint64) m_blockingWriteTimeoutMs))
+	{
+		if (m_fill > 0)
+		{
+			mutexLocker.unlock();
+			emit dataReady(); // make sure the consumer is aware of pending data
+			mutexLocker.relock();
+
+			if (m_size - m_fill >= needed) { // consumer was quick enough
+				break;
+			}
+		}
+
+		m_spaceAvailable.wait(&m_mutex, 100);
+	}
+}
+
+// Called with the mutex held
+void SampleSinkFifo::releaseSpace()
+{
+	if (m_blockingWrites.load(std::memory_order_relaxed)) {
+		m_spaceAvailable.wakeAll();
+	}
 }
 
 SampleSinkFifo::SampleSinkFifo(QObject* parent) :
@@ -48,6 +103,11 @@ SampleSinkFifo::SampleSinkFifo(QObject* parent) :
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_writeReserved = 0;
+	m_writeInPlace = false;
+	m_hasWriteOverflow = false;
+	m_readReserved = false;
+	m_pendingSize = 0;
 }
 
 SampleSinkFifo::SampleSinkFifo(int size, QObject* parent) :
@@ -55,6 +115,10 @@ SampleSinkFifo::SampleSinkFifo(int size, QObject* parent) :
 	m_data()
 {
 	m_suppressed = -1;
+	m_writeInPlace = false;
+	m_hasWriteOverflow = false;
+	m_readReserved = false;
+	m_pendingSize = 0;
 	create(size);
 }
 
@@ -63,10 +127,15 @@ SampleSinkFifo::SampleSinkFifo(const SampleSinkFifo& other) :
     m_data(other.m_data)
 {
   	m_suppressed = -1;
-	m_size = m_data.size();
+	m_size = other.m_size;
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
+	m_writeReserved = 0;
+	m_writeInPlace = false;
+	m_hasWriteOverflow = other.m_hasWriteOverflow;
+	m_readReserved = false;
+	m_pendingSize = 0;
 }
 
 SampleSinkFifo::~SampleSinkFifo()
@@ -77,9 +146,28 @@ SampleSinkFifo::~SampleSinkFifo()
 
 bool SampleSinkFifo::setSize(int size)
 {
-	create(size);
+	QMutexLocker mutexLocker(&m_mutex);
+	m_pendingSize = size;
+
+	return applyPendingSize();
+}
+
+// Called with the mutex held. The buffer is reallocated only when the consumer or an in place
+// producer does not hold iterators into it. Otherwise this is done by readCommit or writeCommit.
+// Returns false if the buffer could not be allocated.
+bool SampleSinkFifo::applyPendingSize()
+{
+	if ((m_pendingSize == 0) || m_readReserved || ((m_writeReserved != 0) && m_writeInPlace)) {
+		return true;
+	}
+
+	unsigned int writeReserved = m_writeReserved; // a reservation in the intermediate buffer stays valid
+	bool created = create(m_pendingSize);
+	m_writeReserved = writeReserved;
+	m_pendingSize = 0;
+	releaseSpace();
 
-	return m_data.size() == (unsigned int)size;
+	return created;
 }
 
 unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
@@ -91,6 +179,7 @@ unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 	const Sample* begin = (const Sample*)data;
 	count /= sizeof(Sample);
 
+	waitForSpace(mutexLocker, count);
 	total = std::min(count, m_size - m_fill);
 
     if (total < count)
@@ -116,6 +205,7 @@ unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 		}
 	}
 
+	updateMetrics(count, total);
 	remaining = total;
 
     while (remaining > 0)
@@ -129,7 +219,10 @@ unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 		remaining -= len;
 	}
 
-	if (m_fill > 0) {
+	bool hasData = m_fill > 0;
+	mutexLocker.unlock();
+
+	if (hasData) {
 		emit dataReady();
     }
 
@@ -144,6 +237,7 @@ unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVec
 	unsigned int remaining;
 	unsigned int len;
 
+	waitForSpace(mutexLocker, count);
 	total = std::min(count, m_size - m_fill);
 
     if (total < count)
@@ -169,6 +263,7 @@ unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVec
 		}
 	}
 
+	updateMetrics(count, total);
 	remaining = total;
 
     while (remaining > 0)
@@ -182,13 +277,112 @@ unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVec
 		remaining -= len;
 	}
 
-	if (m_fill > 0) {
+	bool hasData = m_fill > 0;
+	mutexLocker.unlock();
+
+	if (hasData) {
 		emit dataReady();
     }
 
 	return total;
 }
 
+void SampleSinkFifo::updateMetrics(unsigned int count, unsigned int total)
+{
+	if (!PipelineMetrics::isEnabled()) {
+		return;
+	}
+
+	PipelineMetrics *metrics = PipelineMetrics::instance();
+	metrics->addSamples(PipelineMetrics::StageSampleFifo, total);
+	metrics->updateFill(PipelineMetrics::StageSampleFifo, m_fill + total, m_size);
+
+	if (total < count) {
+		metrics->addOverflow(PipelineMetrics::StageSampleFifo);
+	}
+}
+
+SampleVector::iterator SampleSinkFifo::writeBegin(unsigned int count)
+{
+	QMutexLocker mutexLocker(&m_mutex);
+
+	waitForSpace(mutexLocker, count);
+
+	if (PipelineMetrics::isEnabled()) {
+		m_writeTimer.start();
+	}
+
+	// allocate the overflow area on first use. Growing the buffer moves it so this cannot be
+	// done while the consumer holds iterators: the intermediate buffer is used meanwhile.
+	if (!m_hasWriteOverflow && !m_readReserved)
+	{
+		m_data.resize(m_size + writeOverflowSize(m_size));
+		m_hasWriteOverflow = true;
+	}
+
+	m_writeReserved = count;
+	m_writeTail = m_tail;
+	// the area past the tail is free up to the head and nobody reads past m_size
+	m_writeInPlace = (m_size > 0) && (count <= m_size - m_fill) && (m_tail + count <= m_data.size());
+
+	if (m_writeInPlace) {
+		return m_data.begin() + m_tail;
+	}
+
+	if (m_writeBuffer.size() < count) {
+		m_writeBuffer.resize(count);
+	}
+
+	return m_writeBuffer.begin();
+}
+
+unsigned int SampleSinkFifo::writeCommit(unsigned int count)
+{
+	if (count > m_writeReserved)
+	{
+		qCritical("SampleSinkFifo::writeCommit: cannot commit more than reserved samples");
+		count = m_writeReserved;
+	}
+
+	if (PipelineMetrics::isEnabled() && m_writeTimer.isValid())
+	{
+		PipelineMetrics::instance()->addBlock(PipelineMetrics::StageDeviceWorker, count, m_writeTimer.nsecsElapsed());
+		m_writeTimer.invalidate();
+	}
+
+	if (!m_writeInPlace)
+	{
+		m_writeReserved = 0;
+		return write(m_writeBuffer.begin(), m_writeBuffer.begin() + count);
+	}
+
+	QMutexLocker mutexLocker(&m_mutex);
+	m_writeReserved = 0;
+
+	if (m_tail != m_writeTail) // FIFO was reset meanwhile
+	{
+		applyPendingSize();
+		return 0;
+	}
+
+	if (m_tail + count > m_size) { // move the part written past the end of the ring to its start
+		std::copy(m_data.begin() + m_size, m_data.begin() + m_tail + count, m_data.begin());
+	}
+
+	updateMetrics(count, count);
+	m_tail = (m_tail + count) % m_size;
+	m_fill += count;
+	applyPendingSize();
+	bool hasData = m_fill > 0;
+	mutexLocker.unlock();
+
+	if (hasData) {
+		emit dataReady();
+	}
+
+	return count;
+}
+
 unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::iterator end)
 {
 	QMutexLocker mutexLocker(&m_mutex);
@@ -199,8 +393,13 @@ unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::it
 
 	total = std::min(count, m_fill);
 
-    if (total < count) {
+    if (total < count)
+    {
 		qCritical("SampleSinkFifo::read: underflow - missing %u samples", count - total);
+
+		if (PipelineMetrics::isEnabled()) {
+			PipelineMetrics::instance()->addUnderrun(PipelineMetrics::StageSampleFifo);
+		}
     }
 
 	remaining = total;
@@ -216,6 +415,8 @@ unsigned int SampleSinkFifo::read(SampleVector::iterator begin, SampleVector::it
 		remaining -= len;
 	}
 
+	releaseSpace();
+
 	return total;
 }
 
@@ -230,9 +431,15 @@ unsigned int SampleSinkFifo::readBegin(unsigned int count,
 	unsigned int head = m_head;
 
 	total = std::min(count, m_fill);
+	m_readReserved = total > 0;
 
-    if (total < count) {
+    if (total < count)
+    {
 		qCritical("SampleSinkFifo::readBegin: underflow - missing %u samples", count - total);
+
+		if (PipelineMetrics::isEnabled()) {
+			PipelineMetrics::instance()->addUnderrun(PipelineMetrics::StageSampleFifo);
+		}
     }
 
 	remaining = total;
@@ -279,6 +486,9 @@ unsigned int SampleSinkFifo::readCommit(unsigned int count)
 
     m_head = (m_head + count) % m_size;
 	m_fill -= count;
+	m_readReserved = false;
+	releaseSpace();
+	applyPendingSize();
 
 	return count;
 }
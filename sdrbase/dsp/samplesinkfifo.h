@@ -19,8 +19,11 @@
 #ifndef INCLUDE_SAMPLEFIFO_H
 #define INCLUDE_SAMPLEFIFO_H
 
+#include <atomic>
+
 #include <QObject>
 #include <QMutex>
+#include <QWaitCondition>
 #include <QElapsedTimer>
 #include "dsp/dsptypes.h"
 #include "export.h"
@@ -30,6 +33,7 @@ class SDRBASE_API SampleSinkFifo : public QObject {
 
 private:
 	QMutex m_mutex;
+	QWaitCondition m_spaceAvailable;
 	QElapsedTimer m_msgRateTimer;
 	int m_suppressed;
 
@@ -40,7 +44,25 @@ private:
 	unsigned int m_head;
 	unsigned int m_tail;
 
-	void create(unsigned int s);
+	SampleVector m_writeBuffer;   //!< used by writeBegin when samples cannot be written in place
+	unsigned int m_writeReserved; //!< size of the pending writeBegin reservation
+	unsigned int m_writeTail;     //!< tail at the time of the pending reservation
+	bool m_writeInPlace;          //!< pending reservation is in the FIFO memory
+	bool m_hasWriteOverflow;      //!< overflow area is allocated. Only FIFOs used with writeBegin get it
+	bool m_readReserved;          //!< readBegin returned samples that are not committed yet
+	unsigned int m_pendingSize;   //!< size to apply once the buffer is not used outside the lock (0: none)
+	QElapsedTimer m_writeTimer;   //!< producer processing time between writeBegin and writeCommit
+
+	static std::atomic<bool> m_blockingWrites;
+	static const unsigned long m_blockingWriteTimeoutMs = 2000;
+	static const unsigned int m_maxWriteOverflow = 1<<18; //!< samples past the end of the ring for in place writes
+
+	bool create(unsigned int s);
+	static unsigned int writeOverflowSize(unsigned int s) { return s < m_maxWriteOverflow ? s : m_maxWriteOverflow; }
+	void waitForSpace(QMutexLocker& mutexLocker, unsigned int count);
+	void updateMetrics(unsigned int count, unsigned int total);
+	void releaseSpace();
+	bool applyPendingSize();
 
 public:
 	SampleSinkFifo(QObject* parent = nullptr);
@@ -48,7 +70,7 @@ public:
     SampleSinkFifo(const SampleSinkFifo& other);
 	~SampleSinkFifo();
 
-	bool setSize(int size);
+	bool setSize(int size); //!< false if the buffer cannot be allocated. Deferred while the buffer is reserved
     void reset();
 	inline unsigned int size() const { return m_size; }
 	inline unsigned int fill() { QMutexLocker mutexLocker(&m_mutex); unsigned int fill = m_fill; return fill; }
@@ -56,6 +78,19 @@ public:
 	unsigned int write(const quint8* data, unsigned int count);
 	unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
 
+	/**
+	 * Reserve room for count samples that the producer writes directly, typically the output of
+	 * the decimators, then call writeCommit with the number of samples actually written (at most
+	 * count). The room is contiguous: samples that go past the end of the ring are moved to its
+	 * start by writeCommit. The overflow area is allocated by the first writeBegin call so that
+	 * FIFOs written with write() only do not pay for it. When there is not enough free space or
+	 * count is larger than the overflow area an intermediate buffer is returned and writeCommit
+	 * copies it like write().
+	 * Only one producer may use this.
+	 */
+	SampleVector::iterator writeBegin(unsigned int count);
+	unsigned int writeCommit(unsigned int count);
+
 	unsigned int read(SampleVector::iterator begin, SampleVector::iterator end);
 
 	unsigned int readBegin(unsigned int count,
@@ -63,6 +98,13 @@ public:
 		SampleVector::iterator* part2Begin, SampleVector::iterator* part2End);
 	unsigned int readCommit(unsigned int count);
     static unsigned int getSizePolicy(unsigned int sampleRate);
+    /**
+     * When set writes wait for the consumer to make room instead of dropping samples so that the
+     * slowest stage paces the whole pipeline. Used for offline processing. The wait is bounded so
+     * that a stopped consumer cannot block the producer forever.
+     */
+    static void setBlockingWrites(bool blockingWrites) { m_blockingWrites.store(blockingWrites); }
+    static bool getBlockingWrites() { return m_blockingWrites.load(); }
 
 signals:
 	void dataReady();
@@ -15,44 +15,129 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <QDateTime>
+#include <QThread>
+
 #include "samplesourcefifo.h"
 
 const unsigned int SampleSourceFifo::m_rwDivisor = 2;
 const unsigned int SampleSourceFifo::m_guardDivisor = 10;
 
 SampleSourceFifo::SampleSourceFifo(QObject *parent) :
-    QObject(parent)
-{}
+    QObject(parent),
+    m_size(0),
+    m_lowGuard(0),
+    m_highGuard(0),
+    m_readAhead(0),
+    m_readAheadSetting(0),
+    m_readHead(0),
+    m_writeHead(0),
+    m_readCount(0),
+    m_suspended(false),
+    m_activeAccesses(0),
+    m_underrunCount(0),
+    m_overrunCount(0),
+    m_readPending(false)
+{
+    for (unsigned int i = 0; i < m_nbUnderrunTimestamps; i++) {
+        m_underrunTimestamps[i].store(0, std::memory_order_relaxed);
+    }
+}
 
 SampleSourceFifo::SampleSourceFifo(unsigned int size, QObject *parent) :
-    QObject(parent)
+    SampleSourceFifo(parent)
 {
     resize(size);
 }
 
+SampleSourceFifo::~SampleSourceFifo()
+{}
+
 void SampleSourceFifo::resize(unsigned int size)
 {
     QMutexLocker mutexLocker(&m_mutex);
+    suspend();
     m_size = size;
     m_lowGuard = m_size / m_guardDivisor;
     m_highGuard = m_size - (m_size/m_guardDivisor);
-    m_midPoint = m_size / m_rwDivisor;
-	m_readCount = 0;
-    m_readHead = 0;
-    m_writeHead = m_midPoint;
+    applyReadAhead();
+    m_readCount.store(0, std::memory_order_relaxed);
+    m_readHead.store(0, std::memory_order_relaxed);
+    m_writeHead.store(m_readAhead, std::memory_order_relaxed);
     m_data.resize(size);
+    resume();
 }
 
 void SampleSourceFifo::reset()
 {
     QMutexLocker mutexLocker(&m_mutex);
-	m_readCount = 0;
-    m_readHead = 0;
-    m_writeHead = m_midPoint;
+    suspend();
+    m_readCount.store(0, std::memory_order_relaxed);
+    m_readHead.store(0, std::memory_order_relaxed);
+    m_writeHead.store(m_readAhead, std::memory_order_relaxed);
+    resume();
 }
 
-SampleSourceFifo::~SampleSourceFifo()
-{}
+void SampleSourceFifo::setReadAhead(unsigned int readAhead)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    suspend();
+    m_readAheadSetting = readAhead;
+    applyReadAhead();
+    unsigned int readHead = m_readHead.load(std::memory_order_relaxed);
+    m_writeHead.store(readHead + m_readAhead < m_size ? readHead + m_readAhead : readHead + m_readAhead - m_size, std::memory_order_relaxed);
+    m_readCount.store(0, std::memory_order_relaxed);
+    resume();
+}
+
+void SampleSourceFifo::applyReadAhead()
+{
+    // keep the target well inside the guards so that normal jitter does not trigger a resync
+    unsigned int minReadAhead = 2*m_lowGuard;
+    unsigned int maxReadAhead = m_highGuard - m_lowGuard;
+
+    if (m_readAheadSetting == 0) {
+        m_readAhead = m_size / m_rwDivisor;
+    } else if (m_readAheadSetting < minReadAhead) {
+        m_readAhead = minReadAhead;
+    } else if (m_readAheadSetting > maxReadAhead) {
+        m_readAhead = maxReadAhead;
+    } else {
+        m_readAhead = m_readAheadSetting;
+    }
+}
+
+bool SampleSourceFifo::beginAccess()
+{
+    m_activeAccesses.fetch_add(1, std::memory_order_acquire);
+
+    if (m_suspended.load(std::memory_order_acquire))
+    {
+        m_activeAccesses.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    return true;
+}
+
+void SampleSourceFifo::endAccess()
+{
+    m_activeAccesses.fetch_sub(1, std::memory_order_release);
+}
+
+void SampleSourceFifo::suspend()
+{
+    m_suspended.store(true, std::memory_order_release);
+
+    while (m_activeAccesses.load(std::memory_order_acquire) != 0) {
+        QThread::yieldCurrentThread();
+    }
+}
+
+void SampleSourceFifo::resume()
+{
+    m_suspended.store(false, std::memory_order_release);
+}
 
 void SampleSourceFifo::read(
     unsigned int amount,
@@ -60,26 +145,69 @@ void SampleSourceFifo::read(
     unsigned int& ipart2Begin, unsigned int& ipart2End  // second part offsets
 )
 {
-    QMutexLocker mutexLocker(&m_mutex);
-    unsigned int spaceLeft = m_size - m_readHead;
-    m_readCount = m_readCount + amount < m_size ? m_readCount + amount : m_size; // cannot exceed FIFO size
+    if (!beginAccess())
+    {
+        ipart1Begin = ipart1End = ipart2Begin = ipart2End = 0;
+        return;
+    }
+
+    if (m_size == 0)
+    {
+        endAccess();
+        ipart1Begin = ipart1End = ipart2Begin = ipart2End = 0;
+        return;
+    }
+
+    unsigned int readHead = m_readHead.load(std::memory_order_relaxed);
+    unsigned int spaceLeft = m_size - readHead;
 
     if (amount <= spaceLeft)
     {
-        ipart1Begin = m_readHead;
-        ipart1End = m_readHead + amount;
+        ipart1Begin = readHead;
+        ipart1End = readHead + amount;
         ipart2Begin = m_size;
         ipart2End = m_size;
-        m_readHead += amount;
+        readHead += amount;
     }
     else
     {
         unsigned int remaining = (amount < m_size ? amount : m_size) - spaceLeft;
-        ipart1Begin = m_readHead;
+        ipart1Begin = readHead;
         ipart1End = m_size;
         ipart2Begin = 0;
         ipart2End = remaining;
-        m_readHead = remaining;
+        readHead = remaining;
+    }
+
+    m_readHead.store(readHead, std::memory_order_release);
+
+    unsigned int readCount = m_readCount.load(std::memory_order_relaxed);
+    unsigned int newReadCount;
+
+    do { // cannot exceed FIFO size
+        newReadCount = readCount + amount < m_size ? readCount + amount : m_size;
+    } while (!m_readCount.compare_exchange_weak(readCount, newReadCount, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    // the reader has gone past the last written sample
+    if ((readCount <= m_readAhead) && (newReadCount > m_readAhead))
+    {
+        qint64 now = QDateTime::currentMSecsSinceEpoch();
+        quint32 underrunIndex = m_underrunCount.fetch_add(1, std::memory_order_relaxed);
+        qint64 previous = m_underrunTimestamps[(underrunIndex + m_nbUnderrunTimestamps - 1) % m_nbUnderrunTimestamps].load(std::memory_order_relaxed);
+        m_underrunTimestamps[underrunIndex % m_nbUnderrunTimestamps].store(now, std::memory_order_relaxed);
+
+        if ((underrunIndex == 0) || (now - previous > 1000)) {
+            qWarning("SampleSourceFifo::read: underrun #%u (%u samples missing)", underrunIndex + 1, newReadCount - m_readAhead);
+        }
+    }
+
+    endAccess();
+
+    // only the first read after the writer has waited needs to wake it up
+    if (!m_readPending.exchange(true, std::memory_order_acq_rel))
+    {
+        QMutexLocker readLocker(&m_readMutex);
+        m_readCondition.wakeOne();
     }
 
     emit dataRead();
@@ -91,44 +219,114 @@ void SampleSourceFifo::write(
     unsigned int& ipart2Begin, unsigned int& ipart2End  // second part offsets
 )
 {
-    QMutexLocker mutexLocker(&m_mutex);
-    unsigned int rwDelta = m_writeHead >= m_readHead ? m_writeHead - m_readHead : m_size - (m_readHead - m_writeHead);
+    if (!beginAccess())
+    {
+        ipart1Begin = ipart1End = ipart2Begin = ipart2End = 0;
+        return;
+    }
+
+    if (m_size == 0)
+    {
+        endAccess();
+        ipart1Begin = ipart1End = ipart2Begin = ipart2End = 0;
+        return;
+    }
+
+    unsigned int readHead = m_readHead.load(std::memory_order_acquire);
+    unsigned int writeHead = m_writeHead.load(std::memory_order_relaxed);
+    unsigned int rwDelta = writeHead >= readHead ? writeHead - readHead : m_size - (readHead - writeHead);
 
     if (rwDelta < m_lowGuard)
     {
-        qWarning("SampleSourceFifo::write: underrun (write too slow) using %d old samples", m_midPoint - m_lowGuard);
-        m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
+        qWarning("SampleSourceFifo::write: underrun (write too slow) using %u old samples", m_readAhead - m_lowGuard);
+        writeHead = readHead + m_readAhead < m_size ? readHead + m_readAhead : readHead + m_readAhead - m_size;
     }
     else if (rwDelta > m_highGuard)
     {
-        qWarning("SampleSourceFifo::write: overrrun (read too slow) dropping %d samples", m_highGuard - m_midPoint);
-        m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
+        m_overrunCount.fetch_add(1, std::memory_order_relaxed);
+        qWarning("SampleSourceFifo::write: overrun (read too slow) dropping %u samples", m_highGuard - m_readAhead);
+        writeHead = readHead + m_readAhead < m_size ? readHead + m_readAhead : readHead + m_readAhead - m_size;
     }
 
-    unsigned int spaceLeft = m_size - m_writeHead;
+    unsigned int spaceLeft = m_size - writeHead;
 
     if (amount <= spaceLeft)
     {
-        ipart1Begin = m_writeHead;
-        ipart1End = m_writeHead + amount;
+        ipart1Begin = writeHead;
+        ipart1End = writeHead + amount;
         ipart2Begin = m_size;
         ipart2End = m_size;
-        m_writeHead += amount;
+        writeHead += amount;
     }
     else
     {
         unsigned int remaining = (amount < m_size ? amount : m_size) - spaceLeft;
-        ipart1Begin = m_writeHead;
+        ipart1Begin = writeHead;
         ipart1End = m_size;
         ipart2Begin = 0;
         ipart2End = remaining;
-        m_writeHead = remaining;
+        writeHead = remaining;
     }
 
-    m_readCount = amount < m_readCount ? m_readCount - amount : 0; // cannot be less than 0
+    m_writeHead.store(writeHead, std::memory_order_release);
+
+    unsigned int readCount = m_readCount.load(std::memory_order_relaxed);
+    unsigned int newReadCount;
+
+    do { // cannot be less than 0
+        newReadCount = amount < readCount ? readCount - amount : 0;
+    } while (!m_readCount.compare_exchange_weak(readCount, newReadCount, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+    endAccess();
+}
+
+bool SampleSourceFifo::waitForRead(unsigned long timeoutMs)
+{
+    if (m_readPending.exchange(false, std::memory_order_acq_rel)) {
+        return true;
+    }
+
+    QMutexLocker readLocker(&m_readMutex);
+
+    // re-check under the lock so that a wake between the exchange and the wait is not lost
+    if (m_readPending.exchange(false, std::memory_order_acq_rel)) {
+        return true;
+    }
+
+    bool woken = m_readCondition.wait(&m_readMutex, timeoutMs);
+    m_readPending.store(false, std::memory_order_release);
+    return woken;
+}
+
+void SampleSourceFifo::wakeWriter()
+{
+    QMutexLocker readLocker(&m_readMutex);
+    m_readPending.store(true, std::memory_order_release);
+    m_readCondition.wakeAll();
+}
+
+void SampleSourceFifo::getUnderrunTimestamps(std::vector<qint64>& timestamps) const
+{
+    quint32 count = m_underrunCount.load(std::memory_order_relaxed);
+    quint32 nbTimestamps = count < m_nbUnderrunTimestamps ? count : m_nbUnderrunTimestamps;
+    timestamps.clear();
+
+    for (quint32 i = count - nbTimestamps; i < count; i++) {
+        timestamps.push_back(m_underrunTimestamps[i % m_nbUnderrunTimestamps].load(std::memory_order_relaxed));
+    }
+}
+
+void SampleSourceFifo::resetCounters()
+{
+    m_underrunCount.store(0, std::memory_order_relaxed);
+    m_overrunCount.store(0, std::memory_order_relaxed);
+
+    for (unsigned int i = 0; i < m_nbUnderrunTimestamps; i++) {
+        m_underrunTimestamps[i].store(0, std::memory_order_relaxed);
+    }
 }
 
 unsigned int SampleSourceFifo::getSizePolicy(unsigned int sampleRate)
 {
     return (sampleRate/100)*64; // .64s
-}
\ No newline at end of file
+}
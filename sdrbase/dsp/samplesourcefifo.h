@@ -18,11 +18,24 @@
 #ifndef SDRBASE_DSP_SAMPLESOURCEFIFO_H_
 #define SDRBASE_DSP_SAMPLESOURCEFIFO_H_
 
+#include <atomic>
+#include <vector>
+
 #include <QObject>
 #include <QMutex>
+#include <QWaitCondition>
 #include "dsp/dsptypes.h"
 #include "export.h"
 
+/**
+ * Single producer single consumer FIFO from baseband (writer) to device (reader). The reader
+ * always gets samples and the writer refills what was read so that it stays ahead of the reader
+ * by the read ahead target. Reads and writes do not take any lock. Only resizing and resetting
+ * suspend the FIFO while the buffer is reallocated or reset.
+ *
+ * After each read the dataRead() signal is emitted and a writer blocked in waitForRead() is woken.
+ * A reader going past the writer is an underrun. Underruns are counted and their time stamped.
+ */
 class SDRBASE_API SampleSourceFifo : public QObject {
 	Q_OBJECT
 public:
@@ -43,27 +56,41 @@ public:
 		unsigned int& ipart1Begin, unsigned int& ipart1End, // first part offsets where to write
 		unsigned int& ipart2Begin, unsigned int& ipart2End  // second part offsets
     );
-    unsigned int remainder()
+    unsigned int remainder() //!< number of samples read and not refilled yet
     {
-        QMutexLocker mutexLocker(&m_mutex);
-        return m_readCount;
+        unsigned int readCount = m_readCount.load(std::memory_order_acquire);
+        return readCount < m_size ? readCount : m_size;
     }
     /** returns ratio of off center over buffer size with sign: negative read lags and positive read leads */
     float getRWBalance() const
     {
         int delta;
-        if (m_writeHead > m_readHead) {
-            delta = (m_size/m_rwDivisor) - (m_writeHead - m_readHead);
+        unsigned int readHead = m_readHead.load(std::memory_order_relaxed);
+        unsigned int writeHead = m_writeHead.load(std::memory_order_relaxed);
+        if (writeHead > readHead) {
+            delta = m_readAhead - (writeHead - readHead);
         } else {
-            delta = (m_readHead - m_writeHead) - (m_size/m_rwDivisor);
+            delta = (readHead - writeHead) - m_readAhead;
         }
         return delta / (float) m_size;
     }
     unsigned int size() const { return m_size; }
 
+    void setReadAhead(unsigned int readAhead); //!< target of samples written ahead of the reader. 0 for default (half the size)
+    unsigned int getReadAhead() const { return m_readAhead; }
+
+    bool waitForRead(unsigned long timeoutMs); //!< writer side: wait for a read. Returns false on timeout.
+    void wakeWriter(); //!< unblock waitForRead e.g. to stop the writer
+
+    quint32 getUnderrunCount() const { return m_underrunCount.load(std::memory_order_relaxed); }
+    quint32 getOverrunCount() const { return m_overrunCount.load(std::memory_order_relaxed); }
+    void getUnderrunTimestamps(std::vector<qint64>& timestamps) const; //!< ms since epoch of the last underruns, most recent last
+    void resetCounters();
+
     static unsigned int getSizePolicy(unsigned int sampleRate);
     static const unsigned int m_rwDivisor;
     static const unsigned int m_guardDivisor;
+    static const unsigned int m_nbUnderrunTimestamps = 16;
 
 signals:
     void dataRead();
@@ -73,11 +100,28 @@ private:
     unsigned int m_size;
     unsigned int m_lowGuard;
     unsigned int m_highGuard;
-    unsigned int m_midPoint;
-    unsigned int m_readHead;
-    unsigned int m_writeHead;
-    unsigned int m_readCount;
-    QMutex m_mutex;
+    unsigned int m_readAhead;
+    unsigned int m_readAheadSetting; //!< as requested, 0 for default
+    std::atomic<unsigned int> m_readHead;  //!< owned by the reader
+    std::atomic<unsigned int> m_writeHead; //!< owned by the writer
+    std::atomic<unsigned int> m_readCount;
+    QMutex m_mutex; //!< serializes resize and reset operations
+
+    std::atomic<bool> m_suspended;     //!< set while the buffer is reallocated or reset
+    std::atomic<int> m_activeAccesses; //!< number of read or write operations in progress
+    std::atomic<quint32> m_underrunCount;
+    std::atomic<quint32> m_overrunCount;
+    std::atomic<qint64> m_underrunTimestamps[m_nbUnderrunTimestamps];
+
+    std::atomic<bool> m_readPending; //!< a read occurred since the writer last waited
+    QMutex m_readMutex;
+    QWaitCondition m_readCondition;
+
+    void applyReadAhead();
+    bool beginAccess();
+    void endAccess();
+    void suspend();
+    void resume();
 };
 
 #endif // SDRBASE_DSP_SAMPLESOURCEFIFO_H_
\ No newline at end of file
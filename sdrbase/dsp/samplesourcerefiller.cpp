@@ -0,0 +1,70 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "samplesourcefifo.h"
+#include "samplesourcerefiller.h"
+
+const unsigned long SampleSourceRefiller::m_refillTimeoutMs = 10;
+
+SampleSourceRefiller::SampleSourceRefiller() :
+    m_sampleFifo(nullptr),
+    m_running(false)
+{}
+
+SampleSourceRefiller::~SampleSourceRefiller()
+{
+    stopWork();
+}
+
+void SampleSourceRefiller::startWork(SampleSourceFifo *sampleFifo, const std::function<void()>& refill)
+{
+    if (m_running.load()) {
+        stopWork();
+    }
+
+    qDebug("SampleSourceRefiller::startWork");
+    m_sampleFifo = sampleFifo;
+    m_refill = refill;
+    m_running.store(true);
+    start(QThread::HighestPriority);
+}
+
+void SampleSourceRefiller::stopWork()
+{
+    if (!m_running.load()) {
+        return;
+    }
+
+    qDebug("SampleSourceRefiller::stopWork");
+    m_running.store(false);
+    m_sampleFifo->wakeWriter();
+    wait();
+}
+
+void SampleSourceRefiller::run()
+{
+    while (m_running.load(std::memory_order_relaxed))
+    {
+        m_sampleFifo->waitForRead(m_refillTimeoutMs);
+
+        if (m_running.load(std::memory_order_relaxed)) {
+            m_refill();
+        }
+    }
+}
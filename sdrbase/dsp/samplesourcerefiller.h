@@ -0,0 +1,53 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SAMPLESOURCEREFILLER_H_
+#define SDRBASE_DSP_SAMPLESOURCEREFILLER_H_
+
+#include <atomic>
+#include <functional>
+
+#include <QThread>
+
+#include "export.h"
+
+class SampleSourceFifo;
+
+/**
+ * High priority thread refilling a SampleSourceFifo as soon as the device has read from it.
+ * The refill function is also called periodically in case a wake up is missed.
+ */
+class SDRBASE_API SampleSourceRefiller : public QThread
+{
+public:
+    SampleSourceRefiller();
+    ~SampleSourceRefiller();
+
+    void startWork(SampleSourceFifo *sampleFifo, const std::function<void()>& refill);
+    void stopWork();
+
+private:
+    SampleSourceFifo *m_sampleFifo;
+    std::function<void()> m_refill;
+    std::atomic<bool> m_running;
+
+    void run();
+
+    static const unsigned long m_refillTimeoutMs;
+};
+
+#endif // SDRBASE_DSP_SAMPLESOURCEREFILLER_H_
@@ -0,0 +1,470 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <errno.h>
+#include <new>
+#include <algorithm>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include <QDebug>
+
+#include "util/timeutil.h"
+#include "shmsamplering.h"
+
+ShmSampleRing::ShmSampleRing() :
+    m_header(nullptr),
+    m_samples(nullptr),
+    m_size(0),
+    m_mask(0),
+    m_producer(false),
+    m_consumerIndex(-1),
+    m_heartbeatMs(0),
+    m_slotLost(false),
+    m_sampleRate(0),
+    m_centerFrequency(0)
+{}
+
+ShmSampleRing::~ShmSampleRing()
+{
+    close();
+}
+
+std::string ShmSampleRing::shmName(const QString& name)
+{
+    return name.startsWith("/") ? name.toStdString() : "/" + name.toStdString();
+}
+
+uint64_t ShmSampleRing::magicValue()
+{
+    uint64_t magic;
+    memcpy(&magic, "SDRSHMIQ", 8);
+    return magic;
+}
+
+uint32_t ShmSampleRing::roundCapacity(unsigned int capacity)
+{
+    uint32_t ringCapacity = 1;
+
+    while (ringCapacity < capacity) {
+        ringCapacity <<= 1;
+    }
+
+    return ringCapacity;
+}
+
+bool ShmSampleRing::create(const QString& name, unsigned int capacity)
+{
+    close();
+#ifdef _WIN32
+    (void) name;
+    (void) capacity;
+    qWarning("ShmSampleRing::create: shared memory not supported on this platform");
+    return false;
+#else
+    uint32_t ringCapacity = roundCapacity(capacity);
+    m_name = shmName(name);
+    size_t headerSize = ((sizeof(Header) + 63) / 64) * 64; // keep samples cache line aligned
+    m_size = headerSize + ringCapacity * sizeof(Sample);
+    shm_unlink(m_name.c_str()); // remove a leftover of a previous producer
+    int fd = shm_open(m_name.c_str(), O_CREAT | O_RDWR, 0666);
+
+    if (fd < 0)
+    {
+        qWarning("ShmSampleRing::create: cannot open %s: %s", m_name.c_str(), strerror(errno));
+        return false;
+    }
+
+    // consumers write their slot so they open the ring read/write: let consumers of other users do so whatever the umask
+    if (fchmod(fd, 0666) < 0) {
+        qWarning("ShmSampleRing::create: cannot set permissions of %s: %s", m_name.c_str(), strerror(errno));
+    }
+
+    if (ftruncate(fd, m_size) < 0)
+    {
+        qWarning("ShmSampleRing::create: cannot size %s: %s", m_name.c_str(), strerror(errno));
+        ::close(fd);
+        shm_unlink(m_name.c_str());
+        return false;
+    }
+
+    if (!map(fd, true))
+    {
+        shm_unlink(m_name.c_str());
+        return false;
+    }
+
+    m_header = new (m_header) Header;
+    m_header->m_version = m_layoutVersion;
+    m_header->m_headerSize = headerSize;
+    m_header->m_sampleBytes = sizeof(Sample);
+    m_header->m_capacity = ringCapacity;
+    m_header->m_writeCount.store(0, std::memory_order_relaxed);
+    m_header->m_writeStartCount.store(0, std::memory_order_relaxed);
+    m_header->m_metaSequence.store(0, std::memory_order_relaxed);
+    m_header->m_sampleRate = m_sampleRate;
+    m_header->m_centerFrequency = m_centerFrequency;
+    m_header->m_timestampUs = TimeUtil::nowus();
+    m_header->m_timestampCount = 0;
+
+    for (int i = 0; i < m_maxConsumers; i++)
+    {
+        m_header->m_consumers[i].m_active.store(0, std::memory_order_relaxed);
+        m_header->m_consumers[i].m_readCount.store(0, std::memory_order_relaxed);
+        m_header->m_consumers[i].m_dropped.store(0, std::memory_order_relaxed);
+        m_header->m_consumers[i].m_heartbeatMs.store(0, std::memory_order_relaxed);
+    }
+
+    m_samples = (Sample*) ((uint8_t*) m_header + headerSize);
+    m_mask = ringCapacity - 1;
+    m_producer = true;
+    m_header->m_magic.store(magicValue(), std::memory_order_release); // written last: consumers check it
+    qDebug("ShmSampleRing::create: %s: %u samples", m_name.c_str(), ringCapacity);
+
+    return true;
+#endif
+}
+
+bool ShmSampleRing::open(const QString& name)
+{
+    close();
+#ifdef _WIN32
+    (void) name;
+    qWarning("ShmSampleRing::open: shared memory not supported on this platform");
+    return false;
+#else
+    m_name = shmName(name);
+    int fd = shm_open(m_name.c_str(), O_RDWR, 0);
+
+    if (fd < 0)
+    {
+        qWarning("ShmSampleRing::open: cannot open %s: %s", m_name.c_str(), strerror(errno));
+        return false;
+    }
+
+    struct stat st;
+
+    if ((fstat(fd, &st) < 0) || ((size_t) st.st_size < sizeof(Header)))
+    {
+        qWarning("ShmSampleRing::open: %s is not a sample ring", m_name.c_str());
+        ::close(fd);
+        return false;
+    }
+
+    m_size = st.st_size;
+
+    if (!map(fd, false)) {
+        return false;
+    }
+
+    if ((m_header->m_magic.load(std::memory_order_acquire) != magicValue())
+     || (m_header->m_version != m_layoutVersion)
+     || (m_header->m_sampleBytes != sizeof(Sample))
+     || (m_header->m_headerSize + (size_t) m_header->m_capacity * sizeof(Sample) > m_size))
+    {
+        qWarning("ShmSampleRing::open: %s: incompatible ring (version %u, local %u, sample size %u, local %u)",
+            m_name.c_str(), m_header->m_version, m_layoutVersion, m_header->m_sampleBytes, (unsigned int) sizeof(Sample));
+        close();
+        return false;
+    }
+
+    // Take a free slot or one left by a consumer that is gone, including one that died while claiming it.
+    // The heartbeat decides: only one consumer can exchange a given stale value for the current time.
+    int64_t now = TimeUtil::nowms();
+
+    for (int i = 0; i < m_maxConsumers; i++)
+    {
+        ConsumerSlot& slot = m_header->m_consumers[i];
+        int64_t heartbeatMs = slot.m_heartbeatMs.load(std::memory_order_acquire);
+
+        if (now - heartbeatMs < m_staleMs) {
+            continue; // active or being claimed
+        }
+
+        if (!slot.m_heartbeatMs.compare_exchange_strong(heartbeatMs, now, std::memory_order_acq_rel)) {
+            continue; // taken by another consumer since it was checked
+        }
+
+        slot.m_active.store(2, std::memory_order_relaxed);
+        slot.m_dropped.store(0, std::memory_order_relaxed);
+        slot.m_readCount.store(m_header->m_writeCount.load(std::memory_order_acquire), std::memory_order_relaxed); // start from now
+        slot.m_active.store(1, std::memory_order_release);
+        m_consumerIndex = i;
+        m_heartbeatMs = now;
+        m_slotLost = false;
+        break;
+    }
+
+    if (m_consumerIndex < 0)
+    {
+        qWarning("ShmSampleRing::open: %s: no free consumer slot", m_name.c_str());
+        close();
+        return false;
+    }
+
+    m_samples = (Sample*) ((uint8_t*) m_header + m_header->m_headerSize);
+    m_mask = m_header->m_capacity - 1;
+    m_producer = false;
+    qDebug("ShmSampleRing::open: %s: consumer %d", m_name.c_str(), m_consumerIndex);
+
+    return true;
+#endif
+}
+
+bool ShmSampleRing::map(int fd, bool create)
+{
+#ifdef _WIN32
+    (void) fd;
+    (void) create;
+    return false;
+#else
+    void *shm = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (shm == MAP_FAILED)
+    {
+        qWarning("ShmSampleRing::map: cannot map %s: %s", m_name.c_str(), strerror(errno));
+        return false;
+    }
+
+    if (create) {
+        memset(shm, 0, m_size);
+    }
+
+    m_header = (Header*) shm;
+    return true;
+#endif
+}
+
+void ShmSampleRing::close()
+{
+#ifndef _WIN32
+    if (!m_header) {
+        return;
+    }
+
+    if (m_producer)
+    {
+        m_header->m_magic.store(0, std::memory_order_release);
+        shm_unlink(m_name.c_str()); // consumers keep their mapping until they close
+    }
+    else if ((m_consumerIndex >= 0) && !m_slotLost)
+    {
+        ConsumerSlot& slot = m_header->m_consumers[m_consumerIndex];
+        int64_t heartbeatMs = m_heartbeatMs;
+
+        // free the slot only if it was not reclaimed by another consumer
+        if (slot.m_heartbeatMs.compare_exchange_strong(heartbeatMs, 0, std::memory_order_acq_rel)) {
+            slot.m_active.store(0, std::memory_order_release);
+        }
+    }
+
+    munmap(m_header, m_size);
+#endif
+    m_header = nullptr;
+    m_samples = nullptr;
+    m_consumerIndex = -1;
+    m_slotLost = false;
+    m_producer = false;
+}
+
+void ShmSampleRing::write(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (!m_header || !m_producer) {
+        return;
+    }
+
+    uint64_t writeCount = m_header->m_writeCount.load(std::memory_order_relaxed);
+    uint64_t count = end - begin;
+    SampleVector::const_iterator it = begin;
+
+    if (count > m_header->m_capacity) // only the last samples fit
+    {
+        it += count - m_header->m_capacity;
+        writeCount += count - m_header->m_capacity;
+        count = m_header->m_capacity;
+    }
+
+    // consumers check it after their copy to detect samples overwritten while they were copied
+    m_header->m_writeStartCount.store(writeCount + count, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    uint64_t index = writeCount & m_mask;
+    uint64_t part1 = std::min(count, m_header->m_capacity - index);
+    std::copy(it, it + part1, m_samples + index);
+    std::copy(it + part1, it + count, m_samples);
+    m_header->m_writeCount.store(writeCount + count, std::memory_order_release);
+    publishMeta(writeCount + count);
+}
+
+void ShmSampleRing::setMeta(uint32_t sampleRate, uint64_t centerFrequency)
+{
+    m_sampleRate = sampleRate;
+    m_centerFrequency = centerFrequency;
+
+    if (m_header && m_producer) {
+        publishMeta(m_header->m_writeCount.load(std::memory_order_relaxed));
+    }
+}
+
+void ShmSampleRing::publishMeta(uint64_t writeCount)
+{
+    uint32_t sequence = m_header->m_metaSequence.load(std::memory_order_relaxed);
+    m_header->m_metaSequence.store(sequence + 1, std::memory_order_relaxed); // odd: update in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    m_header->m_sampleRate = m_sampleRate;
+    m_header->m_centerFrequency = m_centerFrequency;
+    m_header->m_timestampUs = TimeUtil::nowus();
+    m_header->m_timestampCount = writeCount;
+    m_header->m_metaSequence.store(sequence + 2, std::memory_order_release);
+}
+
+void ShmSampleRing::getConsumers(std::vector<ConsumerStatus>& consumers) const
+{
+    consumers.clear();
+
+    if (!m_header) {
+        return;
+    }
+
+    uint64_t writeCount = m_header->m_writeCount.load(std::memory_order_acquire);
+    int64_t now = TimeUtil::nowms();
+
+    for (int i = 0; i < m_maxConsumers; i++)
+    {
+        const ConsumerSlot& slot = m_header->m_consumers[i];
+
+        if ((slot.m_active.load(std::memory_order_acquire) == 0)
+         || (now - slot.m_heartbeatMs.load(std::memory_order_relaxed) >= m_staleMs)) {
+            continue;
+        }
+
+        uint64_t readCount = slot.m_readCount.load(std::memory_order_acquire);
+        consumers.push_back(ConsumerStatus{
+            i,
+            writeCount > readCount ? writeCount - readCount : 0,
+            slot.m_dropped.load(std::memory_order_relaxed)
+        });
+    }
+}
+
+unsigned int ShmSampleRing::read(Sample *samples, unsigned int maxSamples)
+{
+    if (!m_header || (m_consumerIndex < 0) || m_slotLost) {
+        return 0;
+    }
+
+    ConsumerSlot& slot = m_header->m_consumers[m_consumerIndex];
+    int64_t now = TimeUtil::nowms();
+    int64_t heartbeatMs = m_heartbeatMs;
+
+    if (!slot.m_heartbeatMs.compare_exchange_strong(heartbeatMs, now, std::memory_order_acq_rel))
+    {
+        qWarning("ShmSampleRing::read: %s: consumer slot %d reclaimed after %lld ms without reads",
+            m_name.c_str(), m_consumerIndex, (long long) (now - m_heartbeatMs));
+        m_slotLost = true;
+        return 0;
+    }
+
+    m_heartbeatMs = now;
+    uint64_t readCount = slot.m_readCount.load(std::memory_order_relaxed);
+    uint64_t writeCount = m_header->m_writeCount.load(std::memory_order_acquire);
+
+    if (writeCount - readCount > m_header->m_capacity) // overrun: skip to the oldest sample still in the ring
+    {
+        slot.m_dropped.fetch_add(writeCount - readCount - m_header->m_capacity, std::memory_order_relaxed);
+        readCount = writeCount - m_header->m_capacity;
+    }
+
+    uint64_t count = std::min((uint64_t) maxSamples, writeCount - readCount);
+    uint64_t index = readCount & m_mask;
+    uint64_t part1 = std::min(count, m_header->m_capacity - index);
+    std::copy(m_samples + index, m_samples + index + part1, samples);
+    std::copy(m_samples, m_samples + (count - part1), samples + part1);
+
+    // the producer may have started to overwrite the samples while they were copied
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t writeStartCount = m_header->m_writeStartCount.load(std::memory_order_relaxed);
+
+    if (writeStartCount - readCount > m_header->m_capacity)
+    {
+        slot.m_dropped.fetch_add(count, std::memory_order_relaxed);
+        slot.m_readCount.store(readCount + count, std::memory_order_release);
+        return 0;
+    }
+
+    slot.m_readCount.store(readCount + count, std::memory_order_release);
+    return count;
+}
+
+bool ShmSampleRing::getMeta(uint32_t& sampleRate, uint64_t& centerFrequency, uint64_t& timestampUs) const
+{
+    if (!m_header) {
+        return false;
+    }
+
+    uint32_t sequence;
+    uint64_t timestampCount;
+
+    do
+    {
+        sequence = m_header->m_metaSequence.load(std::memory_order_acquire);
+        sampleRate = m_header->m_sampleRate;
+        centerFrequency = m_header->m_centerFrequency;
+        timestampUs = m_header->m_timestampUs;
+        timestampCount = m_header->m_timestampCount;
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while ((sequence & 1) || (sequence != m_header->m_metaSequence.load(std::memory_order_relaxed)));
+
+    if ((m_consumerIndex >= 0) && (sampleRate != 0))
+    {
+        int64_t delta = (int64_t) m_header->m_consumers[m_consumerIndex].m_readCount.load(std::memory_order_relaxed) - (int64_t) timestampCount;
+        timestampUs += (delta * 1000000LL) / (int64_t) sampleRate;
+    }
+
+    return true;
+}
+
+uint64_t ShmSampleRing::getLag() const
+{
+    if (!m_header || (m_consumerIndex < 0)) {
+        return 0;
+    }
+
+    uint64_t writeCount = m_header->m_writeCount.load(std::memory_order_acquire);
+    uint64_t readCount = m_header->m_consumers[m_consumerIndex].m_readCount.load(std::memory_order_acquire);
+    return writeCount > readCount ? writeCount - readCount : 0;
+}
+
+uint64_t ShmSampleRing::getDropped() const
+{
+    if (!m_header || (m_consumerIndex < 0)) {
+        return 0;
+    }
+
+    return m_header->m_consumers[m_consumerIndex].m_dropped.load(std::memory_order_relaxed);
+}
+
+bool ShmSampleRing::isProducerGone() const
+{
+    return m_header && (m_slotLost || (m_header->m_magic.load(std::memory_order_acquire) != magicValue()));
+}
@@ -0,0 +1,122 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_SHMSAMPLERING_H_
+#define SDRBASE_DSP_SHMSAMPLERING_H_
+
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <QString>
+
+#include "dsp/dsptypes.h"
+#include "export.h"
+
+/**
+ * Ring of samples in POSIX shared memory to transfer a channel stream between processes on the same host.
+ * There is one producer and up to m_maxConsumers consumers each with its own read position. The producer
+ * never waits for the consumers: a consumer lagging more than the ring capacity loses the oldest samples.
+ *
+ * Sample rate and center frequency come with the timestamp of the last sample written, so the time of
+ * any sample can be derived. They are protected by a sequence counter (odd while the producer updates).
+ */
+class SDRBASE_API ShmSampleRing
+{
+public:
+    static const int m_maxConsumers = 8;
+
+    struct ConsumerSlot
+    {
+        std::atomic<uint32_t> m_active;     //!< 1 when taken by a consumer, 2 while a consumer claims it
+        std::atomic<uint64_t> m_readCount;  //!< samples read so far
+        std::atomic<uint64_t> m_dropped;    //!< samples overwritten before being read
+        std::atomic<int64_t> m_heartbeatMs; //!< last read time (0 when free). Owns the slot: it is claimed by a compare and exchange of a stale value
+    };
+
+    struct Header
+    {
+        std::atomic<uint64_t> m_magic;      //!< "SDRSHMIQ" bytes. Stored last with release order by the producer
+        uint32_t m_version;
+        uint32_t m_headerSize;              //!< offset of the samples
+        uint32_t m_sampleBytes;             //!< size of a Sample in the producer build
+        uint32_t m_capacity;                //!< ring size in samples (power of 2)
+        std::atomic<uint64_t> m_writeCount; //!< samples written so far
+        std::atomic<uint64_t> m_writeStartCount; //!< write count at the end of the write in progress. Stored before the samples are copied
+        std::atomic<uint32_t> m_metaSequence;
+        uint32_t m_sampleRate;
+        uint64_t m_centerFrequency;
+        uint64_t m_timestampUs;             //!< time of the last sample written
+        uint64_t m_timestampCount;          //!< write count at m_timestampUs
+        ConsumerSlot m_consumers[m_maxConsumers];
+    };
+
+    struct ConsumerStatus
+    {
+        int m_index;
+        uint64_t m_lag;      //!< samples written and not read yet
+        uint64_t m_dropped;
+    };
+
+    ShmSampleRing();
+    ~ShmSampleRing();
+
+    bool create(const QString& name, unsigned int capacity); //!< producer side. capacity is rounded up to a power of 2
+    bool open(const QString& name);                           //!< consumer side. Takes a free consumer slot
+    void close();
+    bool isOpen() const { return m_header != nullptr; }
+    bool isProducer() const { return m_producer; }
+
+    // producer
+    void write(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void setMeta(uint32_t sampleRate, uint64_t centerFrequency);
+    void getConsumers(std::vector<ConsumerStatus>& consumers) const;
+
+    // consumer
+    unsigned int read(Sample *samples, unsigned int maxSamples); //!< returns the number of samples read
+    bool getMeta(uint32_t& sampleRate, uint64_t& centerFrequency, uint64_t& timestampUs) const; //!< timestamp of the next sample to be read
+    uint64_t getLag() const;
+    uint64_t getDropped() const;
+    bool isProducerGone() const; //!< the producer closed the ring or the consumer slot was reclaimed. The consumer should close and open again
+
+    static const int64_t m_staleMs = 5000;
+    static const uint32_t m_layoutVersion = 2;
+
+    static uint32_t roundCapacity(unsigned int capacity); //!< ring size in samples for a requested capacity
+    uint32_t getCapacity() const { return m_header ? m_header->m_capacity : 0; }
+
+private:
+    Header *m_header;
+    Sample *m_samples;
+    size_t m_size;
+    uint64_t m_mask;
+    bool m_producer;
+    int m_consumerIndex;
+    int64_t m_heartbeatMs; //!< last heartbeat stored in the consumer slot
+    bool m_slotLost;       //!< the consumer slot was reclaimed by another consumer
+    std::string m_name;
+    uint32_t m_sampleRate;
+    uint64_t m_centerFrequency;
+
+    bool map(int fd, bool create);
+    void publishMeta(uint64_t writeCount);
+    static std::string shmName(const QString& name);
+    static uint64_t magicValue();
+};
+
+#endif // SDRBASE_DSP_SHMSAMPLERING_H_
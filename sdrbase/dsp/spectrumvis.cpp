@@ -795,6 +795,10 @@ void SpectrumVis::handleConfigureDSP(uint64_t centerFrequency, int sampleRate)
     QMutexLocker mutexLocker(&m_mutex);
     m_centerFrequency = centerFrequency;
     m_sampleRate = sampleRate;
+
+    if (m_glSpectrum) {
+        m_glSpectrum->setSignalParameters(centerFrequency, sampleRate);
+    }
 }
 
 void SpectrumVis::handleScalef(Real scalef)
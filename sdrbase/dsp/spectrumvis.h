@@ -42,6 +42,7 @@ class SDRBASE_API SpectrumVis : public BasebandSampleSink {
 public:
     class SDRBASE_API MsgConfigureSpectrumVis : public Message {
         MESSAGE_CLASS_DECLARATION
+        MESSAGE_CLASS_COALESCING(MsgConfigureSpectrumVis)
 
     public:
         const GLSpectrumSettings& getSettings() const { return m_settings; }
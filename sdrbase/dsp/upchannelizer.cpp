@@ -26,6 +26,18 @@
 #include "hbfilterchainconverter.h"
 #include "upchannelizer.h"
 
+// Run the per sample work function on a block. Two output samples are produced for each input sample and
+// the work function is resolved at compile time so that it is inlined in the loop
+template<typename Filter, bool (Filter::*Work)(Sample*, Sample*)>
+static void interpolateBlock(Filter *filter, Sample *in, Sample *out, unsigned int nbIn)
+{
+    for (unsigned int i = 0; i < nbIn; i++)
+    {
+        (filter->*Work)(&in[i], &out[2*i]);   // does not consume input
+        (filter->*Work)(&in[i], &out[2*i+1]); // consumes input
+    }
+}
+
 UpChannelizer::UpChannelizer(ChannelSampleSource* sampleSource) :
     m_filterChainSetMode(false),
     m_sampleSource(sampleSource),
@@ -35,7 +47,9 @@ UpChannelizer::UpChannelizer(ChannelSampleSource* sampleSource) :
     m_channelSampleRate(0),
     m_channelFrequencyOffset(0),
     m_log2Interp(0),
-    m_filterChainHash(0)
+    m_filterChainHash(0),
+    m_outputIndex(0),
+    m_outputRemain(0)
 {
 }
 
@@ -60,28 +74,16 @@ void UpChannelizer::pullOne(Sample& sample)
     }
     else
     {
-        FilterStages::iterator stage = m_filterStages.begin();
-        std::vector<Sample>::iterator stageSample = m_stageSamples.begin();
-
-        for (; stage != m_filterStages.end(); ++stage, ++stageSample)
+        if (m_outputRemain == 0) // interpolate one input sample
         {
-            if(stage == m_filterStages.end() - 1)
-            {
-                if ((*stage)->work(&m_sampleIn, &(*stageSample)))
-                {
-                    m_sampleSource->pullOne(m_sampleIn); // get new input sample
-                }
-            }
-            else
-            {
-                if (!(*stage)->work(&(*(stageSample+1)), &(*stageSample)))
-                {
-                    break;
-                }
-            }
+            m_outputBuffer.allocate(1<<log2Interp);
+            interpolate(m_outputBuffer.m_vector.data(), 1);
+            m_outputIndex = 0;
+            m_outputRemain = 1<<log2Interp;
         }
 
-        sample = *m_stageSamples.begin();
+        sample = m_outputBuffer.m_vector[m_outputIndex++];
+        m_outputRemain--;
     }
 }
 
@@ -98,16 +100,59 @@ void UpChannelizer::pull(SampleVector::iterator begin, unsigned int nbSamples)
     if (log2Interp == 0) // optimization when no downsampling is done anyway
     {
         m_sampleSource->pull(begin, nbSamples);
+        return;
     }
-    else
+
+    // samples left over from the previous call
+    unsigned int nbRemain = std::min(nbSamples, m_outputRemain);
+    std::copy(
+        m_outputBuffer.m_vector.begin() + m_outputIndex,
+        m_outputBuffer.m_vector.begin() + m_outputIndex + nbRemain,
+        begin
+    );
+    m_outputIndex += nbRemain;
+    m_outputRemain -= nbRemain;
+    begin += nbRemain;
+    nbSamples -= nbRemain;
+
+    unsigned int nbIn = nbSamples >> log2Interp;
+
+    if (nbIn > 0) {
+        interpolate(&(*begin), nbIn);
+    }
+
+    unsigned int nbLeft = nbSamples - (nbIn << log2Interp);
+
+    if (nbLeft > 0) // interpolate one more input sample and keep what is not used
     {
-        std::for_each(
-            begin,
-            begin + nbSamples,
-            [this](Sample& s) {
-                pullOne(s);
-            }
+        m_outputBuffer.allocate(1<<log2Interp);
+        interpolate(m_outputBuffer.m_vector.data(), 1);
+        std::copy(
+            m_outputBuffer.m_vector.begin(),
+            m_outputBuffer.m_vector.begin() + nbLeft,
+            begin + (nbIn << log2Interp)
         );
+        m_outputIndex = nbLeft;
+        m_outputRemain = (1<<log2Interp) - nbLeft;
+    }
+}
+
+void UpChannelizer::interpolate(Sample *out, unsigned int nbIn)
+{
+    // stages are ordered from the output (highest rate) to the input (source rate)
+    unsigned int nbStages = m_filterStages.size();
+    m_sourceBlock.allocate(nbIn);
+    m_sampleSource->pull(m_sourceBlock.m_vector.begin(), nbIn);
+    Sample *in = m_sourceBlock.m_vector.data();
+    m_stageBlocks[0].allocate(nbIn << (nbStages - 1));
+    m_stageBlocks[1].allocate(nbIn << (nbStages - 1));
+
+    for (int i = nbStages - 1; i >= 0; i--)
+    {
+        Sample *stageOut = i == 0 ? out : m_stageBlocks[i % 2].m_vector.data(); // ping-pong between stage buffers
+        m_filterStages[i]->workBlock(in, stageOut, nbIn);
+        in = stageOut;
+        nbIn *= 2;
     }
 }
 
@@ -195,38 +240,46 @@ void UpChannelizer::applyInterpolation()
 #ifdef USE_SSE4_1
 UpChannelizer::FilterStage::FilterStage(Mode mode) :
     m_filter(new IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0)
+    m_workFunction(nullptr),
+    m_blockFunction(nullptr)
 {
     switch(mode) {
         case ModeCenter:
             m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateCenter;
+            m_blockFunction = &interpolateBlock<IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>, &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateCenter>;
             break;
 
         case ModeLowerHalf:
             m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateLowerHalf;
+            m_blockFunction = &interpolateBlock<IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>, &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateLowerHalf>;
             break;
 
         case ModeUpperHalf:
             m_workFunction = &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateUpperHalf;
+            m_blockFunction = &interpolateBlock<IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>, &IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateUpperHalf>;
             break;
     }
 }
 #else
 UpChannelizer::FilterStage::FilterStage(Mode mode) :
     m_filter(new IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>),
-    m_workFunction(0)
+    m_workFunction(nullptr),
+    m_blockFunction(nullptr)
 {
     switch(mode) {
         case ModeCenter:
             m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateCenter;
+            m_blockFunction = &interpolateBlock<IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>, &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateCenter>;
             break;
 
         case ModeLowerHalf:
             m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateLowerHalf;
+            m_blockFunction = &interpolateBlock<IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>, &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateLowerHalf>;
             break;
 
         case ModeUpperHalf:
             m_workFunction = &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateUpperHalf;
+            m_blockFunction = &interpolateBlock<IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>, &IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::workInterpolateUpperHalf>;
             break;
     }
 }
@@ -251,7 +304,6 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
 {
     Real sigBw = sigEnd - sigStart;
     Real rot = sigBw / 4;
-    Sample s;
 
     qDebug() << "UpChannelizer::createFilterChain: start:"
             << " sig: ["  << sigStart << ":" << sigEnd << "]"
@@ -266,7 +318,6 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigStart << ":" << sigStart + sigBw / 2.0 << "]";
         m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
-        m_stageSamples.push_back(s);
         return createFilterChain(sigStart, sigStart + sigBw / 2.0, chanStart, chanEnd);
     }
 
@@ -277,7 +328,6 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigEnd - sigBw / 2.0f << ":" << sigEnd << "]";
         m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
-        m_stageSamples.push_back(s);
         return createFilterChain(sigEnd - sigBw / 2.0f, sigEnd, chanStart, chanEnd);
     }
 
@@ -289,7 +339,6 @@ Real UpChannelizer::createFilterChain(Real sigStart, Real sigEnd, Real chanStart
                 << " [" << m_filterStages.size() << "]"
                 << " sig: ["  << sigStart + rot << ":" << sigEnd - rot << "]";
         m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
-        m_stageSamples.push_back(s);
         // Was: return createFilterChain(sigStart + rot, sigStart + sigBw / 2.0f + rot, chanStart, chanEnd);
         return createFilterChain(sigStart + rot, sigEnd - rot, chanStart, chanEnd);
     }
@@ -309,7 +358,6 @@ double UpChannelizer::setFilterChain(const std::vector<unsigned int>& stageIndex
     // filters are described from lower to upper level but the chain is constructed the other way round
     std::vector<unsigned int>::const_reverse_iterator rit = stageIndexes.rbegin();
     double ofs = 0.0, ofs_stage = 0.25;
-    Sample s;
 
     // Each index is a base 3 number with 0 = low, 1 = center, 2 = high
     // Functions at upper level will convert a number to base 3 to describe the filter chain. Common converting
@@ -319,20 +367,17 @@ double UpChannelizer::setFilterChain(const std::vector<unsigned int>& stageIndex
         if (*rit == 0)
         {
             m_filterStages.push_back(new FilterStage(FilterStage::ModeLowerHalf));
-            m_stageSamples.push_back(s);
             ofs -= ofs_stage;
             qDebug("UpChannelizer::setFilterChain: lower half: ofs: %f", ofs);
         }
         else if (*rit == 1)
         {
             m_filterStages.push_back(new FilterStage(FilterStage::ModeCenter));
-            m_stageSamples.push_back(s);
             qDebug("UpChannelizer::setFilterChain: center: ofs: %f", ofs);
         }
         else if (*rit == 2)
         {
             m_filterStages.push_back(new FilterStage(FilterStage::ModeUpperHalf));
-            m_stageSamples.push_back(s);
             ofs += ofs_stage;
             qDebug("UpChannelizer::setFilterChain: upper half: ofs: %f", ofs);
         }
@@ -352,7 +397,7 @@ void UpChannelizer::freeFilterChain()
     for(FilterStages::iterator it = m_filterStages.begin(); it != m_filterStages.end(); ++it)
         delete *it;
     m_filterStages.clear();
-    m_stageSamples.clear();
+    m_outputRemain = 0;
 }
 
 
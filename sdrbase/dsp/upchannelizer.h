@@ -24,6 +24,7 @@
 
 #include "export.h"
 #include "util/message.h"
+#include "util/incrementalvector.h"
 
 #include "channelsamplesource.h"
 
@@ -60,12 +61,15 @@ protected:
 
 #ifdef USE_SSE4_1
         typedef bool (IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* sIn, Sample *sOut);
+        typedef void (*BlockFunction)(IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>* filter, Sample* sIn, Sample *sOut, unsigned int nbIn);
         IntHalfbandFilterEO1<UPCHANNELIZER_HB_FILTER_ORDER>* m_filter;
 #else
         typedef bool (IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>::*WorkFunction)(Sample* sIn, Sample *sOut);
+        typedef void (*BlockFunction)(IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>* filter, Sample* sIn, Sample *sOut, unsigned int nbIn);
         IntHalfbandFilterDB<qint32, UPCHANNELIZER_HB_FILTER_ORDER>* m_filter;
 #endif
         WorkFunction m_workFunction;
+        BlockFunction m_blockFunction;
 
         FilterStage(Mode mode);
         ~FilterStage();
@@ -73,12 +77,15 @@ protected:
         bool work(Sample* sampleIn, Sample *sampleOut) {
             return (m_filter->*m_workFunction)(sampleIn, sampleOut);
         }
+
+        void workBlock(Sample* samplesIn, Sample *samplesOut, unsigned int nbIn) { //!< produces 2*nbIn samples
+            m_blockFunction(m_filter, samplesIn, samplesOut, nbIn);
+        }
     };
 
     typedef std::vector<FilterStage*> FilterStages;
     FilterStages m_filterStages;
     bool m_filterChainSetMode;
-    std::vector<Sample> m_stageSamples;
     ChannelSampleSource* m_sampleSource; //!< Modulator
     int m_basebandSampleRate;
     int m_requestedInputSampleRate;
@@ -88,8 +95,13 @@ protected:
     unsigned int m_log2Interp;
     unsigned int m_filterChainHash;
     SampleVector m_sampleBuffer;
-    Sample m_sampleIn;
+    IncrementalVector<Sample> m_sourceBlock;     //!< samples pulled from the modulator
+    IncrementalVector<Sample> m_stageBlocks[2];  //!< intermediate stage outputs
+    IncrementalVector<Sample> m_outputBuffer;    //!< output of the last interpolated input sample not consumed yet
+    unsigned int m_outputIndex;
+    unsigned int m_outputRemain;
 
+    void interpolate(Sample *out, unsigned int nbIn); //!< pulls nbIn samples from the modulator and produces nbIn * 2^log2Interp samples
     void applyChannelization();
     void applyInterpolation();
     bool signalContainsChannel(Real sigStart, Real sigEnd, Real chanStart, Real chanEnd) const;
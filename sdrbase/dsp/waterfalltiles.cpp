@@ -0,0 +1,567 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QDebug>
+
+#include "dsp/spectrumvis.h"
+#include "waterfalltiles.h"
+
+WaterfallTiles::Settings::Settings()
+{
+    resetToDefaults();
+}
+
+void WaterfallTiles::Settings::resetToDefaults()
+{
+    m_fftSize = 1024;
+    m_lineRate = 10.0f;
+    m_minLevel = -120.0f;
+    m_maxLevel = 0.0f;
+    m_tileLines = 256;
+    m_tileBins = 256;
+    m_nbZoomLevels = 4;
+    m_memoryTiles = 32;
+    m_directory = "";
+}
+
+WaterfallTiles::Tile::Tile() :
+    m_zoom(0),
+    m_timeIndex(0),
+    m_freqIndex(0),
+    m_lines(0),
+    m_bins(0),
+    m_filledLines(0),
+    m_startMs(0),
+    m_endMs(0),
+    m_centerFrequency(0),
+    m_sampleRate(0),
+    m_fftSize(0),
+    m_minLevel(0.0f),
+    m_maxLevel(0.0f)
+{}
+
+WaterfallTiles::WaterfallTiles() :
+    m_centerFrequency(0),
+    m_sampleRate(0),
+    m_fftSize(0),
+    m_linePending(false),
+    m_lineStartMs(0),
+    m_nbLines(0)
+{
+    m_spectrumVis = new SpectrumVis(SDR_RX_SCALEF);
+    m_spectrumVis->setGLSpectrum(this);
+    applySettings(m_settings);
+}
+
+WaterfallTiles::~WaterfallTiles()
+{
+    delete m_spectrumVis;
+}
+
+void WaterfallTiles::applySettings(const Settings& settings)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    Settings newSettings = settings;
+    newSettings.m_lineRate = newSettings.m_lineRate <= 0.0f ? 10.0f : newSettings.m_lineRate;
+    newSettings.m_tileLines = newSettings.m_tileLines < 1 ? 1 : newSettings.m_tileLines;
+    newSettings.m_tileBins = newSettings.m_tileBins < 1 ? 1 : newSettings.m_tileBins;
+    newSettings.m_nbZoomLevels = newSettings.m_nbZoomLevels < 1 ? 1 : newSettings.m_nbZoomLevels > 16 ? 16 : newSettings.m_nbZoomLevels;
+    newSettings.m_memoryTiles = newSettings.m_memoryTiles < 1 ? 1 : newSettings.m_memoryTiles;
+
+    if (newSettings.m_maxLevel <= newSettings.m_minLevel) {
+        newSettings.m_maxLevel = newSettings.m_minLevel + 1.0f;
+    }
+
+    qDebug() << "WaterfallTiles::applySettings:"
+        << " m_fftSize: " << newSettings.m_fftSize
+        << " m_lineRate: " << newSettings.m_lineRate
+        << " m_minLevel: " << newSettings.m_minLevel
+        << " m_maxLevel: " << newSettings.m_maxLevel
+        << " m_tileLines: " << newSettings.m_tileLines
+        << " m_tileBins: " << newSettings.m_tileBins
+        << " m_nbZoomLevels: " << newSettings.m_nbZoomLevels
+        << " m_memoryTiles: " << newSettings.m_memoryTiles
+        << " m_directory: " << newSettings.m_directory;
+
+    bool newHistory = m_zoomLevels.empty()
+        || (newSettings.m_minLevel != m_settings.m_minLevel)
+        || (newSettings.m_maxLevel != m_settings.m_maxLevel)
+        || (newSettings.m_tileLines != m_settings.m_tileLines)
+        || (newSettings.m_tileBins != m_settings.m_tileBins)
+        || (newSettings.m_nbZoomLevels != m_settings.m_nbZoomLevels)
+        || (newSettings.m_directory != m_settings.m_directory);
+
+    if (newHistory) {
+        restartTiles(); // the current history is completed with its own geometry
+    }
+
+    m_settings = newSettings;
+
+    if (newHistory) {
+        resetHistory();
+    }
+
+    m_spectrumVis->configure(
+        m_settings.m_fftSize,
+        0.0f,
+        100.0f,
+        0,
+        0,
+        SpectrumVis::AvgModeNone,
+        FFTWindow::BlackmanHarris,
+        false
+    );
+}
+
+WaterfallTiles::Settings WaterfallTiles::getSettings() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    return m_settings;
+}
+
+void WaterfallTiles::resetHistory()
+{
+    m_zoomLevels.assign(m_settings.m_nbZoomLevels, ZoomLevel());
+    m_linePending = false;
+    m_nbLines = 0;
+    m_sessionName = QDateTime::currentDateTimeUtc().toString("yyyy-MM-ddTHH_mm_ss_zzz");
+}
+
+void WaterfallTiles::restartTiles()
+{
+    for (int zoom = 0; zoom < (int) m_zoomLevels.size(); zoom++)
+    {
+        ZoomLevel& level = m_zoomLevels[zoom];
+        int lineInTile = level.m_lineIndex % m_settings.m_tileLines;
+
+        if (lineInTile != 0)
+        {
+            completeTile(zoom, level.m_lineIndex / m_settings.m_tileLines);
+            level.m_lineIndex += m_settings.m_tileLines - lineInTile;
+        }
+
+        level.m_pending = false;
+    }
+
+    m_linePending = false;
+}
+
+void WaterfallTiles::newSpectrum(const std::vector<Real>& spectrum, int fftSize)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (fftSize != m_fftSize)
+    {
+        restartTiles();
+        m_fftSize = fftSize;
+    }
+
+    qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+
+    // peak hold over the line period so that short bursts are not lost
+    if (!m_linePending)
+    {
+        m_peakLine.assign(spectrum.begin(), spectrum.begin() + fftSize);
+        m_lineStartMs = nowMs;
+        m_linePending = true;
+    }
+    else
+    {
+        for (int i = 0; i < fftSize; i++) {
+            m_peakLine[i] = std::max(m_peakLine[i], spectrum[i]);
+        }
+    }
+
+    if (nowMs - m_lineStartMs < 1000.0f / m_settings.m_lineRate) {
+        return;
+    }
+
+    float scale = 255.0f / (m_settings.m_maxLevel - m_settings.m_minLevel);
+    m_line.resize(fftSize);
+
+    for (int i = 0; i < fftSize; i++)
+    {
+        float v = (m_peakLine[i] - m_settings.m_minLevel) * scale + 0.5f;
+        m_line[i] = v < 0.0f ? 0 : v > 255.0f ? 255 : (quint8) v;
+    }
+
+    m_linePending = false;
+    m_nbLines++;
+    addLine(0, m_line.data(), fftSize, m_lineStartMs, nowMs);
+}
+
+void WaterfallTiles::setSignalParameters(quint64 centerFrequency, int sampleRate)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((centerFrequency != m_centerFrequency) || (sampleRate != m_sampleRate))
+    {
+        restartTiles(); // tiles have constant frequency and rate
+        m_centerFrequency = centerFrequency;
+        m_sampleRate = sampleRate;
+    }
+}
+
+void WaterfallTiles::addLine(int zoom, const quint8 *line, int bins, qint64 startMs, qint64 endMs)
+{
+    ZoomLevel& level = m_zoomLevels[zoom];
+    int tileBins = m_settings.m_tileBins;
+    qint64 timeIndex = level.m_lineIndex / m_settings.m_tileLines;
+    int lineInTile = level.m_lineIndex % m_settings.m_tileLines;
+    std::vector<Tile>& tiles = level.m_tiles[timeIndex];
+
+    if (tiles.empty()) // new time index
+    {
+        tiles.resize((bins + tileBins - 1) / tileBins);
+
+        for (int f = 0; f < (int) tiles.size(); f++)
+        {
+            Tile& tile = tiles[f];
+            tile.m_zoom = zoom;
+            tile.m_timeIndex = timeIndex;
+            tile.m_freqIndex = f;
+            tile.m_lines = m_settings.m_tileLines;
+            tile.m_bins = std::min(tileBins, bins - f*tileBins);
+            tile.m_startMs = startMs;
+            tile.m_centerFrequency = m_centerFrequency;
+            tile.m_sampleRate = m_sampleRate;
+            tile.m_fftSize = m_fftSize;
+            tile.m_minLevel = m_settings.m_minLevel;
+            tile.m_maxLevel = m_settings.m_maxLevel;
+            tile.m_data.assign(tile.m_lines * tile.m_bins, 0);
+        }
+
+        // skipped time indexes (see restartTiles) start with this one
+        for (qint64 i = level.m_firstStartIndex + level.m_tileStartMs.size(); i <= timeIndex; i++) {
+            level.m_tileStartMs.push_back(startMs);
+        }
+
+        while (level.m_tileStartMs.size() > m_maxTileStarts) // oldest tiles can no longer be found by timestamp
+        {
+            level.m_tileStartMs.pop_front();
+            level.m_firstStartIndex++;
+        }
+
+        while ((int) level.m_tiles.size() > m_settings.m_memoryTiles) { // oldest first
+            level.m_tiles.erase(level.m_tiles.begin());
+        }
+    }
+
+    for (int f = 0; f < (int) tiles.size(); f++)
+    {
+        Tile& tile = tiles[f];
+        std::copy(line + f*tileBins, line + f*tileBins + tile.m_bins, &tile.m_data[lineInTile * tile.m_bins]);
+        tile.m_filledLines = lineInTile + 1;
+        tile.m_endMs = endMs;
+    }
+
+    level.m_lineIndex++;
+
+    if (lineInTile + 1 == m_settings.m_tileLines) {
+        completeTile(zoom, timeIndex);
+    }
+
+    // next zoom level merges pairs of lines and bins
+    if ((zoom + 1 < (int) m_zoomLevels.size()) && (bins >= 2))
+    {
+        ZoomLevel& upper = m_zoomLevels[zoom + 1];
+        int upperBins = bins / 2;
+
+        if (!upper.m_pending)
+        {
+            upper.m_pendingLine.resize(upperBins);
+
+            for (int b = 0; b < upperBins; b++) {
+                upper.m_pendingLine[b] = std::max(line[2*b], line[2*b+1]);
+            }
+
+            upper.m_pendingStartMs = startMs;
+            upper.m_pending = true;
+        }
+        else
+        {
+            for (int b = 0; b < upperBins; b++) {
+                upper.m_pendingLine[b] = std::max(upper.m_pendingLine[b], std::max(line[2*b], line[2*b+1]));
+            }
+
+            upper.m_pending = false;
+            addLine(zoom + 1, upper.m_pendingLine.data(), upperBins, upper.m_pendingStartMs, endMs);
+        }
+    }
+}
+
+void WaterfallTiles::completeTile(int zoom, qint64 timeIndex)
+{
+    if (m_settings.m_directory.isEmpty()) {
+        return;
+    }
+
+    const std::map<qint64, std::vector<Tile>>& tiles = m_zoomLevels[zoom].m_tiles;
+    std::map<qint64, std::vector<Tile>>::const_iterator it = tiles.find(timeIndex);
+
+    if (it != tiles.end())
+    {
+        for (const Tile& tile : it->second) {
+            m_tileWriter.push(getTilePath(tile.m_zoom, tile.m_timeIndex, tile.m_freqIndex), tile);
+        }
+    }
+}
+
+QString WaterfallTiles::getTilePath(int zoom, qint64 timeIndex, int freqIndex) const
+{
+    return QString("%1/%2/z%3/t%4_f%5.wft")
+        .arg(m_settings.m_directory)
+        .arg(m_sessionName)
+        .arg(zoom)
+        .arg(timeIndex)
+        .arg(freqIndex);
+}
+
+// Called in the writer thread. The file appears complete or not at all to readers
+void WaterfallTiles::writeTile(const QString& path, const Tile& tile)
+{
+    QDir().mkpath(QFileInfo(path).path());
+    QSaveFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qWarning("WaterfallTiles::writeTile: cannot write %s", qPrintable(path));
+        return;
+    }
+
+    TileHeader header;
+    std::fill(header.magic, header.magic + 8, 0);
+    std::copy(std::begin("SDRWFT1"), std::end("SDRWFT1"), header.magic);
+    header.timeIndex = tile.m_timeIndex;
+    header.startMs = tile.m_startMs;
+    header.endMs = tile.m_endMs;
+    header.centerFrequency = tile.m_centerFrequency;
+    header.zoom = tile.m_zoom;
+    header.freqIndex = tile.m_freqIndex;
+    header.lines = tile.m_lines;
+    header.bins = tile.m_bins;
+    header.filledLines = tile.m_filledLines;
+    header.sampleRate = tile.m_sampleRate;
+    header.fftSize = tile.m_fftSize;
+    header.minLevel = tile.m_minLevel;
+    header.maxLevel = tile.m_maxLevel;
+    header.filler = 0;
+    file.write((const char *) &header, sizeof(TileHeader));
+    file.write((const char *) tile.m_data.data(), tile.m_filledLines * tile.m_bins); // only filled lines
+
+    if (!file.commit()) {
+        qWarning("WaterfallTiles::writeTile: cannot write %s", qPrintable(path));
+    }
+}
+
+// Called without the lock
+bool WaterfallTiles::readTile(const QString& path, Tile& tile)
+{
+    QFile file(path);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    TileHeader header;
+
+    if ((file.read((char *) &header, sizeof(TileHeader)) != sizeof(TileHeader))
+     || (std::string(header.magic, 7) != "SDRWFT1")
+     || (header.lines <= 0) || (header.bins <= 0) || (header.filledLines > header.lines))
+    {
+        qWarning("WaterfallTiles::readTile: invalid tile file %s", qPrintable(file.fileName()));
+        return false;
+    }
+
+    tile.m_zoom = header.zoom;
+    tile.m_timeIndex = header.timeIndex;
+    tile.m_freqIndex = header.freqIndex;
+    tile.m_lines = header.lines;
+    tile.m_bins = header.bins;
+    tile.m_filledLines = header.filledLines;
+    tile.m_startMs = header.startMs;
+    tile.m_endMs = header.endMs;
+    tile.m_centerFrequency = header.centerFrequency;
+    tile.m_sampleRate = header.sampleRate;
+    tile.m_fftSize = header.fftSize;
+    tile.m_minLevel = header.minLevel;
+    tile.m_maxLevel = header.maxLevel;
+    tile.m_data.assign(tile.m_lines * tile.m_bins, 0);
+    qint64 dataSize = tile.m_filledLines * tile.m_bins;
+
+    return file.read((char *) tile.m_data.data(), dataSize) == dataSize;
+}
+
+bool WaterfallTiles::getTile(int zoom, qint64 timeIndex, int freqIndex, Tile& tile) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((zoom < 0) || (zoom >= (int) m_zoomLevels.size()) || (timeIndex < 0) || (freqIndex < 0)) {
+        return false;
+    }
+
+    const std::map<qint64, std::vector<Tile>>& tiles = m_zoomLevels[zoom].m_tiles;
+    std::map<qint64, std::vector<Tile>>::const_iterator it = tiles.find(timeIndex);
+
+    if (it != tiles.end())
+    {
+        if (freqIndex >= (int) it->second.size()) {
+            return false;
+        }
+
+        tile = it->second[freqIndex];
+        return true;
+    }
+
+    if (m_settings.m_directory.isEmpty()) {
+        return false;
+    }
+
+    QString path = getTilePath(zoom, timeIndex, freqIndex);
+    mutexLocker.unlock(); // the disk is accessed without holding up the spectrum thread
+
+    return m_tileWriter.find(path, tile) || readTile(path, tile);
+}
+
+WaterfallTiles::TileWriter::TileWriter() :
+    m_stop(false)
+{}
+
+WaterfallTiles::TileWriter::~TileWriter()
+{
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        m_stop = true;
+        m_queued.wakeAll();
+    }
+
+    wait();
+}
+
+// Called with the tiles lock held
+void WaterfallTiles::TileWriter::push(const QString& path, const Tile& tile)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_queue.size() >= m_maxQueuedTiles)
+    {
+        qWarning("WaterfallTiles::TileWriter::push: disk too slow: %s dropped", qPrintable(path));
+        return;
+    }
+
+    m_queue.push_back(std::make_pair(path, tile));
+    m_queued.wakeAll();
+
+    if (!isRunning()) {
+        start();
+    }
+}
+
+bool WaterfallTiles::TileWriter::find(const QString& path, Tile& tile)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (std::deque<std::pair<QString, Tile>>::const_iterator it = m_queue.begin(); it != m_queue.end(); ++it)
+    {
+        if (it->first == path)
+        {
+            tile = it->second;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void WaterfallTiles::TileWriter::run()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    while (true)
+    {
+        while (m_queue.empty() && !m_stop) {
+            m_queued.wait(&m_mutex);
+        }
+
+        if (m_queue.empty()) { // stopped and all tiles written
+            break;
+        }
+
+        // elements are only added at the back meanwhile so the front stays in place
+        const std::pair<QString, Tile>& entry = m_queue.front();
+        mutexLocker.unlock();
+        writeTile(entry.first, entry.second);
+        mutexLocker.relock();
+        m_queue.pop_front();
+    }
+}
+
+qint64 WaterfallTiles::getTimeIndex(int zoom, qint64 timestampMs) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((zoom < 0) || (zoom >= (int) m_zoomLevels.size())) {
+        return -1;
+    }
+
+    const ZoomLevel& level = m_zoomLevels[zoom];
+    const std::deque<qint64>& starts = level.m_tileStartMs;
+
+    if (starts.empty() || (timestampMs < starts.front())) {
+        return -1;
+    }
+
+    return level.m_firstStartIndex + (std::upper_bound(starts.begin(), starts.end(), timestampMs) - starts.begin()) - 1;
+}
+
+void WaterfallTiles::getSignalParameters(quint64& centerFrequency, int& sampleRate, int& fftSize) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    centerFrequency = m_centerFrequency;
+    sampleRate = m_sampleRate;
+    fftSize = m_fftSize;
+}
+
+void WaterfallTiles::getStatus(std::vector<ZoomStatus>& status, qint64& nbLines) const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    status.resize(m_zoomLevels.size());
+    nbLines = m_nbLines;
+
+    for (int zoom = 0; zoom < (int) m_zoomLevels.size(); zoom++)
+    {
+        const ZoomLevel& level = m_zoomLevels[zoom];
+        ZoomStatus& zoomStatus = status[zoom];
+        zoomStatus.m_lastTimeIndex = level.m_firstStartIndex + (qint64) level.m_tileStartMs.size() - 1;
+        zoomStatus.m_memoryTimeIndex = level.m_tiles.empty() ? -1 : level.m_tiles.begin()->first;
+        zoomStatus.m_firstTimeIndex = (m_settings.m_directory.isEmpty() || level.m_tileStartMs.empty()) ?
+            zoomStatus.m_memoryTimeIndex : level.m_firstStartIndex;
+        zoomStatus.m_nbFreqTiles = level.m_tiles.empty() ? 0 : level.m_tiles.rbegin()->second.size();
+        qint64 startIndex = std::max(zoomStatus.m_firstTimeIndex - level.m_firstStartIndex, (qint64) 0);
+        zoomStatus.m_firstStartMs = (zoomStatus.m_firstTimeIndex < 0) || level.m_tileStartMs.empty() ?
+            0 : level.m_tileStartMs[std::min(startIndex, (qint64) level.m_tileStartMs.size() - 1)];
+        zoomStatus.m_lastEndMs = level.m_tiles.empty() || level.m_tiles.rbegin()->second.empty() ?
+            0 : level.m_tiles.rbegin()->second.front().m_endMs;
+    }
+}
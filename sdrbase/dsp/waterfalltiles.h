@@ -0,0 +1,193 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_WATERFALLTILES_H_
+#define SDRBASE_DSP_WATERFALLTILES_H_
+
+#include <map>
+#include <vector>
+#include <deque>
+
+#include <QString>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+#include "dsp/glspectruminterface.h"
+#include "export.h"
+
+class SpectrumVis;
+
+/**
+ * Waterfall history kept as tiles of 8 bit power levels without any GUI or OpenGL context so that it can be served
+ * by the headless server to remote viewers.
+ *
+ * Spectrum lines come from a dedicated SpectrumVis. They are peak held over the line period then quantized between
+ * a minimum and maximum level. Tiles are built at several zoom levels: zoom n merges 2^n lines and 2^n bins by taking
+ * the maximum so that any part of the history can be fetched at any resolution without running FFTs again.
+ * Tiles at zoom n are indexed by their time index (line number / tile lines) and frequency index (bin / tile bins).
+ * A given number of time indexes is kept in memory for each zoom level and completed tiles can also be written to disk.
+ * Disk writes are done by a writer thread and disk reads outside of the lock so that the spectrum thread never waits
+ * for the disk.
+ */
+class SDRBASE_API WaterfallTiles : public GLSpectrumInterface
+{
+public:
+    struct SDRBASE_API Settings
+    {
+        int m_fftSize;
+        float m_lineRate;    //!< lines per second at zoom 0
+        float m_minLevel;    //!< dB mapped to level 0
+        float m_maxLevel;    //!< dB mapped to level 255
+        int m_tileLines;     //!< tile size in time
+        int m_tileBins;      //!< tile size in frequency
+        int m_nbZoomLevels;
+        int m_memoryTiles;   //!< time indexes kept in memory per zoom level
+        QString m_directory; //!< completed tiles are written there if not empty
+
+        Settings();
+        void resetToDefaults();
+    };
+
+    struct Tile
+    {
+        int m_zoom;
+        qint64 m_timeIndex;
+        int m_freqIndex;
+        int m_lines;
+        int m_bins;
+        int m_filledLines;
+        qint64 m_startMs;          //!< start of first line
+        qint64 m_endMs;            //!< end of last filled line
+        quint64 m_centerFrequency;
+        int m_sampleRate;
+        int m_fftSize;             //!< FFT size at zoom 0
+        float m_minLevel;
+        float m_maxLevel;
+        std::vector<quint8> m_data; //!< m_lines lines of m_bins levels oldest first
+
+        Tile();
+    };
+
+    struct ZoomStatus
+    {
+        qint64 m_firstTimeIndex;   //!< first time index that can be fetched
+        qint64 m_lastTimeIndex;    //!< last time index (tile being filled) or -1 if none
+        qint64 m_memoryTimeIndex;  //!< first time index in memory
+        int m_nbFreqTiles;         //!< frequency tiles of the last time index
+        qint64 m_firstStartMs;
+        qint64 m_lastEndMs;
+    };
+
+    WaterfallTiles();
+    virtual ~WaterfallTiles();
+
+    SpectrumVis *getSpectrumVis() { return m_spectrumVis; }
+    void applySettings(const Settings& settings); //!< changing the tile geometry starts a new history
+    Settings getSettings() const;
+    const QString& getSessionName() const { return m_sessionName; }
+
+    virtual void newSpectrum(const std::vector<Real>& spectrum, int fftSize);
+    virtual void setSignalParameters(quint64 centerFrequency, int sampleRate);
+
+    bool getTile(int zoom, qint64 timeIndex, int freqIndex, Tile& tile) const; //!< from memory or else from disk
+    qint64 getTimeIndex(int zoom, qint64 timestampMs) const; //!< index of the tile containing the timestamp or -1
+    void getStatus(std::vector<ZoomStatus>& status, qint64& nbLines) const;
+    void getSignalParameters(quint64& centerFrequency, int& sampleRate, int& fftSize) const;
+
+private:
+#pragma pack(push, 1)
+    struct TileHeader
+    {
+        char magic[8];
+        qint64 timeIndex;
+        qint64 startMs;
+        qint64 endMs;
+        quint64 centerFrequency;
+        qint32 zoom;
+        qint32 freqIndex;
+        qint32 lines;
+        qint32 bins;
+        qint32 filledLines;
+        qint32 sampleRate;
+        qint32 fftSize;
+        float minLevel;
+        float maxLevel;
+        quint32 filler;
+    };
+#pragma pack(pop)
+
+    struct ZoomLevel
+    {
+        std::map<qint64, std::vector<Tile>> m_tiles; //!< frequency tiles by time index
+        std::deque<qint64> m_tileStartMs;             //!< start of the last m_maxTileStarts tiles by time index
+        qint64 m_firstStartIndex;                     //!< time index of m_tileStartMs.front()
+        qint64 m_lineIndex;                           //!< next line at this zoom
+        std::vector<quint8> m_pendingLine;            //!< first of the two lines merged from the zoom below
+        bool m_pending;
+        qint64 m_pendingStartMs;
+
+        ZoomLevel() : m_firstStartIndex(0), m_lineIndex(0), m_pending(false), m_pendingStartMs(0) {}
+    };
+
+    /** Writes completed tiles to disk in its own thread */
+    class TileWriter : public QThread
+    {
+    public:
+        TileWriter();
+        ~TileWriter(); //!< the tiles queued are written before it returns
+        void push(const QString& path, const Tile& tile);
+        bool find(const QString& path, Tile& tile); //!< tile queued and not written yet
+
+    protected:
+        virtual void run();
+
+    private:
+        static const unsigned int m_maxQueuedTiles = 4096;
+        QMutex m_mutex;
+        QWaitCondition m_queued;
+        std::deque<std::pair<QString, Tile>> m_queue; //!< the front one is being written
+        bool m_stop;
+    };
+
+    static const unsigned int m_maxTileStarts = 1<<16; //!< tiles that can be found by timestamp per zoom level
+
+    SpectrumVis *m_spectrumVis;
+    Settings m_settings;
+    QString m_sessionName;
+    std::vector<ZoomLevel> m_zoomLevels;
+    quint64 m_centerFrequency;
+    int m_sampleRate;
+    int m_fftSize;
+    std::vector<Real> m_peakLine;
+    std::vector<quint8> m_line;
+    bool m_linePending;
+    qint64 m_lineStartMs;
+    qint64 m_nbLines;
+    mutable QMutex m_mutex;
+    mutable TileWriter m_tileWriter;
+
+    void resetHistory();
+    void restartTiles(); //!< completes the tiles being filled and restarts at the next tile boundary
+    void addLine(int zoom, const quint8 *line, int bins, qint64 startMs, qint64 endMs);
+    void completeTile(int zoom, qint64 timeIndex);
+    QString getTilePath(int zoom, qint64 timeIndex, int freqIndex) const;
+    static void writeTile(const QString& path, const Tile& tile);
+    static bool readTile(const QString& path, Tile& tile);
+};
+
+#endif // SDRBASE_DSP_WATERFALLTILES_H_
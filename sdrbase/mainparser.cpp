@@ -34,12 +34,28 @@ MainParser::MainParser() :
     m_fftwfWisdomOption(QStringList() << "w" << "fftwf-wisdom",
         "FFTW Wisdom file.",
         "file",
-        "")
+        ""),
+    m_batchPresetOption(QStringList() << "batch-preset",
+        "Batch mode (server only): preset to apply to the recording given as group:description.",
+        "preset",
+        ""),
+    m_batchInputOption(QStringList() << "batch-input",
+        "Batch mode (server only): .sdriq recording to process as fast as possible. Activates batch mode.",
+        "file",
+        ""),
+    m_batchOutputOption(QStringList() << "batch-output",
+        "Batch mode (server only): directory where channel outputs are written.",
+        "directory",
+        "."),
+    m_executorAffinityOption(QStringList() << "executor-affinity",
+        "Run the channels of a device set on the same pinned thread of the baseband executor (Linux).")
 {
     m_serverAddress = "127.0.0.1";
     m_serverPort = 8091;
     m_mimoSupport = false;
     m_fftwfWindowFileName = "";
+    m_batchOutputDirectory = ".";
+    m_executorAffinity = false;
 
     m_parser.setApplicationDescription("Software Defined Radio application");
     m_parser.addHelpOption();
@@ -48,6 +64,10 @@ MainParser::MainParser() :
     m_parser.addOption(m_serverAddressOption);
     m_parser.addOption(m_serverPortOption);
     m_parser.addOption(m_fftwfWisdomOption);
+    m_parser.addOption(m_batchPresetOption);
+    m_parser.addOption(m_batchInputOption);
+    m_parser.addOption(m_batchOutputOption);
+    m_parser.addOption(m_executorAffinityOption);
 }
 
 MainParser::~MainParser()
@@ -92,6 +112,32 @@ void MainParser::parse(const QCoreApplication& app)
 
     m_fftwfWindowFileName = m_parser.value(m_fftwfWisdomOption);
 
+    // batch mode
+
+    m_batchInputFileName = m_parser.value(m_batchInputOption);
+    m_batchOutputDirectory = m_parser.value(m_batchOutputOption);
+    QString batchPreset = m_parser.value(m_batchPresetOption);
+    int groupSeparator = batchPreset.indexOf(':');
+
+    if (groupSeparator < 0)
+    {
+        m_batchPresetGroup.clear();
+        m_batchPresetDescription = batchPreset;
+    }
+    else
+    {
+        m_batchPresetGroup = batchPreset.left(groupSeparator);
+        m_batchPresetDescription = batchPreset.mid(groupSeparator + 1);
+    }
+
+    if (isBatchMode() && m_batchPresetDescription.isEmpty()) {
+        qWarning() << "MainParser::parse: batch mode without preset. Recording will be processed without channels";
+    }
+
+    // baseband executor
+
+    m_executorAffinity = m_parser.isSet(m_executorAffinityOption);
+
     // MIMO - from version
 
     QStringList versionParts = app.applicationVersion().split(".");
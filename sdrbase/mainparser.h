@@ -36,17 +36,32 @@ public:
     uint16_t getServerPort() const { return m_serverPort; }
     bool getMIMOSupport() const { return m_mimoSupport; }
     const QString& getFFTWFWisdomFileName() const { return m_fftwfWindowFileName; }
+    bool isBatchMode() const { return !m_batchInputFileName.isEmpty(); }
+    const QString& getBatchPresetGroup() const { return m_batchPresetGroup; }
+    const QString& getBatchPresetDescription() const { return m_batchPresetDescription; }
+    const QString& getBatchInputFileName() const { return m_batchInputFileName; }
+    const QString& getBatchOutputDirectory() const { return m_batchOutputDirectory; }
+    bool getExecutorAffinity() const { return m_executorAffinity; }
 
 private:
     QString  m_serverAddress;
     uint16_t m_serverPort;
     QString  m_fftwfWindowFileName;
     bool m_mimoSupport; //!< obtained from major version
+    QString  m_batchPresetGroup;
+    QString  m_batchPresetDescription;
+    QString  m_batchInputFileName;
+    QString  m_batchOutputDirectory;
+    bool m_executorAffinity;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_serverAddressOption;
     QCommandLineOption m_serverPortOption;
     QCommandLineOption m_fftwfWisdomOption;
+    QCommandLineOption m_batchPresetOption;
+    QCommandLineOption m_batchInputOption;
+    QCommandLineOption m_batchOutputOption;
+    QCommandLineOption m_executorAffinityOption;
 };
 
 
@@ -34,6 +34,9 @@ public:
 	void* getDestination() const { return m_destination; }
 	void setDestination(void *destination) { m_destination = destination; }
 
+	virtual bool isCoalescing() const { return false; } //!< true if a newer message of the same class supersedes this one in a queue
+	virtual void coalesce(const Message& older) { (void) older; } //!< keep what is needed from an older message being superseded
+
 protected:
 	// addressing
 	static const char* m_identifier;
@@ -49,6 +52,17 @@ protected:
 		static const char* m_identifier; \
 	private:
 
+/**
+ * To be placed in a message class carrying a full settings object along with a m_force flag.
+ * When such a message is pushed behind a message of the same class still waiting in the queue
+ * the older one is dropped and its force flag is carried over to the newer one.
+ */
+#define MESSAGE_CLASS_COALESCING(Name) \
+	public: \
+		bool isCoalescing() const { return true; } \
+		void coalesce(const Message& older) { m_force = m_force || ((const Name&) older).m_force; } \
+	private:
+
 #define MESSAGE_CLASS_DEFINITION(Name, BaseClass) \
 	const char* Name::m_identifier = #Name; \
 	const char* Name::getIdentifier() const { return m_identifier; } \
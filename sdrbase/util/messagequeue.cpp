@@ -21,10 +21,13 @@
 #include "util/messagequeue.h"
 #include "util/message.h"
 
+std::atomic<quint64> MessageQueue::m_totalCoalescedCount(0);
+
 MessageQueue::MessageQueue(QObject* parent) :
 	QObject(parent),
 	m_lock(QMutex::Recursive),
-	m_queue()
+	m_queue(),
+	m_coalescedCount(0)
 {
 }
 
@@ -44,6 +47,24 @@ void MessageQueue::push(Message* message, bool emitSignal)
 	if (message)
 	{
 		m_lock.lock();
+
+		// A full settings message makes an identical class message still waiting at the tail obsolete.
+		// Only the tail is looked at so that the order relative to other messages is preserved.
+		if (message->isCoalescing() && !m_queue.isEmpty())
+		{
+			Message *older = m_queue.last();
+
+			if ((older->getIdentifier() == message->getIdentifier())
+			 && (older->getDestination() == message->getDestination()))
+			{
+				m_queue.removeLast();
+				message->coalesce(*older);
+				delete older;
+				m_coalescedCount.fetch_add(1, std::memory_order_relaxed);
+				m_totalCoalescedCount.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
 		m_queue.append(message);
 		m_lock.unlock();
 	}
@@ -19,6 +19,8 @@
 #ifndef INCLUDE_MESSAGEQUEUE_H
 #define INCLUDE_MESSAGEQUEUE_H
 
+#include <atomic>
+
 #include <QObject>
 #include <QQueue>
 #include <QMutex>
@@ -38,6 +40,8 @@ public:
 
 	int size(); //!< Returns queue size
 	void clear(); //!< Empty queue
+	quint64 getCoalescedCount() const { return m_coalescedCount.load(); } //!< Messages superseded by a newer one in this queue
+	static quint64 getTotalCoalescedCount() { return m_totalCoalescedCount.load(); } //!< Messages superseded in all queues
 
 signals:
 	void messageEnqueued();
@@ -45,6 +49,8 @@ signals:
 private:
 	QMutex m_lock;
 	QQueue<Message*> m_queue;
+	std::atomic<quint64> m_coalescedCount;
+	static std::atomic<quint64> m_totalCoalescedCount;
 };
 
 #endif // INCLUDE_MESSAGEQUEUE_H
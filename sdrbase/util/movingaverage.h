@@ -58,6 +58,7 @@ class MovingAverageUtil
     float asFloat() const { return ((float)m_total) / N; }
     operator T() const { return  m_total / N; }
     T instantAverage() const { return m_total / (m_num_samples == 0 ? 1 : m_num_samples); }
+    unsigned int size() const { return N; }
 
   private:
     T m_samples[N];
@@ -0,0 +1,274 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include <QUdpSocket>
+#include <QStringList>
+#include <QRegExp>
+#include <QDebug>
+
+#if defined(__linux__)
+#include <errno.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#endif
+
+#include "udpmultisender.h"
+
+UDPMultiSender::UDPMultiSender(QObject *parent, unsigned int maxPayloadSize) :
+    m_maxDatagramSize(maxPayloadSize + m_rtpHeaderSize),
+    m_batchCount(0),
+    m_rtp(false),
+    m_rtpPayloadType(96),
+    m_rtpSequence(0),
+    m_rtpTimestamp(0),
+    m_datagramsSent(0),
+    m_datagramsDropped(0),
+    m_nbDestinations(0),
+    m_throughput(0.0f),
+    m_throughputTimeMs(nowMs()),
+    m_bytesSinceMeasure(0)
+{
+    m_socket = new QUdpSocket(parent);
+
+    if (!m_socket->bind(QHostAddress::AnyIPv4, 0)) { // bound socket has a descriptor for batched sends
+        qWarning("UDPMultiSender::UDPMultiSender: cannot bind socket");
+    }
+
+    m_batchBuffer.resize(m_maxBatchSize * m_maxDatagramSize);
+    m_batchSizes.resize(m_maxBatchSize);
+    std::random_device rd;
+    m_rtpSSRC = rd();
+    m_measureTimer.start();
+}
+
+UDPMultiSender::~UDPMultiSender()
+{
+    delete m_socket;
+}
+
+void UDPMultiSender::setDestinations(const QString& address, uint16_t port, const QString& extraDestinations)
+{
+    QHostAddress hostAddress;
+    m_destinations.clear();
+
+    if (hostAddress.setAddress(address) && (hostAddress.protocol() == QAbstractSocket::IPv4Protocol)) {
+        m_destinations.push_back(Destination(hostAddress, port));
+    } else {
+        qWarning("UDPMultiSender::setDestinations: invalid address %s", qPrintable(address));
+    }
+
+    parseDestinations(extraDestinations, m_destinations);
+    m_nbDestinations = m_destinations.size();
+    qDebug("UDPMultiSender::setDestinations: %u destinations", (unsigned int) m_destinations.size());
+}
+
+void UDPMultiSender::setMulticastTTL(int ttl)
+{
+    m_socket->setSocketOption(QAbstractSocket::MulticastTtlOption, ttl);
+}
+
+void UDPMultiSender::setRTP(bool rtp, int payloadType)
+{
+    m_rtp = rtp;
+    m_rtpPayloadType = payloadType & 0x7F;
+}
+
+void UDPMultiSender::parseDestinations(const QString& destinations, std::vector<Destination>& list)
+{
+    QStringList items = destinations.split(QRegExp("[,;\\s]+"), QString::SkipEmptyParts);
+
+    for (const QString& item : items)
+    {
+        QHostAddress hostAddress;
+        int sep = item.lastIndexOf(':');
+        bool ok = false;
+        unsigned int port = sep > 0 ? item.mid(sep + 1).toUInt(&ok) : 0;
+
+        if (!ok || (port == 0) || (port > 65535)
+            || !hostAddress.setAddress(item.left(sep))
+            || (hostAddress.protocol() != QAbstractSocket::IPv4Protocol))
+        {
+            qWarning("UDPMultiSender::parseDestinations: invalid destination %s", qPrintable(item));
+            continue;
+        }
+
+        list.push_back(Destination(hostAddress, port));
+    }
+}
+
+void UDPMultiSender::write(const char *payload, unsigned int size, uint32_t nbSamples)
+{
+    char *datagram = &m_batchBuffer[m_batchCount * m_maxDatagramSize];
+    unsigned int headerSize = 0;
+    size = std::min(size, m_maxDatagramSize - m_rtpHeaderSize);
+
+    if (m_rtp)
+    {
+        writeRTPHeader(datagram, nbSamples);
+        headerSize = m_rtpHeaderSize;
+    }
+
+    memcpy(datagram + headerSize, payload, size);
+    m_batchSizes[m_batchCount] = headerSize + size;
+    m_batchCount++;
+
+    if (m_batchCount == m_maxBatchSize) {
+        flush();
+    }
+}
+
+void UDPMultiSender::flush()
+{
+    if (m_batchCount == 0) {
+        return;
+    }
+
+    uint64_t nbDatagrams = m_batchCount * m_destinations.size();
+    uint64_t nbSent = sendBatch();
+    m_datagramsSent += nbSent;
+    m_datagramsDropped += nbDatagrams - nbSent;
+    m_batchCount = 0;
+
+    qint64 elapsed = m_measureTimer.elapsed();
+
+    if (elapsed >= m_measurePeriodMs)
+    {
+        m_throughput = (m_bytesSinceMeasure * 1000.0f) / elapsed;
+        m_throughputTimeMs = nowMs();
+        m_bytesSinceMeasure = 0;
+        m_measureTimer.restart();
+    }
+}
+
+int64_t UDPMultiSender::nowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+float UDPMultiSender::getThroughput() const
+{
+    // flush() updates the measure only while datagrams are sent. When no update came for two
+    // periods the stream is considered stopped and the last measure decays with the time elapsed.
+    int64_t age = nowMs() - m_throughputTimeMs.load();
+
+    if (age <= 2 * m_measurePeriodMs) {
+        return m_throughput.load();
+    }
+
+    return (m_throughput.load() * 2 * m_measurePeriodMs) / age;
+}
+
+void UDPMultiSender::writeRTPHeader(char *buffer, uint32_t nbSamples)
+{
+    buffer[0] = (char) 0x80; // version 2 no padding no extension no CSRC
+    buffer[1] = (char) m_rtpPayloadType; // no marker
+    buffer[2] = (char) (m_rtpSequence >> 8);
+    buffer[3] = (char) (m_rtpSequence & 0xFF);
+    buffer[4] = (char) (m_rtpTimestamp >> 24);
+    buffer[5] = (char) ((m_rtpTimestamp >> 16) & 0xFF);
+    buffer[6] = (char) ((m_rtpTimestamp >> 8) & 0xFF);
+    buffer[7] = (char) (m_rtpTimestamp & 0xFF);
+    buffer[8] = (char) (m_rtpSSRC >> 24);
+    buffer[9] = (char) ((m_rtpSSRC >> 16) & 0xFF);
+    buffer[10] = (char) ((m_rtpSSRC >> 8) & 0xFF);
+    buffer[11] = (char) (m_rtpSSRC & 0xFF);
+    m_rtpSequence++;
+    m_rtpTimestamp += nbSamples;
+}
+
+unsigned int UDPMultiSender::sendBatch()
+{
+    unsigned int nbSent = 0;
+
+#if defined(__linux__)
+    int fd = m_socket->socketDescriptor();
+
+    if (fd >= 0)
+    {
+        struct mmsghdr msgs[m_maxBatchSize];
+        struct iovec iovecs[m_maxBatchSize];
+
+        for (const Destination& destination : m_destinations)
+        {
+            struct sockaddr_in sockAddr;
+            memset(&sockAddr, 0, sizeof(sockAddr));
+            sockAddr.sin_family = AF_INET;
+            sockAddr.sin_port = htons(destination.m_port);
+            sockAddr.sin_addr.s_addr = htonl(destination.m_address.toIPv4Address());
+
+            for (unsigned int i = 0; i < m_batchCount; i++)
+            {
+                iovecs[i].iov_base = &m_batchBuffer[i * m_maxDatagramSize];
+                iovecs[i].iov_len = m_batchSizes[i];
+                memset(&msgs[i], 0, sizeof(struct mmsghdr));
+                msgs[i].msg_hdr.msg_name = &sockAddr;
+                msgs[i].msg_hdr.msg_namelen = sizeof(sockAddr);
+                msgs[i].msg_hdr.msg_iov = &iovecs[i];
+                msgs[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            unsigned int done = 0;
+
+            while (done < m_batchCount)
+            {
+                int res = sendmmsg(fd, &msgs[done], m_batchCount - done, 0);
+
+                if (res < 0)
+                {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+
+                    break; // socket buffer full or error: the rest of the batch is dropped for this destination
+                }
+
+                for (int i = 0; i < res; i++) {
+                    m_bytesSinceMeasure += msgs[done + i].msg_len;
+                }
+
+                done += res;
+            }
+
+            nbSent += done;
+        }
+
+        return nbSent;
+    }
+#endif
+
+    for (const Destination& destination : m_destinations)
+    {
+        for (unsigned int i = 0; i < m_batchCount; i++)
+        {
+            qint64 res = m_socket->writeDatagram(&m_batchBuffer[i * m_maxDatagramSize], m_batchSizes[i], destination.m_address, destination.m_port);
+
+            if (res >= 0)
+            {
+                m_bytesSinceMeasure += res;
+                nbSent++;
+            }
+        }
+    }
+
+    return nbSent;
+}
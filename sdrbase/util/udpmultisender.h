@@ -0,0 +1,105 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_UTIL_UDPMULTISENDER_H_
+#define INCLUDE_UTIL_UDPMULTISENDER_H_
+
+#include <atomic>
+#include <vector>
+
+#include <QString>
+#include <QHostAddress>
+#include <QElapsedTimer>
+
+#include "export.h"
+
+class QObject;
+class QUdpSocket;
+
+/**
+ * Sends the same stream of datagrams to a list of IPv4 destinations (unicast or multicast).
+ * Datagrams are queued and sent by batches with a single sendmmsg system call on Linux
+ * or one datagram at a time elsewhere. An optional 12 byte RTP header (RFC 3550) with
+ * sequence number and timestamp in samples is prepended to each datagram so that receivers
+ * can detect losses. Send failures (e.g. socket buffer full) are counted as dropped datagrams.
+ */
+class SDRBASE_API UDPMultiSender
+{
+public:
+    struct Destination
+    {
+        QHostAddress m_address;
+        uint16_t m_port;
+
+        Destination(const QHostAddress& address, uint16_t port) :
+            m_address(address),
+            m_port(port)
+        {}
+    };
+
+    UDPMultiSender(QObject *parent, unsigned int maxPayloadSize);
+    ~UDPMultiSender();
+
+    /**
+     * Set the destinations from the main address and port plus a list of additional destinations
+     * given as address:port items separated by commas or spaces. Invalid items are ignored.
+     */
+    void setDestinations(const QString& address, uint16_t port, const QString& extraDestinations);
+    void setMulticastTTL(int ttl);
+    void setRTP(bool rtp, int payloadType = 96);
+
+    void write(const char *payload, unsigned int size, uint32_t nbSamples); //!< Queue one datagram of nbSamples samples and send the batch if full
+    void flush(); //!< Send all queued datagrams
+
+    unsigned int getNbDestinations() const { return m_nbDestinations.load(); }
+    uint64_t getDatagramsSent() const { return m_datagramsSent.load(); }
+    uint64_t getDatagramsDropped() const { return m_datagramsDropped.load(); }
+    float getThroughput() const; //!< Bytes per second sent to all destinations. Decays when nothing is sent
+
+    static void parseDestinations(const QString& destinations, std::vector<Destination>& list);
+
+private:
+    static const unsigned int m_rtpHeaderSize = 12;
+    static const unsigned int m_maxBatchSize = 64; //!< Maximum number of queued datagrams
+    static const int64_t m_measurePeriodMs = 1000;
+
+    QUdpSocket *m_socket;
+    unsigned int m_maxDatagramSize;
+    std::vector<Destination> m_destinations;
+    std::vector<char> m_batchBuffer;
+    std::vector<unsigned int> m_batchSizes;
+    unsigned int m_batchCount;
+    bool m_rtp;
+    uint8_t m_rtpPayloadType;
+    uint16_t m_rtpSequence;
+    uint32_t m_rtpTimestamp;
+    uint32_t m_rtpSSRC;
+    std::atomic<uint64_t> m_datagramsSent;
+    std::atomic<uint64_t> m_datagramsDropped;
+    std::atomic<unsigned int> m_nbDestinations; //!< size of m_destinations for other threads
+    std::atomic<float> m_throughput;
+    std::atomic<int64_t> m_throughputTimeMs; //!< steady clock time of the last m_throughput update
+    uint64_t m_bytesSinceMeasure;
+    QElapsedTimer m_measureTimer;
+
+    static int64_t nowMs();
+
+    void writeRTPHeader(char *buffer, uint32_t nbSamples);
+    unsigned int sendBatch(); //!< Returns the number of datagrams actually sent
+};
+
+#endif /* INCLUDE_UTIL_UDPMULTISENDER_H_ */
@@ -20,70 +20,33 @@
 #define INCLUDE_UTIL_UDPSINK_H_
 
 #include <stdint.h>
-#include <QObject>
-#include <QUdpSocket>
-#include <QHostAddress>
+#include <string.h>
 
 #include <cassert>
 
+#include "util/udpmultisender.h"
+
+/**
+ * Packs samples of type T into fixed size datagrams handed over to a UDPMultiSender
+ * that sends them to its destinations. The sender may be shared by several sample buffers.
+ */
 template<typename T>
 class UDPSinkUtil
 {
 public:
-	UDPSinkUtil(QObject *parent, unsigned int udpSize) :
+	UDPSinkUtil(UDPMultiSender *sender, unsigned int udpSize) :
+		m_sender(sender),
 		m_udpSize(udpSize),
 		m_udpSamples(udpSize/sizeof(T)),
-		m_address(QHostAddress::LocalHost),
-		m_port(9999),
-		m_sampleBufferIndex(0)
-	{
-        assert(m_udpSamples > 0);
-		m_sampleBuffer = new T[m_udpSamples];
-		m_socket = new QUdpSocket(parent);
-	}
-
-    UDPSinkUtil(QObject *parent, unsigned int udpSize, unsigned int port) :
-        m_udpSize(udpSize),
-        m_udpSamples(udpSize/sizeof(T)),
-        m_address(QHostAddress::LocalHost),
-        m_port(port),
-        m_sampleBufferIndex(0)
-    {
-        assert(m_udpSamples > 0);
-        m_sampleBuffer = new T[m_udpSamples];
-        m_socket = new QUdpSocket(parent);
-    }
-
-	UDPSinkUtil (QObject *parent, unsigned int udpSize, QHostAddress& address, unsigned int port) :
-		m_udpSize(udpSize),
-        m_udpSamples(udpSize/sizeof(T)),
-		m_address(address),
-		m_port(port),
 		m_sampleBufferIndex(0)
 	{
 		assert(m_udpSamples > 0);
 		m_sampleBuffer = new T[m_udpSamples];
-		m_socket = new QUdpSocket(parent);
 	}
 
 	~UDPSinkUtil()
 	{
 		delete[] m_sampleBuffer;
-		delete m_socket;
-	}
-
-	void moveToThread(QThread *thread)
-	{
-	    m_socket->moveToThread(thread);
-	}
-
-	void setAddress(QString& address) { m_address.setAddress(address); }
-	void setPort(unsigned int port) { m_port = port; }
-
-	void setDestination(const QString& address, int port)
-	{
-	    m_address.setAddress(const_cast<QString&>(address));
-	    m_port = port;
 	}
 
 	/**
@@ -98,7 +61,7 @@ public:
 		}
 		else
 		{
-			m_socket->writeDatagram((const char*)&m_sampleBuffer[0], (qint64 ) m_udpSize, m_address, m_port);
+			m_sender->write((const char*)&m_sampleBuffer[0], m_udpSize, m_udpSamples);
 			m_sampleBuffer[0] = sample;
 			m_sampleBufferIndex = 1;
 		}
@@ -114,7 +77,7 @@ public:
 	    if (m_sampleBufferIndex + nbSamples > m_udpSamples) // fill remainder of buffer and send it
 	    {
 	        memcpy(&m_sampleBuffer[m_sampleBufferIndex], &samples[samplesIndex], (m_udpSamples - m_sampleBufferIndex)*sizeof(T)); // fill remainder of buffer
-	        m_socket->writeDatagram((const char*)&m_sampleBuffer[0], (qint64 ) m_udpSize, m_address, m_port); // send buffer
+	        m_sender->write((const char*)&m_sampleBuffer[0], m_udpSize, m_udpSamples); // send buffer
             samplesIndex += (m_udpSamples - m_sampleBufferIndex);
             nbSamples -= (m_udpSamples - m_sampleBufferIndex);
 	        m_sampleBufferIndex = 0;
@@ -122,21 +85,20 @@ public:
 
 	    while (nbSamples > m_udpSamples) // send directly from input without buffering
 	    {
-	        m_socket->writeDatagram((const char*)&samples[samplesIndex], (qint64 ) m_udpSize, m_address, m_port);
+	        m_sender->write((const char*)&samples[samplesIndex], m_udpSize, m_udpSamples);
 	        samplesIndex += m_udpSamples;
 	        nbSamples -= m_udpSamples;
 	    }
 
 	    memcpy(&m_sampleBuffer[m_sampleBufferIndex], &samples[samplesIndex], nbSamples*sizeof(T)); // copy remainder of input to buffer
+	    m_sampleBufferIndex += nbSamples;
 	}
 
 private:
+	UDPMultiSender *m_sender;
 	int m_udpSize;
-    int m_udpSamples;
-	QHostAddress m_address;
-	unsigned int m_port;
-	QUdpSocket *m_socket;
-	T *m_sampleBuffer;;
+	int m_udpSamples;
+	T *m_sampleBuffer;
 	int m_sampleBufferIndex;
 };
 
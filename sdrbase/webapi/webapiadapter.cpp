@@ -35,11 +35,14 @@
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
 #include "dsp/dspengine.h"
+#include "dsp/pipelinemetrics.h"
 #include "plugin/pluginapi.h"
 #include "plugin/pluginmanager.h"
 #include "channel/channelapi.h"
 #include "webapi/webapiadapterbase.h"
 #include "util/serialutil.h"
+#include "webapi/webapiutils.h"
+#include "util/messagequeue.h"
 
 #include "SWGInstanceSummaryResponse.h"
 #include "SWGInstanceConfigResponse.h"
@@ -47,10 +50,16 @@
 #include "SWGInstanceChannelsResponse.h"
 #include "SWGDeviceListItem.h"
 #include "SWGAudioDevices.h"
+#include "SWGAudioOutputStream.h"
 #include "SWGLocationInformation.h"
 #include "SWGDVSerialDevices.h"
 #include "SWGDVSerialDevice.h"
 #include "SWGAMBEDevices.h"
+#include "SWGPipelineMetrics.h"
+#include "SWGWaterfallSettings.h"
+#include "SWGWaterfallReport.h"
+#include "SWGWaterfallZoomLevel.h"
+#include "SWGWaterfallTile.h"
 #include "SWGPresets.h"
 #include "SWGPresetGroup.h"
 #include "SWGPresetItem.h"
@@ -63,6 +72,7 @@
 #include "SWGChannelsDetail.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
+#include "SWGChannelExecutorReport.h"
 #include "SWGChannelActions.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
@@ -400,6 +410,77 @@ int WebAPIAdapter::instanceLoggingPut(
     return 200;
 }
 
+int WebAPIAdapter::instanceMetricsGet(
+        SWGSDRangel::SWGPipelineMetrics& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    (void) error;
+    PipelineMetrics *metrics = PipelineMetrics::instance();
+    response.init();
+    response.setEnabled(PipelineMetrics::isEnabled() ? 1 : 0);
+    response.setCoalescedMessages(MessageQueue::getTotalCoalescedCount());
+    QList<SWGSDRangel::SWGPipelineStageMetrics*> *stages = response.getStages();
+
+    for (int i = 0; i < PipelineMetrics::NbStages; i++)
+    {
+        PipelineMetrics::StageSnapshot snapshot;
+        metrics->getSnapshot((PipelineMetrics::Stage) i, snapshot);
+        stages->append(new SWGSDRangel::SWGPipelineStageMetrics);
+        stages->back()->init();
+        *stages->back()->getName() = PipelineMetrics::getStageName((PipelineMetrics::Stage) i);
+        stages->back()->setBlocks(snapshot.m_blocks);
+        stages->back()->setSamples(snapshot.m_samples);
+        stages->back()->setTotalTimeNs(snapshot.m_totalNs);
+        stages->back()->setMaxTimeNs(snapshot.m_maxNs);
+        stages->back()->setFifoFillHighWater(snapshot.m_fillHighWater);
+        stages->back()->setOverflows(snapshot.m_overflows);
+        stages->back()->setUnderruns(snapshot.m_underruns);
+        QList<SWGSDRangel::SWGPipelineHistogramBucket*> *histogram = stages->back()->getHistogram();
+
+        for (int j = 0; j < PipelineMetrics::m_nbHistogramBuckets; j++)
+        {
+            histogram->append(new SWGSDRangel::SWGPipelineHistogramBucket);
+            histogram->back()->init();
+            histogram->back()->setUpperBoundNs(PipelineMetrics::getBucketUpperBoundNs(j));
+            histogram->back()->setCount(snapshot.m_histogram[j]);
+        }
+    }
+
+    return 200;
+}
+
+int WebAPIAdapter::instanceMetricsPut(
+        SWGSDRangel::SWGPipelineMetrics& query,
+        SWGSDRangel::SWGPipelineMetrics& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    PipelineMetrics::setEnabled(query.getEnabled() != 0);
+    return instanceMetricsGet(response, error);
+}
+
+int WebAPIAdapter::instanceMetricsDelete(
+        SWGSDRangel::SWGSuccessResponse& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    (void) error;
+    PipelineMetrics::instance()->reset();
+
+    response.init();
+    *response.getMessage() = QString("Pipeline metrics reset");
+
+    return 200;
+}
+
+int WebAPIAdapter::instanceMetricsPrometheusGet(
+        QString& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    (void) error;
+    response = PipelineMetrics::instance()->formatPrometheus();
+
+    return 200;
+}
+
 int WebAPIAdapter::instanceAudioGet(
         SWGSDRangel::SWGAudioDevices& response,
         SWGSDRangel::SWGErrorResponse& error)
@@ -461,6 +542,7 @@ int WebAPIAdapter::instanceAudioGet(
     outputDevices->back()->setUdpDecimationFactor((int) outputDeviceInfo.udpDecimationFactor);
     *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
     outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+    getAudioOutputStreams(outputDevices->back()->getStreams(), -1);
 
     // real output devices
     for (int i = 0; i < nbOutputDevices; i++)
@@ -481,11 +563,29 @@ int WebAPIAdapter::instanceAudioGet(
         outputDevices->back()->setUdpDecimationFactor((int) outputDeviceInfo.udpDecimationFactor);
         *outputDevices->back()->getUdpAddress() = outputDeviceInfo.udpAddress;
         outputDevices->back()->setUdpPort(outputDeviceInfo.udpPort);
+        getAudioOutputStreams(outputDevices->back()->getStreams(), i);
     }
 
     return 200;
 }
 
+void WebAPIAdapter::getAudioOutputStreams(QList<SWGSDRangel::SWGAudioOutputStream*> *streams, int outputDeviceIndex)
+{
+    std::vector<AudioMixer::StreamStats> stats;
+    DSPEngine::instance()->getAudioDeviceManager()->getOutputStreamsStats(outputDeviceIndex, stats);
+
+    for (std::vector<AudioMixer::StreamStats>::const_iterator it = stats.begin(); it != stats.end(); ++it)
+    {
+        streams->append(new SWGSDRangel::SWGAudioOutputStream);
+        streams->back()->setSampleRate(it->m_sampleRate);
+        streams->back()->setGain(it->m_gain);
+        streams->back()->setPan(it->m_pan);
+        streams->back()->setFill(it->m_fill);
+        streams->back()->setUnderrunCount(it->m_underruns);
+        streams->back()->setOverrunCount(it->m_overruns);
+    }
+}
+
 int WebAPIAdapter::instanceAudioInputPatch(
         SWGSDRangel::SWGAudioInputDevice& response,
         const QStringList& audioInputKeys,
@@ -812,19 +912,26 @@ int WebAPIAdapter::instanceAMBEDevicesGet(
     DSPEngine *dspEngine = DSPEngine::instance();
     response.init();
 
-    std::vector<std::string> deviceNames;
-    dspEngine->getDVSerialNames(deviceNames);
-    response.setNbDevices((int) deviceNames.size());
+    std::vector<AMBEEngine::DeviceStats> devicesStats;
+    dspEngine->getAMBEEngine()->getDevicesStats(devicesStats);
+    response.setNbDevices((int) devicesStats.size());
+    response.setDroppedFrames(dspEngine->getAMBEEngine()->getNbDroppedFrames());
     QList<SWGSDRangel::SWGAMBEDevice*> *deviceNamesList = response.getAmbeDevices();
 
-    std::vector<std::string>::iterator it = deviceNames.begin();
+    std::vector<AMBEEngine::DeviceStats>::const_iterator it = devicesStats.begin();
 
-    while (it != deviceNames.end())
+    while (it != devicesStats.end())
     {
         deviceNamesList->append(new SWGSDRangel::SWGAMBEDevice);
         deviceNamesList->back()->init();
-        *deviceNamesList->back()->getDeviceRef() = QString::fromStdString(*it);
+        *deviceNamesList->back()->getDeviceRef() = it->m_deviceRef;
         deviceNamesList->back()->setDelete(0);
+        deviceNamesList->back()->setQueueDepth(it->m_queueDepth);
+        deviceNamesList->back()->setNbStreams(it->m_nbStreams);
+        deviceNamesList->back()->setFramesDecoded(it->m_framesDecoded);
+        deviceNamesList->back()->setFramesFailed(it->m_framesFailed);
+        deviceNamesList->back()->setMeanLatencyMs(it->m_meanLatencyMs);
+        deviceNamesList->back()->setMaxLatencyMs(it->m_maxLatencyMs);
         ++it;
     }
 
@@ -1469,6 +1576,228 @@ int WebAPIAdapter::devicesetFocusPatch(
     }
 }
 
+int WebAPIAdapter::devicesetWaterfallGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGWaterfallSettings& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+
+        if (!deviceSet->m_deviceSourceEngine)
+        {
+            error.init();
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 404;
+        }
+
+        response.init();
+        getWaterfallSettings(response, deviceSet->getWaterfallTilesSettings(), deviceSet->getWaterfallTiles() != nullptr);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetWaterfallPutPatch(
+        int deviceSetIndex,
+        bool force,
+        const QStringList& waterfallSettingsKeys,
+        SWGSDRangel::SWGWaterfallSettings& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+
+        if (!deviceSet->m_deviceSourceEngine)
+        {
+            error.init();
+            *error.getMessage() = QString("Device set at %1 is not a receive device set").arg(deviceSetIndex);
+            return 404;
+        }
+
+        WaterfallTiles::Settings settings = deviceSet->getWaterfallTilesSettings();
+        bool enabled = deviceSet->getWaterfallTiles() != nullptr;
+
+        if (force) {
+            settings.resetToDefaults();
+        }
+        if (waterfallSettingsKeys.contains("enabled") || force) {
+            enabled = response.getEnabled() != 0;
+        }
+        if (waterfallSettingsKeys.contains("fftSize")) {
+            settings.m_fftSize = response.getFftSize();
+        }
+        if (waterfallSettingsKeys.contains("lineRate")) {
+            settings.m_lineRate = response.getLineRate();
+        }
+        if (waterfallSettingsKeys.contains("minLevel")) {
+            settings.m_minLevel = response.getMinLevel();
+        }
+        if (waterfallSettingsKeys.contains("maxLevel")) {
+            settings.m_maxLevel = response.getMaxLevel();
+        }
+        if (waterfallSettingsKeys.contains("tileLines")) {
+            settings.m_tileLines = response.getTileLines();
+        }
+        if (waterfallSettingsKeys.contains("tileBins")) {
+            settings.m_tileBins = response.getTileBins();
+        }
+        if (waterfallSettingsKeys.contains("nbZoomLevels")) {
+            settings.m_nbZoomLevels = response.getNbZoomLevels();
+        }
+        if (waterfallSettingsKeys.contains("memoryTiles")) {
+            settings.m_memoryTiles = response.getMemoryTiles();
+        }
+        if (waterfallSettingsKeys.contains("directory") && response.getDirectory()) {
+            settings.m_directory = *response.getDirectory();
+        }
+
+        deviceSet->applyWaterfallTilesSettings(settings, enabled);
+        std::shared_ptr<WaterfallTiles> waterfallTiles = deviceSet->getWaterfallTiles();
+
+        if (waterfallTiles) { // sanitized values
+            settings = waterfallTiles->getSettings();
+        }
+
+        getWaterfallSettings(response, settings, enabled);
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetWaterfallReportGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGWaterfallReport& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        std::shared_ptr<WaterfallTiles> waterfallTiles = m_mainCore->m_deviceSets[deviceSetIndex]->getWaterfallTiles();
+
+        if (!waterfallTiles)
+        {
+            error.init();
+            *error.getMessage() = QString("Waterfall tiles are not enabled on device set %1").arg(deviceSetIndex);
+            return 404;
+        }
+
+        std::vector<WaterfallTiles::ZoomStatus> zoomStatus;
+        qint64 nbLines;
+        quint64 centerFrequency;
+        int sampleRate, fftSize;
+        waterfallTiles->getStatus(zoomStatus, nbLines);
+        waterfallTiles->getSignalParameters(centerFrequency, sampleRate, fftSize);
+
+        response.init();
+        *response.getSession() = waterfallTiles->getSessionName();
+        response.setNbLines(nbLines);
+        response.setCenterFrequency(centerFrequency);
+        response.setSampleRate(sampleRate);
+        response.setFftSize(fftSize);
+        QList<SWGSDRangel::SWGWaterfallZoomLevel*> *zoomLevels = response.getZoomLevels();
+
+        for (int zoom = 0; zoom < (int) zoomStatus.size(); zoom++)
+        {
+            zoomLevels->append(new SWGSDRangel::SWGWaterfallZoomLevel);
+            zoomLevels->back()->init();
+            zoomLevels->back()->setZoom(zoom);
+            zoomLevels->back()->setFirstTimeIndex(zoomStatus[zoom].m_firstTimeIndex);
+            zoomLevels->back()->setLastTimeIndex(zoomStatus[zoom].m_lastTimeIndex);
+            zoomLevels->back()->setMemoryTimeIndex(zoomStatus[zoom].m_memoryTimeIndex);
+            zoomLevels->back()->setNbFreqTiles(zoomStatus[zoom].m_nbFreqTiles);
+            zoomLevels->back()->setFirstStartMs(zoomStatus[zoom].m_firstStartMs);
+            zoomLevels->back()->setLastEndMs(zoomStatus[zoom].m_lastEndMs);
+        }
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
+int WebAPIAdapter::devicesetWaterfallTileGet(
+        int deviceSetIndex,
+        int zoom,
+        qint64 timeIndex,
+        qint64 timestampMs,
+        int freqIndex,
+        SWGSDRangel::SWGWaterfallTile& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore->m_deviceSets.size()))
+    {
+        std::shared_ptr<WaterfallTiles> waterfallTiles = m_mainCore->m_deviceSets[deviceSetIndex]->getWaterfallTiles();
+
+        if (!waterfallTiles)
+        {
+            error.init();
+            *error.getMessage() = QString("Waterfall tiles are not enabled on device set %1").arg(deviceSetIndex);
+            return 404;
+        }
+
+        if (timeIndex < 0) {
+            timeIndex = waterfallTiles->getTimeIndex(zoom, timestampMs);
+        }
+
+        WaterfallTiles::Tile tile;
+
+        if (!waterfallTiles->getTile(zoom, timeIndex, freqIndex, tile))
+        {
+            error.init();
+            *error.getMessage() = QString("There is no tile at zoom %1 time index %2 frequency index %3")
+                .arg(zoom).arg(timeIndex).arg(freqIndex);
+            return 404;
+        }
+
+        response.init();
+        response.setZoom(tile.m_zoom);
+        response.setTimeIndex(tile.m_timeIndex);
+        response.setFreqIndex(tile.m_freqIndex);
+        response.setLines(tile.m_lines);
+        response.setBins(tile.m_bins);
+        response.setFilledLines(tile.m_filledLines);
+        response.setStartMs(tile.m_startMs);
+        response.setEndMs(tile.m_endMs);
+        response.setCenterFrequency(tile.m_centerFrequency);
+        response.setSampleRate(tile.m_sampleRate);
+        response.setFftSize(tile.m_fftSize);
+        response.setMinLevel(tile.m_minLevel);
+        response.setMaxLevel(tile.m_maxLevel);
+        *response.getData() = QString(QByteArray(
+            (const char *) tile.m_data.data(), tile.m_filledLines * tile.m_bins).toBase64());
+
+        return 200;
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+
+        return 404;
+    }
+}
+
 int WebAPIAdapter::devicesetDevicePut(
         int deviceSetIndex,
         SWGSDRangel::SWGDeviceListItem& query,
@@ -1805,6 +2134,94 @@ int WebAPIAdapter::devicesetDeviceSettingsPutPatch(
     }
 }
 
+int WebAPIAdapter::devicesetDeviceSettingsFieldGet(
+        int deviceSetIndex,
+        SettingsField field,
+        double& value,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex < 0) || (deviceSetIndex >= (int) m_mainCore->m_deviceSets.size()))
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+
+    if (field != SettingsFieldCenterFrequency)
+    {
+        *error.getMessage() = QString("%1 is not a device settings field").arg(getSettingsFieldName(field));
+        return 400;
+    }
+
+    DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+
+    if (deviceSet->m_deviceSourceEngine) // Single Rx
+    {
+        value = deviceSet->m_deviceAPI->getSampleSource()->getCenterFrequency();
+        return 200;
+    }
+    else if (deviceSet->m_deviceSinkEngine) // Single Tx
+    {
+        value = deviceSet->m_deviceAPI->getSampleSink()->getCenterFrequency();
+        return 200;
+    }
+    else if (deviceSet->m_deviceMIMOEngine) // MIMO: first Rx stream
+    {
+        value = deviceSet->m_deviceAPI->getSampleMIMO()->getSourceCenterFrequency(0);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("DeviceSet error");
+        return 500;
+    }
+}
+
+int WebAPIAdapter::devicesetDeviceSettingsFieldPatch(
+        int deviceSetIndex,
+        SettingsField field,
+        double value,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex < 0) || (deviceSetIndex >= (int) m_mainCore->m_deviceSets.size()))
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+
+    if (field != SettingsFieldCenterFrequency)
+    {
+        *error.getMessage() = QString("%1 is not a device settings field").arg(getSettingsFieldName(field));
+        return 400;
+    }
+
+    DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+
+    if (deviceSet->m_deviceSourceEngine) // Single Rx
+    {
+        deviceSet->m_deviceAPI->getSampleSource()->setCenterFrequency((qint64) value);
+        return 200;
+    }
+    else if (deviceSet->m_deviceSinkEngine) // Single Tx
+    {
+        deviceSet->m_deviceAPI->getSampleSink()->setCenterFrequency((qint64) value);
+        return 200;
+    }
+    else if (deviceSet->m_deviceMIMOEngine) // MIMO: first Rx stream
+    {
+        deviceSet->m_deviceAPI->getSampleMIMO()->setSourceCenterFrequency((qint64) value, 0);
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("DeviceSet error");
+        return 500;
+    }
+}
+
 int WebAPIAdapter::devicesetDeviceRunGet(
         int deviceSetIndex,
         SWGSDRangel::SWGDeviceState& response,
@@ -2341,6 +2758,159 @@ int WebAPIAdapter::devicesetChannelSettingsGet(
     }
 }
 
+int WebAPIAdapter::devicesetChannelSettingsFieldGet(
+        int deviceSetIndex,
+        int channelIndex,
+        SettingsField field,
+        double& value,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    int httpRC;
+    ChannelAPI *channelAPI = getChannelAPI(deviceSetIndex, channelIndex, error, httpRC);
+
+    if (!channelAPI) {
+        return httpRC;
+    }
+
+    if (field == SettingsFieldInputFrequencyOffset)
+    {
+        value = channelAPI->getCenterFrequency();
+        return 200;
+    }
+    else if (field == SettingsFieldRfBandwidth)
+    {
+        if (channelAPI->getRfBandwidth(value)) {
+            return 200;
+        }
+
+        // channel without direct access to its fields: look in its JSON settings
+        SWGSDRangel::SWGChannelSettings channelSettings;
+        httpRC = devicesetChannelSettingsGet(deviceSetIndex, channelIndex, channelSettings, error);
+
+        if (httpRC/100 != 2) {
+            return httpRC;
+        }
+
+        QJsonObject *jsonObj = channelSettings.asJsonObject();
+        bool found = WebAPIUtils::getSubObjectDouble(*jsonObj, "rfBandwidth", value);
+        delete jsonObj;
+
+        if (found) {
+            return 200;
+        }
+
+        error.init();
+        *error.getMessage() = QString("Channel %1 has no RF bandwidth").arg(channelIndex);
+        return 501;
+    }
+    else
+    {
+        *error.getMessage() = QString("%1 is not a channel settings field").arg(getSettingsFieldName(field));
+        return 400;
+    }
+}
+
+int WebAPIAdapter::devicesetChannelSettingsFieldPatch(
+        int deviceSetIndex,
+        int channelIndex,
+        SettingsField field,
+        double value,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    ChannelSettingsFields fields;
+
+    if (field == SettingsFieldInputFrequencyOffset)
+    {
+        fields.setInputFrequencyOffset((qint64) value);
+    }
+    else if (field == SettingsFieldRfBandwidth)
+    {
+        fields.setRfBandwidth(value);
+    }
+    else
+    {
+        error.init();
+        *error.getMessage() = QString("%1 is not a channel settings field").arg(getSettingsFieldName(field));
+        return 400;
+    }
+
+    return devicesetChannelSettingsFieldsPatch(deviceSetIndex, channelIndex, fields, error);
+}
+
+int WebAPIAdapter::devicesetChannelSettingsFieldsPatch(
+        int deviceSetIndex,
+        int channelIndex,
+        const ChannelSettingsFields& fields,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    int httpRC;
+    ChannelAPI *channelAPI = getChannelAPI(deviceSetIndex, channelIndex, error, httpRC);
+
+    if (!channelAPI) {
+        return httpRC;
+    }
+
+    if (channelAPI->setSettingsFields(fields)) {
+        return 200;
+    }
+
+    // channel without direct setting of its fields: patch its JSON settings with all the fields at once
+    SWGSDRangel::SWGChannelSettings channelSettings;
+    httpRC = devicesetChannelSettingsGet(deviceSetIndex, channelIndex, channelSettings, error);
+
+    if (httpRC/100 != 2) {
+        return httpRC;
+    }
+
+    QJsonObject *jsonObj = channelSettings.asJsonObject();
+    QStringList channelSettingsKeys;
+    bool found = true;
+
+    if (fields.m_hasInputFrequencyOffset)
+    {
+        found = found && WebAPIUtils::setSubObjectDouble(*jsonObj, "inputFrequencyOffset", fields.m_inputFrequencyOffset);
+        channelSettingsKeys.append("inputFrequencyOffset");
+    }
+
+    if (fields.m_hasRfBandwidth)
+    {
+        found = found && WebAPIUtils::setSubObjectDouble(*jsonObj, "rfBandwidth", fields.m_rfBandwidth);
+        channelSettingsKeys.append("rfBandwidth");
+    }
+
+    if (!found)
+    {
+        delete jsonObj;
+        error.init();
+        *error.getMessage() = QString("Channel %1 does not have all of the %2 settings")
+            .arg(channelIndex).arg(channelSettingsKeys.join(", "));
+        return 501;
+    }
+
+    channelSettings.init();
+    channelSettings.fromJsonObject(*jsonObj);
+    delete jsonObj;
+
+    return devicesetChannelSettingsPutPatch(deviceSetIndex, channelIndex, false, channelSettingsKeys, channelSettings, error);
+}
+
+int WebAPIAdapter::devicesetChannelTypeGet(
+        int deviceSetIndex,
+        int channelIndex,
+        QString& channelType,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    int httpRC;
+    ChannelAPI *channelAPI = getChannelAPI(deviceSetIndex, channelIndex, error, httpRC);
+
+    if (!channelAPI) {
+        return httpRC;
+    }
+
+    channelAPI->getIdentifier(channelType);
+    return 200;
+}
+
 int WebAPIAdapter::devicesetChannelReportGet(
             int deviceSetIndex,
             int channelIndex,
@@ -2367,7 +2937,9 @@ int WebAPIAdapter::devicesetChannelReportGet(
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
                 response.setDirection(0);
-                return channelAPI->webapiReportGet(response, *error.getMessage());
+                int httpRC = channelAPI->webapiReportGet(response, *error.getMessage());
+                getChannelExecutorReport(channelAPI, response);
+                return httpRC;
             }
         }
         else if (deviceSet->m_deviceSinkEngine) // Single Tx
@@ -2384,7 +2956,9 @@ int WebAPIAdapter::devicesetChannelReportGet(
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
                 response.setDirection(1);
-                return channelAPI->webapiReportGet(response, *error.getMessage());
+                int httpRC = channelAPI->webapiReportGet(response, *error.getMessage());
+                getChannelExecutorReport(channelAPI, response);
+                return httpRC;
             }
         }
         else if (deviceSet->m_deviceMIMOEngine) // MIMO
@@ -2419,7 +2993,9 @@ int WebAPIAdapter::devicesetChannelReportGet(
             {
                 response.setChannelType(new QString());
                 channelAPI->getIdentifier(*response.getChannelType());
-                return channelAPI->webapiReportGet(response, *error.getMessage());
+                int httpRC = channelAPI->webapiReportGet(response, *error.getMessage());
+                getChannelExecutorReport(channelAPI, response);
+                return httpRC;
             }
             else
             {
@@ -3389,6 +3965,58 @@ int WebAPIAdapter::featuresetGet(
     }
 }
 
+ChannelAPI *WebAPIAdapter::getChannelAPI(int deviceSetIndex, int channelIndex, SWGSDRangel::SWGErrorResponse& error, int& httpRC)
+{
+    error.init();
+
+    if ((deviceSetIndex < 0) || (deviceSetIndex >= (int) m_mainCore->m_deviceSets.size()))
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        httpRC = 404;
+        return nullptr;
+    }
+
+    DeviceSet *deviceSet = m_mainCore->m_deviceSets[deviceSetIndex];
+    ChannelAPI *channelAPI = nullptr;
+
+    if (deviceSet->m_deviceSourceEngine) // Single Rx
+    {
+        channelAPI = deviceSet->m_deviceAPI->getChanelSinkAPIAt(channelIndex);
+    }
+    else if (deviceSet->m_deviceSinkEngine) // Single Tx
+    {
+        channelAPI = deviceSet->m_deviceAPI->getChanelSourceAPIAt(channelIndex);
+    }
+    else if (deviceSet->m_deviceMIMOEngine) // MIMO
+    {
+        int nbSinkChannels = deviceSet->m_deviceAPI->getNbSinkChannels();
+        int nbSourceChannels = deviceSet->m_deviceAPI->getNbSourceChannels();
+        int nbMIMOChannels = deviceSet->m_deviceAPI->getNbMIMOChannels();
+
+        if (channelIndex < nbSinkChannels) {
+            channelAPI = deviceSet->m_deviceAPI->getChanelSinkAPIAt(channelIndex);
+        } else if (channelIndex < nbSinkChannels + nbSourceChannels) {
+            channelAPI = deviceSet->m_deviceAPI->getChanelSourceAPIAt(channelIndex - nbSinkChannels);
+        } else if (channelIndex < nbSinkChannels + nbSourceChannels + nbMIMOChannels) {
+            channelAPI = deviceSet->m_deviceAPI->getMIMOChannelAPIAt(channelIndex - nbSinkChannels - nbSourceChannels);
+        }
+    }
+    else
+    {
+        *error.getMessage() = QString("DeviceSet error");
+        httpRC = 500;
+        return nullptr;
+    }
+
+    if (!channelAPI)
+    {
+        *error.getMessage() = QString("There is no channel with index %1").arg(channelIndex);
+        httpRC = 404;
+    }
+
+    return channelAPI;
+}
+
 void WebAPIAdapter::getFeatureSetList(SWGSDRangel::SWGFeatureSetList* featureSetList)
 {
     featureSetList->init();
@@ -3426,6 +4054,24 @@ void WebAPIAdapter::getFeatureSet(SWGSDRangel::SWGFeatureSet *swgFeatureSet, con
     }
 }
 
+void WebAPIAdapter::getChannelExecutorReport(const ChannelAPI *channelAPI, SWGSDRangel::SWGChannelReport& response)
+{
+    const BasebandExecutor::Task *executorTask = channelAPI->getExecutorTask();
+
+    if (!executorTask) {
+        return;
+    }
+
+    SWGSDRangel::SWGChannelExecutorReport *executorReport = new SWGSDRangel::SWGChannelExecutorReport();
+    executorReport->init();
+    executorReport->setRunCount(executorTask->getRunCount());
+    executorReport->setStolenCount(executorTask->getStolenCount());
+    executorReport->setRunTimeMs(executorTask->getRunTimeNs() / 1000000.0f);
+    executorReport->setLoad(executorTask->getLoad());
+    executorReport->setAffinityGroup(executorTask->getAffinityGroup());
+    response.setExecutorReport(executorReport);
+}
+
 QtMsgType WebAPIAdapter::getMsgTypeFromString(const QString& msgTypeString)
 {
     if (msgTypeString == "debug") {
@@ -3463,3 +4109,22 @@ void WebAPIAdapter::getMsgTypeString(const QtMsgType& msgType, QString& levelStr
         break;
     }
 }
+
+void WebAPIAdapter::getWaterfallSettings(SWGSDRangel::SWGWaterfallSettings& response, const WaterfallTiles::Settings& settings, bool enabled)
+{
+    response.setEnabled(enabled ? 1 : 0);
+    response.setFftSize(settings.m_fftSize);
+    response.setLineRate(settings.m_lineRate);
+    response.setMinLevel(settings.m_minLevel);
+    response.setMaxLevel(settings.m_maxLevel);
+    response.setTileLines(settings.m_tileLines);
+    response.setTileBins(settings.m_tileBins);
+    response.setNbZoomLevels(settings.m_nbZoomLevels);
+    response.setMemoryTiles(settings.m_memoryTiles);
+
+    if (response.getDirectory()) {
+        *response.getDirectory() = settings.m_directory;
+    } else {
+        response.setDirectory(new QString(settings.m_directory));
+    }
+}
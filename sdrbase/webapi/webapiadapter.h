@@ -23,11 +23,13 @@
 #include <QtGlobal>
 
 #include "webapi/webapiadapterinterface.h"
+#include "dsp/waterfalltiles.h"
 #include "export.h"
 
 class MainCore;
 class DeviceSet;
 class FeatureSet;
+class ChannelAPI;
 
 class SDRBASE_API WebAPIAdapter: public WebAPIAdapterInterface
 {
@@ -73,6 +75,23 @@ public:
             SWGSDRangel::SWGLoggingInfo& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int instanceMetricsGet(
+            SWGSDRangel::SWGPipelineMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int instanceMetricsPut(
+            SWGSDRangel::SWGPipelineMetrics& query,
+            SWGSDRangel::SWGPipelineMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int instanceMetricsDelete(
+            SWGSDRangel::SWGSuccessResponse& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int instanceMetricsPrometheusGet(
+            QString& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int instanceAudioGet(
             SWGSDRangel::SWGAudioDevices& response,
             SWGSDRangel::SWGErrorResponse& error);
@@ -218,6 +237,32 @@ public:
             SWGSDRangel::SWGSuccessResponse& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetWaterfallGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGWaterfallSettings& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetWaterfallPutPatch(
+            int deviceSetIndex,
+            bool force,
+            const QStringList& waterfallSettingsKeys,
+            SWGSDRangel::SWGWaterfallSettings& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetWaterfallReportGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGWaterfallReport& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetWaterfallTileGet(
+            int deviceSetIndex,
+            int zoom,
+            qint64 timeIndex,
+            qint64 timestampMs,
+            int freqIndex,
+            SWGSDRangel::SWGWaterfallTile& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int devicesetDevicePut(
             int deviceSetIndex,
             SWGSDRangel::SWGDeviceListItem& query,
@@ -243,6 +288,18 @@ public:
             SWGSDRangel::SWGDeviceSettings& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetDeviceSettingsFieldGet(
+            int deviceSetIndex,
+            SettingsField field,
+            double& value,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDeviceSettingsFieldPatch(
+            int deviceSetIndex,
+            SettingsField field,
+            double value,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int devicesetDeviceRunGet(
             int deviceSetIndex,
             SWGSDRangel::SWGDeviceState& response,
@@ -320,6 +377,32 @@ public:
             SWGSDRangel::SWGChannelSettings& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetChannelSettingsFieldGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SettingsField field,
+            double& value,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetChannelSettingsFieldPatch(
+            int deviceSetIndex,
+            int channelIndex,
+            SettingsField field,
+            double value,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetChannelSettingsFieldsPatch(
+            int deviceSetIndex,
+            int channelIndex,
+            const ChannelSettingsFields& fields,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetChannelTypeGet(
+            int deviceSetIndex,
+            int channelIndex,
+            QString& channelType,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int devicesetChannelReportGet(
             int deviceSetIndex,
             int channelIndex,
@@ -395,10 +478,14 @@ private:
     void getDeviceSetList(SWGSDRangel::SWGDeviceSetList* deviceSetList);
     void getDeviceSet(SWGSDRangel::SWGDeviceSet *swgDeviceSet, const DeviceSet* deviceSet, int deviceSetIndex);
     void getChannelsDetail(SWGSDRangel::SWGChannelsDetail *channelsDetail, const DeviceSet* deviceSet);
+    ChannelAPI *getChannelAPI(int deviceSetIndex, int channelIndex, SWGSDRangel::SWGErrorResponse& error, int& httpRC);
     void getFeatureSetList(SWGSDRangel::SWGFeatureSetList* featureSetList);
     void getFeatureSet(SWGSDRangel::SWGFeatureSet *swgFeatureSet, const FeatureSet* featureSet, int featureSetIndex);
+    void getAudioOutputStreams(QList<SWGSDRangel::SWGAudioOutputStream*> *streams, int outputDeviceIndex);
+    static void getChannelExecutorReport(const ChannelAPI *channelAPI, SWGSDRangel::SWGChannelReport& response);
     static QtMsgType getMsgTypeFromString(const QString& msgTypeString);
     static void getMsgTypeString(const QtMsgType& msgType, QString& level);
+    static void getWaterfallSettings(SWGSDRangel::SWGWaterfallSettings& response, const WaterfallTiles::Settings& settings, bool enabled);
 };
 
 #endif /* SDRBASE_WEBAPI_WEBAPIADAPTERGUI_H_ */
@@ -24,6 +24,8 @@ QString WebAPIAdapterInterface::instanceConfigURL = "/sdrangel/config";
 QString WebAPIAdapterInterface::instanceDevicesURL = "/sdrangel/devices";
 QString WebAPIAdapterInterface::instanceChannelsURL = "/sdrangel/channels";
 QString WebAPIAdapterInterface::instanceLoggingURL = "/sdrangel/logging";
+QString WebAPIAdapterInterface::instanceMetricsURL = "/sdrangel/metrics";
+QString WebAPIAdapterInterface::instanceMetricsPrometheusURL = "/sdrangel/metrics/prometheus";
 QString WebAPIAdapterInterface::instanceAudioURL = "/sdrangel/audio";
 QString WebAPIAdapterInterface::instanceAudioInputParametersURL = "/sdrangel/audio/input/parameters";
 QString WebAPIAdapterInterface::instanceAudioOutputParametersURL = "/sdrangel/audio/output/parameters";
@@ -44,8 +46,12 @@ QString WebAPIAdapterInterface::instanceDeviceSetURL = "/sdrangel/deviceset";
 
 std::regex WebAPIAdapterInterface::devicesetURLRe("^/sdrangel/deviceset/([0-9]{1,2})$");
 std::regex WebAPIAdapterInterface::devicesetFocusURLRe("^/sdrangel/deviceset/([0-9]{1,2})/focus$");
+std::regex WebAPIAdapterInterface::devicesetWaterfallURLRe("^/sdrangel/deviceset/([0-9]{1,2})/waterfall$");
+std::regex WebAPIAdapterInterface::devicesetWaterfallReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/waterfall/report$");
+std::regex WebAPIAdapterInterface::devicesetWaterfallTileURLRe("^/sdrangel/deviceset/([0-9]{1,2})/waterfall/tile$");
 std::regex WebAPIAdapterInterface::devicesetDeviceURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device$");
 std::regex WebAPIAdapterInterface::devicesetDeviceSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/settings$");
+std::regex WebAPIAdapterInterface::devicesetDeviceSettingsFieldURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/settings/([A-Za-z]+)$");
 std::regex WebAPIAdapterInterface::devicesetDeviceRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/run$");
 std::regex WebAPIAdapterInterface::devicesetDeviceSubsystemRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/subdevice/([0-9]{1,2})/run$");
 std::regex WebAPIAdapterInterface::devicesetDeviceReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/report$");
@@ -54,6 +60,7 @@ std::regex WebAPIAdapterInterface::devicesetChannelsReportURLRe("^/sdrangel/devi
 std::regex WebAPIAdapterInterface::devicesetChannelURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel$");
 std::regex WebAPIAdapterInterface::devicesetChannelIndexURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})$");
 std::regex WebAPIAdapterInterface::devicesetChannelSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/settings$");
+std::regex WebAPIAdapterInterface::devicesetChannelSettingsFieldURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/settings/([A-Za-z]+)$");
 std::regex WebAPIAdapterInterface::devicesetChannelReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/report");
 std::regex WebAPIAdapterInterface::devicesetChannelActionsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/channel/([0-9]{1,2})/actions");
 
@@ -65,6 +72,36 @@ std::regex WebAPIAdapterInterface::featuresetFeatureSettingsURLRe("^/sdrangel/fe
 std::regex WebAPIAdapterInterface::featuresetFeatureReportURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature/([0-9]{1,2})/report");
 std::regex WebAPIAdapterInterface::featuresetFeatureActionsURLRe("^/sdrangel/featureset/([0-9]{1,2})/feature/([0-9]{1,2})/actions");
 
+bool WebAPIAdapterInterface::getSettingsField(const QString& fieldName, SettingsField& field)
+{
+    if (fieldName == "centerFrequency") {
+        field = SettingsFieldCenterFrequency;
+    } else if (fieldName == "inputFrequencyOffset") {
+        field = SettingsFieldInputFrequencyOffset;
+    } else if (fieldName == "rfBandwidth") {
+        field = SettingsFieldRfBandwidth;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+QString WebAPIAdapterInterface::getSettingsFieldName(SettingsField field)
+{
+    switch (field)
+    {
+    case SettingsFieldCenterFrequency:
+        return "centerFrequency";
+    case SettingsFieldInputFrequencyOffset:
+        return "inputFrequencyOffset";
+    case SettingsFieldRfBandwidth:
+        return "rfBandwidth";
+    default:
+        return "";
+    }
+}
+
 void WebAPIAdapterInterface::ConfigKeys::debug() const
 {
     qDebug("WebAPIAdapterInterface::ConfigKeys::debug");
@@ -25,6 +25,7 @@
 #include <regex>
 
 #include "SWGErrorResponse.h"
+#include "channel/channelsettingsfields.h"
 
 #include "export.h"
 
@@ -36,9 +37,11 @@ namespace SWGSDRangel
     class SWGInstanceChannelsResponse;
     class SWGPreferences;
     class SWGLoggingInfo;
+    class SWGPipelineMetrics;
     class SWGAudioDevices;
     class SWGAudioInputDevice;
     class SWGAudioOutputDevice;
+    class SWGAudioOutputStream;
     class SWGLocationInformation;
     class SWGDVSerialDevices;
     class SWGAMBEDevices;
@@ -56,6 +59,9 @@ namespace SWGSDRangel
     class SWGDeviceSettings;
     class SWGDeviceState;
     class SWGDeviceReport;
+    class SWGWaterfallSettings;
+    class SWGWaterfallReport;
+    class SWGWaterfallTile;
     class SWGDeviceActions;
     class SWGChannelsDetail;
     class SWGChannelSettings;
@@ -114,9 +120,18 @@ public:
         QList<CommandKeys> m_commandKeys;
         void debug() const;
     };
+    enum SettingsField //!< numeric settings that can be accessed individually without the full settings object
+    {
+        SettingsFieldCenterFrequency,      //!< device center frequency (Hz)
+        SettingsFieldInputFrequencyOffset, //!< channel frequency offset from the device center frequency (Hz)
+        SettingsFieldRfBandwidth           //!< channel RF bandwidth (Hz). Negative for LSB in SSB channels.
+    };
 
     virtual ~WebAPIAdapterInterface() {}
 
+    static bool getSettingsField(const QString& fieldName, SettingsField& field); //!< returns false if the name is not known
+    static QString getSettingsFieldName(SettingsField field);
+
     /**
      * Handler of /sdrangel (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceSummary
      * returns the Http status code (default 501: not implemented)
@@ -242,6 +257,65 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/metrics (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceMetricsGet(
+            SWGSDRangel::SWGPipelineMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) response;
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/metrics (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceMetricsPut(
+            SWGSDRangel::SWGPipelineMetrics& query,
+            SWGSDRangel::SWGPipelineMetrics& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) query;
+        (void) response;
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/metrics (DELETE) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceMetricsDelete(
+            SWGSDRangel::SWGSuccessResponse& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) response;
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/metrics/prometheus (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * Response is plain text in Prometheus exposition format
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int instanceMetricsPrometheusGet(
+            QString& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) response;
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
     /**
      * Handler of /sdrangel/audio (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -708,6 +782,83 @@ public:
         return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/waterfall (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetWaterfallGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGWaterfallSettings& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/waterfall (PUT, PATCH) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetWaterfallPutPatch(
+            int deviceSetIndex,
+            bool force, //!< true to force settings = put else patch
+            const QStringList& waterfallSettingsKeys,
+            SWGSDRangel::SWGWaterfallSettings& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) force;
+        (void) waterfallSettingsKeys;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/waterfall/report (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetWaterfallReportGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGWaterfallReport& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/waterfall/tile (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * The tile is selected by time index or else by a timestamp in ms since epoch if time index is negative
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetWaterfallTileGet(
+            int deviceSetIndex,
+            int zoom,
+            qint64 timeIndex,
+            qint64 timestampMs,
+            int freqIndex,
+            SWGSDRangel::SWGWaterfallTile& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) zoom;
+        (void) timeIndex;
+        (void) timestampMs;
+        (void) freqIndex;
+        (void) response;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset/{devicesetIndex}/device (PUT) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -762,6 +913,44 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/settings/{fieldName} (GET)
+     * Also a direct typed access for in process clients that does not go through the JSON settings.
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceSettingsFieldGet(
+            int deviceSetIndex,
+            SettingsField field,
+            double& value,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) field;
+        (void) value;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/settings/{fieldName} (PATCH)
+     * Also a direct typed access for in process clients that does not go through the JSON settings.
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceSettingsFieldPatch(
+            int deviceSetIndex,
+            SettingsField field,
+            double value,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) field;
+        (void) value;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset/{devicesetIndex}/device/run (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -994,6 +1183,86 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/settings/{fieldName} (GET)
+     * Also a direct typed access for in process clients that does not go through the JSON settings.
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelSettingsFieldGet(
+            int deviceSetIndex,
+            int channelIndex,
+            SettingsField field,
+            double& value,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) channelIndex;
+        (void) field;
+        (void) value;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/settings/{fieldName} (PATCH)
+     * Also a direct typed access for in process clients that does not go through the JSON settings.
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelSettingsFieldPatch(
+            int deviceSetIndex,
+            int channelIndex,
+            SettingsField field,
+            double value,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) channelIndex;
+        (void) field;
+        (void) value;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Several channel settings fields set in a single channel configuration for in process clients.
+     * There is no matching URL. Use this rather than successive field patches that would be applied
+     * on top of the same settings.
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelSettingsFieldsPatch(
+            int deviceSetIndex,
+            int channelIndex,
+            const ChannelSettingsFields& fields,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) channelIndex;
+        (void) fields;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
+    /**
+     * Channel type (identifier) of a channel for in process clients. There is no matching URL.
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetChannelTypeGet(
+            int deviceSetIndex,
+            int channelIndex,
+            QString& channelType,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) channelIndex;
+        (void) channelType;
+        error.init();
+        *error.getMessage() = QString("Function not implemented");
+        return 501;
+    }
+
 
     /**
      * Handler of /sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/settings (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
@@ -1230,6 +1499,8 @@ public:
     static QString instanceDevicesURL;
     static QString instanceChannelsURL;
     static QString instanceLoggingURL;
+    static QString instanceMetricsURL;
+    static QString instanceMetricsPrometheusURL;
     static QString instanceAudioURL;
     static QString instanceAudioInputParametersURL;
     static QString instanceAudioOutputParametersURL;
@@ -1249,8 +1520,12 @@ public:
     static QString instanceDeviceSetURL;
     static std::regex devicesetURLRe;
     static std::regex devicesetFocusURLRe;
+    static std::regex devicesetWaterfallURLRe;
+    static std::regex devicesetWaterfallReportURLRe;
+    static std::regex devicesetWaterfallTileURLRe;
     static std::regex devicesetDeviceURLRe;
     static std::regex devicesetDeviceSettingsURLRe;
+    static std::regex devicesetDeviceSettingsFieldURLRe;
     static std::regex devicesetDeviceRunURLRe;
     static std::regex devicesetDeviceSubsystemRunURLRe;
     static std::regex devicesetDeviceReportURLRe;
@@ -1258,6 +1533,7 @@ public:
     static std::regex devicesetChannelURLRe;
     static std::regex devicesetChannelIndexURLRe;
     static std::regex devicesetChannelSettingsURLRe;
+    static std::regex devicesetChannelSettingsFieldURLRe;
     static std::regex devicesetChannelReportURLRe;
     static std::regex devicesetChannelActionsURLRe;
     static std::regex devicesetChannelsReportURLRe;
@@ -33,6 +33,10 @@
 #include "SWGLocationInformation.h"
 #include "SWGDVSerialDevices.h"
 #include "SWGAMBEDevices.h"
+#include "SWGPipelineMetrics.h"
+#include "SWGWaterfallSettings.h"
+#include "SWGWaterfallReport.h"
+#include "SWGWaterfallTile.h"
 #include "SWGLimeRFEDevices.h"
 #include "SWGLimeRFESettings.h"
 #include "SWGLimeRFEPower.h"
@@ -47,6 +51,7 @@
 #include "SWGDeviceActions.h"
 #include "SWGChannelsDetail.h"
 #include "SWGChannelSettings.h"
+#include "SWGSettingsField.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelActions.h"
 #include "SWGSuccessResponse.h"
@@ -79,6 +84,7 @@ const QMap<QString, QString> WebAPIRequestMapper::m_channelURIToSettingsKey = {
     {"sdrangel.demod.localsink", "LocalSinkSettings"},
     {"sdrangel.channel.localsink", "LocalSinkSettings"}, // remap
     {"sdrangel.channel.localsource", "LocalSourceSettings"},
+    {"sdrangel.channel.shmsink", "ShmSinkSettings"},
     {"sdrangel.channeltx.modpacket", "PacketModSettings"},
     {"sdrangel.channeltx.mod802.15.4", "IEEE_802_15_4_ModSettings"},
     {"sdrangel.demod.remotesink", "RemoteSinkSettings"},
@@ -123,6 +129,7 @@ const QMap<QString, QString> WebAPIRequestMapper::m_deviceIdToSettingsKey = {
     {"sdrangel.samplesource.plutosdr", "plutoSdrInputSettings"},
     {"sdrangel.samplesink.plutosdr", "plutoSdrOutputSettings"},
     {"sdrangel.samplesource.rtlsdr", "rtlSdrSettings"},
+    {"sdrangel.samplesource.shminput", "shmInputSettings"},
     {"sdrangel.samplesource.remoteinput", "remoteInputSettings"},
     {"sdrangel.samplesink.remoteoutput", "remoteOutputSettings"},
     {"sdrangel.samplesource.sdrplay", "sdrPlaySettings"},
@@ -157,6 +164,7 @@ const QMap<QString, QString> WebAPIRequestMapper::m_channelTypeToSettingsKey = {
     {"LocalSource", "LocalSourceSettings"},
     {"RemoteSink", "RemoteSinkSettings"},
     {"RemoteSource", "RemoteSourceSettings"},
+    {"ShmSink", "ShmSinkSettings"},
     {"SSBMod", "SSBModSettings"},
     {"SSBDemod", "SSBDemodSettings"},
     {"UDPSink", "UDPSourceSettings"},
@@ -189,6 +197,7 @@ const QMap<QString, QString> WebAPIRequestMapper::m_sourceDeviceHwIdToSettingsKe
     {"RTLSDR", "rtlSdrSettings"},
     {"RemoteInput", "remoteInputSettings"},
     {"SDRplay1", "sdrPlaySettings"},
+    {"ShmInput", "shmInputSettings"},
     {"SoapySDR", "soapySDRInputSettings"},
     {"TestSource", "testSourceSettings"},
     {"USRP", "usrpInputSettings"},
@@ -243,16 +252,19 @@ const QMap<QString, QString> WebAPIRequestMapper::m_mimoDeviceHwIdToActionsKey=
 
 const QMap<QString, QString> WebAPIRequestMapper::m_featureTypeToSettingsKey = {
     {"SimplePTT", "SimplePTTSettings"},
-    {"RigCtlServer", "RigCtlServerSettings"}
+    {"RigCtlServer", "RigCtlServerSettings"},
+    {"FreqSweep", "FreqSweepSettings"}
 };
 
 const QMap<QString, QString> WebAPIRequestMapper::m_featureTypeToActionsKey = {
-    {"SimplePTT", "SimplePTTActions"}
+    {"SimplePTT", "SimplePTTActions"},
+    {"FreqSweep", "FreqSweepActions"}
 };
 
 const QMap<QString, QString> WebAPIRequestMapper::m_featureURIToSettingsKey = {
     {"sdrangel.feature.simpleptt", "SimplePTTSettings"},
-    {"sdrangel.feature.rigctlserver", "RigCtlServerSettings"}
+    {"sdrangel.feature.rigctlserver", "RigCtlServerSettings"},
+    {"sdrangel.feature.freqsweep", "FreqSweepSettings"}
 };
 
 WebAPIRequestMapper::WebAPIRequestMapper(QObject* parent) :
@@ -313,6 +325,10 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
             instanceChannelsService(request, response);
         } else if (path == WebAPIAdapterInterface::instanceLoggingURL) {
             instanceLoggingService(request, response);
+        } else if (path == WebAPIAdapterInterface::instanceMetricsURL) {
+            instanceMetricsService(request, response);
+        } else if (path == WebAPIAdapterInterface::instanceMetricsPrometheusURL) {
+            instanceMetricsPrometheusService(request, response);
         } else if (path == WebAPIAdapterInterface::instanceAudioURL) {
             instanceAudioService(request, response);
         } else if (path == WebAPIAdapterInterface::instanceAudioInputParametersURL) {
@@ -359,8 +375,16 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
                 devicesetDeviceService(std::string(desc_match[1]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetFocusURLRe)) {
                 devicesetFocusService(std::string(desc_match[1]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetWaterfallURLRe)) {
+                devicesetWaterfallService(std::string(desc_match[1]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetWaterfallReportURLRe)) {
+                devicesetWaterfallReportService(std::string(desc_match[1]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetWaterfallTileURLRe)) {
+                devicesetWaterfallTileService(std::string(desc_match[1]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSettingsURLRe)) {
                 devicesetDeviceSettingsService(std::string(desc_match[1]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSettingsFieldURLRe)) {
+                devicesetDeviceSettingsFieldService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceRunURLRe)) {
                 devicesetDeviceRunService(std::string(desc_match[1]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSubsystemRunURLRe)) {
@@ -377,6 +401,8 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
                 devicesetChannelIndexService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelSettingsURLRe)) {
                 devicesetChannelSettingsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
+            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelSettingsFieldURLRe)) {
+                devicesetChannelSettingsFieldService(std::string(desc_match[1]), std::string(desc_match[2]), std::string(desc_match[3]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelReportURLRe)) {
                 devicesetChannelReportService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
             } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelActionsURLRe)) {
@@ -663,6 +689,117 @@ void WebAPIRequestMapper::instanceLoggingService(qtwebapp::HttpRequest& request,
     }
 }
 
+void WebAPIRequestMapper::instanceMetricsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "GET")
+    {
+        SWGSDRangel::SWGPipelineMetrics normalResponse;
+
+        int status = m_adapter->instanceMetricsGet(normalResponse, errorResponse);
+        response.setStatus(status);
+
+        if (status/100 == 2) {
+            response.write(normalResponse.asJson().toUtf8());
+        } else {
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else if (request.getMethod() == "PUT")
+    {
+        SWGSDRangel::SWGPipelineMetrics query;
+        SWGSDRangel::SWGPipelineMetrics normalResponse;
+        QString jsonStr = request.getBody();
+        QJsonObject jsonObject;
+
+        if (parseJsonBody(jsonStr, jsonObject, response))
+        {
+            if (jsonObject.contains("enabled"))
+            {
+                query.fromJson(jsonStr);
+                int status = m_adapter->instanceMetricsPut(query, normalResponse, errorResponse);
+                response.setStatus(status);
+
+                if (status/100 == 2) {
+                    response.write(normalResponse.asJson().toUtf8());
+                } else {
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON request");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON request";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(400,"Invalid JSON format");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid JSON format";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else if (request.getMethod() == "DELETE")
+    {
+        SWGSDRangel::SWGSuccessResponse normalResponse;
+
+        int status = m_adapter->instanceMetricsDelete(normalResponse, errorResponse);
+        response.setStatus(status);
+
+        if (status/100 == 2) {
+            response.write(normalResponse.asJson().toUtf8());
+        } else {
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::instanceMetricsPrometheusService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "GET")
+    {
+        QString normalResponse;
+
+        int status = m_adapter->instanceMetricsPrometheusGet(normalResponse, errorResponse);
+        response.setStatus(status);
+
+        if (status/100 == 2)
+        {
+            response.setHeader("Content-Type", "text/plain; version=0.0.4");
+            response.write(normalResponse.toUtf8());
+        }
+        else
+        {
+            response.setHeader("Content-Type", "application/json");
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else
+    {
+        response.setHeader("Content-Type", "application/json");
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::instanceAudioService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -1681,6 +1818,177 @@ void WebAPIRequestMapper::devicesetFocusService(const std::string& indexStr, qtw
     }
 }
 
+void WebAPIRequestMapper::devicesetWaterfallService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if ((request.getMethod() == "PUT") || (request.getMethod() == "PATCH"))
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGWaterfallSettings normalResponse;
+                normalResponse.fromJson(jsonStr);
+                int status = m_adapter->devicesetWaterfallPutPatch(
+                        deviceSetIndex,
+                        (request.getMethod() == "PUT"), // force settings on PUT
+                        jsonObject.keys(),
+                        normalResponse,
+                        errorResponse);
+                response.setStatus(status);
+
+                if (status/100 == 2) {
+                    response.write(normalResponse.asJson().toUtf8());
+                } else {
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGWaterfallSettings normalResponse;
+            int status = m_adapter->devicesetWaterfallGet(deviceSetIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetWaterfallReportService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGWaterfallReport normalResponse;
+            int status = m_adapter->devicesetWaterfallReportGet(deviceSetIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::devicesetWaterfallTileService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            bool zoomOk, timeIndexOk, timestampOk, freqIndexOk = true;
+            int zoom = request.getParameter("zoom").toInt(&zoomOk);
+            qint64 timeIndex = request.getParameter("timeIndex").toLongLong(&timeIndexOk);
+            qint64 timestampMs = request.getParameter("timestamp").toLongLong(&timestampOk);
+            QByteArray freqIndexStr = request.getParameter("freqIndex");
+            int freqIndex = freqIndexStr.isEmpty() ? 0 : freqIndexStr.toInt(&freqIndexOk);
+
+            if (!zoomOk || !freqIndexOk || (!timeIndexOk && !timestampOk) || (timeIndexOk && (timeIndex < 0)))
+            {
+                response.setStatus(400,"Invalid query");
+                errorResponse.init();
+                *errorResponse.getMessage() = "zoom and timeIndex or timestamp query parameters are required";
+                response.write(errorResponse.asJson().toUtf8());
+                return;
+            }
+
+            SWGSDRangel::SWGWaterfallTile normalResponse;
+            int status = m_adapter->devicesetWaterfallTileGet(
+                deviceSetIndex,
+                zoom,
+                timeIndexOk ? timeIndex : -1,
+                timestampMs,
+                freqIndex,
+                normalResponse,
+                errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::devicesetDeviceService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -1828,6 +2136,107 @@ void WebAPIRequestMapper::devicesetDeviceSettingsService(const std::string& inde
     }
 }
 
+void WebAPIRequestMapper::devicesetDeviceSettingsFieldService(
+        const std::string& indexStr,
+        const std::string& fieldName,
+        qtwebapp::HttpRequest& request,
+        qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+    QString fieldNameStr = QString::fromStdString(fieldName);
+    WebAPIAdapterInterface::SettingsField field;
+
+    if (!WebAPIAdapterInterface::getSettingsField(fieldNameStr, field))
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = QString("Unknown settings field %1").arg(fieldNameStr);
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+        return;
+    }
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            double value;
+            int status = m_adapter->devicesetDeviceSettingsFieldGet(deviceSetIndex, field, value, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2)
+            {
+                SWGSDRangel::SWGSettingsField normalResponse;
+                normalResponse.init();
+                *normalResponse.getName() = fieldNameStr;
+                normalResponse.setValue(value);
+                response.write(normalResponse.asJson().toUtf8());
+            }
+            else
+            {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "PATCH")
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                if (jsonObject.contains("value"))
+                {
+                    SWGSDRangel::SWGSettingsField query;
+                    query.fromJson(jsonStr);
+                    int status = m_adapter->devicesetDeviceSettingsFieldPatch(deviceSetIndex, field, query.getValue(), errorResponse);
+                    response.setStatus(status);
+
+                    if (status/100 == 2)
+                    {
+                        *query.getName() = fieldNameStr;
+                        response.write(query.asJson().toUtf8());
+                    }
+                    else
+                    {
+                        response.write(errorResponse.asJson().toUtf8());
+                    }
+                }
+                else
+                {
+                    response.setStatus(400,"Invalid JSON request");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = "Invalid JSON request";
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::devicesetDeviceRunService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -2320,6 +2729,109 @@ void WebAPIRequestMapper::devicesetChannelSettingsService(
     }
 }
 
+void WebAPIRequestMapper::devicesetChannelSettingsFieldService(
+        const std::string& deviceSetIndexStr,
+        const std::string& channelIndexStr,
+        const std::string& fieldName,
+        qtwebapp::HttpRequest& request,
+        qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+    QString fieldNameStr = QString::fromStdString(fieldName);
+    WebAPIAdapterInterface::SettingsField field;
+
+    if (!WebAPIAdapterInterface::getSettingsField(fieldNameStr, field))
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = QString("Unknown settings field %1").arg(fieldNameStr);
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+        return;
+    }
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(deviceSetIndexStr);
+        int channelIndex = boost::lexical_cast<int>(channelIndexStr);
+
+        if (request.getMethod() == "GET")
+        {
+            double value;
+            int status = m_adapter->devicesetChannelSettingsFieldGet(deviceSetIndex, channelIndex, field, value, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2)
+            {
+                SWGSDRangel::SWGSettingsField normalResponse;
+                normalResponse.init();
+                *normalResponse.getName() = fieldNameStr;
+                normalResponse.setValue(value);
+                response.write(normalResponse.asJson().toUtf8());
+            }
+            else
+            {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "PATCH")
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                if (jsonObject.contains("value"))
+                {
+                    SWGSDRangel::SWGSettingsField query;
+                    query.fromJson(jsonStr);
+                    int status = m_adapter->devicesetChannelSettingsFieldPatch(deviceSetIndex, channelIndex, field, query.getValue(), errorResponse);
+                    response.setStatus(status);
+
+                    if (status/100 == 2)
+                    {
+                        *query.getName() = fieldNameStr;
+                        response.write(query.asJson().toUtf8());
+                    }
+                    else
+                    {
+                        response.write(errorResponse.asJson().toUtf8());
+                    }
+                }
+                else
+                {
+                    response.setStatus(400,"Invalid JSON request");
+                    errorResponse.init();
+                    *errorResponse.getMessage() = "Invalid JSON request";
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::devicesetChannelReportService(
         const std::string& deviceSetIndexStr,
         const std::string& channelIndexStr,
@@ -3819,6 +4331,11 @@ bool WebAPIRequestMapper::getChannelSettings(
             channelSettings->setRemoteSourceSettings(new SWGSDRangel::SWGRemoteSourceSettings());
             channelSettings->getRemoteSourceSettings()->fromJsonObject(settingsJsonObject);
         }
+        else if (channelSettingsKey == "ShmSinkSettings")
+        {
+            channelSettings->setShmSinkSettings(new SWGSDRangel::SWGShmSinkSettings());
+            channelSettings->getShmSinkSettings()->fromJsonObject(settingsJsonObject);
+        }
         else if (channelSettingsKey == "SSBDemodSettings")
         {
             channelSettings->setSsbDemodSettings(new SWGSDRangel::SWGSSBDemodSettings());
@@ -4108,6 +4625,11 @@ bool WebAPIRequestMapper::getDeviceSettings(
             deviceSettings->setLocalInputSettings(new SWGSDRangel::SWGLocalInputSettings());
             deviceSettings->getLocalInputSettings()->fromJsonObject(settingsJsonObject);
         }
+        else if (deviceSettingsKey == "shmInputSettings")
+        {
+            deviceSettings->setShmInputSettings(new SWGSDRangel::SWGShmInputSettings());
+            deviceSettings->getShmInputSettings()->fromJsonObject(settingsJsonObject);
+        }
         else if (deviceSettingsKey == "remoteOutputSettings")
         {
             deviceSettings->setRemoteOutputSettings(new SWGSDRangel::SWGRemoteOutputSettings());
@@ -4188,6 +4710,11 @@ bool WebAPIRequestMapper::getFeatureSettings(
             featureSettings->setRigCtlServerSettings(new SWGSDRangel::SWGRigCtlServerSettings());
             featureSettings->getRigCtlServerSettings()->fromJsonObject(settingsJsonObject);
         }
+        else if (featureSettingsKey == "FreqSweepSettings")
+        {
+            featureSettings->setFreqSweepSettings(new SWGSDRangel::SWGFreqSweepSettings());
+            featureSettings->getFreqSweepSettings()->fromJsonObject(settingsJsonObject);
+        }
         else
         {
             return false;
@@ -4220,6 +4747,11 @@ bool WebAPIRequestMapper::getFeatureActions(
             featureActions->setSimplePttActions(new SWGSDRangel::SWGSimplePTTActions());
             featureActions->getSimplePttActions()->fromJsonObject(actionsJsonObject);
         }
+        else if (featureActionsKey == "FreqSweepActions")
+        {
+            featureActions->setFreqSweepActions(new SWGSDRangel::SWGFreqSweepActions());
+            featureActions->getFreqSweepActions()->fromJsonObject(actionsJsonObject);
+        }
         else
         {
             return false;
@@ -4292,6 +4824,7 @@ void WebAPIRequestMapper::resetDeviceSettings(SWGSDRangel::SWGDeviceSettings& de
     deviceSettings.setRtlSdrSettings(nullptr);
     deviceSettings.setRemoteOutputSettings(nullptr);
     deviceSettings.setRemoteInputSettings(nullptr);
+    deviceSettings.setShmInputSettings(nullptr);
     deviceSettings.setSdrPlaySettings(nullptr);
     deviceSettings.setTestSourceSettings(nullptr);
     deviceSettings.setUsrpInputSettings(nullptr);
@@ -4313,6 +4846,7 @@ void WebAPIRequestMapper::resetDeviceReport(SWGSDRangel::SWGDeviceReport& device
     deviceReport.setRtlSdrReport(nullptr);
     deviceReport.setRemoteOutputReport(nullptr);
     deviceReport.setRemoteInputReport(nullptr);
+    deviceReport.setShmInputReport(nullptr);
     deviceReport.setSdrPlayReport(nullptr);
     deviceReport.setUsrpOutputReport(nullptr);
 }
@@ -4338,6 +4872,7 @@ void WebAPIRequestMapper::resetChannelSettings(SWGSDRangel::SWGChannelSettings&
     channelSettings.setNfmModSettings(nullptr);
     channelSettings.setPacketModSettings(nullptr);
     channelSettings.setRemoteSinkSettings(nullptr);
+    channelSettings.setShmSinkSettings(nullptr);
     channelSettings.setRemoteSourceSettings(nullptr);
     channelSettings.setSsbDemodSettings(nullptr);
     channelSettings.setSsbModSettings(nullptr);
@@ -4351,16 +4886,20 @@ void WebAPIRequestMapper::resetChannelReport(SWGSDRangel::SWGChannelReport& chan
 {
     channelReport.cleanup();
     channelReport.setChannelType(nullptr);
+    channelReport.setExecutorReport(nullptr);
     channelReport.setAmDemodReport(nullptr);
     channelReport.setAmModReport(nullptr);
     channelReport.setAtvModReport(nullptr);
+    channelReport.setAtvDemodReport(nullptr);
     channelReport.setBfmDemodReport(nullptr);
     channelReport.setDsdDemodReport(nullptr);
     channelReport.setNfmDemodReport(nullptr);
     channelReport.setNfmModReport(nullptr);
     channelReport.setIeee802154ModReport(nullptr);
     channelReport.setPacketModReport(nullptr);
+    channelReport.setRemoteSinkReport(nullptr);
     channelReport.setRemoteSourceReport(nullptr);
+    channelReport.setShmSinkReport(nullptr);
     channelReport.setSsbDemodReport(nullptr);
     channelReport.setSsbModReport(nullptr);
     channelReport.setUdpSourceReport(nullptr);
@@ -4396,6 +4935,7 @@ void WebAPIRequestMapper::resetFeatureSettings(SWGSDRangel::SWGFeatureSettings&
     featureSettings.cleanup();
     featureSettings.setFeatureType(nullptr);
     featureSettings.setSimplePttSettings(nullptr);
+    featureSettings.setFreqSweepSettings(nullptr);
 }
 
 void WebAPIRequestMapper::resetFeatureReport(SWGSDRangel::SWGFeatureReport& featureReport)
@@ -4403,6 +4943,7 @@ void WebAPIRequestMapper::resetFeatureReport(SWGSDRangel::SWGFeatureReport& feat
     featureReport.cleanup();
     featureReport.setFeatureType(nullptr);
     featureReport.setSimplePttReport(nullptr);
+    featureReport.setFreqSweepReport(nullptr);
 }
 
 void WebAPIRequestMapper::resetFeatureActions(SWGSDRangel::SWGFeatureActions& featureActions)
@@ -4410,6 +4951,7 @@ void WebAPIRequestMapper::resetFeatureActions(SWGSDRangel::SWGFeatureActions& fe
     featureActions.cleanup();
     featureActions.setFeatureType(nullptr);
     featureActions.setSimplePttActions(nullptr);
+    featureActions.setFreqSweepActions(nullptr);
 }
 
 void WebAPIRequestMapper::processChannelAnalyzerSettings(
@@ -20,7 +20,60 @@
 #include <QDebug>
 #include <QElapsedTimer>
 
+#include <chrono>
+#include <thread>
+
 #include "ambe/ambeengine.h"
+#include "ambe/ambeworker.h"
+#include "audio/audiofifo.h"
+#include "dsp/fftfilt.h"
+#include "dsp/upchannelizer.h"
+#include "dsp/channelsamplesource.h"
+#include "dsp/nco.h"
+#include "dsp/ncof.h"
+#include "dsp/decimatorc.h"
+#include "dsp/fftcorr.h"
+#include "dsp/phaselockcomplex.h"
+#include "dsp/freqlockcomplex.h"
+#include "dsp/samplesinkfifo.h"
+#include "dsp/iqcorrector.h"
+#include "dsp/projector.h"
+#include "channel/channelsettingsfields.h"
+#include "util/message.h"
+#include "util/messagequeue.h"
+
+// Minimal channel settings and coalescing configuration message like the demodulators have
+struct BenchChannelSettings
+{
+    qint64 m_inputFrequencyOffset;
+    Real m_rfBandwidth;
+    Real m_volume;
+};
+
+class MsgConfigureBenchChannel : public Message {
+    MESSAGE_CLASS_DECLARATION
+    MESSAGE_CLASS_COALESCING(MsgConfigureBenchChannel)
+
+public:
+    const BenchChannelSettings& getSettings() const { return m_settings; }
+    bool getForce() const { return m_force; }
+
+    static MsgConfigureBenchChannel* create(const BenchChannelSettings& settings, bool force) {
+        return new MsgConfigureBenchChannel(settings, force);
+    }
+
+private:
+    BenchChannelSettings m_settings;
+    bool m_force;
+
+    MsgConfigureBenchChannel(const BenchChannelSettings& settings, bool force) :
+        Message(),
+        m_settings(settings),
+        m_force(force)
+    { }
+};
+
+MESSAGE_CLASS_DEFINITION(MsgConfigureBenchChannel, Message)
 
 #include "mainbench.h"
 
@@ -64,6 +117,22 @@ void MainBench::run()
         testDecimateFF();
     } else if (m_parser.getTestType() == ParserBench::TestAMBE) {
         testAMBE();
+    } else if (m_parser.getTestType() == ParserBench::TestAMBEEmulated) {
+        testAMBEEmulated();
+    } else if (m_parser.getTestType() == ParserBench::TestFFTFilter) {
+        testFFTFilter();
+    } else if (m_parser.getTestType() == ParserBench::TestUpChannelizer) {
+        testUpChannelizer();
+    } else if (m_parser.getTestType() == ParserBench::TestChannelAnalyzer) {
+        testChannelAnalyzer();
+    } else if (m_parser.getTestType() == ParserBench::TestSampleSinkFifo) {
+        testSampleSinkFifo();
+    } else if (m_parser.getTestType() == ParserBench::TestIQCorrections) {
+        testIQCorrections();
+    } else if (m_parser.getTestType() == ParserBench::TestProjector) {
+        testProjector();
+    } else if (m_parser.getTestType() == ParserBench::TestChannelSettingsFields) {
+        testChannelSettingsFields();
     } else {
         qDebug() << "MainBench::run: unknown test type: " << m_parser.getTestType();
     }
@@ -207,10 +276,664 @@ void MainBench::testAMBE()
     }
 }
 
+void MainBench::testAMBEEmulated()
+{
+    qDebug() << "MainBench::testAMBEEmulated: create emulated devices and streams";
+    AMBEEngine ambeEngine;
+
+    for (uint32_t i = 0; i < m_parser.getNbAMBEDevices(); i++) {
+        ambeEngine.registerController(QString("%1:%2").arg(AMBEWorker::m_emulatorDeviceRef.c_str()).arg(1500+i).toStdString());
+    }
+
+    std::vector<AudioFifo*> audioFifos;
+
+    for (uint32_t i = 0; i < m_parser.getNbStreams(); i++) {
+        audioFifos.push_back(new AudioFifo(48000));
+    }
+
+    unsigned char mbeFrame[SerialDV::MBE_FRAME_MAX_LENGTH_BYTES];
+    std::fill(mbeFrame, mbeFrame + SerialDV::MBE_FRAME_MAX_LENGTH_BYTES, 0);
+    uint32_t nbFrames = m_parser.getNbSamples() / SerialDV::MBE_AUDIO_BLOCK_SIZE; // one frame per block of 8 kS/s audio samples
+    std::vector<AMBEEngine::DeviceStats> devicesStats;
+    QElapsedTimer timer;
+    timer.start();
+
+    qDebug() << "MainBench::testAMBEEmulated: run test with" << nbFrames << "frames";
+
+    for (uint32_t i = 0; i < nbFrames; i++)
+    {
+        AudioFifo *audioFifo = audioFifos[i % audioFifos.size()];
+        quint64 nbDroppedFrames = ambeEngine.getNbDroppedFrames();
+
+        // push again while devices are saturated so that all frames are decoded
+        for (ambeEngine.pushMbeFrame(mbeFrame, 0, 30, 3, false, 6, audioFifo);
+            ambeEngine.getNbDroppedFrames() != nbDroppedFrames;
+            ambeEngine.pushMbeFrame(mbeFrame, 0, 30, 3, false, 6, audioFifo))
+        {
+            nbDroppedFrames = ambeEngine.getNbDroppedFrames();
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+
+        audioFifo->flush(); // audio output is not part of the test
+    }
+
+    for (int queueDepth = 1; queueDepth > 0;)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        devicesStats.clear();
+        ambeEngine.getDevicesStats(devicesStats);
+        queueDepth = 0;
+
+        for (std::vector<AMBEEngine::DeviceStats>::const_iterator it = devicesStats.begin(); it != devicesStats.end(); ++it) {
+            queueDepth += it->m_queueDepth;
+        }
+    }
+
+    qint64 nsecs = timer.nsecsElapsed();
+    QDebug info = qInfo();
+    info.noquote();
+    info << tr("MainBench::testAMBEEmulated: %1 frames on %2 devices from %3 streams in %L4 ns - %5 frames/s")
+        .arg(nbFrames).arg(devicesStats.size()).arg(audioFifos.size()).arg(nsecs).arg((nbFrames * 1e9) / nsecs);
+
+    for (std::vector<AMBEEngine::DeviceStats>::const_iterator it = devicesStats.begin(); it != devicesStats.end(); ++it)
+    {
+        info << tr("\n  %1: %2 frames decoded %3 failed - latency mean %4 ms max %5 ms")
+            .arg(it->m_deviceRef).arg(it->m_framesDecoded).arg(it->m_framesFailed)
+            .arg(it->m_meanLatencyMs).arg(it->m_maxLatencyMs);
+    }
+
+    qDebug() << "MainBench::testAMBEEmulated: cleanup test data";
+    ambeEngine.releaseAll();
+
+    for (std::vector<AudioFifo*>::iterator it = audioFifos.begin(); it != audioFifos.end(); ++it) {
+        delete *it;
+    }
+}
+
+void MainBench::testFFTFilter()
+{
+    QElapsedTimer timer;
+    qint64 nsecsSample = 0;
+    qint64 nsecsBlock = 0;
+    const int fftLength = 1024;
+
+    qDebug() << "MainBench::testFFTFilter: create test data";
+
+    std::vector<fftfilt::cmplx> buf(m_parser.getNbSamples());
+    std::vector<fftfilt::cmplx> out;
+    out.reserve(m_parser.getNbSamples() + fftLength);
+    auto my_rand = std::bind(m_uniform_distribution_f, m_generator);
+
+    for (std::vector<fftfilt::cmplx>::iterator it = buf.begin(); it != buf.end(); ++it) {
+        *it = fftfilt::cmplx{my_rand(), my_rand()};
+    }
+
+    fftfilt sampleFilter(0.0f, 0.1f, fftLength);
+    fftfilt blockFilter(0.0f, 0.1f, fftLength);
+    fftfilt::cmplx *sampleOut;
+    float maxError = 0.0f;
+
+    qDebug() << "MainBench::testFFTFilter: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        out.clear();
+        timer.start();
+
+        for (std::vector<fftfilt::cmplx>::const_iterator it = buf.begin(); it != buf.end(); ++it)
+        {
+            int n = sampleFilter.runSSB(*it, &sampleOut, true);
+
+            if (n > 0) {
+                out.insert(out.end(), sampleOut, sampleOut + n);
+            }
+        }
+
+        nsecsSample += timer.nsecsElapsed();
+        std::vector<fftfilt::cmplx> sampleResult(out);
+        out.clear();
+
+        timer.start();
+        blockFilter.runSSB(buf.data(), buf.size(), out, true);
+        nsecsBlock += timer.nsecsElapsed();
+
+        for (unsigned int j = 0; j < out.size() && j < sampleResult.size(); j++) {
+            maxError = std::max(maxError, std::abs(out[j] - sampleResult[j]));
+        }
+    }
+
+    printResults("MainBench::testFFTFilter: sample", nsecsSample);
+    printResults("MainBench::testFFTFilter: block", nsecsBlock);
+    qInfo("MainBench::testFFTFilter: max difference block vs sample: %g", maxError);
+}
+
+// Tone modulator standing for a TX channel source
+class ToneSource : public ChannelSampleSource
+{
+public:
+    ToneSource(float frequency, int sampleRate) {
+        m_nco.setFreq(frequency, sampleRate);
+    }
+    virtual void pull(SampleVector::iterator begin, unsigned int nbSamples)
+    {
+        for (unsigned int i = 0; i < nbSamples; i++, ++begin) {
+            pullOne(*begin);
+        }
+    }
+    virtual void pullOne(Sample& sample)
+    {
+        Complex ci = m_nco.nextIQ() * (0.891235351562f * SDR_TX_SCALEF);
+        sample.m_real = (FixReal) ci.real();
+        sample.m_imag = (FixReal) ci.imag();
+    }
+    virtual void prefetch(unsigned int nbSamples) { (void) nbSamples; }
+private:
+    NCO m_nco;
+};
+
+void MainBench::testUpChannelizer()
+{
+    QElapsedTimer timer;
+    qint64 nsecsSample = 0;
+    qint64 nsecsBlock = 0;
+    unsigned int log2Interp = m_parser.getLog2Factor();
+    unsigned int chainHash = 0;
+
+    for (unsigned int i = 0, p = 1; i < log2Interp; i++, p *= 3) { // all center stages
+        chainHash += p;
+    }
+
+    qDebug() << "MainBench::testUpChannelizer: create test data";
+
+    SampleVector buf(m_parser.getNbSamples());
+    ToneSource sampleSource(1000.0f, 48000);
+    ToneSource blockSource(1000.0f, 48000);
+    UpChannelizer sampleChannelizer(&sampleSource);
+    UpChannelizer blockChannelizer(&blockSource);
+    sampleChannelizer.setBasebandSampleRate(48000 << log2Interp);
+    sampleChannelizer.setInterpolation(log2Interp, chainHash);
+    blockChannelizer.setBasebandSampleRate(48000 << log2Interp);
+    blockChannelizer.setInterpolation(log2Interp, chainHash);
+
+    qDebug() << "MainBench::testUpChannelizer: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (SampleVector::iterator it = buf.begin(); it != buf.end(); ++it) {
+            sampleChannelizer.pullOne(*it);
+        }
+
+        nsecsSample += timer.nsecsElapsed();
+
+        timer.start();
+        blockChannelizer.pull(buf.begin(), buf.size());
+        nsecsBlock += timer.nsecsElapsed();
+    }
+
+    printResults("MainBench::testUpChannelizer: sample", nsecsSample);
+    printResults("MainBench::testUpChannelizer: block", nsecsBlock);
+}
+
+// Channel Analyzer chain (mixer, decimator, filter, PLL or FLL, auto-correlation) as run by ChannelAnalyzerSink
+class AnalyzerChain
+{
+public:
+    AnalyzerChain(unsigned int log2Decim, bool ssb, bool pll, bool fll, bool autoCorr) :
+        m_ssbFilter(0.01f, 0.2f, 1024),
+        m_dsbFilter(0.2f, 2048),
+        m_corr(8192),
+        m_ssb(ssb),
+        m_pll(pll),
+        m_fll(fll),
+        m_autoCorr(autoCorr)
+    {
+        m_nco.setFreq(-1000.0f, 48000 << log2Decim);
+        m_decimator.setLog2Decim(log2Decim);
+        m_phaseLock.computeCoefficients(0.002f, 0.5f, 10.0f);
+        m_phaseLock.setSampleRate(48000);
+        m_freqLock.setSampleRate(48000);
+    }
+
+    void runSample(const SampleVector& in, std::vector<Complex>& out)
+    {
+        fftfilt::cmplx *filtered;
+
+        for (SampleVector::const_iterator it = in.begin(); it != in.end(); ++it)
+        {
+            Complex c = Complex(it->real(), it->imag()) * m_nco.nextIQ();
+            Complex cd = c;
+
+            if ((m_decimator.getDecim() != 1) && !m_decimator.decimate(c, cd)) {
+                continue;
+            }
+
+            int n = m_ssb ? m_ssbFilter.runSSB(cd, &filtered, true) : m_dsbFilter.runDSB(cd, &filtered);
+
+            for (int i = 0; i < n; i++)
+            {
+                Complex si = filtered[i];
+
+                if (m_pll && m_fll)
+                {
+                    m_freqLock.feed(si.real(), si.imag());
+                    si *= std::conj(m_freqLock.getComplex());
+                }
+                else if (m_pll)
+                {
+                    m_phaseLock.feed(si.real(), si.imag());
+                    si *= std::conj(m_phaseLock.getComplex());
+                }
+
+                if (m_autoCorr) {
+                    si = m_corr.run(si / SDR_RX_SCALEF, nullptr);
+                }
+
+                out.push_back(si);
+            }
+        }
+    }
+
+    void runBlock(const SampleVector& in, std::vector<Complex>& out)
+    {
+        unsigned int len = in.size();
+        m_buffer.resize(len);
+        m_nco.mix(in.data(), m_buffer.data(), len);
+        len = m_decimator.decimate(m_buffer.data(), len, m_buffer.data());
+        unsigned int start = out.size();
+
+        if (m_ssb) {
+            m_ssbFilter.runSSB(m_buffer.data(), len, out, true);
+        } else {
+            m_dsbFilter.runDSB(m_buffer.data(), len, out);
+        }
+
+        Complex *filtered = out.data() + start;
+        len = out.size() - start;
+        m_lo.resize(len);
+
+        if (m_pll)
+        {
+            if (m_fll) {
+                m_freqLock.feed(filtered, len, m_lo.data());
+            } else {
+                m_phaseLock.feed(filtered, len, m_lo.data());
+            }
+
+            for (unsigned int i = 0; i < len; i++) {
+                filtered[i] *= std::conj(m_lo[i]);
+            }
+        }
+
+        if (m_autoCorr)
+        {
+            for (unsigned int i = 0; i < len; i++) {
+                filtered[i] /= SDR_RX_SCALEF;
+            }
+
+            m_corr.run(filtered, nullptr, len, filtered);
+        }
+    }
+
+private:
+    NCOF m_nco;
+    DecimatorC m_decimator;
+    fftfilt m_ssbFilter;
+    fftfilt m_dsbFilter;
+    PhaseLockComplex m_phaseLock;
+    FreqLockComplex m_freqLock;
+    fftcorr m_corr;
+    bool m_ssb;
+    bool m_pll;
+    bool m_fll;
+    bool m_autoCorr;
+    std::vector<Complex> m_buffer;
+    std::vector<Complex> m_lo;
+};
+
+void MainBench::testChannelAnalyzer()
+{
+    struct AnalyzerConfig
+    {
+        const char *name;
+        bool ssb;
+        bool pll;
+        bool fll;
+        bool autoCorr;
+    };
+    const AnalyzerConfig configs[] = {
+        {"DSB", false, false, false, false},
+        {"SSB", true, false, false, false},
+        {"DSB PLL", false, true, false, false},
+        {"DSB FLL", false, true, true, false},
+        {"SSB autocorr", true, false, false, true}
+    };
+    QElapsedTimer timer;
+
+    qDebug() << "MainBench::testChannelAnalyzer: create test data";
+
+    SampleVector buf(m_parser.getNbSamples());
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (SampleVector::iterator it = buf.begin(); it != buf.end(); ++it) {
+        *it = Sample(my_rand(), my_rand());
+    }
+
+    std::vector<Complex> sampleOut;
+    std::vector<Complex> blockOut;
+
+    qDebug() << "MainBench::testChannelAnalyzer: run test";
+
+    for (const AnalyzerConfig& config : configs)
+    {
+        qint64 nsecsSample = 0;
+        qint64 nsecsBlock = 0;
+        float maxError = 0.0f;
+        AnalyzerChain sampleChain(m_parser.getLog2Factor(), config.ssb, config.pll, config.fll, config.autoCorr);
+        AnalyzerChain blockChain(m_parser.getLog2Factor(), config.ssb, config.pll, config.fll, config.autoCorr);
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            sampleOut.clear();
+            timer.start();
+            sampleChain.runSample(buf, sampleOut);
+            nsecsSample += timer.nsecsElapsed();
+
+            blockOut.clear();
+            timer.start();
+            blockChain.runBlock(buf, blockOut);
+            nsecsBlock += timer.nsecsElapsed();
+
+            for (unsigned int j = 0; j < sampleOut.size() && j < blockOut.size(); j++) {
+                maxError = std::max(maxError, std::abs(blockOut[j] - sampleOut[j]));
+            }
+        }
+
+        printResults(QString("MainBench::testChannelAnalyzer: %1 sample").arg(config.name), nsecsSample);
+        printResults(QString("MainBench::testChannelAnalyzer: %1 block").arg(config.name), nsecsBlock);
+        qInfo("MainBench::testChannelAnalyzer: %s max difference block vs sample: %g", config.name, maxError);
+    }
+}
+
+void MainBench::testSampleSinkFifo()
+{
+    QElapsedTimer timer;
+    qint64 nsecsCopy = 0;
+    qint64 nsecsDirect = 0;
+    unsigned int nbDecimated = (m_parser.getNbSamples() >> m_parser.getLog2Factor()) + 1;
+
+    qDebug() << "MainBench::testSampleSinkFifo: create test data";
+
+    qint16 *buf = new qint16[m_parser.getNbSamples()*2];
+    m_convertBuffer.resize(nbDecimated);
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+    std::generate(buf, buf + m_parser.getNbSamples()*2 - 1, my_rand);
+    SampleSinkFifo sampleFifo(4*nbDecimated);
+    SampleVector::iterator part1Begin, part1End, part2Begin, part2End;
+
+    qDebug() << "MainBench::testSampleSinkFifo: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        // decimation in the conversion buffer then copy to the FIFO
+        timer.start();
+        SampleVector::iterator it = m_convertBuffer.begin();
+        decimateII(it, buf, m_parser.getNbSamples()*2);
+        sampleFifo.write(m_convertBuffer.begin(), it);
+        nsecsCopy += timer.nsecsElapsed();
+        sampleFifo.readCommit(sampleFifo.readBegin(sampleFifo.fill(), &part1Begin, &part1End, &part2Begin, &part2End));
+
+        // decimation directly in the FIFO memory
+        timer.start();
+        SampleVector::iterator begin = sampleFifo.writeBegin(nbDecimated);
+        it = begin;
+        decimateII(it, buf, m_parser.getNbSamples()*2);
+        sampleFifo.writeCommit(it - begin);
+        nsecsDirect += timer.nsecsElapsed();
+        sampleFifo.readCommit(sampleFifo.readBegin(sampleFifo.fill(), &part1Begin, &part1End, &part2Begin, &part2End));
+    }
+
+    printResults("MainBench::testSampleSinkFifo: convert buffer copy", nsecsCopy);
+    printResults("MainBench::testSampleSinkFifo: direct to FIFO", nsecsDirect);
+
+    if (m_parser.getLog2Factor() == 0) // no decimation: compare vectorized conversion with the scalar one
+    {
+        int nbSamples = m_parser.getNbSamples();
+        SampleVector scalarOut(nbSamples);
+        SampleVector simdOut(nbSamples);
+        qint64 nsecsScalar = 0;
+        qint64 nsecsSIMD = 0;
+        int maxError = 0;
+        typedef SampleConverter<qint16, 0, decimation_shifts<SDR_RX_SAMP_SZ, 12>::pre1, true> Converter;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+            Converter::convertScalar(buf, &scalarOut[0], nbSamples);
+            nsecsScalar += timer.nsecsElapsed();
+            timer.start();
+            Converter::convert(buf, &simdOut[0], nbSamples);
+            nsecsSIMD += timer.nsecsElapsed();
+        }
+
+        for (int i = 0; i < nbSamples; i++)
+        {
+            maxError = std::max(maxError, std::abs((int) (simdOut[i].real() - scalarOut[i].real())));
+            maxError = std::max(maxError, std::abs((int) (simdOut[i].imag() - scalarOut[i].imag())));
+        }
+
+        printResults("MainBench::testSampleSinkFifo: scalar conversion", nsecsScalar);
+        printResults("MainBench::testSampleSinkFifo: SIMD conversion", nsecsSIMD);
+        qInfo("MainBench::testSampleSinkFifo: max difference SIMD vs scalar: %d", maxError);
+    }
+
+    qDebug() << "MainBench::testSampleSinkFifo: cleanup test data";
+    delete[] buf;
+}
+
+void MainBench::testIQCorrections()
+{
+    const int blockSize = 16384; // typical engine block
+    QElapsedTimer timer;
+    qint64 nsecsOff = 0;
+    qint64 nsecsScalar[2] = {0, 0};
+    qint64 nsecsSIMD[2] = {0, 0};
+    int maxError = 0;
+
+    qDebug() << "MainBench::testIQCorrections: create test data";
+
+    // sine with DC offset and I/Q imbalance plus noise
+    int nbSamples = m_parser.getNbSamples();
+    SampleVector buf(nbSamples);
+    SampleVector scalarOut(nbSamples);
+    SampleVector simdOut(nbSamples);
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        float i0 = 1000.0f * cos(0.01f * i) + my_rand() / 16;
+        float q0 = 1000.0f * sin(0.01f * i) + my_rand() / 16;
+        buf[i].setReal((FixReal) (i0 + 100.0f) << (SDR_RX_SAMP_SZ - 16));
+        buf[i].setImag((FixReal) (0.8f*q0 + 0.1f*i0 - 50.0f) << (SDR_RX_SAMP_SZ - 16));
+    }
+
+    qDebug() << "MainBench::testIQCorrections: run test";
+
+    for (int imbalance = 0; imbalance < 2; imbalance++)
+    {
+        IQCorrector scalarCorrector;
+        IQCorrector simdCorrector;
+
+        for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+        {
+            timer.start();
+            std::copy(buf.begin(), buf.end(), scalarOut.begin());
+            nsecsOff += timer.nsecsElapsed();
+            std::copy(buf.begin(), buf.end(), simdOut.begin());
+
+            for (int j = 0; j < nbSamples; j += blockSize)
+            {
+                int end = std::min(j + blockSize, nbSamples);
+                timer.start();
+                scalarCorrector.processScalar(scalarOut.begin() + j, scalarOut.begin() + end, imbalance == 1);
+                nsecsScalar[imbalance] += timer.nsecsElapsed();
+                timer.start();
+                simdCorrector.process(simdOut.begin() + j, simdOut.begin() + end, imbalance == 1);
+                nsecsSIMD[imbalance] += timer.nsecsElapsed();
+            }
+        }
+
+        for (int i = 0; i < nbSamples; i++)
+        {
+            maxError = std::max(maxError, std::abs((int) (simdOut[i].real() - scalarOut[i].real())));
+            maxError = std::max(maxError, std::abs((int) (simdOut[i].imag() - scalarOut[i].imag())));
+        }
+
+        if (imbalance == 1)
+        {
+            qInfo("MainBench::testIQCorrections: estimates: DC: %f, %f phase: %f amplitude: %f",
+                simdCorrector.getIOffset(), simdCorrector.getQOffset(), simdCorrector.getPhase(), simdCorrector.getAmplitude());
+        }
+    }
+
+    printResults("MainBench::testIQCorrections: corrections off (block copy)", nsecsOff / 2);
+    printResults("MainBench::testIQCorrections: DC scalar", nsecsScalar[0]);
+    printResults("MainBench::testIQCorrections: DC SIMD", nsecsSIMD[0]);
+    printResults("MainBench::testIQCorrections: DC + IQ scalar", nsecsScalar[1]);
+    printResults("MainBench::testIQCorrections: DC + IQ SIMD", nsecsSIMD[1]);
+    qInfo("MainBench::testIQCorrections: max difference SIMD vs scalar: %d", maxError);
+}
+
+void MainBench::testProjector()
+{
+    const int blockSize = 4800; // scope trace chunk size
+    const Projector::ProjectionType projectionTypes[] = {
+        Projector::ProjectionReal,
+        Projector::ProjectionMagLin,
+        Projector::ProjectionMagSq,
+        Projector::ProjectionMagDB,
+        Projector::ProjectionPhase,
+        Projector::ProjectionDPhase
+    };
+    const char *projectionNames[] = {"Real", "MagLin", "MagSq", "MagDB", "Phase", "DPhase"};
+    QElapsedTimer timer;
+
+    qDebug() << "MainBench::testProjector: create test data";
+
+    int nbSamples = m_parser.getNbSamples();
+    SampleVector buf(nbSamples);
+    std::vector<Real> scalarOut(nbSamples);
+    std::vector<Real> blockOut(nbSamples);
+    auto my_rand = std::bind(m_uniform_distribution_s16, m_generator);
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        buf[i].setReal((FixReal) (16000.0f * cos(0.01f * i) + my_rand() / 16) << (SDR_RX_SAMP_SZ - 16));
+        buf[i].setImag((FixReal) (16000.0f * sin(0.01f * i) + my_rand() / 16) << (SDR_RX_SAMP_SZ - 16));
+    }
+
+    qDebug() << "MainBench::testProjector: run test";
+
+    for (int t = 0; t < 6; t++)
+    {
+        Projector scalarProjector(projectionTypes[t]);
+        Projector blockProjector(projectionTypes[t]);
+        qint64 nsecsScalar = 0;
+        qint64 nsecsBlock = 0;
+        double maxError = 0.0;
+
+        for (uint32_t r = 0; r < m_parser.getRepetition(); r++)
+        {
+            timer.start();
+
+            for (int i = 0; i < nbSamples; i++) {
+                scalarOut[i] = scalarProjector.run(buf[i]);
+            }
+
+            nsecsScalar += timer.nsecsElapsed();
+            timer.start();
+
+            for (int j = 0; j < nbSamples; j += blockSize) {
+                blockProjector.runBlock(&buf[j], std::min(blockSize, nbSamples - j), &blockOut[j]);
+            }
+
+            nsecsBlock += timer.nsecsElapsed();
+        }
+
+        for (int i = 0; i < nbSamples; i++) {
+            maxError = std::max(maxError, (double) std::abs(blockOut[i] - scalarOut[i]));
+        }
+
+        printResults(QString("MainBench::testProjector: %1 scalar").arg(projectionNames[t]), nsecsScalar);
+        printResults(QString("MainBench::testProjector: %1 block").arg(projectionNames[t]), nsecsBlock);
+        qInfo("MainBench::testProjector: %s max difference block vs scalar: %g", projectionNames[t], maxError);
+    }
+}
+
+void MainBench::testChannelSettingsFields()
+{
+    QElapsedTimer timer;
+    qint64 nsecs = 0;
+    int nbFailed = 0;
+    BenchChannelSettings applied{0, 6000.0f, 1.0f}; // settings of the channel handler (m_settings)
+    MessageQueue queue;
+
+    qDebug() << "MainBench::testChannelSettingsFields: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        qint64 offset = 1000 + 100 * (i % 1000);
+        Real bandwidth = (i % 2) ? -3000.0f : 2700.0f; // alternate LSB and USB modes
+
+        timer.start();
+        // new channel: its initial configuration is still in the queue when the mode change comes
+        queue.push(MsgConfigureBenchChannel::create(applied, true));
+        // mode change: offset and bandwidth set together on top of the applied settings
+        // like ChannelAPI::setSettingsFields implementations do
+        ChannelSettingsFields fields;
+        fields.setInputFrequencyOffset(offset);
+        fields.setRfBandwidth(bandwidth);
+        BenchChannelSettings settings = applied;
+        fields.apply(settings);
+        queue.push(MsgConfigureBenchChannel::create(settings, false));
+
+        // channel message handler
+        bool force = false;
+        Message *message;
+
+        while ((message = queue.pop()) != nullptr)
+        {
+            MsgConfigureBenchChannel& cfg = (MsgConfigureBenchChannel&) *message;
+            applied = cfg.getSettings();
+            force = force || cfg.getForce();
+            delete message;
+        }
+
+        nsecs += timer.nsecsElapsed();
+
+        if ((applied.m_inputFrequencyOffset != offset) || (applied.m_rfBandwidth != bandwidth)
+         || (applied.m_volume != 1.0f) || !force)
+        {
+            qCritical("MainBench::testChannelSettingsFields: repetition %u: offset %lld (expected %lld) bandwidth %f (expected %f) force %d",
+                i, applied.m_inputFrequencyOffset, offset, applied.m_rfBandwidth, bandwidth, force ? 1 : 0);
+            nbFailed++;
+        }
+    }
+
+    printResults("MainBench::testChannelSettingsFields: patch and apply", nsecs);
+    qInfo("MainBench::testChannelSettingsFields: %d failed out of %u (coalesced messages: %llu)",
+        nbFailed, m_parser.getRepetition(), queue.getCoalescedCount());
+}
+
 void MainBench::decimateII(const qint16* buf, int len)
 {
     SampleVector::iterator it = m_convertBuffer.begin();
+    decimateII(it, buf, len);
+}
 
+void MainBench::decimateII(SampleVector::iterator& it, const qint16* buf, int len)
+{
     switch (m_parser.getLog2Factor())
     {
     case 0:
@@ -53,7 +53,16 @@ private:
     void testDecimateFI();
     void testDecimateFF();
     void testAMBE();
+    void testAMBEEmulated();
+    void testFFTFilter();
+    void testUpChannelizer();
+    void testChannelAnalyzer();
+    void testSampleSinkFifo();
+    void testIQCorrections();
+    void testProjector();
+    void testChannelSettingsFields();
     void decimateII(const qint16 *buf, int len);
+    void decimateII(SampleVector::iterator& it, const qint16 *buf, int len);
     void decimateInfII(const qint16 *buf, int len);
     void decimateSupII(const qint16 *buf, int len);
     void decimateIF(const qint16 *buf, int len);
@@ -24,7 +24,7 @@
 
 ParserBench::ParserBench() :
     m_testOption(QStringList() << "t" << "test",
-        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe",
+        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe, ambeemu, fftfilt, upchannelizer, chanalyzer, samplefifo, iqcorr, projector, chanfields",
         "test",
         "decimateii"),
     m_nbSamplesOption(QStringList() << "n" << "nb-samples",
@@ -38,12 +38,22 @@ ParserBench::ParserBench() :
     m_log2FactorOption(QStringList() << "l" << "log2-factor",
         "Log2 factor for rate conversion.",
         "log2",
-        "2")
+        "2"),
+    m_nbAMBEDevicesOption(QStringList() << "d" << "ambe-devices",
+        "Number of emulated AMBE devices (ambeemu test).",
+        "devices",
+        "1"),
+    m_nbStreamsOption(QStringList() << "s" << "streams",
+        "Number of concurrent voice streams (ambeemu test).",
+        "streams",
+        "1")
 {
     m_testStr = "decimateii";
     m_nbSamples = 1048576;
     m_repetition = 1;
     m_log2Factor = 4;
+    m_nbAMBEDevices = 1;
+    m_nbStreams = 1;
 
     m_parser.setApplicationDescription("Software Defined Radio application benchmarks");
     m_parser.addHelpOption();
@@ -53,6 +63,8 @@ ParserBench::ParserBench() :
     m_parser.addOption(m_nbSamplesOption);
     m_parser.addOption(m_repetitionOption);
     m_parser.addOption(m_log2FactorOption);
+    m_parser.addOption(m_nbAMBEDevicesOption);
+    m_parser.addOption(m_nbStreamsOption);
 }
 
 ParserBench::~ParserBench()
@@ -111,6 +123,28 @@ void ParserBench::parse(const QCoreApplication& app)
     } else {
         qWarning() << "ParserBench::parse: repetilog2 factortion invalid. Defaulting to " << m_log2Factor;
     }
+
+    // number of emulated AMBE devices
+
+    QString nbAMBEDevicesStr = m_parser.value(m_nbAMBEDevicesOption);
+    int nbAMBEDevices = nbAMBEDevicesStr.toInt(&ok);
+
+    if (ok && (nbAMBEDevices > 0) && (nbAMBEDevices <= 16)) {
+        m_nbAMBEDevices = nbAMBEDevices;
+    } else {
+        qWarning() << "ParserBench::parse: number of AMBE devices invalid. Defaulting to " << m_nbAMBEDevices;
+    }
+
+    // number of streams
+
+    QString nbStreamsStr = m_parser.value(m_nbStreamsOption);
+    int nbStreams = nbStreamsStr.toInt(&ok);
+
+    if (ok && (nbStreams > 0) && (nbStreams <= 64)) {
+        m_nbStreams = nbStreams;
+    } else {
+        qWarning() << "ParserBench::parse: number of streams invalid. Defaulting to " << m_nbStreams;
+    }
 }
 
 ParserBench::TestType ParserBench::getTestType() const
@@ -127,6 +161,22 @@ ParserBench::TestType ParserBench::getTestType() const
         return TestDecimatorsSupII;
     } else if (m_testStr == "ambe") {
         return TestAMBE;
+    } else if (m_testStr == "ambeemu") {
+        return TestAMBEEmulated;
+    } else if (m_testStr == "fftfilt") {
+        return TestFFTFilter;
+    } else if (m_testStr == "upchannelizer") {
+        return TestUpChannelizer;
+    } else if (m_testStr == "chanalyzer") {
+        return TestChannelAnalyzer;
+    } else if (m_testStr == "samplefifo") {
+        return TestSampleSinkFifo;
+    } else if (m_testStr == "iqcorr") {
+        return TestIQCorrections;
+    } else if (m_testStr == "projector") {
+        return TestProjector;
+    } else if (m_testStr == "chanfields") {
+        return TestChannelSettingsFields;
     } else {
         return TestDecimatorsII;
     }
@@ -33,7 +33,15 @@ public:
         TestDecimatorsFF,
         TestDecimatorsInfII,
         TestDecimatorsSupII,
-        TestAMBE
+        TestAMBE,
+        TestAMBEEmulated,
+        TestFFTFilter,
+        TestUpChannelizer,
+        TestChannelAnalyzer,
+        TestSampleSinkFifo,
+        TestIQCorrections,
+        TestProjector,
+        TestChannelSettingsFields
     } TestType;
 
     ParserBench();
@@ -46,18 +54,24 @@ public:
     uint32_t getNbSamples() const { return m_nbSamples; }
     uint32_t getRepetition() const { return m_repetition; }
     uint32_t getLog2Factor() const { return m_log2Factor; }
+    uint32_t getNbAMBEDevices() const { return m_nbAMBEDevices; }
+    uint32_t getNbStreams() const { return m_nbStreams; }
 
 private:
     QString  m_testStr;
     uint32_t m_nbSamples;
     uint32_t m_repetition;
     uint32_t m_log2Factor;
+    uint32_t m_nbAMBEDevices;
+    uint32_t m_nbStreams;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_testOption;
     QCommandLineOption m_nbSamplesOption;
     QCommandLineOption m_repetitionOption;
     QCommandLineOption m_log2FactorOption;
+    QCommandLineOption m_nbAMBEDevicesOption;
+    QCommandLineOption m_nbStreamsOption;
 };
 
 
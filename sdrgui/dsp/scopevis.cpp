@@ -16,9 +16,17 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <QDebug>
 #include <QMutexLocker>
 
+#if defined(USE_SSE2)
+#include <emmintrin.h>
+#elif defined(USE_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "scopevis.h"
 #include "dsp/dspcommands.h"
 #include "gui/glscope.h"
@@ -68,8 +76,9 @@ ScopeVis::ScopeVis(GLScope* glScope) :
     setObjectName("ScopeVis");
     m_traceDiscreteMemory.resize(m_traceChunkDefaultSize); // arbitrary
     m_glScope->setTraces(&m_traces.m_tracesData, &m_traces.m_traces[0]);
+
     for (int i = 0; i < (int) Projector::nbProjectionTypes; i++) {
-        m_projectorCache[i] = 0.0;
+        m_projectors.push_back(Projector((Projector::ProjectionType) i));
     }
 }
 
@@ -323,6 +332,12 @@ void ScopeVis::processTrace(const SampleVector::const_iterator& cbegin, const Sa
     {
         TriggerCondition* triggerCondition = m_triggerConditions[m_currentTriggerIndex]; // current trigger condition
 
+        if (begin < end) // project the whole buffer at once for the trigger search
+        {
+            m_triggerValues.resize(end - cbegin);
+            triggerCondition->m_projector.runBlock(&(*cbegin), end - cbegin, m_triggerValues.data());
+        }
+
         while (begin < end)
         {
             if (m_triggerState == TriggerDelay) // delayed trigger
@@ -354,34 +369,45 @@ void ScopeVis::processTrace(const SampleVector::const_iterator& cbegin, const Sa
                 }
             }
 
-            if (m_triggerComparator.triggered(*begin, *triggerCondition)) // matched the current trigger
+            int triggerIndex = m_triggerComparator.triggeredBlock(&m_triggerValues[begin - cbegin], end - begin, *triggerCondition);
+
+            if (triggerIndex < 0) // no match in the rest of the buffer
             {
-                if (triggerCondition->m_triggerData.m_triggerDelay > 0)
-                {
-                    triggerCondition->m_triggerDelayCount = triggerCondition->m_triggerData.m_triggerDelay; // initialize delayed samples counter
-                    m_triggerState = TriggerDelay;
-                    ++begin;
-                    continue;
-                }
+                begin = end;
+                break;
+            }
 
-                if (nextTrigger()) // move to next trigger and keep going
-                {
-                    m_triggerComparator.reset();
-                    m_triggerState = TriggerUntriggered;
-                }
-                else // this was the last trigger then start trace
-                {
-                    m_traceStart = true; // start of trace processing
-                    m_nbSamples = m_traceSize + m_maxTraceDelay;
-                    m_triggerComparator.reset();
-                    m_triggerState = TriggerTriggered;
-                    triggerPointToEnd = end - begin;
-                    break;
-                }
+            begin += triggerIndex; // matched the current trigger
+
+            if (triggerCondition->m_triggerData.m_triggerDelay > 0)
+            {
+                triggerCondition->m_triggerDelayCount = triggerCondition->m_triggerData.m_triggerDelay; // initialize delayed samples counter
+                m_triggerState = TriggerDelay;
+                ++begin;
+                continue;
+            }
+
+            if (nextTrigger()) // move to next trigger and keep going
+            {
+                m_triggerComparator.reset();
+                m_triggerState = TriggerUntriggered;
+            }
+            else // this was the last trigger then start trace
+            {
+                m_traceStart = true; // start of trace processing
+                m_nbSamples = m_traceSize + m_maxTraceDelay;
+                m_triggerComparator.reset();
+                m_triggerState = TriggerTriggered;
+                triggerPointToEnd = end - begin;
+                break;
             }
 
             ++begin;
         } // look for trigger
+
+        if (begin < end) { // stopped on the trigger: the block projection went past it so restore the phase memory to the trigger sample
+            triggerCondition->m_projector.run(*begin);
+        }
     } // untriggered or delayed
 
     // trace process
@@ -490,122 +516,151 @@ int ScopeVis::processTraces(const SampleVector::const_iterator& cbegin, const Sa
     SampleVector::const_iterator begin(cbegin);
     uint32_t shift = (m_timeOfsProMill / 1000.0) * m_traceSize;
     uint32_t length = m_traceSize / m_timeBase;
+    int nbSamples = std::min((int) (end - cbegin), m_nbSamples);
 
-    while ((begin < end) && (m_nbSamples > 0))
+    if (nbSamples > 0)
     {
-        std::vector<TraceControl*>::iterator itCtl = m_traces.m_tracesControl.begin();
-        std::vector<TraceData>::iterator itData = m_traces.m_tracesData.begin();
-        std::vector<float *>::iterator itTrace = m_traces.m_traces[m_traces.currentBufferIndex()].begin();
+        const Sample *samples = &(*cbegin);
+        uint32_t bufferIndex = m_traces.currentBufferIndex();
+        int projectionStart[(int) Projector::nbProjectionTypes];
+        int projectionEnd[(int) Projector::nbProjectionTypes];
+        int magsqStart = nbSamples, magsqEnd = 0;
+        std::fill(projectionStart, projectionStart + (int) Projector::nbProjectionTypes, nbSamples);
+        std::fill(projectionEnd, projectionEnd + (int) Projector::nbProjectionTypes, 0);
+
+        // find which samples have to be projected for each projection type
 
-        for (; itCtl != m_traces.m_tracesControl.end(); ++itCtl, ++itData, ++itTrace)
+        for (unsigned int i = 0; i < m_traces.m_tracesControl.size(); i++)
         {
-            if (traceBack && ((end - begin) > itData->m_traceDelay)) { // before start of trace
+            const TraceData& traceData = m_traces.m_tracesData[i];
+            int start, count;
+
+            if (!getTraceSpan(i, nbSamples, end - cbegin, traceBack, start, count)) {
+                continue;
+            }
+
+            if ((i > 0) && !traceData.m_viewTrace) { // hidden trace is not projected
+                continue;
+            }
+
+            if (traceData.m_projectionType == Projector::ProjectionDPhase) { // projected with the trace own projector
                 continue;
             }
 
-            Projector::ProjectionType projectionType = itData->m_projectionType;
+            int projectionIndex = (int) traceData.m_projectionType;
+            projectionStart[projectionIndex] = std::min(projectionStart[projectionIndex], start);
+            projectionEnd[projectionIndex] = std::max(projectionEnd[projectionIndex], start + count);
 
-            if ((*itCtl)->m_traceCount[m_traces.currentBufferIndex()] < m_traceSize)
+            if ((traceData.m_projectionType == Projector::ProjectionMagSq) || (traceData.m_projectionType == Projector::ProjectionMagDB))
             {
-                uint32_t& traceCount = (*itCtl)->m_traceCount[m_traces.currentBufferIndex()]; // reference for code clarity
-                float v;
+                magsqStart = std::min(magsqStart, start);
+                magsqEnd = std::max(magsqEnd, start + count);
+            }
+        }
 
-                if (projectionType == Projector::ProjectionMagLin)
-                {
-                    v = ((*itCtl)->m_projector.run(*begin) - itData->m_ofs)*itData->m_amp - 1.0f;
-                }
-                else if (projectionType == Projector::ProjectionMagSq)
-                {
-                    Real magsq = (*itCtl)->m_projector.run(*begin);
-                    v = (magsq - itData->m_ofs)*itData->m_amp - 1.0f;
+        // project each type only once for all traces
 
-                    if ((traceCount >= shift) && (traceCount < shift+length)) // power display overlay values construction
-                    {
-                        if (traceCount == shift)
-                        {
-                            (*itCtl)->m_maxPow = 0.0f;
-                            (*itCtl)->m_sumPow = 0.0f;
-                            (*itCtl)->m_nbPow = 1;
-                        }
-
-                        if (magsq > 0.0f)
-                        {
-                            if (magsq > (*itCtl)->m_maxPow)
-                            {
-                                (*itCtl)->m_maxPow = magsq;
-                            }
-
-                            (*itCtl)->m_sumPow += magsq;
-                            (*itCtl)->m_nbPow++;
-                        }
-                    }
+        if (magsqEnd > magsqStart)
+        {
+            m_magsq.resize(nbSamples);
+            Projector::magSqBlock(samples + magsqStart, magsqEnd - magsqStart, &m_magsq[magsqStart]);
+        }
 
-                    if ((m_nbSamples == 1) && ((*itCtl)->m_nbPow > 0)) // on last sample create power display overlay
-                    {
-                        double avgPow = (*itCtl)->m_sumPow / (*itCtl)->m_nbPow;
-                        itData->m_textOverlay = QString("%1  %2").arg((*itCtl)->m_maxPow, 0, 'e', 2).arg(avgPow, 0, 'e', 2);
-                        (*itCtl)->m_nbPow = 0;
-                    }
-                }
-                else if (projectionType == Projector::ProjectionMagDB)
-                {
-                    Real re = begin->m_real / SDR_RX_SCALEF;
-                    Real im = begin->m_imag / SDR_RX_SCALEF;
-                    double magsq = re*re + im*im;
-                    float pdB = log10f(magsq) * 10.0f;
-                    float p = pdB - (100.0f * itData->m_ofs);
-                    v = ((p/50.0f) + 2.0f)*itData->m_amp - 1.0f;
-
-                    if ((traceCount >= shift) && (traceCount < shift+length)) // power display overlay values construction
-                    {
-                        if (traceCount == shift)
-                        {
-                            (*itCtl)->m_maxPow = 0.0f;
-                            (*itCtl)->m_sumPow = 0.0f;
-                            (*itCtl)->m_nbPow = 1;
-                        }
-
-                        if (magsq > 0.0f)
-                        {
-                            if (magsq > (*itCtl)->m_maxPow)
-                            {
-                                (*itCtl)->m_maxPow = magsq;
-                            }
-
-                            (*itCtl)->m_sumPow += magsq;
-                            (*itCtl)->m_nbPow++;
-                        }
-                    }
+        for (int projectionIndex = 0; projectionIndex < (int) Projector::nbProjectionTypes; projectionIndex++)
+        {
+            int start = projectionStart[projectionIndex];
+            int count = projectionEnd[projectionIndex] - start;
 
-                    if ((m_nbSamples == 1) && ((*itCtl)->m_nbPow > 0)) // on last sample create power display overlay
-                    {
-                        double avgPow = log10f((*itCtl)->m_sumPow / (*itCtl)->m_nbPow)*10.0;
-                        double peakPow = log10f((*itCtl)->m_maxPow)*10.0;
-                        double peakToAvgPow = peakPow - avgPow;
-                        itData->m_textOverlay = QString("%1  %2  %3").arg(peakPow, 0, 'f', 1).arg(avgPow, 0, 'f', 1).arg(peakToAvgPow, 4, 'f', 1, ' ');
-                        (*itCtl)->m_nbPow = 0;
-                    }
-                }
-                else
-                {
-                    v = ((*itCtl)->m_projector.run(*begin) - itData->m_ofs) * itData->m_amp;
-                }
+            if (count <= 0) {
+                continue;
+            }
+
+            std::vector<Real>& projection = m_projections[projectionIndex];
+            projection.resize(nbSamples);
 
-                if(v > 1.0f) {
-                    v = 1.0f;
-                } else if (v < -1.0f) {
-                    v = -1.0f;
+            if (projectionIndex == (int) Projector::ProjectionMagSq) {
+                std::copy(&m_magsq[start], &m_magsq[start] + count, &projection[start]);
+            } else if (projectionIndex == (int) Projector::ProjectionMagDB) {
+                Projector::dBBlock(&m_magsq[start], count, &projection[start]);
+            } else {
+                m_projectors[projectionIndex].runBlock(samples + start, count, &projection[start]);
+            }
+        }
+
+        // scale projections to display
+
+        for (unsigned int i = 0; i < m_traces.m_tracesControl.size(); i++)
+        {
+            TraceControl *traceControl = m_traces.m_tracesControl[i];
+            TraceData& traceData = m_traces.m_tracesData[i];
+            uint32_t& traceCount = traceControl->m_traceCount[bufferIndex]; // reference for code clarity
+            int start, count;
+
+            if (!getTraceSpan(i, nbSamples, end - cbegin, traceBack, start, count)) {
+                continue;
+            }
+
+            if ((i > 0) && !traceData.m_viewTrace) // hidden trace (first trace is used as X in XY displays)
+            {
+                traceCount += count;
+                continue;
+            }
+
+            Projector::ProjectionType projectionType = traceData.m_projectionType;
+
+            if (projectionType == Projector::ProjectionDPhase)
+            {
+                // The phase memory must follow the samples of this trace only through the trace back
+                // and the following blocks thus the trace projector is used instead of the shared one
+                std::vector<Real>& projection = m_projections[(int) projectionType];
+                projection.resize(nbSamples);
+
+                if ((traceCount == 0) && (start > 0)) { // phase reference of the first sample of the trace
+                    traceControl->m_projector.run(samples[start - 1]);
                 }
 
-                (*itTrace)[2*traceCount]
-                           = traceCount - shift;   // display x
-                (*itTrace)[2*traceCount + 1] = v;  // display y
-                traceCount++;
+                traceControl->m_projector.runBlock(samples + start, count, &projection[start]);
+            }
+
+            const Real *values = &m_projections[(int) projectionType][start];
+            float a, b; // v = a*value + b
+
+            if ((projectionType == Projector::ProjectionMagLin) || (projectionType == Projector::ProjectionMagSq))
+            {
+                a = traceData.m_amp;
+                b = -traceData.m_ofs*traceData.m_amp - 1.0f;
+            }
+            else if (projectionType == Projector::ProjectionMagDB)
+            {
+                a = traceData.m_amp / 50.0f;
+                b = (2.0f - 2.0f*traceData.m_ofs)*traceData.m_amp - 1.0f;
+            }
+            else
+            {
+                a = traceData.m_amp;
+                b = -traceData.m_ofs*traceData.m_amp;
+            }
+
+            float *trace = &m_traces.m_traces[bufferIndex][i][2*traceCount];
+            uint32_t x = traceCount - shift;
+
+            for (int k = 0; k < count; k++)
+            {
+                float v = values[k]*a + b;
+                trace[2*k] = x + k;                                  // display x
+                trace[2*k + 1] = v > 1.0f ? 1.0f : v < -1.0f ? -1.0f : v; // display y
+            }
+
+            if ((projectionType == Projector::ProjectionMagSq) || (projectionType == Projector::ProjectionMagDB)) {
+                updatePowerOverlay(traceControl, traceData, &m_magsq[start], count, traceCount, shift, length,
+                    (m_nbSamples == nbSamples) && (start + count == nbSamples));
             }
+
+            traceCount += count;
         }
 
-        ++begin;
-        m_nbSamples--;
+        begin += nbSamples;
+        m_nbSamples -= nbSamples;
     }
 
     float traceTime = ((float) m_traceSize) / m_sampleRate;
@@ -637,6 +692,153 @@ int ScopeVis::processTraces(const SampleVector::const_iterator& cbegin, const Sa
     }
 }
 
+#if defined(USE_SSE2) || defined(USE_NEON)
+static inline int greaterThanMask(const Real *values, Real level) //!< one bit per value in a group of 4 values
+{
+#if defined(USE_SSE2)
+    return _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(values), _mm_set1_ps(level)));
+#else
+    static const uint32_t bitValues[4] = {1, 2, 4, 8};
+    uint32x4_t bits = vandq_u32(vcgtq_f32(vld1q_f32(values), vdupq_n_f32(level)), vld1q_u32(bitValues));
+    uint32x2_t sum = vpadd_u32(vget_low_u32(bits), vget_high_u32(bits));
+    sum = vpadd_u32(sum, sum);
+    return vget_lane_u32(sum, 0);
+#endif
+}
+#endif
+
+int ScopeVis::TriggerComparator::triggeredBlock(const Real *values, int nbValues, TriggerCondition& triggerCondition)
+{
+    int i = 0;
+
+    if (triggerCondition.m_triggerData.m_triggerHoldoff > 0) // hold off counts have to be processed sample by sample
+    {
+        for (; i < nbValues; i++)
+        {
+            if (triggered(values[i], triggerCondition)) {
+                return i;
+            }
+        }
+
+        return -1;
+    }
+
+    if ((nbValues > 0) && m_reset) // initializes previous condition
+    {
+        triggered(values[0], triggerCondition);
+        i++;
+    }
+
+#if defined(USE_SSE2) || defined(USE_NEON)
+    Real level = getLevel(triggerCondition);
+    int prevBit = triggerCondition.m_prevCondition ? 1 : 0;
+
+    for (; i + 4 <= nbValues; i += 4)
+    {
+        int bits = greaterThanMask(&values[i], level);
+        int prevBits = ((bits << 1) | prevBit) & 0xF;
+        int edges;
+
+        if (triggerCondition.m_triggerData.m_triggerBothEdges) {
+            edges = bits ^ prevBits;
+        } else if (triggerCondition.m_triggerData.m_triggerPositiveEdge) {
+            edges = bits & ~prevBits;
+        } else {
+            edges = ~bits & prevBits;
+        }
+
+        if (edges & 0xF)
+        {
+            int k = 0;
+
+            while ((edges & (1<<k)) == 0) {
+                k++;
+            }
+
+            updateHoldoffCounts(bits, (2<<k) - 1, triggerCondition);
+            triggerCondition.m_prevCondition = (bits >> k) & 1;
+            return i + k;
+        }
+
+        updateHoldoffCounts(bits, 0xF, triggerCondition);
+        prevBit = bits >> 3;
+    }
+
+    triggerCondition.m_prevCondition = prevBit != 0;
+#endif
+
+    for (; i < nbValues; i++)
+    {
+        if (triggered(values[i], triggerCondition)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool ScopeVis::getTraceSpan(unsigned int traceIndex, int nbSamples, int bufferSize, bool traceBack, int& start, int& count)
+{
+    const TraceData& traceData = m_traces.m_tracesData[traceIndex];
+    uint32_t traceCount = m_traces.m_tracesControl[traceIndex]->m_traceCount[m_traces.currentBufferIndex()];
+    start = traceBack ? std::max(0, bufferSize - (int) traceData.m_traceDelay) : 0; // in trace back skip samples before start of trace
+    count = std::min(nbSamples - start, (int) m_traceSize - (int) traceCount);
+    return count > 0;
+}
+
+void ScopeVis::updatePowerOverlay(
+    TraceControl *traceControl,
+    TraceData& traceData,
+    const Real *magsq,
+    int count,
+    uint32_t traceCount,
+    uint32_t shift,
+    uint32_t length,
+    bool last)
+{
+    int kStart = traceCount < shift ? shift - traceCount : 0;
+    int kEnd = traceCount < shift + length ? std::min(count, (int) (shift + length - traceCount)) : 0;
+
+    for (int k = kStart; k < kEnd; k++) // power display overlay values construction
+    {
+        if (traceCount + k == shift)
+        {
+            traceControl->m_maxPow = 0.0f;
+            traceControl->m_sumPow = 0.0f;
+            traceControl->m_nbPow = 1;
+        }
+
+        if (magsq[k] > 0.0f)
+        {
+            if (magsq[k] > traceControl->m_maxPow)
+            {
+                traceControl->m_maxPow = magsq[k];
+            }
+
+            traceControl->m_sumPow += magsq[k];
+            traceControl->m_nbPow++;
+        }
+    }
+
+    if (last && (traceControl->m_nbPow > 0)) // on last sample create power display overlay
+    {
+        if (traceData.m_projectionType == Projector::ProjectionMagDB)
+        {
+            double avgPow = log10f(traceControl->m_sumPow / traceControl->m_nbPow)*10.0;
+            double peakPow = log10f(traceControl->m_maxPow)*10.0;
+            double peakToAvgPow = peakPow - avgPow;
+            traceData.m_textOverlay = QString("%1  %2  %3").arg(peakPow, 0, 'f', 1).arg(avgPow, 0, 'f', 1).arg(peakToAvgPow, 4, 'f', 1, ' ');
+        }
+        else
+        {
+            double avgPow = traceControl->m_sumPow / traceControl->m_nbPow;
+            traceData.m_textOverlay = QString("%1  %2").arg(traceControl->m_maxPow, 0, 'e', 2).arg(avgPow, 0, 'e', 2);
+        }
+
+        traceControl->m_nbPow = 0;
+    }
+}
+
 void ScopeVis::start()
 {
 }
@@ -914,13 +1116,9 @@ bool ScopeVis::handleMessage(const Message& message)
 void ScopeVis::updateMaxTraceDelay()
 {
     int maxTraceDelay = 0;
-    bool allocateCache = false;
-    uint32_t projectorCounts[(int) Projector::nbProjectionTypes];
-    memset(projectorCounts, 0, ((int) Projector::nbProjectionTypes)*sizeof(uint32_t));
     std::vector<TraceData>::iterator itData = m_traces.m_tracesData.begin();
-    std::vector<TraceControl*>::iterator itCtrl = m_traces.m_tracesControl.begin();
 
-    for (; itData != m_traces.m_tracesData.end(); ++itData, ++itCtrl)
+    for (; itData != m_traces.m_tracesData.end(); ++itData)
     {
         if (itData->m_traceDelay > maxTraceDelay)
         {
@@ -930,29 +1128,6 @@ void ScopeVis::updateMaxTraceDelay()
         if (itData->m_projectionType < 0) {
             itData->m_projectionType = Projector::ProjectionReal;
         }
-
-        if (projectorCounts[(int) itData->m_projectionType] > 0)
-        {
-            allocateCache = true;
-            (*itCtrl)->m_projector.setCacheMaster(false);
-        }
-        else
-        {
-            (*itCtrl)->m_projector.setCacheMaster(true);
-        }
-
-        projectorCounts[(int) itData->m_projectionType]++;
-    }
-
-    itCtrl = m_traces.m_tracesControl.begin();
-
-    for (; itCtrl != m_traces.m_tracesControl.end(); ++itCtrl)
-    {
-        if (allocateCache) {
-            (*itCtrl)->m_projector.setCache(m_projectorCache);
-        } else {
-            (*itCtrl)->m_projector.setCache(0);
-        }
     }
 
     m_maxTraceDelay = maxTraceDelay;
@@ -1047,23 +1047,14 @@ private:
             computeLevels();
         }
 
-        bool triggered(const Sample& s, TriggerCondition& triggerCondition)
+        /**
+         * Compare a projected sample value to the trigger level and return true on the trigger edge
+         */
+        bool triggered(Real value, TriggerCondition& triggerCondition)
         {
-            if (triggerCondition.m_triggerData.m_triggerLevel != m_level)
-            {
-                m_level = triggerCondition.m_triggerData.m_triggerLevel;
-                computeLevels();
-            }
-
             bool condition, trigger;
 
-            if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagDB) {
-                condition = triggerCondition.m_projector.run(s) > m_levelPowerDB;
-            } else if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagLin) {
-                condition = triggerCondition.m_projector.run(s) > m_levelPowerLin;
-            } else {
-                condition = triggerCondition.m_projector.run(s) > m_level;
-            }
+            condition = value > getLevel(triggerCondition);
 
             if (condition)
             {
@@ -1103,7 +1094,7 @@ private:
 //                qDebug("ScopeVis::triggered: %s/%s %f/%f",
 //                        triggerCondition.m_prevCondition ? "T" : "F",
 //                        condition ? "T" : "F",
-//                        triggerCondition.m_projector->run(s),
+//                        value,
 //                        triggerCondition.m_triggerData.m_triggerLevel);
 //            }
 
@@ -1111,12 +1102,49 @@ private:
             return trigger;
         }
 
+        /**
+         * Look for the trigger edge in a block of projected sample values.
+         * Returns the index of the triggering value or -1 if the block does not trigger.
+         */
+        int triggeredBlock(const Real *values, int nbValues, TriggerCondition& triggerCondition);
+
         void reset()
         {
             m_reset = true;
         }
 
     private:
+        /**
+         * Hold off counts as triggered() leaves them with no hold off for the values of a group
+         * of 4 compared values (bits) selected by mask
+         */
+        static void updateHoldoffCounts(int bits, int mask, TriggerCondition& triggerCondition)
+        {
+            if (bits & mask) { // some true conditions
+                triggerCondition.m_falses = 0;
+            }
+            if (~bits & mask) { // some false conditions
+                triggerCondition.m_trues = 0;
+            }
+        }
+
+        Real getLevel(const TriggerCondition& triggerCondition)
+        {
+            if (triggerCondition.m_triggerData.m_triggerLevel != m_level)
+            {
+                m_level = triggerCondition.m_triggerData.m_triggerLevel;
+                computeLevels();
+            }
+
+            if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagDB) {
+                return m_levelPowerDB;
+            } else if (triggerCondition.m_projector.getProjectionType() == Projector::ProjectionMagLin) {
+                return m_levelPowerLin;
+            } else {
+                return m_level;
+            }
+        }
+
         void computeLevels()
         {
             m_levelPowerLin = m_level + 1.0f;
@@ -1153,7 +1181,10 @@ private:
     int m_maxTraceDelay;                           //!< Maximum trace delay
     TriggerComparator m_triggerComparator;         //!< Compares sample level to trigger level
     QMutex m_mutex;
-    Real m_projectorCache[(int) Projector::nbProjectionTypes];
+    std::vector<Projector> m_projectors;           //!< One projector per projection type shared by all traces (but DPhase that has memory)
+    std::vector<Real> m_projections[(int) Projector::nbProjectionTypes]; //!< Current block of samples projected for each projection type
+    std::vector<Real> m_magsq;                     //!< Current block of samples squared magnitudes for power overlays
+    std::vector<Real> m_triggerValues;             //!< Current block of samples projected for the current trigger
     bool m_triggerOneShot;                         //!< True when one shot mode is active
     bool m_triggerWaitForReset;                    //!< In one shot mode suspended until reset by UI
     uint32_t m_currentTraceMemoryIndex;            //!< The current index of trace in memory (0: current)
@@ -1182,6 +1213,29 @@ private:
      */
     int processTraces(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool traceBack = false);
 
+    /**
+     * Get the span of samples of the current block to process for a trace
+     * - start: index of first sample in the block
+     * - count: number of samples to process
+     * Returns false if there is nothing to process
+     */
+    bool getTraceSpan(unsigned int traceIndex, int nbSamples, int bufferSize, bool traceBack, int& start, int& count);
+
+    /**
+     * Update power display overlay values (MagSq and MagDB traces) with a block of squared magnitudes
+     * starting at trace position traceCount. The overlay text is built when last is true.
+     */
+    void updatePowerOverlay(
+        TraceControl *traceControl,
+        TraceData& traceData,
+        const Real *magsq,
+        int count,
+        uint32_t traceCount,
+        uint32_t shift,
+        uint32_t length,
+        bool last
+    );
+
     /**
      * Get maximum trace delay
      */
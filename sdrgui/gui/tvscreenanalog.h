@@ -26,7 +26,6 @@
 #include "export.h"
 
 #include <memory>
-#include <algorithm>
 
 #include <QMutex>
 #include <QTimer>
@@ -35,81 +34,7 @@
 #include <QOpenGLFunctions>
 #include <QOpenGLShaderProgram>
 
-class TVScreenAnalogBuffer
-{
-public:
-	TVScreenAnalogBuffer(int width, int height)
-	{
-		m_width = width;
-		m_height = height;
-
-		m_imageData = new int[width * height];
-		m_lineShiftData = new int[height];
-		m_outOfBoundsLine = new int[width];
-		m_currentLine = m_outOfBoundsLine;
-
-		std::fill(m_imageData, m_imageData + width * height, 0);
-		std::fill(m_lineShiftData, m_lineShiftData + height, 127);
-	}
-
-	~TVScreenAnalogBuffer()
-	{
-		delete[] m_imageData;
-		delete[] m_lineShiftData;
-		delete[] m_outOfBoundsLine;
-	}
-
-	int getWidth()
-	{
-		return m_width;
-	}
-
-	int getHeight()
-	{
-		return m_height;
-	}
-
-	const int* getImageData()
-	{
-		return m_imageData;
-	}
-
-	const int* getLineShiftData()
-	{
-		return m_lineShiftData;
-	}
-
-	void selectRow(int line, float shift)
-	{
-		if ((line < m_height) && (line >= 0))
-		{
-			m_currentLine = m_imageData + line * m_width;
-			m_lineShiftData[line] = (1.0f + shift) * 127.5f;
-		}
-		else
-		{
-			m_currentLine = m_outOfBoundsLine;
-		}
-	}
-
-	void setSampleValue(int column, int value)
-	{
-		if ((column < m_width - 2) && (column >= -2))
-		{
-			m_currentLine[column + 2] = value;
-		}
-	}
-
-private:
-	int m_width;
-	int m_height;
-
-	int* m_imageData;
-	int* m_lineShiftData;
-
-	int* m_currentLine;
-	int* m_outOfBoundsLine;
-};
+#include "tvscreenanalogbuffer.h"
 
 class SDRGUI_API TVScreenAnalog : public QGLWidget, protected QOpenGLFunctions
 {
@@ -176,6 +176,7 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
     splash->showStatusMessage("allocate FFTs...", Qt::white);
     splash->showStatusMessage("allocate FFTs...", Qt::white);
     m_dspEngine->createFFTFactory(parser.getFFTWFWisdomFileName());
+    m_dspEngine->createBasebandExecutor(parser.getExecutorAffinity());
     m_dspEngine->preAllocateFFTs();
 
     splash->showStatusMessage("load settings...", Qt::white);
@@ -449,6 +450,8 @@ void MainWindow::removeLastDevice()
 	    DSPDeviceSourceEngine *lastDeviceEngine = m_deviceUIs.back()->m_deviceSourceEngine;
 	    lastDeviceEngine->stopAcquistion();
 	    lastDeviceEngine->removeSink(m_deviceUIs.back()->m_spectrumVis);
+	    m_deviceUIs.back()->m_deviceSet->applyWaterfallTilesSettings( // the device set outlives the engine
+	        m_deviceUIs.back()->m_deviceSet->getWaterfallTilesSettings(), false);
 
 	    ui->tabSpectraGUI->removeTab(ui->tabSpectraGUI->count() - 1);
 	    ui->tabSpectra->removeTab(ui->tabSpectra->count() - 1);
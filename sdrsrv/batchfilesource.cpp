@@ -0,0 +1,248 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/dspcommands.h"
+#include "dsp/filerecord.h"
+#include "device/deviceapi.h"
+
+#include "batchfilesource.h"
+
+BatchFileSourceThread::BatchFileSourceThread(std::ifstream *samplesStream, SampleSinkFifo* sampleFifo, QObject* parent) :
+    QThread(parent),
+    m_running(false),
+    m_eof(false),
+    m_samplesCount(0),
+    m_ifstream(samplesStream),
+    m_sampleFifo(sampleFifo),
+    m_sampleSize(16),
+    m_sampleBytes(2)
+{
+}
+
+BatchFileSourceThread::~BatchFileSourceThread()
+{
+    stopWork();
+}
+
+void BatchFileSourceThread::startWork()
+{
+    m_startWaitMutex.lock();
+    start();
+
+    while (!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void BatchFileSourceThread::stopWork()
+{
+    m_running = false;
+    wait();
+}
+
+void BatchFileSourceThread::setSampleSize(quint32 sampleSize)
+{
+    m_sampleSize = sampleSize;
+    m_sampleBytes = m_sampleSize > 16 ? sizeof(int32_t) : sizeof(int16_t);
+}
+
+void BatchFileSourceThread::run()
+{
+    m_fileBuf.resize(m_blockSize * 2 * m_sampleBytes);
+    m_convertBuf.resize(m_blockSize);
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    while (m_running)
+    {
+        m_ifstream->read(reinterpret_cast<char*>(m_fileBuf.data()), m_fileBuf.size());
+        unsigned int nbSamples = m_ifstream->gcount() / (2 * m_sampleBytes);
+        writeToSampleFifo(m_fileBuf.data(), nbSamples);
+        m_samplesCount += nbSamples;
+
+        if (m_ifstream->eof())
+        {
+            qDebug("BatchFileSourceThread::run: end of file after %llu samples", m_samplesCount.load());
+            m_eof = true;
+            break;
+        }
+    }
+
+    m_running = false;
+}
+
+void BatchFileSourceThread::writeToSampleFifo(const quint8* buf, unsigned int nbSamples)
+{
+    if (m_sampleSize == 16)
+    {
+        const int16_t *fileBuf = (const int16_t *) buf;
+
+        for (unsigned int is = 0; is < nbSamples; is++)
+        {
+            m_convertBuf[is].m_real = fileBuf[2*is] << (SDR_RX_SAMP_SZ - 16);
+            m_convertBuf[is].m_imag = fileBuf[2*is+1] << (SDR_RX_SAMP_SZ - 16);
+        }
+    }
+    else
+    {
+        const int32_t *fileBuf = (const int32_t *) buf;
+
+        for (unsigned int is = 0; is < nbSamples; is++)
+        {
+            m_convertBuf[is].m_real = fileBuf[2*is] >> (24 - SDR_RX_SAMP_SZ);
+            m_convertBuf[is].m_imag = fileBuf[2*is+1] >> (24 - SDR_RX_SAMP_SZ);
+        }
+    }
+
+    // nothing is dropped here: the FIFO blocks or returns what it could take
+    SampleVector::const_iterator begin = m_convertBuf.begin();
+    SampleVector::const_iterator end = m_convertBuf.begin() + nbSamples;
+
+    while (m_running && (begin != end))
+    {
+        unsigned int written = m_sampleFifo->write(begin, end);
+        begin += written;
+
+        if (written == 0) {
+            msleep(1);
+        }
+    }
+}
+
+BatchFileSource::BatchFileSource(DeviceAPI *deviceAPI) :
+    m_deviceAPI(deviceAPI),
+    m_thread(nullptr),
+    m_deviceDescription("BatchFileSource"),
+    m_sampleRate(48000),
+    m_sampleSize(16),
+    m_centerFrequency(0),
+    m_recordLengthSamples(0)
+{
+    m_deviceAPI->setNbSourceStreams(1);
+}
+
+BatchFileSource::~BatchFileSource()
+{
+    stop();
+}
+
+void BatchFileSource::destroy()
+{
+    delete this;
+}
+
+bool BatchFileSource::openFile(const QString& fileName)
+{
+#ifdef Q_OS_WIN
+    m_ifstream.open(fileName.toStdWString().c_str(), std::ios::binary | std::ios::ate);
+#else
+    m_ifstream.open(fileName.toStdString().c_str(), std::ios::binary | std::ios::ate);
+#endif
+
+    if (!m_ifstream.is_open())
+    {
+        qCritical("BatchFileSource::openFile: cannot open %s", qPrintable(fileName));
+        return false;
+    }
+
+    quint64 fileSize = m_ifstream.tellg();
+
+    if (fileSize <= sizeof(FileRecord::Header))
+    {
+        qCritical("BatchFileSource::openFile: %s is too short", qPrintable(fileName));
+        m_ifstream.close();
+        return false;
+    }
+
+    FileRecord::Header header;
+    m_ifstream.seekg(0, std::ios_base::beg);
+
+    if (!FileRecord::readHeader(m_ifstream, header))
+    {
+        qCritical("BatchFileSource::openFile: bad header CRC in %s", qPrintable(fileName));
+        m_ifstream.close();
+        return false;
+    }
+
+    m_sampleRate = header.sampleRate;
+    m_centerFrequency = header.centerFrequency;
+    m_sampleSize = header.sampleSize;
+    m_recordLengthSamples = (fileSize - sizeof(FileRecord::Header)) / (m_sampleSize == 24 ? 8 : 4);
+
+    qDebug() << "BatchFileSource::openFile: " << fileName
+        << " sample rate: " << m_sampleRate << " S/s"
+        << " center frequency: " << m_centerFrequency << " Hz"
+        << " sample size: " << m_sampleSize << " bits"
+        << " length: " << m_recordLengthSamples << " samples";
+
+    return true;
+}
+
+bool BatchFileSource::isEOF() const
+{
+    return m_thread ? m_thread->isEOF() : false;
+}
+
+quint64 BatchFileSource::getSamplesCount() const
+{
+    return m_thread ? m_thread->getSamplesCount() : 0;
+}
+
+void BatchFileSource::init()
+{
+    DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+    m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+}
+
+bool BatchFileSource::start()
+{
+    if (!m_ifstream.is_open())
+    {
+        qWarning("BatchFileSource::start: file not open. not starting");
+        return false;
+    }
+
+    if (!m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(m_sampleRate)))
+    {
+        qCritical("BatchFileSource::start: could not allocate SampleFifo");
+        return false;
+    }
+
+    m_ifstream.clear();
+    m_ifstream.seekg(sizeof(FileRecord::Header), std::ios::beg);
+    m_thread = new BatchFileSourceThread(&m_ifstream, &m_sampleFifo);
+    m_thread->setSampleSize(m_sampleSize);
+    m_thread->startWork();
+    qDebug("BatchFileSource::start: started");
+
+    return true;
+}
+
+void BatchFileSource::stop()
+{
+    if (m_thread)
+    {
+        m_thread->stopWork();
+        delete m_thread;
+        m_thread = nullptr;
+        qDebug("BatchFileSource::stop: stopped");
+    }
+}
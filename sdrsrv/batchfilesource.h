@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRSRV_BATCHFILESOURCE_H_
+#define SDRSRV_BATCHFILESOURCE_H_
+
+#include <atomic>
+#include <fstream>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include "dsp/devicesamplesource.h"
+
+class DeviceAPI;
+
+/**
+ * Reads a .sdriq recording and writes its samples to the device FIFO as fast as the FIFO accepts them.
+ * With blocking FIFO writes the pace is set by the slowest stage of the pipeline.
+ */
+class BatchFileSourceThread : public QThread {
+    Q_OBJECT
+
+public:
+    BatchFileSourceThread(std::ifstream *samplesStream, SampleSinkFifo* sampleFifo, QObject* parent = nullptr);
+    ~BatchFileSourceThread();
+
+    void startWork();
+    void stopWork();
+    void setSampleSize(quint32 sampleSize);
+    bool isEOF() const { return m_eof.load(); }
+    quint64 getSamplesCount() const { return m_samplesCount.load(); }
+
+private:
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    std::atomic<bool> m_running;
+    std::atomic<bool> m_eof;
+    std::atomic<quint64> m_samplesCount;
+
+    std::ifstream *m_ifstream;
+    SampleSinkFifo *m_sampleFifo;
+    quint32 m_sampleSize;  //!< File effective sample size in bits (I or Q). Ex: 16, 24.
+    quint32 m_sampleBytes; //!< Number of bytes used to store a I or Q sample. Ex: 2. 4.
+    std::vector<quint8> m_fileBuf;
+    SampleVector m_convertBuf;
+
+    static const unsigned int m_blockSize = 1<<16; //!< number of I/Q samples read at once
+
+    void run();
+    void writeToSampleFifo(const quint8* buf, unsigned int nbSamples);
+};
+
+/**
+ * Minimal sample source used by the server batch mode. It is not a plugin: it is attached directly to
+ * the device set created for the batch and exposes the recording sample rate and center frequency.
+ */
+class BatchFileSource : public DeviceSampleSource {
+    Q_OBJECT
+
+public:
+    BatchFileSource(DeviceAPI *deviceAPI);
+    virtual ~BatchFileSource();
+    virtual void destroy();
+
+    bool openFile(const QString& fileName); //!< returns false if the file cannot be used
+    bool isEOF() const;
+    quint64 getSamplesCount() const;
+    quint64 getRecordLengthSamples() const { return m_recordLengthSamples; }
+
+    virtual void init();
+    virtual bool start();
+    virtual void stop();
+
+    virtual QByteArray serialize() const { return QByteArray(); }
+    virtual bool deserialize(const QByteArray& data) { (void) data; return true; }
+
+    virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
+    virtual const QString& getDeviceDescription() const { return m_deviceDescription; }
+    virtual int getSampleRate() const { return m_sampleRate; }
+    virtual void setSampleRate(int sampleRate) { (void) sampleRate; }
+    virtual quint64 getCenterFrequency() const { return m_centerFrequency; }
+    virtual void setCenterFrequency(qint64 centerFrequency) { (void) centerFrequency; }
+
+    virtual bool handleMessage(const Message& message) { (void) message; return false; }
+
+private:
+    DeviceAPI *m_deviceAPI;
+    std::ifstream m_ifstream;
+    BatchFileSourceThread *m_thread;
+    QString m_deviceDescription;
+    int m_sampleRate;
+    quint32 m_sampleSize;
+    quint64 m_centerFrequency;
+    quint64 m_recordLengthSamples;
+};
+
+#endif // SDRSRV_BATCHFILESOURCE_H_
@@ -0,0 +1,316 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QDir>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include "SWGChannelReport.h"
+
+#include "audio/audiofifo.h"
+#include "audio/audiodevicemanager.h"
+#include "channel/channelapi.h"
+#include "device/deviceapi.h"
+#include "device/deviceset.h"
+#include "dsp/dsptypes.h"
+
+#include "batchfilesource.h"
+#include "batchprocessor.h"
+
+BatchAudioRecorder::BatchAudioRecorder(const QString& outputDirectory, QObject* parent) :
+    QThread(parent),
+    m_outputDirectory(outputDirectory),
+    m_running(false)
+{
+    m_buffer.resize(16384 * sizeof(AudioSample));
+}
+
+BatchAudioRecorder::~BatchAudioRecorder()
+{
+    stopWork();
+}
+
+void BatchAudioRecorder::addFifo(AudioFifo *audioFifo, int sampleRate)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (std::vector<Record>::const_iterator it = m_records.begin(); it != m_records.end(); ++it)
+    {
+        if (it->m_audioFifo == audioFifo) {
+            return;
+        }
+    }
+
+    Record record;
+    record.m_audioFifo = audioFifo;
+    record.m_stats.m_fileName = QDir(m_outputDirectory).filePath(QString("audio%1.wav").arg(m_records.size()));
+    record.m_stats.m_sampleRate = sampleRate;
+    record.m_stats.m_samplesWritten = 0;
+    record.m_stats.m_overruns = audioFifo->getOverrunCount();
+    record.m_stream = new std::ofstream(record.m_stats.m_fileName.toStdString().c_str(), std::ios::binary);
+    writeWavHeader(*record.m_stream, sampleRate, 0);
+    m_records.push_back(record);
+
+    qInfo("BatchAudioRecorder::addFifo: %s at %d S/s", qPrintable(record.m_stats.m_fileName), sampleRate);
+}
+
+void BatchAudioRecorder::startWork()
+{
+    m_running = true;
+    start();
+}
+
+void BatchAudioRecorder::stopWork()
+{
+    if (!m_running) {
+        return;
+    }
+
+    m_running = false;
+    wait();
+    drain();
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    for (std::vector<Record>::iterator it = m_records.begin(); it != m_records.end(); ++it)
+    {
+        it->m_stats.m_overruns = it->m_audioFifo->getOverrunCount() - it->m_stats.m_overruns;
+        it->m_stream->seekp(0, std::ios::beg);
+        writeWavHeader(*it->m_stream, it->m_stats.m_sampleRate, it->m_stats.m_samplesWritten);
+        it->m_stream->close();
+        delete it->m_stream;
+        it->m_stream = nullptr;
+    }
+}
+
+void BatchAudioRecorder::getStats(std::vector<RecordStats>& stats)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    stats.clear();
+
+    for (std::vector<Record>::const_iterator it = m_records.begin(); it != m_records.end(); ++it) {
+        stats.push_back(it->m_stats);
+    }
+}
+
+void BatchAudioRecorder::run()
+{
+    while (m_running)
+    {
+        drain();
+        msleep(2);
+    }
+}
+
+void BatchAudioRecorder::drain()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    uint32_t bufferSamples = m_buffer.size() / sizeof(AudioSample);
+
+    for (std::vector<Record>::iterator it = m_records.begin(); it != m_records.end(); ++it)
+    {
+        if (!it->m_stream) {
+            continue;
+        }
+
+        uint32_t nbSamples;
+
+        while ((nbSamples = it->m_audioFifo->read(m_buffer.data(), std::min(it->m_audioFifo->fill(), bufferSamples))) > 0)
+        {
+            it->m_stream->write(reinterpret_cast<const char*>(m_buffer.data()), nbSamples * sizeof(AudioSample));
+            it->m_stats.m_samplesWritten += nbSamples;
+        }
+    }
+}
+
+void BatchAudioRecorder::writeWavHeader(std::ofstream& stream, int sampleRate, quint64 nbSamples)
+{
+    const quint16 nbChannels = 2;
+    const quint16 bitsPerSample = 16;
+    quint32 dataSize = nbSamples * sizeof(AudioSample);
+    quint32 riffSize = 36 + dataSize;
+    quint32 fmtSize = 16;
+    quint16 audioFormat = 1; // PCM
+    quint32 rate = sampleRate;
+    quint32 byteRate = sampleRate * sizeof(AudioSample);
+    quint16 blockAlign = sizeof(AudioSample);
+
+    stream.write("RIFF", 4);
+    stream.write(reinterpret_cast<const char*>(&riffSize), 4);
+    stream.write("WAVEfmt ", 8);
+    stream.write(reinterpret_cast<const char*>(&fmtSize), 4);
+    stream.write(reinterpret_cast<const char*>(&audioFormat), 2);
+    stream.write(reinterpret_cast<const char*>(&nbChannels), 2);
+    stream.write(reinterpret_cast<const char*>(&rate), 4);
+    stream.write(reinterpret_cast<const char*>(&byteRate), 4);
+    stream.write(reinterpret_cast<const char*>(&blockAlign), 2);
+    stream.write(reinterpret_cast<const char*>(&bitsPerSample), 2);
+    stream.write("data", 4);
+    stream.write(reinterpret_cast<const char*>(&dataSize), 4);
+}
+
+BatchProcessor::BatchProcessor(
+        DeviceSet *deviceSet,
+        BatchFileSource *source,
+        AudioDeviceManager *audioDeviceManager,
+        const QString& outputDirectory,
+        QObject *parent) :
+    QObject(parent),
+    m_deviceSet(deviceSet),
+    m_source(source),
+    m_audioDeviceManager(audioDeviceManager),
+    m_outputDirectory(outputDirectory),
+    m_audioRecorder(outputDirectory),
+    m_tickCount(0),
+    m_drainTicks(0)
+{
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+}
+
+BatchProcessor::~BatchProcessor()
+{
+    m_timer.stop();
+    m_audioRecorder.stopWork();
+}
+
+bool BatchProcessor::start()
+{
+    if (!QDir().mkpath(m_outputDirectory))
+    {
+        qCritical("BatchProcessor::start: cannot create output directory %s", qPrintable(m_outputDirectory));
+        return false;
+    }
+
+    m_reportsFile.setFileName(QDir(m_outputDirectory).filePath("reports.jsonl"));
+
+    if (!m_reportsFile.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        qWarning("BatchProcessor::start: cannot open %s. Reports are not saved", qPrintable(m_reportsFile.fileName()));
+    }
+
+    updateAudioFifos();
+    m_audioRecorder.startWork();
+
+    if (!m_deviceSet->m_deviceAPI->initDeviceEngine() || !m_deviceSet->m_deviceAPI->startDeviceEngine())
+    {
+        qCritical("BatchProcessor::start: cannot start device engine");
+        return false;
+    }
+
+    m_elapsedTimer.start();
+    m_timer.start(m_tickMs);
+    qInfo("BatchProcessor::start: processing %llu samples", m_source->getRecordLengthSamples());
+
+    return true;
+}
+
+// Channels may register their audio sinks only once their settings are applied
+void BatchProcessor::updateAudioFifos()
+{
+    const QMap<AudioFifo*, int>& audioSinkFifos = m_audioDeviceManager->getAudioSinkFifos();
+
+    for (QMap<AudioFifo*, int>::const_iterator it = audioSinkFifos.begin(); it != audioSinkFifos.end(); ++it) {
+        m_audioRecorder.addFifo(it.key(), m_audioDeviceManager->getOutputSampleRate(it.value()));
+    }
+}
+
+void BatchProcessor::writeReports()
+{
+    if (!m_reportsFile.isOpen()) {
+        return;
+    }
+
+    double signalTime = m_source->getSamplesCount() / (double) m_source->getSampleRate();
+    DeviceAPI *deviceAPI = m_deviceSet->m_deviceAPI;
+
+    for (int i = 0; i < deviceAPI->getNbSinkChannels(); i++)
+    {
+        ChannelAPI *channelAPI = deviceAPI->getChanelSinkAPIAt(i);
+        SWGSDRangel::SWGChannelReport report;
+        QString errorMessage;
+        report.setChannelType(new QString());
+        channelAPI->getIdentifier(*report.getChannelType());
+        report.setDirection(0);
+
+        if (channelAPI->webapiReportGet(report, errorMessage) / 100 != 2) {
+            continue; // channel has no report
+        }
+
+        QJsonObject *reportObject = report.asJsonObject();
+        QJsonObject line;
+        line.insert("signalTime", signalTime);
+        line.insert("channelIndex", i);
+        line.insert("report", *reportObject);
+        delete reportObject;
+        m_reportsFile.write(QJsonDocument(line).toJson(QJsonDocument::Compact));
+        m_reportsFile.write("\n");
+    }
+
+    m_reportsFile.flush();
+}
+
+void BatchProcessor::tick()
+{
+    m_tickCount++;
+    updateAudioFifos();
+
+    if (m_tickCount % m_reportTicks == 0) {
+        writeReports();
+    }
+
+    if (m_source->isEOF() && (m_source->getSampleFifo()->fill() == 0)) {
+        m_drainTicks++;
+    }
+
+    if (m_drainTicks > m_drainGraceTicks) {
+        finish();
+    }
+}
+
+void BatchProcessor::finish()
+{
+    m_timer.stop();
+    qint64 elapsedNs = m_elapsedTimer.nsecsElapsed();
+    quint64 nbSamples = m_source->getSamplesCount();
+
+    writeReports();
+    m_deviceSet->m_deviceAPI->stopDeviceEngine();
+    m_audioRecorder.stopWork();
+    m_reportsFile.close();
+
+    double elapsedSeconds = elapsedNs / 1e9;
+    double signalSeconds = nbSamples / (double) m_source->getSampleRate();
+    std::vector<BatchAudioRecorder::RecordStats> audioStats;
+    m_audioRecorder.getStats(audioStats);
+
+    QDebug info = qInfo();
+    info.noquote();
+    info << QString("BatchProcessor::finish: processed %L1 samples (%2 s of signal) in %3 s - %4 MS/s - %5 x real time")
+        .arg(nbSamples)
+        .arg(signalSeconds, 0, 'f', 3)
+        .arg(elapsedSeconds, 0, 'f', 3)
+        .arg(nbSamples / (elapsedSeconds * 1e6), 0, 'f', 3)
+        .arg(signalSeconds / elapsedSeconds, 0, 'f', 1);
+
+    for (std::vector<BatchAudioRecorder::RecordStats>::const_iterator it = audioStats.begin(); it != audioStats.end(); ++it)
+    {
+        info << QString("\n  %1: %2 samples at %3 S/s - %4 overruns")
+            .arg(it->m_fileName).arg(it->m_samplesWritten).arg(it->m_sampleRate).arg(it->m_overruns);
+    }
+
+    emit finished();
+}
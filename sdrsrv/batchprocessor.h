@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRSRV_BATCHPROCESSOR_H_
+#define SDRSRV_BATCHPROCESSOR_H_
+
+#include <atomic>
+#include <fstream>
+#include <vector>
+
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QFile>
+
+class AudioFifo;
+class AudioDeviceManager;
+class DeviceSet;
+class BatchFileSource;
+
+/**
+ * Drains the audio sink FIFOs of the channels into 16 bit stereo WAV files
+ * in place of the audio output devices that are not started in batch mode.
+ */
+class BatchAudioRecorder : public QThread {
+    Q_OBJECT
+
+public:
+    struct RecordStats
+    {
+        QString m_fileName;
+        int m_sampleRate;
+        quint64 m_samplesWritten;
+        uint32_t m_overruns;
+    };
+
+    BatchAudioRecorder(const QString& outputDirectory, QObject* parent = nullptr);
+    ~BatchAudioRecorder();
+
+    void addFifo(AudioFifo *audioFifo, int sampleRate); //!< creates a new WAV file for a FIFO not seen yet
+    void startWork();
+    void stopWork(); //!< drains remaining samples and finalizes WAV files
+    void getStats(std::vector<RecordStats>& stats);
+
+private:
+    struct Record
+    {
+        AudioFifo *m_audioFifo;
+        std::ofstream *m_stream;
+        RecordStats m_stats;
+    };
+
+    QString m_outputDirectory;
+    QMutex m_mutex;
+    std::vector<Record> m_records;
+    std::vector<quint8> m_buffer;
+    std::atomic<bool> m_running;
+
+    void run();
+    void drain();
+    static void writeWavHeader(std::ofstream& stream, int sampleRate, quint64 nbSamples);
+};
+
+/**
+ * Monitors a batch run: feeds the audio recorder, writes channel reports snapshots and
+ * detects the end of processing. Throughput statistics are logged when done.
+ */
+class BatchProcessor : public QObject {
+    Q_OBJECT
+
+public:
+    BatchProcessor(
+        DeviceSet *deviceSet,
+        BatchFileSource *source,
+        AudioDeviceManager *audioDeviceManager,
+        const QString& outputDirectory,
+        QObject *parent = nullptr);
+    ~BatchProcessor();
+
+    bool start();
+
+signals:
+    void finished();
+
+private:
+    DeviceSet *m_deviceSet;
+    BatchFileSource *m_source;
+    AudioDeviceManager *m_audioDeviceManager;
+    QString m_outputDirectory;
+    BatchAudioRecorder m_audioRecorder;
+    QFile m_reportsFile;
+    QTimer m_timer;
+    QElapsedTimer m_elapsedTimer;
+    int m_tickCount;
+    int m_drainTicks;   //!< ticks elapsed since the source reached end of file and its FIFO emptied
+
+    static const int m_tickMs = 100;
+    static const int m_reportTicks = 10;  //!< reports snapshot period in ticks
+    static const int m_drainGraceTicks = 5; //!< ticks to let the channels flush after the source is exhausted
+
+    void updateAudioFifos();
+    void writeReports();
+    void finish();
+
+private slots:
+    void tick();
+};
+
+#endif // SDRSRV_BATCHPROCESSOR_H_
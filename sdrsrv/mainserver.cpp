@@ -25,6 +25,8 @@
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
+#include "dsp/samplesinkfifo.h"
+#include "audio/audiofifo.h"
 #include "device/deviceapi.h"
 #include "device/deviceset.h"
 #include "device/deviceenumerator.h"
@@ -36,13 +38,24 @@
 
 #include "mainparser.h"
 #include "mainserver.h"
+#include "batchfilesource.h"
+#include "batchprocessor.h"
 
 MainServer *MainServer::m_instance = 0;
 
 MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parser, QObject *parent) :
     QObject(parent),
     m_mainCore(MainCore::instance()),
-    m_dspEngine(DSPEngine::instance())
+    m_dspEngine(DSPEngine::instance()),
+    m_requestMapper(nullptr),
+    m_apiServer(nullptr),
+    m_apiAdapter(nullptr),
+    m_batchMode(parser.isBatchMode()),
+    m_batchPresetGroup(parser.getBatchPresetGroup()),
+    m_batchPresetDescription(parser.getBatchPresetDescription()),
+    m_batchInputFileName(parser.getBatchInputFileName()),
+    m_batchOutputDirectory(parser.getBatchOutputDirectory()),
+    m_batchProcessor(nullptr)
 {
     qDebug() << "MainServer::MainServer: start";
 
@@ -53,8 +66,18 @@ MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parse
     m_mainCore->m_settings.setAMBEEngine(m_dspEngine->getAMBEEngine());
     m_mainCore->m_masterTabIndex = -1;
 
+    if (m_batchMode)
+    {
+        // no wall clock pacing: audio is recorded to files and the slowest stage paces the pipeline
+        qDebug() << "MainServer::MainServer: batch mode";
+        m_dspEngine->getAudioDeviceManager()->setOfflineOutputs(true);
+        SampleSinkFifo::setBlockingWrites(true);
+        AudioFifo::setBlockingWrites(true);
+    }
+
     qDebug() << "MainServer::MainServer: create FFT factory...";
     m_dspEngine->createFFTFactory(parser.getFFTWFWisdomFileName());
+    m_dspEngine->createBasebandExecutor(parser.getExecutorAffinity());
 
     qDebug() << "MainServer::MainServer: load plugins...";
     m_mainCore->m_pluginManager = new PluginManager(this);
@@ -70,12 +93,20 @@ MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parse
     QString applicationDirPath = QCoreApplication::instance()->applicationDirPath();
 
     m_apiAdapter = new WebAPIAdapter();
-    m_requestMapper = new WebAPIRequestMapper(this);
-    m_requestMapper->setAdapter(m_apiAdapter);
     m_apiHost = parser.getServerAddress();
     m_apiPort = parser.getServerPort();
-    m_apiServer = new WebAPIServer(parser.getServerAddress(), parser.getServerPort(), m_requestMapper);
-    m_apiServer->start();
+
+    if (m_batchMode) // no API server so that a batch can run next to a live instance
+    {
+        QMetaObject::invokeMethod(this, "setupBatch", Qt::QueuedConnection);
+    }
+    else
+    {
+        m_requestMapper = new WebAPIRequestMapper(this);
+        m_requestMapper->setAdapter(m_apiAdapter);
+        m_apiServer = new WebAPIServer(parser.getServerAddress(), parser.getServerPort(), m_requestMapper);
+        m_apiServer->start();
+    }
 
     m_dspEngine->setMIMOSupport(parser.getMIMOSupport());
 
@@ -84,12 +115,20 @@ MainServer::MainServer(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 
 MainServer::~MainServer()
 {
+    delete m_batchProcessor; // stops audio recording before channels are destroyed
+
     while (m_mainCore->m_deviceSets.size() > 0) {
         removeLastDevice();
     }
 
-	m_apiServer->stop();
-	m_mainCore->m_settings.save();
+    if (m_apiServer) {
+        m_apiServer->stop();
+    }
+
+    if (!m_batchMode) { // a batch does not change the settings
+        m_mainCore->m_settings.save();
+    }
+
     delete m_apiServer;
     delete m_requestMapper;
     delete m_apiAdapter;
@@ -237,6 +276,74 @@ void MainServer::handleMessages()
     }
 }
 
+void MainServer::setupBatch()
+{
+    qInfo("MainServer::setupBatch: input: %s preset: [%s | %s] output: %s",
+        qPrintable(m_batchInputFileName),
+        qPrintable(m_batchPresetGroup),
+        qPrintable(m_batchPresetDescription),
+        qPrintable(m_batchOutputDirectory));
+
+    // the default file input of a new device set is replaced by the unthrottled batch file source
+    addSourceDevice();
+    DeviceSet *deviceSet = m_mainCore->m_deviceSets.back();
+    DeviceAPI *deviceAPI = deviceSet->m_deviceAPI;
+    deviceAPI->getPluginInterface()->deleteSampleSourcePluginInstanceInput(deviceAPI->getSampleSource());
+    BatchFileSource *source = new BatchFileSource(deviceAPI);
+    deviceAPI->setSampleSource(source);
+
+    if (!source->openFile(m_batchInputFileName))
+    {
+        qCritical("MainServer::setupBatch: cannot use input file %s", qPrintable(m_batchInputFileName));
+        emit finished();
+        return;
+    }
+
+    const Preset *preset = nullptr;
+
+    for (int i = 0; i < m_mainCore->m_settings.getPresetCount(); i++)
+    {
+        const Preset *candidate = m_mainCore->m_settings.getPreset(i);
+
+        if (candidate->isSourcePreset()
+            && (candidate->getGroup() == m_batchPresetGroup)
+            && (candidate->getDescription() == m_batchPresetDescription))
+        {
+            preset = candidate;
+            break;
+        }
+    }
+
+    if (preset) // only channels are loaded: channel offsets apply to the recording center frequency
+    {
+        deviceSet->loadRxChannelSettings(preset, m_mainCore->m_pluginManager->getPluginAPI());
+    }
+    else if (!m_batchPresetDescription.isEmpty())
+    {
+        qCritical("MainServer::setupBatch: Rx preset [%s | %s] not found",
+            qPrintable(m_batchPresetGroup), qPrintable(m_batchPresetDescription));
+        emit finished();
+        return;
+    }
+
+    m_batchProcessor = new BatchProcessor(deviceSet, source, m_dspEngine->getAudioDeviceManager(), m_batchOutputDirectory);
+    connect(m_batchProcessor, SIGNAL(finished()), this, SLOT(batchFinished()));
+    QTimer::singleShot(m_batchSettleMs, this, SLOT(startBatch()));
+}
+
+void MainServer::startBatch()
+{
+    if (!m_batchProcessor->start()) {
+        emit finished();
+    }
+}
+
+void MainServer::batchFinished()
+{
+    qInfo("MainServer::batchFinished: outputs in %s", qPrintable(m_batchOutputDirectory));
+    emit finished();
+}
+
 void MainServer::loadSettings()
 {
 	qDebug() << "MainServer::loadSettings";
@@ -40,6 +40,7 @@ class FeatureSet;
 class WebAPIRequestMapper;
 class WebAPIServer;
 class WebAPIAdapter;
+class BatchProcessor;
 
 namespace qtwebapp {
     class LoggerWithFile;
@@ -88,6 +89,14 @@ private:
     WebAPIServer *m_apiServer;
     WebAPIAdapter *m_apiAdapter;
 
+    bool m_batchMode;
+    QString m_batchPresetGroup;
+    QString m_batchPresetDescription;
+    QString m_batchInputFileName;
+    QString m_batchOutputDirectory;
+    BatchProcessor *m_batchProcessor;
+    static const int m_batchSettleMs = 500; //!< time given to channels to apply their settings before processing starts
+
 	void loadSettings();
     void applySettings();
 	void loadPresetSettings(const Preset* preset, int tabIndex);
@@ -99,6 +108,9 @@ private:
 
 private slots:
     void handleMessages();
+    void setupBatch();
+    void startBatch();
+    void batchFinished();
 };
 
 
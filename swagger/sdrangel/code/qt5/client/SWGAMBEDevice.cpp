@@ -32,6 +32,18 @@ SWGAMBEDevice::SWGAMBEDevice() {
     m_device_ref_isSet = false;
     _delete = 0;
     m__delete_isSet = false;
+    queue_depth = 0;
+    m_queue_depth_isSet = false;
+    nb_streams = 0;
+    m_nb_streams_isSet = false;
+    frames_decoded = 0;
+    m_frames_decoded_isSet = false;
+    frames_failed = 0;
+    m_frames_failed_isSet = false;
+    mean_latency_ms = 0.0f;
+    m_mean_latency_ms_isSet = false;
+    max_latency_ms = 0.0f;
+    m_max_latency_ms_isSet = false;
 }
 
 SWGAMBEDevice::~SWGAMBEDevice() {
@@ -44,6 +56,18 @@ SWGAMBEDevice::init() {
     m_device_ref_isSet = false;
     _delete = 0;
     m__delete_isSet = false;
+    queue_depth = 0;
+    m_queue_depth_isSet = false;
+    nb_streams = 0;
+    m_nb_streams_isSet = false;
+    frames_decoded = 0;
+    m_frames_decoded_isSet = false;
+    frames_failed = 0;
+    m_frames_failed_isSet = false;
+    mean_latency_ms = 0.0f;
+    m_mean_latency_ms_isSet = false;
+    max_latency_ms = 0.0f;
+    m_max_latency_ms_isSet = false;
 }
 
 void
@@ -52,6 +76,12 @@ SWGAMBEDevice::cleanup() {
         delete device_ref;
     }
 
+
+
+
+
+
+
 }
 
 SWGAMBEDevice*
@@ -69,6 +99,18 @@ SWGAMBEDevice::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&_delete, pJson["delete"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&queue_depth, pJson["queueDepth"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_streams, pJson["nbStreams"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frames_decoded, pJson["framesDecoded"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frames_failed, pJson["framesFailed"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&mean_latency_ms, pJson["meanLatencyMs"], "float", "");
+    
+    ::SWGSDRangel::setValue(&max_latency_ms, pJson["maxLatencyMs"], "float", "");
+    
 }
 
 QString
@@ -91,6 +133,24 @@ SWGAMBEDevice::asJsonObject() {
     if(m__delete_isSet){
         obj->insert("delete", QJsonValue(_delete));
     }
+    if(m_queue_depth_isSet){
+        obj->insert("queueDepth", QJsonValue(queue_depth));
+    }
+    if(m_nb_streams_isSet){
+        obj->insert("nbStreams", QJsonValue(nb_streams));
+    }
+    if(m_frames_decoded_isSet){
+        obj->insert("framesDecoded", QJsonValue(frames_decoded));
+    }
+    if(m_frames_failed_isSet){
+        obj->insert("framesFailed", QJsonValue(frames_failed));
+    }
+    if(m_mean_latency_ms_isSet){
+        obj->insert("meanLatencyMs", QJsonValue(mean_latency_ms));
+    }
+    if(m_max_latency_ms_isSet){
+        obj->insert("maxLatencyMs", QJsonValue(max_latency_ms));
+    }
 
     return obj;
 }
@@ -115,6 +175,66 @@ SWGAMBEDevice::setDelete(qint32 _delete) {
     this->m__delete_isSet = true;
 }
 
+qint32
+SWGAMBEDevice::getQueueDepth() {
+    return queue_depth;
+}
+void
+SWGAMBEDevice::setQueueDepth(qint32 queue_depth) {
+    this->queue_depth = queue_depth;
+    this->m_queue_depth_isSet = true;
+}
+
+qint32
+SWGAMBEDevice::getNbStreams() {
+    return nb_streams;
+}
+void
+SWGAMBEDevice::setNbStreams(qint32 nb_streams) {
+    this->nb_streams = nb_streams;
+    this->m_nb_streams_isSet = true;
+}
+
+qint32
+SWGAMBEDevice::getFramesDecoded() {
+    return frames_decoded;
+}
+void
+SWGAMBEDevice::setFramesDecoded(qint32 frames_decoded) {
+    this->frames_decoded = frames_decoded;
+    this->m_frames_decoded_isSet = true;
+}
+
+qint32
+SWGAMBEDevice::getFramesFailed() {
+    return frames_failed;
+}
+void
+SWGAMBEDevice::setFramesFailed(qint32 frames_failed) {
+    this->frames_failed = frames_failed;
+    this->m_frames_failed_isSet = true;
+}
+
+float
+SWGAMBEDevice::getMeanLatencyMs() {
+    return mean_latency_ms;
+}
+void
+SWGAMBEDevice::setMeanLatencyMs(float mean_latency_ms) {
+    this->mean_latency_ms = mean_latency_ms;
+    this->m_mean_latency_ms_isSet = true;
+}
+
+float
+SWGAMBEDevice::getMaxLatencyMs() {
+    return max_latency_ms;
+}
+void
+SWGAMBEDevice::setMaxLatencyMs(float max_latency_ms) {
+    this->max_latency_ms = max_latency_ms;
+    this->m_max_latency_ms_isSet = true;
+}
+
 
 bool
 SWGAMBEDevice::isSet(){
@@ -126,6 +246,24 @@ SWGAMBEDevice::isSet(){
         if(m__delete_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_queue_depth_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_streams_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frames_decoded_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frames_failed_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_mean_latency_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_max_latency_ms_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -48,6 +48,24 @@ public:
     qint32 getDelete();
     void setDelete(qint32 _delete);
 
+    qint32 getQueueDepth();
+    void setQueueDepth(qint32 queue_depth);
+
+    qint32 getNbStreams();
+    void setNbStreams(qint32 nb_streams);
+
+    qint32 getFramesDecoded();
+    void setFramesDecoded(qint32 frames_decoded);
+
+    qint32 getFramesFailed();
+    void setFramesFailed(qint32 frames_failed);
+
+    float getMeanLatencyMs();
+    void setMeanLatencyMs(float mean_latency_ms);
+
+    float getMaxLatencyMs();
+    void setMaxLatencyMs(float max_latency_ms);
+
 
     virtual bool isSet() override;
 
@@ -58,6 +76,24 @@ private:
     qint32 _delete;
     bool m__delete_isSet;
 
+    qint32 queue_depth;
+    bool m_queue_depth_isSet;
+
+    qint32 nb_streams;
+    bool m_nb_streams_isSet;
+
+    qint32 frames_decoded;
+    bool m_frames_decoded_isSet;
+
+    qint32 frames_failed;
+    bool m_frames_failed_isSet;
+
+    float mean_latency_ms;
+    bool m_mean_latency_ms_isSet;
+
+    float max_latency_ms;
+    bool m_max_latency_ms_isSet;
+
 };
 
 }
@@ -32,6 +32,8 @@ SWGAMBEDevices::SWGAMBEDevices() {
     m_nb_devices_isSet = false;
     ambe_devices = nullptr;
     m_ambe_devices_isSet = false;
+    dropped_frames = 0;
+    m_dropped_frames_isSet = false;
 }
 
 SWGAMBEDevices::~SWGAMBEDevices() {
@@ -44,6 +46,8 @@ SWGAMBEDevices::init() {
     m_nb_devices_isSet = false;
     ambe_devices = new QList<SWGAMBEDevice*>();
     m_ambe_devices_isSet = false;
+    dropped_frames = 0;
+    m_dropped_frames_isSet = false;
 }
 
 void
@@ -56,6 +60,7 @@ SWGAMBEDevices::cleanup() {
         }
         delete ambe_devices;
     }
+
 }
 
 SWGAMBEDevices*
@@ -73,6 +78,8 @@ SWGAMBEDevices::fromJsonObject(QJsonObject &pJson) {
     
     
     ::SWGSDRangel::setValue(&ambe_devices, pJson["ambeDevices"], "QList", "SWGAMBEDevice");
+    ::SWGSDRangel::setValue(&dropped_frames, pJson["droppedFrames"], "qint32", "");
+    
 }
 
 QString
@@ -95,6 +102,9 @@ SWGAMBEDevices::asJsonObject() {
     if(ambe_devices && ambe_devices->size() > 0){
         toJsonArray((QList<void*>*)ambe_devices, obj, "ambeDevices", "SWGAMBEDevice");
     }
+    if(m_dropped_frames_isSet){
+        obj->insert("droppedFrames", QJsonValue(dropped_frames));
+    }
 
     return obj;
 }
@@ -119,6 +129,16 @@ SWGAMBEDevices::setAmbeDevices(QList<SWGAMBEDevice*>* ambe_devices) {
     this->m_ambe_devices_isSet = true;
 }
 
+qint32
+SWGAMBEDevices::getDroppedFrames() {
+    return dropped_frames;
+}
+void
+SWGAMBEDevices::setDroppedFrames(qint32 dropped_frames) {
+    this->dropped_frames = dropped_frames;
+    this->m_dropped_frames_isSet = true;
+}
+
 
 bool
 SWGAMBEDevices::isSet(){
@@ -130,6 +150,9 @@ SWGAMBEDevices::isSet(){
         if(ambe_devices && (ambe_devices->size() > 0)){
             isObjectUpdated = true; break;
         }
+        if(m_dropped_frames_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
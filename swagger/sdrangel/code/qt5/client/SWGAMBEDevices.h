@@ -49,6 +49,9 @@ public:
     QList<SWGAMBEDevice*>* getAmbeDevices();
     void setAmbeDevices(QList<SWGAMBEDevice*>* ambe_devices);
 
+    qint32 getDroppedFrames();
+    void setDroppedFrames(qint32 dropped_frames);
+
 
     virtual bool isSet() override;
 
@@ -59,6 +62,9 @@ private:
     QList<SWGAMBEDevice*>* ambe_devices;
     bool m_ambe_devices_isSet;
 
+    qint32 dropped_frames;
+    bool m_dropped_frames_isSet;
+
 };
 
 }
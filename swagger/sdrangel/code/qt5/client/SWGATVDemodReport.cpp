@@ -0,0 +1,338 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGATVDemodReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGATVDemodReport::SWGATVDemodReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGATVDemodReport::SWGATVDemodReport() {
+    channel_power_db = 0.0f;
+    m_channel_power_db_isSet = false;
+    channel_sample_rate = 0;
+    m_channel_sample_rate_isSet = false;
+    bfo_locked = 0;
+    m_bfo_locked_isSet = false;
+    line_count = 0L;
+    m_line_count_isSet = false;
+    frame_count = 0L;
+    m_frame_count_isSet = false;
+    v_sync_count = 0L;
+    m_v_sync_count_isSet = false;
+    h_sync_lock_count = 0L;
+    m_h_sync_lock_count_isSet = false;
+    h_sync_resync_count = 0L;
+    m_h_sync_resync_count_isSet = false;
+    frame_output_count = 0L;
+    m_frame_output_count_isSet = false;
+    frame_output_width = 0;
+    m_frame_output_width_isSet = false;
+    frame_output_height = 0;
+    m_frame_output_height_isSet = false;
+}
+
+SWGATVDemodReport::~SWGATVDemodReport() {
+    this->cleanup();
+}
+
+void
+SWGATVDemodReport::init() {
+    channel_power_db = 0.0f;
+    m_channel_power_db_isSet = false;
+    channel_sample_rate = 0;
+    m_channel_sample_rate_isSet = false;
+    bfo_locked = 0;
+    m_bfo_locked_isSet = false;
+    line_count = 0L;
+    m_line_count_isSet = false;
+    frame_count = 0L;
+    m_frame_count_isSet = false;
+    v_sync_count = 0L;
+    m_v_sync_count_isSet = false;
+    h_sync_lock_count = 0L;
+    m_h_sync_lock_count_isSet = false;
+    h_sync_resync_count = 0L;
+    m_h_sync_resync_count_isSet = false;
+    frame_output_count = 0L;
+    m_frame_output_count_isSet = false;
+    frame_output_width = 0;
+    m_frame_output_width_isSet = false;
+    frame_output_height = 0;
+    m_frame_output_height_isSet = false;
+}
+
+void
+SWGATVDemodReport::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+}
+
+SWGATVDemodReport*
+SWGATVDemodReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGATVDemodReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&channel_power_db, pJson["channelPowerDB"], "float", "");
+    
+    ::SWGSDRangel::setValue(&channel_sample_rate, pJson["channelSampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&bfo_locked, pJson["bfoLocked"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&line_count, pJson["lineCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&frame_count, pJson["frameCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&v_sync_count, pJson["vSyncCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&h_sync_lock_count, pJson["hSyncLockCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&h_sync_resync_count, pJson["hSyncResyncCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&frame_output_count, pJson["frameOutputCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&frame_output_width, pJson["frameOutputWidth"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frame_output_height, pJson["frameOutputHeight"], "qint32", "");
+    
+}
+
+QString
+SWGATVDemodReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGATVDemodReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_channel_power_db_isSet){
+        obj->insert("channelPowerDB", QJsonValue(channel_power_db));
+    }
+    if(m_channel_sample_rate_isSet){
+        obj->insert("channelSampleRate", QJsonValue(channel_sample_rate));
+    }
+    if(m_bfo_locked_isSet){
+        obj->insert("bfoLocked", QJsonValue(bfo_locked));
+    }
+    if(m_line_count_isSet){
+        obj->insert("lineCount", QJsonValue(line_count));
+    }
+    if(m_frame_count_isSet){
+        obj->insert("frameCount", QJsonValue(frame_count));
+    }
+    if(m_v_sync_count_isSet){
+        obj->insert("vSyncCount", QJsonValue(v_sync_count));
+    }
+    if(m_h_sync_lock_count_isSet){
+        obj->insert("hSyncLockCount", QJsonValue(h_sync_lock_count));
+    }
+    if(m_h_sync_resync_count_isSet){
+        obj->insert("hSyncResyncCount", QJsonValue(h_sync_resync_count));
+    }
+    if(m_frame_output_count_isSet){
+        obj->insert("frameOutputCount", QJsonValue(frame_output_count));
+    }
+    if(m_frame_output_width_isSet){
+        obj->insert("frameOutputWidth", QJsonValue(frame_output_width));
+    }
+    if(m_frame_output_height_isSet){
+        obj->insert("frameOutputHeight", QJsonValue(frame_output_height));
+    }
+
+    return obj;
+}
+
+float
+SWGATVDemodReport::getChannelPowerDb() {
+    return channel_power_db;
+}
+void
+SWGATVDemodReport::setChannelPowerDb(float channel_power_db) {
+    this->channel_power_db = channel_power_db;
+    this->m_channel_power_db_isSet = true;
+}
+
+qint32
+SWGATVDemodReport::getChannelSampleRate() {
+    return channel_sample_rate;
+}
+void
+SWGATVDemodReport::setChannelSampleRate(qint32 channel_sample_rate) {
+    this->channel_sample_rate = channel_sample_rate;
+    this->m_channel_sample_rate_isSet = true;
+}
+
+qint32
+SWGATVDemodReport::getBfoLocked() {
+    return bfo_locked;
+}
+void
+SWGATVDemodReport::setBfoLocked(qint32 bfo_locked) {
+    this->bfo_locked = bfo_locked;
+    this->m_bfo_locked_isSet = true;
+}
+
+qint64
+SWGATVDemodReport::getLineCount() {
+    return line_count;
+}
+void
+SWGATVDemodReport::setLineCount(qint64 line_count) {
+    this->line_count = line_count;
+    this->m_line_count_isSet = true;
+}
+
+qint64
+SWGATVDemodReport::getFrameCount() {
+    return frame_count;
+}
+void
+SWGATVDemodReport::setFrameCount(qint64 frame_count) {
+    this->frame_count = frame_count;
+    this->m_frame_count_isSet = true;
+}
+
+qint64
+SWGATVDemodReport::getVSyncCount() {
+    return v_sync_count;
+}
+void
+SWGATVDemodReport::setVSyncCount(qint64 v_sync_count) {
+    this->v_sync_count = v_sync_count;
+    this->m_v_sync_count_isSet = true;
+}
+
+qint64
+SWGATVDemodReport::getHSyncLockCount() {
+    return h_sync_lock_count;
+}
+void
+SWGATVDemodReport::setHSyncLockCount(qint64 h_sync_lock_count) {
+    this->h_sync_lock_count = h_sync_lock_count;
+    this->m_h_sync_lock_count_isSet = true;
+}
+
+qint64
+SWGATVDemodReport::getHSyncResyncCount() {
+    return h_sync_resync_count;
+}
+void
+SWGATVDemodReport::setHSyncResyncCount(qint64 h_sync_resync_count) {
+    this->h_sync_resync_count = h_sync_resync_count;
+    this->m_h_sync_resync_count_isSet = true;
+}
+
+qint64
+SWGATVDemodReport::getFrameOutputCount() {
+    return frame_output_count;
+}
+void
+SWGATVDemodReport::setFrameOutputCount(qint64 frame_output_count) {
+    this->frame_output_count = frame_output_count;
+    this->m_frame_output_count_isSet = true;
+}
+
+qint32
+SWGATVDemodReport::getFrameOutputWidth() {
+    return frame_output_width;
+}
+void
+SWGATVDemodReport::setFrameOutputWidth(qint32 frame_output_width) {
+    this->frame_output_width = frame_output_width;
+    this->m_frame_output_width_isSet = true;
+}
+
+qint32
+SWGATVDemodReport::getFrameOutputHeight() {
+    return frame_output_height;
+}
+void
+SWGATVDemodReport::setFrameOutputHeight(qint32 frame_output_height) {
+    this->frame_output_height = frame_output_height;
+    this->m_frame_output_height_isSet = true;
+}
+
+
+bool
+SWGATVDemodReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_channel_power_db_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_channel_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_bfo_locked_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_line_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frame_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_v_sync_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_h_sync_lock_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_h_sync_resync_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frame_output_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frame_output_width_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frame_output_height_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
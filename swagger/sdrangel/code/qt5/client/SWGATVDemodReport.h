@@ -0,0 +1,117 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGATVDemodReport.h
+ *
+ * ATVDemod
+ */
+
+#ifndef SWGATVDemodReport_H_
+#define SWGATVDemodReport_H_
+
+#include <QJsonObject>
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGATVDemodReport: public SWGObject {
+public:
+    SWGATVDemodReport();
+    SWGATVDemodReport(QString* json);
+    virtual ~SWGATVDemodReport();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGATVDemodReport* fromJson(QString &jsonString) override;
+
+    float getChannelPowerDb();
+    void setChannelPowerDb(float channel_power_db);
+
+    qint32 getChannelSampleRate();
+    void setChannelSampleRate(qint32 channel_sample_rate);
+
+    qint32 getBfoLocked();
+    void setBfoLocked(qint32 bfo_locked);
+
+    qint64 getLineCount();
+    void setLineCount(qint64 line_count);
+
+    qint64 getFrameCount();
+    void setFrameCount(qint64 frame_count);
+
+    qint64 getVSyncCount();
+    void setVSyncCount(qint64 v_sync_count);
+
+    qint64 getHSyncLockCount();
+    void setHSyncLockCount(qint64 h_sync_lock_count);
+
+    qint64 getHSyncResyncCount();
+    void setHSyncResyncCount(qint64 h_sync_resync_count);
+
+    qint64 getFrameOutputCount();
+    void setFrameOutputCount(qint64 frame_output_count);
+
+    qint32 getFrameOutputWidth();
+    void setFrameOutputWidth(qint32 frame_output_width);
+
+    qint32 getFrameOutputHeight();
+    void setFrameOutputHeight(qint32 frame_output_height);
+
+
+    virtual bool isSet() override;
+
+private:
+    float channel_power_db;
+    bool m_channel_power_db_isSet;
+
+    qint32 channel_sample_rate;
+    bool m_channel_sample_rate_isSet;
+
+    qint32 bfo_locked;
+    bool m_bfo_locked_isSet;
+
+    qint64 line_count;
+    bool m_line_count_isSet;
+
+    qint64 frame_count;
+    bool m_frame_count_isSet;
+
+    qint64 v_sync_count;
+    bool m_v_sync_count_isSet;
+
+    qint64 h_sync_lock_count;
+    bool m_h_sync_lock_count_isSet;
+
+    qint64 h_sync_resync_count;
+    bool m_h_sync_resync_count_isSet;
+
+    qint64 frame_output_count;
+    bool m_frame_output_count_isSet;
+
+    qint32 frame_output_width;
+    bool m_frame_output_width_isSet;
+
+    qint32 frame_output_height;
+    bool m_frame_output_height_isSet;
+
+};
+
+}
+
+#endif /* SWGATVDemodReport_H_ */
@@ -94,6 +94,10 @@ SWGATVDemodSettings::SWGATVDemodSettings() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    frame_output = 0;
+    m_frame_output_isSet = false;
+    frame_output_name = nullptr;
+    m_frame_output_name_isSet = false;
 }
 
 SWGATVDemodSettings::~SWGATVDemodSettings() {
@@ -168,6 +172,10 @@ SWGATVDemodSettings::init() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    frame_output = 0;
+    m_frame_output_isSet = false;
+    frame_output_name = new QString("");
+    m_frame_output_name_isSet = false;
 }
 
 void
@@ -209,6 +217,10 @@ SWGATVDemodSettings::cleanup() {
         delete udp_address;
     }
 
+
+    if(frame_output_name != nullptr) { 
+        delete frame_output_name;
+    }
 }
 
 SWGATVDemodSettings*
@@ -288,6 +300,10 @@ SWGATVDemodSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&udp_port, pJson["udpPort"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&frame_output, pJson["frameOutput"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frame_output_name, pJson["frameOutputName"], "QString", "QString");
+    
 }
 
 QString
@@ -403,6 +419,12 @@ SWGATVDemodSettings::asJsonObject() {
     if(m_udp_port_isSet){
         obj->insert("udpPort", QJsonValue(udp_port));
     }
+    if(m_frame_output_isSet){
+        obj->insert("frameOutput", QJsonValue(frame_output));
+    }
+    if(frame_output_name != nullptr && *frame_output_name != QString("")){
+        toJsonValue(QString("frameOutputName"), frame_output_name, obj, QString("QString"));
+    }
 
     return obj;
 }
@@ -737,6 +759,26 @@ SWGATVDemodSettings::setUdpPort(qint32 udp_port) {
     this->m_udp_port_isSet = true;
 }
 
+qint32
+SWGATVDemodSettings::getFrameOutput() {
+    return frame_output;
+}
+void
+SWGATVDemodSettings::setFrameOutput(qint32 frame_output) {
+    this->frame_output = frame_output;
+    this->m_frame_output_isSet = true;
+}
+
+QString*
+SWGATVDemodSettings::getFrameOutputName() {
+    return frame_output_name;
+}
+void
+SWGATVDemodSettings::setFrameOutputName(QString* frame_output_name) {
+    this->frame_output_name = frame_output_name;
+    this->m_frame_output_name_isSet = true;
+}
+
 
 bool
 SWGATVDemodSettings::isSet(){
@@ -841,6 +883,12 @@ SWGATVDemodSettings::isSet(){
         if(m_udp_port_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_frame_output_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(frame_output_name && *frame_output_name != QString("")){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -141,6 +141,12 @@ public:
     qint32 getUdpPort();
     void setUdpPort(qint32 udp_port);
 
+    qint32 getFrameOutput();
+    void setFrameOutput(qint32 frame_output);
+
+    QString* getFrameOutputName();
+    void setFrameOutputName(QString* frame_output_name);
+
 
     virtual bool isSet() override;
 
@@ -244,6 +250,12 @@ private:
     qint32 udp_port;
     bool m_udp_port_isSet;
 
+    qint32 frame_output;
+    bool m_frame_output_isSet;
+
+    QString* frame_output_name;
+    bool m_frame_output_name_isSet;
+
 };
 
 }
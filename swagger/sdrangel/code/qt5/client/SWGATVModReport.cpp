@@ -32,6 +32,10 @@ SWGATVModReport::SWGATVModReport() {
     m_channel_power_db_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    dropped_frames = 0;
+    m_dropped_frames_isSet = false;
+    repeated_frames = 0;
+    m_repeated_frames_isSet = false;
 }
 
 SWGATVModReport::~SWGATVModReport() {
@@ -44,12 +48,18 @@ SWGATVModReport::init() {
     m_channel_power_db_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    dropped_frames = 0;
+    m_dropped_frames_isSet = false;
+    repeated_frames = 0;
+    m_repeated_frames_isSet = false;
 }
 
 void
 SWGATVModReport::cleanup() {
 
 
+
+
 }
 
 SWGATVModReport*
@@ -67,6 +77,10 @@ SWGATVModReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&channel_sample_rate, pJson["channelSampleRate"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&dropped_frames, pJson["droppedFrames"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&repeated_frames, pJson["repeatedFrames"], "qint32", "");
+    
 }
 
 QString
@@ -89,6 +103,12 @@ SWGATVModReport::asJsonObject() {
     if(m_channel_sample_rate_isSet){
         obj->insert("channelSampleRate", QJsonValue(channel_sample_rate));
     }
+    if(m_dropped_frames_isSet){
+        obj->insert("droppedFrames", QJsonValue(dropped_frames));
+    }
+    if(m_repeated_frames_isSet){
+        obj->insert("repeatedFrames", QJsonValue(repeated_frames));
+    }
 
     return obj;
 }
@@ -113,6 +133,26 @@ SWGATVModReport::setChannelSampleRate(qint32 channel_sample_rate) {
     this->m_channel_sample_rate_isSet = true;
 }
 
+qint32
+SWGATVModReport::getDroppedFrames() {
+    return dropped_frames;
+}
+void
+SWGATVModReport::setDroppedFrames(qint32 dropped_frames) {
+    this->dropped_frames = dropped_frames;
+    this->m_dropped_frames_isSet = true;
+}
+
+qint32
+SWGATVModReport::getRepeatedFrames() {
+    return repeated_frames;
+}
+void
+SWGATVModReport::setRepeatedFrames(qint32 repeated_frames) {
+    this->repeated_frames = repeated_frames;
+    this->m_repeated_frames_isSet = true;
+}
+
 
 bool
 SWGATVModReport::isSet(){
@@ -124,6 +164,12 @@ SWGATVModReport::isSet(){
         if(m_channel_sample_rate_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_dropped_frames_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_repeated_frames_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
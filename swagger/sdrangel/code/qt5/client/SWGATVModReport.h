@@ -47,6 +47,12 @@ public:
     qint32 getChannelSampleRate();
     void setChannelSampleRate(qint32 channel_sample_rate);
 
+    qint32 getDroppedFrames();
+    void setDroppedFrames(qint32 dropped_frames);
+
+    qint32 getRepeatedFrames();
+    void setRepeatedFrames(qint32 repeated_frames);
+
 
     virtual bool isSet() override;
 
@@ -57,6 +63,12 @@ private:
     qint32 channel_sample_rate;
     bool m_channel_sample_rate_isSet;
 
+    qint32 dropped_frames;
+    bool m_dropped_frames_isSet;
+
+    qint32 repeated_frames;
+    bool m_repeated_frames_isSet;
+
 };
 
 }
@@ -52,6 +52,8 @@ SWGAudioOutputDevice::SWGAudioOutputDevice() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    streams = nullptr;
+    m_streams_isSet = false;
 }
 
 SWGAudioOutputDevice::~SWGAudioOutputDevice() {
@@ -84,6 +86,8 @@ SWGAudioOutputDevice::init() {
     m_udp_address_isSet = false;
     udp_port = 0;
     m_udp_port_isSet = false;
+    streams = new QList<SWGAudioOutputStream*>();
+    m_streams_isSet = false;
 }
 
 void
@@ -104,6 +108,13 @@ SWGAudioOutputDevice::cleanup() {
         delete udp_address;
     }
 
+    if(streams != nullptr) { 
+        auto arr = streams;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete streams;
+    }
 }
 
 SWGAudioOutputDevice*
@@ -141,6 +152,8 @@ SWGAudioOutputDevice::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&udp_port, pJson["udpPort"], "qint32", "");
     
+    
+    ::SWGSDRangel::setValue(&streams, pJson["streams"], "QList", "SWGAudioOutputStream");
 }
 
 QString
@@ -193,6 +206,9 @@ SWGAudioOutputDevice::asJsonObject() {
     if(m_udp_port_isSet){
         obj->insert("udpPort", QJsonValue(udp_port));
     }
+    if(streams && streams->size() > 0){
+        toJsonArray((QList<void*>*)streams, obj, "streams", "SWGAudioOutputStream");
+    }
 
     return obj;
 }
@@ -317,6 +333,16 @@ SWGAudioOutputDevice::setUdpPort(qint32 udp_port) {
     this->m_udp_port_isSet = true;
 }
 
+QList<SWGAudioOutputStream*>*
+SWGAudioOutputDevice::getStreams() {
+    return streams;
+}
+void
+SWGAudioOutputDevice::setStreams(QList<SWGAudioOutputStream*>* streams) {
+    this->streams = streams;
+    this->m_streams_isSet = true;
+}
+
 
 bool
 SWGAudioOutputDevice::isSet(){
@@ -358,6 +384,9 @@ SWGAudioOutputDevice::isSet(){
         if(m_udp_port_isSet){
             isObjectUpdated = true; break;
         }
+        if(streams && (streams->size() > 0)){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
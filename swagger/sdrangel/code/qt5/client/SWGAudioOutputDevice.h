@@ -24,6 +24,10 @@
 
 #include <QString>
 
+#include "SWGAudioOutputStream.h"
+
+#include <QList>
+
 #include "SWGObject.h"
 #include "export.h"
 
@@ -78,6 +82,9 @@ public:
     qint32 getUdpPort();
     void setUdpPort(qint32 udp_port);
 
+    QList<SWGAudioOutputStream*>* getStreams();
+    void setStreams(QList<SWGAudioOutputStream*>* streams);
+
 
     virtual bool isSet() override;
 
@@ -118,6 +125,9 @@ private:
     qint32 udp_port;
     bool m_udp_port_isSet;
 
+    QList<SWGAudioOutputStream*>* streams;
+    bool m_streams_isSet;
+
 };
 
 }
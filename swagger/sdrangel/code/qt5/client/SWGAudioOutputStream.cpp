@@ -0,0 +1,223 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGAudioOutputStream.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGAudioOutputStream::SWGAudioOutputStream(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGAudioOutputStream::SWGAudioOutputStream() {
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    gain = 0.0f;
+    m_gain_isSet = false;
+    pan = 0.0f;
+    m_pan_isSet = false;
+    fill = 0;
+    m_fill_isSet = false;
+    underrun_count = 0;
+    m_underrun_count_isSet = false;
+    overrun_count = 0;
+    m_overrun_count_isSet = false;
+}
+
+SWGAudioOutputStream::~SWGAudioOutputStream() {
+    this->cleanup();
+}
+
+void
+SWGAudioOutputStream::init() {
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    gain = 0.0f;
+    m_gain_isSet = false;
+    pan = 0.0f;
+    m_pan_isSet = false;
+    fill = 0;
+    m_fill_isSet = false;
+    underrun_count = 0;
+    m_underrun_count_isSet = false;
+    overrun_count = 0;
+    m_overrun_count_isSet = false;
+}
+
+void
+SWGAudioOutputStream::cleanup() {
+
+
+
+
+
+
+}
+
+SWGAudioOutputStream*
+SWGAudioOutputStream::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGAudioOutputStream::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&gain, pJson["gain"], "float", "");
+    
+    ::SWGSDRangel::setValue(&pan, pJson["pan"], "float", "");
+    
+    ::SWGSDRangel::setValue(&fill, pJson["fill"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&underrun_count, pJson["underrunCount"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&overrun_count, pJson["overrunCount"], "qint32", "");
+    
+}
+
+QString
+SWGAudioOutputStream::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGAudioOutputStream::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_gain_isSet){
+        obj->insert("gain", QJsonValue(gain));
+    }
+    if(m_pan_isSet){
+        obj->insert("pan", QJsonValue(pan));
+    }
+    if(m_fill_isSet){
+        obj->insert("fill", QJsonValue(fill));
+    }
+    if(m_underrun_count_isSet){
+        obj->insert("underrunCount", QJsonValue(underrun_count));
+    }
+    if(m_overrun_count_isSet){
+        obj->insert("overrunCount", QJsonValue(overrun_count));
+    }
+
+    return obj;
+}
+
+qint32
+SWGAudioOutputStream::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGAudioOutputStream::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+float
+SWGAudioOutputStream::getGain() {
+    return gain;
+}
+void
+SWGAudioOutputStream::setGain(float gain) {
+    this->gain = gain;
+    this->m_gain_isSet = true;
+}
+
+float
+SWGAudioOutputStream::getPan() {
+    return pan;
+}
+void
+SWGAudioOutputStream::setPan(float pan) {
+    this->pan = pan;
+    this->m_pan_isSet = true;
+}
+
+qint32
+SWGAudioOutputStream::getFill() {
+    return fill;
+}
+void
+SWGAudioOutputStream::setFill(qint32 fill) {
+    this->fill = fill;
+    this->m_fill_isSet = true;
+}
+
+qint32
+SWGAudioOutputStream::getUnderrunCount() {
+    return underrun_count;
+}
+void
+SWGAudioOutputStream::setUnderrunCount(qint32 underrun_count) {
+    this->underrun_count = underrun_count;
+    this->m_underrun_count_isSet = true;
+}
+
+qint32
+SWGAudioOutputStream::getOverrunCount() {
+    return overrun_count;
+}
+void
+SWGAudioOutputStream::setOverrunCount(qint32 overrun_count) {
+    this->overrun_count = overrun_count;
+    this->m_overrun_count_isSet = true;
+}
+
+
+bool
+SWGAudioOutputStream::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_gain_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_pan_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fill_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_underrun_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_overrun_count_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,87 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGAudioOutputStream.h
+ *
+ * Audio stream (audio FIFO) mixed into an audio output device
+ */
+
+#ifndef SWGAudioOutputStream_H_
+#define SWGAudioOutputStream_H_
+
+#include <QJsonObject>
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGAudioOutputStream: public SWGObject {
+public:
+    SWGAudioOutputStream();
+    SWGAudioOutputStream(QString* json);
+    virtual ~SWGAudioOutputStream();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGAudioOutputStream* fromJson(QString &jsonString) override;
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+    float getGain();
+    void setGain(float gain);
+
+    float getPan();
+    void setPan(float pan);
+
+    qint32 getFill();
+    void setFill(qint32 fill);
+
+    qint32 getUnderrunCount();
+    void setUnderrunCount(qint32 underrun_count);
+
+    qint32 getOverrunCount();
+    void setOverrunCount(qint32 overrun_count);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+    float gain;
+    bool m_gain_isSet;
+
+    float pan;
+    bool m_pan_isSet;
+
+    qint32 fill;
+    bool m_fill_isSet;
+
+    qint32 underrun_count;
+    bool m_underrun_count_isSet;
+
+    qint32 overrun_count;
+    bool m_overrun_count_isSet;
+
+};
+
+}
+
+#endif /* SWGAudioOutputStream_H_ */
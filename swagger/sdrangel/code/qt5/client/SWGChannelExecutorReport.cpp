@@ -0,0 +1,200 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGChannelExecutorReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGChannelExecutorReport::SWGChannelExecutorReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGChannelExecutorReport::SWGChannelExecutorReport() {
+    run_count = 0L;
+    m_run_count_isSet = false;
+    stolen_count = 0L;
+    m_stolen_count_isSet = false;
+    run_time_ms = 0.0f;
+    m_run_time_ms_isSet = false;
+    load = 0.0f;
+    m_load_isSet = false;
+    affinity_group = 0;
+    m_affinity_group_isSet = false;
+}
+
+SWGChannelExecutorReport::~SWGChannelExecutorReport() {
+    this->cleanup();
+}
+
+void
+SWGChannelExecutorReport::init() {
+    run_count = 0L;
+    m_run_count_isSet = false;
+    stolen_count = 0L;
+    m_stolen_count_isSet = false;
+    run_time_ms = 0.0f;
+    m_run_time_ms_isSet = false;
+    load = 0.0f;
+    m_load_isSet = false;
+    affinity_group = 0;
+    m_affinity_group_isSet = false;
+}
+
+void
+SWGChannelExecutorReport::cleanup() {
+
+
+
+
+
+}
+
+SWGChannelExecutorReport*
+SWGChannelExecutorReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGChannelExecutorReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&run_count, pJson["runCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&stolen_count, pJson["stolenCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&run_time_ms, pJson["runTimeMs"], "float", "");
+    
+    ::SWGSDRangel::setValue(&load, pJson["load"], "float", "");
+    
+    ::SWGSDRangel::setValue(&affinity_group, pJson["affinityGroup"], "qint32", "");
+    
+}
+
+QString
+SWGChannelExecutorReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGChannelExecutorReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_run_count_isSet){
+        obj->insert("runCount", QJsonValue(run_count));
+    }
+    if(m_stolen_count_isSet){
+        obj->insert("stolenCount", QJsonValue(stolen_count));
+    }
+    if(m_run_time_ms_isSet){
+        obj->insert("runTimeMs", QJsonValue(run_time_ms));
+    }
+    if(m_load_isSet){
+        obj->insert("load", QJsonValue(load));
+    }
+    if(m_affinity_group_isSet){
+        obj->insert("affinityGroup", QJsonValue(affinity_group));
+    }
+
+    return obj;
+}
+
+qint64
+SWGChannelExecutorReport::getRunCount() {
+    return run_count;
+}
+void
+SWGChannelExecutorReport::setRunCount(qint64 run_count) {
+    this->run_count = run_count;
+    this->m_run_count_isSet = true;
+}
+
+qint64
+SWGChannelExecutorReport::getStolenCount() {
+    return stolen_count;
+}
+void
+SWGChannelExecutorReport::setStolenCount(qint64 stolen_count) {
+    this->stolen_count = stolen_count;
+    this->m_stolen_count_isSet = true;
+}
+
+float
+SWGChannelExecutorReport::getRunTimeMs() {
+    return run_time_ms;
+}
+void
+SWGChannelExecutorReport::setRunTimeMs(float run_time_ms) {
+    this->run_time_ms = run_time_ms;
+    this->m_run_time_ms_isSet = true;
+}
+
+float
+SWGChannelExecutorReport::getLoad() {
+    return load;
+}
+void
+SWGChannelExecutorReport::setLoad(float load) {
+    this->load = load;
+    this->m_load_isSet = true;
+}
+
+qint32
+SWGChannelExecutorReport::getAffinityGroup() {
+    return affinity_group;
+}
+void
+SWGChannelExecutorReport::setAffinityGroup(qint32 affinity_group) {
+    this->affinity_group = affinity_group;
+    this->m_affinity_group_isSet = true;
+}
+
+
+bool
+SWGChannelExecutorReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_run_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_stolen_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_run_time_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_load_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_affinity_group_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
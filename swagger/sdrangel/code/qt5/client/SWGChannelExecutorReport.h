@@ -0,0 +1,81 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGChannelExecutorReport.h
+ *
+ * Baseband executor run-time accounting of a channel
+ */
+
+#ifndef SWGChannelExecutorReport_H_
+#define SWGChannelExecutorReport_H_
+
+#include <QJsonObject>
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGChannelExecutorReport: public SWGObject {
+public:
+    SWGChannelExecutorReport();
+    SWGChannelExecutorReport(QString* json);
+    virtual ~SWGChannelExecutorReport();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGChannelExecutorReport* fromJson(QString &jsonString) override;
+
+    qint64 getRunCount();
+    void setRunCount(qint64 run_count);
+
+    qint64 getStolenCount();
+    void setStolenCount(qint64 stolen_count);
+
+    float getRunTimeMs();
+    void setRunTimeMs(float run_time_ms);
+
+    float getLoad();
+    void setLoad(float load);
+
+    qint32 getAffinityGroup();
+    void setAffinityGroup(qint32 affinity_group);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 run_count;
+    bool m_run_count_isSet;
+
+    qint64 stolen_count;
+    bool m_stolen_count_isSet;
+
+    float run_time_ms;
+    bool m_run_time_ms_isSet;
+
+    float load;
+    bool m_load_isSet;
+
+    qint32 affinity_group;
+    bool m_affinity_group_isSet;
+
+};
+
+}
+
+#endif /* SWGChannelExecutorReport_H_ */
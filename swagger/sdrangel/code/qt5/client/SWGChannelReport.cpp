@@ -74,6 +74,14 @@ SWGChannelReport::SWGChannelReport() {
     m_wfm_demod_report_isSet = false;
     wfm_mod_report = nullptr;
     m_wfm_mod_report_isSet = false;
+    atv_demod_report = nullptr;
+    m_atv_demod_report_isSet = false;
+    shm_sink_report = nullptr;
+    m_shm_sink_report_isSet = false;
+    executor_report = nullptr;
+    m_executor_report_isSet = false;
+    remote_sink_report = nullptr;
+    m_remote_sink_report_isSet = false;
 }
 
 SWGChannelReport::~SWGChannelReport() {
@@ -128,6 +136,14 @@ SWGChannelReport::init() {
     m_wfm_demod_report_isSet = false;
     wfm_mod_report = new SWGWFMModReport();
     m_wfm_mod_report_isSet = false;
+    atv_demod_report = new SWGATVDemodReport();
+    m_atv_demod_report_isSet = false;
+    shm_sink_report = new SWGShmSinkReport();
+    m_shm_sink_report_isSet = false;
+    executor_report = new SWGChannelExecutorReport();
+    m_executor_report_isSet = false;
+    remote_sink_report = new SWGRemoteSinkReport();
+    m_remote_sink_report_isSet = false;
 }
 
 void
@@ -199,6 +215,18 @@ SWGChannelReport::cleanup() {
     if(wfm_mod_report != nullptr) { 
         delete wfm_mod_report;
     }
+    if(atv_demod_report != nullptr) { 
+        delete atv_demod_report;
+    }
+    if(shm_sink_report != nullptr) { 
+        delete shm_sink_report;
+    }
+    if(executor_report != nullptr) { 
+        delete executor_report;
+    }
+    if(remote_sink_report != nullptr) { 
+        delete remote_sink_report;
+    }
 }
 
 SWGChannelReport*
@@ -258,6 +286,14 @@ SWGChannelReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&wfm_mod_report, pJson["WFMModReport"], "SWGWFMModReport", "SWGWFMModReport");
     
+    ::SWGSDRangel::setValue(&atv_demod_report, pJson["ATVDemodReport"], "SWGATVDemodReport", "SWGATVDemodReport");
+    
+    ::SWGSDRangel::setValue(&shm_sink_report, pJson["ShmSinkReport"], "SWGShmSinkReport", "SWGShmSinkReport");
+    
+    ::SWGSDRangel::setValue(&executor_report, pJson["executorReport"], "SWGChannelExecutorReport", "SWGChannelExecutorReport");
+    
+    ::SWGSDRangel::setValue(&remote_sink_report, pJson["RemoteSinkReport"], "SWGRemoteSinkReport", "SWGRemoteSinkReport");
+    
 }
 
 QString
@@ -343,6 +379,18 @@ SWGChannelReport::asJsonObject() {
     if((wfm_mod_report != nullptr) && (wfm_mod_report->isSet())){
         toJsonValue(QString("WFMModReport"), wfm_mod_report, obj, QString("SWGWFMModReport"));
     }
+    if((atv_demod_report != nullptr) && (atv_demod_report->isSet())){
+        toJsonValue(QString("ATVDemodReport"), atv_demod_report, obj, QString("SWGATVDemodReport"));
+    }
+    if((shm_sink_report != nullptr) && (shm_sink_report->isSet())){
+        toJsonValue(QString("ShmSinkReport"), shm_sink_report, obj, QString("SWGShmSinkReport"));
+    }
+    if((executor_report != nullptr) && (executor_report->isSet())){
+        toJsonValue(QString("executorReport"), executor_report, obj, QString("SWGChannelExecutorReport"));
+    }
+    if((remote_sink_report != nullptr) && (remote_sink_report->isSet())){
+        toJsonValue(QString("RemoteSinkReport"), remote_sink_report, obj, QString("SWGRemoteSinkReport"));
+    }
 
     return obj;
 }
@@ -577,6 +625,46 @@ SWGChannelReport::setWfmModReport(SWGWFMModReport* wfm_mod_report) {
     this->m_wfm_mod_report_isSet = true;
 }
 
+SWGATVDemodReport*
+SWGChannelReport::getAtvDemodReport() {
+    return atv_demod_report;
+}
+void
+SWGChannelReport::setAtvDemodReport(SWGATVDemodReport* atv_demod_report) {
+    this->atv_demod_report = atv_demod_report;
+    this->m_atv_demod_report_isSet = true;
+}
+
+SWGShmSinkReport*
+SWGChannelReport::getShmSinkReport() {
+    return shm_sink_report;
+}
+void
+SWGChannelReport::setShmSinkReport(SWGShmSinkReport* shm_sink_report) {
+    this->shm_sink_report = shm_sink_report;
+    this->m_shm_sink_report_isSet = true;
+}
+
+SWGChannelExecutorReport*
+SWGChannelReport::getExecutorReport() {
+    return executor_report;
+}
+void
+SWGChannelReport::setExecutorReport(SWGChannelExecutorReport* executor_report) {
+    this->executor_report = executor_report;
+    this->m_executor_report_isSet = true;
+}
+
+SWGRemoteSinkReport*
+SWGChannelReport::getRemoteSinkReport() {
+    return remote_sink_report;
+}
+void
+SWGChannelReport::setRemoteSinkReport(SWGRemoteSinkReport* remote_sink_report) {
+    this->remote_sink_report = remote_sink_report;
+    this->m_remote_sink_report_isSet = true;
+}
+
 
 bool
 SWGChannelReport::isSet(){
@@ -651,6 +739,18 @@ SWGChannelReport::isSet(){
         if(wfm_mod_report && wfm_mod_report->isSet()){
             isObjectUpdated = true; break;
         }
+        if(atv_demod_report && atv_demod_report->isSet()){
+            isObjectUpdated = true; break;
+        }
+        if(shm_sink_report && shm_sink_report->isSet()){
+            isObjectUpdated = true; break;
+        }
+        if(executor_report && executor_report->isSet()){
+            isObjectUpdated = true; break;
+        }
+        if(remote_sink_report && remote_sink_report->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -45,6 +45,14 @@
 #include "SWGWFMModReport.h"
 #include <QString>
 
+#include "SWGATVDemodReport.h"
+
+#include "SWGShmSinkReport.h"
+
+#include "SWGChannelExecutorReport.h"
+
+#include "SWGRemoteSinkReport.h"
+
 #include "SWGObject.h"
 #include "export.h"
 
@@ -132,6 +140,18 @@ public:
     SWGWFMModReport* getWfmModReport();
     void setWfmModReport(SWGWFMModReport* wfm_mod_report);
 
+    SWGATVDemodReport* getAtvDemodReport();
+    void setAtvDemodReport(SWGATVDemodReport* atv_demod_report);
+
+    SWGShmSinkReport* getShmSinkReport();
+    void setShmSinkReport(SWGShmSinkReport* shm_sink_report);
+
+    SWGChannelExecutorReport* getExecutorReport();
+    void setExecutorReport(SWGChannelExecutorReport* executor_report);
+
+    SWGRemoteSinkReport* getRemoteSinkReport();
+    void setRemoteSinkReport(SWGRemoteSinkReport* remote_sink_report);
+
 
     virtual bool isSet() override;
 
@@ -205,6 +225,18 @@ private:
     SWGWFMModReport* wfm_mod_report;
     bool m_wfm_mod_report_isSet;
 
+    SWGATVDemodReport* atv_demod_report;
+    bool m_atv_demod_report_isSet;
+
+    SWGShmSinkReport* shm_sink_report;
+    bool m_shm_sink_report_isSet;
+
+    SWGChannelExecutorReport* executor_report;
+    bool m_executor_report_isSet;
+
+    SWGRemoteSinkReport* remote_sink_report;
+    bool m_remote_sink_report_isSet;
+
 };
 
 }
@@ -90,6 +90,8 @@ SWGChannelSettings::SWGChannelSettings() {
     m_wfm_demod_settings_isSet = false;
     wfm_mod_settings = nullptr;
     m_wfm_mod_settings_isSet = false;
+    shm_sink_settings = nullptr;
+    m_shm_sink_settings_isSet = false;
 }
 
 SWGChannelSettings::~SWGChannelSettings() {
@@ -160,6 +162,8 @@ SWGChannelSettings::init() {
     m_wfm_demod_settings_isSet = false;
     wfm_mod_settings = new SWGWFMModSettings();
     m_wfm_mod_settings_isSet = false;
+    shm_sink_settings = new SWGShmSinkSettings();
+    m_shm_sink_settings_isSet = false;
 }
 
 void
@@ -251,6 +255,9 @@ SWGChannelSettings::cleanup() {
     if(wfm_mod_settings != nullptr) { 
         delete wfm_mod_settings;
     }
+    if(shm_sink_settings != nullptr) { 
+        delete shm_sink_settings;
+    }
 }
 
 SWGChannelSettings*
@@ -326,6 +333,8 @@ SWGChannelSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&wfm_mod_settings, pJson["WFMModSettings"], "SWGWFMModSettings", "SWGWFMModSettings");
     
+    ::SWGSDRangel::setValue(&shm_sink_settings, pJson["ShmSinkSettings"], "SWGShmSinkSettings", "SWGShmSinkSettings");
+    
 }
 
 QString
@@ -435,6 +444,9 @@ SWGChannelSettings::asJsonObject() {
     if((wfm_mod_settings != nullptr) && (wfm_mod_settings->isSet())){
         toJsonValue(QString("WFMModSettings"), wfm_mod_settings, obj, QString("SWGWFMModSettings"));
     }
+    if((shm_sink_settings != nullptr) && (shm_sink_settings->isSet())){
+        toJsonValue(QString("ShmSinkSettings"), shm_sink_settings, obj, QString("SWGShmSinkSettings"));
+    }
 
     return obj;
 }
@@ -749,6 +761,16 @@ SWGChannelSettings::setWfmModSettings(SWGWFMModSettings* wfm_mod_settings) {
     this->m_wfm_mod_settings_isSet = true;
 }
 
+SWGShmSinkSettings*
+SWGChannelSettings::getShmSinkSettings() {
+    return shm_sink_settings;
+}
+void
+SWGChannelSettings::setShmSinkSettings(SWGShmSinkSettings* shm_sink_settings) {
+    this->shm_sink_settings = shm_sink_settings;
+    this->m_shm_sink_settings_isSet = true;
+}
+
 
 bool
 SWGChannelSettings::isSet(){
@@ -847,6 +869,9 @@ SWGChannelSettings::isSet(){
         if(wfm_mod_settings && wfm_mod_settings->isSet()){
             isObjectUpdated = true; break;
         }
+        if(shm_sink_settings && shm_sink_settings->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -51,6 +51,8 @@
 #include "SWGWFMModSettings.h"
 #include <QString>
 
+#include "SWGShmSinkSettings.h"
+
 #include "SWGObject.h"
 #include "export.h"
 
@@ -162,6 +164,9 @@ public:
     SWGWFMModSettings* getWfmModSettings();
     void setWfmModSettings(SWGWFMModSettings* wfm_mod_settings);
 
+    SWGShmSinkSettings* getShmSinkSettings();
+    void setShmSinkSettings(SWGShmSinkSettings* shm_sink_settings);
+
 
     virtual bool isSet() override;
 
@@ -259,6 +264,9 @@ private:
     SWGWFMModSettings* wfm_mod_settings;
     bool m_wfm_mod_settings_isSet;
 
+    SWGShmSinkSettings* shm_sink_settings;
+    bool m_shm_sink_settings_isSet;
+
 };
 
 }
@@ -78,6 +78,8 @@ SWGDeviceReport::SWGDeviceReport() {
     m_xtrx_input_report_isSet = false;
     xtrx_output_report = nullptr;
     m_xtrx_output_report_isSet = false;
+    shm_input_report = nullptr;
+    m_shm_input_report_isSet = false;
 }
 
 SWGDeviceReport::~SWGDeviceReport() {
@@ -136,6 +138,8 @@ SWGDeviceReport::init() {
     m_xtrx_input_report_isSet = false;
     xtrx_output_report = new SWGXtrxOutputReport();
     m_xtrx_output_report_isSet = false;
+    shm_input_report = new SWGShmInputReport();
+    m_shm_input_report_isSet = false;
 }
 
 void
@@ -213,6 +217,9 @@ SWGDeviceReport::cleanup() {
     if(xtrx_output_report != nullptr) { 
         delete xtrx_output_report;
     }
+    if(shm_input_report != nullptr) { 
+        delete shm_input_report;
+    }
 }
 
 SWGDeviceReport*
@@ -276,6 +283,8 @@ SWGDeviceReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&xtrx_output_report, pJson["xtrxOutputReport"], "SWGXtrxOutputReport", "SWGXtrxOutputReport");
     
+    ::SWGSDRangel::setValue(&shm_input_report, pJson["shmInputReport"], "SWGShmInputReport", "SWGShmInputReport");
+    
 }
 
 QString
@@ -367,6 +376,9 @@ SWGDeviceReport::asJsonObject() {
     if((xtrx_output_report != nullptr) && (xtrx_output_report->isSet())){
         toJsonValue(QString("xtrxOutputReport"), xtrx_output_report, obj, QString("SWGXtrxOutputReport"));
     }
+    if((shm_input_report != nullptr) && (shm_input_report->isSet())){
+        toJsonValue(QString("shmInputReport"), shm_input_report, obj, QString("SWGShmInputReport"));
+    }
 
     return obj;
 }
@@ -621,6 +633,16 @@ SWGDeviceReport::setXtrxOutputReport(SWGXtrxOutputReport* xtrx_output_report) {
     this->m_xtrx_output_report_isSet = true;
 }
 
+SWGShmInputReport*
+SWGDeviceReport::getShmInputReport() {
+    return shm_input_report;
+}
+void
+SWGDeviceReport::setShmInputReport(SWGShmInputReport* shm_input_report) {
+    this->shm_input_report = shm_input_report;
+    this->m_shm_input_report_isSet = true;
+}
+
 
 bool
 SWGDeviceReport::isSet(){
@@ -701,6 +723,9 @@ SWGDeviceReport::isSet(){
         if(xtrx_output_report && xtrx_output_report->isSet()){
             isObjectUpdated = true; break;
         }
+        if(shm_input_report && shm_input_report->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -46,6 +46,8 @@
 #include "SWGXtrxOutputReport.h"
 #include <QString>
 
+#include "SWGShmInputReport.h"
+
 #include "SWGObject.h"
 #include "export.h"
 
@@ -139,6 +141,9 @@ public:
     SWGXtrxOutputReport* getXtrxOutputReport();
     void setXtrxOutputReport(SWGXtrxOutputReport* xtrx_output_report);
 
+    SWGShmInputReport* getShmInputReport();
+    void setShmInputReport(SWGShmInputReport* shm_input_report);
+
 
     virtual bool isSet() override;
 
@@ -218,6 +223,9 @@ private:
     SWGXtrxOutputReport* xtrx_output_report;
     bool m_xtrx_output_report_isSet;
 
+    SWGShmInputReport* shm_input_report;
+    bool m_shm_input_report_isSet;
+
 };
 
 }
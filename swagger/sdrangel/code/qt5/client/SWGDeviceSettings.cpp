@@ -96,6 +96,8 @@ SWGDeviceSettings::SWGDeviceSettings() {
     m_xtrx_input_settings_isSet = false;
     xtrx_output_settings = nullptr;
     m_xtrx_output_settings_isSet = false;
+    shm_input_settings = nullptr;
+    m_shm_input_settings_isSet = false;
 }
 
 SWGDeviceSettings::~SWGDeviceSettings() {
@@ -172,6 +174,8 @@ SWGDeviceSettings::init() {
     m_xtrx_input_settings_isSet = false;
     xtrx_output_settings = new SWGXtrxOutputSettings();
     m_xtrx_output_settings_isSet = false;
+    shm_input_settings = new SWGShmInputSettings();
+    m_shm_input_settings_isSet = false;
 }
 
 void
@@ -274,6 +278,9 @@ SWGDeviceSettings::cleanup() {
     if(xtrx_output_settings != nullptr) { 
         delete xtrx_output_settings;
     }
+    if(shm_input_settings != nullptr) { 
+        delete shm_input_settings;
+    }
 }
 
 SWGDeviceSettings*
@@ -355,6 +362,8 @@ SWGDeviceSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&xtrx_output_settings, pJson["xtrxOutputSettings"], "SWGXtrxOutputSettings", "SWGXtrxOutputSettings");
     
+    ::SWGSDRangel::setValue(&shm_input_settings, pJson["shmInputSettings"], "SWGShmInputSettings", "SWGShmInputSettings");
+    
 }
 
 QString
@@ -473,6 +482,9 @@ SWGDeviceSettings::asJsonObject() {
     if((xtrx_output_settings != nullptr) && (xtrx_output_settings->isSet())){
         toJsonValue(QString("xtrxOutputSettings"), xtrx_output_settings, obj, QString("SWGXtrxOutputSettings"));
     }
+    if((shm_input_settings != nullptr) && (shm_input_settings->isSet())){
+        toJsonValue(QString("shmInputSettings"), shm_input_settings, obj, QString("SWGShmInputSettings"));
+    }
 
     return obj;
 }
@@ -817,6 +829,16 @@ SWGDeviceSettings::setXtrxOutputSettings(SWGXtrxOutputSettings* xtrx_output_sett
     this->m_xtrx_output_settings_isSet = true;
 }
 
+SWGShmInputSettings*
+SWGDeviceSettings::getShmInputSettings() {
+    return shm_input_settings;
+}
+void
+SWGDeviceSettings::setShmInputSettings(SWGShmInputSettings* shm_input_settings) {
+    this->shm_input_settings = shm_input_settings;
+    this->m_shm_input_settings_isSet = true;
+}
+
 
 bool
 SWGDeviceSettings::isSet(){
@@ -924,6 +946,9 @@ SWGDeviceSettings::isSet(){
         if(xtrx_output_settings && xtrx_output_settings->isSet()){
             isObjectUpdated = true; break;
         }
+        if(shm_input_settings && shm_input_settings->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
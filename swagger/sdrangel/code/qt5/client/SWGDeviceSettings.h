@@ -55,6 +55,8 @@
 #include "SWGXtrxOutputSettings.h"
 #include <QString>
 
+#include "SWGShmInputSettings.h"
+
 #include "SWGObject.h"
 #include "export.h"
 
@@ -175,6 +177,9 @@ public:
     SWGXtrxOutputSettings* getXtrxOutputSettings();
     void setXtrxOutputSettings(SWGXtrxOutputSettings* xtrx_output_settings);
 
+    SWGShmInputSettings* getShmInputSettings();
+    void setShmInputSettings(SWGShmInputSettings* shm_input_settings);
+
 
     virtual bool isSet() override;
 
@@ -281,6 +286,9 @@ private:
     SWGXtrxOutputSettings* xtrx_output_settings;
     bool m_xtrx_output_settings_isSet;
 
+    SWGShmInputSettings* shm_input_settings;
+    bool m_shm_input_settings_isSet;
+
 };
 
 }
@@ -36,6 +36,8 @@ SWGFeatureActions::SWGFeatureActions() {
     m_originator_feature_index_isSet = false;
     simple_ptt_actions = nullptr;
     m_simple_ptt_actions_isSet = false;
+    freq_sweep_actions = nullptr;
+    m_freq_sweep_actions_isSet = false;
 }
 
 SWGFeatureActions::~SWGFeatureActions() {
@@ -52,6 +54,8 @@ SWGFeatureActions::init() {
     m_originator_feature_index_isSet = false;
     simple_ptt_actions = new SWGSimplePTTActions();
     m_simple_ptt_actions_isSet = false;
+    freq_sweep_actions = new SWGFreqSweepActions();
+    m_freq_sweep_actions_isSet = false;
 }
 
 void
@@ -64,6 +68,9 @@ SWGFeatureActions::cleanup() {
     if(simple_ptt_actions != nullptr) { 
         delete simple_ptt_actions;
     }
+    if(freq_sweep_actions != nullptr) { 
+        delete freq_sweep_actions;
+    }
 }
 
 SWGFeatureActions*
@@ -85,6 +92,8 @@ SWGFeatureActions::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&simple_ptt_actions, pJson["SimplePTTActions"], "SWGSimplePTTActions", "SWGSimplePTTActions");
     
+    ::SWGSDRangel::setValue(&freq_sweep_actions, pJson["FreqSweepActions"], "SWGFreqSweepActions", "SWGFreqSweepActions");
+    
 }
 
 QString
@@ -113,6 +122,9 @@ SWGFeatureActions::asJsonObject() {
     if((simple_ptt_actions != nullptr) && (simple_ptt_actions->isSet())){
         toJsonValue(QString("SimplePTTActions"), simple_ptt_actions, obj, QString("SWGSimplePTTActions"));
     }
+    if((freq_sweep_actions != nullptr) && (freq_sweep_actions->isSet())){
+        toJsonValue(QString("FreqSweepActions"), freq_sweep_actions, obj, QString("SWGFreqSweepActions"));
+    }
 
     return obj;
 }
@@ -157,6 +169,16 @@ SWGFeatureActions::setSimplePttActions(SWGSimplePTTActions* simple_ptt_actions)
     this->m_simple_ptt_actions_isSet = true;
 }
 
+SWGFreqSweepActions*
+SWGFeatureActions::getFreqSweepActions() {
+    return freq_sweep_actions;
+}
+void
+SWGFeatureActions::setFreqSweepActions(SWGFreqSweepActions* freq_sweep_actions) {
+    this->freq_sweep_actions = freq_sweep_actions;
+    this->m_freq_sweep_actions_isSet = true;
+}
+
 
 bool
 SWGFeatureActions::isSet(){
@@ -174,6 +196,9 @@ SWGFeatureActions::isSet(){
         if(simple_ptt_actions && simple_ptt_actions->isSet()){
             isObjectUpdated = true; break;
         }
+        if(freq_sweep_actions && freq_sweep_actions->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -25,6 +25,8 @@
 #include "SWGSimplePTTActions.h"
 #include <QString>
 
+#include "SWGFreqSweepActions.h"
+
 #include "SWGObject.h"
 #include "export.h"
 
@@ -55,6 +57,9 @@ public:
     SWGSimplePTTActions* getSimplePttActions();
     void setSimplePttActions(SWGSimplePTTActions* simple_ptt_actions);
 
+    SWGFreqSweepActions* getFreqSweepActions();
+    void setFreqSweepActions(SWGFreqSweepActions* freq_sweep_actions);
+
 
     virtual bool isSet() override;
 
@@ -71,6 +76,9 @@ private:
     SWGSimplePTTActions* simple_ptt_actions;
     bool m_simple_ptt_actions_isSet;
 
+    SWGFreqSweepActions* freq_sweep_actions;
+    bool m_freq_sweep_actions_isSet;
+
 };
 
 }
@@ -32,6 +32,8 @@ SWGFeatureReport::SWGFeatureReport() {
     m_feature_type_isSet = false;
     simple_ptt_report = nullptr;
     m_simple_ptt_report_isSet = false;
+    freq_sweep_report = nullptr;
+    m_freq_sweep_report_isSet = false;
 }
 
 SWGFeatureReport::~SWGFeatureReport() {
@@ -44,6 +46,8 @@ SWGFeatureReport::init() {
     m_feature_type_isSet = false;
     simple_ptt_report = new SWGSimplePTTReport();
     m_simple_ptt_report_isSet = false;
+    freq_sweep_report = new SWGFreqSweepReport();
+    m_freq_sweep_report_isSet = false;
 }
 
 void
@@ -54,6 +58,9 @@ SWGFeatureReport::cleanup() {
     if(simple_ptt_report != nullptr) { 
         delete simple_ptt_report;
     }
+    if(freq_sweep_report != nullptr) { 
+        delete freq_sweep_report;
+    }
 }
 
 SWGFeatureReport*
@@ -71,6 +78,8 @@ SWGFeatureReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&simple_ptt_report, pJson["SimplePTTReport"], "SWGSimplePTTReport", "SWGSimplePTTReport");
     
+    ::SWGSDRangel::setValue(&freq_sweep_report, pJson["FreqSweepReport"], "SWGFreqSweepReport", "SWGFreqSweepReport");
+    
 }
 
 QString
@@ -93,6 +102,9 @@ SWGFeatureReport::asJsonObject() {
     if((simple_ptt_report != nullptr) && (simple_ptt_report->isSet())){
         toJsonValue(QString("SimplePTTReport"), simple_ptt_report, obj, QString("SWGSimplePTTReport"));
     }
+    if((freq_sweep_report != nullptr) && (freq_sweep_report->isSet())){
+        toJsonValue(QString("FreqSweepReport"), freq_sweep_report, obj, QString("SWGFreqSweepReport"));
+    }
 
     return obj;
 }
@@ -117,6 +129,16 @@ SWGFeatureReport::setSimplePttReport(SWGSimplePTTReport* simple_ptt_report) {
     this->m_simple_ptt_report_isSet = true;
 }
 
+SWGFreqSweepReport*
+SWGFeatureReport::getFreqSweepReport() {
+    return freq_sweep_report;
+}
+void
+SWGFeatureReport::setFreqSweepReport(SWGFreqSweepReport* freq_sweep_report) {
+    this->freq_sweep_report = freq_sweep_report;
+    this->m_freq_sweep_report_isSet = true;
+}
+
 
 bool
 SWGFeatureReport::isSet(){
@@ -128,6 +150,9 @@ SWGFeatureReport::isSet(){
         if(simple_ptt_report && simple_ptt_report->isSet()){
             isObjectUpdated = true; break;
         }
+        if(freq_sweep_report && freq_sweep_report->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
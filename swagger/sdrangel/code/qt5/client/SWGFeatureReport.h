@@ -25,6 +25,8 @@
 #include "SWGSimplePTTReport.h"
 #include <QString>
 
+#include "SWGFreqSweepReport.h"
+
 #include "SWGObject.h"
 #include "export.h"
 
@@ -49,6 +51,9 @@ public:
     SWGSimplePTTReport* getSimplePttReport();
     void setSimplePttReport(SWGSimplePTTReport* simple_ptt_report);
 
+    SWGFreqSweepReport* getFreqSweepReport();
+    void setFreqSweepReport(SWGFreqSweepReport* freq_sweep_report);
+
 
     virtual bool isSet() override;
 
@@ -59,6 +64,9 @@ private:
     SWGSimplePTTReport* simple_ptt_report;
     bool m_simple_ptt_report_isSet;
 
+    SWGFreqSweepReport* freq_sweep_report;
+    bool m_freq_sweep_report_isSet;
+
 };
 
 }
@@ -38,6 +38,8 @@ SWGFeatureSettings::SWGFeatureSettings() {
     m_simple_ptt_settings_isSet = false;
     rig_ctl_server_settings = nullptr;
     m_rig_ctl_server_settings_isSet = false;
+    freq_sweep_settings = nullptr;
+    m_freq_sweep_settings_isSet = false;
 }
 
 SWGFeatureSettings::~SWGFeatureSettings() {
@@ -56,6 +58,8 @@ SWGFeatureSettings::init() {
     m_simple_ptt_settings_isSet = false;
     rig_ctl_server_settings = new SWGRigCtlServerSettings();
     m_rig_ctl_server_settings_isSet = false;
+    freq_sweep_settings = new SWGFreqSweepSettings();
+    m_freq_sweep_settings_isSet = false;
 }
 
 void
@@ -71,6 +75,9 @@ SWGFeatureSettings::cleanup() {
     if(rig_ctl_server_settings != nullptr) { 
         delete rig_ctl_server_settings;
     }
+    if(freq_sweep_settings != nullptr) { 
+        delete freq_sweep_settings;
+    }
 }
 
 SWGFeatureSettings*
@@ -94,6 +101,8 @@ SWGFeatureSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&rig_ctl_server_settings, pJson["RigCtlServerSettings"], "SWGRigCtlServerSettings", "SWGRigCtlServerSettings");
     
+    ::SWGSDRangel::setValue(&freq_sweep_settings, pJson["FreqSweepSettings"], "SWGFreqSweepSettings", "SWGFreqSweepSettings");
+    
 }
 
 QString
@@ -125,6 +134,9 @@ SWGFeatureSettings::asJsonObject() {
     if((rig_ctl_server_settings != nullptr) && (rig_ctl_server_settings->isSet())){
         toJsonValue(QString("RigCtlServerSettings"), rig_ctl_server_settings, obj, QString("SWGRigCtlServerSettings"));
     }
+    if((freq_sweep_settings != nullptr) && (freq_sweep_settings->isSet())){
+        toJsonValue(QString("FreqSweepSettings"), freq_sweep_settings, obj, QString("SWGFreqSweepSettings"));
+    }
 
     return obj;
 }
@@ -179,6 +191,16 @@ SWGFeatureSettings::setRigCtlServerSettings(SWGRigCtlServerSettings* rig_ctl_ser
     this->m_rig_ctl_server_settings_isSet = true;
 }
 
+SWGFreqSweepSettings*
+SWGFeatureSettings::getFreqSweepSettings() {
+    return freq_sweep_settings;
+}
+void
+SWGFeatureSettings::setFreqSweepSettings(SWGFreqSweepSettings* freq_sweep_settings) {
+    this->freq_sweep_settings = freq_sweep_settings;
+    this->m_freq_sweep_settings_isSet = true;
+}
+
 
 bool
 SWGFeatureSettings::isSet(){
@@ -199,6 +221,9 @@ SWGFeatureSettings::isSet(){
         if(rig_ctl_server_settings && rig_ctl_server_settings->isSet()){
             isObjectUpdated = true; break;
         }
+        if(freq_sweep_settings && freq_sweep_settings->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
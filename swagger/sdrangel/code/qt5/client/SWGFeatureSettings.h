@@ -26,6 +26,8 @@
 #include "SWGSimplePTTSettings.h"
 #include <QString>
 
+#include "SWGFreqSweepSettings.h"
+
 #include "SWGObject.h"
 #include "export.h"
 
@@ -59,6 +61,9 @@ public:
     SWGRigCtlServerSettings* getRigCtlServerSettings();
     void setRigCtlServerSettings(SWGRigCtlServerSettings* rig_ctl_server_settings);
 
+    SWGFreqSweepSettings* getFreqSweepSettings();
+    void setFreqSweepSettings(SWGFreqSweepSettings* freq_sweep_settings);
+
 
     virtual bool isSet() override;
 
@@ -78,6 +83,9 @@ private:
     SWGRigCtlServerSettings* rig_ctl_server_settings;
     bool m_rig_ctl_server_settings_isSet;
 
+    SWGFreqSweepSettings* freq_sweep_settings;
+    bool m_freq_sweep_settings_isSet;
+
 };
 
 }
@@ -0,0 +1,342 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGFreqSweepReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGFreqSweepReport::SWGFreqSweepReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGFreqSweepReport::SWGFreqSweepReport() {
+    sweeping = 0;
+    m_sweeping_isSet = false;
+    error_message = nullptr;
+    m_error_message_isSet = false;
+    sweep_count = 0L;
+    m_sweep_count_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    bin_width = 0.0;
+    m_bin_width_isSet = false;
+    nb_steps = 0;
+    m_nb_steps_isSet = false;
+    sweep_duration_ms = 0.0f;
+    m_sweep_duration_ms_isSet = false;
+    sweep_rate = 0.0f;
+    m_sweep_rate_isSet = false;
+    retune_latency_us = 0.0f;
+    m_retune_latency_us_isSet = false;
+    transient_blocks = 0;
+    m_transient_blocks_isSet = false;
+    power = nullptr;
+    m_power_isSet = false;
+}
+
+SWGFreqSweepReport::~SWGFreqSweepReport() {
+    this->cleanup();
+}
+
+void
+SWGFreqSweepReport::init() {
+    sweeping = 0;
+    m_sweeping_isSet = false;
+    error_message = new QString("");
+    m_error_message_isSet = false;
+    sweep_count = 0L;
+    m_sweep_count_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    bin_width = 0.0;
+    m_bin_width_isSet = false;
+    nb_steps = 0;
+    m_nb_steps_isSet = false;
+    sweep_duration_ms = 0.0f;
+    m_sweep_duration_ms_isSet = false;
+    sweep_rate = 0.0f;
+    m_sweep_rate_isSet = false;
+    retune_latency_us = 0.0f;
+    m_retune_latency_us_isSet = false;
+    transient_blocks = 0;
+    m_transient_blocks_isSet = false;
+    power = new QList<float>();
+    m_power_isSet = false;
+}
+
+void
+SWGFreqSweepReport::cleanup() {
+
+    if(error_message != nullptr) { 
+        delete error_message;
+    }
+
+
+
+
+
+
+
+
+    if(power != nullptr) { 
+        delete power;
+    }
+}
+
+SWGFreqSweepReport*
+SWGFreqSweepReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGFreqSweepReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&sweeping, pJson["sweeping"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&error_message, pJson["errorMessage"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&sweep_count, pJson["sweepCount"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&start_frequency, pJson["startFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&bin_width, pJson["binWidth"], "double", "");
+    
+    ::SWGSDRangel::setValue(&nb_steps, pJson["nbSteps"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&sweep_duration_ms, pJson["sweepDurationMs"], "float", "");
+    
+    ::SWGSDRangel::setValue(&sweep_rate, pJson["sweepRate"], "float", "");
+    
+    ::SWGSDRangel::setValue(&retune_latency_us, pJson["retuneLatencyUs"], "float", "");
+    
+    ::SWGSDRangel::setValue(&transient_blocks, pJson["transientBlocks"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&power, pJson["power"], "QList", "float");
+}
+
+QString
+SWGFreqSweepReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGFreqSweepReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_sweeping_isSet){
+        obj->insert("sweeping", QJsonValue(sweeping));
+    }
+    if(error_message != nullptr && *error_message != QString("")){
+        toJsonValue(QString("errorMessage"), error_message, obj, QString("QString"));
+    }
+    if(m_sweep_count_isSet){
+        obj->insert("sweepCount", QJsonValue(sweep_count));
+    }
+    if(m_start_frequency_isSet){
+        obj->insert("startFrequency", QJsonValue(start_frequency));
+    }
+    if(m_bin_width_isSet){
+        obj->insert("binWidth", QJsonValue(bin_width));
+    }
+    if(m_nb_steps_isSet){
+        obj->insert("nbSteps", QJsonValue(nb_steps));
+    }
+    if(m_sweep_duration_ms_isSet){
+        obj->insert("sweepDurationMs", QJsonValue(sweep_duration_ms));
+    }
+    if(m_sweep_rate_isSet){
+        obj->insert("sweepRate", QJsonValue(sweep_rate));
+    }
+    if(m_retune_latency_us_isSet){
+        obj->insert("retuneLatencyUs", QJsonValue(retune_latency_us));
+    }
+    if(m_transient_blocks_isSet){
+        obj->insert("transientBlocks", QJsonValue(transient_blocks));
+    }
+    if(power && power->size() > 0){
+        toJsonArray((QList<void*>*)power, obj, "power", "float");
+    }
+
+    return obj;
+}
+
+qint32
+SWGFreqSweepReport::getSweeping() {
+    return sweeping;
+}
+void
+SWGFreqSweepReport::setSweeping(qint32 sweeping) {
+    this->sweeping = sweeping;
+    this->m_sweeping_isSet = true;
+}
+
+QString*
+SWGFreqSweepReport::getErrorMessage() {
+    return error_message;
+}
+void
+SWGFreqSweepReport::setErrorMessage(QString* error_message) {
+    this->error_message = error_message;
+    this->m_error_message_isSet = true;
+}
+
+qint64
+SWGFreqSweepReport::getSweepCount() {
+    return sweep_count;
+}
+void
+SWGFreqSweepReport::setSweepCount(qint64 sweep_count) {
+    this->sweep_count = sweep_count;
+    this->m_sweep_count_isSet = true;
+}
+
+qint64
+SWGFreqSweepReport::getStartFrequency() {
+    return start_frequency;
+}
+void
+SWGFreqSweepReport::setStartFrequency(qint64 start_frequency) {
+    this->start_frequency = start_frequency;
+    this->m_start_frequency_isSet = true;
+}
+
+double
+SWGFreqSweepReport::getBinWidth() {
+    return bin_width;
+}
+void
+SWGFreqSweepReport::setBinWidth(double bin_width) {
+    this->bin_width = bin_width;
+    this->m_bin_width_isSet = true;
+}
+
+qint32
+SWGFreqSweepReport::getNbSteps() {
+    return nb_steps;
+}
+void
+SWGFreqSweepReport::setNbSteps(qint32 nb_steps) {
+    this->nb_steps = nb_steps;
+    this->m_nb_steps_isSet = true;
+}
+
+float
+SWGFreqSweepReport::getSweepDurationMs() {
+    return sweep_duration_ms;
+}
+void
+SWGFreqSweepReport::setSweepDurationMs(float sweep_duration_ms) {
+    this->sweep_duration_ms = sweep_duration_ms;
+    this->m_sweep_duration_ms_isSet = true;
+}
+
+float
+SWGFreqSweepReport::getSweepRate() {
+    return sweep_rate;
+}
+void
+SWGFreqSweepReport::setSweepRate(float sweep_rate) {
+    this->sweep_rate = sweep_rate;
+    this->m_sweep_rate_isSet = true;
+}
+
+float
+SWGFreqSweepReport::getRetuneLatencyUs() {
+    return retune_latency_us;
+}
+void
+SWGFreqSweepReport::setRetuneLatencyUs(float retune_latency_us) {
+    this->retune_latency_us = retune_latency_us;
+    this->m_retune_latency_us_isSet = true;
+}
+
+qint32
+SWGFreqSweepReport::getTransientBlocks() {
+    return transient_blocks;
+}
+void
+SWGFreqSweepReport::setTransientBlocks(qint32 transient_blocks) {
+    this->transient_blocks = transient_blocks;
+    this->m_transient_blocks_isSet = true;
+}
+
+QList<float>*
+SWGFreqSweepReport::getPower() {
+    return power;
+}
+void
+SWGFreqSweepReport::setPower(QList<float>* power) {
+    this->power = power;
+    this->m_power_isSet = true;
+}
+
+
+bool
+SWGFreqSweepReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_sweeping_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(error_message && *error_message != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_sweep_count_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_start_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_bin_width_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_steps_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_sweep_duration_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_sweep_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_retune_latency_us_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_transient_blocks_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(power && (power->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,120 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGFreqSweepReport.h
+ *
+ * Frequency sweep report
+ */
+
+#ifndef SWGFreqSweepReport_H_
+#define SWGFreqSweepReport_H_
+
+#include <QJsonObject>
+
+
+#include <QList>
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGFreqSweepReport: public SWGObject {
+public:
+    SWGFreqSweepReport();
+    SWGFreqSweepReport(QString* json);
+    virtual ~SWGFreqSweepReport();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGFreqSweepReport* fromJson(QString &jsonString) override;
+
+    qint32 getSweeping();
+    void setSweeping(qint32 sweeping);
+
+    QString* getErrorMessage();
+    void setErrorMessage(QString* error_message);
+
+    qint64 getSweepCount();
+    void setSweepCount(qint64 sweep_count);
+
+    qint64 getStartFrequency();
+    void setStartFrequency(qint64 start_frequency);
+
+    double getBinWidth();
+    void setBinWidth(double bin_width);
+
+    qint32 getNbSteps();
+    void setNbSteps(qint32 nb_steps);
+
+    float getSweepDurationMs();
+    void setSweepDurationMs(float sweep_duration_ms);
+
+    float getSweepRate();
+    void setSweepRate(float sweep_rate);
+
+    float getRetuneLatencyUs();
+    void setRetuneLatencyUs(float retune_latency_us);
+
+    qint32 getTransientBlocks();
+    void setTransientBlocks(qint32 transient_blocks);
+
+    QList<float>* getPower();
+    void setPower(QList<float>* power);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 sweeping;
+    bool m_sweeping_isSet;
+
+    QString* error_message;
+    bool m_error_message_isSet;
+
+    qint64 sweep_count;
+    bool m_sweep_count_isSet;
+
+    qint64 start_frequency;
+    bool m_start_frequency_isSet;
+
+    double bin_width;
+    bool m_bin_width_isSet;
+
+    qint32 nb_steps;
+    bool m_nb_steps_isSet;
+
+    float sweep_duration_ms;
+    bool m_sweep_duration_ms_isSet;
+
+    float sweep_rate;
+    bool m_sweep_rate_isSet;
+
+    float retune_latency_us;
+    bool m_retune_latency_us_isSet;
+
+    qint32 transient_blocks;
+    bool m_transient_blocks_isSet;
+
+    QList<float>* power;
+    bool m_power_isSet;
+
+};
+
+}
+
+#endif /* SWGFreqSweepReport_H_ */
@@ -0,0 +1,551 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGFreqSweepSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGFreqSweepSettings::SWGFreqSweepSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGFreqSweepSettings::SWGFreqSweepSettings() {
+    title = nullptr;
+    m_title_isSet = false;
+    rgb_color = 0;
+    m_rgb_color_isSet = false;
+    device_set_index = 0;
+    m_device_set_index_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    stop_frequency = 0L;
+    m_stop_frequency_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    usable_bandwidth_ratio = 0.0f;
+    m_usable_bandwidth_ratio_isSet = false;
+    fft_averaging = 0;
+    m_fft_averaging_isSet = false;
+    discard_blocks = 0;
+    m_discard_blocks_isSet = false;
+    settle_time_us = 0;
+    m_settle_time_us_isSet = false;
+    settle_timeout_ms = 0;
+    m_settle_timeout_ms_isSet = false;
+    continuous = 0;
+    m_continuous_isSet = false;
+    use_web_socket = 0;
+    m_use_web_socket_isSet = false;
+    web_socket_address = nullptr;
+    m_web_socket_address_isSet = false;
+    web_socket_port = 0;
+    m_web_socket_port_isSet = false;
+    use_reverse_api = 0;
+    m_use_reverse_api_isSet = false;
+    reverse_api_address = nullptr;
+    m_reverse_api_address_isSet = false;
+    reverse_api_port = 0;
+    m_reverse_api_port_isSet = false;
+    reverse_api_device_index = 0;
+    m_reverse_api_device_index_isSet = false;
+    reverse_api_channel_index = 0;
+    m_reverse_api_channel_index_isSet = false;
+}
+
+SWGFreqSweepSettings::~SWGFreqSweepSettings() {
+    this->cleanup();
+}
+
+void
+SWGFreqSweepSettings::init() {
+    title = new QString("");
+    m_title_isSet = false;
+    rgb_color = 0;
+    m_rgb_color_isSet = false;
+    device_set_index = 0;
+    m_device_set_index_isSet = false;
+    start_frequency = 0L;
+    m_start_frequency_isSet = false;
+    stop_frequency = 0L;
+    m_stop_frequency_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    usable_bandwidth_ratio = 0.0f;
+    m_usable_bandwidth_ratio_isSet = false;
+    fft_averaging = 0;
+    m_fft_averaging_isSet = false;
+    discard_blocks = 0;
+    m_discard_blocks_isSet = false;
+    settle_time_us = 0;
+    m_settle_time_us_isSet = false;
+    settle_timeout_ms = 0;
+    m_settle_timeout_ms_isSet = false;
+    continuous = 0;
+    m_continuous_isSet = false;
+    use_web_socket = 0;
+    m_use_web_socket_isSet = false;
+    web_socket_address = new QString("");
+    m_web_socket_address_isSet = false;
+    web_socket_port = 0;
+    m_web_socket_port_isSet = false;
+    use_reverse_api = 0;
+    m_use_reverse_api_isSet = false;
+    reverse_api_address = new QString("");
+    m_reverse_api_address_isSet = false;
+    reverse_api_port = 0;
+    m_reverse_api_port_isSet = false;
+    reverse_api_device_index = 0;
+    m_reverse_api_device_index_isSet = false;
+    reverse_api_channel_index = 0;
+    m_reverse_api_channel_index_isSet = false;
+}
+
+void
+SWGFreqSweepSettings::cleanup() {
+    if(title != nullptr) { 
+        delete title;
+    }
+
+
+
+
+
+
+
+
+
+
+
+
+    if(web_socket_address != nullptr) { 
+        delete web_socket_address;
+    }
+
+
+    if(reverse_api_address != nullptr) { 
+        delete reverse_api_address;
+    }
+
+
+
+}
+
+SWGFreqSweepSettings*
+SWGFreqSweepSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGFreqSweepSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&title, pJson["title"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&device_set_index, pJson["deviceSetIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&start_frequency, pJson["startFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&stop_frequency, pJson["stopFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&fft_size, pJson["fftSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&usable_bandwidth_ratio, pJson["usableBandwidthRatio"], "float", "");
+    
+    ::SWGSDRangel::setValue(&fft_averaging, pJson["fftAveraging"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&discard_blocks, pJson["discardBlocks"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&settle_time_us, pJson["settleTimeUs"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&settle_timeout_ms, pJson["settleTimeoutMs"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&continuous, pJson["continuous"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&use_web_socket, pJson["useWebSocket"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&web_socket_address, pJson["webSocketAddress"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&web_socket_port, pJson["webSocketPort"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&reverse_api_port, pJson["reverseAPIPort"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_device_index, pJson["reverseAPIDeviceIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_channel_index, pJson["reverseAPIChannelIndex"], "qint32", "");
+    
+}
+
+QString
+SWGFreqSweepSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGFreqSweepSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(title != nullptr && *title != QString("")){
+        toJsonValue(QString("title"), title, obj, QString("QString"));
+    }
+    if(m_rgb_color_isSet){
+        obj->insert("rgbColor", QJsonValue(rgb_color));
+    }
+    if(m_device_set_index_isSet){
+        obj->insert("deviceSetIndex", QJsonValue(device_set_index));
+    }
+    if(m_start_frequency_isSet){
+        obj->insert("startFrequency", QJsonValue(start_frequency));
+    }
+    if(m_stop_frequency_isSet){
+        obj->insert("stopFrequency", QJsonValue(stop_frequency));
+    }
+    if(m_fft_size_isSet){
+        obj->insert("fftSize", QJsonValue(fft_size));
+    }
+    if(m_usable_bandwidth_ratio_isSet){
+        obj->insert("usableBandwidthRatio", QJsonValue(usable_bandwidth_ratio));
+    }
+    if(m_fft_averaging_isSet){
+        obj->insert("fftAveraging", QJsonValue(fft_averaging));
+    }
+    if(m_discard_blocks_isSet){
+        obj->insert("discardBlocks", QJsonValue(discard_blocks));
+    }
+    if(m_settle_time_us_isSet){
+        obj->insert("settleTimeUs", QJsonValue(settle_time_us));
+    }
+    if(m_settle_timeout_ms_isSet){
+        obj->insert("settleTimeoutMs", QJsonValue(settle_timeout_ms));
+    }
+    if(m_continuous_isSet){
+        obj->insert("continuous", QJsonValue(continuous));
+    }
+    if(m_use_web_socket_isSet){
+        obj->insert("useWebSocket", QJsonValue(use_web_socket));
+    }
+    if(web_socket_address != nullptr && *web_socket_address != QString("")){
+        toJsonValue(QString("webSocketAddress"), web_socket_address, obj, QString("QString"));
+    }
+    if(m_web_socket_port_isSet){
+        obj->insert("webSocketPort", QJsonValue(web_socket_port));
+    }
+    if(m_use_reverse_api_isSet){
+        obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
+    }
+    if(reverse_api_address != nullptr && *reverse_api_address != QString("")){
+        toJsonValue(QString("reverseAPIAddress"), reverse_api_address, obj, QString("QString"));
+    }
+    if(m_reverse_api_port_isSet){
+        obj->insert("reverseAPIPort", QJsonValue(reverse_api_port));
+    }
+    if(m_reverse_api_device_index_isSet){
+        obj->insert("reverseAPIDeviceIndex", QJsonValue(reverse_api_device_index));
+    }
+    if(m_reverse_api_channel_index_isSet){
+        obj->insert("reverseAPIChannelIndex", QJsonValue(reverse_api_channel_index));
+    }
+
+    return obj;
+}
+
+QString*
+SWGFreqSweepSettings::getTitle() {
+    return title;
+}
+void
+SWGFreqSweepSettings::setTitle(QString* title) {
+    this->title = title;
+    this->m_title_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getRgbColor() {
+    return rgb_color;
+}
+void
+SWGFreqSweepSettings::setRgbColor(qint32 rgb_color) {
+    this->rgb_color = rgb_color;
+    this->m_rgb_color_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getDeviceSetIndex() {
+    return device_set_index;
+}
+void
+SWGFreqSweepSettings::setDeviceSetIndex(qint32 device_set_index) {
+    this->device_set_index = device_set_index;
+    this->m_device_set_index_isSet = true;
+}
+
+qint64
+SWGFreqSweepSettings::getStartFrequency() {
+    return start_frequency;
+}
+void
+SWGFreqSweepSettings::setStartFrequency(qint64 start_frequency) {
+    this->start_frequency = start_frequency;
+    this->m_start_frequency_isSet = true;
+}
+
+qint64
+SWGFreqSweepSettings::getStopFrequency() {
+    return stop_frequency;
+}
+void
+SWGFreqSweepSettings::setStopFrequency(qint64 stop_frequency) {
+    this->stop_frequency = stop_frequency;
+    this->m_stop_frequency_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getFftSize() {
+    return fft_size;
+}
+void
+SWGFreqSweepSettings::setFftSize(qint32 fft_size) {
+    this->fft_size = fft_size;
+    this->m_fft_size_isSet = true;
+}
+
+float
+SWGFreqSweepSettings::getUsableBandwidthRatio() {
+    return usable_bandwidth_ratio;
+}
+void
+SWGFreqSweepSettings::setUsableBandwidthRatio(float usable_bandwidth_ratio) {
+    this->usable_bandwidth_ratio = usable_bandwidth_ratio;
+    this->m_usable_bandwidth_ratio_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getFftAveraging() {
+    return fft_averaging;
+}
+void
+SWGFreqSweepSettings::setFftAveraging(qint32 fft_averaging) {
+    this->fft_averaging = fft_averaging;
+    this->m_fft_averaging_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getDiscardBlocks() {
+    return discard_blocks;
+}
+void
+SWGFreqSweepSettings::setDiscardBlocks(qint32 discard_blocks) {
+    this->discard_blocks = discard_blocks;
+    this->m_discard_blocks_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getSettleTimeUs() {
+    return settle_time_us;
+}
+void
+SWGFreqSweepSettings::setSettleTimeUs(qint32 settle_time_us) {
+    this->settle_time_us = settle_time_us;
+    this->m_settle_time_us_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getSettleTimeoutMs() {
+    return settle_timeout_ms;
+}
+void
+SWGFreqSweepSettings::setSettleTimeoutMs(qint32 settle_timeout_ms) {
+    this->settle_timeout_ms = settle_timeout_ms;
+    this->m_settle_timeout_ms_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getContinuous() {
+    return continuous;
+}
+void
+SWGFreqSweepSettings::setContinuous(qint32 continuous) {
+    this->continuous = continuous;
+    this->m_continuous_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getUseWebSocket() {
+    return use_web_socket;
+}
+void
+SWGFreqSweepSettings::setUseWebSocket(qint32 use_web_socket) {
+    this->use_web_socket = use_web_socket;
+    this->m_use_web_socket_isSet = true;
+}
+
+QString*
+SWGFreqSweepSettings::getWebSocketAddress() {
+    return web_socket_address;
+}
+void
+SWGFreqSweepSettings::setWebSocketAddress(QString* web_socket_address) {
+    this->web_socket_address = web_socket_address;
+    this->m_web_socket_address_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getWebSocketPort() {
+    return web_socket_port;
+}
+void
+SWGFreqSweepSettings::setWebSocketPort(qint32 web_socket_port) {
+    this->web_socket_port = web_socket_port;
+    this->m_web_socket_port_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getUseReverseApi() {
+    return use_reverse_api;
+}
+void
+SWGFreqSweepSettings::setUseReverseApi(qint32 use_reverse_api) {
+    this->use_reverse_api = use_reverse_api;
+    this->m_use_reverse_api_isSet = true;
+}
+
+QString*
+SWGFreqSweepSettings::getReverseApiAddress() {
+    return reverse_api_address;
+}
+void
+SWGFreqSweepSettings::setReverseApiAddress(QString* reverse_api_address) {
+    this->reverse_api_address = reverse_api_address;
+    this->m_reverse_api_address_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getReverseApiPort() {
+    return reverse_api_port;
+}
+void
+SWGFreqSweepSettings::setReverseApiPort(qint32 reverse_api_port) {
+    this->reverse_api_port = reverse_api_port;
+    this->m_reverse_api_port_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getReverseApiDeviceIndex() {
+    return reverse_api_device_index;
+}
+void
+SWGFreqSweepSettings::setReverseApiDeviceIndex(qint32 reverse_api_device_index) {
+    this->reverse_api_device_index = reverse_api_device_index;
+    this->m_reverse_api_device_index_isSet = true;
+}
+
+qint32
+SWGFreqSweepSettings::getReverseApiChannelIndex() {
+    return reverse_api_channel_index;
+}
+void
+SWGFreqSweepSettings::setReverseApiChannelIndex(qint32 reverse_api_channel_index) {
+    this->reverse_api_channel_index = reverse_api_channel_index;
+    this->m_reverse_api_channel_index_isSet = true;
+}
+
+
+bool
+SWGFreqSweepSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(title && *title != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_rgb_color_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_device_set_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_start_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_stop_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fft_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_usable_bandwidth_ratio_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fft_averaging_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_discard_blocks_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_settle_time_us_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_settle_timeout_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_continuous_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_use_web_socket_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(web_socket_address && *web_socket_address != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_web_socket_port_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_use_reverse_api_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(reverse_api_address && *reverse_api_address != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_port_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_device_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_channel_index_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,173 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGFreqSweepSettings.h
+ *
+ * Frequency sweep settings
+ */
+
+#ifndef SWGFreqSweepSettings_H_
+#define SWGFreqSweepSettings_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGFreqSweepSettings: public SWGObject {
+public:
+    SWGFreqSweepSettings();
+    SWGFreqSweepSettings(QString* json);
+    virtual ~SWGFreqSweepSettings();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGFreqSweepSettings* fromJson(QString &jsonString) override;
+
+    QString* getTitle();
+    void setTitle(QString* title);
+
+    qint32 getRgbColor();
+    void setRgbColor(qint32 rgb_color);
+
+    qint32 getDeviceSetIndex();
+    void setDeviceSetIndex(qint32 device_set_index);
+
+    qint64 getStartFrequency();
+    void setStartFrequency(qint64 start_frequency);
+
+    qint64 getStopFrequency();
+    void setStopFrequency(qint64 stop_frequency);
+
+    qint32 getFftSize();
+    void setFftSize(qint32 fft_size);
+
+    float getUsableBandwidthRatio();
+    void setUsableBandwidthRatio(float usable_bandwidth_ratio);
+
+    qint32 getFftAveraging();
+    void setFftAveraging(qint32 fft_averaging);
+
+    qint32 getDiscardBlocks();
+    void setDiscardBlocks(qint32 discard_blocks);
+
+    qint32 getSettleTimeUs();
+    void setSettleTimeUs(qint32 settle_time_us);
+
+    qint32 getSettleTimeoutMs();
+    void setSettleTimeoutMs(qint32 settle_timeout_ms);
+
+    qint32 getContinuous();
+    void setContinuous(qint32 continuous);
+
+    qint32 getUseWebSocket();
+    void setUseWebSocket(qint32 use_web_socket);
+
+    QString* getWebSocketAddress();
+    void setWebSocketAddress(QString* web_socket_address);
+
+    qint32 getWebSocketPort();
+    void setWebSocketPort(qint32 web_socket_port);
+
+    qint32 getUseReverseApi();
+    void setUseReverseApi(qint32 use_reverse_api);
+
+    QString* getReverseApiAddress();
+    void setReverseApiAddress(QString* reverse_api_address);
+
+    qint32 getReverseApiPort();
+    void setReverseApiPort(qint32 reverse_api_port);
+
+    qint32 getReverseApiDeviceIndex();
+    void setReverseApiDeviceIndex(qint32 reverse_api_device_index);
+
+    qint32 getReverseApiChannelIndex();
+    void setReverseApiChannelIndex(qint32 reverse_api_channel_index);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* title;
+    bool m_title_isSet;
+
+    qint32 rgb_color;
+    bool m_rgb_color_isSet;
+
+    qint32 device_set_index;
+    bool m_device_set_index_isSet;
+
+    qint64 start_frequency;
+    bool m_start_frequency_isSet;
+
+    qint64 stop_frequency;
+    bool m_stop_frequency_isSet;
+
+    qint32 fft_size;
+    bool m_fft_size_isSet;
+
+    float usable_bandwidth_ratio;
+    bool m_usable_bandwidth_ratio_isSet;
+
+    qint32 fft_averaging;
+    bool m_fft_averaging_isSet;
+
+    qint32 discard_blocks;
+    bool m_discard_blocks_isSet;
+
+    qint32 settle_time_us;
+    bool m_settle_time_us_isSet;
+
+    qint32 settle_timeout_ms;
+    bool m_settle_timeout_ms_isSet;
+
+    qint32 continuous;
+    bool m_continuous_isSet;
+
+    qint32 use_web_socket;
+    bool m_use_web_socket_isSet;
+
+    QString* web_socket_address;
+    bool m_web_socket_address_isSet;
+
+    qint32 web_socket_port;
+    bool m_web_socket_port_isSet;
+
+    qint32 use_reverse_api;
+    bool m_use_reverse_api_isSet;
+
+    QString* reverse_api_address;
+    bool m_reverse_api_address_isSet;
+
+    qint32 reverse_api_port;
+    bool m_reverse_api_port_isSet;
+
+    qint32 reverse_api_device_index;
+    bool m_reverse_api_device_index_isSet;
+
+    qint32 reverse_api_channel_index;
+    bool m_reverse_api_channel_index_isSet;
+
+};
+
+}
+
+#endif /* SWGFreqSweepSettings_H_ */
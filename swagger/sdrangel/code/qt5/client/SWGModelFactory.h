@@ -20,6 +20,7 @@
 #include "SWGAMDemodSettings.h"
 #include "SWGAMModReport.h"
 #include "SWGAMModSettings.h"
+#include "SWGATVDemodReport.h"
 #include "SWGATVDemodSettings.h"
 #include "SWGATVModReport.h"
 #include "SWGATVModSettings.h"
@@ -32,6 +33,7 @@
 #include "SWGAudioDevices.h"
 #include "SWGAudioInputDevice.h"
 #include "SWGAudioOutputDevice.h"
+#include "SWGAudioOutputStream.h"
 #include "SWGBFMDemodReport.h"
 #include "SWGBFMDemodSettings.h"
 #include "SWGBandwidth.h"
@@ -47,6 +49,7 @@
 #include "SWGChannelActions.h"
 #include "SWGChannelAnalyzerSettings.h"
 #include "SWGChannelConfig.h"
+#include "SWGChannelExecutorReport.h"
 #include "SWGChannelListItem.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelSettings.h"
@@ -89,6 +92,9 @@
 #include "SWGFreeDVDemodSettings.h"
 #include "SWGFreeDVModReport.h"
 #include "SWGFreeDVModSettings.h"
+#include "SWGFreqSweepActions.h"
+#include "SWGFreqSweepReport.h"
+#include "SWGFreqSweepSettings.h"
 #include "SWGFreqTrackerReport.h"
 #include "SWGFreqTrackerSettings.h"
 #include "SWGFrequency.h"
@@ -136,6 +142,9 @@
 #include "SWGPacketModSettings.h"
 #include "SWGPerseusReport.h"
 #include "SWGPerseusSettings.h"
+#include "SWGPipelineHistogramBucket.h"
+#include "SWGPipelineMetrics.h"
+#include "SWGPipelineStageMetrics.h"
 #include "SWGPlutoSdrInputReport.h"
 #include "SWGPlutoSdrInputSettings.h"
 #include "SWGPlutoSdrOutputReport.h"
@@ -157,6 +166,7 @@
 #include "SWGRemoteInputSettings.h"
 #include "SWGRemoteOutputReport.h"
 #include "SWGRemoteOutputSettings.h"
+#include "SWGRemoteSinkReport.h"
 #include "SWGRemoteSinkSettings.h"
 #include "SWGRemoteSourceReport.h"
 #include "SWGRemoteSourceSettings.h"
@@ -171,6 +181,12 @@
 #include "SWGSSBModSettings.h"
 #include "SWGSampleRate.h"
 #include "SWGSamplingDevice.h"
+#include "SWGSettingsField.h"
+#include "SWGShmInputReport.h"
+#include "SWGShmInputSettings.h"
+#include "SWGShmSinkConsumer.h"
+#include "SWGShmSinkReport.h"
+#include "SWGShmSinkSettings.h"
 #include "SWGSimplePTTActions.h"
 #include "SWGSimplePTTReport.h"
 #include "SWGSimplePTTSettings.h"
@@ -195,6 +211,10 @@
 #include "SWGWFMDemodSettings.h"
 #include "SWGWFMModReport.h"
 #include "SWGWFMModSettings.h"
+#include "SWGWaterfallReport.h"
+#include "SWGWaterfallSettings.h"
+#include "SWGWaterfallTile.h"
+#include "SWGWaterfallZoomLevel.h"
 #include "SWGXtrxInputReport.h"
 #include "SWGXtrxInputSettings.h"
 #include "SWGXtrxOutputReport.h"
@@ -221,6 +241,9 @@ namespace SWGSDRangel {
     if(QString("SWGAMModSettings").compare(type) == 0) {
       return new SWGAMModSettings();
     }
+    if(QString("SWGATVDemodReport").compare(type) == 0) {
+      return new SWGATVDemodReport();
+    }
     if(QString("SWGATVDemodSettings").compare(type) == 0) {
       return new SWGATVDemodSettings();
     }
@@ -257,6 +280,9 @@ namespace SWGSDRangel {
     if(QString("SWGAudioOutputDevice").compare(type) == 0) {
       return new SWGAudioOutputDevice();
     }
+    if(QString("SWGAudioOutputStream").compare(type) == 0) {
+      return new SWGAudioOutputStream();
+    }
     if(QString("SWGBFMDemodReport").compare(type) == 0) {
       return new SWGBFMDemodReport();
     }
@@ -302,6 +328,9 @@ namespace SWGSDRangel {
     if(QString("SWGChannelConfig").compare(type) == 0) {
       return new SWGChannelConfig();
     }
+    if(QString("SWGChannelExecutorReport").compare(type) == 0) {
+      return new SWGChannelExecutorReport();
+    }
     if(QString("SWGChannelListItem").compare(type) == 0) {
       return new SWGChannelListItem();
     }
@@ -428,6 +457,15 @@ namespace SWGSDRangel {
     if(QString("SWGFreeDVModSettings").compare(type) == 0) {
       return new SWGFreeDVModSettings();
     }
+    if(QString("SWGFreqSweepActions").compare(type) == 0) {
+      return new SWGFreqSweepActions();
+    }
+    if(QString("SWGFreqSweepReport").compare(type) == 0) {
+      return new SWGFreqSweepReport();
+    }
+    if(QString("SWGFreqSweepSettings").compare(type) == 0) {
+      return new SWGFreqSweepSettings();
+    }
     if(QString("SWGFreqTrackerReport").compare(type) == 0) {
       return new SWGFreqTrackerReport();
     }
@@ -569,6 +607,15 @@ namespace SWGSDRangel {
     if(QString("SWGPerseusSettings").compare(type) == 0) {
       return new SWGPerseusSettings();
     }
+    if(QString("SWGPipelineHistogramBucket").compare(type) == 0) {
+      return new SWGPipelineHistogramBucket();
+    }
+    if(QString("SWGPipelineMetrics").compare(type) == 0) {
+      return new SWGPipelineMetrics();
+    }
+    if(QString("SWGPipelineStageMetrics").compare(type) == 0) {
+      return new SWGPipelineStageMetrics();
+    }
     if(QString("SWGPlutoSdrInputReport").compare(type) == 0) {
       return new SWGPlutoSdrInputReport();
     }
@@ -632,6 +679,9 @@ namespace SWGSDRangel {
     if(QString("SWGRemoteOutputSettings").compare(type) == 0) {
       return new SWGRemoteOutputSettings();
     }
+    if(QString("SWGRemoteSinkReport").compare(type) == 0) {
+      return new SWGRemoteSinkReport();
+    }
     if(QString("SWGRemoteSinkSettings").compare(type) == 0) {
       return new SWGRemoteSinkSettings();
     }
@@ -674,6 +724,24 @@ namespace SWGSDRangel {
     if(QString("SWGSamplingDevice").compare(type) == 0) {
       return new SWGSamplingDevice();
     }
+    if(QString("SWGSettingsField").compare(type) == 0) {
+      return new SWGSettingsField();
+    }
+    if(QString("SWGShmInputReport").compare(type) == 0) {
+      return new SWGShmInputReport();
+    }
+    if(QString("SWGShmInputSettings").compare(type) == 0) {
+      return new SWGShmInputSettings();
+    }
+    if(QString("SWGShmSinkConsumer").compare(type) == 0) {
+      return new SWGShmSinkConsumer();
+    }
+    if(QString("SWGShmSinkReport").compare(type) == 0) {
+      return new SWGShmSinkReport();
+    }
+    if(QString("SWGShmSinkSettings").compare(type) == 0) {
+      return new SWGShmSinkSettings();
+    }
     if(QString("SWGSimplePTTActions").compare(type) == 0) {
       return new SWGSimplePTTActions();
     }
@@ -746,6 +814,18 @@ namespace SWGSDRangel {
     if(QString("SWGWFMModSettings").compare(type) == 0) {
       return new SWGWFMModSettings();
     }
+    if(QString("SWGWaterfallReport").compare(type) == 0) {
+      return new SWGWaterfallReport();
+    }
+    if(QString("SWGWaterfallSettings").compare(type) == 0) {
+      return new SWGWaterfallSettings();
+    }
+    if(QString("SWGWaterfallTile").compare(type) == 0) {
+      return new SWGWaterfallTile();
+    }
+    if(QString("SWGWaterfallZoomLevel").compare(type) == 0) {
+      return new SWGWaterfallZoomLevel();
+    }
     if(QString("SWGXtrxInputReport").compare(type) == 0) {
       return new SWGXtrxInputReport();
     }
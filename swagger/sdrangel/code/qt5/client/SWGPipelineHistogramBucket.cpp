@@ -0,0 +1,131 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGPipelineHistogramBucket.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGPipelineHistogramBucket::SWGPipelineHistogramBucket(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGPipelineHistogramBucket::SWGPipelineHistogramBucket() {
+    upper_bound_ns = 0L;
+    m_upper_bound_ns_isSet = false;
+    count = 0L;
+    m_count_isSet = false;
+}
+
+SWGPipelineHistogramBucket::~SWGPipelineHistogramBucket() {
+    this->cleanup();
+}
+
+void
+SWGPipelineHistogramBucket::init() {
+    upper_bound_ns = 0L;
+    m_upper_bound_ns_isSet = false;
+    count = 0L;
+    m_count_isSet = false;
+}
+
+void
+SWGPipelineHistogramBucket::cleanup() {
+
+
+}
+
+SWGPipelineHistogramBucket*
+SWGPipelineHistogramBucket::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGPipelineHistogramBucket::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&upper_bound_ns, pJson["upperBoundNs"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&count, pJson["count"], "qint64", "");
+    
+}
+
+QString
+SWGPipelineHistogramBucket::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGPipelineHistogramBucket::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_upper_bound_ns_isSet){
+        obj->insert("upperBoundNs", QJsonValue(upper_bound_ns));
+    }
+    if(m_count_isSet){
+        obj->insert("count", QJsonValue(count));
+    }
+
+    return obj;
+}
+
+qint64
+SWGPipelineHistogramBucket::getUpperBoundNs() {
+    return upper_bound_ns;
+}
+void
+SWGPipelineHistogramBucket::setUpperBoundNs(qint64 upper_bound_ns) {
+    this->upper_bound_ns = upper_bound_ns;
+    this->m_upper_bound_ns_isSet = true;
+}
+
+qint64
+SWGPipelineHistogramBucket::getCount() {
+    return count;
+}
+void
+SWGPipelineHistogramBucket::setCount(qint64 count) {
+    this->count = count;
+    this->m_count_isSet = true;
+}
+
+
+bool
+SWGPipelineHistogramBucket::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_upper_bound_ns_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_count_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,160 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGPipelineMetrics.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGPipelineMetrics::SWGPipelineMetrics(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGPipelineMetrics::SWGPipelineMetrics() {
+    enabled = 0;
+    m_enabled_isSet = false;
+    stages = nullptr;
+    m_stages_isSet = false;
+    coalesced_messages = 0L;
+    m_coalesced_messages_isSet = false;
+}
+
+SWGPipelineMetrics::~SWGPipelineMetrics() {
+    this->cleanup();
+}
+
+void
+SWGPipelineMetrics::init() {
+    enabled = 0;
+    m_enabled_isSet = false;
+    stages = new QList<SWGPipelineStageMetrics*>();
+    m_stages_isSet = false;
+    coalesced_messages = 0L;
+    m_coalesced_messages_isSet = false;
+}
+
+void
+SWGPipelineMetrics::cleanup() {
+
+    if(stages != nullptr) { 
+        auto arr = stages;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete stages;
+    }
+
+}
+
+SWGPipelineMetrics*
+SWGPipelineMetrics::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGPipelineMetrics::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&enabled, pJson["enabled"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&stages, pJson["stages"], "QList", "SWGPipelineStageMetrics");
+    ::SWGSDRangel::setValue(&coalesced_messages, pJson["coalescedMessages"], "qint64", "");
+    
+}
+
+QString
+SWGPipelineMetrics::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGPipelineMetrics::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_enabled_isSet){
+        obj->insert("enabled", QJsonValue(enabled));
+    }
+    if(stages && stages->size() > 0){
+        toJsonArray((QList<void*>*)stages, obj, "stages", "SWGPipelineStageMetrics");
+    }
+    if(m_coalesced_messages_isSet){
+        obj->insert("coalescedMessages", QJsonValue(coalesced_messages));
+    }
+
+    return obj;
+}
+
+qint32
+SWGPipelineMetrics::getEnabled() {
+    return enabled;
+}
+void
+SWGPipelineMetrics::setEnabled(qint32 enabled) {
+    this->enabled = enabled;
+    this->m_enabled_isSet = true;
+}
+
+QList<SWGPipelineStageMetrics*>*
+SWGPipelineMetrics::getStages() {
+    return stages;
+}
+void
+SWGPipelineMetrics::setStages(QList<SWGPipelineStageMetrics*>* stages) {
+    this->stages = stages;
+    this->m_stages_isSet = true;
+}
+
+qint64
+SWGPipelineMetrics::getCoalescedMessages() {
+    return coalesced_messages;
+}
+void
+SWGPipelineMetrics::setCoalescedMessages(qint64 coalesced_messages) {
+    this->coalesced_messages = coalesced_messages;
+    this->m_coalesced_messages_isSet = true;
+}
+
+
+bool
+SWGPipelineMetrics::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_enabled_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(stages && (stages->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+        if(m_coalesced_messages_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
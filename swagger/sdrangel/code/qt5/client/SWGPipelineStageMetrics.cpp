@@ -0,0 +1,300 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGPipelineStageMetrics.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGPipelineStageMetrics::SWGPipelineStageMetrics(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGPipelineStageMetrics::SWGPipelineStageMetrics() {
+    name = nullptr;
+    m_name_isSet = false;
+    blocks = 0L;
+    m_blocks_isSet = false;
+    samples = 0L;
+    m_samples_isSet = false;
+    total_time_ns = 0L;
+    m_total_time_ns_isSet = false;
+    max_time_ns = 0L;
+    m_max_time_ns_isSet = false;
+    histogram = nullptr;
+    m_histogram_isSet = false;
+    fifo_fill_high_water = 0.0f;
+    m_fifo_fill_high_water_isSet = false;
+    overflows = 0L;
+    m_overflows_isSet = false;
+    underruns = 0L;
+    m_underruns_isSet = false;
+}
+
+SWGPipelineStageMetrics::~SWGPipelineStageMetrics() {
+    this->cleanup();
+}
+
+void
+SWGPipelineStageMetrics::init() {
+    name = new QString("");
+    m_name_isSet = false;
+    blocks = 0L;
+    m_blocks_isSet = false;
+    samples = 0L;
+    m_samples_isSet = false;
+    total_time_ns = 0L;
+    m_total_time_ns_isSet = false;
+    max_time_ns = 0L;
+    m_max_time_ns_isSet = false;
+    histogram = new QList<SWGPipelineHistogramBucket*>();
+    m_histogram_isSet = false;
+    fifo_fill_high_water = 0.0f;
+    m_fifo_fill_high_water_isSet = false;
+    overflows = 0L;
+    m_overflows_isSet = false;
+    underruns = 0L;
+    m_underruns_isSet = false;
+}
+
+void
+SWGPipelineStageMetrics::cleanup() {
+    if(name != nullptr) { 
+        delete name;
+    }
+
+
+
+
+    if(histogram != nullptr) { 
+        auto arr = histogram;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete histogram;
+    }
+
+
+
+}
+
+SWGPipelineStageMetrics*
+SWGPipelineStageMetrics::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGPipelineStageMetrics::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&name, pJson["name"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&blocks, pJson["blocks"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&samples, pJson["samples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&total_time_ns, pJson["totalTimeNs"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&max_time_ns, pJson["maxTimeNs"], "qint64", "");
+    
+    
+    ::SWGSDRangel::setValue(&histogram, pJson["histogram"], "QList", "SWGPipelineHistogramBucket");
+    ::SWGSDRangel::setValue(&fifo_fill_high_water, pJson["fifoFillHighWater"], "float", "");
+    
+    ::SWGSDRangel::setValue(&overflows, pJson["overflows"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&underruns, pJson["underruns"], "qint64", "");
+    
+}
+
+QString
+SWGPipelineStageMetrics::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGPipelineStageMetrics::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(name != nullptr && *name != QString("")){
+        toJsonValue(QString("name"), name, obj, QString("QString"));
+    }
+    if(m_blocks_isSet){
+        obj->insert("blocks", QJsonValue(blocks));
+    }
+    if(m_samples_isSet){
+        obj->insert("samples", QJsonValue(samples));
+    }
+    if(m_total_time_ns_isSet){
+        obj->insert("totalTimeNs", QJsonValue(total_time_ns));
+    }
+    if(m_max_time_ns_isSet){
+        obj->insert("maxTimeNs", QJsonValue(max_time_ns));
+    }
+    if(histogram && histogram->size() > 0){
+        toJsonArray((QList<void*>*)histogram, obj, "histogram", "SWGPipelineHistogramBucket");
+    }
+    if(m_fifo_fill_high_water_isSet){
+        obj->insert("fifoFillHighWater", QJsonValue(fifo_fill_high_water));
+    }
+    if(m_overflows_isSet){
+        obj->insert("overflows", QJsonValue(overflows));
+    }
+    if(m_underruns_isSet){
+        obj->insert("underruns", QJsonValue(underruns));
+    }
+
+    return obj;
+}
+
+QString*
+SWGPipelineStageMetrics::getName() {
+    return name;
+}
+void
+SWGPipelineStageMetrics::setName(QString* name) {
+    this->name = name;
+    this->m_name_isSet = true;
+}
+
+qint64
+SWGPipelineStageMetrics::getBlocks() {
+    return blocks;
+}
+void
+SWGPipelineStageMetrics::setBlocks(qint64 blocks) {
+    this->blocks = blocks;
+    this->m_blocks_isSet = true;
+}
+
+qint64
+SWGPipelineStageMetrics::getSamples() {
+    return samples;
+}
+void
+SWGPipelineStageMetrics::setSamples(qint64 samples) {
+    this->samples = samples;
+    this->m_samples_isSet = true;
+}
+
+qint64
+SWGPipelineStageMetrics::getTotalTimeNs() {
+    return total_time_ns;
+}
+void
+SWGPipelineStageMetrics::setTotalTimeNs(qint64 total_time_ns) {
+    this->total_time_ns = total_time_ns;
+    this->m_total_time_ns_isSet = true;
+}
+
+qint64
+SWGPipelineStageMetrics::getMaxTimeNs() {
+    return max_time_ns;
+}
+void
+SWGPipelineStageMetrics::setMaxTimeNs(qint64 max_time_ns) {
+    this->max_time_ns = max_time_ns;
+    this->m_max_time_ns_isSet = true;
+}
+
+QList<SWGPipelineHistogramBucket*>*
+SWGPipelineStageMetrics::getHistogram() {
+    return histogram;
+}
+void
+SWGPipelineStageMetrics::setHistogram(QList<SWGPipelineHistogramBucket*>* histogram) {
+    this->histogram = histogram;
+    this->m_histogram_isSet = true;
+}
+
+float
+SWGPipelineStageMetrics::getFifoFillHighWater() {
+    return fifo_fill_high_water;
+}
+void
+SWGPipelineStageMetrics::setFifoFillHighWater(float fifo_fill_high_water) {
+    this->fifo_fill_high_water = fifo_fill_high_water;
+    this->m_fifo_fill_high_water_isSet = true;
+}
+
+qint64
+SWGPipelineStageMetrics::getOverflows() {
+    return overflows;
+}
+void
+SWGPipelineStageMetrics::setOverflows(qint64 overflows) {
+    this->overflows = overflows;
+    this->m_overflows_isSet = true;
+}
+
+qint64
+SWGPipelineStageMetrics::getUnderruns() {
+    return underruns;
+}
+void
+SWGPipelineStageMetrics::setUnderruns(qint64 underruns) {
+    this->underruns = underruns;
+    this->m_underruns_isSet = true;
+}
+
+
+bool
+SWGPipelineStageMetrics::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(name && *name != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_blocks_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_samples_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_total_time_ns_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_max_time_ns_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(histogram && (histogram->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+        if(m_fifo_fill_high_water_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_overflows_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_underruns_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,109 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGPipelineStageMetrics.h
+ *
+ * Counters of a pipeline stage. All instances of a stage (e.g. all channelizers) are aggregated.
+ */
+
+#ifndef SWGPipelineStageMetrics_H_
+#define SWGPipelineStageMetrics_H_
+
+#include <QJsonObject>
+
+
+#include "SWGPipelineHistogramBucket.h"
+#include <QList>
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGPipelineStageMetrics: public SWGObject {
+public:
+    SWGPipelineStageMetrics();
+    SWGPipelineStageMetrics(QString* json);
+    virtual ~SWGPipelineStageMetrics();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGPipelineStageMetrics* fromJson(QString &jsonString) override;
+
+    QString* getName();
+    void setName(QString* name);
+
+    qint64 getBlocks();
+    void setBlocks(qint64 blocks);
+
+    qint64 getSamples();
+    void setSamples(qint64 samples);
+
+    qint64 getTotalTimeNs();
+    void setTotalTimeNs(qint64 total_time_ns);
+
+    qint64 getMaxTimeNs();
+    void setMaxTimeNs(qint64 max_time_ns);
+
+    QList<SWGPipelineHistogramBucket*>* getHistogram();
+    void setHistogram(QList<SWGPipelineHistogramBucket*>* histogram);
+
+    float getFifoFillHighWater();
+    void setFifoFillHighWater(float fifo_fill_high_water);
+
+    qint64 getOverflows();
+    void setOverflows(qint64 overflows);
+
+    qint64 getUnderruns();
+    void setUnderruns(qint64 underruns);
+
+
+    virtual bool isSet() override;
+
+private:
+    QString* name;
+    bool m_name_isSet;
+
+    qint64 blocks;
+    bool m_blocks_isSet;
+
+    qint64 samples;
+    bool m_samples_isSet;
+
+    qint64 total_time_ns;
+    bool m_total_time_ns_isSet;
+
+    qint64 max_time_ns;
+    bool m_max_time_ns_isSet;
+
+    QList<SWGPipelineHistogramBucket*>* histogram;
+    bool m_histogram_isSet;
+
+    float fifo_fill_high_water;
+    bool m_fifo_fill_high_water_isSet;
+
+    qint64 overflows;
+    bool m_overflows_isSet;
+
+    qint64 underruns;
+    bool m_underruns_isSet;
+
+};
+
+}
+
+#endif /* SWGPipelineStageMetrics_H_ */
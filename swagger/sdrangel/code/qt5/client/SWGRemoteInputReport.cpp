@@ -40,6 +40,12 @@ SWGRemoteInputReport::SWGRemoteInputReport() {
     m_min_nb_blocks_isSet = false;
     max_nb_recovery = 0;
     m_max_nb_recovery_isSet = false;
+    transport_encoding = 0;
+    m_transport_encoding_isSet = false;
+    compression_ratio = 0.0f;
+    m_compression_ratio_isSet = false;
+    codec_time_us = 0.0f;
+    m_codec_time_us_isSet = false;
 }
 
 SWGRemoteInputReport::~SWGRemoteInputReport() {
@@ -60,6 +66,12 @@ SWGRemoteInputReport::init() {
     m_min_nb_blocks_isSet = false;
     max_nb_recovery = 0;
     m_max_nb_recovery_isSet = false;
+    transport_encoding = 0;
+    m_transport_encoding_isSet = false;
+    compression_ratio = 0.0f;
+    m_compression_ratio_isSet = false;
+    codec_time_us = 0.0f;
+    m_codec_time_us_isSet = false;
 }
 
 void
@@ -72,6 +84,9 @@ SWGRemoteInputReport::cleanup() {
     }
 
 
+
+
+
 }
 
 SWGRemoteInputReport*
@@ -97,6 +112,12 @@ SWGRemoteInputReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&max_nb_recovery, pJson["maxNbRecovery"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&transport_encoding, pJson["transportEncoding"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&compression_ratio, pJson["compressionRatio"], "float", "");
+    
+    ::SWGSDRangel::setValue(&codec_time_us, pJson["codecTimeUs"], "float", "");
+    
 }
 
 QString
@@ -131,6 +152,15 @@ SWGRemoteInputReport::asJsonObject() {
     if(m_max_nb_recovery_isSet){
         obj->insert("maxNbRecovery", QJsonValue(max_nb_recovery));
     }
+    if(m_transport_encoding_isSet){
+        obj->insert("transportEncoding", QJsonValue(transport_encoding));
+    }
+    if(m_compression_ratio_isSet){
+        obj->insert("compressionRatio", QJsonValue(compression_ratio));
+    }
+    if(m_codec_time_us_isSet){
+        obj->insert("codecTimeUs", QJsonValue(codec_time_us));
+    }
 
     return obj;
 }
@@ -195,6 +225,36 @@ SWGRemoteInputReport::setMaxNbRecovery(qint32 max_nb_recovery) {
     this->m_max_nb_recovery_isSet = true;
 }
 
+qint32
+SWGRemoteInputReport::getTransportEncoding() {
+    return transport_encoding;
+}
+void
+SWGRemoteInputReport::setTransportEncoding(qint32 transport_encoding) {
+    this->transport_encoding = transport_encoding;
+    this->m_transport_encoding_isSet = true;
+}
+
+float
+SWGRemoteInputReport::getCompressionRatio() {
+    return compression_ratio;
+}
+void
+SWGRemoteInputReport::setCompressionRatio(float compression_ratio) {
+    this->compression_ratio = compression_ratio;
+    this->m_compression_ratio_isSet = true;
+}
+
+float
+SWGRemoteInputReport::getCodecTimeUs() {
+    return codec_time_us;
+}
+void
+SWGRemoteInputReport::setCodecTimeUs(float codec_time_us) {
+    this->codec_time_us = codec_time_us;
+    this->m_codec_time_us_isSet = true;
+}
+
 
 bool
 SWGRemoteInputReport::isSet(){
@@ -218,6 +278,15 @@ SWGRemoteInputReport::isSet(){
         if(m_max_nb_recovery_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_transport_encoding_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_compression_ratio_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_codec_time_us_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -60,6 +60,15 @@ public:
     qint32 getMaxNbRecovery();
     void setMaxNbRecovery(qint32 max_nb_recovery);
 
+    qint32 getTransportEncoding();
+    void setTransportEncoding(qint32 transport_encoding);
+
+    float getCompressionRatio();
+    void setCompressionRatio(float compression_ratio);
+
+    float getCodecTimeUs();
+    void setCodecTimeUs(float codec_time_us);
+
 
     virtual bool isSet() override;
 
@@ -82,6 +91,15 @@ private:
     qint32 max_nb_recovery;
     bool m_max_nb_recovery_isSet;
 
+    qint32 transport_encoding;
+    bool m_transport_encoding_isSet;
+
+    float compression_ratio;
+    bool m_compression_ratio_isSet;
+
+    float codec_time_us;
+    bool m_codec_time_us_isSet;
+
 };
 
 }
@@ -0,0 +1,154 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGRemoteSinkReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGRemoteSinkReport::SWGRemoteSinkReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGRemoteSinkReport::SWGRemoteSinkReport() {
+    transport_encoding = 0;
+    m_transport_encoding_isSet = false;
+    compression_ratio = 0.0f;
+    m_compression_ratio_isSet = false;
+    codec_time_us = 0.0f;
+    m_codec_time_us_isSet = false;
+}
+
+SWGRemoteSinkReport::~SWGRemoteSinkReport() {
+    this->cleanup();
+}
+
+void
+SWGRemoteSinkReport::init() {
+    transport_encoding = 0;
+    m_transport_encoding_isSet = false;
+    compression_ratio = 0.0f;
+    m_compression_ratio_isSet = false;
+    codec_time_us = 0.0f;
+    m_codec_time_us_isSet = false;
+}
+
+void
+SWGRemoteSinkReport::cleanup() {
+
+
+
+}
+
+SWGRemoteSinkReport*
+SWGRemoteSinkReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGRemoteSinkReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&transport_encoding, pJson["transportEncoding"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&compression_ratio, pJson["compressionRatio"], "float", "");
+    
+    ::SWGSDRangel::setValue(&codec_time_us, pJson["codecTimeUs"], "float", "");
+    
+}
+
+QString
+SWGRemoteSinkReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGRemoteSinkReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_transport_encoding_isSet){
+        obj->insert("transportEncoding", QJsonValue(transport_encoding));
+    }
+    if(m_compression_ratio_isSet){
+        obj->insert("compressionRatio", QJsonValue(compression_ratio));
+    }
+    if(m_codec_time_us_isSet){
+        obj->insert("codecTimeUs", QJsonValue(codec_time_us));
+    }
+
+    return obj;
+}
+
+qint32
+SWGRemoteSinkReport::getTransportEncoding() {
+    return transport_encoding;
+}
+void
+SWGRemoteSinkReport::setTransportEncoding(qint32 transport_encoding) {
+    this->transport_encoding = transport_encoding;
+    this->m_transport_encoding_isSet = true;
+}
+
+float
+SWGRemoteSinkReport::getCompressionRatio() {
+    return compression_ratio;
+}
+void
+SWGRemoteSinkReport::setCompressionRatio(float compression_ratio) {
+    this->compression_ratio = compression_ratio;
+    this->m_compression_ratio_isSet = true;
+}
+
+float
+SWGRemoteSinkReport::getCodecTimeUs() {
+    return codec_time_us;
+}
+void
+SWGRemoteSinkReport::setCodecTimeUs(float codec_time_us) {
+    this->codec_time_us = codec_time_us;
+    this->m_codec_time_us_isSet = true;
+}
+
+
+bool
+SWGRemoteSinkReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_transport_encoding_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_compression_ratio_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_codec_time_us_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -56,6 +56,10 @@ SWGRemoteSinkSettings::SWGRemoteSinkSettings() {
     m_reverse_api_device_index_isSet = false;
     reverse_api_channel_index = 0;
     m_reverse_api_channel_index_isSet = false;
+    transport_packing = 0;
+    m_transport_packing_isSet = false;
+    transport_lz4 = 0;
+    m_transport_lz4_isSet = false;
 }
 
 SWGRemoteSinkSettings::~SWGRemoteSinkSettings() {
@@ -92,6 +96,10 @@ SWGRemoteSinkSettings::init() {
     m_reverse_api_device_index_isSet = false;
     reverse_api_channel_index = 0;
     m_reverse_api_channel_index_isSet = false;
+    transport_packing = 0;
+    m_transport_packing_isSet = false;
+    transport_lz4 = 0;
+    m_transport_lz4_isSet = false;
 }
 
 void
@@ -116,6 +124,8 @@ SWGRemoteSinkSettings::cleanup() {
 
 
 
+
+
 }
 
 SWGRemoteSinkSettings*
@@ -157,6 +167,10 @@ SWGRemoteSinkSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&reverse_api_channel_index, pJson["reverseAPIChannelIndex"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&transport_packing, pJson["transportPacking"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&transport_lz4, pJson["transportLZ4"], "qint32", "");
+    
 }
 
 QString
@@ -215,6 +229,12 @@ SWGRemoteSinkSettings::asJsonObject() {
     if(m_reverse_api_channel_index_isSet){
         obj->insert("reverseAPIChannelIndex", QJsonValue(reverse_api_channel_index));
     }
+    if(m_transport_packing_isSet){
+        obj->insert("transportPacking", QJsonValue(transport_packing));
+    }
+    if(m_transport_lz4_isSet){
+        obj->insert("transportLZ4", QJsonValue(transport_lz4));
+    }
 
     return obj;
 }
@@ -359,6 +379,26 @@ SWGRemoteSinkSettings::setReverseApiChannelIndex(qint32 reverse_api_channel_inde
     this->m_reverse_api_channel_index_isSet = true;
 }
 
+qint32
+SWGRemoteSinkSettings::getTransportPacking() {
+    return transport_packing;
+}
+void
+SWGRemoteSinkSettings::setTransportPacking(qint32 transport_packing) {
+    this->transport_packing = transport_packing;
+    this->m_transport_packing_isSet = true;
+}
+
+qint32
+SWGRemoteSinkSettings::getTransportLz4() {
+    return transport_lz4;
+}
+void
+SWGRemoteSinkSettings::setTransportLz4(qint32 transport_lz4) {
+    this->transport_lz4 = transport_lz4;
+    this->m_transport_lz4_isSet = true;
+}
+
 
 bool
 SWGRemoteSinkSettings::isSet(){
@@ -406,6 +446,12 @@ SWGRemoteSinkSettings::isSet(){
         if(m_reverse_api_channel_index_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_transport_packing_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_transport_lz4_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
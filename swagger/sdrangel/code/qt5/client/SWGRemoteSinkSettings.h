@@ -84,6 +84,12 @@ public:
     qint32 getReverseApiChannelIndex();
     void setReverseApiChannelIndex(qint32 reverse_api_channel_index);
 
+    qint32 getTransportPacking();
+    void setTransportPacking(qint32 transport_packing);
+
+    qint32 getTransportLz4();
+    void setTransportLz4(qint32 transport_lz4);
+
 
     virtual bool isSet() override;
 
@@ -130,6 +136,12 @@ private:
     qint32 reverse_api_channel_index;
     bool m_reverse_api_channel_index_isSet;
 
+    qint32 transport_packing;
+    bool m_transport_packing_isSet;
+
+    qint32 transport_lz4;
+    bool m_transport_lz4_isSet;
+
 };
 
 }
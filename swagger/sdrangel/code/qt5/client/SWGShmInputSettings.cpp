@@ -0,0 +1,250 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGShmInputSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGShmInputSettings::SWGShmInputSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGShmInputSettings::SWGShmInputSettings() {
+    shm_name = nullptr;
+    m_shm_name_isSet = false;
+    dc_block = 0;
+    m_dc_block_isSet = false;
+    iq_correction = 0;
+    m_iq_correction_isSet = false;
+    use_reverse_api = 0;
+    m_use_reverse_api_isSet = false;
+    reverse_api_address = nullptr;
+    m_reverse_api_address_isSet = false;
+    reverse_api_port = 0;
+    m_reverse_api_port_isSet = false;
+    reverse_api_device_index = 0;
+    m_reverse_api_device_index_isSet = false;
+}
+
+SWGShmInputSettings::~SWGShmInputSettings() {
+    this->cleanup();
+}
+
+void
+SWGShmInputSettings::init() {
+    shm_name = new QString("");
+    m_shm_name_isSet = false;
+    dc_block = 0;
+    m_dc_block_isSet = false;
+    iq_correction = 0;
+    m_iq_correction_isSet = false;
+    use_reverse_api = 0;
+    m_use_reverse_api_isSet = false;
+    reverse_api_address = new QString("");
+    m_reverse_api_address_isSet = false;
+    reverse_api_port = 0;
+    m_reverse_api_port_isSet = false;
+    reverse_api_device_index = 0;
+    m_reverse_api_device_index_isSet = false;
+}
+
+void
+SWGShmInputSettings::cleanup() {
+    if(shm_name != nullptr) { 
+        delete shm_name;
+    }
+
+
+
+    if(reverse_api_address != nullptr) { 
+        delete reverse_api_address;
+    }
+
+
+}
+
+SWGShmInputSettings*
+SWGShmInputSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGShmInputSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&shm_name, pJson["shmName"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&dc_block, pJson["dcBlock"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&iq_correction, pJson["iqCorrection"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&reverse_api_port, pJson["reverseAPIPort"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_device_index, pJson["reverseAPIDeviceIndex"], "qint32", "");
+    
+}
+
+QString
+SWGShmInputSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGShmInputSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(shm_name != nullptr && *shm_name != QString("")){
+        toJsonValue(QString("shmName"), shm_name, obj, QString("QString"));
+    }
+    if(m_dc_block_isSet){
+        obj->insert("dcBlock", QJsonValue(dc_block));
+    }
+    if(m_iq_correction_isSet){
+        obj->insert("iqCorrection", QJsonValue(iq_correction));
+    }
+    if(m_use_reverse_api_isSet){
+        obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
+    }
+    if(reverse_api_address != nullptr && *reverse_api_address != QString("")){
+        toJsonValue(QString("reverseAPIAddress"), reverse_api_address, obj, QString("QString"));
+    }
+    if(m_reverse_api_port_isSet){
+        obj->insert("reverseAPIPort", QJsonValue(reverse_api_port));
+    }
+    if(m_reverse_api_device_index_isSet){
+        obj->insert("reverseAPIDeviceIndex", QJsonValue(reverse_api_device_index));
+    }
+
+    return obj;
+}
+
+QString*
+SWGShmInputSettings::getShmName() {
+    return shm_name;
+}
+void
+SWGShmInputSettings::setShmName(QString* shm_name) {
+    this->shm_name = shm_name;
+    this->m_shm_name_isSet = true;
+}
+
+qint32
+SWGShmInputSettings::getDcBlock() {
+    return dc_block;
+}
+void
+SWGShmInputSettings::setDcBlock(qint32 dc_block) {
+    this->dc_block = dc_block;
+    this->m_dc_block_isSet = true;
+}
+
+qint32
+SWGShmInputSettings::getIqCorrection() {
+    return iq_correction;
+}
+void
+SWGShmInputSettings::setIqCorrection(qint32 iq_correction) {
+    this->iq_correction = iq_correction;
+    this->m_iq_correction_isSet = true;
+}
+
+qint32
+SWGShmInputSettings::getUseReverseApi() {
+    return use_reverse_api;
+}
+void
+SWGShmInputSettings::setUseReverseApi(qint32 use_reverse_api) {
+    this->use_reverse_api = use_reverse_api;
+    this->m_use_reverse_api_isSet = true;
+}
+
+QString*
+SWGShmInputSettings::getReverseApiAddress() {
+    return reverse_api_address;
+}
+void
+SWGShmInputSettings::setReverseApiAddress(QString* reverse_api_address) {
+    this->reverse_api_address = reverse_api_address;
+    this->m_reverse_api_address_isSet = true;
+}
+
+qint32
+SWGShmInputSettings::getReverseApiPort() {
+    return reverse_api_port;
+}
+void
+SWGShmInputSettings::setReverseApiPort(qint32 reverse_api_port) {
+    this->reverse_api_port = reverse_api_port;
+    this->m_reverse_api_port_isSet = true;
+}
+
+qint32
+SWGShmInputSettings::getReverseApiDeviceIndex() {
+    return reverse_api_device_index;
+}
+void
+SWGShmInputSettings::setReverseApiDeviceIndex(qint32 reverse_api_device_index) {
+    this->reverse_api_device_index = reverse_api_device_index;
+    this->m_reverse_api_device_index_isSet = true;
+}
+
+
+bool
+SWGShmInputSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(shm_name && *shm_name != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_dc_block_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_iq_correction_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_use_reverse_api_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(reverse_api_address && *reverse_api_address != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_port_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_device_index_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
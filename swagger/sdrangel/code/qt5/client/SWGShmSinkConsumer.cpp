@@ -0,0 +1,177 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGShmSinkConsumer.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGShmSinkConsumer::SWGShmSinkConsumer(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGShmSinkConsumer::SWGShmSinkConsumer() {
+    index = 0;
+    m_index_isSet = false;
+    lag_samples = 0L;
+    m_lag_samples_isSet = false;
+    lag_ms = 0.0f;
+    m_lag_ms_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
+}
+
+SWGShmSinkConsumer::~SWGShmSinkConsumer() {
+    this->cleanup();
+}
+
+void
+SWGShmSinkConsumer::init() {
+    index = 0;
+    m_index_isSet = false;
+    lag_samples = 0L;
+    m_lag_samples_isSet = false;
+    lag_ms = 0.0f;
+    m_lag_ms_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
+}
+
+void
+SWGShmSinkConsumer::cleanup() {
+
+
+
+
+}
+
+SWGShmSinkConsumer*
+SWGShmSinkConsumer::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGShmSinkConsumer::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&index, pJson["index"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lag_samples, pJson["lagSamples"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&lag_ms, pJson["lagMs"], "float", "");
+    
+    ::SWGSDRangel::setValue(&dropped_samples, pJson["droppedSamples"], "qint64", "");
+    
+}
+
+QString
+SWGShmSinkConsumer::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGShmSinkConsumer::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_index_isSet){
+        obj->insert("index", QJsonValue(index));
+    }
+    if(m_lag_samples_isSet){
+        obj->insert("lagSamples", QJsonValue(lag_samples));
+    }
+    if(m_lag_ms_isSet){
+        obj->insert("lagMs", QJsonValue(lag_ms));
+    }
+    if(m_dropped_samples_isSet){
+        obj->insert("droppedSamples", QJsonValue(dropped_samples));
+    }
+
+    return obj;
+}
+
+qint32
+SWGShmSinkConsumer::getIndex() {
+    return index;
+}
+void
+SWGShmSinkConsumer::setIndex(qint32 index) {
+    this->index = index;
+    this->m_index_isSet = true;
+}
+
+qint64
+SWGShmSinkConsumer::getLagSamples() {
+    return lag_samples;
+}
+void
+SWGShmSinkConsumer::setLagSamples(qint64 lag_samples) {
+    this->lag_samples = lag_samples;
+    this->m_lag_samples_isSet = true;
+}
+
+float
+SWGShmSinkConsumer::getLagMs() {
+    return lag_ms;
+}
+void
+SWGShmSinkConsumer::setLagMs(float lag_ms) {
+    this->lag_ms = lag_ms;
+    this->m_lag_ms_isSet = true;
+}
+
+qint64
+SWGShmSinkConsumer::getDroppedSamples() {
+    return dropped_samples;
+}
+void
+SWGShmSinkConsumer::setDroppedSamples(qint64 dropped_samples) {
+    this->dropped_samples = dropped_samples;
+    this->m_dropped_samples_isSet = true;
+}
+
+
+bool
+SWGShmSinkConsumer::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lag_samples_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lag_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_dropped_samples_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
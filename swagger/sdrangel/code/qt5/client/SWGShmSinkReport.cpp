@@ -0,0 +1,160 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGShmSinkReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGShmSinkReport::SWGShmSinkReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGShmSinkReport::SWGShmSinkReport() {
+    channel_sample_rate = 0;
+    m_channel_sample_rate_isSet = false;
+    nb_consumers = 0;
+    m_nb_consumers_isSet = false;
+    consumers = nullptr;
+    m_consumers_isSet = false;
+}
+
+SWGShmSinkReport::~SWGShmSinkReport() {
+    this->cleanup();
+}
+
+void
+SWGShmSinkReport::init() {
+    channel_sample_rate = 0;
+    m_channel_sample_rate_isSet = false;
+    nb_consumers = 0;
+    m_nb_consumers_isSet = false;
+    consumers = new QList<SWGShmSinkConsumer*>();
+    m_consumers_isSet = false;
+}
+
+void
+SWGShmSinkReport::cleanup() {
+
+
+    if(consumers != nullptr) { 
+        auto arr = consumers;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete consumers;
+    }
+}
+
+SWGShmSinkReport*
+SWGShmSinkReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGShmSinkReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&channel_sample_rate, pJson["channelSampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_consumers, pJson["nbConsumers"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&consumers, pJson["consumers"], "QList", "SWGShmSinkConsumer");
+}
+
+QString
+SWGShmSinkReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGShmSinkReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_channel_sample_rate_isSet){
+        obj->insert("channelSampleRate", QJsonValue(channel_sample_rate));
+    }
+    if(m_nb_consumers_isSet){
+        obj->insert("nbConsumers", QJsonValue(nb_consumers));
+    }
+    if(consumers && consumers->size() > 0){
+        toJsonArray((QList<void*>*)consumers, obj, "consumers", "SWGShmSinkConsumer");
+    }
+
+    return obj;
+}
+
+qint32
+SWGShmSinkReport::getChannelSampleRate() {
+    return channel_sample_rate;
+}
+void
+SWGShmSinkReport::setChannelSampleRate(qint32 channel_sample_rate) {
+    this->channel_sample_rate = channel_sample_rate;
+    this->m_channel_sample_rate_isSet = true;
+}
+
+qint32
+SWGShmSinkReport::getNbConsumers() {
+    return nb_consumers;
+}
+void
+SWGShmSinkReport::setNbConsumers(qint32 nb_consumers) {
+    this->nb_consumers = nb_consumers;
+    this->m_nb_consumers_isSet = true;
+}
+
+QList<SWGShmSinkConsumer*>*
+SWGShmSinkReport::getConsumers() {
+    return consumers;
+}
+void
+SWGShmSinkReport::setConsumers(QList<SWGShmSinkConsumer*>* consumers) {
+    this->consumers = consumers;
+    this->m_consumers_isSet = true;
+}
+
+
+bool
+SWGShmSinkReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_channel_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_consumers_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(consumers && (consumers->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,390 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGShmSinkSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGShmSinkSettings::SWGShmSinkSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGShmSinkSettings::SWGShmSinkSettings() {
+    shm_name = nullptr;
+    m_shm_name_isSet = false;
+    ring_size_ms = 0;
+    m_ring_size_ms_isSet = false;
+    rgb_color = 0;
+    m_rgb_color_isSet = false;
+    title = nullptr;
+    m_title_isSet = false;
+    log2_decim = 0;
+    m_log2_decim_isSet = false;
+    filter_chain_hash = 0;
+    m_filter_chain_hash_isSet = false;
+    play = 0;
+    m_play_isSet = false;
+    stream_index = 0;
+    m_stream_index_isSet = false;
+    use_reverse_api = 0;
+    m_use_reverse_api_isSet = false;
+    reverse_api_address = nullptr;
+    m_reverse_api_address_isSet = false;
+    reverse_api_port = 0;
+    m_reverse_api_port_isSet = false;
+    reverse_api_device_index = 0;
+    m_reverse_api_device_index_isSet = false;
+    reverse_api_channel_index = 0;
+    m_reverse_api_channel_index_isSet = false;
+}
+
+SWGShmSinkSettings::~SWGShmSinkSettings() {
+    this->cleanup();
+}
+
+void
+SWGShmSinkSettings::init() {
+    shm_name = new QString("");
+    m_shm_name_isSet = false;
+    ring_size_ms = 0;
+    m_ring_size_ms_isSet = false;
+    rgb_color = 0;
+    m_rgb_color_isSet = false;
+    title = new QString("");
+    m_title_isSet = false;
+    log2_decim = 0;
+    m_log2_decim_isSet = false;
+    filter_chain_hash = 0;
+    m_filter_chain_hash_isSet = false;
+    play = 0;
+    m_play_isSet = false;
+    stream_index = 0;
+    m_stream_index_isSet = false;
+    use_reverse_api = 0;
+    m_use_reverse_api_isSet = false;
+    reverse_api_address = new QString("");
+    m_reverse_api_address_isSet = false;
+    reverse_api_port = 0;
+    m_reverse_api_port_isSet = false;
+    reverse_api_device_index = 0;
+    m_reverse_api_device_index_isSet = false;
+    reverse_api_channel_index = 0;
+    m_reverse_api_channel_index_isSet = false;
+}
+
+void
+SWGShmSinkSettings::cleanup() {
+    if(shm_name != nullptr) { 
+        delete shm_name;
+    }
+
+
+    if(title != nullptr) { 
+        delete title;
+    }
+
+
+
+
+
+    if(reverse_api_address != nullptr) { 
+        delete reverse_api_address;
+    }
+
+
+
+}
+
+SWGShmSinkSettings*
+SWGShmSinkSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGShmSinkSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&shm_name, pJson["shmName"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&ring_size_ms, pJson["ringSizeMs"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&title, pJson["title"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&log2_decim, pJson["log2Decim"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&filter_chain_hash, pJson["filterChainHash"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&play, pJson["play"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&stream_index, pJson["streamIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&reverse_api_port, pJson["reverseAPIPort"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_device_index, pJson["reverseAPIDeviceIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_channel_index, pJson["reverseAPIChannelIndex"], "qint32", "");
+    
+}
+
+QString
+SWGShmSinkSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGShmSinkSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(shm_name != nullptr && *shm_name != QString("")){
+        toJsonValue(QString("shmName"), shm_name, obj, QString("QString"));
+    }
+    if(m_ring_size_ms_isSet){
+        obj->insert("ringSizeMs", QJsonValue(ring_size_ms));
+    }
+    if(m_rgb_color_isSet){
+        obj->insert("rgbColor", QJsonValue(rgb_color));
+    }
+    if(title != nullptr && *title != QString("")){
+        toJsonValue(QString("title"), title, obj, QString("QString"));
+    }
+    if(m_log2_decim_isSet){
+        obj->insert("log2Decim", QJsonValue(log2_decim));
+    }
+    if(m_filter_chain_hash_isSet){
+        obj->insert("filterChainHash", QJsonValue(filter_chain_hash));
+    }
+    if(m_play_isSet){
+        obj->insert("play", QJsonValue(play));
+    }
+    if(m_stream_index_isSet){
+        obj->insert("streamIndex", QJsonValue(stream_index));
+    }
+    if(m_use_reverse_api_isSet){
+        obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
+    }
+    if(reverse_api_address != nullptr && *reverse_api_address != QString("")){
+        toJsonValue(QString("reverseAPIAddress"), reverse_api_address, obj, QString("QString"));
+    }
+    if(m_reverse_api_port_isSet){
+        obj->insert("reverseAPIPort", QJsonValue(reverse_api_port));
+    }
+    if(m_reverse_api_device_index_isSet){
+        obj->insert("reverseAPIDeviceIndex", QJsonValue(reverse_api_device_index));
+    }
+    if(m_reverse_api_channel_index_isSet){
+        obj->insert("reverseAPIChannelIndex", QJsonValue(reverse_api_channel_index));
+    }
+
+    return obj;
+}
+
+QString*
+SWGShmSinkSettings::getShmName() {
+    return shm_name;
+}
+void
+SWGShmSinkSettings::setShmName(QString* shm_name) {
+    this->shm_name = shm_name;
+    this->m_shm_name_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getRingSizeMs() {
+    return ring_size_ms;
+}
+void
+SWGShmSinkSettings::setRingSizeMs(qint32 ring_size_ms) {
+    this->ring_size_ms = ring_size_ms;
+    this->m_ring_size_ms_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getRgbColor() {
+    return rgb_color;
+}
+void
+SWGShmSinkSettings::setRgbColor(qint32 rgb_color) {
+    this->rgb_color = rgb_color;
+    this->m_rgb_color_isSet = true;
+}
+
+QString*
+SWGShmSinkSettings::getTitle() {
+    return title;
+}
+void
+SWGShmSinkSettings::setTitle(QString* title) {
+    this->title = title;
+    this->m_title_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getLog2Decim() {
+    return log2_decim;
+}
+void
+SWGShmSinkSettings::setLog2Decim(qint32 log2_decim) {
+    this->log2_decim = log2_decim;
+    this->m_log2_decim_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getFilterChainHash() {
+    return filter_chain_hash;
+}
+void
+SWGShmSinkSettings::setFilterChainHash(qint32 filter_chain_hash) {
+    this->filter_chain_hash = filter_chain_hash;
+    this->m_filter_chain_hash_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getPlay() {
+    return play;
+}
+void
+SWGShmSinkSettings::setPlay(qint32 play) {
+    this->play = play;
+    this->m_play_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getStreamIndex() {
+    return stream_index;
+}
+void
+SWGShmSinkSettings::setStreamIndex(qint32 stream_index) {
+    this->stream_index = stream_index;
+    this->m_stream_index_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getUseReverseApi() {
+    return use_reverse_api;
+}
+void
+SWGShmSinkSettings::setUseReverseApi(qint32 use_reverse_api) {
+    this->use_reverse_api = use_reverse_api;
+    this->m_use_reverse_api_isSet = true;
+}
+
+QString*
+SWGShmSinkSettings::getReverseApiAddress() {
+    return reverse_api_address;
+}
+void
+SWGShmSinkSettings::setReverseApiAddress(QString* reverse_api_address) {
+    this->reverse_api_address = reverse_api_address;
+    this->m_reverse_api_address_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getReverseApiPort() {
+    return reverse_api_port;
+}
+void
+SWGShmSinkSettings::setReverseApiPort(qint32 reverse_api_port) {
+    this->reverse_api_port = reverse_api_port;
+    this->m_reverse_api_port_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getReverseApiDeviceIndex() {
+    return reverse_api_device_index;
+}
+void
+SWGShmSinkSettings::setReverseApiDeviceIndex(qint32 reverse_api_device_index) {
+    this->reverse_api_device_index = reverse_api_device_index;
+    this->m_reverse_api_device_index_isSet = true;
+}
+
+qint32
+SWGShmSinkSettings::getReverseApiChannelIndex() {
+    return reverse_api_channel_index;
+}
+void
+SWGShmSinkSettings::setReverseApiChannelIndex(qint32 reverse_api_channel_index) {
+    this->reverse_api_channel_index = reverse_api_channel_index;
+    this->m_reverse_api_channel_index_isSet = true;
+}
+
+
+bool
+SWGShmSinkSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(shm_name && *shm_name != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_ring_size_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rgb_color_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(title && *title != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_log2_decim_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_filter_chain_hash_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_play_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_stream_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_use_reverse_api_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(reverse_api_address && *reverse_api_address != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_port_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_device_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_channel_index_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -36,6 +36,14 @@ SWGUDPSinkReport::SWGUDPSinkReport() {
     m_squelch_isSet = false;
     input_sample_rate = 0;
     m_input_sample_rate_isSet = false;
+    nb_destinations = 0;
+    m_nb_destinations_isSet = false;
+    datagrams_sent = 0L;
+    m_datagrams_sent_isSet = false;
+    datagrams_dropped = 0L;
+    m_datagrams_dropped_isSet = false;
+    throughput = 0.0f;
+    m_throughput_isSet = false;
 }
 
 SWGUDPSinkReport::~SWGUDPSinkReport() {
@@ -52,6 +60,14 @@ SWGUDPSinkReport::init() {
     m_squelch_isSet = false;
     input_sample_rate = 0;
     m_input_sample_rate_isSet = false;
+    nb_destinations = 0;
+    m_nb_destinations_isSet = false;
+    datagrams_sent = 0L;
+    m_datagrams_sent_isSet = false;
+    datagrams_dropped = 0L;
+    m_datagrams_dropped_isSet = false;
+    throughput = 0.0f;
+    m_throughput_isSet = false;
 }
 
 void
@@ -60,6 +76,10 @@ SWGUDPSinkReport::cleanup() {
 
 
 
+
+
+
+
 }
 
 SWGUDPSinkReport*
@@ -81,6 +101,14 @@ SWGUDPSinkReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&input_sample_rate, pJson["inputSampleRate"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&nb_destinations, pJson["nbDestinations"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&datagrams_sent, pJson["datagramsSent"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&datagrams_dropped, pJson["datagramsDropped"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&throughput, pJson["throughput"], "float", "");
+    
 }
 
 QString
@@ -109,6 +137,18 @@ SWGUDPSinkReport::asJsonObject() {
     if(m_input_sample_rate_isSet){
         obj->insert("inputSampleRate", QJsonValue(input_sample_rate));
     }
+    if(m_nb_destinations_isSet){
+        obj->insert("nbDestinations", QJsonValue(nb_destinations));
+    }
+    if(m_datagrams_sent_isSet){
+        obj->insert("datagramsSent", QJsonValue(datagrams_sent));
+    }
+    if(m_datagrams_dropped_isSet){
+        obj->insert("datagramsDropped", QJsonValue(datagrams_dropped));
+    }
+    if(m_throughput_isSet){
+        obj->insert("throughput", QJsonValue(throughput));
+    }
 
     return obj;
 }
@@ -153,6 +193,46 @@ SWGUDPSinkReport::setInputSampleRate(qint32 input_sample_rate) {
     this->m_input_sample_rate_isSet = true;
 }
 
+qint32
+SWGUDPSinkReport::getNbDestinations() {
+    return nb_destinations;
+}
+void
+SWGUDPSinkReport::setNbDestinations(qint32 nb_destinations) {
+    this->nb_destinations = nb_destinations;
+    this->m_nb_destinations_isSet = true;
+}
+
+qint64
+SWGUDPSinkReport::getDatagramsSent() {
+    return datagrams_sent;
+}
+void
+SWGUDPSinkReport::setDatagramsSent(qint64 datagrams_sent) {
+    this->datagrams_sent = datagrams_sent;
+    this->m_datagrams_sent_isSet = true;
+}
+
+qint64
+SWGUDPSinkReport::getDatagramsDropped() {
+    return datagrams_dropped;
+}
+void
+SWGUDPSinkReport::setDatagramsDropped(qint64 datagrams_dropped) {
+    this->datagrams_dropped = datagrams_dropped;
+    this->m_datagrams_dropped_isSet = true;
+}
+
+float
+SWGUDPSinkReport::getThroughput() {
+    return throughput;
+}
+void
+SWGUDPSinkReport::setThroughput(float throughput) {
+    this->throughput = throughput;
+    this->m_throughput_isSet = true;
+}
+
 
 bool
 SWGUDPSinkReport::isSet(){
@@ -170,6 +250,18 @@ SWGUDPSinkReport::isSet(){
         if(m_input_sample_rate_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_nb_destinations_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_datagrams_sent_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_datagrams_dropped_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_throughput_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
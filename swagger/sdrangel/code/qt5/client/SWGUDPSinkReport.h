@@ -21,8 +21,6 @@
 
 #include <QJsonObject>
 
-
-
 #include "SWGObject.h"
 #include "export.h"
 
@@ -53,6 +51,18 @@ public:
     qint32 getInputSampleRate();
     void setInputSampleRate(qint32 input_sample_rate);
 
+    qint32 getNbDestinations();
+    void setNbDestinations(qint32 nb_destinations);
+
+    qint64 getDatagramsSent();
+    void setDatagramsSent(qint64 datagrams_sent);
+
+    qint64 getDatagramsDropped();
+    void setDatagramsDropped(qint64 datagrams_dropped);
+
+    float getThroughput();
+    void setThroughput(float throughput);
+
 
     virtual bool isSet() override;
 
@@ -69,6 +79,18 @@ private:
     qint32 input_sample_rate;
     bool m_input_sample_rate_isSet;
 
+    qint32 nb_destinations;
+    bool m_nb_destinations_isSet;
+
+    qint64 datagrams_sent;
+    bool m_datagrams_sent_isSet;
+
+    qint64 datagrams_dropped;
+    bool m_datagrams_dropped_isSet;
+
+    float throughput;
+    bool m_throughput_isSet;
+
 };
 
 }
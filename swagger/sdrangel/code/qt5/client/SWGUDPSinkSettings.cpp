@@ -78,6 +78,12 @@ SWGUDPSinkSettings::SWGUDPSinkSettings() {
     m_reverse_api_device_index_isSet = false;
     reverse_api_channel_index = 0;
     m_reverse_api_channel_index_isSet = false;
+    udp_destinations = nullptr;
+    m_udp_destinations_isSet = false;
+    multicast_ttl = 0;
+    m_multicast_ttl_isSet = false;
+    rtp = 0;
+    m_rtp_isSet = false;
 }
 
 SWGUDPSinkSettings::~SWGUDPSinkSettings() {
@@ -136,6 +142,12 @@ SWGUDPSinkSettings::init() {
     m_reverse_api_device_index_isSet = false;
     reverse_api_channel_index = 0;
     m_reverse_api_channel_index_isSet = false;
+    udp_destinations = new QString("");
+    m_udp_destinations_isSet = false;
+    multicast_ttl = 0;
+    m_multicast_ttl_isSet = false;
+    rtp = 0;
+    m_rtp_isSet = false;
 }
 
 void
@@ -171,6 +183,11 @@ SWGUDPSinkSettings::cleanup() {
 
 
 
+    if(udp_destinations != nullptr) { 
+        delete udp_destinations;
+    }
+
+
 }
 
 SWGUDPSinkSettings*
@@ -234,6 +251,12 @@ SWGUDPSinkSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&reverse_api_channel_index, pJson["reverseAPIChannelIndex"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&udp_destinations, pJson["udpDestinations"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&multicast_ttl, pJson["multicastTTL"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rtp, pJson["rtp"], "qint32", "");
+    
 }
 
 QString
@@ -325,6 +348,15 @@ SWGUDPSinkSettings::asJsonObject() {
     if(m_reverse_api_channel_index_isSet){
         obj->insert("reverseAPIChannelIndex", QJsonValue(reverse_api_channel_index));
     }
+    if(udp_destinations != nullptr && *udp_destinations != QString("")){
+        toJsonValue(QString("udpDestinations"), udp_destinations, obj, QString("QString"));
+    }
+    if(m_multicast_ttl_isSet){
+        obj->insert("multicastTTL", QJsonValue(multicast_ttl));
+    }
+    if(m_rtp_isSet){
+        obj->insert("rtp", QJsonValue(rtp));
+    }
 
     return obj;
 }
@@ -579,6 +611,36 @@ SWGUDPSinkSettings::setReverseApiChannelIndex(qint32 reverse_api_channel_index)
     this->m_reverse_api_channel_index_isSet = true;
 }
 
+QString*
+SWGUDPSinkSettings::getUdpDestinations() {
+    return udp_destinations;
+}
+void
+SWGUDPSinkSettings::setUdpDestinations(QString* udp_destinations) {
+    this->udp_destinations = udp_destinations;
+    this->m_udp_destinations_isSet = true;
+}
+
+qint32
+SWGUDPSinkSettings::getMulticastTtl() {
+    return multicast_ttl;
+}
+void
+SWGUDPSinkSettings::setMulticastTtl(qint32 multicast_ttl) {
+    this->multicast_ttl = multicast_ttl;
+    this->m_multicast_ttl_isSet = true;
+}
+
+qint32
+SWGUDPSinkSettings::getRtp() {
+    return rtp;
+}
+void
+SWGUDPSinkSettings::setRtp(qint32 rtp) {
+    this->rtp = rtp;
+    this->m_rtp_isSet = true;
+}
+
 
 bool
 SWGUDPSinkSettings::isSet(){
@@ -659,6 +721,15 @@ SWGUDPSinkSettings::isSet(){
         if(m_reverse_api_channel_index_isSet){
             isObjectUpdated = true; break;
         }
+        if(udp_destinations && *udp_destinations != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_multicast_ttl_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rtp_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -117,6 +117,15 @@ public:
     qint32 getReverseApiChannelIndex();
     void setReverseApiChannelIndex(qint32 reverse_api_channel_index);
 
+    QString* getUdpDestinations();
+    void setUdpDestinations(QString* udp_destinations);
+
+    qint32 getMulticastTtl();
+    void setMulticastTtl(qint32 multicast_ttl);
+
+    qint32 getRtp();
+    void setRtp(qint32 rtp);
+
 
     virtual bool isSet() override;
 
@@ -196,6 +205,15 @@ private:
     qint32 reverse_api_channel_index;
     bool m_reverse_api_channel_index_isSet;
 
+    QString* udp_destinations;
+    bool m_udp_destinations_isSet;
+
+    qint32 multicast_ttl;
+    bool m_multicast_ttl_isSet;
+
+    qint32 rtp;
+    bool m_rtp_isSet;
+
 };
 
 }
@@ -38,6 +38,16 @@ SWGUDPSourceReport::SWGUDPSourceReport() {
     m_buffer_gauge_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    buffer_depth = 0.0f;
+    m_buffer_depth_isSet = false;
+    late_packets = 0;
+    m_late_packets_isSet = false;
+    lost_packets = 0;
+    m_lost_packets_isSet = false;
+    underruns = 0;
+    m_underruns_isSet = false;
+    rate_correction = 0.0f;
+    m_rate_correction_isSet = false;
 }
 
 SWGUDPSourceReport::~SWGUDPSourceReport() {
@@ -56,6 +66,16 @@ SWGUDPSourceReport::init() {
     m_buffer_gauge_isSet = false;
     channel_sample_rate = 0;
     m_channel_sample_rate_isSet = false;
+    buffer_depth = 0.0f;
+    m_buffer_depth_isSet = false;
+    late_packets = 0;
+    m_late_packets_isSet = false;
+    lost_packets = 0;
+    m_lost_packets_isSet = false;
+    underruns = 0;
+    m_underruns_isSet = false;
+    rate_correction = 0.0f;
+    m_rate_correction_isSet = false;
 }
 
 void
@@ -65,6 +85,11 @@ SWGUDPSourceReport::cleanup() {
 
 
 
+
+
+
+
+
 }
 
 SWGUDPSourceReport*
@@ -88,6 +113,16 @@ SWGUDPSourceReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&channel_sample_rate, pJson["channelSampleRate"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&buffer_depth, pJson["bufferDepth"], "float", "");
+    
+    ::SWGSDRangel::setValue(&late_packets, pJson["latePackets"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lost_packets, pJson["lostPackets"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&underruns, pJson["underruns"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rate_correction, pJson["rateCorrection"], "float", "");
+    
 }
 
 QString
@@ -119,6 +154,21 @@ SWGUDPSourceReport::asJsonObject() {
     if(m_channel_sample_rate_isSet){
         obj->insert("channelSampleRate", QJsonValue(channel_sample_rate));
     }
+    if(m_buffer_depth_isSet){
+        obj->insert("bufferDepth", QJsonValue(buffer_depth));
+    }
+    if(m_late_packets_isSet){
+        obj->insert("latePackets", QJsonValue(late_packets));
+    }
+    if(m_lost_packets_isSet){
+        obj->insert("lostPackets", QJsonValue(lost_packets));
+    }
+    if(m_underruns_isSet){
+        obj->insert("underruns", QJsonValue(underruns));
+    }
+    if(m_rate_correction_isSet){
+        obj->insert("rateCorrection", QJsonValue(rate_correction));
+    }
 
     return obj;
 }
@@ -173,6 +223,56 @@ SWGUDPSourceReport::setChannelSampleRate(qint32 channel_sample_rate) {
     this->m_channel_sample_rate_isSet = true;
 }
 
+float
+SWGUDPSourceReport::getBufferDepth() {
+    return buffer_depth;
+}
+void
+SWGUDPSourceReport::setBufferDepth(float buffer_depth) {
+    this->buffer_depth = buffer_depth;
+    this->m_buffer_depth_isSet = true;
+}
+
+qint32
+SWGUDPSourceReport::getLatePackets() {
+    return late_packets;
+}
+void
+SWGUDPSourceReport::setLatePackets(qint32 late_packets) {
+    this->late_packets = late_packets;
+    this->m_late_packets_isSet = true;
+}
+
+qint32
+SWGUDPSourceReport::getLostPackets() {
+    return lost_packets;
+}
+void
+SWGUDPSourceReport::setLostPackets(qint32 lost_packets) {
+    this->lost_packets = lost_packets;
+    this->m_lost_packets_isSet = true;
+}
+
+qint32
+SWGUDPSourceReport::getUnderruns() {
+    return underruns;
+}
+void
+SWGUDPSourceReport::setUnderruns(qint32 underruns) {
+    this->underruns = underruns;
+    this->m_underruns_isSet = true;
+}
+
+float
+SWGUDPSourceReport::getRateCorrection() {
+    return rate_correction;
+}
+void
+SWGUDPSourceReport::setRateCorrection(float rate_correction) {
+    this->rate_correction = rate_correction;
+    this->m_rate_correction_isSet = true;
+}
+
 
 bool
 SWGUDPSourceReport::isSet(){
@@ -193,6 +293,21 @@ SWGUDPSourceReport::isSet(){
         if(m_channel_sample_rate_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_buffer_depth_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_late_packets_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lost_packets_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_underruns_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rate_correction_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
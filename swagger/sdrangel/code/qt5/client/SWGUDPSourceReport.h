@@ -21,8 +21,6 @@
 
 #include <QJsonObject>
 
-
-
 #include "SWGObject.h"
 #include "export.h"
 
@@ -56,6 +54,21 @@ public:
     qint32 getChannelSampleRate();
     void setChannelSampleRate(qint32 channel_sample_rate);
 
+    float getBufferDepth();
+    void setBufferDepth(float buffer_depth);
+
+    qint32 getLatePackets();
+    void setLatePackets(qint32 late_packets);
+
+    qint32 getLostPackets();
+    void setLostPackets(qint32 lost_packets);
+
+    qint32 getUnderruns();
+    void setUnderruns(qint32 underruns);
+
+    float getRateCorrection();
+    void setRateCorrection(float rate_correction);
+
 
     virtual bool isSet() override;
 
@@ -75,6 +88,21 @@ private:
     qint32 channel_sample_rate;
     bool m_channel_sample_rate_isSet;
 
+    float buffer_depth;
+    bool m_buffer_depth_isSet;
+
+    qint32 late_packets;
+    bool m_late_packets_isSet;
+
+    qint32 lost_packets;
+    bool m_lost_packets_isSet;
+
+    qint32 underruns;
+    bool m_underruns_isSet;
+
+    float rate_correction;
+    bool m_rate_correction_isSet;
+
 };
 
 }
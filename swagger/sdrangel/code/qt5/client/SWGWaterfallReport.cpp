@@ -0,0 +1,231 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGWaterfallReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGWaterfallReport::SWGWaterfallReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGWaterfallReport::SWGWaterfallReport() {
+    session = nullptr;
+    m_session_isSet = false;
+    nb_lines = 0L;
+    m_nb_lines_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    zoom_levels = nullptr;
+    m_zoom_levels_isSet = false;
+}
+
+SWGWaterfallReport::~SWGWaterfallReport() {
+    this->cleanup();
+}
+
+void
+SWGWaterfallReport::init() {
+    session = new QString("");
+    m_session_isSet = false;
+    nb_lines = 0L;
+    m_nb_lines_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    zoom_levels = new QList<SWGWaterfallZoomLevel*>();
+    m_zoom_levels_isSet = false;
+}
+
+void
+SWGWaterfallReport::cleanup() {
+    if(session != nullptr) { 
+        delete session;
+    }
+
+
+
+
+    if(zoom_levels != nullptr) { 
+        auto arr = zoom_levels;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete zoom_levels;
+    }
+}
+
+SWGWaterfallReport*
+SWGWaterfallReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGWaterfallReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&session, pJson["session"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&nb_lines, pJson["nbLines"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&center_frequency, pJson["centerFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fft_size, pJson["fftSize"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&zoom_levels, pJson["zoomLevels"], "QList", "SWGWaterfallZoomLevel");
+}
+
+QString
+SWGWaterfallReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGWaterfallReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(session != nullptr && *session != QString("")){
+        toJsonValue(QString("session"), session, obj, QString("QString"));
+    }
+    if(m_nb_lines_isSet){
+        obj->insert("nbLines", QJsonValue(nb_lines));
+    }
+    if(m_center_frequency_isSet){
+        obj->insert("centerFrequency", QJsonValue(center_frequency));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_fft_size_isSet){
+        obj->insert("fftSize", QJsonValue(fft_size));
+    }
+    if(zoom_levels && zoom_levels->size() > 0){
+        toJsonArray((QList<void*>*)zoom_levels, obj, "zoomLevels", "SWGWaterfallZoomLevel");
+    }
+
+    return obj;
+}
+
+QString*
+SWGWaterfallReport::getSession() {
+    return session;
+}
+void
+SWGWaterfallReport::setSession(QString* session) {
+    this->session = session;
+    this->m_session_isSet = true;
+}
+
+qint64
+SWGWaterfallReport::getNbLines() {
+    return nb_lines;
+}
+void
+SWGWaterfallReport::setNbLines(qint64 nb_lines) {
+    this->nb_lines = nb_lines;
+    this->m_nb_lines_isSet = true;
+}
+
+qint64
+SWGWaterfallReport::getCenterFrequency() {
+    return center_frequency;
+}
+void
+SWGWaterfallReport::setCenterFrequency(qint64 center_frequency) {
+    this->center_frequency = center_frequency;
+    this->m_center_frequency_isSet = true;
+}
+
+qint32
+SWGWaterfallReport::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGWaterfallReport::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+qint32
+SWGWaterfallReport::getFftSize() {
+    return fft_size;
+}
+void
+SWGWaterfallReport::setFftSize(qint32 fft_size) {
+    this->fft_size = fft_size;
+    this->m_fft_size_isSet = true;
+}
+
+QList<SWGWaterfallZoomLevel*>*
+SWGWaterfallReport::getZoomLevels() {
+    return zoom_levels;
+}
+void
+SWGWaterfallReport::setZoomLevels(QList<SWGWaterfallZoomLevel*>* zoom_levels) {
+    this->zoom_levels = zoom_levels;
+    this->m_zoom_levels_isSet = true;
+}
+
+
+bool
+SWGWaterfallReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(session && *session != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_lines_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_center_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fft_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(zoom_levels && (zoom_levels->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
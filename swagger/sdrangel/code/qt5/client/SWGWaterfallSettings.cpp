@@ -0,0 +1,317 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGWaterfallSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGWaterfallSettings::SWGWaterfallSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGWaterfallSettings::SWGWaterfallSettings() {
+    enabled = 0;
+    m_enabled_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    line_rate = 0.0f;
+    m_line_rate_isSet = false;
+    min_level = 0.0f;
+    m_min_level_isSet = false;
+    max_level = 0.0f;
+    m_max_level_isSet = false;
+    tile_lines = 0;
+    m_tile_lines_isSet = false;
+    tile_bins = 0;
+    m_tile_bins_isSet = false;
+    nb_zoom_levels = 0;
+    m_nb_zoom_levels_isSet = false;
+    memory_tiles = 0;
+    m_memory_tiles_isSet = false;
+    directory = nullptr;
+    m_directory_isSet = false;
+}
+
+SWGWaterfallSettings::~SWGWaterfallSettings() {
+    this->cleanup();
+}
+
+void
+SWGWaterfallSettings::init() {
+    enabled = 0;
+    m_enabled_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    line_rate = 0.0f;
+    m_line_rate_isSet = false;
+    min_level = 0.0f;
+    m_min_level_isSet = false;
+    max_level = 0.0f;
+    m_max_level_isSet = false;
+    tile_lines = 0;
+    m_tile_lines_isSet = false;
+    tile_bins = 0;
+    m_tile_bins_isSet = false;
+    nb_zoom_levels = 0;
+    m_nb_zoom_levels_isSet = false;
+    memory_tiles = 0;
+    m_memory_tiles_isSet = false;
+    directory = new QString("");
+    m_directory_isSet = false;
+}
+
+void
+SWGWaterfallSettings::cleanup() {
+
+
+
+
+
+
+
+
+
+    if(directory != nullptr) { 
+        delete directory;
+    }
+}
+
+SWGWaterfallSettings*
+SWGWaterfallSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGWaterfallSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&enabled, pJson["enabled"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fft_size, pJson["fftSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&line_rate, pJson["lineRate"], "float", "");
+    
+    ::SWGSDRangel::setValue(&min_level, pJson["minLevel"], "float", "");
+    
+    ::SWGSDRangel::setValue(&max_level, pJson["maxLevel"], "float", "");
+    
+    ::SWGSDRangel::setValue(&tile_lines, pJson["tileLines"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&tile_bins, pJson["tileBins"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&nb_zoom_levels, pJson["nbZoomLevels"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&memory_tiles, pJson["memoryTiles"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&directory, pJson["directory"], "QString", "QString");
+    
+}
+
+QString
+SWGWaterfallSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGWaterfallSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_enabled_isSet){
+        obj->insert("enabled", QJsonValue(enabled));
+    }
+    if(m_fft_size_isSet){
+        obj->insert("fftSize", QJsonValue(fft_size));
+    }
+    if(m_line_rate_isSet){
+        obj->insert("lineRate", QJsonValue(line_rate));
+    }
+    if(m_min_level_isSet){
+        obj->insert("minLevel", QJsonValue(min_level));
+    }
+    if(m_max_level_isSet){
+        obj->insert("maxLevel", QJsonValue(max_level));
+    }
+    if(m_tile_lines_isSet){
+        obj->insert("tileLines", QJsonValue(tile_lines));
+    }
+    if(m_tile_bins_isSet){
+        obj->insert("tileBins", QJsonValue(tile_bins));
+    }
+    if(m_nb_zoom_levels_isSet){
+        obj->insert("nbZoomLevels", QJsonValue(nb_zoom_levels));
+    }
+    if(m_memory_tiles_isSet){
+        obj->insert("memoryTiles", QJsonValue(memory_tiles));
+    }
+    if(directory != nullptr && *directory != QString("")){
+        toJsonValue(QString("directory"), directory, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGWaterfallSettings::getEnabled() {
+    return enabled;
+}
+void
+SWGWaterfallSettings::setEnabled(qint32 enabled) {
+    this->enabled = enabled;
+    this->m_enabled_isSet = true;
+}
+
+qint32
+SWGWaterfallSettings::getFftSize() {
+    return fft_size;
+}
+void
+SWGWaterfallSettings::setFftSize(qint32 fft_size) {
+    this->fft_size = fft_size;
+    this->m_fft_size_isSet = true;
+}
+
+float
+SWGWaterfallSettings::getLineRate() {
+    return line_rate;
+}
+void
+SWGWaterfallSettings::setLineRate(float line_rate) {
+    this->line_rate = line_rate;
+    this->m_line_rate_isSet = true;
+}
+
+float
+SWGWaterfallSettings::getMinLevel() {
+    return min_level;
+}
+void
+SWGWaterfallSettings::setMinLevel(float min_level) {
+    this->min_level = min_level;
+    this->m_min_level_isSet = true;
+}
+
+float
+SWGWaterfallSettings::getMaxLevel() {
+    return max_level;
+}
+void
+SWGWaterfallSettings::setMaxLevel(float max_level) {
+    this->max_level = max_level;
+    this->m_max_level_isSet = true;
+}
+
+qint32
+SWGWaterfallSettings::getTileLines() {
+    return tile_lines;
+}
+void
+SWGWaterfallSettings::setTileLines(qint32 tile_lines) {
+    this->tile_lines = tile_lines;
+    this->m_tile_lines_isSet = true;
+}
+
+qint32
+SWGWaterfallSettings::getTileBins() {
+    return tile_bins;
+}
+void
+SWGWaterfallSettings::setTileBins(qint32 tile_bins) {
+    this->tile_bins = tile_bins;
+    this->m_tile_bins_isSet = true;
+}
+
+qint32
+SWGWaterfallSettings::getNbZoomLevels() {
+    return nb_zoom_levels;
+}
+void
+SWGWaterfallSettings::setNbZoomLevels(qint32 nb_zoom_levels) {
+    this->nb_zoom_levels = nb_zoom_levels;
+    this->m_nb_zoom_levels_isSet = true;
+}
+
+qint32
+SWGWaterfallSettings::getMemoryTiles() {
+    return memory_tiles;
+}
+void
+SWGWaterfallSettings::setMemoryTiles(qint32 memory_tiles) {
+    this->memory_tiles = memory_tiles;
+    this->m_memory_tiles_isSet = true;
+}
+
+QString*
+SWGWaterfallSettings::getDirectory() {
+    return directory;
+}
+void
+SWGWaterfallSettings::setDirectory(QString* directory) {
+    this->directory = directory;
+    this->m_directory_isSet = true;
+}
+
+
+bool
+SWGWaterfallSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_enabled_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fft_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_line_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_min_level_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_max_level_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_tile_lines_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_tile_bins_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_zoom_levels_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_memory_tiles_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(directory && *directory != QString("")){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,113 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGWaterfallSettings.h
+ *
+ * Server side waterfall tiles settings of a device set
+ */
+
+#ifndef SWGWaterfallSettings_H_
+#define SWGWaterfallSettings_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGWaterfallSettings: public SWGObject {
+public:
+    SWGWaterfallSettings();
+    SWGWaterfallSettings(QString* json);
+    virtual ~SWGWaterfallSettings();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGWaterfallSettings* fromJson(QString &jsonString) override;
+
+    qint32 getEnabled();
+    void setEnabled(qint32 enabled);
+
+    qint32 getFftSize();
+    void setFftSize(qint32 fft_size);
+
+    float getLineRate();
+    void setLineRate(float line_rate);
+
+    float getMinLevel();
+    void setMinLevel(float min_level);
+
+    float getMaxLevel();
+    void setMaxLevel(float max_level);
+
+    qint32 getTileLines();
+    void setTileLines(qint32 tile_lines);
+
+    qint32 getTileBins();
+    void setTileBins(qint32 tile_bins);
+
+    qint32 getNbZoomLevels();
+    void setNbZoomLevels(qint32 nb_zoom_levels);
+
+    qint32 getMemoryTiles();
+    void setMemoryTiles(qint32 memory_tiles);
+
+    QString* getDirectory();
+    void setDirectory(QString* directory);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 enabled;
+    bool m_enabled_isSet;
+
+    qint32 fft_size;
+    bool m_fft_size_isSet;
+
+    float line_rate;
+    bool m_line_rate_isSet;
+
+    float min_level;
+    bool m_min_level_isSet;
+
+    float max_level;
+    bool m_max_level_isSet;
+
+    qint32 tile_lines;
+    bool m_tile_lines_isSet;
+
+    qint32 tile_bins;
+    bool m_tile_bins_isSet;
+
+    qint32 nb_zoom_levels;
+    bool m_nb_zoom_levels_isSet;
+
+    qint32 memory_tiles;
+    bool m_memory_tiles_isSet;
+
+    QString* directory;
+    bool m_directory_isSet;
+
+};
+
+}
+
+#endif /* SWGWaterfallSettings_H_ */
@@ -0,0 +1,409 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGWaterfallTile.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGWaterfallTile::SWGWaterfallTile(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGWaterfallTile::SWGWaterfallTile() {
+    zoom = 0;
+    m_zoom_isSet = false;
+    time_index = 0L;
+    m_time_index_isSet = false;
+    freq_index = 0;
+    m_freq_index_isSet = false;
+    lines = 0;
+    m_lines_isSet = false;
+    bins = 0;
+    m_bins_isSet = false;
+    filled_lines = 0;
+    m_filled_lines_isSet = false;
+    start_ms = 0L;
+    m_start_ms_isSet = false;
+    end_ms = 0L;
+    m_end_ms_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    min_level = 0.0f;
+    m_min_level_isSet = false;
+    max_level = 0.0f;
+    m_max_level_isSet = false;
+    data = nullptr;
+    m_data_isSet = false;
+}
+
+SWGWaterfallTile::~SWGWaterfallTile() {
+    this->cleanup();
+}
+
+void
+SWGWaterfallTile::init() {
+    zoom = 0;
+    m_zoom_isSet = false;
+    time_index = 0L;
+    m_time_index_isSet = false;
+    freq_index = 0;
+    m_freq_index_isSet = false;
+    lines = 0;
+    m_lines_isSet = false;
+    bins = 0;
+    m_bins_isSet = false;
+    filled_lines = 0;
+    m_filled_lines_isSet = false;
+    start_ms = 0L;
+    m_start_ms_isSet = false;
+    end_ms = 0L;
+    m_end_ms_isSet = false;
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    fft_size = 0;
+    m_fft_size_isSet = false;
+    min_level = 0.0f;
+    m_min_level_isSet = false;
+    max_level = 0.0f;
+    m_max_level_isSet = false;
+    data = new QString("");
+    m_data_isSet = false;
+}
+
+void
+SWGWaterfallTile::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+
+
+    if(data != nullptr) { 
+        delete data;
+    }
+}
+
+SWGWaterfallTile*
+SWGWaterfallTile::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGWaterfallTile::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&zoom, pJson["zoom"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&time_index, pJson["timeIndex"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&freq_index, pJson["freqIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lines, pJson["lines"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&bins, pJson["bins"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&filled_lines, pJson["filledLines"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&start_ms, pJson["startMs"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&end_ms, pJson["endMs"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&center_frequency, pJson["centerFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fft_size, pJson["fftSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&min_level, pJson["minLevel"], "float", "");
+    
+    ::SWGSDRangel::setValue(&max_level, pJson["maxLevel"], "float", "");
+    
+    ::SWGSDRangel::setValue(&data, pJson["data"], "QString", "QString");
+    
+}
+
+QString
+SWGWaterfallTile::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGWaterfallTile::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_zoom_isSet){
+        obj->insert("zoom", QJsonValue(zoom));
+    }
+    if(m_time_index_isSet){
+        obj->insert("timeIndex", QJsonValue(time_index));
+    }
+    if(m_freq_index_isSet){
+        obj->insert("freqIndex", QJsonValue(freq_index));
+    }
+    if(m_lines_isSet){
+        obj->insert("lines", QJsonValue(lines));
+    }
+    if(m_bins_isSet){
+        obj->insert("bins", QJsonValue(bins));
+    }
+    if(m_filled_lines_isSet){
+        obj->insert("filledLines", QJsonValue(filled_lines));
+    }
+    if(m_start_ms_isSet){
+        obj->insert("startMs", QJsonValue(start_ms));
+    }
+    if(m_end_ms_isSet){
+        obj->insert("endMs", QJsonValue(end_ms));
+    }
+    if(m_center_frequency_isSet){
+        obj->insert("centerFrequency", QJsonValue(center_frequency));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_fft_size_isSet){
+        obj->insert("fftSize", QJsonValue(fft_size));
+    }
+    if(m_min_level_isSet){
+        obj->insert("minLevel", QJsonValue(min_level));
+    }
+    if(m_max_level_isSet){
+        obj->insert("maxLevel", QJsonValue(max_level));
+    }
+    if(data != nullptr && *data != QString("")){
+        toJsonValue(QString("data"), data, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGWaterfallTile::getZoom() {
+    return zoom;
+}
+void
+SWGWaterfallTile::setZoom(qint32 zoom) {
+    this->zoom = zoom;
+    this->m_zoom_isSet = true;
+}
+
+qint64
+SWGWaterfallTile::getTimeIndex() {
+    return time_index;
+}
+void
+SWGWaterfallTile::setTimeIndex(qint64 time_index) {
+    this->time_index = time_index;
+    this->m_time_index_isSet = true;
+}
+
+qint32
+SWGWaterfallTile::getFreqIndex() {
+    return freq_index;
+}
+void
+SWGWaterfallTile::setFreqIndex(qint32 freq_index) {
+    this->freq_index = freq_index;
+    this->m_freq_index_isSet = true;
+}
+
+qint32
+SWGWaterfallTile::getLines() {
+    return lines;
+}
+void
+SWGWaterfallTile::setLines(qint32 lines) {
+    this->lines = lines;
+    this->m_lines_isSet = true;
+}
+
+qint32
+SWGWaterfallTile::getBins() {
+    return bins;
+}
+void
+SWGWaterfallTile::setBins(qint32 bins) {
+    this->bins = bins;
+    this->m_bins_isSet = true;
+}
+
+qint32
+SWGWaterfallTile::getFilledLines() {
+    return filled_lines;
+}
+void
+SWGWaterfallTile::setFilledLines(qint32 filled_lines) {
+    this->filled_lines = filled_lines;
+    this->m_filled_lines_isSet = true;
+}
+
+qint64
+SWGWaterfallTile::getStartMs() {
+    return start_ms;
+}
+void
+SWGWaterfallTile::setStartMs(qint64 start_ms) {
+    this->start_ms = start_ms;
+    this->m_start_ms_isSet = true;
+}
+
+qint64
+SWGWaterfallTile::getEndMs() {
+    return end_ms;
+}
+void
+SWGWaterfallTile::setEndMs(qint64 end_ms) {
+    this->end_ms = end_ms;
+    this->m_end_ms_isSet = true;
+}
+
+qint64
+SWGWaterfallTile::getCenterFrequency() {
+    return center_frequency;
+}
+void
+SWGWaterfallTile::setCenterFrequency(qint64 center_frequency) {
+    this->center_frequency = center_frequency;
+    this->m_center_frequency_isSet = true;
+}
+
+qint32
+SWGWaterfallTile::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGWaterfallTile::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+qint32
+SWGWaterfallTile::getFftSize() {
+    return fft_size;
+}
+void
+SWGWaterfallTile::setFftSize(qint32 fft_size) {
+    this->fft_size = fft_size;
+    this->m_fft_size_isSet = true;
+}
+
+float
+SWGWaterfallTile::getMinLevel() {
+    return min_level;
+}
+void
+SWGWaterfallTile::setMinLevel(float min_level) {
+    this->min_level = min_level;
+    this->m_min_level_isSet = true;
+}
+
+float
+SWGWaterfallTile::getMaxLevel() {
+    return max_level;
+}
+void
+SWGWaterfallTile::setMaxLevel(float max_level) {
+    this->max_level = max_level;
+    this->m_max_level_isSet = true;
+}
+
+QString*
+SWGWaterfallTile::getData() {
+    return data;
+}
+void
+SWGWaterfallTile::setData(QString* data) {
+    this->data = data;
+    this->m_data_isSet = true;
+}
+
+
+bool
+SWGWaterfallTile::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_zoom_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_time_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_freq_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lines_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_bins_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_filled_lines_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_start_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_end_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_center_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fft_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_min_level_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_max_level_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(data && *data != QString("")){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,137 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGWaterfallTile.h
+ *
+ * Waterfall tile of 8 bit levels
+ */
+
+#ifndef SWGWaterfallTile_H_
+#define SWGWaterfallTile_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGWaterfallTile: public SWGObject {
+public:
+    SWGWaterfallTile();
+    SWGWaterfallTile(QString* json);
+    virtual ~SWGWaterfallTile();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGWaterfallTile* fromJson(QString &jsonString) override;
+
+    qint32 getZoom();
+    void setZoom(qint32 zoom);
+
+    qint64 getTimeIndex();
+    void setTimeIndex(qint64 time_index);
+
+    qint32 getFreqIndex();
+    void setFreqIndex(qint32 freq_index);
+
+    qint32 getLines();
+    void setLines(qint32 lines);
+
+    qint32 getBins();
+    void setBins(qint32 bins);
+
+    qint32 getFilledLines();
+    void setFilledLines(qint32 filled_lines);
+
+    qint64 getStartMs();
+    void setStartMs(qint64 start_ms);
+
+    qint64 getEndMs();
+    void setEndMs(qint64 end_ms);
+
+    qint64 getCenterFrequency();
+    void setCenterFrequency(qint64 center_frequency);
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+    qint32 getFftSize();
+    void setFftSize(qint32 fft_size);
+
+    float getMinLevel();
+    void setMinLevel(float min_level);
+
+    float getMaxLevel();
+    void setMaxLevel(float max_level);
+
+    QString* getData();
+    void setData(QString* data);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 zoom;
+    bool m_zoom_isSet;
+
+    qint64 time_index;
+    bool m_time_index_isSet;
+
+    qint32 freq_index;
+    bool m_freq_index_isSet;
+
+    qint32 lines;
+    bool m_lines_isSet;
+
+    qint32 bins;
+    bool m_bins_isSet;
+
+    qint32 filled_lines;
+    bool m_filled_lines_isSet;
+
+    qint64 start_ms;
+    bool m_start_ms_isSet;
+
+    qint64 end_ms;
+    bool m_end_ms_isSet;
+
+    qint64 center_frequency;
+    bool m_center_frequency_isSet;
+
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+    qint32 fft_size;
+    bool m_fft_size_isSet;
+
+    float min_level;
+    bool m_min_level_isSet;
+
+    float max_level;
+    bool m_max_level_isSet;
+
+    QString* data;
+    bool m_data_isSet;
+
+};
+
+}
+
+#endif /* SWGWaterfallTile_H_ */
@@ -0,0 +1,246 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGWaterfallZoomLevel.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGWaterfallZoomLevel::SWGWaterfallZoomLevel(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGWaterfallZoomLevel::SWGWaterfallZoomLevel() {
+    zoom = 0;
+    m_zoom_isSet = false;
+    first_time_index = 0L;
+    m_first_time_index_isSet = false;
+    last_time_index = 0L;
+    m_last_time_index_isSet = false;
+    memory_time_index = 0L;
+    m_memory_time_index_isSet = false;
+    nb_freq_tiles = 0;
+    m_nb_freq_tiles_isSet = false;
+    first_start_ms = 0L;
+    m_first_start_ms_isSet = false;
+    last_end_ms = 0L;
+    m_last_end_ms_isSet = false;
+}
+
+SWGWaterfallZoomLevel::~SWGWaterfallZoomLevel() {
+    this->cleanup();
+}
+
+void
+SWGWaterfallZoomLevel::init() {
+    zoom = 0;
+    m_zoom_isSet = false;
+    first_time_index = 0L;
+    m_first_time_index_isSet = false;
+    last_time_index = 0L;
+    m_last_time_index_isSet = false;
+    memory_time_index = 0L;
+    m_memory_time_index_isSet = false;
+    nb_freq_tiles = 0;
+    m_nb_freq_tiles_isSet = false;
+    first_start_ms = 0L;
+    m_first_start_ms_isSet = false;
+    last_end_ms = 0L;
+    m_last_end_ms_isSet = false;
+}
+
+void
+SWGWaterfallZoomLevel::cleanup() {
+
+
+
+
+
+
+
+}
+
+SWGWaterfallZoomLevel*
+SWGWaterfallZoomLevel::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGWaterfallZoomLevel::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&zoom, pJson["zoom"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&first_time_index, pJson["firstTimeIndex"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&last_time_index, pJson["lastTimeIndex"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&memory_time_index, pJson["memoryTimeIndex"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&nb_freq_tiles, pJson["nbFreqTiles"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&first_start_ms, pJson["firstStartMs"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&last_end_ms, pJson["lastEndMs"], "qint64", "");
+    
+}
+
+QString
+SWGWaterfallZoomLevel::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGWaterfallZoomLevel::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_zoom_isSet){
+        obj->insert("zoom", QJsonValue(zoom));
+    }
+    if(m_first_time_index_isSet){
+        obj->insert("firstTimeIndex", QJsonValue(first_time_index));
+    }
+    if(m_last_time_index_isSet){
+        obj->insert("lastTimeIndex", QJsonValue(last_time_index));
+    }
+    if(m_memory_time_index_isSet){
+        obj->insert("memoryTimeIndex", QJsonValue(memory_time_index));
+    }
+    if(m_nb_freq_tiles_isSet){
+        obj->insert("nbFreqTiles", QJsonValue(nb_freq_tiles));
+    }
+    if(m_first_start_ms_isSet){
+        obj->insert("firstStartMs", QJsonValue(first_start_ms));
+    }
+    if(m_last_end_ms_isSet){
+        obj->insert("lastEndMs", QJsonValue(last_end_ms));
+    }
+
+    return obj;
+}
+
+qint32
+SWGWaterfallZoomLevel::getZoom() {
+    return zoom;
+}
+void
+SWGWaterfallZoomLevel::setZoom(qint32 zoom) {
+    this->zoom = zoom;
+    this->m_zoom_isSet = true;
+}
+
+qint64
+SWGWaterfallZoomLevel::getFirstTimeIndex() {
+    return first_time_index;
+}
+void
+SWGWaterfallZoomLevel::setFirstTimeIndex(qint64 first_time_index) {
+    this->first_time_index = first_time_index;
+    this->m_first_time_index_isSet = true;
+}
+
+qint64
+SWGWaterfallZoomLevel::getLastTimeIndex() {
+    return last_time_index;
+}
+void
+SWGWaterfallZoomLevel::setLastTimeIndex(qint64 last_time_index) {
+    this->last_time_index = last_time_index;
+    this->m_last_time_index_isSet = true;
+}
+
+qint64
+SWGWaterfallZoomLevel::getMemoryTimeIndex() {
+    return memory_time_index;
+}
+void
+SWGWaterfallZoomLevel::setMemoryTimeIndex(qint64 memory_time_index) {
+    this->memory_time_index = memory_time_index;
+    this->m_memory_time_index_isSet = true;
+}
+
+qint32
+SWGWaterfallZoomLevel::getNbFreqTiles() {
+    return nb_freq_tiles;
+}
+void
+SWGWaterfallZoomLevel::setNbFreqTiles(qint32 nb_freq_tiles) {
+    this->nb_freq_tiles = nb_freq_tiles;
+    this->m_nb_freq_tiles_isSet = true;
+}
+
+qint64
+SWGWaterfallZoomLevel::getFirstStartMs() {
+    return first_start_ms;
+}
+void
+SWGWaterfallZoomLevel::setFirstStartMs(qint64 first_start_ms) {
+    this->first_start_ms = first_start_ms;
+    this->m_first_start_ms_isSet = true;
+}
+
+qint64
+SWGWaterfallZoomLevel::getLastEndMs() {
+    return last_end_ms;
+}
+void
+SWGWaterfallZoomLevel::setLastEndMs(qint64 last_end_ms) {
+    this->last_end_ms = last_end_ms;
+    this->m_last_end_ms_isSet = true;
+}
+
+
+bool
+SWGWaterfallZoomLevel::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_zoom_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_first_time_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_last_time_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_memory_time_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_nb_freq_tiles_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_first_start_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_last_end_ms_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
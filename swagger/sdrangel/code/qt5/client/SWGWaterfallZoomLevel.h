@@ -0,0 +1,93 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1, USRP and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGWaterfallZoomLevel.h
+ *
+ * Status of a zoom level of the waterfall tiles
+ */
+
+#ifndef SWGWaterfallZoomLevel_H_
+#define SWGWaterfallZoomLevel_H_
+
+#include <QJsonObject>
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGWaterfallZoomLevel: public SWGObject {
+public:
+    SWGWaterfallZoomLevel();
+    SWGWaterfallZoomLevel(QString* json);
+    virtual ~SWGWaterfallZoomLevel();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGWaterfallZoomLevel* fromJson(QString &jsonString) override;
+
+    qint32 getZoom();
+    void setZoom(qint32 zoom);
+
+    qint64 getFirstTimeIndex();
+    void setFirstTimeIndex(qint64 first_time_index);
+
+    qint64 getLastTimeIndex();
+    void setLastTimeIndex(qint64 last_time_index);
+
+    qint64 getMemoryTimeIndex();
+    void setMemoryTimeIndex(qint64 memory_time_index);
+
+    qint32 getNbFreqTiles();
+    void setNbFreqTiles(qint32 nb_freq_tiles);
+
+    qint64 getFirstStartMs();
+    void setFirstStartMs(qint64 first_start_ms);
+
+    qint64 getLastEndMs();
+    void setLastEndMs(qint64 last_end_ms);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 zoom;
+    bool m_zoom_isSet;
+
+    qint64 first_time_index;
+    bool m_first_time_index_isSet;
+
+    qint64 last_time_index;
+    bool m_last_time_index_isSet;
+
+    qint64 memory_time_index;
+    bool m_memory_time_index_isSet;
+
+    qint32 nb_freq_tiles;
+    bool m_nb_freq_tiles_isSet;
+
+    qint64 first_start_ms;
+    bool m_first_start_ms_isSet;
+
+    qint64 last_end_ms;
+    bool m_last_end_ms_isSet;
+
+};
+
+}
+
+#endif /* SWGWaterfallZoomLevel_H_ */